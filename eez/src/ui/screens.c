@@ -14,13 +14,431 @@ objects_t objects;
 lv_obj_t *tick_value_change_obj;
 uint32_t active_theme_index = 0;
 
+// Shared styles (generated by compact_eez_styles.py)
+static lv_style_t style_main_screen;
+static lv_style_t style_top_bar;
+static lv_style_t style_top_bar_wifi_signal;
+static lv_style_t style_top_bar_clock;
+static lv_style_t style_bottom_bar;
+static lv_style_t style_bottom_bar_message;
+static lv_style_t style_main_screen_ams_right_nozzle_indicator;
+static lv_style_t style_main_screen_ams_right_nozzle_text;
+static lv_style_t style_main_screen_ams_ht;
+static lv_style_t style_main_screen_ams_ht_2;
+static lv_style_t style_main_screen_ams_ht_3;
+static lv_style_t style_main_screen_ams_b_label;
+static lv_style_t style_main_screen_ams_b_slot;
+static lv_style_t style_main_screen_ams_b_slot_2;
+static lv_style_t style_main_screen_ams_b_slot_3;
+static lv_style_t style_main_screen_ams_b_slot_4;
+static lv_style_t style_main_screen_button_ams_setup;
+static lv_style_t style_main_screen_button_ams_setup_icon;
+static lv_style_t style_main_screen_button_catalog;
+static lv_style_t style_main_screen_nfc_scale_nfc_logo;
+static lv_style_t style_main_screen_nfc_scale_nfc_label;
+static lv_style_t style_main_screen_ams_c;
+static lv_style_t style_ams_screen_ams_panel_amd_d;
+static lv_style_t style_ams_screen_ams_panel_amd_d_slot;
+static lv_style_t style_ams_screen_ams_panel_amd_d_slot_1_color;
+static lv_style_t style_ams_screen_ams_panel_amd_d_slot_2;
+static lv_style_t style_ams_screen_ams_panel_amd_d_slot_2_color;
+static lv_style_t style_ams_screen_ams_panel_amd_d_slot_3_color;
+static lv_style_t style_ams_screen_ams_panel_amd_d_slot_4_color;
+static lv_style_t style_ams_screen_ams_panel_amd_d_slot_3_label_material;
+static lv_style_t style_ams_screen_ams_panel_amd_d_slot_2_label_slotname;
+static lv_style_t style_ams_screen_ams_panel_amd_d_icon_thermometer;
+static lv_style_t style_ams_screen_ams_panel_ext_1_icon_empty;
+static lv_style_t style_scan_screen_main_panel;
+static lv_style_t style_scan_screen_main_panel_top_panel_icon_ok;
+static lv_style_t style_scan_screen_main_panel_spool_panel;
+static lv_style_t style_scan_screen_main_panel_spool_panel_label_weight;
+static lv_style_t style_scan_screen_main_panel_spool_panel_label_filament;
+static lv_style_t style_scan_screen_main_panel_spool_panel_label_filament_color;
+static lv_style_t style_scan_screen_main_panel_spool_panel_label_k_factor;
+static lv_style_t style_scan_screen_main_panel_spool_panel_label_weight_percentage;
+static lv_style_t style_scan_screen_main_panel_ams_panel_ams_a_label_name;
+static lv_style_t style_scan_screen_main_panel_ams_panel_ams_a_slot;
+static lv_style_t style_scan_screen_main_panel_ams_panel_ams_a_indicator;
+static lv_style_t style_scan_screen_button_assign_save;
+static lv_style_t style_scan_screen_button_assign_save_label;
+static lv_style_t style_spool_screen_main_panel_button_edit;
+static lv_style_t style_spool_screen_main_panel_middle_panel;
+static lv_style_t style_settings_screen_tabs_printers;
+static lv_style_t style_settings_screen_tabs_printers_label;
+static lv_style_t style_settings_screen_tabs_network_content;
+static lv_style_t style_settings_screen_tabs_network_content_wifi;
+static lv_style_t style_settings_screen_tabs_network_content_wifi_label_name;
+static lv_style_t style_settings_screen_tabs_network_content_wifi_icon_select;
+static lv_style_t style_settings_wifi_screen_content_panel_;
+static lv_style_t style_settings_wifi_screen_content_panel_label_wifi;
+static lv_style_t style_settings_wifi_screen_content_panel_input_ssid;
+static lv_style_t style_settings_wifi_screen_content_panel_button_connect_;
+static lv_style_t style_settings_printer_add_screen_panel_panel_input_name;
+static lv_style_t style_settings_display_screen_content_panel_label_brightness_slider;
+
+static void init_shared_styles() {
+    static bool initialized = false;
+    if (initialized) return;
+    initialized = true;
+    lv_style_init(&style_main_screen);
+    lv_style_set_bg_color(&style_main_screen, lv_color_hex(0xff1a1a1a));
+    lv_style_set_bg_opa(&style_main_screen, 255);
+    lv_style_init(&style_top_bar);
+    lv_style_set_pad_left(&style_top_bar, 0);
+    lv_style_set_pad_top(&style_top_bar, 0);
+    lv_style_set_pad_right(&style_top_bar, 0);
+    lv_style_set_pad_bottom(&style_top_bar, 0);
+    lv_style_set_radius(&style_top_bar, 0);
+    lv_style_set_bg_color(&style_top_bar, lv_color_hex(0xff000000));
+    lv_style_set_bg_opa(&style_top_bar, 255);
+    lv_style_set_border_color(&style_top_bar, lv_color_hex(0xff3d3d3d));
+    lv_style_set_border_opa(&style_top_bar, 255);
+    lv_style_set_border_width(&style_top_bar, 1);
+    lv_style_set_border_side(&style_top_bar, LV_BORDER_SIDE_BOTTOM);
+    lv_style_init(&style_top_bar_wifi_signal);
+    lv_style_set_image_opa(&style_top_bar_wifi_signal, 255);
+    lv_style_set_image_recolor(&style_top_bar_wifi_signal, lv_color_hex(0xff00ff00));
+    lv_style_set_image_recolor_opa(&style_top_bar_wifi_signal, 255);
+    lv_style_init(&style_top_bar_clock);
+    lv_style_set_text_font(&style_top_bar_clock, &lv_font_montserrat_18);
+    lv_style_init(&style_bottom_bar);
+    lv_style_set_pad_left(&style_bottom_bar, 0);
+    lv_style_set_pad_top(&style_bottom_bar, 0);
+    lv_style_set_pad_right(&style_bottom_bar, 0);
+    lv_style_set_pad_bottom(&style_bottom_bar, 0);
+    lv_style_set_radius(&style_bottom_bar, 0);
+    lv_style_set_bg_color(&style_bottom_bar, lv_color_hex(0xff000000));
+    lv_style_set_bg_opa(&style_bottom_bar, 255);
+    lv_style_set_border_color(&style_bottom_bar, lv_color_hex(0xfffaaa05));
+    lv_style_set_border_opa(&style_bottom_bar, 255);
+    lv_style_set_border_width(&style_bottom_bar, 2);
+    lv_style_set_border_side(&style_bottom_bar, LV_BORDER_SIDE_TOP);
+    lv_style_init(&style_bottom_bar_message);
+    lv_style_set_text_font(&style_bottom_bar_message, &lv_font_montserrat_12);
+    lv_style_init(&style_main_screen_ams_right_nozzle_indicator);
+    lv_style_set_bg_color(&style_main_screen_ams_right_nozzle_indicator, lv_color_hex(0xff00ff00));
+    lv_style_set_bg_opa(&style_main_screen_ams_right_nozzle_indicator, 255);
+    lv_style_set_text_color(&style_main_screen_ams_right_nozzle_indicator, lv_color_hex(0xff000000));
+    lv_style_set_text_font(&style_main_screen_ams_right_nozzle_indicator, &lv_font_montserrat_10);
+    lv_style_set_text_align(&style_main_screen_ams_right_nozzle_indicator, LV_TEXT_ALIGN_CENTER);
+    lv_style_set_text_opa(&style_main_screen_ams_right_nozzle_indicator, 255);
+    lv_style_init(&style_main_screen_ams_right_nozzle_text);
+    lv_style_set_text_font(&style_main_screen_ams_right_nozzle_text, &lv_font_montserrat_10);
+    lv_style_init(&style_main_screen_ams_ht);
+    lv_style_set_arc_width(&style_main_screen_ams_ht, 0);
+    lv_style_set_arc_rounded(&style_main_screen_ams_ht, false);
+    lv_style_set_arc_opa(&style_main_screen_ams_ht, 255);
+    lv_style_set_layout(&style_main_screen_ams_ht, LV_LAYOUT_NONE);
+    lv_style_set_bg_color(&style_main_screen_ams_ht, lv_color_hex(0xff000000));
+    lv_style_set_shadow_width(&style_main_screen_ams_ht, 5);
+    lv_style_set_shadow_ofs_x(&style_main_screen_ams_ht, 2);
+    lv_style_set_shadow_ofs_y(&style_main_screen_ams_ht, 2);
+    lv_style_set_shadow_spread(&style_main_screen_ams_ht, 2);
+    lv_style_set_shadow_opa(&style_main_screen_ams_ht, 100);
+    lv_style_set_border_width(&style_main_screen_ams_ht, 3);
+    lv_style_init(&style_main_screen_ams_ht_2);
+    lv_style_set_text_color(&style_main_screen_ams_ht_2, lv_color_hex(0xfffafafa));
+    lv_style_set_text_opa(&style_main_screen_ams_ht_2, 255);
+    lv_style_set_text_font(&style_main_screen_ams_ht_2, &lv_font_montserrat_12);
+    lv_style_init(&style_main_screen_ams_ht_3);
+    lv_style_set_bg_color(&style_main_screen_ams_ht_3, lv_color_hex(0xff726e6e));
+    lv_style_set_bg_opa(&style_main_screen_ams_ht_3, 255);
+    lv_style_set_radius(&style_main_screen_ams_ht_3, 5);
+    lv_style_set_clip_corner(&style_main_screen_ams_ht_3, true);
+    lv_style_set_border_color(&style_main_screen_ams_ht_3, lv_color_hex(0xffbab1b1));
+    lv_style_set_border_opa(&style_main_screen_ams_ht_3, 255);
+    lv_style_set_border_width(&style_main_screen_ams_ht_3, 2);
+    lv_style_set_bg_grad_dir(&style_main_screen_ams_ht_3, LV_GRAD_DIR_VER);
+    lv_style_set_bg_grad_stop(&style_main_screen_ams_ht_3, 200);
+    lv_style_set_bg_main_stop(&style_main_screen_ams_ht_3, 100);
+    lv_style_set_bg_grad_color(&style_main_screen_ams_ht_3, lv_color_hex(0xff352a2a));
+    lv_style_init(&style_main_screen_ams_b_label);
+    lv_style_set_text_color(&style_main_screen_ams_b_label, lv_color_hex(0xfffafafa));
+    lv_style_set_text_opa(&style_main_screen_ams_b_label, 255);
+    lv_style_set_text_font(&style_main_screen_ams_b_label, &lv_font_montserrat_14);
+    lv_style_init(&style_main_screen_ams_b_slot);
+    lv_style_set_bg_color(&style_main_screen_ams_b_slot, lv_color_hex(0xffec0a0a));
+    lv_style_set_bg_opa(&style_main_screen_ams_b_slot, 255);
+    lv_style_set_radius(&style_main_screen_ams_b_slot, 5);
+    lv_style_set_clip_corner(&style_main_screen_ams_b_slot, true);
+    lv_style_set_border_color(&style_main_screen_ams_b_slot, lv_color_hex(0xffbab1b1));
+    lv_style_set_border_opa(&style_main_screen_ams_b_slot, 255);
+    lv_style_set_border_width(&style_main_screen_ams_b_slot, 2);
+    lv_style_init(&style_main_screen_ams_b_slot_2);
+    lv_style_set_bg_color(&style_main_screen_ams_b_slot_2, lv_color_hex(0xff0a40ec));
+    lv_style_set_bg_opa(&style_main_screen_ams_b_slot_2, 255);
+    lv_style_set_border_color(&style_main_screen_ams_b_slot_2, lv_color_hex(0xffbab1b1));
+    lv_style_set_border_opa(&style_main_screen_ams_b_slot_2, 255);
+    lv_style_set_border_width(&style_main_screen_ams_b_slot_2, 2);
+    lv_style_set_radius(&style_main_screen_ams_b_slot_2, 5);
+    lv_style_set_clip_corner(&style_main_screen_ams_b_slot_2, true);
+    lv_style_init(&style_main_screen_ams_b_slot_3);
+    lv_style_set_bg_color(&style_main_screen_ams_b_slot_3, lv_color_hex(0xffece90a));
+    lv_style_set_bg_opa(&style_main_screen_ams_b_slot_3, 255);
+    lv_style_set_border_color(&style_main_screen_ams_b_slot_3, lv_color_hex(0xffbab1b1));
+    lv_style_set_border_opa(&style_main_screen_ams_b_slot_3, 255);
+    lv_style_set_border_width(&style_main_screen_ams_b_slot_3, 2);
+    lv_style_set_clip_corner(&style_main_screen_ams_b_slot_3, true);
+    lv_style_set_radius(&style_main_screen_ams_b_slot_3, 5);
+    lv_style_init(&style_main_screen_ams_b_slot_4);
+    lv_style_set_bg_color(&style_main_screen_ams_b_slot_4, lv_color_hex(0xff146819));
+    lv_style_set_bg_opa(&style_main_screen_ams_b_slot_4, 255);
+    lv_style_set_border_color(&style_main_screen_ams_b_slot_4, lv_color_hex(0xffbab1b1));
+    lv_style_set_border_opa(&style_main_screen_ams_b_slot_4, 255);
+    lv_style_set_border_width(&style_main_screen_ams_b_slot_4, 2);
+    lv_style_set_clip_corner(&style_main_screen_ams_b_slot_4, true);
+    lv_style_set_radius(&style_main_screen_ams_b_slot_4, 5);
+    lv_style_init(&style_main_screen_button_ams_setup);
+    lv_style_set_bg_color(&style_main_screen_button_ams_setup, lv_color_hex(0xff2d2d2d));
+    lv_style_set_shadow_width(&style_main_screen_button_ams_setup, 1);
+    lv_style_set_shadow_ofs_x(&style_main_screen_button_ams_setup, 2);
+    lv_style_set_shadow_ofs_y(&style_main_screen_button_ams_setup, 1);
+    lv_style_set_shadow_spread(&style_main_screen_button_ams_setup, 1);
+    lv_style_set_shadow_color(&style_main_screen_button_ams_setup, lv_color_hex(0xff796666));
+    lv_style_set_shadow_opa(&style_main_screen_button_ams_setup, 100);
+    lv_style_init(&style_main_screen_button_ams_setup_icon);
+    lv_style_set_bg_color(&style_main_screen_button_ams_setup_icon, lv_color_hex(0xff000000));
+    lv_style_set_bg_opa(&style_main_screen_button_ams_setup_icon, 255);
+    lv_style_set_image_opa(&style_main_screen_button_ams_setup_icon, 255);
+    lv_style_set_image_recolor(&style_main_screen_button_ams_setup_icon, lv_color_hex(0xff00ff00));
+    lv_style_set_image_recolor_opa(&style_main_screen_button_ams_setup_icon, 255);
+    lv_style_set_bg_grad_dir(&style_main_screen_button_ams_setup_icon, LV_GRAD_DIR_HOR);
+    lv_style_set_bg_grad_color(&style_main_screen_button_ams_setup_icon, lv_color_hex(0xff5f5b5b));
+    lv_style_set_bg_grad_stop(&style_main_screen_button_ams_setup_icon, 255);
+    lv_style_set_border_color(&style_main_screen_button_ams_setup_icon, lv_color_hex(0xff000000));
+    lv_style_set_border_opa(&style_main_screen_button_ams_setup_icon, 255);
+    lv_style_set_border_width(&style_main_screen_button_ams_setup_icon, 2);
+    lv_style_set_border_side(&style_main_screen_button_ams_setup_icon, LV_BORDER_SIDE_FULL);
+    lv_style_set_outline_width(&style_main_screen_button_ams_setup_icon, 2);
+    lv_style_set_outline_color(&style_main_screen_button_ams_setup_icon, lv_color_hex(0xff000000));
+    lv_style_set_outline_opa(&style_main_screen_button_ams_setup_icon, 255);
+    lv_style_set_radius(&style_main_screen_button_ams_setup_icon, 10);
+    lv_style_set_clip_corner(&style_main_screen_button_ams_setup_icon, true);
+    lv_style_init(&style_main_screen_button_catalog);
+    lv_style_set_bg_color(&style_main_screen_button_catalog, lv_color_hex(0xff1a1a1a));
+    lv_style_set_bg_opa(&style_main_screen_button_catalog, 128);
+    lv_style_set_shadow_opa(&style_main_screen_button_catalog, 0);
+    lv_style_init(&style_main_screen_nfc_scale_nfc_logo);
+    lv_style_set_image_recolor(&style_main_screen_nfc_scale_nfc_logo, lv_color_hex(0xff00ff00));
+    lv_style_set_image_recolor_opa(&style_main_screen_nfc_scale_nfc_logo, 255);
+    lv_style_set_image_opa(&style_main_screen_nfc_scale_nfc_logo, 100);
+    lv_style_init(&style_main_screen_nfc_scale_nfc_label);
+    lv_style_set_text_color(&style_main_screen_nfc_scale_nfc_label, lv_color_hex(0xff00ff00));
+    lv_style_set_text_opa(&style_main_screen_nfc_scale_nfc_label, 125);
+    lv_style_set_text_font(&style_main_screen_nfc_scale_nfc_label, &lv_font_montserrat_16);
+    lv_style_init(&style_main_screen_ams_c);
+    lv_style_set_arc_width(&style_main_screen_ams_c, 0);
+    lv_style_set_arc_rounded(&style_main_screen_ams_c, false);
+    lv_style_set_arc_opa(&style_main_screen_ams_c, 255);
+    lv_style_set_layout(&style_main_screen_ams_c, LV_LAYOUT_NONE);
+    lv_style_set_bg_color(&style_main_screen_ams_c, lv_color_hex(0xff000000));
+    lv_style_set_shadow_width(&style_main_screen_ams_c, 5);
+    lv_style_set_shadow_ofs_x(&style_main_screen_ams_c, 2);
+    lv_style_set_shadow_ofs_y(&style_main_screen_ams_c, 2);
+    lv_style_set_shadow_spread(&style_main_screen_ams_c, 2);
+    lv_style_set_shadow_opa(&style_main_screen_ams_c, 100);
+    lv_style_set_border_color(&style_main_screen_ams_c, lv_color_hex(0xff2f3237));
+    lv_style_set_border_width(&style_main_screen_ams_c, 3);
+    lv_style_init(&style_ams_screen_ams_panel_amd_d);
+    lv_style_set_bg_color(&style_ams_screen_ams_panel_amd_d, lv_color_hex(0xff000000));
+    lv_style_set_bg_grad_dir(&style_ams_screen_ams_panel_amd_d, LV_GRAD_DIR_VER);
+    lv_style_set_bg_grad_color(&style_ams_screen_ams_panel_amd_d, lv_color_hex(0xff545151));
+    lv_style_set_bg_grad_stop(&style_ams_screen_ams_panel_amd_d, 255);
+    lv_style_set_bg_main_opa(&style_ams_screen_ams_panel_amd_d, 128);
+    lv_style_set_bg_grad_opa(&style_ams_screen_ams_panel_amd_d, 128);
+    lv_style_set_shadow_width(&style_ams_screen_ams_panel_amd_d, 1);
+    lv_style_set_shadow_ofs_x(&style_ams_screen_ams_panel_amd_d, 2);
+    lv_style_set_shadow_ofs_y(&style_ams_screen_ams_panel_amd_d, 1);
+    lv_style_set_shadow_spread(&style_ams_screen_ams_panel_amd_d, 1);
+    lv_style_set_shadow_opa(&style_ams_screen_ams_panel_amd_d, 100);
+    lv_style_set_shadow_color(&style_ams_screen_ams_panel_amd_d, lv_color_hex(0xff000000));
+    lv_style_set_border_color(&style_ams_screen_ams_panel_amd_d, lv_color_hex(0xff3d3d3d));
+    lv_style_set_border_opa(&style_ams_screen_ams_panel_amd_d, 255);
+    lv_style_set_border_width(&style_ams_screen_ams_panel_amd_d, 2);
+    lv_style_init(&style_ams_screen_ams_panel_amd_d_slot);
+    lv_style_set_bg_color(&style_ams_screen_ams_panel_amd_d_slot, lv_color_hex(0xff000000));
+    lv_style_set_bg_opa(&style_ams_screen_ams_panel_amd_d_slot, 0);
+    lv_style_init(&style_ams_screen_ams_panel_amd_d_slot_1_color);
+    lv_style_set_image_opa(&style_ams_screen_ams_panel_amd_d_slot_1_color, 255);
+    lv_style_set_image_recolor(&style_ams_screen_ams_panel_amd_d_slot_1_color, lv_color_hex(0xfff70303));
+    lv_style_set_image_recolor_opa(&style_ams_screen_ams_panel_amd_d_slot_1_color, 255);
+    lv_style_init(&style_ams_screen_ams_panel_amd_d_slot_2);
+    lv_style_set_border_color(&style_ams_screen_ams_panel_amd_d_slot_2, lv_color_hex(0xff00ff00));
+    lv_style_set_border_width(&style_ams_screen_ams_panel_amd_d_slot_2, 0);
+    lv_style_set_bg_color(&style_ams_screen_ams_panel_amd_d_slot_2, lv_color_hex(0xff000000));
+    lv_style_set_bg_opa(&style_ams_screen_ams_panel_amd_d_slot_2, 0);
+    lv_style_init(&style_ams_screen_ams_panel_amd_d_slot_2_color);
+    lv_style_set_image_opa(&style_ams_screen_ams_panel_amd_d_slot_2_color, 255);
+    lv_style_set_image_recolor(&style_ams_screen_ams_panel_amd_d_slot_2_color, lv_color_hex(0xff3603f7));
+    lv_style_set_image_recolor_opa(&style_ams_screen_ams_panel_amd_d_slot_2_color, 255);
+    lv_style_init(&style_ams_screen_ams_panel_amd_d_slot_3_color);
+    lv_style_set_image_opa(&style_ams_screen_ams_panel_amd_d_slot_3_color, 255);
+    lv_style_set_image_recolor(&style_ams_screen_ams_panel_amd_d_slot_3_color, lv_color_hex(0xff509405));
+    lv_style_set_image_recolor_opa(&style_ams_screen_ams_panel_amd_d_slot_3_color, 255);
+    lv_style_init(&style_ams_screen_ams_panel_amd_d_slot_4_color);
+    lv_style_set_image_opa(&style_ams_screen_ams_panel_amd_d_slot_4_color, 255);
+    lv_style_set_image_recolor(&style_ams_screen_ams_panel_amd_d_slot_4_color, lv_color_hex(0xfffad607));
+    lv_style_set_image_recolor_opa(&style_ams_screen_ams_panel_amd_d_slot_4_color, 255);
+    lv_style_init(&style_ams_screen_ams_panel_amd_d_slot_3_label_material);
+    lv_style_set_text_font(&style_ams_screen_ams_panel_amd_d_slot_3_label_material, &lv_font_montserrat_10);
+    lv_style_set_text_color(&style_ams_screen_ams_panel_amd_d_slot_3_label_material, lv_color_hex(0xfffafafa));
+    lv_style_init(&style_ams_screen_ams_panel_amd_d_slot_2_label_slotname);
+    lv_style_set_text_font(&style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, &lv_font_montserrat_10);
+    lv_style_set_text_color(&style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, lv_color_hex(0xfffafafa));
+    lv_style_set_text_align(&style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_TEXT_ALIGN_CENTER);
+    lv_style_set_radius(&style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, 5);
+    lv_style_set_clip_corner(&style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, true);
+    lv_style_init(&style_ams_screen_ams_panel_amd_d_icon_thermometer);
+    lv_style_set_image_recolor(&style_ams_screen_ams_panel_amd_d_icon_thermometer, lv_color_hex(0xff1967ea));
+    lv_style_set_image_recolor_opa(&style_ams_screen_ams_panel_amd_d_icon_thermometer, 255);
+    lv_style_init(&style_ams_screen_ams_panel_ext_1_icon_empty);
+    lv_style_set_image_recolor(&style_ams_screen_ams_panel_ext_1_icon_empty, lv_color_hex(0xffffffff));
+    lv_style_set_image_opa(&style_ams_screen_ams_panel_ext_1_icon_empty, 100);
+    lv_style_init(&style_scan_screen_main_panel);
+    lv_style_set_bg_color(&style_scan_screen_main_panel, lv_color_hex(0xff2d2d2d));
+    lv_style_set_border_color(&style_scan_screen_main_panel, lv_color_hex(0xff3d3d3d));
+    lv_style_set_border_width(&style_scan_screen_main_panel, 1);
+    lv_style_set_shadow_width(&style_scan_screen_main_panel, 1);
+    lv_style_set_shadow_ofs_x(&style_scan_screen_main_panel, 2);
+    lv_style_set_shadow_ofs_y(&style_scan_screen_main_panel, 1);
+    lv_style_set_shadow_spread(&style_scan_screen_main_panel, 1);
+    lv_style_set_shadow_opa(&style_scan_screen_main_panel, 100);
+    lv_style_init(&style_scan_screen_main_panel_top_panel_icon_ok);
+    lv_style_set_image_recolor(&style_scan_screen_main_panel_top_panel_icon_ok, lv_color_hex(0xff00ff00));
+    lv_style_set_image_recolor_opa(&style_scan_screen_main_panel_top_panel_icon_ok, 255);
+    lv_style_init(&style_scan_screen_main_panel_spool_panel);
+    lv_style_set_shadow_width(&style_scan_screen_main_panel_spool_panel, 1);
+    lv_style_set_shadow_ofs_x(&style_scan_screen_main_panel_spool_panel, 2);
+    lv_style_set_shadow_ofs_y(&style_scan_screen_main_panel_spool_panel, 1);
+    lv_style_set_shadow_spread(&style_scan_screen_main_panel_spool_panel, 1);
+    lv_style_set_shadow_opa(&style_scan_screen_main_panel_spool_panel, 100);
+    lv_style_set_border_color(&style_scan_screen_main_panel_spool_panel, lv_color_hex(0xff2f3237));
+    lv_style_init(&style_scan_screen_main_panel_spool_panel_label_weight);
+    lv_style_set_radius(&style_scan_screen_main_panel_spool_panel_label_weight, 2);
+    lv_style_set_clip_corner(&style_scan_screen_main_panel_spool_panel_label_weight, true);
+    lv_style_set_text_color(&style_scan_screen_main_panel_spool_panel_label_weight, lv_color_hex(0xfffafafa));
+    lv_style_init(&style_scan_screen_main_panel_spool_panel_label_filament);
+    lv_style_set_text_color(&style_scan_screen_main_panel_spool_panel_label_filament, lv_color_hex(0xffffffff));
+    lv_style_init(&style_scan_screen_main_panel_spool_panel_label_filament_color);
+    lv_style_set_text_color(&style_scan_screen_main_panel_spool_panel_label_filament_color, lv_color_hex(0xfffafafa));
+    lv_style_init(&style_scan_screen_main_panel_spool_panel_label_k_factor);
+    lv_style_set_text_color(&style_scan_screen_main_panel_spool_panel_label_k_factor, lv_color_hex(0xffaca7a7));
+    lv_style_init(&style_scan_screen_main_panel_spool_panel_label_weight_percentage);
+    lv_style_set_radius(&style_scan_screen_main_panel_spool_panel_label_weight_percentage, 2);
+    lv_style_set_clip_corner(&style_scan_screen_main_panel_spool_panel_label_weight_percentage, true);
+    lv_style_set_text_color(&style_scan_screen_main_panel_spool_panel_label_weight_percentage, lv_color_hex(0xff00ff00));
+    lv_style_init(&style_scan_screen_main_panel_ams_panel_ams_a_label_name);
+    lv_style_set_text_font(&style_scan_screen_main_panel_ams_panel_ams_a_label_name, &lv_font_montserrat_20);
+    lv_style_init(&style_scan_screen_main_panel_ams_panel_ams_a_slot);
+    lv_style_set_bg_color(&style_scan_screen_main_panel_ams_panel_ams_a_slot, lv_color_hex(0xffd0bdbb));
+    lv_style_set_bg_opa(&style_scan_screen_main_panel_ams_panel_ams_a_slot, 255);
+    lv_style_set_border_color(&style_scan_screen_main_panel_ams_panel_ams_a_slot, lv_color_hex(0xffbab1b1));
+    lv_style_set_border_opa(&style_scan_screen_main_panel_ams_panel_ams_a_slot, 255);
+    lv_style_set_border_width(&style_scan_screen_main_panel_ams_panel_ams_a_slot, 2);
+    lv_style_set_clip_corner(&style_scan_screen_main_panel_ams_panel_ams_a_slot, true);
+    lv_style_set_radius(&style_scan_screen_main_panel_ams_panel_ams_a_slot, 5);
+    lv_style_init(&style_scan_screen_main_panel_ams_panel_ams_a_indicator);
+    lv_style_set_bg_color(&style_scan_screen_main_panel_ams_panel_ams_a_indicator, lv_color_hex(0xff00ff00));
+    lv_style_set_bg_opa(&style_scan_screen_main_panel_ams_panel_ams_a_indicator, 255);
+    lv_style_set_text_color(&style_scan_screen_main_panel_ams_panel_ams_a_indicator, lv_color_hex(0xff000000));
+    lv_style_set_text_font(&style_scan_screen_main_panel_ams_panel_ams_a_indicator, &lv_font_montserrat_16);
+    lv_style_set_text_align(&style_scan_screen_main_panel_ams_panel_ams_a_indicator, LV_TEXT_ALIGN_CENTER);
+    lv_style_set_text_opa(&style_scan_screen_main_panel_ams_panel_ams_a_indicator, 255);
+    lv_style_init(&style_scan_screen_button_assign_save);
+    lv_style_set_bg_color(&style_scan_screen_button_assign_save, lv_color_hex(0xff00ff00));
+    lv_style_init(&style_scan_screen_button_assign_save_label);
+    lv_style_set_text_color(&style_scan_screen_button_assign_save_label, lv_color_hex(0xff000000));
+    lv_style_init(&style_spool_screen_main_panel_button_edit);
+    lv_style_set_bg_color(&style_spool_screen_main_panel_button_edit, lv_color_hex(0xff00ff00));
+    lv_style_set_shadow_width(&style_spool_screen_main_panel_button_edit, 1);
+    lv_style_set_shadow_ofs_x(&style_spool_screen_main_panel_button_edit, 1);
+    lv_style_set_shadow_ofs_y(&style_spool_screen_main_panel_button_edit, 1);
+    lv_style_set_shadow_spread(&style_spool_screen_main_panel_button_edit, 1);
+    lv_style_set_shadow_color(&style_spool_screen_main_panel_button_edit, lv_color_hex(0xff000000));
+    lv_style_init(&style_spool_screen_main_panel_middle_panel);
+    lv_style_set_shadow_width(&style_spool_screen_main_panel_middle_panel, 1);
+    lv_style_set_shadow_ofs_x(&style_spool_screen_main_panel_middle_panel, 2);
+    lv_style_set_shadow_ofs_y(&style_spool_screen_main_panel_middle_panel, 1);
+    lv_style_set_shadow_spread(&style_spool_screen_main_panel_middle_panel, 1);
+    lv_style_set_shadow_opa(&style_spool_screen_main_panel_middle_panel, 100);
+    lv_style_init(&style_settings_screen_tabs_printers);
+    lv_style_set_pad_top(&style_settings_screen_tabs_printers, 0);
+    lv_style_set_pad_bottom(&style_settings_screen_tabs_printers, 0);
+    lv_style_set_bg_color(&style_settings_screen_tabs_printers, lv_color_hex(0xff252525));
+    lv_style_set_bg_opa(&style_settings_screen_tabs_printers, 255);
+    lv_style_set_radius(&style_settings_screen_tabs_printers, 5);
+    lv_style_set_border_width(&style_settings_screen_tabs_printers, 0);
+    lv_style_set_pad_left(&style_settings_screen_tabs_printers, 15);
+    lv_style_set_pad_right(&style_settings_screen_tabs_printers, 15);
+    lv_style_set_clip_corner(&style_settings_screen_tabs_printers, true);
+    lv_style_init(&style_settings_screen_tabs_printers_label);
+    lv_style_set_text_color(&style_settings_screen_tabs_printers_label, lv_color_hex(0xff888888));
+    lv_style_set_text_font(&style_settings_screen_tabs_printers_label, &lv_font_montserrat_14);
+    lv_style_init(&style_settings_screen_tabs_network_content);
+    lv_style_set_pad_top(&style_settings_screen_tabs_network_content, 0);
+    lv_style_set_pad_bottom(&style_settings_screen_tabs_network_content, 0);
+    lv_style_set_bg_color(&style_settings_screen_tabs_network_content, lv_color_hex(0xff1a1a1a));
+    lv_style_set_bg_opa(&style_settings_screen_tabs_network_content, 255);
+    lv_style_set_radius(&style_settings_screen_tabs_network_content, 0);
+    lv_style_set_border_width(&style_settings_screen_tabs_network_content, 0);
+    lv_style_set_pad_left(&style_settings_screen_tabs_network_content, 15);
+    lv_style_set_pad_right(&style_settings_screen_tabs_network_content, 15);
+    lv_style_init(&style_settings_screen_tabs_network_content_wifi);
+    lv_style_set_pad_top(&style_settings_screen_tabs_network_content_wifi, 0);
+    lv_style_set_pad_bottom(&style_settings_screen_tabs_network_content_wifi, 0);
+    lv_style_set_bg_color(&style_settings_screen_tabs_network_content_wifi, lv_color_hex(0xff2d2d2d));
+    lv_style_set_bg_opa(&style_settings_screen_tabs_network_content_wifi, 255);
+    lv_style_set_radius(&style_settings_screen_tabs_network_content_wifi, 8);
+    lv_style_set_border_width(&style_settings_screen_tabs_network_content_wifi, 0);
+    lv_style_set_pad_left(&style_settings_screen_tabs_network_content_wifi, 15);
+    lv_style_set_pad_right(&style_settings_screen_tabs_network_content_wifi, 15);
+    lv_style_init(&style_settings_screen_tabs_network_content_wifi_label_name);
+    lv_style_set_text_color(&style_settings_screen_tabs_network_content_wifi_label_name, lv_color_hex(0xffffffff));
+    lv_style_set_text_font(&style_settings_screen_tabs_network_content_wifi_label_name, &lv_font_montserrat_16);
+    lv_style_init(&style_settings_screen_tabs_network_content_wifi_icon_select);
+    lv_style_set_text_color(&style_settings_screen_tabs_network_content_wifi_icon_select, lv_color_hex(0xff666666));
+    lv_style_set_text_font(&style_settings_screen_tabs_network_content_wifi_icon_select, &lv_font_montserrat_18);
+    lv_style_init(&style_settings_wifi_screen_content_panel_);
+    lv_style_set_arc_width(&style_settings_wifi_screen_content_panel_, 5);
+    lv_style_set_arc_rounded(&style_settings_wifi_screen_content_panel_, true);
+    lv_style_set_bg_color(&style_settings_wifi_screen_content_panel_, lv_color_hex(0xff2d2d2d));
+    lv_style_set_shadow_width(&style_settings_wifi_screen_content_panel_, 1);
+    lv_style_set_shadow_ofs_x(&style_settings_wifi_screen_content_panel_, 1);
+    lv_style_set_shadow_ofs_y(&style_settings_wifi_screen_content_panel_, 1);
+    lv_style_set_shadow_spread(&style_settings_wifi_screen_content_panel_, 1);
+    lv_style_set_shadow_color(&style_settings_wifi_screen_content_panel_, lv_color_hex(0xff796666));
+    lv_style_set_shadow_opa(&style_settings_wifi_screen_content_panel_, 100);
+    lv_style_init(&style_settings_wifi_screen_content_panel_label_wifi);
+    lv_style_set_text_decor(&style_settings_wifi_screen_content_panel_label_wifi, LV_TEXT_DECOR_UNDERLINE);
+    lv_style_init(&style_settings_wifi_screen_content_panel_input_ssid);
+    lv_style_set_shadow_width(&style_settings_wifi_screen_content_panel_input_ssid, 1);
+    lv_style_set_shadow_ofs_x(&style_settings_wifi_screen_content_panel_input_ssid, 1);
+    lv_style_set_shadow_ofs_y(&style_settings_wifi_screen_content_panel_input_ssid, 1);
+    lv_style_set_shadow_spread(&style_settings_wifi_screen_content_panel_input_ssid, 0);
+    lv_style_init(&style_settings_wifi_screen_content_panel_button_connect_);
+    lv_style_set_bg_color(&style_settings_wifi_screen_content_panel_button_connect_, lv_color_hex(0xff00ff00));
+    lv_style_set_text_color(&style_settings_wifi_screen_content_panel_button_connect_, lv_color_hex(0xff000000));
+    lv_style_init(&style_settings_printer_add_screen_panel_panel_input_name);
+    lv_style_set_shadow_width(&style_settings_printer_add_screen_panel_panel_input_name, 1);
+    lv_style_set_shadow_ofs_x(&style_settings_printer_add_screen_panel_panel_input_name, 1);
+    lv_style_set_shadow_ofs_y(&style_settings_printer_add_screen_panel_panel_input_name, 1);
+    lv_style_init(&style_settings_display_screen_content_panel_label_brightness_slider);
+    lv_style_set_bg_color(&style_settings_display_screen_content_panel_label_brightness_slider, lv_color_hex(0xff000000));
+    lv_style_set_shadow_width(&style_settings_display_screen_content_panel_label_brightness_slider, 1);
+    lv_style_set_shadow_ofs_x(&style_settings_display_screen_content_panel_label_brightness_slider, 1);
+    lv_style_set_shadow_ofs_y(&style_settings_display_screen_content_panel_label_brightness_slider, 1);
+    lv_style_set_shadow_spread(&style_settings_display_screen_content_panel_label_brightness_slider, 1);
+    lv_style_set_shadow_opa(&style_settings_display_screen_content_panel_label_brightness_slider, 100);
+}
+
+
 void create_screen_main_screen() {
+    init_shared_styles();
     lv_obj_t *obj = lv_obj_create(0);
     objects.main_screen = obj;
     lv_obj_set_pos(obj, 0, 0);
     lv_obj_set_size(obj, 800, 480);
-    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(obj, &style_main_screen, LV_PART_MAIN | LV_STATE_DEFAULT);
     {
         lv_obj_t *parent_obj = obj;
         {
@@ -29,18 +447,8 @@ void create_screen_main_screen() {
             objects.top_bar = obj;
             lv_obj_set_pos(obj, 0, 0);
             lv_obj_set_size(obj, 800, 44);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_top_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -69,9 +477,7 @@ void create_screen_main_screen() {
                     lv_obj_set_pos(obj, 698, 10);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_signal);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_wifi_signal, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // top_bar_notification_bell
@@ -88,7 +494,7 @@ void create_screen_main_screen() {
                     objects.top_bar_clock = obj;
                     lv_obj_set_pos(obj, 737, 12);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_clock, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
             }
@@ -99,18 +505,8 @@ void create_screen_main_screen() {
             objects.bottom_bar = obj;
             lv_obj_set_pos(obj, 0, 450);
             lv_obj_set_size(obj, 800, 30);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_bottom_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_set_style_align(obj, LV_ALIGN_DEFAULT, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xfffaaa05), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_TOP, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -128,7 +524,7 @@ void create_screen_main_screen() {
                     objects.bottom_bar_message = obj;
                     lv_obj_set_pos(obj, 33, 6);
                     lv_obj_set_size(obj, 754, 16);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_bottom_bar_message, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
             }
@@ -157,12 +553,7 @@ void create_screen_main_screen() {
                     objects.main_screen_ams_right_nozzle_indicator = obj;
                     lv_obj_set_pos(obj, -14, -17);
                     lv_obj_set_size(obj, 12, 12);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "R");
                 }
                 {
@@ -171,7 +562,7 @@ void create_screen_main_screen() {
                     objects.main_screen_ams_right_nozzle_text = obj;
                     lv_obj_set_pos(obj, 2, -17);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, 12);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "Right Nozzle");
                 }
                 {
@@ -181,17 +572,7 @@ void create_screen_main_screen() {
                     lv_obj_set_pos(obj, -14, 50);
                     lv_obj_set_size(obj, 47, 50);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_ht, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -200,9 +581,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_ht_a_text = obj;
                             lv_obj_set_pos(obj, -14, -17);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "HT-A");
                         }
                         {
@@ -211,17 +590,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_ht_a_slot = obj;
                             lv_obj_set_pos(obj, -11, -1);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff726e6e), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_stop(obj, 200, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_main_stop(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff352a2a), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -233,17 +602,7 @@ void create_screen_main_screen() {
                     lv_obj_set_pos(obj, 40, 50);
                     lv_obj_set_size(obj, 47, 50);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_ht, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -252,9 +611,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_ext_1_text = obj;
                             lv_obj_set_pos(obj, -14, -17);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Ext-1");
                         }
                         {
@@ -263,17 +620,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_ext_1_slot = obj;
                             lv_obj_set_pos(obj, -11, -1);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff726e6e), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff352a2a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_stop(obj, 200, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_main_stop(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -285,17 +632,7 @@ void create_screen_main_screen() {
                     lv_obj_set_pos(obj, -14, -2);
                     lv_obj_set_size(obj, 120, 50);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_ht, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -304,9 +641,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_b_label = obj;
                             lv_obj_set_pos(obj, 31, -19);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "B");
                         }
                         {
@@ -315,13 +650,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_b_slot_1 = obj;
                             lv_obj_set_pos(obj, -17, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xffec0a0a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -330,13 +659,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_b_slot_2 = obj;
                             lv_obj_set_pos(obj, 11, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0a40ec), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -345,13 +668,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_b_slot_3 = obj;
                             lv_obj_set_pos(obj, 39, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xffece90a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -360,13 +677,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_b_slot_4 = obj;
                             lv_obj_set_pos(obj, 68, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff146819), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_4, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -379,13 +690,7 @@ void create_screen_main_screen() {
             objects.main_screen_button_ams_setup = obj;
             lv_obj_set_pos(obj, 507, 49);
             lv_obj_set_size(obj, 137, 122);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_main_screen_button_ams_setup, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -397,23 +702,7 @@ void create_screen_main_screen() {
                     lv_image_set_src(obj, &img_amssetup);
                     lv_image_set_scale(obj, 180);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff5f5b5b), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_FULL, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_button_ams_setup_icon, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // main_screen_button_ams_setup_label
@@ -432,13 +721,7 @@ void create_screen_main_screen() {
             objects.main_screen_button_encode_tag = obj;
             lv_obj_set_pos(obj, 657, 49);
             lv_obj_set_size(obj, 130, 122);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_main_screen_button_ams_setup, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -450,23 +733,7 @@ void create_screen_main_screen() {
                     lv_image_set_src(obj, &img_encoding);
                     lv_image_set_scale(obj, 150);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff5f5b5b), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_FULL, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_button_ams_setup_icon, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // main_screen_button_encode_tag_label
@@ -485,13 +752,7 @@ void create_screen_main_screen() {
             objects.main_screen_button_settings = obj;
             lv_obj_set_pos(obj, 657, 182);
             lv_obj_set_size(obj, 130, 126);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_main_screen_button_ams_setup, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -503,23 +764,7 @@ void create_screen_main_screen() {
                     lv_image_set_src(obj, &img_settings);
                     lv_image_set_scale(obj, 150);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff5f5b5b), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_FULL, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_button_ams_setup_icon, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // main_screen_button_settings_label
@@ -538,17 +783,9 @@ void create_screen_main_screen() {
             objects.main_screen_button_catalog = obj;
             lv_obj_set_pos(obj, 507, 180);
             lv_obj_set_size(obj, 137, 129);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_main_screen_button_ams_setup, LV_PART_MAIN | LV_STATE_DEFAULT);
             // Disabled state styling
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DISABLED);
-            lv_obj_set_style_bg_opa(obj, 128, LV_PART_MAIN | LV_STATE_DISABLED);
-            lv_obj_set_style_shadow_opa(obj, 0, LV_PART_MAIN | LV_STATE_DISABLED);
+            lv_obj_add_style(obj, &style_main_screen_button_catalog, LV_PART_MAIN | LV_STATE_DISABLED);
             lv_obj_add_state(obj, LV_STATE_DISABLED);
             {
                 lv_obj_t *parent_obj = obj;
@@ -561,23 +798,7 @@ void create_screen_main_screen() {
                     lv_image_set_src(obj, &img_catalog);
                     lv_image_set_scale(obj, 150);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff5f5b5b), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_FULL, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_button_ams_setup_icon, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // main_screen_button_catalog_label
@@ -597,13 +818,7 @@ void create_screen_main_screen() {
             lv_obj_set_pos(obj, 11, 179);
             lv_obj_set_size(obj, 483, 130);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_main_screen_button_ams_setup, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -614,9 +829,7 @@ void create_screen_main_screen() {
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_nfc);
                     lv_image_set_scale(obj, 175);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_nfc_scale_nfc_logo, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // main_screen_nfc_scale_nfc_label
@@ -624,9 +837,7 @@ void create_screen_main_screen() {
                     objects.main_screen_nfc_scale_nfc_label = obj;
                     lv_obj_set_pos(obj, 7, 78);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_opa(obj, 125, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_nfc_scale_nfc_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "Ready");
                 }
                 {
@@ -637,9 +848,7 @@ void create_screen_main_screen() {
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_scale);
                     lv_image_set_scale(obj, 190);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_nfc_scale_nfc_logo, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // main_screen_nfc_scale_scale_label
@@ -647,9 +856,7 @@ void create_screen_main_screen() {
                     objects.main_screen_nfc_scale_scale_label = obj;
                     lv_obj_set_pos(obj, 382, 76);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_opa(obj, 125, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_nfc_scale_nfc_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "Ready");
                 }
                 {
@@ -691,13 +898,7 @@ void create_screen_main_screen() {
             lv_obj_set_pos(obj, 10, 319);
             lv_obj_set_size(obj, 385, 127);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_main_screen_button_ams_setup, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -706,12 +907,7 @@ void create_screen_main_screen() {
                     objects.main_screen_ams_left_nozzle_indicator = obj;
                     lv_obj_set_pos(obj, -16, -17);
                     lv_obj_set_size(obj, 12, 12);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "L");
                 }
                 {
@@ -720,7 +916,7 @@ void create_screen_main_screen() {
                     objects.main_screen_ams_left_nozzle_label = obj;
                     lv_obj_set_pos(obj, 0, -17);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, 12);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "Left Nozzle");
                 }
                 {
@@ -730,17 +926,7 @@ void create_screen_main_screen() {
                     lv_obj_set_pos(obj, -16, -2);
                     lv_obj_set_size(obj, 120, 50);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_ht, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -757,13 +943,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_a_slot_1 = obj;
                             lv_obj_set_pos(obj, -17, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xffec0a0a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -772,13 +952,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_a_slot_3 = obj;
                             lv_obj_set_pos(obj, 39, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xffece90a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -787,13 +961,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_a_slot_4 = obj;
                             lv_obj_set_pos(obj, 68, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff146819), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_4, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -802,13 +970,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_a_slot_2 = obj;
                             lv_obj_set_pos(obj, 10, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0a40ec), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -820,18 +982,7 @@ void create_screen_main_screen() {
                     lv_obj_set_pos(obj, 111, -2);
                     lv_obj_set_size(obj, 120, 50);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff2f3237), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_c, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -840,9 +991,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_c_label = obj;
                             lv_obj_set_pos(obj, 32, -18);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "C");
                         }
                         {
@@ -851,13 +1000,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_c_slot_1 = obj;
                             lv_obj_set_pos(obj, -17, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xffec0a0a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -866,13 +1009,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_c_slot_2 = obj;
                             lv_obj_set_pos(obj, 11, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0a40ec), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -881,13 +1018,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_c_slot_3 = obj;
                             lv_obj_set_pos(obj, 39, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xffece90a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -896,13 +1027,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_c_slot_4 = obj;
                             lv_obj_set_pos(obj, 68, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff146819), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_4, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -913,17 +1038,7 @@ void create_screen_main_screen() {
                     lv_obj_set_pos(obj, 240, -2);
                     lv_obj_set_size(obj, 120, 50);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_ht, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -932,9 +1047,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_d_label = obj;
                             lv_obj_set_pos(obj, 31, -18);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "D");
                         }
                         {
@@ -943,13 +1056,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_d_slot_1 = obj;
                             lv_obj_set_pos(obj, -17, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xffec0a0a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -958,13 +1065,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_d_slot_2 = obj;
                             lv_obj_set_pos(obj, 11, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0a40ec), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -973,13 +1074,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_d_slot_3 = obj;
                             lv_obj_set_pos(obj, 39, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xffece90a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -988,13 +1083,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ams_d_slot_4 = obj;
                             lv_obj_set_pos(obj, 68, -3);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff146819), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_b_slot_4, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -1006,17 +1095,7 @@ void create_screen_main_screen() {
                     lv_obj_set_pos(obj, -16, 50);
                     lv_obj_set_size(obj, 47, 50);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_ht, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -1025,9 +1104,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ht_b_label = obj;
                             lv_obj_set_pos(obj, -14, -17);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "HT-B");
                         }
                         {
@@ -1036,17 +1113,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ht_b_slot = obj;
                             lv_obj_set_pos(obj, -10, -1);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff726e6e), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_stop(obj, 200, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_main_stop(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff352a2a), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -1058,17 +1125,7 @@ void create_screen_main_screen() {
                     lv_obj_set_pos(obj, 38, 50);
                     lv_obj_set_size(obj, 47, 50);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_ht, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -1077,9 +1134,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ext_2_label = obj;
                             lv_obj_set_pos(obj, -14, -17);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Ext-2");
                         }
                         {
@@ -1088,17 +1143,7 @@ void create_screen_main_screen() {
                             objects.main_screen_ext_2_slot = obj;
                             lv_obj_set_pos(obj, -11, -1);
                             lv_obj_set_size(obj, 23, 24);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff726e6e), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff352a2a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_grad_stop(obj, 200, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_main_stop(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -1170,9 +1215,7 @@ void create_screen_main_screen() {
                     objects.main_screen_printer_filename = obj;
                     lv_obj_set_pos(obj, -13, 62);
                     lv_obj_set_size(obj, 353, 16);
-                    lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_ht_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
                 {
@@ -1181,9 +1224,7 @@ void create_screen_main_screen() {
                     objects.main_screen_printer_eta = obj;
                     lv_obj_set_pos(obj, 385, 35);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_ht_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
                 {
@@ -1225,12 +1266,12 @@ void tick_screen_main_screen() {
 }
 
 void create_screen_ams_overview() {
+    init_shared_styles();
     lv_obj_t *obj = lv_obj_create(0);
     objects.ams_overview = obj;
     lv_obj_set_pos(obj, 0, 0);
     lv_obj_set_size(obj, 800, 480);
-    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(obj, &style_main_screen, LV_PART_MAIN | LV_STATE_DEFAULT);
     {
         lv_obj_t *parent_obj = obj;
         {
@@ -1239,17 +1280,7 @@ void create_screen_ams_overview() {
             objects.ams_screen_top_bar = obj;
             lv_obj_set_pos(obj, 0, 0);
             lv_obj_set_size(obj, 800, 44);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_top_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -1278,9 +1309,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 698, 10);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_signal);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_wifi_signal, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // ams_screen_top_bar_notofication_bell
@@ -1297,7 +1326,7 @@ void create_screen_ams_overview() {
                     objects.ams_screen_top_bar_clock = obj;
                     lv_obj_set_pos(obj, 737, 12);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_clock, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
             }
@@ -1308,18 +1337,8 @@ void create_screen_ams_overview() {
             objects.ams_screen_bottom_bar = obj;
             lv_obj_set_pos(obj, 0, 450);
             lv_obj_set_size(obj, 800, 30);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_bottom_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_set_style_align(obj, LV_ALIGN_DEFAULT, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xfffaaa05), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_TOP, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -1337,7 +1356,7 @@ void create_screen_ams_overview() {
                     objects.ams_screen_bottom_bar_message = obj;
                     lv_obj_set_pos(obj, 30, 5);
                     lv_obj_set_size(obj, 696, 16);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_bottom_bar_message, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
             }
@@ -1348,13 +1367,7 @@ void create_screen_ams_overview() {
             objects.ams_screen_button_home = obj;
             lv_obj_set_pos(obj, 728, 49);
             lv_obj_set_size(obj, 60, 60);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_main_screen_button_ams_setup, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -1366,23 +1379,7 @@ void create_screen_ams_overview() {
                     lv_image_set_src(obj, &img_home);
                     lv_image_set_scale(obj, 100);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff5f5b5b), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_FULL, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_button_ams_setup_icon, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // ams_screen_button_home_label
@@ -1391,7 +1388,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 0, 23);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_obj_set_style_align(obj, LV_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "Home");
                 }
             }
@@ -1402,13 +1399,7 @@ void create_screen_ams_overview() {
             objects.ams_screen_button_encode_tag = obj;
             lv_obj_set_pos(obj, 728, 116);
             lv_obj_set_size(obj, 60, 60);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_main_screen_button_ams_setup, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -1420,23 +1411,7 @@ void create_screen_ams_overview() {
                     lv_image_set_src(obj, &img_encoding);
                     lv_image_set_scale(obj, 100);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff5f5b5b), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_FULL, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_button_ams_setup_icon, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // ams_screen_button_encode_tag_label
@@ -1445,7 +1420,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 0, 23);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_obj_set_style_align(obj, LV_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "Encode");
                 }
             }
@@ -1456,13 +1431,7 @@ void create_screen_ams_overview() {
             objects.ams_screen_button_settings = obj;
             lv_obj_set_pos(obj, 729, 249);
             lv_obj_set_size(obj, 60, 60);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_main_screen_button_ams_setup, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -1474,23 +1443,7 @@ void create_screen_ams_overview() {
                     lv_image_set_src(obj, &img_settings);
                     lv_image_set_scale(obj, 110);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff5f5b5b), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_FULL, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_button_ams_setup_icon, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // ams_screen_button_settings_label
@@ -1499,7 +1452,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 0, 23);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_obj_set_style_align(obj, LV_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "Settings");
                 }
             }
@@ -1510,17 +1463,9 @@ void create_screen_ams_overview() {
             objects.ams_screen_button_catalog = obj;
             lv_obj_set_pos(obj, 729, 182);
             lv_obj_set_size(obj, 60, 60);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_main_screen_button_ams_setup, LV_PART_MAIN | LV_STATE_DEFAULT);
             // Disabled state styling
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DISABLED);
-            lv_obj_set_style_bg_opa(obj, 128, LV_PART_MAIN | LV_STATE_DISABLED);
-            lv_obj_set_style_shadow_opa(obj, 0, LV_PART_MAIN | LV_STATE_DISABLED);
+            lv_obj_add_style(obj, &style_main_screen_button_catalog, LV_PART_MAIN | LV_STATE_DISABLED);
             lv_obj_add_state(obj, LV_STATE_DISABLED);
             {
                 lv_obj_t *parent_obj = obj;
@@ -1533,23 +1478,7 @@ void create_screen_ams_overview() {
                     lv_image_set_src(obj, &img_catalog);
                     lv_image_set_scale(obj, 100);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff5f5b5b), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_FULL, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_outline_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_button_ams_setup_icon, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // ams_screen_button_catalog_label
@@ -1558,7 +1487,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 0, 23);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_obj_set_style_align(obj, LV_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "Catalog");
                 }
             }
@@ -1595,21 +1524,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, -14, 185);
                     lv_obj_set_size(obj, 225, 175);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff545151), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_main_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -1618,12 +1533,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_indicator = obj;
                             lv_obj_set_pos(obj, -16, -16);
                             lv_obj_set_size(obj, 12, 12);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, " ");
                         }
                         {
@@ -1632,7 +1542,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_label = obj;
                             lv_obj_set_pos(obj, 1, -15);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "AMS D");
                         }
                         {
@@ -1641,7 +1551,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_labe_humidity = obj;
                             lv_obj_set_pos(obj, 170, -14);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1659,7 +1569,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_label_humidity = obj;
                             lv_obj_set_pos(obj, 133, -14);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1670,8 +1580,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_amd_d_slot_1_color
@@ -1681,9 +1590,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfff70303), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_1_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_amd_d_slot_2
@@ -1693,10 +1600,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_amd_d_slot_2_color
@@ -1706,9 +1610,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff3603f7), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_amd_d_slot_3
@@ -1718,8 +1620,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_amd_d_slot_3_color
@@ -1729,9 +1630,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff509405), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_3_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_amd_d_slot_4
@@ -1741,8 +1640,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_amd_d_slot_4_color
@@ -1752,9 +1650,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfffad607), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_4_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_amd_d_slot_1_label_material
@@ -1762,7 +1658,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_1_label_material = obj;
                             lv_obj_set_pos(obj, 0, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1771,7 +1667,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_2_label_material = obj;
                             lv_obj_set_pos(obj, 52, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1780,8 +1676,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_3_label_material = obj;
                             lv_obj_set_pos(obj, 105, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_3_label_material, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1790,7 +1685,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_4_label_material = obj;
                             lv_obj_set_pos(obj, 157, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1799,11 +1694,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_2_label_slotname = obj;
                             lv_obj_set_pos(obj, 55, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "D2");
                         }
                         {
@@ -1812,11 +1703,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_3_label_slotname = obj;
                             lv_obj_set_pos(obj, 108, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "D3");
                         }
                         {
@@ -1825,11 +1712,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_4_label_slotname = obj;
                             lv_obj_set_pos(obj, 162, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "D4");
                         }
                         {
@@ -1838,7 +1721,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_1_label_fill_level = obj;
                             lv_obj_set_pos(obj, 0, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1847,7 +1730,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_2_label_fill_level = obj;
                             lv_obj_set_pos(obj, 54, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1856,7 +1739,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_3_label_fill_level = obj;
                             lv_obj_set_pos(obj, 107, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1865,7 +1748,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_4_label_fill_level = obj;
                             lv_obj_set_pos(obj, 161, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1874,11 +1757,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_amd_d_slot_1_label_slotname = obj;
                             lv_obj_set_pos(obj, 2, 107);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "D1");
                         }
                         {
@@ -1889,8 +1768,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 21, 14);
                             lv_image_set_src(obj, &img_thermometer);
                             lv_image_set_scale(obj, 95);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff1967ea), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_icon_thermometer, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -1901,21 +1779,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, -16, 3);
                     lv_obj_set_size(obj, 225, 175);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff545151), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_main_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -1924,12 +1788,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_indicator = obj;
                             lv_obj_set_pos(obj, -16, -16);
                             lv_obj_set_size(obj, 12, 12);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, " ");
                         }
                         {
@@ -1938,7 +1797,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_label_name = obj;
                             lv_obj_set_pos(obj, 1, -15);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "AMS A");
                         }
                         {
@@ -1947,7 +1806,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_label_temperature = obj;
                             lv_obj_set_pos(obj, 170, -14);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1965,7 +1824,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_label_humidity = obj;
                             lv_obj_set_pos(obj, 133, -14);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -1976,8 +1835,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 21, 14);
                             lv_image_set_src(obj, &img_thermometer);
                             lv_image_set_scale(obj, 95);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff1967ea), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_icon_thermometer, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_a_slot_1
@@ -1987,8 +1845,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_a_slot_1_color
@@ -1998,9 +1855,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfff70303), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_1_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_a_slot_2
@@ -2010,10 +1865,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_a_slot_2_color
@@ -2023,9 +1875,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff3603f7), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_a_slot_3
@@ -2035,8 +1885,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_a_slot_3_color
@@ -2046,9 +1895,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff509405), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_3_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_a_slot_4
@@ -2058,8 +1905,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_a_slot_4_color
@@ -2069,9 +1915,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfffad607), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_4_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_a_slot_1_label_material
@@ -2079,7 +1923,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_1_label_material = obj;
                             lv_obj_set_pos(obj, 0, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2088,7 +1932,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_2_label_material = obj;
                             lv_obj_set_pos(obj, 52, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2097,8 +1941,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_3_label_material = obj;
                             lv_obj_set_pos(obj, 105, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_3_label_material, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2107,7 +1950,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_4_label_material = obj;
                             lv_obj_set_pos(obj, 157, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2116,11 +1959,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_2_label_slot_name = obj;
                             lv_obj_set_pos(obj, 55, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "A2");
                         }
                         {
@@ -2129,11 +1968,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_3_label_slot_name = obj;
                             lv_obj_set_pos(obj, 108, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "A3");
                         }
                         {
@@ -2142,11 +1977,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_4_label_slot_name = obj;
                             lv_obj_set_pos(obj, 162, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "A4");
                         }
                         {
@@ -2155,7 +1986,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_1_label_slot_name_label_fill_level = obj;
                             lv_obj_set_pos(obj, 0, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2164,7 +1995,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_2_label_slot_name_label_fill_level = obj;
                             lv_obj_set_pos(obj, 54, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2173,7 +2004,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_3_label_slot_name_label_fill_level = obj;
                             lv_obj_set_pos(obj, 107, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2182,7 +2013,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_4_label_slot_name_label_fill_level = obj;
                             lv_obj_set_pos(obj, 161, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2191,11 +2022,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_a_slot_1_label_slot_name = obj;
                             lv_obj_set_pos(obj, 1, 105);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "A1");
                         }
                     }
@@ -2207,21 +2034,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 219, 185);
                     lv_obj_set_size(obj, 108, 175);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff545151), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_main_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -2230,12 +2043,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_a_indicator = obj;
                             lv_obj_set_pos(obj, -16, -16);
                             lv_obj_set_size(obj, 12, 12);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, " ");
                         }
                         {
@@ -2244,8 +2052,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_a_label_name = obj;
                             lv_obj_set_pos(obj, 1, -15);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_3_label_material, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "HT-A");
                         }
                         {
@@ -2254,7 +2061,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_a_label_temperature = obj;
                             lv_obj_set_pos(obj, 50, 136);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2272,7 +2079,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_a_label_humidity = obj;
                             lv_obj_set_pos(obj, 10, 136);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2281,7 +2088,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_a_label_material = obj;
                             lv_obj_set_pos(obj, 19, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2290,7 +2097,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_a_label_fill_level = obj;
                             lv_obj_set_pos(obj, 22, 107);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "85%");
                         }
                         {
@@ -2301,8 +2108,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ht_a_slot_color
@@ -2312,9 +2118,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfff70303), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_1_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ht_a_icon_thermometer
@@ -2324,8 +2128,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 21, 14);
                             lv_image_set_src(obj, &img_thermometer);
                             lv_image_set_scale(obj, 95);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff1967ea), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_icon_thermometer, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -2336,21 +2139,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 336, 185);
                     lv_obj_set_size(obj, 108, 175);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff545151), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_main_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -2359,12 +2148,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_b_indicator = obj;
                             lv_obj_set_pos(obj, -16, -16);
                             lv_obj_set_size(obj, 12, 12);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, " ");
                         }
                         {
@@ -2373,8 +2157,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_b_label_name = obj;
                             lv_obj_set_pos(obj, 1, -15);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_3_label_material, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "HT-B");
                         }
                         {
@@ -2383,7 +2166,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_b_label_temperature = obj;
                             lv_obj_set_pos(obj, 50, 136);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2401,7 +2184,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_b_label_humidity = obj;
                             lv_obj_set_pos(obj, 10, 136);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2410,7 +2193,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_b_label_material = obj;
                             lv_obj_set_pos(obj, 19, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2419,7 +2202,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ht_b_label_fill_level = obj;
                             lv_obj_set_pos(obj, 22, 107);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "85%");
                         }
                         {
@@ -2430,8 +2213,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ht_b_slot_color
@@ -2441,9 +2223,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfff70303), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_1_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ht_b_icon_t
@@ -2453,8 +2233,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 21, 14);
                             lv_image_set_src(obj, &img_thermometer);
                             lv_image_set_scale(obj, 95);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff1967ea), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_icon_thermometer, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -2465,21 +2244,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 454, 185);
                     lv_obj_set_size(obj, 108, 175);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff545151), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_main_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -2488,12 +2253,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ext_1_indicator = obj;
                             lv_obj_set_pos(obj, -16, -16);
                             lv_obj_set_size(obj, 12, 12);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, " ");
                         }
                         {
@@ -2502,7 +2262,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ext_1_label_name = obj;
                             lv_obj_set_pos(obj, 1, -15);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "EXT-1");
                         }
                         {
@@ -2511,7 +2271,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ext_1_label_empty = obj;
                             lv_obj_set_pos(obj, 9, 12);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "<empty>");
                         }
                         {
@@ -2522,8 +2282,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 66, 55);
                             lv_image_set_src(obj, &img_circle_empty);
                             lv_image_set_scale(obj, 25);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_ext_1_icon_empty, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -2534,21 +2293,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 570, 185);
                     lv_obj_set_size(obj, 108, 175);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff545151), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_main_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -2557,12 +2302,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ext_2_indicator = obj;
                             lv_obj_set_pos(obj, -16, -16);
                             lv_obj_set_size(obj, 12, 12);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, " ");
                         }
                         {
@@ -2571,7 +2311,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ext_2_label_name = obj;
                             lv_obj_set_pos(obj, 1, -15);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "EXT-2");
                         }
                         {
@@ -2580,7 +2320,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ext_2_label_empty = obj;
                             lv_obj_set_pos(obj, 9, 12);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "<empty>");
                         }
                         {
@@ -2591,8 +2331,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 66, 55);
                             lv_image_set_src(obj, &img_circle_empty);
                             lv_image_set_scale(obj, 25);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_ext_1_icon_empty, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -2603,21 +2342,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 219, 3);
                     lv_obj_set_size(obj, 225, 175);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff545151), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_main_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -2626,12 +2351,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_indicator = obj;
                             lv_obj_set_pos(obj, -16, -16);
                             lv_obj_set_size(obj, 12, 12);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, " ");
                         }
                         {
@@ -2640,7 +2360,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_label_name = obj;
                             lv_obj_set_pos(obj, 1, -15);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "AMS B");
                         }
                         {
@@ -2649,7 +2369,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_label_temperature = obj;
                             lv_obj_set_pos(obj, 170, -14);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2667,7 +2387,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_labe_humidity = obj;
                             lv_obj_set_pos(obj, 133, -14);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2678,8 +2398,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_b_slot_1_color
@@ -2689,9 +2408,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfff70303), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_1_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_b_slot_2
@@ -2701,10 +2418,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_b_slot_2_color
@@ -2714,9 +2428,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff3603f7), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_b_slot_3
@@ -2726,8 +2438,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_b_slot_3_color
@@ -2737,9 +2448,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff509405), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_3_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_b_slot_4
@@ -2749,8 +2458,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_b_slot_4_color
@@ -2760,9 +2468,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfffad607), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_4_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_b_slot_1_label_material
@@ -2770,7 +2476,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_1_label_material = obj;
                             lv_obj_set_pos(obj, 0, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2779,7 +2485,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_2_label_material = obj;
                             lv_obj_set_pos(obj, 52, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2788,8 +2494,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_3_label_material = obj;
                             lv_obj_set_pos(obj, 105, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_3_label_material, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2798,7 +2503,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_4_label_material = obj;
                             lv_obj_set_pos(obj, 157, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2807,11 +2512,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_1_label_slot_name = obj;
                             lv_obj_set_pos(obj, 2, 107);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "B1");
                         }
                         {
@@ -2820,11 +2521,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_2_label_slot_name = obj;
                             lv_obj_set_pos(obj, 55, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "B2");
                         }
                         {
@@ -2833,11 +2530,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_3_label_slot_name = obj;
                             lv_obj_set_pos(obj, 108, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "B3");
                         }
                         {
@@ -2846,11 +2539,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_4_label_slot_name = obj;
                             lv_obj_set_pos(obj, 162, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "B4");
                         }
                         {
@@ -2859,7 +2548,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_1_label_fill_level = obj;
                             lv_obj_set_pos(obj, 0, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2868,7 +2557,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_2_label_fill_level = obj;
                             lv_obj_set_pos(obj, 54, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2877,7 +2566,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_3_label_fill_level = obj;
                             lv_obj_set_pos(obj, 107, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2886,7 +2575,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_b_slot_4_label_fill_level = obj;
                             lv_obj_set_pos(obj, 161, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2897,8 +2586,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 21, 14);
                             lv_image_set_src(obj, &img_thermometer);
                             lv_image_set_scale(obj, 95);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff1967ea), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_icon_thermometer, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -2909,21 +2597,7 @@ void create_screen_ams_overview() {
                     lv_obj_set_pos(obj, 454, 3);
                     lv_obj_set_size(obj, 225, 175);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff545151), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_stop(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_main_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_grad_opa(obj, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -2932,12 +2606,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_indicator = obj;
                             lv_obj_set_pos(obj, -16, -16);
                             lv_obj_set_size(obj, 12, 12);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, " ");
                         }
                         {
@@ -2946,7 +2615,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_label_name = obj;
                             lv_obj_set_pos(obj, 1, -15);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "AMS C");
                         }
                         {
@@ -2955,7 +2624,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_label_temperature = obj;
                             lv_obj_set_pos(obj, 170, -14);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2973,7 +2642,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_label_humidity = obj;
                             lv_obj_set_pos(obj, 133, -14);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -2984,8 +2653,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_c_slot_1_color
@@ -2995,9 +2663,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfff70303), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_1_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_c_slot_2
@@ -3007,10 +2673,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_c_slot_2_color
@@ -3020,9 +2683,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff3603f7), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_c_slot_3
@@ -3032,8 +2693,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_c_slot_3_color
@@ -3043,9 +2703,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff509405), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_3_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_c_slot_4
@@ -3055,8 +2713,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_clean);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_opa(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_c_slot_4_color
@@ -3066,9 +2723,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 400);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfffad607), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_4_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // ams_screen_ams_panel_ams_c_slot_1_label_material
@@ -3076,7 +2731,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_1_label_material = obj;
                             lv_obj_set_pos(obj, 0, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3085,7 +2740,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_2_label_material = obj;
                             lv_obj_set_pos(obj, 52, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3094,8 +2749,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_3_label_material = obj;
                             lv_obj_set_pos(obj, 105, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_3_label_material, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3104,7 +2758,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_4_label_material = obj;
                             lv_obj_set_pos(obj, 157, 20);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3113,11 +2767,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_2_label_slot_name = obj;
                             lv_obj_set_pos(obj, 55, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "C2");
                         }
                         {
@@ -3126,11 +2776,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_3_label_slot_name = obj;
                             lv_obj_set_pos(obj, 108, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "C3");
                         }
                         {
@@ -3139,11 +2785,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_4_label_slot_name = obj;
                             lv_obj_set_pos(obj, 162, 106);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "C4");
                         }
                         {
@@ -3152,7 +2794,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_1_label_fill_level = obj;
                             lv_obj_set_pos(obj, 0, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3161,7 +2803,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_2_label_fill_level = obj;
                             lv_obj_set_pos(obj, 54, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3170,7 +2812,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_3_label_fill_level = obj;
                             lv_obj_set_pos(obj, 107, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3179,7 +2821,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_4_label_fill_level = obj;
                             lv_obj_set_pos(obj, 161, 123);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_text, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3188,11 +2830,7 @@ void create_screen_ams_overview() {
                             objects.ams_screen_ams_panel_ams_c_slot_1_label_slot_name = obj;
                             lv_obj_set_pos(obj, 2, 107);
                             lv_obj_set_size(obj, 18, 11);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_2_label_slotname, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "C1");
                         }
                         {
@@ -3203,8 +2841,7 @@ void create_screen_ams_overview() {
                             lv_obj_set_size(obj, 21, 14);
                             lv_image_set_src(obj, &img_thermometer);
                             lv_image_set_scale(obj, 95);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff1967ea), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_icon_thermometer, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -3219,12 +2856,12 @@ void tick_screen_ams_overview() {
 }
 
 void create_screen_scan_result() {
+    init_shared_styles();
     lv_obj_t *obj = lv_obj_create(0);
     objects.scan_result = obj;
     lv_obj_set_pos(obj, 0, 0);
     lv_obj_set_size(obj, 800, 480);
-    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(obj, &style_main_screen, LV_PART_MAIN | LV_STATE_DEFAULT);
     {
         lv_obj_t *parent_obj = obj;
         {
@@ -3233,17 +2870,7 @@ void create_screen_scan_result() {
             objects.scan_screen_top_bar = obj;
             lv_obj_set_pos(obj, 0, 0);
             lv_obj_set_size(obj, 800, 44);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_top_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -3281,9 +2908,7 @@ void create_screen_scan_result() {
                     lv_obj_set_pos(obj, 698, 10);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_signal);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_wifi_signal, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // scan_screen_top_bar_icon_notification_bell
@@ -3300,7 +2925,7 @@ void create_screen_scan_result() {
                     objects.scan_screen_top_bar_label_clock = obj;
                     lv_obj_set_pos(obj, 737, 12);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_clock, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
             }
@@ -3312,14 +2937,7 @@ void create_screen_scan_result() {
             lv_obj_set_pos(obj, 25, 50);
             lv_obj_set_size(obj, 751, 418);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_scan_screen_main_panel, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -3365,8 +2983,7 @@ void create_screen_scan_result() {
                             lv_obj_set_size(obj, 38, 35);
                             lv_image_set_src(obj, &img_ok);
                             lv_image_set_scale(obj, 255);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_top_panel_icon_ok, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -3377,12 +2994,7 @@ void create_screen_scan_result() {
                     lv_obj_set_pos(obj, -3, 66);
                     lv_obj_set_size(obj, 706, 72);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff2f3237), LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -3402,9 +3014,7 @@ void create_screen_scan_result() {
                             lv_obj_set_size(obj, 32, 42);
                             lv_image_set_src(obj, &img_spool_fill);
                             lv_image_set_scale(obj, 300);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfffad607), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_4_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // scan_screen_main_panel_spool_panel_label_weight
@@ -3412,9 +3022,7 @@ void create_screen_scan_result() {
                             objects.scan_screen_main_panel_spool_panel_label_weight = obj;
                             lv_obj_set_pos(obj, 46, 23);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_radius(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_weight, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3423,7 +3031,7 @@ void create_screen_scan_result() {
                             objects.scan_screen_main_panel_spool_panel_label_filament = obj;
                             lv_obj_set_pos(obj, 46, -11);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3432,7 +3040,7 @@ void create_screen_scan_result() {
                             objects.scan_screen_main_panel_spool_panel_label_filament_color = obj;
                             lv_obj_set_pos(obj, 46, 6);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3441,7 +3049,7 @@ void create_screen_scan_result() {
                             objects.scan_screen_main_panel_spool_panel_label_k_factor = obj;
                             lv_obj_set_pos(obj, 265, -11);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "K Factor");
                         }
                         {
@@ -3450,7 +3058,7 @@ void create_screen_scan_result() {
                             objects.scan_screen_main_panel_spool_panel_label_k_factor_value = obj;
                             lv_obj_set_pos(obj, 266, 5);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3459,7 +3067,7 @@ void create_screen_scan_result() {
                             objects.scan_screen_main_panel_spool_panel_label_k_profile = obj;
                             lv_obj_set_pos(obj, 370, -11);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "K Profile");
                         }
                         {
@@ -3468,7 +3076,7 @@ void create_screen_scan_result() {
                             objects.scan_screen_main_panel_spool_panel_label_k_profile_value = obj;
                             lv_obj_set_pos(obj, 371, 5);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -3477,9 +3085,7 @@ void create_screen_scan_result() {
                             objects.scan_screen_main_panel_spool_panel_label_weight_percentage = obj;
                             lv_obj_set_pos(obj, 93, 23);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_radius(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_weight_percentage, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -3491,12 +3097,7 @@ void create_screen_scan_result() {
                     lv_obj_set_pos(obj, -3, 150);
                     lv_obj_set_size(obj, 706, 178);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_border_color(obj, lv_color_hex(0xff2f3237), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -3514,18 +3115,7 @@ void create_screen_scan_result() {
                             lv_obj_set_pos(obj, 506, 3);
                             lv_obj_set_size(obj, 78, 64);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                            lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xff2f3237), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_c, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -3534,9 +3124,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ht_a_label_name = obj;
                                     lv_obj_set_pos(obj, -14, -17);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_ht_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "HT-A");
                                 }
                                 {
@@ -3545,17 +3133,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ht_a_slot_color = obj;
                                     lv_obj_set_pos(obj, 1, 2);
                                     lv_obj_set_size(obj, 30, 30);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff726e6e), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_stop(obj, 200, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_main_stop(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff352a2a), LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_ht_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3564,12 +3142,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ht_a_indicator = obj;
                                     lv_obj_set_pos(obj, 33, -15);
                                     lv_obj_set_size(obj, 12, 12);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, " ");
                                 }
                             }
@@ -3599,7 +3172,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_a_label_name = obj;
                                     lv_obj_set_pos(obj, -11, -13);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_20, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "A");
                                 }
                                 {
@@ -3608,13 +3181,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_a_slot_1 = obj;
                                     lv_obj_set_pos(obj, 11, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffec0a0a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3623,13 +3190,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_a_slot_2 = obj;
                                     lv_obj_set_pos(obj, 64, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0a40ec), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3638,13 +3199,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_a_slot_3 = obj;
                                     lv_obj_set_pos(obj, 116, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffece90a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3653,13 +3208,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_a_slot_4 = obj;
                                     lv_obj_set_pos(obj, 169, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffd0bdbb), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3668,12 +3217,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_a_indicator = obj;
                                     lv_obj_set_pos(obj, -12, 13);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "    ");
                                 }
                             }
@@ -3685,18 +3229,7 @@ void create_screen_scan_result() {
                             lv_obj_set_pos(obj, 249, 2);
                             lv_obj_set_size(obj, 245, 65);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                            lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xff2f3237), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_c, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -3705,7 +3238,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_b_label_name = obj;
                                     lv_obj_set_pos(obj, -11, -14);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_20, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "B");
                                 }
                                 {
@@ -3714,13 +3247,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_b_slot_1 = obj;
                                     lv_obj_set_pos(obj, 11, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffec0a0a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3729,13 +3256,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_b_slot_2 = obj;
                                     lv_obj_set_pos(obj, 64, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0a40ec), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3744,13 +3265,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_b_slot_3 = obj;
                                     lv_obj_set_pos(obj, 116, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffece90a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3759,13 +3274,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_b_slot_4 = obj;
                                     lv_obj_set_pos(obj, 169, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffd0bdbb), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3774,12 +3283,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_b_indicator = obj;
                                     lv_obj_set_pos(obj, -13, 14);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "    ");
                                 }
                             }
@@ -3791,18 +3295,7 @@ void create_screen_scan_result() {
                             lv_obj_set_pos(obj, -9, 80);
                             lv_obj_set_size(obj, 245, 65);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                            lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xff2f3237), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_c, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -3811,7 +3304,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_c_label_name = obj;
                                     lv_obj_set_pos(obj, -11, -13);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_20, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "C");
                                 }
                                 {
@@ -3820,13 +3313,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_c_slot_1 = obj;
                                     lv_obj_set_pos(obj, 11, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffec0a0a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3835,13 +3322,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_c_slot_2 = obj;
                                     lv_obj_set_pos(obj, 64, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0a40ec), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3850,13 +3331,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_c_slot_3 = obj;
                                     lv_obj_set_pos(obj, 116, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffece90a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3865,13 +3340,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_c_slot_4 = obj;
                                     lv_obj_set_pos(obj, 169, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffd0bdbb), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3880,12 +3349,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_c_indicator = obj;
                                     lv_obj_set_pos(obj, -13, 14);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "    ");
                                 }
                             }
@@ -3897,18 +3361,7 @@ void create_screen_scan_result() {
                             lv_obj_set_pos(obj, 249, 80);
                             lv_obj_set_size(obj, 245, 65);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                            lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_color(obj, lv_color_hex(0xff2f3237), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_c, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -3917,7 +3370,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_d_label_name = obj;
                                     lv_obj_set_pos(obj, -11, -13);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_20, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "D");
                                 }
                                 {
@@ -3926,13 +3379,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_d_slot_1 = obj;
                                     lv_obj_set_pos(obj, 11, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffec0a0a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3941,13 +3388,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_d_slot_2 = obj;
                                     lv_obj_set_pos(obj, 64, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0a40ec), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3956,13 +3397,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_d_slot_3 = obj;
                                     lv_obj_set_pos(obj, 116, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffece90a), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_b_slot_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3971,13 +3406,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_d_slot_4 = obj;
                                     lv_obj_set_pos(obj, 169, -13);
                                     lv_obj_set_size(obj, 45, 45);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xffd0bdbb), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_slot, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -3986,12 +3415,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ams_d_indicator = obj;
                                     lv_obj_set_pos(obj, -11, 14);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_main_panel_ams_panel_ams_a_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "    ");
                                 }
                             }
@@ -4003,17 +3427,7 @@ void create_screen_scan_result() {
                             lv_obj_set_pos(obj, 507, 80);
                             lv_obj_set_size(obj, 78, 64);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                            lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -4022,9 +3436,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ht_b_label_name = obj;
                                     lv_obj_set_pos(obj, -14, -17);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_ht_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "HT-B");
                                 }
                                 {
@@ -4033,17 +3445,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ht_b_slot = obj;
                                     lv_obj_set_pos(obj, 1, 2);
                                     lv_obj_set_size(obj, 30, 30);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff726e6e), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_stop(obj, 200, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_main_stop(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff352a2a), LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_ht_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -4052,12 +3454,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ht_b_indicator = obj;
                                     lv_obj_set_pos(obj, 30, -15);
                                     lv_obj_set_size(obj, 15, 12);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "    ");
                                 }
                             }
@@ -4069,17 +3466,7 @@ void create_screen_scan_result() {
                             lv_obj_set_pos(obj, 594, 3);
                             lv_obj_set_size(obj, 78, 64);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                            lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -4088,9 +3475,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ext_l_label_name = obj;
                                     lv_obj_set_pos(obj, -14, -17);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_ht_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "EXT-L");
                                 }
                                 {
@@ -4099,17 +3484,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ext_l_slot = obj;
                                     lv_obj_set_pos(obj, 1, 2);
                                     lv_obj_set_size(obj, 30, 30);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff726e6e), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_stop(obj, 200, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_main_stop(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff352a2a), LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_ht_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -4118,12 +3493,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ext_l_indicator = obj;
                                     lv_obj_set_pos(obj, 33, -15);
                                     lv_obj_set_size(obj, 12, 12);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, " ");
                                 }
                             }
@@ -4135,17 +3505,7 @@ void create_screen_scan_result() {
                             lv_obj_set_pos(obj, 594, 80);
                             lv_obj_set_size(obj, 78, 64);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                            lv_obj_set_style_arc_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_rounded(obj, false, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_arc_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_border_width(obj, 3, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_main_screen_ams_ht, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -4154,9 +3514,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ext_r_label_name = obj;
                                     lv_obj_set_pos(obj, -14, -17);
                                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_12, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_ht_2, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "EXT-R");
                                 }
                                 {
@@ -4165,17 +3523,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ext_r_slot = obj;
                                     lv_obj_set_pos(obj, 1, 2);
                                     lv_obj_set_size(obj, 30, 30);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff726e6e), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_color(obj, lv_color_hex(0xffbab1b1), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_stop(obj, 200, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_main_stop(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xff352a2a), LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_ht_3, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "");
                                 }
                                 {
@@ -4184,12 +3532,7 @@ void create_screen_scan_result() {
                                     objects.scan_screen_main_panel_ams_panel_ext_r_indicator = obj;
                                     lv_obj_set_pos(obj, 28, -15);
                                     lv_obj_set_size(obj, 17, 12);
-                                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_10, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                                    lv_obj_set_style_text_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_main_screen_ams_right_nozzle_indicator, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "    ");
                                 }
                             }
@@ -4202,7 +3545,7 @@ void create_screen_scan_result() {
                     objects.scan_screen_button_assign_save = obj;
                     lv_obj_set_pos(obj, 2, 338);
                     lv_obj_set_size(obj, 706, 50);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_scan_screen_button_assign_save, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -4212,7 +3555,7 @@ void create_screen_scan_result() {
                             lv_obj_set_pos(obj, 0, 0);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_obj_set_style_align(obj, LV_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_button_assign_save_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Assign & Save");
                         }
                     }
@@ -4228,12 +3571,12 @@ void tick_screen_scan_result() {
 }
 
 void create_screen_spool_details() {
+    init_shared_styles();
     lv_obj_t *obj = lv_obj_create(0);
     objects.spool_details = obj;
     lv_obj_set_pos(obj, 0, 0);
     lv_obj_set_size(obj, 800, 480);
-    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(obj, &style_main_screen, LV_PART_MAIN | LV_STATE_DEFAULT);
     {
         lv_obj_t *parent_obj = obj;
         {
@@ -4242,17 +3585,7 @@ void create_screen_spool_details() {
             objects.spool_screen_top_bar = obj;
             lv_obj_set_pos(obj, 0, 0);
             lv_obj_set_size(obj, 800, 44);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_top_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -4290,9 +3623,7 @@ void create_screen_spool_details() {
                     lv_obj_set_pos(obj, 698, 10);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_signal);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_wifi_signal, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // spool_screen_top_bar_icon_notifiastion_bell
@@ -4309,7 +3640,7 @@ void create_screen_spool_details() {
                     objects.spool_screen_top_bar_label_clock = obj;
                     lv_obj_set_pos(obj, 737, 12);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_clock, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
             }
@@ -4320,14 +3651,7 @@ void create_screen_spool_details() {
             objects.spool_screen_main_panel = obj;
             lv_obj_set_pos(obj, 29, 66);
             lv_obj_set_size(obj, 751, 380);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_scan_screen_main_panel, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -4336,12 +3660,7 @@ void create_screen_spool_details() {
                     objects.spool_screen_main_panel_button_edit = obj;
                     lv_obj_set_pos(obj, 236, 295);
                     lv_obj_set_size(obj, 230, 50);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_spool_screen_main_panel_button_edit, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -4351,7 +3670,7 @@ void create_screen_spool_details() {
                             lv_obj_set_pos(obj, 0, 0);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_obj_set_style_align(obj, LV_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_button_assign_save_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Edit");
                         }
                     }
@@ -4377,7 +3696,7 @@ void create_screen_spool_details() {
                             lv_obj_set_pos(obj, 0, 0);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_obj_set_style_align(obj, LV_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_button_assign_save_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Remove");
                         }
                     }
@@ -4388,12 +3707,7 @@ void create_screen_spool_details() {
                     objects.spool_screen_main_panel_button_assign = obj;
                     lv_obj_set_pos(obj, -3, 295);
                     lv_obj_set_size(obj, 230, 50);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_spool_screen_main_panel_button_edit, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -4403,7 +3717,7 @@ void create_screen_spool_details() {
                             lv_obj_set_pos(obj, 0, 0);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_obj_set_style_align(obj, LV_ALIGN_CENTER, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_button_assign_save_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Assign Slot");
                         }
                     }
@@ -4415,11 +3729,7 @@ void create_screen_spool_details() {
                     lv_obj_set_pos(obj, -3, 66);
                     lv_obj_set_size(obj, 706, 77);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_spool_screen_main_panel_middle_panel, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -4428,7 +3738,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_middle_panel_label_name = obj;
                             lv_obj_set_pos(obj, -7, -14);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Print Settings");
                         }
                         {
@@ -4437,7 +3747,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_middle_panel_label_nozzle = obj;
                             lv_obj_set_pos(obj, -8, 7);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Nozzle");
                         }
                         {
@@ -4446,7 +3756,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_middle_panel_label_bed = obj;
                             lv_obj_set_pos(obj, 103, 7);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Bed");
                         }
                         {
@@ -4455,7 +3765,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_middle_panel_label_speed = obj;
                             lv_obj_set_pos(obj, 195, 7);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Max. Speed");
                         }
                         {
@@ -4464,7 +3774,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_middle_panel_label_nozzle_label = obj;
                             lv_obj_set_pos(obj, -7, 25);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4473,7 +3783,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_middle_panel_label_bed_value = obj;
                             lv_obj_set_pos(obj, 103, 25);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4482,7 +3792,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_middle_panel_label_speed_value = obj;
                             lv_obj_set_pos(obj, 195, 25);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4491,7 +3801,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_middle_panel_label_k_profile = obj;
                             lv_obj_set_pos(obj, 318, 9);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "K Profile");
                         }
                         {
@@ -4500,7 +3810,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_middle_panel_label_k_profile_value = obj;
                             lv_obj_set_pos(obj, 319, 25);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -4512,11 +3822,7 @@ void create_screen_spool_details() {
                     lv_obj_set_pos(obj, -3, -9);
                     lv_obj_set_size(obj, 706, 66);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_spool_screen_main_panel_middle_panel, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -4534,9 +3840,7 @@ void create_screen_spool_details() {
                             lv_obj_set_pos(obj, -8, -10);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_image_set_src(obj, &img_spool_fill);
-                            lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xfffad607), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_ams_screen_ams_panel_amd_d_slot_4_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // spool_screen_main_panel_top_label_weight
@@ -4544,9 +3848,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_top_label_weight = obj;
                             lv_obj_set_pos(obj, 38, -10);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_radius(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_weight, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4555,7 +3857,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_top_label_spool_material = obj;
                             lv_obj_set_pos(obj, 186, -10);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4564,7 +3866,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_top_label_color = obj;
                             lv_obj_set_pos(obj, 99, 16);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xfffafafa), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament_color, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4573,7 +3875,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_top_label_spool_vendor = obj;
                             lv_obj_set_pos(obj, 99, -10);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4582,9 +3884,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_top_label_spool_fill_level = obj;
                             lv_obj_set_pos(obj, 38, 16);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_radius(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_weight_percentage, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -4605,7 +3905,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_name = obj;
                             lv_obj_set_pos(obj, -8, -14);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Spool Information");
                         }
                         {
@@ -4614,7 +3914,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_tag_id = obj;
                             lv_obj_set_pos(obj, -8, 7);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Tag ID");
                         }
                         {
@@ -4623,7 +3923,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_weight = obj;
                             lv_obj_set_pos(obj, 180, 7);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Initial Weight");
                         }
                         {
@@ -4632,7 +3932,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_used = obj;
                             lv_obj_set_pos(obj, 180, 54);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Used");
                         }
                         {
@@ -4641,7 +3941,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_last_weighed = obj;
                             lv_obj_set_pos(obj, 439, 7);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Last Weighed");
                         }
                         {
@@ -4650,7 +3950,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_added = obj;
                             lv_obj_set_pos(obj, -7, 56);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffaca7a7), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_k_factor, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Added");
                         }
                         {
@@ -4659,7 +3959,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_tag_value = obj;
                             lv_obj_set_pos(obj, -8, 27);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4668,7 +3968,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_weight_value = obj;
                             lv_obj_set_pos(obj, 180, 27);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4677,7 +3977,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_used_value = obj;
                             lv_obj_set_pos(obj, 180, 74);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4686,7 +3986,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_last_weighed_value = obj;
                             lv_obj_set_pos(obj, 439, 27);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4695,7 +3995,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_added_value = obj;
                             lv_obj_set_pos(obj, -7, 74);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_filament, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -4704,9 +4004,7 @@ void create_screen_spool_details() {
                             objects.spool_screen_main_panel_bottom_label_used_value_percentage = obj;
                             lv_obj_set_pos(obj, 221, 74);
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                            lv_obj_set_style_radius(obj, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_spool_panel_label_weight_percentage, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                     }
@@ -4722,12 +4020,12 @@ void tick_screen_spool_details() {
 }
 
 void create_screen_settings_screen() {
+    init_shared_styles();
     lv_obj_t *obj = lv_obj_create(0);
     objects.settings_screen = obj;
     lv_obj_set_pos(obj, 0, 0);
     lv_obj_set_size(obj, 800, 480);
-    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(obj, &style_main_screen, LV_PART_MAIN | LV_STATE_DEFAULT);
     {
         lv_obj_t *parent_obj = obj;
         {
@@ -4736,18 +4034,8 @@ void create_screen_settings_screen() {
             objects.settings_screen_top_bar_ = obj;
             lv_obj_set_pos(obj, 0, 0);
             lv_obj_set_size(obj, 800, 44);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_top_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -4776,9 +4064,7 @@ void create_screen_settings_screen() {
                     lv_obj_set_pos(obj, 698, 10);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_signal);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_wifi_signal, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // settings_screen_top_bar_icon_notification_bell
@@ -4795,7 +4081,7 @@ void create_screen_settings_screen() {
                     objects.settings_screen_top_bar_label_clock = obj;
                     lv_obj_set_pos(obj, 737, 12);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_clock, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
                 {
@@ -4864,16 +4150,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_printers = obj;
                     lv_obj_set_pos(obj, 200, 0);
                     lv_obj_set_size(obj, 200, 40);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_printers, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff252525), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -4884,8 +4162,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 80, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff888888), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_printers_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Printers");
                         }
                     }
@@ -4896,16 +4173,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_hardware = obj;
                     lv_obj_set_pos(obj, 400, 0);
                     lv_obj_set_size(obj, 200, 40);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_printers, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff252525), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -4916,8 +4185,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 80, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff888888), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_printers_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Hardware");
                         }
                     }
@@ -4928,16 +4196,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_system = obj;
                     lv_obj_set_pos(obj, 600, 0);
                     lv_obj_set_size(obj, 200, 40);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_printers, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff252525), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_clip_corner(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -4948,8 +4208,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 80, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff888888), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_printers_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "System");
                         }
                     }
@@ -4962,15 +4221,8 @@ void create_screen_settings_screen() {
             objects.settings_screen_tabs_network_content = obj;
             lv_obj_set_pos(obj, 0, 84);
             lv_obj_set_size(obj, 800, 396);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -4979,15 +4231,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_network_content_wifi = obj;
                     lv_obj_set_pos(obj, 15, 10);
                     lv_obj_set_size(obj, 770, 50);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -4998,8 +4243,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 200, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "WiFi Network");
                         }
                         {
@@ -5010,8 +4254,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 150, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff888888), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_printers_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "SpoolBuddy_5G");
                         }
                         {
@@ -5022,8 +4265,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 20, 24);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff666666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_icon_select, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, ">");
                         }
                         {
@@ -5034,8 +4276,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 70, 69);
                             lv_image_set_src(obj, &img_wifi);
                             lv_image_set_scale(obj, 20);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_top_panel_icon_ok, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // settings_screen_tabs_network_content_wifi_label_ip_address
@@ -5045,8 +4286,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 150, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff888888), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_printers_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "192.168.1.42");
                         }
                     }
@@ -5059,15 +4299,8 @@ void create_screen_settings_screen() {
             objects.settings_screen_tabs_printers_content = obj;
             lv_obj_set_pos(obj, 0, 84);
             lv_obj_set_size(obj, 800, 396);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -5076,15 +4309,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_printers_content_add_printer = obj;
                     lv_obj_set_pos(obj, 15, 10);
                     lv_obj_set_size(obj, 770, 50);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -5095,8 +4321,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 200, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Add Printer");
                         }
                         {
@@ -5107,8 +4332,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 20, 24);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff666666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_icon_select, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, ">");
                         }
                         {
@@ -5119,8 +4343,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_image_set_src(obj, &img_add);
                             lv_image_set_scale(obj, 80);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_top_panel_icon_ok, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -5130,15 +4353,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_printers_content_printer_1 = obj;
                     lv_obj_set_pos(obj, 15, 70);
                     lv_obj_set_size(obj, 770, 50);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -5149,8 +4365,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 200, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "H2D-1");
                         }
                         {
@@ -5161,8 +4376,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 67, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff888888), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_printers_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Online");
                         }
                         {
@@ -5173,8 +4387,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 20, 24);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff666666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_icon_select, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, ">");
                         }
                         {
@@ -5185,8 +4398,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_image_set_src(obj, &img_3d_cube);
                             lv_image_set_scale(obj, 80);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_top_panel_icon_ok, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -5198,15 +4410,8 @@ void create_screen_settings_screen() {
             objects.settings_screen_tabs_hardware_content = obj;
             lv_obj_set_pos(obj, 0, 84);
             lv_obj_set_size(obj, 800, 396);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -5215,15 +4420,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_hardware_content_nfc = obj;
                     lv_obj_set_pos(obj, 15, 10);
                     lv_obj_set_size(obj, 770, 50);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -5234,8 +4432,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 200, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "NFC Reader");
                         }
                         {
@@ -5246,8 +4443,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 150, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff888888), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_printers_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "PN5180");
                         }
                         {
@@ -5258,8 +4454,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 20, 24);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff666666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_icon_select, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, ">");
                         }
                         {
@@ -5270,8 +4465,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_image_set_src(obj, &img_nfc);
                             lv_image_set_scale(obj, 75);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_top_panel_icon_ok, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -5281,15 +4475,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_hardware_content_scale = obj;
                     lv_obj_set_pos(obj, 15, 70);
                     lv_obj_set_size(obj, 770, 50);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -5300,8 +4487,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 200, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Scale");
                         }
                         {
@@ -5312,8 +4498,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 150, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff888888), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_printers_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "NAU7802");
                         }
                         {
@@ -5324,8 +4509,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 20, 24);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff666666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_icon_select, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, ">");
                         }
                         {
@@ -5336,8 +4520,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_image_set_src(obj, &img_scale_2);
                             lv_image_set_scale(obj, 75);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_top_panel_icon_ok, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -5347,15 +4530,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_display_content = obj;
                     lv_obj_set_pos(obj, 15, 130);
                     lv_obj_set_size(obj, 770, 50);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -5366,8 +4542,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 200, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Display");
                         }
                         {
@@ -5378,8 +4553,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 150, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff888888), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_printers_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "7.0\" 800x480");
                         }
                         {
@@ -5390,8 +4564,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 20, 24);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff666666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_icon_select, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, ">");
                         }
                         {
@@ -5402,8 +4575,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_image_set_src(obj, &img_display);
                             lv_image_set_scale(obj, 75);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_top_panel_icon_ok, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -5415,15 +4587,8 @@ void create_screen_settings_screen() {
             objects.settings_screen_tabs_system_content = obj;
             lv_obj_set_pos(obj, 0, 84);
             lv_obj_set_size(obj, 800, 396);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -5432,15 +4597,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_system_content_firmware = obj;
                     lv_obj_set_pos(obj, 15, 10);
                     lv_obj_set_size(obj, 770, 50);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -5451,8 +4609,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 200, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Firmware Version");
                         }
                         {
@@ -5463,8 +4620,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 79, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff888888), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_printers_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "");
                         }
                         {
@@ -5475,8 +4631,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 20, 24);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff666666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_icon_select, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, ">");
                         }
                         {
@@ -5487,8 +4642,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_image_set_src(obj, &img_firmware);
                             lv_image_set_scale(obj, 80);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_top_panel_icon_ok, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -5498,15 +4652,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_system_content_reset = obj;
                     lv_obj_set_pos(obj, 15, 70);
                     lv_obj_set_size(obj, 770, 50);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -5517,8 +4664,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 200, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Factory Reset");
                         }
                         {
@@ -5529,8 +4675,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 20, 24);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff666666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_icon_select, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, ">");
                         }
                         {
@@ -5541,8 +4686,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_image_set_src(obj, &img_reset);
                             lv_image_set_scale(obj, 80);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_top_panel_icon_ok, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -5552,15 +4696,8 @@ void create_screen_settings_screen() {
                     objects.settings_screen_tabs_about_content = obj;
                     lv_obj_set_pos(obj, 15, 130);
                     lv_obj_set_size(obj, 770, 50);
-                    lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_radius(obj, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -5571,8 +4708,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 200, 20);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xffffffff), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_label_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "About");
                         }
                         {
@@ -5583,8 +4719,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, 20, 24);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff666666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content_wifi_icon_select, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, ">");
                         }
                         {
@@ -5595,8 +4730,7 @@ void create_screen_settings_screen() {
                             lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                             lv_image_set_src(obj, &img_about);
                             lv_image_set_scale(obj, 80);
-                            lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_main_panel_top_panel_icon_ok, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -5611,6 +4745,7 @@ void tick_screen_settings_screen() {
 }
 
 void create_screen_settings_wifi_screen() {
+    init_shared_styles();
     lv_obj_t *obj = lv_obj_create(0);
     objects.settings_wifi_screen = obj;
     lv_obj_set_pos(obj, 0, 0);
@@ -5630,18 +4765,8 @@ void create_screen_settings_wifi_screen() {
             objects.settings_wifi_screen_top_bar = obj;
             lv_obj_set_pos(obj, 0, 0);
             lv_obj_set_size(obj, 800, 44);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_top_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -5670,9 +4795,7 @@ void create_screen_settings_wifi_screen() {
                     lv_obj_set_pos(obj, 698, 10);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_signal);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_wifi_signal, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // settings_wifi_screen_top_bar_icon_notification_bell
@@ -5689,7 +4812,7 @@ void create_screen_settings_wifi_screen() {
                     objects.settings_wifi_screen_top_bar_label_clock = obj;
                     lv_obj_set_pos(obj, 737, 12);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_clock, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
                 {
@@ -5709,15 +4832,8 @@ void create_screen_settings_wifi_screen() {
             objects.settings_wifi_screen_content_ = obj;
             lv_obj_set_pos(obj, 0, 44);
             lv_obj_set_size(obj, 800, 436);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -5727,15 +4843,7 @@ void create_screen_settings_wifi_screen() {
                     lv_obj_set_pos(obj, 0, 10);
                     lv_obj_set_size(obj, 765, 343);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -5746,7 +4854,7 @@ void create_screen_settings_wifi_screen() {
                             lv_obj_set_size(obj, 300, 30);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_decor(obj, LV_TEXT_DECOR_UNDERLINE, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_label_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "WiFi Network");
                         }
                         {
@@ -5770,10 +4878,7 @@ void create_screen_settings_wifi_screen() {
                             lv_textarea_set_one_line(obj, true);
                             lv_textarea_set_password_mode(obj, false);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_input_ssid, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // settings_wifi_screen_content_panel_label_password
@@ -5796,10 +4901,7 @@ void create_screen_settings_wifi_screen() {
                             lv_textarea_set_one_line(obj, true);
                             lv_textarea_set_password_mode(obj, false);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_input_ssid, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // settings_wifi_screen_content_panel_label_status
@@ -5818,8 +4920,7 @@ void create_screen_settings_wifi_screen() {
                             lv_obj_set_pos(obj, 213, 250);
                             lv_obj_set_size(obj, 150, 50);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_button_connect_, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -5842,8 +4943,7 @@ void create_screen_settings_wifi_screen() {
                             lv_obj_set_pos(obj, 16, 250);
                             lv_obj_set_size(obj, 180, 50);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_button_connect_, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -5871,12 +4971,12 @@ void tick_screen_settings_wifi_screen() {
 }
 
 void create_screen_settings_printer_add_screen() {
+    init_shared_styles();
     lv_obj_t *obj = lv_obj_create(0);
     objects.settings_printer_add_screen = obj;
     lv_obj_set_pos(obj, 0, 0);
     lv_obj_set_size(obj, 800, 480);
-    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(obj, &style_main_screen, LV_PART_MAIN | LV_STATE_DEFAULT);
     {
         lv_obj_t *parent_obj = obj;
         {
@@ -5885,18 +4985,8 @@ void create_screen_settings_printer_add_screen() {
             objects.settings_printer_add_screen_top_bar = obj;
             lv_obj_set_pos(obj, 0, 0);
             lv_obj_set_size(obj, 800, 44);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_top_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -5925,9 +5015,7 @@ void create_screen_settings_printer_add_screen() {
                     lv_obj_set_pos(obj, 698, 10);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_signal);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_wifi_signal, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // settings_printer_add_screen_top_bar_icon_notification_bell
@@ -5944,7 +5032,7 @@ void create_screen_settings_printer_add_screen() {
                     objects.settings_printer_add_screen_top_bar_label_clock = obj;
                     lv_obj_set_pos(obj, 737, 12);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_clock, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "");
                 }
                 {
@@ -5964,15 +5052,8 @@ void create_screen_settings_printer_add_screen() {
             objects.settings_printer_add_screen_panel = obj;
             lv_obj_set_pos(obj, 0, 44);
             lv_obj_set_size(obj, 800, 436);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -5982,15 +5063,7 @@ void create_screen_settings_printer_add_screen() {
                     lv_obj_set_pos(obj, 0, 10);
                     lv_obj_set_size(obj, 765, 339);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -6001,7 +5074,7 @@ void create_screen_settings_printer_add_screen() {
                             lv_obj_set_size(obj, 300, 30);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_decor(obj, LV_TEXT_DECOR_UNDERLINE, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_label_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Add Printer");
                         }
                         {
@@ -6025,9 +5098,7 @@ void create_screen_settings_printer_add_screen() {
                             lv_textarea_set_one_line(obj, true);
                             lv_textarea_set_password_mode(obj, false);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_printer_add_screen_panel_panel_input_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // settings_printer_add_screen_panel_panel_label_serial
@@ -6050,9 +5121,7 @@ void create_screen_settings_printer_add_screen() {
                             lv_textarea_set_one_line(obj, true);
                             lv_textarea_set_password_mode(obj, false);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_printer_add_screen_panel_panel_input_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // settings_printer_add_screen_panel_panel_label_code
@@ -6075,9 +5144,7 @@ void create_screen_settings_printer_add_screen() {
                             lv_textarea_set_one_line(obj, true);
                             lv_textarea_set_password_mode(obj, false);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_printer_add_screen_panel_panel_input_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // settings_printer_add_screen_panel_panel_button_add
@@ -6086,7 +5153,7 @@ void create_screen_settings_printer_add_screen() {
                             lv_obj_set_pos(obj, 18, 247);
                             lv_obj_set_size(obj, 180, 50);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_button_assign_save, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -6108,7 +5175,7 @@ void create_screen_settings_printer_add_screen() {
                             lv_obj_set_pos(obj, 16, 24);
                             lv_obj_set_size(obj, 100, 30);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_button_assign_save, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -6144,9 +5211,7 @@ void create_screen_settings_printer_add_screen() {
                             lv_textarea_set_one_line(obj, true);
                             lv_textarea_set_password_mode(obj, false);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_printer_add_screen_panel_panel_input_name, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                     }
                 }
@@ -6161,12 +5226,12 @@ void tick_screen_settings_printer_add_screen() {
 }
 
 void create_screen_settings_display_screen() {
+    init_shared_styles();
     lv_obj_t *obj = lv_obj_create(0);
     objects.settings_display_screen = obj;
     lv_obj_set_pos(obj, 0, 0);
     lv_obj_set_size(obj, 800, 480);
-    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(obj, &style_main_screen, LV_PART_MAIN | LV_STATE_DEFAULT);
     {
         lv_obj_t *parent_obj = obj;
         {
@@ -6175,18 +5240,8 @@ void create_screen_settings_display_screen() {
             objects.settings_display_screen_top_bar = obj;
             lv_obj_set_pos(obj, 0, 0);
             lv_obj_set_size(obj, 800, 44);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_top_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -6224,9 +5279,7 @@ void create_screen_settings_display_screen() {
                     lv_obj_set_pos(obj, 698, 10);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_signal);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_wifi_signal, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // settings_display_screen_top_bar_icon_notification_bell
@@ -6243,7 +5296,7 @@ void create_screen_settings_display_screen() {
                     objects.settings_display_screen_top_bar_label_clock = obj;
                     lv_obj_set_pos(obj, 737, 12);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_clock, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "10:23");
                 }
             }
@@ -6254,15 +5307,8 @@ void create_screen_settings_display_screen() {
             objects.settings_display_screen_content = obj;
             lv_obj_set_pos(obj, 0, 44);
             lv_obj_set_size(obj, 800, 436);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -6272,15 +5318,7 @@ void create_screen_settings_display_screen() {
                     lv_obj_set_pos(obj, 0, 10);
                     lv_obj_set_size(obj, 765, 217);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -6291,7 +5329,7 @@ void create_screen_settings_display_screen() {
                             lv_obj_set_size(obj, 300, 30);
                             lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_text_decor(obj, LV_TEXT_DECOR_UNDERLINE, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_label_wifi, LV_PART_MAIN | LV_STATE_DEFAULT);
                             lv_label_set_text(obj, "Display Settings");
                         }
                         {
@@ -6341,12 +5379,7 @@ void create_screen_settings_display_screen() {
                             lv_obj_set_pos(obj, 18, 119);
                             lv_obj_set_size(obj, 150, 10);
                             lv_slider_set_value(obj, 25, LV_ANIM_OFF);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_display_screen_content_panel_label_brightness_slider, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // settings_display_screen_content_panel_label_timeout_slider
@@ -6356,12 +5389,7 @@ void create_screen_settings_display_screen() {
                             lv_obj_set_size(obj, 150, 10);
                             lv_slider_set_range(obj, 0, 900);
                             lv_slider_set_value(obj, 300, LV_ANIM_OFF);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                            lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_settings_display_screen_content_panel_label_brightness_slider, LV_PART_MAIN | LV_STATE_DEFAULT);
                         }
                         {
                             // settings_display_screen_content_panel_label_resolution_value
@@ -6396,12 +5424,12 @@ void tick_screen_settings_display_screen() {
 }
 
 void create_screen_settings_update_screen() {
+    init_shared_styles();
     lv_obj_t *obj = lv_obj_create(0);
     objects.settings_update_screen = obj;
     lv_obj_set_pos(obj, 0, 0);
     lv_obj_set_size(obj, 800, 480);
-    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(obj, &style_main_screen, LV_PART_MAIN | LV_STATE_DEFAULT);
     {
         lv_obj_t *parent_obj = obj;
         {
@@ -6410,18 +5438,8 @@ void create_screen_settings_update_screen() {
             objects.settings_update_screen_top_bar = obj;
             lv_obj_set_pos(obj, 0, 0);
             lv_obj_set_size(obj, 800, 44);
-            lv_obj_set_style_pad_left(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_top_bar, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_color(obj, lv_color_hex(0xff3d3d3d), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -6459,9 +5477,7 @@ void create_screen_settings_update_screen() {
                     lv_obj_set_pos(obj, 698, 10);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
                     lv_image_set_src(obj, &img_signal);
-                    lv_obj_set_style_image_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_image_recolor_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_wifi_signal, LV_PART_MAIN | LV_STATE_DEFAULT);
                 }
                 {
                     // settings_update_screen_top_bar_icon_notification_bell
@@ -6478,7 +5494,7 @@ void create_screen_settings_update_screen() {
                     objects.settings_update_screen_top_bar_label_clock = obj;
                     lv_obj_set_pos(obj, 737, 12);
                     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-                    lv_obj_set_style_text_font(obj, &lv_font_montserrat_18, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_top_bar_clock, LV_PART_MAIN | LV_STATE_DEFAULT);
                     lv_label_set_text(obj, "10:23");
                 }
             }
@@ -6489,15 +5505,8 @@ void create_screen_settings_update_screen() {
             objects.settings_update_screen_top_bar_content = obj;
             lv_obj_set_pos(obj, 0, 44);
             lv_obj_set_size(obj, 800, 436);
-            lv_obj_set_style_pad_top(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_bottom(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_add_style(obj, &style_settings_screen_tabs_network_content, LV_PART_MAIN | LV_STATE_DEFAULT);
             lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW);
-            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff1a1a1a), LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_bg_opa(obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_radius(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_left(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
-            lv_obj_set_style_pad_right(obj, 15, LV_PART_MAIN | LV_STATE_DEFAULT);
             {
                 lv_obj_t *parent_obj = obj;
                 {
@@ -6507,15 +5516,7 @@ void create_screen_settings_update_screen() {
                     lv_obj_set_pos(obj, 0, 10);
                     lv_obj_set_size(obj, 765, 232);
                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-                    lv_obj_set_style_arc_width(obj, 5, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_arc_rounded(obj, true, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff2d2d2d), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_width(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_x(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_ofs_y(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_spread(obj, 1, LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_color(obj, lv_color_hex(0xff796666), LV_PART_MAIN | LV_STATE_DEFAULT);
-                    lv_obj_set_style_shadow_opa(obj, 100, LV_PART_MAIN | LV_STATE_DEFAULT);
+                    lv_obj_add_style(obj, &style_settings_wifi_screen_content_panel_, LV_PART_MAIN | LV_STATE_DEFAULT);
                     {
                         lv_obj_t *parent_obj = obj;
                         {
@@ -6565,7 +5566,7 @@ void create_screen_settings_update_screen() {
                             lv_obj_set_pos(obj, 16, 136);
                             lv_obj_set_size(obj, 152, 50);
                             lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                            lv_obj_set_style_bg_color(obj, lv_color_hex(0xff00ff00), LV_PART_MAIN | LV_STATE_DEFAULT);
+                            lv_obj_add_style(obj, &style_scan_screen_button_assign_save, LV_PART_MAIN | LV_STATE_DEFAULT);
                             {
                                 lv_obj_t *parent_obj = obj;
                                 {
@@ -6576,7 +5577,7 @@ void create_screen_settings_update_screen() {
                                     lv_obj_set_size(obj, 140, 14);
                                     lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
                                     lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE);
-                                    lv_obj_set_style_text_color(obj, lv_color_hex(0xff000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+                                    lv_obj_add_style(obj, &style_scan_screen_button_assign_save_label, LV_PART_MAIN | LV_STATE_DEFAULT);
                                     lv_label_set_text(obj, "Check for Updates");
                                 }
                             }
@@ -24,71 +24,72 @@
 #define LV_ATTRIBUTE_IMG_CIRCLE
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 10000 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_CIRCLE
 uint8_t img_circle_map[] = {
 
-    0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xef,0xef,0xef,0xff,0xe1,0xe1,0xe1,0xff,0xd4,0xd4,0xd4,0xff,0xd9,0xd9,0xd9,0xff,0xcc,0xcc,0xcc,0xff,0xdb,0xdb,0xdb,0xff,0xdf,0xdf,0xdf,0xff,0xeb,0xeb,0xeb,0xff,0xfc,0xfc,0xfc,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xf2,0xf2,0xf2,0xff,
-    0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xde,0xde,0xde,0xff,0xba,0xba,0xba,0xff,0xa3,0xa3,0xa3,0xff,0xa5,0xa5,0xa5,0xff,0xad,0xad,0xad,0xff,0xc2,0xc2,0xc2,0xff,0xd0,0xd0,0xd0,0xff,0xcf,0xcf,0xcf,0xff,0xdb,0xdb,0xdb,0xff,0xcb,0xcb,0xcb,0xff,0xc4,0xc4,0xc4,0xff,0xb2,0xb2,0xb2,0xff,0x9f,0x9f,0x9f,0xff,0xa1,0xa1,0xa1,0xff,0xb5,0xb5,0xb5,0xff,0xe2,0xe2,0xe2,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,
-    0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xee,0xee,0xee,0xff,0xbb,0xbb,0xbb,0xff,0x9d,0x9d,0x9d,0xff,0xc1,0xc1,0xc1,0xff,0xe2,0xe2,0xe2,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xeb,0xeb,0xeb,0xff,0xbc,0xbc,0xbc,0xff,0x9a,0x9a,0x9a,0xff,0xb5,0xb5,0xb5,0xff,0xec,0xec,0xec,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,
-    0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xee,0xee,0xee,0xff,0xab,0xab,0xab,0xff,0xa2,0xa2,0xa2,0xff,0xdf,0xdf,0xdf,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xe4,0xe4,0xe4,0xff,0xac,0xac,0xac,0xff,0xae,0xae,0xae,0xff,0xec,0xec,0xec,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xc8,0xc8,0xc8,0xff,0xa0,0xa0,0xa0,0xff,0xe6,0xe6,0xe6,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xe8,0xe8,0xe8,0xff,0xa0,0xa0,0xa0,0xff,0xbb,0xbb,0xbb,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,
-    0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xeb,0xeb,0xeb,0xff,0x9f,0x9f,0x9f,0xff,0xcf,0xcf,0xcf,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xd3,0xd3,0xd3,0xff,0x95,0x95,0x95,0xff,0xe5,0xe5,0xe5,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,
-    0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xdd,0xdd,0xdd,0xff,0x97,0x97,0x97,0xff,0xe7,0xe7,0xe7,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xef,0xef,0xef,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf3,0xf3,0xf3,0xff,0xf6,0xf6,0xf6,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xeb,0xeb,0xeb,0xff,0x9c,0x9c,0x9c,0xff,0xd2,0xd2,0xd2,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfa,0xfa,0xfa,0xff,
-    0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xdb,0xdb,0xdb,0xff,0xa0,0xa0,0xa0,0xff,0xf2,0xf2,0xf2,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf6,0xf6,0xf6,0xff,0xf3,0xf3,0xf3,0xff,0xfc,0xfc,0xfc,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xef,0xef,0xef,0xff,0xae,0xae,0xae,0xff,0xc8,0xc8,0xc8,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xf2,0xf2,0xf2,0xff,
-    0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xdc,0xdc,0xdc,0xff,0xa2,0xa2,0xa2,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xaf,0xaf,0xaf,0xff,0xcd,0xcd,0xcd,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,
-    0xf8,0xf8,0xf8,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xe2,0xe2,0xe2,0xff,0x9a,0x9a,0x9a,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf8,0xf8,0xf8,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf8,0xf8,0xf8,0xff,0xf3,0xf3,0xf3,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf8,0xf8,0xf8,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf3,0xf3,0xf3,0xff,0xf8,0xf8,0xf8,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf8,0xf8,0xf8,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf3,0xf3,0xf3,0xff,0xa8,0xa8,0xa8,0xff,0xd9,0xd9,0xd9,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,
-    0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf1,0xf1,0xf1,0xff,0x92,0x92,0x92,0xff,0xf3,0xf3,0xf3,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0x94,0x94,0x94,0xff,0xeb,0xeb,0xeb,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xa3,0xa3,0xa3,0xff,0xe6,0xe6,0xe6,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xe9,0xe9,0xe9,0xff,0x98,0x98,0x98,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,
-    0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xd4,0xd4,0xd4,0xff,0xc1,0xc1,0xc1,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xc6,0xc6,0xc6,0xff,0xcc,0xcc,0xcc,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,
-    0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0x95,0x95,0x95,0xff,0xfa,0xfa,0xfa,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xef,0xef,0xef,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf3,0xf3,0xf3,0xff,0xf6,0xf6,0xf6,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0x96,0x96,0x96,0xff,0xf8,0xf8,0xf8,0xff,0xed,0xed,0xed,0xff,0xfa,0xfa,0xfa,0xff,
-    0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xc1,0xc1,0xc1,0xff,0xd4,0xd4,0xd4,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf6,0xf6,0xf6,0xff,0xf3,0xf3,0xf3,0xff,0xfc,0xfc,0xfc,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xe3,0xe3,0xe3,0xff,0xb6,0xb6,0xb6,0xff,0xfe,0xfe,0xfe,0xff,0xf2,0xf2,0xf2,0xff,
-    0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0x95,0x95,0x95,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0x9c,0x9c,0x9c,0xff,0xef,0xef,0xef,0xff,0xf8,0xf8,0xf8,0xff,
-    0xf9,0xf9,0xf9,0xff,0xd5,0xd5,0xd5,0xff,0xc9,0xc9,0xc9,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf3,0xf3,0xf3,0xff,0xf9,0xf9,0xf9,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf2,0xf2,0xf2,0xff,0xf9,0xf9,0xf9,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xf9,0xf9,0xf9,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xcb,0xcb,0xcb,0xff,0xd0,0xd0,0xd0,0xff,0xf4,0xf4,0xf4,0xff,
-    0xf4,0xf4,0xf4,0xff,0xa2,0xa2,0xa2,0xff,0xf1,0xf1,0xf1,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0x9f,0x9f,0x9f,0xff,0xf7,0xf7,0xf7,0xff,
-    0xf3,0xf3,0xf3,0xff,0x9e,0x9e,0x9e,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xa2,0xa2,0xa2,0xff,0xf3,0xf3,0xf3,0xff,
-    0xe4,0xe4,0xe4,0xff,0xbb,0xbb,0xbb,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xcc,0xcc,0xcc,0xff,0xd3,0xd3,0xd3,0xff,
-    0xbd,0xbd,0xbd,0xff,0xe5,0xe5,0xe5,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xef,0xef,0xef,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf3,0xf3,0xf3,0xff,0xf6,0xf6,0xf6,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xdd,0xdd,0xdd,0xff,0xbf,0xbf,0xbf,0xff,
-    0xab,0xab,0xab,0xff,0xed,0xed,0xed,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf6,0xf6,0xf6,0xff,0xf3,0xf3,0xf3,0xff,0xfc,0xfc,0xfc,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0x9c,0x9c,0x9c,0xff,
-    0x9d,0x9d,0x9d,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfc,0xfc,0xfc,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xf0,0xf0,0xf0,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfc,0xfc,0xfc,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf0,0xf0,0xf0,0xff,0xa2,0xa2,0xa2,0xff,
-    0xa6,0xa6,0xa6,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfa,0xfa,0xfa,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfa,0xfa,0xfa,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfa,0xfa,0xfa,0xff,0xa4,0xa4,0xa4,0xff,
-    0xa3,0xa3,0xa3,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xa6,0xa6,0xa6,0xff,
-    0xa3,0xa3,0xa3,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xa6,0xa6,0xa6,0xff,
-    0xa6,0xa6,0xa6,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xa4,0xa4,0xa4,0xff,
-    0x9b,0x9b,0x9b,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xef,0xef,0xef,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf3,0xf3,0xf3,0xff,0xf6,0xf6,0xf6,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xa3,0xa3,0xa3,0xff,
-    0xab,0xab,0xab,0xff,0xed,0xed,0xed,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf6,0xf6,0xf6,0xff,0xf3,0xf3,0xf3,0xff,0xfc,0xfc,0xfc,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0x9c,0x9c,0x9c,0xff,
-    0xbe,0xbe,0xbe,0xff,0xe3,0xe3,0xe3,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xef,0xef,0xef,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfc,0xfc,0xfc,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf1,0xf1,0xf1,0xff,0xfc,0xfc,0xfc,0xff,0xf0,0xf0,0xf0,0xff,0xfa,0xfa,0xfa,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0xfc,0xfc,0xfc,0xff,0xdf,0xdf,0xdf,0xff,0xbe,0xbe,0xbe,0xff,
-    0xe4,0xe4,0xe4,0xff,0xbb,0xbb,0xbb,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfa,0xfa,0xfa,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf1,0xf1,0xf1,0xff,0xcc,0xcc,0xcc,0xff,0xd3,0xd3,0xd3,0xff,
-    0xf3,0xf3,0xf3,0xff,0x9e,0x9e,0x9e,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xa2,0xa2,0xa2,0xff,0xf3,0xf3,0xf3,0xff,
-    0xf4,0xf4,0xf4,0xff,0xa2,0xa2,0xa2,0xff,0xf0,0xf0,0xf0,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0x9f,0x9f,0x9f,0xff,0xf7,0xf7,0xf7,0xff,
-    0xfb,0xfb,0xfb,0xff,0xd5,0xd5,0xd5,0xff,0xca,0xca,0xca,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xca,0xca,0xca,0xff,0xd1,0xd1,0xd1,0xff,0xf3,0xf3,0xf3,0xff,
-    0xee,0xee,0xee,0xff,0xfa,0xfa,0xfa,0xff,0x96,0x96,0x96,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0xfc,0xfc,0xfc,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfe,0xfe,0xfe,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf6,0xf6,0xf6,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xee,0xee,0xee,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0x9d,0x9d,0x9d,0xff,0xec,0xec,0xec,0xff,0xfa,0xfa,0xfa,0xff,
-    0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xc1,0xc1,0xc1,0xff,0xd4,0xd4,0xd4,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf6,0xf6,0xf6,0xff,0xf3,0xf3,0xf3,0xff,0xfc,0xfc,0xfc,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xe3,0xe3,0xe3,0xff,0xb6,0xb6,0xb6,0xff,0xfe,0xfe,0xfe,0xff,0xf2,0xf2,0xf2,0xff,
-    0xee,0xee,0xee,0xff,0xfa,0xfa,0xfa,0xff,0xf3,0xf3,0xf3,0xff,0x95,0x95,0x95,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfd,0xfd,0xfd,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0xfc,0xfc,0xfc,0xff,0xee,0xee,0xee,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfd,0xfd,0xfd,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xef,0xef,0xef,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfd,0xfd,0xfd,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0x96,0x96,0x96,0xff,0xf8,0xf8,0xf8,0xff,0xee,0xee,0xee,0xff,0xf9,0xf9,0xf9,0xff,
-    0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xd4,0xd4,0xd4,0xff,0xc1,0xc1,0xc1,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xc6,0xc6,0xc6,0xff,0xcc,0xcc,0xcc,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,
-    0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xa4,0xa4,0xa4,0xff,0xe5,0xe5,0xe5,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xe9,0xe9,0xe9,0xff,0x98,0x98,0x98,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,
-    0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf1,0xf1,0xf1,0xff,0x92,0x92,0x92,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0x93,0x93,0x93,0xff,0xeb,0xeb,0xeb,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,
-    0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xe5,0xe5,0xe5,0xff,0x9a,0x9a,0x9a,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xa7,0xa7,0xa7,0xff,0xd8,0xd8,0xd8,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,
-    0xee,0xee,0xee,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xde,0xde,0xde,0xff,0xa3,0xa3,0xa3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0xfc,0xfc,0xfc,0xff,0xee,0xee,0xee,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfd,0xfd,0xfd,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xef,0xef,0xef,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xaf,0xaf,0xaf,0xff,0xcc,0xcc,0xcc,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0xfc,0xfc,0xfc,0xff,0xee,0xee,0xee,0xff,0xf9,0xf9,0xf9,0xff,
-    0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xdb,0xdb,0xdb,0xff,0xa0,0xa0,0xa0,0xff,0xf2,0xf2,0xf2,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf6,0xf6,0xf6,0xff,0xf3,0xf3,0xf3,0xff,0xfc,0xfc,0xfc,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xef,0xef,0xef,0xff,0xae,0xae,0xae,0xff,0xc8,0xc8,0xc8,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xf2,0xf2,0xf2,0xff,
-    0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xdd,0xdd,0xdd,0xff,0x97,0x97,0x97,0xff,0xe7,0xe7,0xe7,0xff,0xfc,0xfc,0xfc,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xf0,0xf0,0xf0,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf6,0xf6,0xf6,0xff,0xf9,0xf9,0xf9,0xff,0xf0,0xf0,0xf0,0xff,0xfe,0xfe,0xfe,0xff,0xee,0xee,0xee,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfb,0xfb,0xfb,0xff,0xee,0xee,0xee,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xeb,0xeb,0xeb,0xff,0x9b,0x9b,0x9b,0xff,0xd2,0xd2,0xd2,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xee,0xee,0xee,0xff,0xfa,0xfa,0xfa,0xff,
-    0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xeb,0xeb,0xeb,0xff,0x9f,0x9f,0x9f,0xff,0xcf,0xcf,0xcf,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf1,0xf1,0xf1,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xd3,0xd3,0xd3,0xff,0x95,0x95,0x95,0xff,0xe5,0xe5,0xe5,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,
-    0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xc8,0xc8,0xc8,0xff,0x9f,0x9f,0x9f,0xff,0xe5,0xe5,0xe5,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xe8,0xe8,0xe8,0xff,0xa0,0xa0,0xa0,0xff,0xbc,0xbc,0xbc,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,
-    0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xed,0xed,0xed,0xff,0xab,0xab,0xab,0xff,0xa2,0xa2,0xa2,0xff,0xdf,0xdf,0xdf,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xe4,0xe4,0xe4,0xff,0xad,0xad,0xad,0xff,0xae,0xae,0xae,0xff,0xed,0xed,0xed,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xf7,0xf7,0xf7,0xff,0xf4,0xf4,0xf4,0xff,0xf7,0xf7,0xf7,0xff,
-    0xfa,0xfa,0xfa,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfa,0xfa,0xfa,0xff,0xf3,0xf3,0xf3,0xff,0xee,0xee,0xee,0xff,0xbc,0xbc,0xbc,0xff,0x9d,0x9d,0x9d,0xff,0xc1,0xc1,0xc1,0xff,0xdf,0xdf,0xdf,0xff,0xf9,0xf9,0xf9,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfa,0xfa,0xfa,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf9,0xf9,0xf9,0xff,0xf1,0xf1,0xf1,0xff,0xee,0xee,0xee,0xff,0xbc,0xbc,0xbc,0xff,0x9a,0x9a,0x9a,0xff,0xb5,0xb5,0xb5,0xff,0xea,0xea,0xea,0xff,0xfb,0xfb,0xfb,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xf1,0xf1,0xf1,0xff,0xf9,0xf9,0xf9,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,
-    0xef,0xef,0xef,0xff,0xfa,0xfa,0xfa,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf3,0xf3,0xf3,0xff,0xfb,0xfb,0xfb,0xff,0xef,0xef,0xef,0xff,0xfa,0xfa,0xfa,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf9,0xf9,0xf9,0xff,0xdd,0xdd,0xdd,0xff,0xbc,0xbc,0xbc,0xff,0xa1,0xa1,0xa1,0xff,0xa4,0xa4,0xa4,0xff,0xad,0xad,0xad,0xff,0xc2,0xc2,0xc2,0xff,0xd0,0xd0,0xd0,0xff,0xce,0xce,0xce,0xff,0xdb,0xdb,0xdb,0xff,0xcb,0xcb,0xcb,0xff,0xc4,0xc4,0xc4,0xff,0xb2,0xb2,0xb2,0xff,0x9f,0x9f,0x9f,0xff,0xa4,0xa4,0xa4,0xff,0xb3,0xb3,0xb3,0xff,0xe3,0xe3,0xe3,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfa,0xfa,0xfa,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf2,0xf2,0xf2,0xff,0xfc,0xfc,0xfc,0xff,0xef,0xef,0xef,0xff,0xf9,0xf9,0xf9,0xff,
-    0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf5,0xf5,0xf5,0xff,0xfa,0xfa,0xfa,0xff,0xef,0xef,0xef,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfd,0xfd,0xfd,0xff,0xed,0xed,0xed,0xff,0xfc,0xfc,0xfc,0xff,0xf2,0xf2,0xf2,0xff,0xef,0xef,0xef,0xff,0xe1,0xe1,0xe1,0xff,0xd4,0xd4,0xd4,0xff,0xd9,0xd9,0xd9,0xff,0xcc,0xcc,0xcc,0xff,0xdb,0xdb,0xdb,0xff,0xdf,0xdf,0xdf,0xff,0xeb,0xeb,0xeb,0xff,0xfc,0xfc,0xfc,0xff,0xed,0xed,0xed,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xf1,0xf1,0xf1,0xff,0xf7,0xf7,0xf7,0xff,0xf7,0xf7,0xf7,0xff,0xf1,0xf1,0xf1,0xff,0xfe,0xfe,0xfe,0xff,0xed,0xed,0xed,0xff,0xfb,0xfb,0xfb,0xff,0xf4,0xf4,0xf4,0xff,0xf4,0xf4,0xf4,0xff,0xfa,0xfa,0xfa,0xff,0xee,0xee,0xee,0xff,0xfe,0xfe,0xfe,0xff,0xf2,0xf2,0xf2,0xff,
+    0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0x7d,0xef,0x1c,0xe7,0xba,0xd6,0xdb,0xde,0x79,0xce,0xdb,0xde,0xfb,0xde,0x5d,0xef,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,
+    0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xfb,0xde,0xd7,0xbd,0x14,0xa5,0x34,0xa5,0x75,0xad,0x18,0xc6,0x9a,0xd6,0x79,0xce,0xdb,0xde,0x59,0xce,0x38,0xc6,0x96,0xb5,0xf3,0x9c,0x14,0xa5,0xb6,0xb5,0x1c,0xe7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,
+    0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0x7d,0xef,0xd7,0xbd,0xf3,0x9c,0x18,0xc6,0x1c,0xe7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x5d,0xef,0xf7,0xbd,0xd3,0x9c,0xb6,0xb5,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,
+    0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x7d,0xef,0x55,0xad,0x14,0xa5,0xfb,0xde,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x3c,0xe7,0x75,0xad,0x75,0xad,0x7d,0xef,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,
+    0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x59,0xce,0x14,0xa5,0x3c,0xe7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x5d,0xef,0x14,0xa5,0xd7,0xbd,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,
+    0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x5d,0xef,0xf3,0x9c,0x79,0xce,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0x9a,0xd6,0xb2,0x94,0x3c,0xe7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,
+    0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xfb,0xde,0xb2,0x94,0x3c,0xe7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0x5d,0xef,0xf3,0x9c,0x9a,0xd6,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,
+    0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdb,0xde,0x14,0xa5,0x9e,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x7d,0xef,0x75,0xad,0x59,0xce,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,
+    0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xfb,0xde,0x14,0xa5,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0x75,0xad,0x79,0xce,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,
+    0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x1c,0xe7,0xd3,0x9c,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0x55,0xad,0xdb,0xde,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,
+    0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0x92,0x94,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xb2,0x94,0x5d,0xef,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,
+    0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x14,0xa5,0x3c,0xe7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x5d,0xef,0xd3,0x9c,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,
+    0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xba,0xd6,0x18,0xc6,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x38,0xc6,0x79,0xce,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,
+    0x7d,0xef,0xdf,0xff,0x9e,0xf7,0xb2,0x94,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xb2,0x94,0xdf,0xff,0x7d,0xef,0xdf,0xff,
+    0xff,0xff,0x9e,0xf7,0x18,0xc6,0xba,0xd6,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0x1c,0xe7,0xb6,0xb5,0xff,0xff,0x9e,0xf7,
+    0x9e,0xf7,0xdf,0xff,0xb2,0x94,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xf3,0x9c,0x7d,0xef,0xdf,0xff,
+    0xdf,0xff,0xba,0xd6,0x59,0xce,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x59,0xce,0x9a,0xd6,0xbe,0xf7,
+    0xbe,0xf7,0x14,0xa5,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xf3,0x9c,0xbe,0xf7,
+    0x9e,0xf7,0xf3,0x9c,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x14,0xa5,0x9e,0xf7,
+    0x3c,0xe7,0xd7,0xbd,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0x79,0xce,0x9a,0xd6,
+    0xf7,0xbd,0x3c,0xe7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0xfb,0xde,0xf7,0xbd,
+    0x55,0xad,0x7d,0xef,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0xf3,0x9c,
+    0xf3,0x9c,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0x14,0xa5,
+    0x34,0xa5,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x34,0xa5,
+    0x14,0xa5,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x34,0xa5,
+    0x14,0xa5,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x34,0xa5,
+    0x34,0xa5,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x34,0xa5,
+    0xd3,0x9c,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0x14,0xa5,
+    0x55,0xad,0x7d,0xef,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0xf3,0x9c,
+    0xf7,0xbd,0x1c,0xe7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0xfb,0xde,0xf7,0xbd,
+    0x3c,0xe7,0xd7,0xbd,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0x79,0xce,0x9a,0xd6,
+    0x9e,0xf7,0xf3,0x9c,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x14,0xa5,0x9e,0xf7,
+    0xbe,0xf7,0x14,0xa5,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xf3,0x9c,0xbe,0xf7,
+    0xdf,0xff,0xba,0xd6,0x59,0xce,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x59,0xce,0x9a,0xd6,0x9e,0xf7,
+    0x7d,0xef,0xdf,0xff,0xb2,0x94,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xf3,0x9c,0x7d,0xef,0xdf,0xff,
+    0xff,0xff,0x9e,0xf7,0x18,0xc6,0xba,0xd6,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0x1c,0xe7,0xb6,0xb5,0xff,0xff,0x9e,0xf7,
+    0x7d,0xef,0xdf,0xff,0x9e,0xf7,0xb2,0x94,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0xb2,0x94,0xdf,0xff,0x7d,0xef,0xdf,0xff,
+    0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xba,0xd6,0x18,0xc6,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x38,0xc6,0x79,0xce,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,
+    0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x34,0xa5,0x3c,0xe7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x5d,0xef,0xd3,0x9c,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,
+    0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0x92,0x94,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0x92,0x94,0x5d,0xef,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,
+    0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0x3c,0xe7,0xd3,0x9c,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0x34,0xa5,0xdb,0xde,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,
+    0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xfb,0xde,0x14,0xa5,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0x75,0xad,0x79,0xce,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,
+    0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdb,0xde,0x14,0xa5,0x9e,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x7d,0xef,0x75,0xad,0x59,0xce,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,
+    0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xfb,0xde,0xb2,0x94,0x3c,0xe7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0x5d,0xef,0xd3,0x9c,0x9a,0xd6,0xff,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,
+    0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0x5d,0xef,0xf3,0x9c,0x79,0xce,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0x9a,0xd6,0xb2,0x94,0x3c,0xe7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,
+    0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x59,0xce,0xf3,0x9c,0x3c,0xe7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x5d,0xef,0x14,0xa5,0xf7,0xbd,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,
+    0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x7d,0xef,0x55,0xad,0x14,0xa5,0xfb,0xde,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x3c,0xe7,0x75,0xad,0x75,0xad,0x7d,0xef,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,
+    0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0x7d,0xef,0xf7,0xbd,0xf3,0x9c,0x18,0xc6,0xfb,0xde,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0x7d,0xef,0xf7,0xbd,0xd3,0x9c,0xb6,0xb5,0x5d,0xef,0xdf,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x9e,0xf7,0xdf,0xff,0xbe,0xf7,
+    0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xfb,0xde,0xf7,0xbd,0x14,0xa5,0x34,0xa5,0x75,0xad,0x18,0xc6,0x9a,0xd6,0x79,0xce,0xdb,0xde,0x59,0xce,0x38,0xc6,0x96,0xb5,0xf3,0x9c,0x34,0xa5,0x96,0xb5,0x1c,0xe7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,
+    0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0x7d,0xef,0x1c,0xe7,0xba,0xd6,0xdb,0xde,0x79,0xce,0xdb,0xde,0xfb,0xde,0x5d,0xef,0xff,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x9e,0xf7,0xbe,0xf7,0xbe,0xf7,0x9e,0xf7,0xff,0xff,0x7d,0xef,0xdf,0xff,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0xff,0xff,0x9e,0xf7,
 
 };
 
 const lv_image_dsc_t img_circle = {
   .header = {
     .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_ARGB8888,
+    .cf = LV_COLOR_FORMAT_RGB565,
     .flags = 0,
     .w = 50,
     .h = 50,
-    .stride = 200,
+    .stride = 100,
     .reserved_2 = 0,
   },
   .data_size = sizeof(img_circle_map),
@@ -24,50 +24,52 @@
 #define LV_ATTRIBUTE_IMG_DOT
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 3480 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOT
 uint8_t img_dot_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xee,0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xd2,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xfc,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xfc,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xd2,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xee,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xee,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfe,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfe,0x00,0x00,0x00,0x00,
-    0x04,0xaa,0xfb,0xee,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xee,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xd2,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xfc,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xfc,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xd2,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xd2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xee,0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0xaa,0xfb,0xee,0x04,0xaa,0xfb,0xfe,0x04,0xaa,0xfb,0xff,0x04,0xaa,0xfb,0xd2,0x04,0xaa,0xfb,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x23,0x33,0x33,0x33,0x21,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x02,0x33,0x33,0x33,0x33,0x33,0x33,0x32,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x04,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x00,0x00,0x00,
+    0x00,0x00,0x53,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x50,0x00,0x00,
+    0x00,0x05,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x35,0x00,0x00,
+    0x00,0x43,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x40,0x00,
+    0x00,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x30,0x00,
+    0x02,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x32,0x00,
+    0x03,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x00,
+    0x13,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x10,
+    0x23,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x20,
+    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x30,
+    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x30,
+    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x30,
+    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x30,
+    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x30,
+    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x30,
+    0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x30,
+    0x23,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x20,
+    0x13,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x10,
+    0x03,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x00,
+    0x02,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x32,0x00,
+    0x00,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x30,0x00,
+    0x00,0x43,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x40,0x00,
+    0x00,0x05,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x35,0x00,0x00,
+    0x00,0x00,0x53,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x50,0x00,0x00,
+    0x00,0x00,0x04,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x02,0x33,0x33,0x33,0x33,0x33,0x33,0x32,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x23,0x33,0x33,0x33,0x21,0x00,0x00,0x00,0x00,0x00,
 
 };
 
 const lv_image_dsc_t img_dot = {
   .header = {
     .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_ARGB8888,
+    .cf = LV_COLOR_FORMAT_I4,
     .flags = 0,
     .w = 29,
     .h = 29,
-    .stride = 120,
+    .stride = 15,
     .reserved_2 = 0,
   },
   .data_size = sizeof(img_dot_map),
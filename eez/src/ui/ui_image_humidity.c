@@ -24,75 +24,130 @@
 #define LV_ATTRIBUTE_IMG_HUMIDITY
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 11880 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HUMIDITY
 uint8_t img_humidity_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x85,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x83,0x83,0x60,0x85,0x85,0x84,0xe7,0x85,0x85,0x85,0xff,0x86,0x85,0x85,0xde,0x83,0x83,0x83,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x03,0x84,0x84,0x84,0x9d,0x85,0x85,0x85,0xff,0x92,0x8f,0x86,0xfd,0xb9,0xab,0x8b,0xff,0x8e,0x8c,0x87,0xfd,0x84,0x84,0x84,0xfe,0x85,0x85,0x85,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x03,0x84,0x84,0x84,0xab,0x85,0x85,0x85,0xff,0xaa,0xa0,0x89,0xff,0xf8,0xda,0x93,0xff,0xff,0xdf,0x94,0xff,0xf3,0xd6,0x93,0xff,0x9c,0x96,0x87,0xfe,0x85,0x85,0x85,0xff,0x84,0x84,0x84,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0x99,0x85,0x85,0x85,0xff,0xb1,0xa6,0x8b,0xff,0xfd,0xdd,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xf7,0xd9,0x93,0xff,0x9b,0x95,0x87,0xfe,0x84,0x84,0x84,0xfe,0x84,0x84,0x84,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0x73,0x85,0x85,0x85,0xff,0xa8,0x9f,0x89,0xff,0xfd,0xde,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xf3,0xd6,0x93,0xff,0x91,0x8e,0x86,0xfd,0x85,0x85,0x85,0xf7,0x82,0x82,0x82,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x82,0x3c,0x85,0x85,0x84,0xfc,0x99,0x94,0x88,0xfd,0xf9,0xdb,0x93,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xe7,0xcd,0x91,0xff,0x87,0x86,0x85,0xfe,0x86,0x85,0x85,0xd6,0x80,0x80,0x80,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7a,0x7a,0x7a,0x16,0x86,0x86,0x84,0xe6,0x8a,0x89,0x86,0xfd,0xeb,0xd0,0x91,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xc7,0xb6,0x8d,0xff,0x85,0x85,0x85,0xff,0x85,0x85,0x85,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x02,0x84,0x84,0x84,0xba,0x85,0x85,0x85,0xff,0xd3,0xbf,0x8f,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xa8,0x9e,0x89,0xff,0x85,0x85,0x85,0xff,0x83,0x83,0x83,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0x80,0x85,0x85,0x85,0xff,0xba,0xac,0x8c,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xf3,0xd6,0x92,0xff,0x8e,0x8c,0x86,0xfd,0x86,0x86,0x85,0xed,0x80,0x80,0x80,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x82,0x30,0x85,0x85,0x85,0xfb,0x9c,0x96,0x87,0xfe,0xfc,0xdd,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xda,0xc4,0x90,0xff,0x85,0x85,0x85,0xff,0x84,0x84,0x84,0xa9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x66,0x66,0x04,0x84,0x84,0x83,0xcd,0x86,0x86,0x85,0xfe,0xe8,0xce,0x92,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xae,0xa3,0x8a,0xff,0x85,0x85,0x85,0xff,0x84,0x84,0x84,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x85,0x7c,0x85,0x85,0x85,0xff,0xc2,0xb2,0x8c,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xf4,0xd7,0x93,0xff,0x8b,0x8a,0x86,0xfd,0x85,0x85,0x85,0xe1,0x80,0x80,0x80,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x83,0x83,0x28,0x85,0x85,0x85,0xf8,0x9a,0x94,0x87,0xfe,0xfc,0xdd,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xca,0xb8,0x8d,0xff,0x85,0x85,0x85,0xff,0x83,0x83,0x83,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x02,0x85,0x85,0x83,0xc9,0x86,0x86,0x85,0xfe,0xe7,0xcd,0x91,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xfe,0xde,0x94,0xff,0x9c,0x96,0x87,0xfe,0x85,0x85,0x85,0xfa,0x82,0x82,0x82,0x2a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x85,0x61,0x85,0x85,0x85,0xff,0xbd,0xae,0x8c,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xe6,0xcd,0x91,0xff,0x85,0x85,0x84,0xfe,0x84,0x84,0x84,0xb9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x0d,0x86,0x84,0x84,0xe8,0x8f,0x8d,0x86,0xfd,0xf8,0xda,0x93,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xb3,0xa7,0x8a,0xff,0x85,0x85,0x85,0xff,0x83,0x83,0x83,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x83,0x83,0x89,0x85,0x85,0x85,0xff,0xd1,0xbd,0x8e,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xf2,0xd5,0x92,0xff,0x89,0x87,0x85,0xfe,0x84,0x84,0x84,0xd1,0x55,0x55,0x55,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x83,0x83,0x22,0x85,0x85,0x85,0xf9,0x9c,0x96,0x87,0xfe,0xfe,0xde,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xbe,0xaf,0x8c,0xff,0x85,0x85,0x85,0xff,0x84,0x84,0x84,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x85,0xb0,0x85,0x85,0x84,0xff,0xe2,0xca,0x91,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xf8,0xda,0x93,0xff,0x8e,0x8c,0x87,0xfd,0x86,0x85,0x85,0xe2,0x71,0x71,0x71,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x82,0x3a,0x85,0x85,0x85,0xff,0xb0,0xa5,0x8b,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xc9,0xb7,0x8d,0xff,0x85,0x85,0x85,0xff,0x83,0x83,0x83,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0xb7,0x86,0x86,0x85,0xfe,0xee,0xd3,0x92,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xfc,0xdd,0x94,0xff,0x92,0x8f,0x86,0xfd,0x86,0x84,0x84,0xe8,0x71,0x71,0x71,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0x33,0x84,0x84,0x84,0xfe,0xb2,0xa6,0x8b,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xca,0xb8,0x8d,0xff,0x85,0x85,0x85,0xff,0x84,0x84,0x84,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0xb4,0x85,0x85,0x84,0xfe,0xec,0xd1,0x91,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xfa,0xdb,0x93,0xff,0x8f,0x8d,0x87,0xfd,0x85,0x84,0x84,0xdf,0x66,0x66,0x66,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x85,0x31,0x84,0x84,0x84,0xfe,0xb0,0xa5,0x8a,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xc4,0xb3,0x8d,0xff,0x85,0x85,0x85,0xff,0x84,0x84,0x84,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0xad,0x86,0x85,0x85,0xff,0xeb,0xd0,0x92,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xf7,0xd9,0x93,0xff,0x8b,0x8a,0x86,0xfd,0x86,0x86,0x86,0xd3,0x80,0x80,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x1d,0x85,0x85,0x84,0xfd,0xaa,0xa0,0x89,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xbd,0xae,0x8b,0xff,0x85,0x85,0x85,0xff,0x81,0x81,0x81,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x83,0x83,0x85,0x85,0x85,0x85,0xff,0xde,0xc7,0x90,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xed,0xd2,0x92,0xff,0x85,0x85,0x84,0xff,0x83,0x83,0x83,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x02,0x85,0x84,0x84,0xe5,0x95,0x90,0x86,0xfe,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xa2,0x9a,0x89,0xff,0x85,0x85,0x85,0xf5,0x80,0x80,0x80,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0x3f,0x85,0x85,0x85,0xff,0xc2,0xb2,0x8d,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xd0,0xbc,0x8f,0xff,0x85,0x85,0x85,0xff,0x83,0x83,0x83,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0x90,0x85,0x85,0x85,0xff,0xea,0xcf,0x91,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xf9,0xdb,0x93,0xff,0x89,0x87,0x85,0xfe,0x84,0x84,0x84,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x84,0xd2,0x91,0x8e,0x86,0xfd,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xac,0xa2,0x8a,0xff,0x85,0x85,0x84,0xfc,0x80,0x80,0x80,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0x76,0x76,0x0c,0x85,0x85,0x85,0xfd,0xb0,0xa5,0x8a,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xcc,0xb9,0x8e,0xff,0x85,0x85,0x85,0xff,0x85,0x85,0x85,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x83,0x83,0x28,0x85,0x85,0x85,0xff,0xc2,0xb2,0x8d,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xe0,0xc8,0x90,0xff,0x85,0x85,0x85,0xff,0x83,0x83,0x83,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0x33,0x85,0x85,0x85,0xff,0xc7,0xb6,0x8d,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xe5,0xcc,0x91,0xff,0x85,0x85,0x85,0xff,0x83,0x83,0x83,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x25,0x85,0x85,0x85,0xff,0xc0,0xb1,0x8c,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xd8,0xc2,0x8f,0xff,0x85,0x85,0x85,0xff,0x82,0x82,0x82,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x07,0x85,0x84,0x84,0xfd,0xae,0xa3,0x8a,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xc8,0xb6,0x8d,0xff,0x85,0x85,0x85,0xff,0x84,0x84,0x84,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x85,0xd4,0x92,0x8e,0x86,0xfe,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xa6,0x9d,0x89,0xff,0x85,0x85,0x85,0xf7,0x80,0x80,0x80,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x85,0x8f,0x85,0x85,0x85,0xff,0xe9,0xcf,0x92,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xf7,0xd9,0x93,0xff,0x86,0x86,0x84,0xfe,0x84,0x84,0x84,0xb1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0x35,0x85,0x85,0x85,0xff,0xb9,0xab,0x8b,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xc9,0xb7,0x8d,0xff,0x85,0x85,0x85,0xff,0x85,0x85,0x85,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x83,0xcb,0x88,0x87,0x84,0xfe,0xf3,0xd6,0x92,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xf8,0xda,0x93,0xff,0x8d,0x8b,0x86,0xfd,0x86,0x85,0x85,0xe0,0x80,0x80,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x85,0x48,0x85,0x85,0x85,0xff,0xaf,0xa4,0x8a,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xbd,0xae,0x8b,0xff,0x85,0x85,0x85,0xff,0x82,0x82,0x82,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x85,0xaa,0x85,0x85,0x85,0xff,0xd1,0xbd,0x8e,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xe0,0xc8,0x90,0xff,0x85,0x85,0x84,0xfe,0x85,0x85,0x84,0xca,0x55,0x55,0x55,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x13,0x86,0x85,0x85,0xe0,0x88,0x87,0x85,0xfe,0xdf,0xc7,0x90,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xeb,0xd0,0x91,0xff,0x8d,0x8b,0x86,0xfd,0x85,0x84,0x84,0xf2,0x80,0x80,0x80,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x2d,0x85,0x85,0x84,0xee,0x89,0x88,0x86,0xfd,0xda,0xc4,0x8f,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xe8,0xce,0x92,0xff,0x8f,0x8c,0x86,0xfd,0x85,0x85,0x85,0xfa,0x81,0x81,0x81,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x85,0x85,0x31,0x86,0x86,0x85,0xeb,0x86,0x85,0x85,0xff,0xc1,0xb1,0x8d,0xff,0xfc,0xdd,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xd2,0xbe,0x8e,0xff,0x8a,0x89,0x86,0xfd,0x85,0x85,0x85,0xf7,0x83,0x83,0x83,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0x1e,0x85,0x85,0x85,0xcc,0x85,0x85,0x85,0xff,0x9a,0x94,0x88,0xfe,0xdc,0xc5,0x90,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xee,0xd3,0x92,0xff,0xa9,0x9f,0x89,0xff,0x85,0x85,0x85,0xff,0x85,0x84,0x84,0xe3,0x82,0x82,0x82,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x05,0x85,0x85,0x85,0x7c,0x85,0x85,0x85,0xf6,0x85,0x85,0x85,0xff,0x9d,0x97,0x87,0xfe,0xd1,0xbd,0x8e,0xff,0xf9,0xdb,0x93,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xe4,0xcb,0x90,0xff,0xb1,0xa6,0x8b,0xff,0x86,0x86,0x85,0xfe,0x84,0x84,0x84,0xfe,0x84,0x84,0x84,0xa1,0x80,0x80,0x80,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x84,0x84,0x1a,0x85,0x85,0x85,0x93,0x85,0x85,0x85,0xf4,0x85,0x85,0x85,0xff,0x87,0x86,0x84,0xfe,0xa7,0x9e,0x89,0xff,0xc5,0xb4,0x8d,0xff,0xde,0xc7,0x90,0xff,0xf2,0xd6,0x93,0xff,0xfe,0xde,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xff,0xdf,0x94,0xff,0xfc,0xdd,0x94,0xff,0xeb,0xd0,0x91,0xff,0xd4,0xbf,0x8e,0xff,0xb8,0xab,0x8c,0xff,0x93,0x8f,0x86,0xfe,0x85,0x85,0x85,0xff,0x84,0x84,0x84,0xfe,0x84,0x84,0x84,0xb7,0x84,0x84,0x84,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x77,0x77,0x0e,0x83,0x83,0x83,0x66,0x84,0x84,0x84,0xb6,0x85,0x85,0x85,0xf8,0x85,0x85,0x85,0xff,0x85,0x85,0x85,0xff,0x85,0x85,0x85,0xff,0x86,0x86,0x84,0xfe,0x8f,0x8d,0x86,0xfd,0x94,0x90,0x86,0xfe,0x99,0x94,0x88,0xff,0x94,0x90,0x87,0xfd,0x8d,0x8b,0x86,0xfd,0x85,0x85,0x84,0xff,0x85,0x85,0x85,0xff,0x85,0x85,0x85,0xff,0x85,0x85,0x85,0xff,0x85,0x85,0x85,0xde,0x84,0x84,0x84,0x88,0x82,0x82,0x82,0x2c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x71,0x71,0x08,0x82,0x82,0x82,0x38,0x83,0x83,0x83,0x6a,0x85,0x85,0x85,0x8f,0x84,0x84,0x84,0xad,0x84,0x84,0x84,0xbe,0x84,0x84,0x84,0xcc,0x84,0x84,0x84,0xcc,0x84,0x84,0x84,0xca,0x85,0x85,0x85,0xbb,0x84,0x84,0x84,0xa5,0x83,0x83,0x83,0x83,0x84,0x84,0x84,0x5a,0x84,0x84,0x84,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x30,0x84,0x72,0x84,0x57,0x8d,0x71,0x84,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x30,0x84,0x15,0x8d,0xdf,0x96,0xff,0x96,0xbe,0x96,0xb3,0x84,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x36,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xde,0x96,0xb3,0x84,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0xf5,0x8c,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xbe,0x96,0x72,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0xb3,0x8c,0xdf,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x7c,0x96,0x30,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0x7b,0x30,0x84,0x51,0x84,0x9d,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xb8,0x8d,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x52,0x30,0x84,0x30,0x84,0xfa,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xf5,0x8c,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x77,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xbe,0x96,0x71,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0xb3,0x84,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x3b,0x96,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x63,0x30,0x84,0x30,0x84,0x7d,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x15,0x8d,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x98,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xbe,0x96,0x51,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0xb3,0x84,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xd9,0x8d,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x52,0x30,0x84,0x30,0x84,0x7c,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xb3,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x77,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x7c,0x96,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x71,0x84,0xdf,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x36,0x8d,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0xfa,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xbe,0x96,0x31,0x84,0x30,0x84,0xaa,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0xb3,0x84,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x77,0x8d,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x5c,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xdf,0x96,0x71,0x84,0x30,0x84,0x8e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x36,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xb9,0x8d,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x9d,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x72,0x84,0x30,0x84,0x8e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x36,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xd9,0x8d,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x9d,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xdf,0x96,0x71,0x84,0x30,0x84,0x2c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x36,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x98,0x8d,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x9d,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xde,0x96,0x51,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x15,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x77,0x8d,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x3b,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x9d,0x96,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x52,0x30,0x84,0x92,0x84,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xd4,0x8c,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x98,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xfa,0x8d,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x7d,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xdf,0x96,0x31,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x72,0x84,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x15,0x8d,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0x73,0x30,0x84,0x36,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xd9,0x8d,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x98,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x5c,0x96,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0xb8,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x7c,0x96,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x98,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x1b,0x8e,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x15,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xb9,0x8d,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x72,0x84,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xf4,0x8c,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x7d,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xde,0x96,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x57,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xb9,0x8d,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x31,0x84,0xbe,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xdf,0x96,0x51,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x35,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x77,0x8d,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0xfa,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x5c,0x96,0x30,0x84,0x30,0x84,0xaa,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x31,0x84,0x3b,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x9d,0x96,0x51,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x51,0x84,0x3b,0x8e,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x7d,0x96,0x71,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x30,0x84,0x98,0x8d,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xfa,0x8d,0x51,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x30,0x84,0xb3,0x8c,0x3b,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x9d,0x96,0xf5,0x8c,0x30,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0xb3,0x84,0xfa,0x8d,0xdf,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x5c,0x96,0x36,0x8d,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0xf4,0x8c,0xb8,0x8d,0x3b,0x96,0xbe,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0xff,0x96,0x9d,0x96,0xfa,0x8d,0x57,0x8d,0x72,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0x73,0x10,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x71,0x84,0x92,0x84,0xb3,0x8c,0x92,0x84,0x51,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8e,0x73,0x10,0x84,0x10,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x30,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xe7,0xff,0xde,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x9d,0xff,0xfd,0xff,0xfd,0xfe,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xab,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xfe,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xf7,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xfc,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xd6,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0xe6,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xed,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xfb,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xcd,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xe1,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xf8,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xc9,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xfa,0x2a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xb9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xe8,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xd1,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0xf9,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xe2,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb7,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xe8,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb4,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xdf,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xd3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xe5,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf5,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd2,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x46,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x68,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x72,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x57,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd4,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xb1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xca,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xe0,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xf2,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xee,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xfa,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xeb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xf7,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xcc,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe3,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x7c,0xf6,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xfe,0xa1,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0x93,0xf4,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xb7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x66,0xb6,0xf8,0xff,0xff,0xff,0xfe,0xfd,0xfe,0xff,0xfd,0xfd,0xff,0xff,0xff,0xff,0xde,0x88,0x2c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x38,0x6a,0x8f,0xad,0xbe,0xcc,0xcc,0xca,0xbb,0xa5,0x83,0x5a,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 };
 
 const lv_image_dsc_t img_humidity = {
   .header = {
     .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_ARGB8888,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
     .flags = 0,
     .w = 54,
     .h = 54,
-    .stride = 220,
+    .stride = 108,
     .reserved_2 = 0,
   },
   .data_size = sizeof(img_humidity_map),
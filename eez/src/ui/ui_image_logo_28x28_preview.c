@@ -23,48 +23,77 @@
 #define LV_ATTRIBUTE_IMG_LOGO_28X28_PREVIEW
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 3136 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_LOGO_28X28_PREVIEW
 uint8_t img_logo_28x28_preview_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x7f,0x7f,0x00,0x02,0x55,0x55,0x55,0x03,0x55,0x55,0x55,0x03,0x55,0x55,0x55,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x7f,0x7f,0x7f,0x02,0x55,0x55,0x55,0x03,0x55,0x55,0x55,0x03,0x55,0x55,0x55,0x03,0x7f,0x7f,0x7f,0x02,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x7f,0x00,0x02,0x33,0x66,0x33,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x66,0x66,0x05,0x55,0x55,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x33,0x66,0x33,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x74,0x3a,0x23,0x38,0x6d,0x31,0x6d,0x38,0x6b,0x2f,0x9d,0x3e,0x6c,0x35,0xb9,0x43,0x76,0x38,0x90,0x00,0x4c,0x00,0x14,0x2b,0x2b,0x31,0x29,0x67,0x64,0x64,0x63,0x74,0x74,0x72,0x7d,0x71,0x71,0x6f,0x82,0x6c,0x6c,0x6a,0x7a,0x60,0x5d,0x5d,0x57,0x41,0x41,0x41,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x66,0x66,0x05,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x3d,0x66,0x33,0x19,0x36,0x6b,0x31,0x82,0x3b,0x6f,0x34,0xb0,0x40,0x70,0x37,0xb3,0x41,0x72,0x39,0xb7,0x3b,0x6d,0x33,0xb8,0x3b,0x5d,0x35,0xb1,0x72,0x78,0x6f,0x9c,0x8b,0x8a,0x8a,0xc7,0x81,0x81,0x81,0xff,0x7f,0x7f,0x7e,0xff,0x7a,0x79,0x78,0xff,0x78,0x77,0x76,0xff,0x72,0x71,0x71,0xf5,0x73,0x72,0x73,0xbe,0x65,0x67,0x67,0x79,0x4b,0x4b,0x44,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x6e,0x31,0x2e,0x3b,0x6d,0x30,0xa8,0x37,0x6a,0x31,0xd7,0x3a,0x6b,0x33,0xcc,0x43,0x75,0x3a,0xa9,0x46,0x74,0x3f,0x70,0x5d,0x5f,0x5a,0x5d,0x7b,0x76,0x7c,0xb0,0x87,0x85,0x86,0xff,0x8a,0x8a,0x8a,0xe9,0x87,0x87,0x87,0xb9,0x78,0x78,0x7a,0x9a,0x73,0x72,0x70,0x8f,0x72,0x70,0x70,0xa3,0x73,0x71,0x71,0xc5,0x6e,0x6d,0x6d,0xf4,0x6f,0x6f,0x6d,0xff,0x68,0x68,0x66,0xb0,0x5c,0x5c,0x5c,0x37,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x3f,0x7f,0x3f,0x04,0x00,0x00,0x00,0x00,0x3e,0x6f,0x31,0x29,0x3a,0x6c,0x2f,0xc3,0x3b,0x6e,0x31,0xe3,0x40,0x6f,0x3a,0x7e,0x3b,0x6e,0x36,0x96,0x37,0x6c,0x2d,0xb3,0x49,0x63,0x43,0xa9,0x75,0x72,0x75,0xdd,0x8e,0x8f,0x8d,0xff,0x79,0x7b,0x78,0xae,0x33,0x33,0x36,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x43,0x45,0x43,0x5f,0x63,0x63,0x60,0xbc,0x6f,0x6e,0x6f,0xff,0x66,0x66,0x66,0xcc,0x5a,0x5a,0x5a,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x03,0x00,0x00,0x00,0x00,0x36,0x64,0x2d,0x1c,0x38,0x6a,0x30,0xa3,0x39,0x6b,0x30,0xe7,0x3f,0x6e,0x3a,0x5c,0x46,0x75,0x3d,0xce,0x3e,0x73,0x34,0xf5,0x3a,0x5a,0x32,0xa1,0x73,0x6c,0x73,0xbe,0x83,0x83,0x82,0xfc,0x58,0x58,0x58,0x7f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x62,0x62,0x62,0x1a,0x6f,0x6f,0x6f,0x7b,0x72,0x70,0x70,0x9c,0x61,0x61,0x61,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x0d,0x5a,0x58,0x58,0x99,0x67,0x66,0x66,0xfd,0x60,0x60,0x60,0xc1,0x58,0x58,0x58,0x17,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x55,0x00,0x03,0x00,0x00,0x00,0x00,0x38,0x6b,0x32,0x70,0x38,0x69,0x30,0xeb,0x3b,0x6b,0x34,0x6b,0x40,0x6a,0x3b,0xb3,0x48,0x76,0x3f,0xff,0x37,0x67,0x2c,0xa0,0x6c,0x73,0x69,0xb0,0x7a,0x77,0x79,0xfe,0x5f,0x5f,0x5d,0x90,0x00,0x00,0x00,0x00,0x3c,0x3c,0x3c,0x11,0x00,0x00,0x00,0x00,0x63,0x66,0x66,0x48,0x7d,0x7d,0x7d,0xd2,0x88,0x86,0x84,0xf9,0x6e,0x6e,0x6d,0xa6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x48,0x07,0x43,0x43,0x43,0x13,0x56,0x56,0x56,0xa2,0x62,0x62,0x62,0xfe,0x62,0x62,0x62,0x8c,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x03,0x00,0x00,0x00,0x01,0x39,0x6d,0x34,0x31,0x3b,0x6f,0x32,0xb0,0x3c,0x6d,0x33,0xcf,0x3e,0x6a,0x38,0x7a,0x3e,0x69,0x3a,0xb7,0x48,0x74,0x42,0xd7,0x46,0x5b,0x44,0x9f,0x6a,0x67,0x6a,0xe3,0x73,0x73,0x71,0xc3,0x1c,0x1c,0x12,0x1b,0x64,0x64,0x64,0x75,0x7e,0x7e,0x7e,0xd4,0x84,0x84,0x84,0xa6,0x94,0x96,0x94,0xd6,0x9d,0x9c,0x9b,0xff,0x90,0x8e,0x8e,0xff,0x7a,0x79,0x79,0xff,0x70,0x6f,0x6f,0xbe,0x6b,0x6a,0x6b,0xbb,0x6b,0x6b,0x6b,0xc1,0x76,0x76,0x76,0x2b,0x47,0x47,0x47,0x32,0x58,0x58,0x58,0xe4,0x59,0x59,0x59,0xd5,0x73,0x73,0x73,0x2a,
-    0x00,0x00,0x00,0x00,0x2a,0x7f,0x2a,0x06,0x00,0x00,0x00,0x00,0x38,0x6c,0x2f,0x71,0x39,0x6c,0x31,0xd2,0x40,0x71,0x37,0x77,0x3e,0x6d,0x38,0x9e,0x46,0x73,0x3f,0xb8,0x3e,0x73,0x37,0x98,0x57,0x60,0x56,0xcf,0x61,0x5c,0x60,0xf6,0x56,0x56,0x54,0x61,0x50,0x50,0x50,0x13,0x6b,0x6c,0x6b,0xeb,0x98,0x99,0x98,0xff,0x98,0x98,0x98,0xff,0x80,0x80,0x7f,0xc6,0x77,0x77,0x77,0x80,0x6f,0x6f,0x6f,0x72,0x64,0x62,0x62,0x99,0x63,0x62,0x62,0xef,0x73,0x74,0x73,0xff,0x73,0x73,0x72,0xff,0x65,0x65,0x65,0x6a,0x3f,0x3f,0x3f,0x04,0x52,0x52,0x52,0x8b,0x56,0x55,0x56,0xfb,0x67,0x67,0x67,0x7b,
-    0x00,0x00,0x00,0x01,0x00,0x7f,0x00,0x04,0x00,0x00,0x00,0x00,0x36,0x6b,0x2e,0x9f,0x36,0x69,0x2e,0xe0,0x3f,0x6c,0x3c,0x50,0x3c,0x6e,0x35,0xa1,0x43,0x77,0x3b,0xb8,0x31,0x62,0x2b,0x82,0x61,0x65,0x5e,0xe7,0x5c,0x5a,0x5b,0xd6,0x23,0x23,0x23,0x1d,0x7f,0x7f,0x7f,0x0e,0x67,0x67,0x67,0xc5,0x88,0x89,0x88,0xfe,0x88,0x8b,0x88,0xa1,0x4b,0x46,0x4b,0x33,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x54,0x56,0x54,0x61,0x5f,0x5f,0x5f,0xdd,0x62,0x61,0x61,0xfe,0x5b,0x5e,0x5b,0x56,0x00,0x00,0x00,0x00,0x52,0x52,0x52,0x4a,0x56,0x55,0x55,0xea,0x5c,0x5c,0x5a,0xca,
-    0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x3c,0x78,0x3c,0x11,0x38,0x6c,0x31,0xb8,0x38,0x6b,0x31,0xdc,0x41,0x6d,0x3b,0x62,0x41,0x72,0x39,0x9c,0x3d,0x72,0x34,0xae,0x34,0x52,0x32,0x7e,0x5f,0x5f,0x5f,0xeb,0x5f,0x5d,0x5f,0xa9,0x00,0x00,0x00,0x00,0x56,0x56,0x56,0x38,0x6b,0x6b,0x6d,0xb4,0x6f,0x6e,0x6e,0xd2,0x3c,0x5b,0x39,0x59,0x20,0x6a,0x18,0x1f,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x00,0x55,0x9d,0x48,0x15,0x40,0x78,0x37,0x37,0x4d,0x4b,0x4b,0x7d,0x53,0x52,0x53,0xf3,0x58,0x58,0x58,0x7c,0x7f,0x7f,0x7f,0x0e,0x53,0x53,0x53,0x31,0x55,0x55,0x53,0xc0,0x55,0x54,0x54,0xf5,
-    0x00,0xff,0x00,0x01,0x00,0x00,0x00,0x00,0x33,0x6b,0x33,0x32,0x3a,0x6e,0x34,0xb8,0x3c,0x6e,0x35,0xcc,0x3f,0x6e,0x39,0x78,0x44,0x72,0x3e,0x9c,0x40,0x72,0x36,0xaa,0x3d,0x4c,0x3d,0x7c,0x56,0x52,0x56,0xf3,0x5e,0x5c,0x5c,0x8d,0x3f,0x3f,0x3f,0x18,0x63,0x63,0x63,0xbb,0x79,0x78,0x79,0xf6,0x5a,0x56,0x58,0x76,0x43,0x6f,0x3f,0x7c,0x48,0x77,0x3f,0x71,0x49,0x70,0x40,0x3b,0x46,0x71,0x41,0x2f,0x45,0x73,0x3d,0x63,0x42,0x74,0x3c,0x83,0x5b,0x73,0x5b,0x2a,0x53,0x50,0x53,0xda,0x56,0x55,0x56,0xef,0x5d,0x5b,0x5d,0x5f,0x5f,0x5f,0x5f,0x33,0x53,0x53,0x53,0xa7,0x52,0x51,0x51,0xff,
-    0x00,0xff,0x00,0x01,0x00,0x00,0x00,0x00,0x32,0x68,0x2d,0x38,0x39,0x6c,0x33,0xae,0x3a,0x6c,0x35,0xc3,0x3a,0x6c,0x33,0x8b,0x3e,0x6d,0x38,0x9e,0x3b,0x71,0x31,0xa6,0x3d,0x49,0x3d,0x88,0x4e,0x4a,0x4e,0xfa,0x51,0x51,0x4f,0x84,0x58,0x58,0x58,0x51,0x70,0x6f,0x70,0xff,0x6e,0x6d,0x6d,0xf3,0x46,0x43,0x46,0x57,0x37,0x66,0x2f,0x5c,0x49,0x7f,0x41,0x5e,0x42,0x72,0x3a,0xad,0x43,0x71,0x3c,0xba,0x4b,0x7a,0x46,0x62,0x44,0x77,0x3f,0x78,0x4d,0x8b,0x4d,0x21,0x50,0x4f,0x4f,0xce,0x55,0x54,0x54,0xff,0x4c,0x4d,0x4c,0xb5,0x69,0x69,0x6c,0x4b,0x56,0x56,0x56,0x94,0x4e,0x4e,0x4e,0xff,
-    0x00,0xff,0x00,0x01,0x00,0x00,0x00,0x00,0x33,0x67,0x2a,0x36,0x3b,0x6f,0x36,0xb3,0x3c,0x6f,0x37,0xc9,0x41,0x6d,0x3b,0x89,0x4f,0x77,0x4a,0xa0,0x3c,0x70,0x32,0xa1,0x3f,0x4b,0x3d,0x7d,0x4c,0x49,0x4c,0xf8,0x51,0x51,0x4f,0x86,0x44,0x48,0x48,0x43,0x57,0x57,0x57,0xff,0x5d,0x5d,0x5d,0xf7,0x4c,0x4a,0x4c,0x6a,0x40,0x6a,0x36,0x7a,0x40,0x74,0x34,0x53,0x45,0x76,0x3d,0x79,0x49,0x75,0x3f,0x84,0x49,0x76,0x42,0x49,0x43,0x74,0x3b,0x81,0x6b,0x86,0x6b,0x13,0x52,0x4e,0x50,0xcc,0x5c,0x5c,0x5a,0xff,0x55,0x55,0x53,0x9c,0x6a,0x6a,0x6e,0x3c,0x56,0x56,0x58,0x9f,0x4f,0x4f,0x4f,0xff,
-    0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x44,0x77,0x3b,0x1e,0x39,0x6d,0x34,0xba,0x39,0x6b,0x32,0xd4,0x3d,0x6e,0x3b,0x63,0x45,0x72,0x40,0x9a,0x49,0x75,0x41,0xb2,0x41,0x57,0x3d,0x80,0x47,0x45,0x46,0xec,0x49,0x47,0x47,0xa7,0x48,0x48,0x48,0x07,0x45,0x49,0x49,0x49,0x4d,0x4e,0x4e,0xd9,0x4f,0x4f,0x4f,0xc1,0x4f,0x66,0x49,0x2d,0x07,0x52,0x07,0x22,0x7c,0x96,0x7a,0xb9,0x86,0x9f,0x85,0xed,0x49,0x72,0x45,0x76,0x36,0x6d,0x2d,0x1c,0x8d,0x8d,0x8d,0x48,0x4f,0x4e,0x4f,0xee,0x4d,0x4f,0x4d,0x84,0x5f,0x5f,0x5f,0x18,0x5f,0x5f,0x5f,0x30,0x56,0x55,0x56,0xb9,0x50,0x4f,0x4f,0xfa,
-    0x00,0x00,0x00,0x00,0x7f,0x7f,0x7f,0x02,0x66,0x99,0x66,0x05,0x38,0x69,0x2f,0xac,0x38,0x68,0x30,0xe2,0x46,0x75,0x42,0x50,0x43,0x73,0x3e,0x9b,0x4c,0x77,0x48,0xbe,0x44,0x6a,0x42,0x7f,0x3e,0x40,0x3c,0xe3,0x3e,0x3c,0x3d,0xcc,0x3c,0x3c,0x3c,0x15,0x00,0x33,0x33,0x05,0x44,0x44,0x44,0xb0,0x4a,0x4b,0x4a,0xf5,0x5e,0x5a,0x5e,0x77,0x30,0x65,0x2b,0x3a,0x75,0x96,0x74,0x9e,0x72,0x90,0x70,0xde,0x3d,0x72,0x35,0x78,0xff,0xff,0xff,0x1d,0x6f,0x6e,0x6e,0xbe,0x56,0x56,0x56,0xfa,0x4b,0x4b,0x4b,0x4e,0x00,0x00,0x00,0x00,0x52,0x52,0x52,0x41,0x55,0x54,0x54,0xe2,0x53,0x52,0x52,0xd0,
-    0x00,0x00,0x00,0x00,0x33,0x66,0x33,0x05,0x00,0x00,0x00,0x00,0x38,0x69,0x2f,0x87,0x3a,0x6c,0x33,0xd6,0x44,0x77,0x3f,0x64,0x40,0x6f,0x3c,0xa9,0x45,0x71,0x42,0xb3,0x3e,0x71,0x36,0x82,0x39,0x40,0x36,0xd2,0x3d,0x3a,0x3d,0xf6,0x42,0x42,0x42,0x50,0x38,0x38,0x38,0x12,0x40,0x3f,0x40,0xe4,0x47,0x47,0x47,0xff,0x48,0x48,0x49,0xff,0x47,0x50,0x48,0xc8,0x5f,0x6b,0x5d,0xab,0x68,0x77,0x66,0xb5,0x62,0x71,0x5f,0xb6,0x61,0x60,0x61,0xce,0x51,0x50,0x50,0xff,0x54,0x53,0x54,0xff,0x55,0x53,0x53,0x74,0xff,0xff,0xff,0x04,0x4c,0x4c,0x4c,0x71,0x47,0x47,0x47,0xf7,0x62,0x60,0x60,0x8e,
-    0x00,0x00,0x00,0x00,0x3f,0x7f,0x3f,0x04,0x00,0x00,0x00,0x00,0x3c,0x6c,0x38,0x44,0x3b,0x6d,0x33,0xbc,0x3a,0x6e,0x31,0xab,0x3c,0x6a,0x36,0x7f,0x46,0x6d,0x42,0xca,0x46,0x77,0x3f,0xc0,0x3d,0x4d,0x3b,0xa7,0x3c,0x37,0x3d,0xee,0x3f,0x3f,0x3f,0xa4,0x4d,0x4d,0x4d,0x17,0x3e,0x3e,0x3f,0xb0,0x3e,0x3e,0x3e,0xdd,0x3a,0x3b,0x3b,0xc8,0x48,0x47,0x4a,0xef,0x4e,0x4c,0x4f,0xf3,0x5b,0x58,0x5c,0xdf,0x60,0x5d,0x60,0xf2,0x4c,0x4b,0x4c,0xd1,0x3b,0x3b,0x3c,0xc5,0x49,0x49,0x49,0xd1,0x44,0x44,0x44,0x47,0xe3,0xe3,0xe3,0x1c,0x60,0x62,0x62,0xc8,0x44,0x44,0x44,0xe4,0x7a,0x76,0x76,0x38,
-    0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x01,0x00,0x00,0x00,0x01,0x6d,0x91,0x6d,0x07,0x3b,0x6d,0x31,0x8a,0x37,0x6a,0x2d,0xeb,0x3b,0x69,0x36,0x63,0x4a,0x6f,0x46,0xcd,0x4e,0x7f,0x48,0xff,0x44,0x6f,0x3f,0x95,0x37,0x37,0x37,0xb3,0x39,0x39,0x39,0xf8,0x40,0x40,0x40,0x63,0x3f,0x3f,0x3f,0x0c,0x36,0x36,0x36,0x4f,0x44,0x44,0x44,0x1e,0x47,0x47,0x47,0x72,0x3a,0x3a,0x3b,0xf4,0x3e,0x3f,0x3f,0xff,0x42,0x42,0x42,0xbd,0x93,0x93,0x93,0x13,0x6f,0x75,0x6f,0x27,0x5a,0x5a,0x5a,0x30,0xff,0xff,0xff,0x04,0x69,0x69,0x6b,0x82,0x63,0x62,0x62,0xff,0x5b,0x59,0x59,0x9c,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2a,0x55,0x2a,0x06,0x00,0x00,0x00,0x01,0x3d,0x66,0x2d,0x32,0x38,0x69,0x2f,0xc1,0x38,0x6b,0x31,0xc5,0x43,0x71,0x3b,0x85,0x3d,0x6f,0x34,0xe8,0x3c,0x74,0x34,0xcb,0x39,0x51,0x38,0xa3,0x37,0x34,0x37,0xee,0x39,0x3a,0x39,0xe4,0x4e,0x4e,0x4e,0x3e,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x00,0x4d,0x4d,0x4d,0x21,0x45,0x45,0x45,0xa9,0x47,0x47,0x47,0xe5,0x4c,0x4c,0x4c,0x6a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcc,0xcc,0xcc,0x05,0x98,0x98,0x9a,0x70,0x5a,0x59,0x5a,0xfc,0x3d,0x3a,0x3a,0xd0,0x82,0x88,0x88,0x2d,0xff,0xff,0xff,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x55,0x55,0x55,0x03,0x00,0x00,0x00,0x01,0x3c,0x6d,0x34,0x3f,0x3c,0x6e,0x32,0xe5,0x3f,0x70,0x36,0xb5,0x40,0x72,0x38,0x7a,0x38,0x6a,0x30,0xe5,0x39,0x6b,0x32,0xbb,0x3a,0x45,0x38,0x8c,0x3c,0x3b,0x3c,0xff,0x42,0x43,0x42,0xe7,0x5b,0x5b,0x5b,0x6d,0xaa,0xaa,0xaa,0x06,0x00,0x00,0x00,0x00,0x2a,0x2a,0x2a,0x06,0x33,0x33,0x33,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd6,0xd6,0xd6,0x13,0x99,0x97,0x99,0x8f,0x57,0x56,0x57,0xfa,0x4c,0x4a,0x4a,0xe4,0x6e,0x6e,0x6b,0x5a,0x01,0x01,0x01,0x00,0x7f,0x7f,0x7f,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x7f,0x7f,0x7f,0x02,0x3f,0x70,0x34,0x44,0x3b,0x6c,0x32,0xca,0x3a,0x6a,0x32,0xdf,0x39,0x69,0x34,0xa5,0x41,0x73,0x3d,0x84,0x4c,0x7a,0x47,0x64,0x43,0x47,0x43,0x72,0x39,0x36,0x39,0xf2,0x38,0x37,0x38,0xf8,0x47,0x46,0x46,0xca,0x60,0x60,0x60,0x8a,0x77,0x77,0x77,0x4f,0x89,0x85,0x85,0x41,0x85,0x88,0x88,0x63,0x79,0x79,0x77,0x93,0x5e,0x5c,0x5d,0xd7,0x53,0x51,0x51,0xff,0x51,0x4f,0x4f,0xd9,0x5f,0x62,0x62,0x50,0xda,0xda,0xda,0x07,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x6d,0x30,0x3a,0x39,0x6c,0x33,0x8f,0x3d,0x6f,0x34,0xb7,0x3e,0x72,0x36,0xe6,0x43,0x74,0x3e,0xe5,0x4c,0x75,0x47,0xab,0x3b,0x56,0x37,0xb3,0x3a,0x3d,0x3a,0xbf,0x46,0x44,0x44,0xff,0x4b,0x4b,0x4a,0xff,0x43,0x43,0x43,0xf9,0x44,0x43,0x43,0xf3,0x4d,0x4c,0x4c,0xff,0x59,0x57,0x57,0xff,0x56,0x53,0x53,0xf0,0x48,0x45,0x45,0x90,0x58,0x53,0x4e,0x37,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x7f,0x7f,0x7f,0x02,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x36,0x7f,0x48,0x0e,0x3e,0x71,0x35,0x5a,0x3b,0x70,0x32,0x8d,0x40,0x70,0x3a,0xa6,0x47,0x73,0x40,0xa5,0x43,0x7c,0x3a,0x71,0x4a,0x66,0x46,0x48,0x41,0x41,0x41,0x5e,0x39,0x39,0x39,0x8e,0x39,0x39,0x39,0xa8,0x3a,0x39,0x39,0xad,0x3c,0x3a,0x3a,0xa1,0x3d,0x3b,0x3b,0x81,0x51,0x51,0x4e,0x4b,0xb9,0xb9,0xb9,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x2a,0x55,0x2a,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x04,0x37,0x6f,0x27,0x20,0x47,0x70,0x3b,0x2b,0x43,0x86,0x35,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x04,0xb2,0x99,0x99,0x0a,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x33,0x33,0x05,0x7f,0x7f,0x7f,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x02,0x33,0x66,0x33,0x05,0x33,0x66,0x33,0x05,0x00,0xff,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x33,0x33,0x05,0x33,0x33,0x33,0x05,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x55,0x55,0x55,0x06,0x66,0x66,0x66,0x05,0x7f,0x7f,0x7f,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0x03,0xaa,0x52,0xaa,0x52,0xaa,0x52,0x00,0x00,0x00,0x00,0xef,0x7b,0xaa,0x52,0xaa,0x52,0xaa,0x52,0xef,0x7b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0x03,0x26,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x63,0xaa,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x33,0x00,0x00,0x00,0x00,0xa7,0x3b,0x67,0x33,0x47,0x2b,0x67,0x33,0xa8,0x3b,0x60,0x02,0x45,0x31,0x2c,0x63,0xae,0x73,0x8e,0x6b,0x6d,0x6b,0xec,0x5a,0x08,0x42,0x00,0x00,0x00,0x00,0x2c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0x00,0x00,0x00,0x00,0x27,0x33,0x46,0x33,0x67,0x33,0x88,0x33,0x88,0x3b,0x67,0x33,0xe7,0x32,0xce,0x6b,0x51,0x8c,0x10,0x84,0xef,0x7b,0xcf,0x7b,0xaf,0x73,0x8e,0x73,0x8e,0x73,0x2c,0x63,0x49,0x42,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x03,0x00,0x00,0x00,0x00,0x67,0x33,0x67,0x33,0x46,0x33,0x47,0x33,0xa8,0x3b,0xa8,0x3b,0xeb,0x5a,0xaf,0x7b,0x30,0x84,0x51,0x8c,0x30,0x84,0xcf,0x7b,0x8e,0x73,0x8e,0x73,0x8e,0x73,0x6d,0x6b,0x6d,0x6b,0x4d,0x63,0xeb,0x5a,0x00,0x00,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x3b,0x00,0x00,0x67,0x33,0x67,0x2b,0x67,0x33,0x68,0x3b,0x67,0x33,0x66,0x2b,0x09,0x43,0x8e,0x73,0x71,0x8c,0xcf,0x7b,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x0c,0x63,0x6d,0x6b,0x2c,0x63,0xcb,0x5a,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xaa,0x52,0x00,0x00,0x26,0x2b,0x47,0x33,0x47,0x33,0x67,0x3b,0xa8,0x3b,0x87,0x33,0xc7,0x32,0x6e,0x73,0x10,0x84,0xcb,0x5a,0x00,0x00,0x00,0x00,0x0c,0x63,0x6d,0x6b,0x8e,0x73,0x0c,0x63,0x00,0x00,0x00,0x00,0x02,0x00,0xcb,0x5a,0x2c,0x63,0x0c,0x63,0xcb,0x5a,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xa0,0x02,0x00,0x00,0x47,0x33,0x47,0x33,0x47,0x33,0x48,0x3b,0xa9,0x3b,0x26,0x2b,0x8d,0x6b,0xaf,0x7b,0xeb,0x5a,0x00,0x00,0xe7,0x39,0x00,0x00,0x2c,0x63,0xef,0x7b,0x31,0x84,0x6d,0x6b,0x00,0x00,0x00,0x00,0x49,0x4a,0x08,0x42,0xaa,0x52,0x0c,0x63,0x0c,0x63,0x00,0x00,
+    0x00,0x00,0xaa,0x52,0x00,0x00,0x67,0x33,0x67,0x33,0x67,0x33,0x47,0x3b,0x47,0x3b,0xa9,0x43,0xc8,0x42,0x2d,0x6b,0x8e,0x73,0xe3,0x10,0x2c,0x63,0xef,0x7b,0x30,0x84,0xb2,0x94,0xf3,0x9c,0x72,0x8c,0xcf,0x7b,0x6e,0x6b,0x4d,0x6b,0x4d,0x6b,0xae,0x73,0x28,0x42,0xcb,0x5a,0xcb,0x5a,0x8e,0x73,
+    0x00,0x00,0xe5,0x2b,0x00,0x00,0x67,0x2b,0x67,0x33,0x88,0x33,0x67,0x3b,0x88,0x3b,0x87,0x33,0x0a,0x53,0xec,0x62,0xaa,0x52,0x8a,0x52,0x6d,0x6b,0xd3,0x9c,0xd3,0x9c,0x10,0x7c,0xae,0x73,0x6d,0x6b,0x0c,0x63,0x0c,0x63,0xae,0x73,0x8e,0x73,0x2c,0x63,0xe7,0x39,0x8a,0x52,0xaa,0x52,0x2c,0x63,
+    0x00,0x00,0xe0,0x03,0x00,0x00,0x46,0x2b,0x46,0x2b,0x67,0x3b,0x67,0x33,0xa8,0x3b,0x06,0x2b,0x2c,0x5b,0xcb,0x5a,0x04,0x21,0xef,0x7b,0x2c,0x63,0x51,0x8c,0x51,0x8c,0x29,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x52,0xeb,0x5a,0x0c,0x63,0xeb,0x5a,0x00,0x00,0x8a,0x52,0xaa,0x52,0xeb,0x5a,
+    0x00,0x00,0x00,0x00,0xc7,0x3b,0x67,0x33,0x47,0x33,0x68,0x3b,0x88,0x3b,0x87,0x33,0x86,0x32,0xeb,0x5a,0xeb,0x5a,0x00,0x00,0xaa,0x52,0x4d,0x6b,0x6d,0x6b,0xc7,0x3a,0x44,0x1b,0xff,0xff,0x00,0x00,0xea,0x4c,0xc8,0x33,0x49,0x4a,0x8a,0x52,0xcb,0x5a,0xef,0x7b,0x8a,0x52,0xaa,0x52,0xaa,0x52,
+    0xe0,0x07,0x00,0x00,0x46,0x33,0x67,0x33,0x67,0x33,0x67,0x3b,0x88,0x3b,0x88,0x33,0x67,0x3a,0x8a,0x52,0xeb,0x5a,0xe7,0x39,0x0c,0x63,0xcf,0x7b,0xab,0x5a,0x68,0x3b,0xa9,0x3b,0x89,0x43,0x88,0x43,0x88,0x3b,0xa8,0x3b,0x8b,0x5b,0x8a,0x52,0xaa,0x52,0xcb,0x5a,0xeb,0x5a,0x8a,0x52,0x8a,0x52,
+    0xe0,0x07,0x00,0x00,0x46,0x2b,0x67,0x33,0x67,0x33,0x67,0x33,0x67,0x3b,0x87,0x33,0x47,0x3a,0x49,0x4a,0x8a,0x4a,0xcb,0x5a,0x6e,0x73,0x6d,0x6b,0x08,0x42,0x26,0x2b,0xe9,0x43,0x88,0x3b,0x88,0x3b,0xc9,0x43,0xa8,0x3b,0x49,0x4c,0x6a,0x4a,0xaa,0x52,0x69,0x4a,0x4d,0x6b,0xaa,0x52,0x69,0x4a,
+    0xe0,0x07,0x00,0x00,0x26,0x2b,0x67,0x33,0x67,0x33,0x68,0x3b,0xa9,0x4b,0x87,0x33,0x47,0x3a,0x49,0x4a,0x8a,0x4a,0x48,0x4a,0xaa,0x52,0xeb,0x5a,0x49,0x4a,0x48,0x33,0xa8,0x33,0xa8,0x3b,0xa9,0x3b,0xa9,0x43,0xa8,0x3b,0x2d,0x6c,0x6a,0x52,0xeb,0x5a,0xaa,0x52,0x4d,0x6b,0xaa,0x5a,0x69,0x4a,
+    0x00,0x00,0x00,0x00,0xa8,0x3b,0x67,0x33,0x47,0x33,0x67,0x3b,0x88,0x43,0xa9,0x43,0xa8,0x3a,0x28,0x42,0x29,0x42,0x49,0x4a,0x48,0x4a,0x69,0x4a,0x69,0x4a,0x29,0x4b,0x80,0x02,0xaf,0x7c,0xf0,0x84,0x89,0x43,0x66,0x2b,0x71,0x8c,0x69,0x4a,0x69,0x4a,0xeb,0x5a,0xeb,0x5a,0xaa,0x52,0x6a,0x4a,
+    0x00,0x00,0xef,0x7b,0xcc,0x64,0x47,0x2b,0x47,0x33,0xa8,0x43,0x88,0x3b,0xa9,0x4b,0x48,0x43,0x07,0x3a,0xe7,0x39,0xe7,0x39,0x80,0x31,0x28,0x42,0x49,0x4a,0xcb,0x5a,0x26,0x2b,0xae,0x74,0x8e,0x74,0x87,0x33,0xff,0xff,0x6d,0x6b,0xaa,0x52,0x49,0x4a,0x00,0x00,0x8a,0x52,0xaa,0x52,0x8a,0x52,
+    0x00,0x00,0x26,0x33,0x00,0x00,0x47,0x2b,0x67,0x33,0xa8,0x3b,0x68,0x3b,0x88,0x43,0x87,0x33,0x07,0x32,0xc7,0x39,0x08,0x42,0xc7,0x39,0xe8,0x41,0x28,0x42,0x49,0x4a,0x88,0x4a,0x4b,0x5b,0xad,0x63,0x8c,0x5b,0x0c,0x63,0x8a,0x52,0x8a,0x52,0x8a,0x52,0xff,0xff,0x69,0x4a,0x28,0x42,0x0c,0x63,
+    0x00,0x00,0xe7,0x3b,0x00,0x00,0x67,0x3b,0x67,0x33,0x67,0x33,0x47,0x33,0x68,0x43,0xa8,0x3b,0x67,0x3a,0xa7,0x39,0xe7,0x39,0x69,0x4a,0xe7,0x39,0xe7,0x39,0xc7,0x39,0x29,0x4a,0x69,0x4a,0xcb,0x5a,0xec,0x62,0x49,0x4a,0xc7,0x39,0x49,0x4a,0x28,0x42,0x1c,0xe7,0x0c,0x63,0x28,0x42,0xaf,0x73,
+    0x00,0x00,0xff,0x07,0x00,0x00,0x8d,0x6c,0x67,0x33,0x46,0x2b,0x47,0x33,0x69,0x43,0xe9,0x4b,0x68,0x3b,0xa6,0x31,0xc7,0x39,0x08,0x42,0xe7,0x39,0xa6,0x31,0x28,0x42,0x28,0x42,0xc7,0x39,0xe7,0x39,0x08,0x42,0x92,0x94,0xad,0x6b,0xcb,0x5a,0xff,0xff,0x4d,0x6b,0x0c,0x63,0xcb,0x5a,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xa5,0x2a,0x00,0x00,0x27,0x2b,0x47,0x2b,0x47,0x33,0x88,0x3b,0x67,0x33,0xa7,0x33,0x87,0x3a,0xa6,0x31,0xc7,0x39,0x69,0x4a,0xff,0xff,0x00,0x00,0x69,0x4a,0x28,0x42,0x28,0x42,0x69,0x4a,0x00,0x00,0x00,0x00,0x79,0xce,0xd3,0x9c,0xcb,0x5a,0xc7,0x39,0x50,0x8c,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x52,0x00,0x00,0x67,0x33,0x67,0x33,0x87,0x33,0x88,0x3b,0x47,0x33,0x47,0x33,0x27,0x3a,0xc7,0x39,0x08,0x42,0xcb,0x5a,0x55,0xad,0x00,0x00,0x45,0x29,0x86,0x31,0x00,0x00,0x00,0x00,0xba,0xd6,0xb3,0x9c,0xaa,0x52,0x49,0x4a,0x6d,0x6b,0x00,0x00,0xef,0x7b,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0x7b,0x87,0x33,0x67,0x33,0x47,0x33,0x47,0x33,0x88,0x3b,0xc9,0x43,0x28,0x42,0xa7,0x39,0xa7,0x39,0x28,0x42,0x0c,0x63,0xae,0x73,0x31,0x84,0x50,0x8c,0xcf,0x73,0xeb,0x5a,0x8a,0x52,0x6a,0x4a,0x0b,0x63,0xdb,0xde,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x67,0x33,0x67,0x33,0x87,0x33,0xa8,0x3b,0xa9,0x43,0xa7,0x32,0xe7,0x39,0x28,0x42,0x49,0x4a,0x08,0x42,0x08,0x42,0x69,0x4a,0xab,0x52,0x8a,0x52,0x29,0x42,0x8b,0x4a,0xff,0xff,0x00,0x00,0xef,0x7b,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0x00,0x00,0x00,0x00,0xe6,0x4b,0x87,0x33,0x87,0x33,0x88,0x3b,0x88,0x43,0xe8,0x3b,0x29,0x43,0x08,0x42,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0x8a,0x4a,0xd7,0xbd,0x00,0x00,0x00,0x00,0x55,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa5,0x2a,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x03,0x66,0x23,0x88,0x3b,0x28,0x34,0x00,0x00,0x00,0x00,0xff,0xff,0xd6,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xef,0x7b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x03,0x26,0x33,0x26,0x33,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x52,0x2c,0x63,0xef,0x7b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x03,0x03,0x03,0x01,0x01,0x02,0x03,0x03,0x03,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x03,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x05,0x00,0x00,0x23,0x6d,0x9d,0xb9,0x90,0x14,0x29,0x63,0x7d,0x82,0x7a,0x57,0x23,0x00,0x00,0x05,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x19,0x82,0xb0,0xb3,0xb7,0xb8,0xb1,0x9c,0xc7,0xff,0xff,0xff,0xff,0xf5,0xbe,0x79,0x25,0x00,0x00,0x01,0x00,
+    0x00,0x00,0x00,0x02,0x00,0x00,0x2e,0xa8,0xd7,0xcc,0xa9,0x70,0x5d,0xb0,0xff,0xe9,0xb9,0x9a,0x8f,0xa3,0xc5,0xf4,0xff,0xb0,0x37,0x00,0x01,0x00,
+    0x00,0x00,0x01,0x04,0x00,0x29,0xc3,0xe3,0x7e,0x96,0xb3,0xa9,0xdd,0xff,0xae,0x4b,0x00,0x00,0x00,0x00,0x10,0x5f,0xbc,0xff,0xcc,0x3b,0x00,0x01,
+    0x00,0x00,0x03,0x00,0x1c,0xa3,0xe7,0x5c,0xce,0xf5,0xa1,0xbe,0xfc,0x7f,0x02,0x00,0x1a,0x7b,0x9c,0x44,0x00,0x00,0x0d,0x99,0xfd,0xc1,0x17,0x00,
+    0x00,0x01,0x03,0x00,0x70,0xeb,0x6b,0xb3,0xff,0xa0,0xb0,0xfe,0x90,0x00,0x11,0x00,0x48,0xd2,0xf9,0xa6,0x00,0x00,0x07,0x13,0xa2,0xfe,0x8c,0x00,
+    0x00,0x03,0x01,0x31,0xb0,0xcf,0x7a,0xb7,0xd7,0x9f,0xe3,0xc3,0x1b,0x75,0xd4,0xa6,0xd6,0xff,0xff,0xff,0xbe,0xbb,0xc1,0x2b,0x32,0xe4,0xd5,0x2a,
+    0x00,0x06,0x00,0x71,0xd2,0x77,0x9e,0xb8,0x98,0xcf,0xf6,0x61,0x13,0xeb,0xff,0xff,0xc6,0x80,0x72,0x99,0xef,0xff,0xff,0x6a,0x04,0x8b,0xfb,0x7b,
+    0x01,0x04,0x00,0x9f,0xe0,0x50,0xa1,0xb8,0x82,0xe7,0xd6,0x1d,0x0e,0xc5,0xfe,0xa1,0x33,0x09,0x00,0x0b,0x61,0xdd,0xfe,0x56,0x00,0x4a,0xea,0xca,
+    0x01,0x00,0x11,0xb8,0xdc,0x62,0x9c,0xae,0x7e,0xeb,0xa9,0x00,0x38,0xb4,0xd2,0x59,0x1f,0x02,0x00,0x15,0x37,0x7d,0xf3,0x7c,0x0e,0x31,0xc0,0xf5,
+    0x01,0x00,0x32,0xb8,0xcc,0x78,0x9c,0xaa,0x7c,0xf3,0x8d,0x18,0xbb,0xf6,0x76,0x7c,0x71,0x3b,0x2f,0x63,0x83,0x2a,0xda,0xef,0x5f,0x33,0xa7,0xff,
+    0x01,0x00,0x38,0xae,0xc3,0x8b,0x9e,0xa6,0x88,0xfa,0x84,0x51,0xff,0xf3,0x57,0x5c,0x5e,0xad,0xba,0x62,0x78,0x21,0xce,0xff,0xb5,0x4b,0x94,0xff,
+    0x01,0x00,0x36,0xb3,0xc9,0x89,0xa0,0xa1,0x7d,0xf8,0x86,0x43,0xff,0xf7,0x6a,0x7a,0x53,0x79,0x84,0x49,0x81,0x13,0xcc,0xff,0x9c,0x3c,0x9f,0xff,
+    0x01,0x00,0x1e,0xba,0xd4,0x63,0x9a,0xb2,0x80,0xec,0xa7,0x07,0x49,0xd9,0xc1,0x2d,0x22,0xb9,0xed,0x76,0x1c,0x48,0xee,0x84,0x18,0x30,0xb9,0xfa,
+    0x00,0x02,0x05,0xac,0xe2,0x50,0x9b,0xbe,0x7f,0xe3,0xcc,0x15,0x05,0xb0,0xf5,0x77,0x3a,0x9e,0xde,0x78,0x1d,0xbe,0xfa,0x4e,0x00,0x41,0xe2,0xd0,
+    0x00,0x05,0x00,0x87,0xd6,0x64,0xa9,0xb3,0x82,0xd2,0xf6,0x50,0x12,0xe4,0xff,0xff,0xc8,0xab,0xb5,0xb6,0xce,0xff,0xff,0x74,0x04,0x71,0xf7,0x8e,
+    0x00,0x04,0x00,0x44,0xbc,0xab,0x7f,0xca,0xc0,0xa7,0xee,0xa4,0x17,0xb0,0xdd,0xc8,0xef,0xf3,0xdf,0xf2,0xd1,0xc5,0xd1,0x47,0x1c,0xc8,0xe4,0x38,
+    0x00,0x01,0x01,0x07,0x8a,0xeb,0x63,0xcd,0xff,0x95,0xb3,0xf8,0x63,0x0c,0x4f,0x1e,0x72,0xf4,0xff,0xbd,0x13,0x27,0x30,0x04,0x82,0xff,0x9c,0x00,
+    0x00,0x00,0x06,0x01,0x32,0xc1,0xc5,0x85,0xe8,0xcb,0xa3,0xee,0xe4,0x3e,0x02,0x00,0x21,0xa9,0xe5,0x6a,0x00,0x00,0x05,0x70,0xfc,0xd0,0x2d,0x01,
+    0x00,0x00,0x01,0x03,0x01,0x3f,0xe5,0xb5,0x7a,0xe5,0xbb,0x8c,0xff,0xe7,0x6d,0x06,0x00,0x06,0x0a,0x00,0x00,0x13,0x8f,0xfa,0xe4,0x5a,0x00,0x02,
+    0x00,0x00,0x00,0x02,0x00,0x02,0x44,0xca,0xdf,0xa5,0x84,0x64,0x72,0xf2,0xf8,0xca,0x8a,0x4f,0x41,0x63,0x93,0xd7,0xff,0xd9,0x50,0x07,0x01,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x3a,0x8f,0xb7,0xe6,0xe5,0xab,0xb3,0xbf,0xff,0xff,0xf9,0xf3,0xff,0xff,0xf0,0x90,0x37,0x01,0x00,0x02,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x0e,0x5a,0x8d,0xa6,0xa5,0x71,0x48,0x5e,0x8e,0xa8,0xad,0xa1,0x81,0x4b,0x0b,0x00,0x00,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x06,0x00,0x00,0x00,0x04,0x20,0x2b,0x13,0x00,0x00,0x04,0x0a,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x05,0x05,0x01,0x00,0x00,0x00,0x05,0x05,0x01,0x00,0x02,0x06,0x05,0x02,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 };
 
 const lv_image_dsc_t img_logo_28x28_preview = {
   .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.cf = LV_COLOR_FORMAT_ARGB8888,
+  .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.flags = 0,
   .header.w = 28,
   .header.h = 28,
-  .header.stride = 112,
+  .header.stride = 56,
   .data_size = sizeof(img_logo_28x28_preview_map),
   .data = img_logo_28x28_preview_map,
 };
@@ -23,107 +23,195 @@
 #define LV_ATTRIBUTE_IMG_MONITOR_EXTRUDER_EMPTY_UNLOAD
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 10440 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_MONITOR_EXTRUDER_EMPTY_UNLOAD
 uint8_t img_monitor_extruder_empty_unload_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x01,0xff,0x00,0xff,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xaa,0x00,0x03,0x55,0xaa,0x55,0x03,0x55,0xaa,0x55,0x03,0x00,0x7f,0x7f,0x02,0x00,0x7f,0x00,0x02,0x7f,0x7f,0x00,0x02,0x7f,0xff,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xaa,0x00,0x06,0x55,0xaa,0x00,0x03,0x40,0xbf,0x00,0x04,0x55,0xaa,0x00,0x03,0x55,0xaa,0x00,0x03,0x55,0xaa,0x55,0x03,0x55,0xaa,0x2a,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xa2,0x00,0x0b,0x66,0xcc,0x33,0x05,0x33,0x99,0x00,0x05,0x33,0x99,0x00,0x05,0x33,0xcc,0x00,0x05,0x40,0xbf,0x40,0x04,0x39,0xaa,0x1c,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0xb6,0x00,0x0e,0x2a,0xaa,0x2a,0x06,0x33,0x99,0x00,0x05,0x2a,0xaa,0x00,0x06,0x2a,0xaa,0x00,0x06,0x2a,0xaa,0x00,0x06,0x49,0xa4,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xb8,0x00,0x12,0x49,0xb6,0x24,0x07,0x49,0xb6,0x24,0x07,0x49,0xb6,0x24,0x07,0x49,0xb6,0x00,0x07,0x49,0xb6,0x24,0x07,0x47,0xaa,0x0e,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xae,0x00,0x16,0x40,0xbf,0x00,0x08,0x55,0xaa,0x1c,0x09,0x40,0xbf,0x00,0x08,0x40,0x9f,0x00,0x08,0x40,0x9f,0x00,0x08,0x3d,0xb6,0x0c,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xb0,0x00,0x1a,0x39,0xaa,0x00,0x09,0x33,0xb2,0x00,0x0a,0x33,0xb2,0x00,0x0a,0x33,0x99,0x19,0x0a,0x33,0x99,0x00,0x0a,0x3d,0xad,0x00,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xb2,0x00,0x1e,0x46,0xa2,0x00,0x0b,0x46,0xa2,0x17,0x0b,0x33,0xb2,0x00,0x0a,0x2e,0xa2,0x00,0x0b,0x46,0xb9,0x17,0x0b,0x3e,0xb0,0x00,0x1d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xac,0x00,0x22,0x40,0xaa,0x00,0x0c,0x3b,0xb0,0x00,0x0d,0x40,0xaa,0x00,0x0c,0x40,0xaa,0x15,0x0c,0x40,0xaa,0x00,0x0c,0x40,0xaf,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xae,0x00,0x26,0x3b,0xb0,0x14,0x0d,0x3b,0xb0,0x00,0x0d,0x3b,0x9d,0x14,0x0d,0x3b,0xb0,0x00,0x0d,0x49,0xa4,0x00,0x0e,0x40,0xb1,0x07,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xae,0x06,0x29,0x44,0xaa,0x00,0x0f,0x37,0xb6,0x00,0x0e,0x49,0xb6,0x00,0x0e,0x37,0xb6,0x00,0x0e,0x44,0xaa,0x00,0x0f,0x40,0xb2,0x06,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xb0,0x00,0x2d,0x40,0xaf,0x00,0x10,0x40,0xaf,0x10,0x10,0x40,0x9f,0x00,0x10,0x40,0xaf,0x00,0x10,0x40,0xaf,0x00,0x10,0x3e,0xaa,0x06,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xac,0x00,0x31,0x4b,0xb4,0x0f,0x11,0x3c,0xb4,0x00,0x11,0x3c,0xb4,0x00,0x11,0x47,0xaa,0x00,0x12,0x3c,0xb4,0x00,0x11,0x40,0xaa,0x05,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xad,0x00,0x35,0x43,0xae,0x0d,0x13,0x43,0xae,0x0d,0x13,0x50,0xae,0x0d,0x13,0x47,0xaa,0x0e,0x12,0x39,0xaa,0x00,0x12,0x45,0xb0,0x05,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xae,0x04,0x39,0x40,0xa6,0x00,0x14,0x40,0xa6,0x00,0x14,0x43,0xae,0x00,0x13,0x43,0xae,0x00,0x13,0x43,0xae,0x00,0x13,0x46,0xb0,0x05,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xae,0x04,0x3c,0x40,0xb2,0x0d,0x14,0x3d,0xaa,0x00,0x15,0x3d,0xaa,0x0c,0x15,0x49,0xaa,0x0c,0x15,0x49,0xaa,0x00,0x15,0x42,0xb0,0x00,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xae,0x00,0x3f,0x42,0xb1,0x00,0x17,0x46,0xae,0x0c,0x16,0x46,0xae,0x0c,0x16,0x46,0xae,0x00,0x16,0x46,0xae,0x0c,0x16,0x45,0xae,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xaf,0x04,0x43,0x40,0xaa,0x00,0x18,0x45,0xac,0x00,0x25,0x44,0xb0,0x00,0x47,0x47,0xb1,0x00,0x24,0x37,0xb1,0x0b,0x17,0x41,0xaf,0x00,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xac,0x00,0x47,0x43,0xa8,0x00,0x26,0x40,0xaf,0x00,0x50,0x3d,0xaa,0x00,0x2a,0x42,0xae,0x00,0x55,0x3d,0xad,0x00,0x32,0x3e,0xaf,0x04,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xad,0x00,0x4b,0x43,0xac,0x00,0x22,0x43,0xac,0x07,0x22,0x3b,0xa7,0x00,0x1a,0x3c,0xac,0x00,0x22,0x41,0xaa,0x00,0x27,0x41,0xad,0x00,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xad,0x00,0x4e,0x42,0xaa,0x00,0x1b,0x42,0xb3,0x00,0x1b,0x42,0xaa,0x00,0x1b,0x42,0xaa,0x00,0x1b,0x42,0xaa,0x00,0x1b,0x41,0xad,0x00,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xae,0x00,0x52,0x40,0xad,0x00,0x1c,0x40,0xad,0x00,0x1c,0x40,0xad,0x00,0x1c,0x37,0xad,0x09,0x1c,0x40,0xad,0x09,0x1c,0x41,0xae,0x00,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xae,0x00,0x55,0x3e,0xb0,0x00,0x1d,0x44,0xaa,0x00,0x1e,0x3b,0xaa,0x00,0x1e,0x44,0xaa,0x00,0x1e,0x3e,0xb0,0x00,0x1d,0x42,0xae,0x03,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xae,0x03,0x58,0x42,0xad,0x00,0x1f,0x42,0xad,0x08,0x1f,0x3a,0xad,0x08,0x1f,0x42,0xad,0x08,0x1f,0x42,0xad,0x00,0x1f,0x41,0xad,0x00,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xad,0x00,0x5d,0x40,0xa7,0x00,0x20,0x40,0xaf,0x08,0x20,0x48,0xaf,0x00,0x20,0x40,0xaf,0x00,0x20,0x40,0xaf,0x08,0x20,0x41,0xae,0x00,0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xad,0x00,0x61,0x46,0xb2,0x00,0x21,0x3e,0xb2,0x00,0x21,0x46,0xb2,0x00,0x21,0x46,0xb2,0x00,0x21,0x46,0xb2,0x00,0x21,0x44,0xae,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xad,0x00,0x64,0x43,0xac,0x00,0x22,0x42,0xaf,0x00,0x23,0x45,0xaf,0x00,0x59,0x44,0xaa,0x00,0x2d,0x43,0xac,0x00,0x22,0x42,0xae,0x00,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xb0,0x00,0x67,0x41,0xae,0x00,0x2f,0x43,0xad,0x00,0xb2,0x42,0xae,0x00,0xa7,0x42,0xad,0x00,0xb2,0x42,0xb0,0x00,0x3a,0x42,0xaf,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xae,0x00,0x6b,0x41,0xac,0x00,0x66,0x41,0xae,0x00,0x71,0x3e,0xac,0x07,0x25,0x43,0xad,0x00,0x67,0x41,0xae,0x00,0x71,0x42,0xaf,0x00,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xb0,0x00,0x6e,0x43,0xae,0x00,0x26,0x41,0xaa,0x00,0x27,0x3c,0xa8,0x07,0x26,0x43,0xae,0x00,0x26,0x41,0xaa,0x00,0x27,0x42,0xaf,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xac,0x00,0x72,0x46,0xac,0x06,0x28,0x40,0xac,0x00,0x28,0x41,0xb0,0x00,0x27,0x46,0xb2,0x06,0x28,0x41,0xaa,0x00,0x27,0x41,0xac,0x00,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xac,0x00,0x75,0x44,0xae,0x00,0x29,0x44,0xae,0x00,0x29,0x3e,0xae,0x00,0x29,0x3e,0xae,0x06,0x29,0x44,0xae,0x00,0x29,0x42,0xae,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xaf,0x00,0x79,0x43,0xb0,0x00,0x2a,0x41,0xac,0x00,0x2b,0x3d,0xaa,0x00,0x2a,0x43,0xb0,0x00,0x2a,0x43,0xb0,0x00,0x2a,0x42,0xad,0x02,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xaf,0x00,0x7c,0x41,0xac,0x00,0x2b,0x41,0xb2,0x00,0x2b,0x40,0xac,0x00,0x53,0x41,0xac,0x00,0x2b,0x41,0xb2,0x00,0x2b,0x40,0xaf,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xaf,0x02,0x7f,0x41,0xac,0x00,0x47,0x43,0xae,0x00,0xca,0x42,0xae,0x00,0xca,0x42,0xae,0x00,0xe5,0x41,0xac,0x00,0x47,0x42,0xaf,0x00,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xaf,0x00,0x83,0x42,0xad,0x00,0x7c,0x43,0xaf,0x00,0x6f,0x42,0xb1,0x00,0x2e,0x43,0xad,0x00,0x63,0x42,0xad,0x00,0x7c,0x42,0xae,0x02,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xad,0x02,0x86,0x41,0xae,0x00,0x2f,0x41,0xae,0x00,0x2f,0x40,0xaf,0x05,0x30,0x45,0xaf,0x00,0x30,0x40,0xaa,0x00,0x30,0x42,0xad,0x00,0x8c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xae,0x00,0x8a,0x40,0xaf,0x00,0x30,0x44,0xb1,0x05,0x31,0x40,0xaf,0x05,0x30,0x40,0xaf,0x00,0x30,0x44,0xac,0x00,0x31,0x40,0xaf,0x00,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xad,0x00,0x8c,0x42,0xad,0x00,0x32,0x42,0xad,0x05,0x32,0x42,0xad,0x00,0x32,0x3d,0xad,0x00,0x32,0x42,0xad,0x05,0x32,0x42,0xaf,0x02,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7d,0xb3,0x5a,0xa5,0x9b,0xb7,0x8b,0x7f,0x99,0xb5,0x89,0x80,0x99,0xb5,0x89,0x80,0x9b,0xb7,0x8b,0x7f,0x9b,0xb5,0x8d,0x7f,0x79,0xb3,0x56,0xab,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xba,0xba,0xba,0xbf,0xbd,0xbd,0xbc,0xff,0xc6,0xc5,0xc3,0xff,0xc8,0xc7,0xc5,0xff,0xc7,0xc6,0xc4,0xff,0xbe,0xbe,0xbd,0xff,0xb9,0xb9,0xb9,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbb,0xbb,0xba,0xbf,0xc9,0xc8,0xc5,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xb9,0xb9,0xb9,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0xbc,0xbb,0xbf,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xbd,0xbd,0xbd,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0xbc,0xbb,0xbf,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xbd,0xbd,0xbd,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbb,0xbb,0xba,0xbf,0xc8,0xc7,0xc5,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xc8,0xc7,0xc4,0xff,0xbc,0xbc,0xba,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xcf,0xcf,0x10,0xd4,0xd4,0xcf,0x30,0xd3,0xd3,0xcf,0x40,0xd3,0xd3,0xcf,0x40,0x96,0x96,0x96,0x50,0xb6,0xb6,0xb6,0xcf,0xbb,0xbb,0xbb,0xff,0xc2,0xc2,0xc0,0xff,0xc6,0xc5,0xc2,0xff,0xc2,0xc2,0xc0,0xff,0xbb,0xbb,0xba,0xff,0xb5,0xb5,0xb5,0xef,0x87,0x87,0x87,0x40,0xd3,0xd3,0xcf,0x40,0xd3,0xd3,0xcf,0x40,0xd3,0xd3,0xcf,0x40,0xd3,0xd3,0xcf,0x40,0xcf,0xcf,0xcf,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd3,0xd3,0xcf,0x40,0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xcb,0xcb,0xc7,0xff,0xbf,0xbf,0xbc,0xff,0xb6,0xb6,0xb4,0xff,0xb9,0xb9,0xb7,0xff,0xb9,0xb9,0xb7,0xff,0xb9,0xb9,0xb7,0xff,0xb6,0xb6,0xb4,0xff,0xba,0xba,0xb8,0xff,0xc1,0xc1,0xbe,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,0xd7,0xd7,0xd1,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd3,0xd3,0xcf,0x90,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd5,0xd5,0xd0,0x9f,0xcf,0xcf,0xcf,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd3,0xd3,0xcf,0x90,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd5,0xd5,0xd2,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd7,0xd7,0xd4,0xff,0xd6,0xd6,0xd3,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xcf,0xcf,0xcf,0xcf,0x10,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xcf,0x70,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd7,0xd7,0xd4,0xff,0xde,0xde,0xdb,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xdf,0xdd,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd6,0xd6,0xd1,0x8f,0x00,0x00,0x00,0x00,
-    0xcf,0xcf,0xcf,0x10,0xd5,0xd5,0xd0,0xdf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdb,0xdb,0xd8,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd8,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd7,0xd7,0xcf,0x20,
-    0xd4,0xd4,0xcf,0x60,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xda,0xda,0xd7,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd1,0x8f,
-    0xd5,0xd5,0xd0,0xaf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xe0,0xe0,0xdd,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe0,0xe0,0xde,0xff,0xd5,0xd5,0xd1,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xcf,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd7,0xd7,0xd4,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xef,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd8,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe0,0xdf,0xdd,0xff,0xd8,0xd7,0xd4,0xff,0xd6,0xd6,0xd2,0xff,0xcf,0xcd,0xc9,0xff,0xd0,0xce,0xca,0xff,0xd6,0xd4,0xd1,0xff,0xd6,0xd5,0xd1,0xff,0xdf,0xde,0xdc,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe0,0xe0,0xde,0xff,0xd7,0xd6,0xd2,0xff,0xcd,0xcb,0xc7,0xff,0xd0,0xce,0xca,0xff,0xcf,0xcd,0xc8,0xff,0xcb,0xc9,0xc4,0xff,0xcc,0xca,0xc6,0xff,0xcf,0xcd,0xc9,0xff,0xcf,0xcd,0xc9,0xff,0xcb,0xc9,0xc4,0xff,0xd5,0xd4,0xd0,0xff,0xdf,0xde,0xdc,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe0,0xe0,0xde,0xff,0xd2,0xd1,0xcd,0xff,0xcd,0xcc,0xc7,0xff,0xcd,0xcc,0xc7,0xff,0xce,0xcc,0xc8,0xff,0xdc,0xdb,0xd9,0xff,0xe4,0xe3,0xe1,0xff,0xe4,0xe4,0xe3,0xff,0xde,0xdd,0xdb,0xff,0xd0,0xcf,0xcb,0xff,0xcf,0xcd,0xc9,0xff,0xcb,0xc9,0xc4,0xff,0xd2,0xd1,0xcc,0xff,0xdf,0xde,0xdc,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd5,0xd4,0xd0,0xff,0xd0,0xcf,0xca,0xff,0xcd,0xcc,0xc7,0xff,0xde,0xdd,0xda,0xff,0xf6,0xf6,0xf6,0xff,0xf7,0xf7,0xf7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xe4,0xe3,0xe1,0xff,0xd0,0xce,0xca,0xff,0xcd,0xcc,0xc7,0xff,0xd2,0xd1,0xcc,0xff,0xe0,0xe0,0xde,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd8,0xff,0xcf,0xce,0xc9,0xff,0xcb,0xc9,0xc4,0xff,0xe2,0xe2,0xdf,0xff,0xf7,0xf7,0xf7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xeb,0xeb,0xea,0xff,0xcb,0xca,0xc5,0xff,0xcf,0xce,0xc9,0xff,0xda,0xda,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd4,0xd2,0xce,0xff,0xcc,0xcb,0xc6,0xff,0xdb,0xda,0xd7,0xff,0xf7,0xf7,0xf7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xdf,0xde,0xdc,0xff,0xca,0xc9,0xc4,0xff,0xd2,0xd1,0xcc,0xff,0xe0,0xe0,0xde,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xde,0xdc,0xff,0xcc,0xcb,0xc6,0xff,0xcb,0xca,0xc5,0xff,0xeb,0xeb,0xe9,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf1,0xff,0xcd,0xcc,0xc7,0xff,0xcb,0xc9,0xc5,0xff,0xda,0xda,0xd7,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xda,0xd9,0xd7,0xff,0xd0,0xce,0xca,0xff,0xcf,0xce,0xc9,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xd3,0xd2,0xcf,0xff,0xcf,0xcd,0xc9,0xff,0xd7,0xd7,0xd3,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xda,0xda,0xd7,0xff,0xd1,0xcf,0xcb,0xff,0xd0,0xcf,0xcb,0xff,0xf7,0xf7,0xf7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xd4,0xd3,0xd0,0xff,0xcf,0xcd,0xc8,0xff,0xd9,0xd9,0xd5,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd9,0xd9,0xd5,0xff,0xcf,0xcd,0xc8,0xff,0xcd,0xcb,0xc7,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xd4,0xd3,0xd0,0xff,0xcf,0xcd,0xc8,0xff,0xd7,0xd7,0xd3,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xdf,0xdc,0xff,0xcb,0xc9,0xc5,0xff,0xcd,0xcb,0xc6,0xff,0xeb,0xeb,0xe9,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf3,0xf3,0xf3,0xff,0xca,0xc9,0xc4,0xff,0xcb,0xca,0xc5,0xff,0xda,0xda,0xd7,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd4,0xd3,0xcf,0xff,0xca,0xc9,0xc4,0xff,0xdb,0xda,0xd8,0xff,0xf7,0xf7,0xf7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xe0,0xdf,0xdc,0xff,0xcb,0xca,0xc5,0xff,0xd2,0xd0,0xcc,0xff,0xe0,0xe0,0xde,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd9,0xd8,0xd5,0xff,0xd0,0xce,0xca,0xff,0xca,0xc9,0xc4,0xff,0xe5,0xe5,0xe3,0xff,0xf7,0xf7,0xf7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xef,0xef,0xef,0xff,0xcd,0xcb,0xc7,0xff,0xcf,0xce,0xc9,0xff,0xd7,0xd7,0xd3,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd4,0xd3,0xcf,0xff,0xcf,0xcd,0xc9,0xff,0xca,0xc9,0xc4,0xff,0xe2,0xe1,0xde,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf6,0xf6,0xf6,0xff,0xe8,0xe8,0xe6,0xff,0xd0,0xcf,0xcb,0xff,0xce,0xcd,0xc8,0xff,0xd2,0xd1,0xcd,0xff,0xde,0xde,0xdc,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xde,0xdc,0xff,0xd0,0xcf,0xca,0xff,0xce,0xcc,0xc8,0xff,0xcd,0xcc,0xc7,0xff,0xd0,0xce,0xca,0xff,0xe1,0xe1,0xde,0xff,0xe9,0xe8,0xe8,0xff,0xe8,0xe7,0xe5,0xff,0xe1,0xe0,0xde,0xff,0xd6,0xd4,0xd1,0xff,0xcd,0xcc,0xc7,0xff,0xcc,0xcb,0xc6,0xff,0xd2,0xd1,0xcd,0xff,0xdf,0xdf,0xdd,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe0,0xe0,0xde,0xff,0xd5,0xd5,0xd1,0xff,0xce,0xcc,0xc8,0xff,0xce,0xcc,0xc8,0xff,0xcd,0xcc,0xc7,0xff,0xca,0xc8,0xc3,0xff,0xcc,0xca,0xc6,0xff,0xce,0xcc,0xc8,0xff,0xcf,0xcd,0xc9,0xff,0xcc,0xcb,0xc6,0xff,0xd3,0xd2,0xce,0xff,0xdf,0xdf,0xdd,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xde,0xde,0xdc,0xff,0xd6,0xd5,0xd1,0xff,0xd4,0xd3,0xcf,0xff,0xcd,0xcb,0xc6,0xff,0xce,0xcc,0xc8,0xff,0xd3,0xd2,0xce,0xff,0xd5,0xd4,0xd0,0xff,0xdc,0xdb,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xd4,0xd4,0xd0,0xbf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd9,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,
-    0xcc,0xcc,0xc8,0xbf,0xcd,0xce,0xca,0xff,0xcd,0xce,0xca,0xff,0xd3,0xd4,0xd0,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xdd,0xdd,0xdb,0xff,0xd7,0xd7,0xd4,0xff,0xcd,0xce,0xca,0xff,0xcd,0xce,0xca,0xff,0xcd,0xce,0xca,0xff,
-    0xa3,0xa6,0xa3,0xbf,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xb0,0xb1,0xac,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xc7,0xc5,0xbe,0xff,0xb8,0xb9,0xb4,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,
-    0xa3,0xa6,0xa3,0xbf,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xaa,0xab,0xaa,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xae,0xaf,0xae,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,
-    0xa3,0xa6,0xa3,0xbf,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xaa,0xab,0xaa,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xae,0xaf,0xae,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,
-    0xa3,0xa6,0xa3,0xbf,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xaa,0xab,0xaa,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xae,0xaf,0xae,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,
-    0x9f,0xa3,0x9f,0x50,0xa1,0xa5,0xa1,0xdf,0xa2,0xa5,0xa2,0xff,0xa4,0xa7,0xa4,0xff,0xaa,0xab,0xaa,0xff,0xaa,0xab,0xaa,0xff,0xac,0xae,0xac,0xbf,0xb6,0xb6,0xb6,0x5f,0xb6,0xb6,0xb6,0x5f,0xb6,0xb6,0xb6,0x5f,0xb6,0xb6,0xb6,0x5f,0xb6,0xb6,0xb6,0x5f,0xaa,0xac,0xaa,0xef,0xaa,0xab,0xaa,0xff,0xaa,0xab,0xaa,0xff,0xaa,0xab,0xaa,0xff,0xaa,0xab,0xaa,0xff,0xaa,0xab,0xaa,0xff,0xac,0xad,0xac,0xaf,0xb6,0xb6,0xb6,0x5f,0xb6,0xb6,0xb6,0x5f,0xb6,0xb6,0xb6,0x5f,0xb6,0xb6,0xb6,0x5f,0xac,0xad,0xac,0xaf,0xaa,0xab,0xaa,0xff,0xaa,0xab,0xaa,0xff,0xa7,0xa9,0xa7,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xef,0xa1,0xa5,0xa1,0x7f,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xa2,0x9f,0x60,0xa1,0xa5,0xa1,0xcf,0xa2,0xa5,0xa2,0xdf,0xa2,0xa5,0xa2,0xdf,0xa2,0xa4,0xa2,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa3,0xa6,0xa3,0xbf,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa6,0xa2,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa3,0xa5,0xa3,0x6f,0xa2,0xa5,0xa2,0xdf,0xa2,0xa5,0xa2,0xdf,0xa2,0xa5,0xa2,0xdf,0xa1,0xa5,0xa1,0x7f,0x9f,0x9f,0x9f,0x10,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0x9f,0x9f,0x30,0xa6,0xa6,0xa6,0x3f,0x96,0x97,0x97,0xcf,0x95,0x96,0x96,0xef,0xa6,0xa6,0xa6,0x3f,0xa6,0xa6,0xa6,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x07,0x1f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x05,0x4a,0x55,0x4a,0x55,0xe0,0x7b,0xe0,0x03,0xef,0x03,0xef,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x05,0x4a,0x05,0xe8,0x05,0x4a,0x05,0x4a,0x05,0x4a,0x55,0x4a,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x05,0x6c,0x36,0xc6,0x04,0xc6,0x04,0x66,0x06,0xe8,0x45,0x47,0x1d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x05,0x45,0x2d,0xc6,0x04,0x45,0x05,0x45,0x05,0x45,0x05,0x29,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x05,0xa9,0x25,0xa9,0x25,0xa9,0x25,0xa9,0x05,0xa9,0x25,0x48,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0xe8,0x05,0x4a,0x1d,0xe8,0x05,0xe8,0x04,0xe8,0x04,0xa7,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x47,0x05,0x86,0x05,0x86,0x05,0xc6,0x1c,0xc6,0x04,0x67,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x08,0x05,0x08,0x15,0x86,0x05,0x05,0x05,0xc8,0x15,0x87,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x48,0x05,0x87,0x05,0x48,0x05,0x48,0x15,0x48,0x05,0x68,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x87,0x15,0x87,0x05,0xe7,0x14,0x87,0x05,0x29,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x05,0x48,0x05,0xa6,0x05,0xa9,0x05,0xa6,0x05,0x48,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x05,0x68,0x05,0x68,0x15,0xe8,0x04,0x68,0x05,0x68,0x05,0x47,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0xa9,0x0d,0xa7,0x05,0xa7,0x05,0x48,0x05,0xa7,0x05,0x48,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x0d,0x68,0x0d,0x6a,0x0d,0x48,0x0d,0x47,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x05,0x28,0x05,0x28,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x88,0x0d,0x47,0x05,0x47,0x0d,0x49,0x0d,0x49,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x88,0x05,0x68,0x0d,0x68,0x0d,0x68,0x05,0x68,0x0d,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x48,0x05,0x68,0x05,0x88,0x05,0x88,0x05,0x86,0x0d,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x48,0x05,0x68,0x05,0x47,0x05,0x68,0x05,0x67,0x05,0x67,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x27,0x05,0x67,0x05,0x48,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x48,0x05,0x88,0x05,0x48,0x05,0x48,0x05,0x48,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x66,0x0d,0x68,0x0d,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x87,0x05,0x48,0x05,0x47,0x05,0x48,0x05,0x87,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x0d,0x67,0x0d,0x68,0x0d,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x28,0x05,0x68,0x0d,0x69,0x05,0x68,0x05,0x68,0x0d,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x88,0x05,0x87,0x05,0x88,0x05,0x88,0x05,0x88,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x48,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x88,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x67,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x68,0x05,0x48,0x05,0x47,0x05,0x68,0x05,0x48,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x88,0x05,0x88,0x05,0x48,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x67,0x05,0x67,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x88,0x05,0x68,0x05,0x47,0x05,0x88,0x05,0x88,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x88,0x05,0x68,0x05,0x68,0x05,0x88,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x88,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x48,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x88,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x67,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0x5d,0xb3,0x8d,0xb3,0x8d,0xb3,0x8d,0xb3,0x8d,0xb3,0x8d,0x8f,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0xbd,0xf7,0xbd,0x38,0xc6,0x39,0xc6,0x38,0xc6,0xf7,0xbd,0xd7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0xbd,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0xd7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xbd,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0xf7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xbd,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0xf7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0xbd,0x39,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x39,0xc6,0xf7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xce,0xba,0xce,0x9a,0xce,0x9a,0xce,0xb2,0x94,0xb6,0xb5,0xd7,0xbd,0x18,0xc6,0x38,0xc6,0x18,0xc6,0xd7,0xbd,0xb6,0xb5,0x30,0x84,0x9a,0xce,0x9a,0xce,0x9a,0xce,0x9a,0xce,0x79,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9a,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x59,0xc6,0xf7,0xbd,0xb6,0xb5,0xd7,0xb5,0xd7,0xb5,0xd7,0xb5,0xb6,0xb5,0xd7,0xbd,0x18,0xbe,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x9a,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x79,0xce,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x9a,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x79,0xce,0x00,0x00,
+    0x00,0x00,0xba,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x00,0x00,
+    0x79,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xce,
+    0xba,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfc,0xde,0xbb,0xd6,0xba,0xd6,0x79,0xce,0x7a,0xce,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xba,0xd6,0x59,0xc6,0x7a,0xce,0x79,0xce,0x59,0xc6,0x59,0xc6,0x79,0xce,0x79,0xce,0x59,0xc6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9a,0xce,0x79,0xc6,0x79,0xc6,0x79,0xce,0xdb,0xde,0x1c,0xe7,0x3c,0xe7,0xfb,0xde,0x7a,0xce,0x79,0xce,0x59,0xc6,0x9a,0xce,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xba,0xd6,0x7a,0xce,0x79,0xc6,0xfb,0xde,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xbe,0xf7,0x1c,0xe7,0x7a,0xce,0x79,0xc6,0x9a,0xce,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0x79,0xce,0x59,0xc6,0x1c,0xdf,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xbe,0xf7,0x5d,0xef,0x59,0xc6,0x79,0xce,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9a,0xce,0x59,0xc6,0xdb,0xd6,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xbe,0xf7,0xfb,0xde,0x59,0xc6,0x9a,0xce,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0x59,0xc6,0x59,0xc6,0x5d,0xef,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x9e,0xf7,0x79,0xc6,0x59,0xc6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0x7a,0xce,0x79,0xce,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xbe,0xf7,0x9a,0xce,0x79,0xce,0xba,0xd6,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0x7a,0xce,0x7a,0xce,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xbe,0xf7,0x9a,0xd6,0x79,0xce,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0x79,0xce,0x59,0xc6,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xbe,0xf7,0x9a,0xd6,0x79,0xce,0xba,0xd6,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0x59,0xc6,0x59,0xc6,0x5d,0xef,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x9e,0xf7,0x59,0xc6,0x59,0xc6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9a,0xce,0x59,0xc6,0xdb,0xde,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xbe,0xf7,0xfc,0xde,0x59,0xc6,0x9a,0xce,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0x7a,0xce,0x59,0xc6,0x3c,0xe7,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x7d,0xef,0x59,0xc6,0x79,0xce,0xba,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9a,0xce,0x79,0xce,0x59,0xc6,0x1c,0xdf,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xbe,0xf7,0x5d,0xe7,0x7a,0xce,0x79,0xce,0x9a,0xce,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0x7a,0xce,0x79,0xce,0x79,0xc6,0x7a,0xce,0x1c,0xdf,0x5d,0xef,0x3d,0xe7,0x1c,0xdf,0xba,0xd6,0x79,0xc6,0x59,0xc6,0x9a,0xce,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xba,0xd6,0x79,0xce,0x79,0xce,0x79,0xc6,0x59,0xc6,0x59,0xc6,0x79,0xce,0x79,0xce,0x59,0xc6,0x9a,0xce,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0xba,0xd6,0x9a,0xce,0x59,0xc6,0x79,0xce,0x9a,0xce,0xba,0xd6,0xdb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x79,0xce,0x79,0xce,0x79,0xce,0xba,0xd6,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xba,0xd6,0x79,0xce,0x79,0xce,0x79,0xce,
+    0x34,0xa5,0x34,0xa5,0x34,0xa5,0x96,0xad,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0x38,0xbe,0xd7,0xb5,0x34,0xa5,0x34,0xa5,0x34,0xa5,
+    0x34,0xa5,0x34,0xa5,0x34,0xa5,0x55,0xad,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x75,0xad,0x34,0xa5,0x34,0xa5,0x34,0xa5,
+    0x34,0xa5,0x34,0xa5,0x34,0xa5,0x55,0xad,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x75,0xad,0x34,0xa5,0x34,0xa5,0x34,0xa5,
+    0x34,0xa5,0x34,0xa5,0x34,0xa5,0x55,0xad,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x75,0xad,0x34,0xa5,0x34,0xa5,0x34,0xa5,
+    0x13,0x9d,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x55,0xad,0x55,0xad,0x75,0xad,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x75,0xad,0x55,0xad,0x55,0xad,0x55,0xad,0x55,0xad,0x55,0xad,0x75,0xad,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x75,0xad,0x55,0xad,0x55,0xad,0x54,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,
+    0x00,0x00,0x00,0x00,0x13,0x9d,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0xf3,0x9c,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0x9c,0x34,0xa5,0xb2,0x94,0xb2,0x94,0x34,0xa5,0x34,0xa5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x02,0x02,0x02,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x03,0x04,0x03,0x03,0x03,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x05,0x05,0x05,0x05,0x04,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x06,0x05,0x06,0x06,0x06,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x07,0x07,0x07,0x07,0x07,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x08,0x09,0x08,0x08,0x08,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0x09,0x0a,0x0a,0x0a,0x0a,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x0b,0x0b,0x0a,0x0b,0x0b,0x1d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x0c,0x0d,0x0c,0x0c,0x0c,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x0d,0x0d,0x0d,0x0d,0x0e,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x0f,0x0e,0x0e,0x0e,0x0f,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x10,0x10,0x10,0x10,0x10,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x11,0x11,0x11,0x12,0x11,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x13,0x13,0x13,0x12,0x12,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x14,0x14,0x13,0x13,0x13,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x14,0x15,0x15,0x15,0x15,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x17,0x16,0x16,0x16,0x16,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x18,0x25,0x47,0x24,0x17,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x26,0x50,0x2a,0x55,0x32,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0x22,0x22,0x1a,0x22,0x27,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0x1b,0x1b,0x1b,0x1b,0x1b,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x1c,0x1c,0x1c,0x1c,0x1c,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x1d,0x1e,0x1e,0x1e,0x1d,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x1f,0x1f,0x1f,0x1f,0x1f,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x20,0x20,0x20,0x20,0x20,0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x21,0x21,0x21,0x21,0x21,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x22,0x23,0x59,0x2d,0x22,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x2f,0xb2,0xa7,0xb2,0x3a,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0x66,0x71,0x25,0x67,0x71,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0x26,0x27,0x26,0x26,0x27,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0x28,0x28,0x27,0x28,0x27,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0x29,0x29,0x29,0x29,0x29,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0x2a,0x2b,0x2a,0x2a,0x2a,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x2b,0x2b,0x53,0x2b,0x2b,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x47,0xca,0xca,0xe5,0x47,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x7c,0x6f,0x2e,0x63,0x7c,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x2f,0x2f,0x30,0x30,0x30,0x8c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8a,0x30,0x31,0x30,0x30,0x31,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8c,0x32,0x32,0x32,0x32,0x32,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa5,0x7f,0x80,0x80,0x7f,0x7f,0xab,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x30,0x40,0x40,0x50,0xcf,0xff,0xff,0xff,0xff,0xff,0xef,0x40,0x40,0x40,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x40,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,0x5f,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,0x10,0x00,0x00,
+    0x00,0x00,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xcf,0x10,0x00,
+    0x00,0x70,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,0x00,
+    0x10,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x20,
+    0x60,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,
+    0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xcf,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x50,0xdf,0xff,0xff,0xff,0xff,0xbf,0x5f,0x5f,0x5f,0x5f,0x5f,0xef,0xff,0xff,0xff,0xff,0xff,0xaf,0x5f,0x5f,0x5f,0x5f,0xaf,0xff,0xff,0xff,0xff,0xef,0x7f,
+    0x00,0x00,0x60,0xcf,0xdf,0xdf,0x8f,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0x3f,0x00,0x00,0x00,0x00,0x6f,0xdf,0xdf,0xdf,0x7f,0x10,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x3f,0xcf,0xef,0x3f,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 };
 
 const lv_image_dsc_t img_monitor_extruder_empty_unload = {
   .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.cf = LV_COLOR_FORMAT_ARGB8888,
+  .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.flags = 0,
   .header.w = 30,
   .header.h = 87,
-  .header.stride = 120,
+  .header.stride = 60,
   .data_size = sizeof(img_monitor_extruder_empty_unload_map),
   .data = img_monitor_extruder_empty_unload_map,
 };
@@ -23,106 +23,193 @@
 #define LV_ATTRIBUTE_IMG_MONITOR_EXTRUDER_FILLED_LOAD
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 10664 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_MONITOR_EXTRUDER_FILLED_LOAD
 uint8_t img_monitor_extruder_filled_load_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x01,0x00,0x00,0xff,0x01,0x00,0xff,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xbf,0x40,0x04,0x55,0xaa,0x55,0x03,0x00,0x7f,0x7f,0x02,0x00,0x7f,0x00,0x02,0x7f,0x7f,0x00,0x02,0x00,0x7f,0x00,0x02,0x7f,0x7f,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9f,0x00,0x08,0x40,0xbf,0x00,0x04,0x55,0xaa,0x00,0x03,0x55,0xaa,0x00,0x03,0x55,0xaa,0x55,0x03,0x40,0x7f,0x40,0x04,0x66,0xcc,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0xb0,0x14,0x0d,0x33,0xcc,0x00,0x05,0x33,0x99,0x00,0x05,0x33,0xcc,0x00,0x05,0x40,0xbf,0x40,0x04,0x00,0xbf,0x40,0x04,0x40,0x9f,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xbb,0x11,0x0f,0x33,0x99,0x00,0x05,0x2a,0xaa,0x00,0x06,0x55,0xaa,0x00,0x06,0x2a,0xaa,0x00,0x06,0x55,0xaa,0x00,0x06,0x46,0xa2,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xb2,0x0d,0x14,0x49,0xb6,0x24,0x07,0x49,0xb6,0x24,0x07,0x49,0xb6,0x00,0x07,0x49,0xb6,0x24,0x07,0x49,0xb6,0x24,0x07,0x49,0xa4,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xb5,0x0b,0x18,0x55,0xaa,0x1c,0x09,0x40,0xbf,0x00,0x08,0x40,0x9f,0x00,0x08,0x40,0x9f,0x00,0x08,0x40,0xbf,0x20,0x08,0x3c,0xa5,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xad,0x00,0x1c,0x33,0xb2,0x00,0x0a,0x33,0xb2,0x00,0x0a,0x33,0xb2,0x19,0x0a,0x33,0xb2,0x00,0x0a,0x39,0xaa,0x00,0x09,0x39,0xb8,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xaa,0x00,0x21,0x46,0xa2,0x17,0x0b,0x33,0xb2,0x00,0x0a,0x2e,0xa2,0x00,0x0b,0x46,0xb9,0x17,0x0b,0x46,0xa2,0x00,0x0b,0x3a,0xa2,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xb3,0x07,0x25,0x3b,0xb0,0x00,0x0d,0x40,0xaa,0x00,0x0c,0x40,0xaa,0x15,0x0c,0x40,0xaa,0x00,0x0c,0x40,0xaa,0x15,0x0c,0x3d,0xad,0x00,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xae,0x06,0x29,0x37,0xa4,0x00,0x0e,0x3b,0x9d,0x14,0x0d,0x3b,0xb0,0x00,0x0d,0x49,0xa4,0x00,0x0e,0x3b,0xb0,0x14,0x0d,0x40,0xad,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xac,0x06,0x2e,0x37,0xb6,0x00,0x0e,0x44,0xaa,0x00,0x0f,0x37,0xb6,0x00,0x0e,0x40,0x9f,0x00,0x10,0x44,0xaa,0x11,0x0f,0x3b,0xaa,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xb1,0x00,0x31,0x40,0xaf,0x10,0x10,0x40,0x9f,0x00,0x10,0x40,0xaf,0x00,0x10,0x40,0xaf,0x00,0x10,0x40,0xaf,0x10,0x10,0x46,0xaa,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xaf,0x05,0x36,0x47,0xaa,0x00,0x12,0x3c,0xb4,0x00,0x11,0x47,0xaa,0x00,0x12,0x3c,0xb4,0x00,0x11,0x3c,0xa5,0x0f,0x11,0x47,0xaa,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xb0,0x04,0x3a,0x43,0xae,0x0d,0x13,0x50,0xae,0x0d,0x13,0x47,0xaa,0x0e,0x12,0x39,0xaa,0x00,0x12,0x43,0xae,0x0d,0x13,0x48,0xb0,0x00,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xb0,0x00,0x3d,0x40,0xa6,0x00,0x14,0x43,0xae,0x00,0x13,0x43,0xae,0x00,0x13,0x43,0xae,0x00,0x13,0x40,0xb2,0x0d,0x14,0x44,0xb4,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xb0,0x04,0x41,0x3d,0xaa,0x00,0x15,0x3d,0xb6,0x0c,0x15,0x49,0xb6,0x0c,0x15,0x49,0xaa,0x00,0x15,0x3d,0xaa,0x00,0x15,0x44,0xb0,0x00,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xaf,0x04,0x46,0x46,0xb9,0x0c,0x16,0x46,0xae,0x0c,0x16,0x46,0xae,0x00,0x16,0x46,0xae,0x0c,0x16,0x42,0xb1,0x00,0x17,0x46,0xae,0x00,0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xb0,0x03,0x4a,0x45,0xad,0x00,0x3b,0x44,0xb0,0x00,0x2d,0x42,0xb1,0x00,0x17,0x42,0xab,0x04,0x3a,0x40,0xb2,0x00,0x28,0x42,0xad,0x00,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xaf,0x03,0x4d,0x40,0xaf,0x00,0x20,0x43,0xb0,0x00,0x54,0x43,0xae,0x00,0x4c,0x41,0xaf,0x00,0x43,0x40,0xaa,0x0b,0x18,0x45,0xac,0x00,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xb0,0x00,0x51,0x45,0xb0,0x0a,0x1a,0x3c,0xac,0x00,0x22,0x41,0xac,0x00,0x2b,0x3b,0xa7,0x00,0x1a,0x45,0xb0,0x00,0x1a,0x41,0xb0,0x00,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xac,0x00,0x56,0x40,0xad,0x00,0x1c,0x42,0xaa,0x00,0x1b,0x42,0xaa,0x00,0x1b,0x42,0xb3,0x00,0x1b,0x42,0xb3,0x00,0x1b,0x42,0xb0,0x00,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xaf,0x00,0x59,0x40,0xad,0x00,0x1c,0x40,0xad,0x00,0x1c,0x40,0xad,0x09,0x1c,0x40,0xad,0x09,0x1c,0x40,0xad,0x00,0x1c,0x43,0xab,0x00,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xad,0x00,0x5d,0x44,0xaa,0x00,0x1e,0x3b,0xaa,0x00,0x1e,0x44,0xaa,0x00,0x1e,0x3e,0xb0,0x00,0x1d,0x3e,0xb0,0x09,0x1d,0x43,0xad,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xac,0x00,0x62,0x42,0xad,0x08,0x1f,0x3a,0xad,0x08,0x1f,0x42,0xad,0x08,0x1f,0x42,0xad,0x00,0x1f,0x3a,0xad,0x00,0x1f,0x41,0xaf,0x00,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xae,0x00,0x65,0x40,0xaf,0x08,0x20,0x48,0xaf,0x00,0x20,0x40,0xaf,0x00,0x20,0x40,0xaf,0x08,0x20,0x40,0xaf,0x00,0x20,0x42,0xb1,0x00,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xac,0x00,0x69,0x3e,0xb2,0x00,0x21,0x46,0xb2,0x00,0x21,0x43,0xac,0x00,0x22,0x43,0xac,0x00,0x22,0x43,0xac,0x00,0x22,0x40,0xae,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xaf,0x00,0x6c,0x44,0xb0,0x00,0x5a,0x42,0xac,0x00,0x2e,0x43,0xac,0x00,0x22,0x41,0xaf,0x00,0x43,0x44,0xb2,0x00,0x38,0x44,0xb1,0x00,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xae,0x00,0x71,0x42,0xaf,0x00,0x70,0x42,0xae,0x00,0xbd,0x44,0xad,0x00,0x5a,0x43,0xad,0x00,0xb2,0x42,0xab,0x00,0x3a,0x41,0xad,0x00,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xae,0x00,0x74,0x45,0xac,0x00,0x25,0x40,0xae,0x03,0x5b,0x42,0xad,0x00,0x9e,0x42,0xab,0x00,0x3a,0x3e,0xac,0x00,0x25,0x41,0xab,0x00,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xae,0x00,0x78,0x41,0xaa,0x00,0x27,0x3c,0xa8,0x07,0x26,0x43,0xae,0x00,0x26,0x41,0xaa,0x00,0x27,0x41,0xaa,0x00,0x27,0x43,0xad,0x00,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xaf,0x02,0x7c,0x40,0xac,0x00,0x28,0x41,0xb0,0x00,0x27,0x46,0xb2,0x06,0x28,0x41,0xaa,0x00,0x27,0x40,0xac,0x00,0x28,0x41,0xaf,0x00,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xad,0x00,0x80,0x44,0xae,0x00,0x29,0x3e,0xae,0x00,0x29,0x3e,0xae,0x06,0x29,0x44,0xae,0x00,0x29,0x44,0xae,0x00,0x29,0x42,0xaf,0x00,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xac,0x00,0x84,0x41,0xac,0x00,0x2b,0x3d,0xaa,0x00,0x2a,0x43,0xb0,0x00,0x2a,0x43,0xb0,0x00,0x2a,0x43,0xaa,0x06,0x2a,0x42,0xaf,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xae,0x00,0x87,0x40,0xaf,0x00,0x53,0x41,0xb2,0x00,0x2b,0x41,0xac,0x00,0x2b,0x44,0xad,0x00,0x38,0x42,0xae,0x00,0x45,0x43,0xae,0x00,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xae,0x00,0x8b,0x42,0xae,0x00,0x88,0x42,0xae,0x00,0xe5,0x43,0xaf,0x00,0x95,0x42,0xae,0x00,0xe5,0x40,0xad,0x00,0x54,0x41,0xae,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xae,0x00,0x8e,0x42,0xb1,0x00,0x2e,0x43,0xae,0x00,0x48,0x42,0xae,0x00,0x97,0x41,0xad,0x00,0x3b,0x42,0xb1,0x06,0x2e,0x42,0xb0,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xad,0x00,0x92,0x41,0xae,0x00,0x2f,0x40,0xaf,0x05,0x30,0x45,0xaf,0x00,0x30,0x40,0xaa,0x00,0x30,0x40,0xaa,0x00,0x30,0x42,0xac,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xaf,0x00,0x95,0x44,0xb1,0x05,0x31,0x40,0xaf,0x05,0x30,0x40,0xaf,0x00,0x30,0x44,0xac,0x00,0x31,0x3e,0xac,0x00,0x31,0x43,0xad,0x00,0x6a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xae,0x00,0x98,0x42,0xad,0x05,0x32,0x42,0xad,0x00,0x32,0x3d,0xad,0x00,0x32,0x42,0xad,0x05,0x32,0x42,0xad,0x05,0x32,0x44,0xaf,0x00,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8c,0xb4,0x73,0xcc,0xa5,0xb7,0x99,0x99,0xa5,0xb7,0x99,0x99,0xa5,0xb7,0x99,0x99,0xa6,0xb7,0x9c,0x98,0xa4,0xb7,0x9c,0x98,0x89,0xb5,0x6e,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb9,0xb9,0xb9,0xff,0xc0,0xc0,0xbf,0xff,0xc9,0xc8,0xc5,0xff,0xca,0xc9,0xc6,0xff,0xc8,0xc7,0xc4,0xff,0xbd,0xbd,0xbc,0xff,0xb8,0xb8,0xb8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xbe,0xbd,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xc9,0xc8,0xc5,0xff,0xb8,0xb8,0xb8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xbf,0xbe,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xb8,0xb8,0xb8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xbf,0xbe,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xb8,0xb8,0xb8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xba,0xba,0xba,0xff,0xc9,0xc8,0xc5,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xca,0xc9,0xc6,0xff,0xc4,0xc4,0xc1,0xff,0xb8,0xb8,0xb8,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd4,0xd4,0xcf,0x30,0xd4,0xd4,0xcf,0x60,0xd4,0xd4,0xcf,0x60,0xd4,0xd4,0xcf,0x60,0x87,0x87,0x87,0x60,0xb9,0xb9,0xb9,0xff,0xbb,0xbb,0xbb,0xff,0xc1,0xc1,0xbf,0xff,0xc3,0xc3,0xc0,0xff,0xc0,0xc0,0xbe,0xff,0xba,0xba,0xba,0xff,0xae,0xae,0xae,0xcf,0xa2,0xa2,0x9f,0x60,0xd4,0xd4,0xcf,0x60,0xd4,0xd4,0xcf,0x60,0xd4,0xd4,0xcf,0x60,0xd2,0xd2,0xcf,0x50,0xd7,0xd7,0xcf,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd3,0xd3,0xcf,0x80,0xd4,0xd4,0xd0,0xef,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xcb,0xcb,0xc7,0xff,0xc0,0xc0,0xbe,0xff,0xbd,0xbd,0xbb,0xff,0xbd,0xbd,0xbb,0xff,0xbd,0xbd,0xbb,0xff,0xbd,0xbd,0xbb,0xff,0xbd,0xbd,0xbb,0xff,0xc0,0xc0,0xbe,0xff,0xd0,0xd0,0xcc,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,0xd7,0xd7,0xd1,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0xd7,0xcf,0x20,0xd4,0xd4,0xd0,0xcf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd6,0xd6,0xd1,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0xd7,0xcf,0x20,0xd5,0xd5,0xd0,0xdf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd5,0xd5,0xd1,0xff,0xd7,0xd7,0xd4,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd9,0xd9,0xd6,0xff,0xd7,0xd7,0xd4,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd5,0xd5,0xd0,0x9f,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd5,0xd5,0xd1,0xff,0xdb,0xdb,0xd8,0xff,0xe0,0xe0,0xde,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xdf,0xdd,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xcf,0x70,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xd3,0xd3,0xcf,0x40,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd5,0xd5,0xd1,0xff,0xdf,0xdf,0xdc,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdb,0xdb,0xd8,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xef,0xcf,0xcf,0xcf,0x10,
-    0x00,0x00,0x00,0x00,0xd5,0xd5,0xd0,0x9f,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd1,0x5f,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xcf,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd6,0xd6,0xd2,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xdf,0xdd,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0x9f,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd9,0xd9,0xd6,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd6,0xd6,0xd3,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdd,0xdc,0xda,0xff,0xd4,0xd3,0xcf,0xff,0xd3,0xd1,0xce,0xff,0xcf,0xcd,0xc9,0xff,0xcb,0xca,0xc5,0xff,0xd5,0xd4,0xd0,0xff,0xd7,0xd6,0xd2,0xff,0xde,0xdd,0xdb,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xde,0xdc,0xff,0xd4,0xd3,0xcf,0xff,0xcd,0xcc,0xc7,0xff,0xcf,0xcd,0xc9,0xff,0xce,0xcc,0xc8,0xff,0xcd,0xcc,0xc7,0xff,0xcb,0xc9,0xc4,0xff,0xcc,0xca,0xc6,0xff,0xcf,0xcd,0xc9,0xff,0xce,0xcd,0xc8,0xff,0xd4,0xd3,0xcf,0xff,0xe0,0xe0,0xde,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdd,0xdc,0xda,0xff,0xd0,0xcf,0xca,0xff,0xcb,0xca,0xc5,0xff,0xcd,0xcc,0xc7,0xff,0xd5,0xd3,0xd0,0xff,0xca,0xd7,0xc0,0xff,0xa5,0xcd,0x8b,0xff,0xbc,0xd7,0xaa,0xff,0xca,0xd6,0xbe,0xff,0xd0,0xce,0xca,0xff,0xce,0xcc,0xc8,0xff,0xcf,0xce,0xc9,0xff,0xd0,0xcf,0xca,0xff,0xe0,0xe0,0xde,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xde,0xdd,0xdb,0xff,0xd2,0xd1,0xcd,0xff,0xcd,0xcc,0xc8,0xff,0xd2,0xd0,0xcc,0xff,0xbd,0xd7,0xaa,0xff,0x6e,0xbf,0x3c,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x84,0xc7,0x5a,0xff,0xcb,0xd7,0xbf,0xff,0xcb,0xc9,0xc4,0xff,0xcf,0xce,0xc9,0xff,0xd2,0xd1,0xcd,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd7,0xd6,0xd2,0xff,0xcf,0xce,0xc9,0xff,0xcf,0xce,0xc9,0xff,0xab,0xd3,0x90,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x58,0xb6,0x1e,0xff,0xce,0xd9,0xc2,0xff,0xca,0xc9,0xc4,0xff,0xd2,0xd0,0xcc,0xff,0xda,0xda,0xd7,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xde,0xdc,0xff,0xd0,0xcf,0xca,0xff,0xcc,0xcb,0xc6,0xff,0xcd,0xda,0xc2,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x63,0xbb,0x2d,0xff,0xd5,0xd3,0xd0,0xff,0xcb,0xc9,0xc4,0xff,0xd6,0xd5,0xd1,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd9,0xd9,0xd6,0xff,0xcb,0xca,0xc5,0xff,0xcd,0xcb,0xc7,0xff,0x84,0xc7,0x5a,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0xbd,0xd7,0xaa,0xff,0xcb,0xca,0xc5,0xff,0xcc,0xca,0xc5,0xff,0xdf,0xdf,0xdc,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd6,0xd5,0xd1,0xff,0xce,0xcc,0xc8,0xff,0xd5,0xd4,0xd0,0xff,0x63,0xbb,0x2d,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x8f,0xcc,0x6a,0xff,0xcc,0xca,0xc6,0xff,0xce,0xcc,0xc8,0xff,0xdb,0xdb,0xd8,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd7,0xd3,0xff,0xce,0xcc,0xc8,0xff,0xdb,0xda,0xd7,0xff,0x58,0xb6,0x1e,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x84,0xc8,0x5b,0xff,0xd0,0xcf,0xcb,0xff,0xd1,0xcf,0xcb,0xff,0xda,0xda,0xd7,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd6,0xd6,0xd2,0xff,0xcf,0xcd,0xc9,0xff,0xd5,0xd3,0xd0,0xff,0x58,0xb6,0x1e,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x8f,0xcc,0x6a,0xff,0xcc,0xca,0xc6,0xff,0xd0,0xce,0xca,0xff,0xdd,0xdd,0xda,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd9,0xd8,0xd4,0xff,0xcb,0xca,0xc5,0xff,0xd0,0xce,0xc9,0xff,0x97,0xcd,0x76,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0xbd,0xd7,0xab,0xff,0xcd,0xcc,0xc7,0xff,0xcc,0xcb,0xc6,0xff,0xe0,0xe0,0xde,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe0,0xe0,0xde,0xff,0xd1,0xcf,0xcb,0xff,0xca,0xc9,0xc4,0xff,0xd3,0xd9,0xcb,0xff,0x4d,0xb2,0x0f,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x58,0xb7,0x1e,0xff,0xd8,0xd6,0xd4,0xff,0xcb,0xca,0xc5,0xff,0xd5,0xd4,0xd0,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd9,0xd9,0xd5,0xff,0xce,0xcd,0xc9,0xff,0xce,0xcd,0xc8,0xff,0xb3,0xd4,0x9d,0xff,0x4d,0xb2,0x0f,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x58,0xb7,0x1e,0xff,0xca,0xd6,0xbe,0xff,0xca,0xc9,0xc4,0xff,0xd0,0xce,0xca,0xff,0xdb,0xdb,0xd8,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xdf,0xdd,0xff,0xd1,0xd0,0xcc,0xff,0xcb,0xca,0xc5,0xff,0xce,0xcd,0xc8,0xff,0xcc,0xd9,0xc2,0xff,0x6e,0xbf,0x3d,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x42,0xae,0x00,0xff,0x4d,0xb2,0x0f,0xff,0x98,0xce,0x76,0xff,0xd1,0xd6,0xc9,0xff,0xcd,0xcc,0xc7,0xff,0xcf,0xcd,0xc9,0xff,0xd7,0xd7,0xd3,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xde,0xdc,0xff,0xd2,0xd1,0xcd,0xff,0xca,0xc9,0xc4,0xff,0xd0,0xce,0xca,0xff,0xd0,0xce,0xca,0xff,0xd3,0xd9,0xcc,0xff,0xb7,0xd1,0xa4,0xff,0xc2,0xd6,0xb4,0xff,0xd0,0xd7,0xc9,0xff,0xcf,0xcd,0xc9,0xff,0xcd,0xcc,0xc7,0xff,0xcf,0xce,0xc9,0xff,0xd3,0xd2,0xcd,0xff,0xe0,0xe0,0xde,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdf,0xde,0xdc,0xff,0xd6,0xd6,0xd2,0xff,0xcb,0xca,0xc5,0xff,0xcf,0xcd,0xc9,0xff,0xce,0xcc,0xc8,0xff,0xcd,0xcc,0xc7,0xff,0xcc,0xca,0xc5,0xff,0xcc,0xcb,0xc6,0xff,0xd1,0xcf,0xcb,0xff,0xd0,0xcf,0xcb,0xff,0xd6,0xd6,0xd2,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xdd,0xdd,0xdb,0xff,0xd6,0xd5,0xd1,0xff,0xd5,0xd4,0xd0,0xff,0xd1,0xcf,0xcb,0xff,0xcd,0xcc,0xc7,0xff,0xd5,0xd4,0xd0,0xff,0xd8,0xd8,0xd4,0xff,0xe0,0xe0,0xde,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xdc,0xdc,0xd9,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xe1,0xe1,0xdf,0xff,0xd8,0xd8,0xd5,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xff,0xd4,0xd4,0xd0,0xbf,
-    0x00,0x00,0x00,0x00,0xc7,0xc8,0xc4,0xff,0xc7,0xc8,0xc4,0xff,0xc7,0xc8,0xc4,0xff,0xd2,0xd3,0xcf,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xda,0xda,0xd6,0xff,0xcf,0xd0,0xcc,0xff,0xc7,0xc8,0xc4,0xff,0xc7,0xc8,0xc4,0xff,0xc7,0xc8,0xc4,0xbf,
-    0x00,0x00,0x00,0x00,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xb8,0xb8,0xb3,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xc5,0xc3,0xbd,0xff,0xaf,0xb0,0xac,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa1,0xa4,0xa1,0xbf,
-    0x00,0x00,0x00,0x00,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xaf,0xaf,0xaf,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xa9,0xab,0xa9,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa1,0xa4,0xa1,0xbf,
-    0x00,0x00,0x00,0x00,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xaf,0xaf,0xaf,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xa9,0xab,0xa9,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa1,0xa4,0xa1,0xbf,
-    0x00,0x00,0x00,0x00,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xaf,0xaf,0xaf,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xa9,0xab,0xa9,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa1,0xa4,0xa1,0xbf,
-    0x00,0x00,0x00,0x00,0xa3,0xa5,0xa3,0x7f,0xa1,0xa5,0xa1,0xdf,0xa2,0xa5,0xa2,0xff,0xa5,0xa8,0xa5,0xff,0xa7,0xa9,0xa7,0xff,0xa7,0xa9,0xa7,0xff,0xab,0xad,0xab,0x8f,0xb6,0xb6,0xb6,0x3f,0xb6,0xb6,0xb6,0x3f,0xb6,0xb6,0xb6,0x3f,0xb6,0xb6,0xb6,0x3f,0xae,0xb1,0xae,0x5f,0xa7,0xa9,0xa7,0xff,0xa7,0xa9,0xa7,0xff,0xa7,0xa9,0xa7,0xff,0xa7,0xa9,0xa7,0xff,0xa7,0xa9,0xa7,0xff,0xa7,0xa9,0xa7,0xff,0xad,0xaf,0xad,0x7f,0xb6,0xb6,0xb6,0x3f,0xb6,0xb6,0xb6,0x3f,0xb6,0xb6,0xb6,0x3f,0xb6,0xb6,0xb6,0x3f,0xaa,0xac,0xaa,0xaf,0xa7,0xa9,0xa7,0xff,0xa7,0xa9,0xa7,0xff,0xa3,0xa6,0xa3,0xff,0xa2,0xa5,0xa2,0xff,0xa1,0xa4,0xa1,0xbf,0xa2,0xa6,0xa2,0x3f,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xa2,0x9f,0x60,0xa3,0xa4,0xa3,0xbf,0xa3,0xa4,0xa3,0xbf,0xa3,0xa4,0xa3,0xbf,0x9f,0x9f,0x9f,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa2,0xa5,0xa2,0xef,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0xa2,0xa5,0xa2,0xff,0x9f,0x9f,0x9f,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xa3,0x9f,0x80,0xa3,0xa4,0xa3,0xbf,0xa3,0xa4,0xa3,0xbf,0xa2,0xa5,0xa2,0xaf,0xa2,0xa6,0xa2,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0x9f,0x9f,0x10,0x9a,0x9a,0x9f,0x30,0x93,0x93,0x95,0xdf,0x93,0x95,0x95,0xaf,0xa4,0xa4,0xa4,0x1f,0xa4,0xa4,0xa4,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x07,0x00,0xf8,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0x45,0x4a,0x55,0xe0,0x7b,0xe0,0x03,0xef,0x03,0xe0,0x03,0xef,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x04,0xe8,0x05,0x4a,0x05,0x4a,0x05,0x4a,0x55,0xe8,0x43,0x6c,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x15,0x66,0x06,0xc6,0x04,0x66,0x06,0xe8,0x45,0xe0,0x45,0xe8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x15,0xc6,0x04,0x45,0x05,0x4a,0x05,0x45,0x05,0x4a,0x05,0x08,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x0d,0xa9,0x25,0xa9,0x25,0xa9,0x05,0xa9,0x25,0xa9,0x25,0x29,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x0d,0x4a,0x1d,0xe8,0x05,0xe8,0x04,0xe8,0x04,0xe8,0x25,0x27,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x86,0x05,0x86,0x05,0x86,0x1d,0x86,0x05,0x47,0x05,0xc7,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x05,0x08,0x15,0x86,0x05,0x05,0x05,0xc8,0x15,0x08,0x05,0x07,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x87,0x05,0x48,0x05,0x48,0x15,0x48,0x05,0x48,0x15,0x67,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x26,0x05,0xe7,0x14,0x87,0x05,0x29,0x05,0x87,0x15,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0xa6,0x05,0x48,0x05,0xa6,0x05,0xe8,0x04,0x48,0x15,0x47,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x68,0x15,0xe8,0x04,0x68,0x05,0x68,0x05,0x68,0x15,0x48,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x48,0x05,0xa7,0x05,0x48,0x05,0xa7,0x05,0x27,0x0d,0x48,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x68,0x0d,0x6a,0x0d,0x48,0x0d,0x47,0x05,0x68,0x0d,0x89,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x28,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x88,0x0d,0xa8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x47,0x05,0xa7,0x0d,0xa9,0x0d,0x49,0x05,0x47,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0xc8,0x0d,0x68,0x0d,0x68,0x05,0x68,0x0d,0x88,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x68,0x05,0x88,0x05,0x88,0x05,0x48,0x05,0x88,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x88,0x05,0x68,0x05,0x68,0x05,0x48,0x0d,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x05,0x88,0x0d,0x67,0x05,0x68,0x05,0x27,0x05,0x88,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x48,0x05,0x48,0x05,0x88,0x05,0x88,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x0d,0x68,0x0d,0x68,0x05,0x48,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x48,0x05,0x47,0x05,0x48,0x05,0x87,0x05,0x87,0x0d,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x0d,0x67,0x0d,0x68,0x0d,0x68,0x05,0x67,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x0d,0x69,0x05,0x68,0x05,0x68,0x0d,0x68,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x87,0x05,0x88,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x88,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x88,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x48,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x48,0x05,0x67,0x05,0x48,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x48,0x05,0x47,0x05,0x68,0x05,0x48,0x05,0x48,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x88,0x05,0x88,0x05,0x48,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x67,0x05,0x67,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x47,0x05,0x88,0x05,0x88,0x05,0x48,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x88,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x88,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x88,0x05,0x88,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x48,0x05,0x48,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x88,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x67,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x05,0x68,0x05,0x68,0x05,0x67,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb1,0x75,0xb4,0x9d,0xb4,0x9d,0xb4,0x9d,0xb4,0x9d,0xb4,0x9d,0xb1,0x6d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0xbd,0x18,0xbe,0x59,0xc6,0x59,0xc6,0x39,0xc6,0xf7,0xbd,0xd7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xbd,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0xd7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xbd,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0xd7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xbd,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0xd7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0xbd,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x59,0xc6,0x38,0xc6,0xd7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xba,0xce,0xba,0xce,0xba,0xce,0xba,0xce,0x30,0x84,0xd7,0xbd,0xd7,0xbd,0x18,0xbe,0x18,0xc6,0x18,0xbe,0xd7,0xbd,0x75,0xad,0x14,0x9d,0xba,0xce,0xba,0xce,0xba,0xce,0x9a,0xce,0xba,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9a,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x59,0xc6,0x18,0xbe,0xf7,0xbd,0xf7,0xbd,0xf7,0xbd,0xf7,0xbd,0xf7,0xbd,0x18,0xbe,0x9a,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xba,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xba,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xce,0x00,0x00,
+    0x00,0x00,0x9a,0xce,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x79,0xce,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0x9a,0xce,0x9a,0xce,0x79,0xce,0x59,0xc6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0x9a,0xce,0x79,0xc6,0x79,0xce,0x79,0xce,0x79,0xc6,0x59,0xc6,0x59,0xc6,0x79,0xce,0x79,0xce,0x9a,0xce,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0x7a,0xce,0x59,0xc6,0x79,0xc6,0x9a,0xd6,0xb9,0xc6,0x74,0x8e,0xb7,0xae,0xb9,0xbe,0x7a,0xce,0x79,0xce,0x79,0xce,0x7a,0xce,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0x9a,0xce,0x79,0xce,0x9a,0xce,0xb7,0xae,0xed,0x3d,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x30,0x5e,0xb9,0xbe,0x59,0xc6,0x79,0xce,0x9a,0xce,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xba,0xd6,0x79,0xce,0x79,0xce,0x95,0x96,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0xab,0x1d,0xd9,0xc6,0x59,0xc6,0x9a,0xce,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0x7a,0xce,0x59,0xc6,0xd9,0xc6,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0xcc,0x2d,0x9a,0xd6,0x59,0xc6,0xba,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0x59,0xc6,0x59,0xc6,0x30,0x5e,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0xb7,0xae,0x59,0xc6,0x59,0xc6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0xba,0xd6,0x79,0xce,0xba,0xd6,0xcc,0x2d,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x71,0x6e,0x59,0xc6,0x79,0xce,0xdb,0xde,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0xbb,0xd6,0x79,0xce,0xdb,0xd6,0xab,0x1d,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x50,0x5e,0x7a,0xce,0x7a,0xce,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0xba,0xd6,0x79,0xce,0x9a,0xd6,0xab,0x1d,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x71,0x6e,0x59,0xc6,0x7a,0xce,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0x59,0xc6,0x7a,0xce,0x72,0x76,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0xb7,0xae,0x79,0xc6,0x59,0xc6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x7a,0xce,0x59,0xc6,0xda,0xce,0x89,0x0d,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0xab,0x1d,0xbb,0xd6,0x59,0xc6,0xba,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0x79,0xce,0x79,0xce,0xb6,0x9e,0x89,0x0d,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0x68,0x05,0xab,0x1d,0xb9,0xbe,0x59,0xc6,0x7a,0xce,0xdb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0x9a,0xce,0x59,0xc6,0x79,0xce,0xd9,0xc6,0xed,0x3d,0x68,0x05,0x68,0x05,0x68,0x05,0x89,0x0d,0x73,0x76,0xba,0xce,0x79,0xc6,0x79,0xce,0xba,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0x9a,0xce,0x59,0xc6,0x7a,0xce,0x7a,0xce,0xda,0xce,0x96,0xa6,0xb8,0xb6,0xba,0xce,0x79,0xce,0x79,0xc6,0x79,0xce,0x9a,0xce,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0xba,0xd6,0x59,0xc6,0x79,0xce,0x79,0xce,0x79,0xc6,0x59,0xc6,0x59,0xc6,0x7a,0xce,0x7a,0xce,0xba,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xfb,0xde,0xba,0xd6,0xba,0xd6,0x7a,0xce,0x79,0xc6,0xba,0xd6,0xdb,0xd6,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0xba,0xd6,0xba,0xd6,0xba,0xd6,0xfb,0xde,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0xdb,0xd6,0xba,0xd6,0xba,0xd6,0xba,0xd6,
+    0x00,0x00,0x58,0xc6,0x58,0xc6,0x58,0xc6,0x9a,0xce,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0x99,0xce,0x58,0xc6,0x58,0xc6,0x58,0xc6,
+    0x00,0x00,0x34,0xa5,0x34,0xa5,0x34,0xa5,0xd7,0xb5,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x18,0xbe,0x95,0xad,0x34,0xa5,0x34,0xa5,0x34,0xa5,
+    0x00,0x00,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x75,0xad,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x55,0xad,0x34,0xa5,0x34,0xa5,0x34,0xa5,
+    0x00,0x00,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x75,0xad,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x55,0xad,0x34,0xa5,0x34,0xa5,0x34,0xa5,
+    0x00,0x00,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x75,0xad,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x55,0xad,0x34,0xa5,0x34,0xa5,0x34,0xa5,
+    0x00,0x00,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x54,0xa5,0x54,0xa5,0x54,0xa5,0x75,0xad,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x95,0xad,0x54,0xa5,0x54,0xa5,0x54,0xa5,0x54,0xa5,0x54,0xa5,0x54,0xa5,0x75,0xad,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0xb6,0xb5,0x75,0xad,0x54,0xa5,0x54,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x9d,0x34,0xa5,0x34,0xa5,0x34,0xa5,0xf3,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0xf3,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x9d,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x34,0xa5,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0x9c,0xd3,0x9c,0x92,0x94,0xb2,0x94,0x34,0xa5,0x34,0xa5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x03,0x02,0x02,0x02,0x02,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x04,0x03,0x03,0x03,0x04,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x05,0x05,0x05,0x04,0x04,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x05,0x06,0x06,0x06,0x06,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x07,0x07,0x07,0x07,0x07,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x09,0x08,0x08,0x08,0x08,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x0a,0x0a,0x0a,0x0a,0x09,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x0b,0x0a,0x0b,0x0b,0x0b,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x0d,0x0c,0x0c,0x0c,0x0c,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x0e,0x0d,0x0d,0x0e,0x0d,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x0e,0x0f,0x0e,0x10,0x0f,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x10,0x10,0x10,0x10,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x12,0x11,0x12,0x11,0x11,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x13,0x13,0x12,0x12,0x13,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x14,0x13,0x13,0x13,0x14,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x15,0x15,0x15,0x15,0x15,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x16,0x16,0x16,0x16,0x17,0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x3b,0x2d,0x17,0x3a,0x28,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0x20,0x54,0x4c,0x43,0x18,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x1a,0x22,0x2b,0x1a,0x1a,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0x1c,0x1b,0x1b,0x1b,0x1b,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x1c,0x1c,0x1c,0x1c,0x1c,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x1e,0x1e,0x1e,0x1d,0x1d,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x1f,0x1f,0x1f,0x1f,0x1f,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x20,0x20,0x20,0x20,0x20,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x21,0x21,0x22,0x22,0x22,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0x5a,0x2e,0x22,0x43,0x38,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x70,0xbd,0x5a,0xb2,0x3a,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x25,0x5b,0x9e,0x3a,0x25,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x27,0x26,0x26,0x27,0x27,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x28,0x27,0x28,0x27,0x28,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x29,0x29,0x29,0x29,0x29,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x2b,0x2a,0x2a,0x2a,0x2a,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x53,0x2b,0x2b,0x38,0x45,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8b,0x88,0xe5,0x95,0xe5,0x54,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8e,0x2e,0x48,0x97,0x3b,0x2e,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x2f,0x30,0x30,0x30,0x30,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0x31,0x30,0x30,0x31,0x31,0x6a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x98,0x32,0x32,0x32,0x32,0x32,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcc,0x99,0x99,0x99,0x98,0x98,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x60,0x60,0x60,0x60,0xff,0xff,0xff,0xff,0xff,0xff,0xcf,0x60,0x60,0x60,0x60,0x50,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x80,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,0x5f,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x20,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,0x00,0x00,0x00,
+    0x00,0x00,0x20,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,0x00,0x00,
+    0x00,0x00,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x70,0x00,
+    0x00,0x40,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x10,
+    0x00,0x9f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,
+    0x00,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,
+    0x00,0x7f,0xdf,0xff,0xff,0xff,0xff,0x8f,0x3f,0x3f,0x3f,0x3f,0x5f,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,0x3f,0x3f,0x3f,0x3f,0xaf,0xff,0xff,0xff,0xff,0xbf,0x3f,
+    0x00,0x00,0x00,0x60,0xbf,0xbf,0xbf,0x40,0x00,0x00,0x00,0x00,0x00,0xef,0xff,0xff,0xff,0xff,0xff,0x10,0x00,0x00,0x00,0x00,0x80,0xbf,0xbf,0xaf,0x3f,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x30,0xdf,0xaf,0x1f,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 };
 
 const lv_image_dsc_t img_monitor_extruder_filled_load = {
   .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.cf = LV_COLOR_FORMAT_ARGB8888,
+  .header.cf = LV_COLOR_FORMAT_RGB565A8,
   .header.flags = 0,
   .header.w = 31,
   .header.h = 86,
-  .header.stride = 124,
+  .header.stride = 62,
   .data_size = sizeof(img_monitor_extruder_filled_load_map),
   .data = img_monitor_extruder_filled_load_map,
 };
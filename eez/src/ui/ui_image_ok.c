@@ -24,71 +24,122 @@
 #define LV_ATTRIBUTE_IMG_OK
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 10000 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_OK
 uint8_t img_ok_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xfc,0xfa,0x06,0xf7,0xfa,0xf8,0x1d,0xf9,0xfb,0xfa,0x4e,0xfb,0xfd,0xfc,0x82,0xfb,0xfc,0xfc,0xb4,0xfc,0xfd,0xfd,0xca,0xf9,0xfb,0xfa,0xf0,0xf8,0xfb,0xf9,0xf8,0xf9,0xfb,0xfa,0xdb,0xfc,0xfd,0xfd,0xc7,0xfc,0xfd,0xfd,0xc6,0xfc,0xfd,0xfd,0xbf,0xfa,0xfc,0xfb,0x8c,0xfb,0xfc,0xfc,0x55,0xf8,0xfa,0xf9,0x2a,0xf9,0xfc,0xfa,0x08,0xf0,0xf6,0xf1,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xf8,0xf4,0x02,0xfb,0xfd,0xfc,0x19,0xfc,0xfd,0xfd,0x6c,0xfc,0xfd,0xfd,0xbe,0xfc,0xfd,0xfd,0xef,0xfc,0xfd,0xfd,0xfb,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfb,0xfc,0xfd,0xfd,0xf4,0xfb,0xfd,0xfc,0xd1,0xfa,0xfc,0xfb,0x79,0xfc,0xfd,0xfd,0x24,0xf9,0xfb,0xfa,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfb,0xf9,0x02,0xfb,0xfd,0xfc,0x28,0xf9,0xfb,0xfa,0x8d,0xfc,0xfd,0xfd,0xe6,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xee,0xfa,0xfc,0xfb,0x9b,0xf6,0xfa,0xf7,0x37,0xf9,0xfb,0xfa,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf6,0xf9,0xf7,0x15,0xfb,0xfd,0xfc,0x82,0xfc,0xfd,0xfd,0xec,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfb,0xfd,0xfc,0xf3,0xfb,0xfd,0xfc,0x9f,0xf8,0xfb,0xf9,0x1f,0xf3,0xf7,0xf4,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xfa,0xf8,0x03,0xfb,0xfc,0xfc,0x43,0xfc,0xfd,0xfd,0xd1,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfb,0xfd,0xfc,0xe0,0xf9,0xfb,0xfa,0x5f,0xf9,0xfb,0xfa,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xfc,0xfb,0x0b,0xfa,0xfc,0xfb,0x78,0xfc,0xfd,0xfd,0xf0,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf9,0xfb,0xfc,0xfc,0x91,0xfb,0xfc,0xfc,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfd,0xfc,0x0f,0xfa,0xfc,0xfb,0x9d,0xfc,0xfd,0xfd,0xfb,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xac,0xf6,0xf9,0xf7,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xfc,0xfb,0x0f,0xfc,0xfd,0xfd,0xab,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xfa,0xfc,0xfb,0xbe,0xf7,0xfa,0xf8,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xfb,0xf9,0x06,0xfb,0xfc,0xfb,0x98,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xae,0xfb,0xfc,0xfc,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfa,0xf8,0x02,0xfa,0xfd,0xfb,0x70,0xfc,0xfd,0xfd,0xfa,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xfb,0xfc,0xfc,0x90,0xf9,0xfb,0xfa,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xfc,0xfb,0x40,0xfc,0xfd,0xfd,0xf0,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf9,0xfa,0xfc,0xfb,0x62,0xf5,0xf9,0xf6,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf6,0xf9,0xf7,0x10,0xfb,0xfd,0xfc,0xcc,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xe0,0xf8,0xfb,0xf9,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfb,0xf9,0x02,0xfc,0xfd,0xfd,0x79,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfb,0xfc,0xfc,0x9f,0xf9,0xfc,0xfa,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf6,0xfa,0xf7,0x21,0xfc,0xfd,0xfd,0xe5,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf9,0xf8,0xfb,0xf9,0xb7,0xf9,0xfb,0xfa,0xd5,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf5,0xfc,0xfd,0xfd,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xf8,0xfa,0xf8,0x02,0xfb,0xfc,0xfc,0x81,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xf9,0xfb,0xfa,0x8e,0xef,0xf6,0xf0,0x08,0xe3,0xed,0xe4,0x15,0xf6,0xfa,0xf7,0x90,0xfa,0xfc,0xfb,0xf7,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfb,0xfc,0xfc,0xa8,0xf6,0xf9,0xf7,0x04,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xf9,0xfb,0xfa,0x14,0xfc,0xfd,0xfd,0xe1,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfa,0xfc,0xfb,0xca,0xee,0xf5,0xef,0x13,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x0c,0xf8,0xfb,0xf8,0x13,0xef,0xf6,0xf0,0x63,0xfa,0xfc,0xfb,0xef,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf2,0xfc,0xfd,0xfd,0x29,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xfc,0xfd,0xfd,0x5d,0xfc,0xfd,0xfd,0xfc,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xee,0xf8,0xfb,0xf9,0x37,0xfe,0xfe,0xfe,0x03,0xff,0xff,0xff,0x0e,0xff,0xff,0xff,0x16,0xff,0xff,0xff,0x19,0xf3,0xf8,0xf3,0x12,0xf2,0xf7,0xf2,0xc2,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0x85,0xfb,0xfd,0xfc,0x01,
-    0xfb,0xfc,0xfc,0x04,0xfc,0xfd,0xfd,0xae,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfb,0xfa,0xfc,0xfb,0x6f,0xf3,0xf8,0xf3,0x02,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x0f,0xff,0xff,0xff,0x0e,0xe8,0xf1,0xe9,0x33,0xf9,0xfc,0xfa,0xec,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xd1,0xfb,0xfc,0xfc,0x0c,
-    0xfa,0xfc,0xfb,0x14,0xfc,0xfd,0xfd,0xe7,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfa,0xfc,0xfb,0xb9,0xf3,0xf7,0xf4,0x0c,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x07,0xef,0xf6,0xef,0x0e,0xf6,0xf9,0xf7,0xb9,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf7,0xf8,0xfa,0xf9,0x2c,
-    0xfa,0xfc,0xfb,0x40,0xfc,0xfd,0xfd,0xf9,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xe6,0xfa,0xfb,0xfb,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x05,0xf1,0xf7,0xf1,0x04,0xf1,0xf7,0xf2,0x71,0xfb,0xfd,0xfc,0xfb,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xf9,0xfb,0xfa,0x6b,
-    0xfb,0xfc,0xfc,0x70,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfa,0xfb,0xfc,0xfc,0x65,0xf4,0xf8,0xf5,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xfe,0xfe,0xfe,0x01,0xf2,0xf7,0xf2,0x2a,0xfa,0xfc,0xfb,0xe8,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfb,0xfc,0xfc,0x93,
-    0xfb,0xfc,0xfc,0x98,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xae,0xfc,0xfd,0xfd,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe9,0xf2,0xe9,0x09,0xf8,0xfb,0xf9,0xb3,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfb,0xfd,0xfc,0xc4,
-    0xfc,0xfd,0xfd,0xc4,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xe2,0xf6,0xf9,0xf7,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xf8,0xf3,0x01,0xf8,0xfa,0xf9,0x65,0xfc,0xfd,0xfd,0xfa,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfb,0xfc,0xfc,0xe2,
-    0xfc,0xfd,0xfd,0xc6,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf9,0xf9,0xfb,0xfa,0x61,0xf5,0xf9,0xf6,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfb,0xf9,0x28,0xfb,0xfd,0xfc,0xe3,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfa,0xfc,0xfb,0xfa,
-    0xfc,0xfd,0xfd,0xc6,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xf7,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfb,0xfc,0xfc,0xa1,0xf7,0xfa,0xf8,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfb,0xf9,0x09,0xfb,0xfc,0xfc,0xb2,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xf9,0xfb,0xfa,0xfc,
-    0xfc,0xfd,0xfd,0xc6,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfa,0xfb,0xfc,0xfc,0x86,0xf7,0xfa,0xf8,0x2c,0xfa,0xfc,0xfb,0x9d,0xfc,0xfd,0xfd,0xfc,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfb,0xfd,0xfc,0xdf,0xf8,0xfb,0xf9,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe9,0xf2,0xea,0x02,0xf7,0xfa,0xf8,0x6e,0xfc,0xfd,0xfd,0xfb,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xf9,0xfb,0xfa,0xfc,
-    0xfc,0xfd,0xfd,0xc6,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfa,0xfc,0xfd,0xfd,0x80,0xfc,0xfd,0xfd,0x05,0x00,0x00,0x00,0x00,0xfa,0xfd,0xfb,0x09,0xfc,0xfd,0xfd,0x97,0xfc,0xfd,0xfd,0xfc,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf7,0xfa,0xfc,0xfb,0x54,0xf7,0xfa,0xf8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xf8,0xf4,0x2d,0xfc,0xfd,0xfd,0xe8,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfa,0xfc,0xfb,0xfa,
-    0xfc,0xfd,0xfd,0xc4,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfb,0xfc,0xfc,0x91,0xfb,0xfd,0xfc,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfd,0xfc,0x0a,0xfc,0xfd,0xfd,0x96,0xfc,0xfd,0xfd,0xfc,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfb,0xfc,0xfc,0xa2,0xf4,0xf7,0xf5,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xec,0xf3,0xed,0x0d,0xf9,0xfb,0xfa,0xbb,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfb,0xfd,0xfc,0xd6,
-    0xfc,0xfd,0xfd,0x97,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfb,0xf5,0xf9,0xf6,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfd,0xfd,0x09,0xfc,0xfd,0xfd,0x96,0xfc,0xfd,0xfd,0xfc,0xfc,0xfd,0xfd,0xff,0xfb,0xfc,0xfc,0xd9,0xf9,0xfb,0xfa,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xed,0xf4,0xee,0x02,0xf9,0xfb,0xfa,0x72,0xfc,0xfd,0xfd,0xfb,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xc0,
-    0xfc,0xfd,0xfd,0x6e,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xbf,0xfb,0xfc,0xfc,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfd,0xfd,0x09,0xfa,0xfc,0xfb,0x96,0xfb,0xfd,0xfc,0xf3,0xf8,0xfb,0xf9,0x4d,0xed,0xf4,0xee,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xf8,0xf4,0x34,0xfc,0xfd,0xfd,0xee,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0x90,
-    0xfa,0xfc,0xfb,0x3f,0xfc,0xfd,0xfd,0xf9,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfb,0xfc,0xfc,0xbd,0xf0,0xf6,0xf1,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0xf6,0xf0,0x08,0xf5,0xf9,0xf6,0x43,0xfa,0xfc,0xfb,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0xf8,0xf5,0x0c,0xfb,0xfc,0xfc,0xbd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xf9,0xfb,0xfa,0x6a,
-    0xfb,0xfc,0xfc,0x14,0xfc,0xfd,0xfd,0xe7,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xf7,0xfa,0xf8,0xba,0xec,0xf4,0xed,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xfa,0xf8,0x02,0xf9,0xfb,0xfa,0x7c,0xfc,0xfd,0xfd,0xfc,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf6,0xf8,0xfa,0xf9,0x29,
-    0xfb,0xfd,0xfc,0x05,0xfc,0xfd,0xfd,0xb1,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xf7,0xfa,0xf8,0xb7,0xec,0xf4,0xed,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfb,0xf9,0x35,0xfb,0xfd,0xfc,0xeb,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xce,0xfa,0xfc,0xfb,0x09,
-    0x00,0x00,0x00,0x00,0xfc,0xfd,0xfd,0x5d,0xfc,0xfd,0xfd,0xfc,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xf8,0xfb,0xf9,0xb5,0xec,0xf4,0xed,0x15,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf6,0xfa,0xf7,0x10,0xfa,0xfc,0xfb,0xc5,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0x86,0xfb,0xfc,0xfc,0x02,
-    0x00,0x00,0x00,0x00,0xf7,0xfa,0xf8,0x15,0xfc,0xfd,0xfd,0xe0,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xf6,0xfa,0xf7,0xb6,0xed,0xf4,0xee,0x17,0xfe,0xfe,0xfe,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf2,0xf6,0xf2,0x03,0xf7,0xfa,0xf7,0x85,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf3,0xfb,0xfd,0xfc,0x28,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xfa,0xfb,0xfb,0x02,0xfb,0xfc,0xfc,0x82,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xf8,0xfb,0xf9,0xbb,0xee,0xf5,0xef,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfc,0xfc,0x3e,0xfc,0xfd,0xfd,0xf1,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfb,0xfc,0xfc,0xaa,0xf6,0xf9,0xf7,0x05,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfa,0xf9,0x1f,0xfc,0xfd,0xfd,0xe3,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfa,0xfb,0xfb,0xbd,0xfb,0xfd,0xfc,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0xf8,0xf5,0x14,0xfb,0xfd,0xfc,0xcc,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf5,0xfc,0xfd,0xfd,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfd,0xfc,0x01,0xfc,0xfd,0xfd,0x78,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xc1,0xf6,0xf9,0xf7,0x3d,0xf3,0xf8,0xf4,0x29,0xf9,0xfb,0xf9,0xa7,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfb,0xfd,0xfc,0x9e,0xf9,0xfc,0xfa,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfb,0xf9,0x0f,0xfb,0xfc,0xfc,0xcb,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf8,0xfc,0xfd,0xfd,0xf6,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfb,0xfd,0xfc,0xe0,0xf8,0xfa,0xf9,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xfc,0xfb,0x41,0xfc,0xfd,0xfd,0xf0,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf9,0xfa,0xfc,0xfb,0x5f,0xf3,0xf8,0xf4,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xfb,0xfa,0x02,0xfb,0xfd,0xfc,0x6f,0xfc,0xfd,0xfd,0xfa,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xfb,0xfc,0xfc,0x8f,0xf9,0xfb,0xfa,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfd,0xfc,0x06,0xfa,0xfc,0xfb,0x90,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xb3,0xfb,0xfc,0xfc,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf6,0xf9,0xf7,0x0e,0xfb,0xfc,0xfc,0xa9,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfb,0xfc,0xfc,0xb8,0xfa,0xfc,0xfb,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf6,0xfa,0xf7,0x0e,0xfa,0xfc,0xfb,0x91,0xfc,0xfd,0xfd,0xfa,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xb3,0xfa,0xfc,0xfb,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfd,0xfc,0x06,0xfb,0xfc,0xfc,0x7a,0xfc,0xfd,0xfd,0xf2,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xf8,0xfb,0xfc,0xfc,0x8d,0xfb,0xfd,0xfc,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xfb,0xfa,0x03,0xfc,0xfd,0xfd,0x4a,0xfb,0xfd,0xfc,0xd2,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xdd,0xfb,0xfc,0xfc,0x56,0xfb,0xfc,0xfc,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfa,0xf9,0x14,0xfb,0xfd,0xfc,0x7d,0xfc,0xfd,0xfd,0xea,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xf1,0xfc,0xfd,0xfd,0x93,0xfb,0xfd,0xfc,0x1a,0xf9,0xfb,0xf9,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xfb,0xf8,0x02,0xfa,0xfc,0xfb,0x27,0xfb,0xfc,0xfc,0x8a,0xfc,0xfd,0xfd,0xe1,0xfc,0xfd,0xfd,0xfc,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfd,0xfc,0xfd,0xfd,0xed,0xfb,0xfd,0xfc,0x96,0xf9,0xfb,0xfa,0x33,0xfb,0xfc,0xfc,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xfb,0xfa,0x02,0xfc,0xfd,0xfd,0x18,0xfb,0xfc,0xfc,0x69,0xfc,0xfd,0xfd,0xbb,0xfc,0xfd,0xfd,0xec,0xfc,0xfd,0xfd,0xfa,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfd,0xfd,0xfe,0xfc,0xfd,0xfd,0xfb,0xfc,0xfd,0xfd,0xf0,0xfc,0xfd,0xfd,0xc6,0xfa,0xfc,0xfb,0x77,0xf8,0xfb,0xf9,0x23,0xfb,0xfc,0xfc,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xfc,0xfb,0x06,0xf8,0xfa,0xf9,0x19,0xfb,0xfc,0xfc,0x47,0xfc,0xfd,0xfd,0x7b,0xfc,0xfd,0xfd,0xa3,0xfc,0xfd,0xfd,0xc5,0xfb,0xfc,0xfc,0xd4,0xf9,0xfb,0xfa,0xf9,0xf9,0xfb,0xfa,0xfb,0xfb,0xfc,0xfc,0xdb,0xfc,0xfd,0xfd,0xc6,0xfb,0xfd,0xfc,0xab,0xfc,0xfd,0xfd,0x81,0xfa,0xfc,0xfb,0x50,0xf9,0xfb,0xfa,0x1e,0xfa,0xfc,0xfb,0x07,0xf1,0xf7,0xf2,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xde,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xbd,0xf7,0x7c,0xe7,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0x00,0x00,
+    0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0xef,0xff,0xff,0xff,0xff,0xdf,0xff,0xbd,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0xef,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xbe,0xf7,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9d,0xef,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xf7,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xde,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9d,0xef,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9d,0xef,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbd,0xef,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xbd,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbd,0xf7,0xde,0xf7,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0xbd,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0xbd,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xbd,0xef,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0xbd,0xef,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xf7,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xbd,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0xde,0xf7,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x1d,0x4e,0x82,0xb4,0xca,0xf0,0xf8,0xdb,0xc7,0xc6,0xbf,0x8c,0x55,0x2a,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x19,0x6c,0xbe,0xef,0xfb,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0xf4,0xd1,0x79,0x24,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x28,0x8d,0xe6,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xee,0x9b,0x37,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x82,0xec,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0x9f,0x1f,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x43,0xd1,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xe0,0x5f,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x78,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0x91,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x9d,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xac,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xab,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xbe,0x14,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x06,0x98,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xae,0x0e,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x02,0x70,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x90,0x05,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x40,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0x62,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x10,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x21,0x00,0x00,0x00,
+    0x00,0x00,0x02,0x79,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x9f,0x04,0x00,0x00,
+    0x00,0x00,0x21,0xe5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0xb7,0xd5,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf5,0x3a,0x00,0x00,
+    0x00,0x02,0x81,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x8e,0x08,0x15,0x90,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa8,0x04,0x00,
+    0x00,0x14,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xca,0x13,0x05,0x0c,0x13,0x63,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf2,0x29,0x00,
+    0x00,0x5d,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xee,0x37,0x03,0x0e,0x16,0x19,0x12,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x85,0x01,
+    0x04,0xae,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x6f,0x02,0x04,0x0b,0x0f,0x0e,0x33,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd1,0x0c,
+    0x14,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb9,0x0c,0x00,0x02,0x07,0x07,0x0e,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x2c,
+    0x40,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe6,0x27,0x00,0x00,0x02,0x05,0x04,0x71,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x6b,
+    0x70,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x65,0x01,0x00,0x00,0x01,0x01,0x2a,0xe8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x93,
+    0x98,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xae,0x09,0x00,0x00,0x00,0x00,0x09,0xb3,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc4,
+    0xc4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe2,0x24,0x00,0x00,0x00,0x00,0x01,0x65,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe2,
+    0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0x61,0x01,0x00,0x00,0x00,0x00,0x28,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,
+    0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xf7,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xa1,0x06,0x00,0x00,0x00,0x00,0x09,0xb2,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,
+    0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x86,0x2c,0x9d,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x21,0x00,0x00,0x00,0x00,0x02,0x6e,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,
+    0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x80,0x05,0x00,0x09,0x97,0xfc,0xff,0xff,0xff,0xff,0xf7,0x54,0x01,0x00,0x00,0x00,0x00,0x2d,0xe8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,
+    0xc4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x91,0x05,0x00,0x00,0x00,0x0a,0x96,0xfc,0xff,0xff,0xfe,0xa2,0x06,0x00,0x00,0x00,0x00,0x0d,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,
+    0x97,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x5a,0x00,0x00,0x00,0x00,0x00,0x09,0x96,0xfc,0xff,0xd9,0x1a,0x00,0x00,0x00,0x00,0x02,0x72,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,
+    0x6e,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,0x18,0x00,0x00,0x00,0x00,0x00,0x09,0x96,0xf3,0x4d,0x01,0x00,0x00,0x00,0x00,0x34,0xee,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x90,
+    0x3f,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xbd,0x18,0x00,0x00,0x00,0x00,0x00,0x08,0x43,0x04,0x00,0x00,0x00,0x00,0x0c,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x6a,
+    0x14,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xba,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x7c,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x29,
+    0x05,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xb7,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xeb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x09,
+    0x00,0x5d,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xb5,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x10,0xc5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x86,0x02,
+    0x00,0x15,0xe0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xb6,0x17,0x01,0x00,0x00,0x00,0x00,0x03,0x85,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0x28,0x00,
+    0x00,0x02,0x82,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xbb,0x17,0x00,0x00,0x00,0x00,0x3e,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xaa,0x05,0x00,
+    0x00,0x00,0x1f,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xbd,0x18,0x00,0x00,0x14,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf5,0x3a,0x00,0x00,
+    0x00,0x00,0x01,0x78,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xc1,0x3d,0x29,0xa7,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x9e,0x04,0x00,0x00,
+    0x00,0x00,0x00,0x0f,0xcb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xf6,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x21,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x41,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0x5f,0x01,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x02,0x6f,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x8f,0x05,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x06,0x90,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xb3,0x0e,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xa9,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xb8,0x16,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x91,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xb3,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x7a,0xf2,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x8d,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x4a,0xd2,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xdd,0x56,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x7d,0xea,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xf1,0x93,0x1a,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x27,0x8a,0xe1,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xed,0x96,0x33,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x18,0x69,0xbb,0xec,0xfa,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xfb,0xf0,0xc6,0x77,0x23,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x19,0x47,0x7b,0xa3,0xc5,0xd4,0xf9,0xfb,0xdb,0xc6,0xab,0x81,0x50,0x1e,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 };
 
 const lv_image_dsc_t img_ok = {
   .header = {
     .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_ARGB8888,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
     .flags = 0,
     .w = 50,
     .h = 50,
-    .stride = 200,
+    .stride = 100,
     .reserved_2 = 0,
   },
   .data_size = sizeof(img_ok_map),
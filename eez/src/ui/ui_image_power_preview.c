@@ -23,32 +23,34 @@
 #define LV_ATTRIBUTE_IMG_POWER_PREVIEW
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 576 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_POWER_PREVIEW
 uint8_t img_power_preview_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,
-    0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,
-    0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,
-    0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,
-    0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,
-    0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0xfb,0xfe,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xfb,0xfe,0xfc,0xff,
+    0x06,0x00,
+    0x26,0x40,
+    0x66,0x60,
+    0x46,0x20,
+    0xc6,0x30,
+    0x86,0x10,
+    0x80,0x10,
+    0xc0,0x30,
+    0x40,0x20,
+    0x60,0x60,
+    0x39,0xc0,
+    0x0f,0x00,
 
 };
 
 const lv_image_dsc_t img_power_preview = {
   .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.cf = LV_COLOR_FORMAT_ARGB8888,
+  .header.cf = LV_COLOR_FORMAT_I1,
   .header.flags = 0,
   .header.w = 12,
   .header.h = 12,
-  .header.stride = 48,
+  .header.stride = 2,
   .data_size = sizeof(img_power_preview_map),
   .data = img_power_preview_map,
 };
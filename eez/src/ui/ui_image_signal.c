@@ -24,45 +24,70 @@
 #define LV_ATTRIBUTE_IMG_SIGNAL
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 2400 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SIGNAL
 uint8_t img_signal_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x4a,0xfe,0xfe,0xfe,0xea,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xb4,0xff,0xff,0xff,0x1e,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x1f,0xfe,0xfe,0xfe,0xf7,0xfe,0xfe,0xfe,0x86,0xfe,0xfe,0xfe,0x40,0xfe,0xfe,0xfe,0xd6,0xfe,0xfe,0xfe,0xa9,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xee,0xff,0xff,0xff,0x04,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0x6f,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x3e,0xfe,0xfe,0xfe,0xb8,0xfe,0xfe,0xfe,0xc2,0xfe,0xfe,0xfe,0x62,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x2a,0xfe,0xfe,0xfe,0xf3,0xfe,0xfe,0xfe,0xa1,0xfe,0xfe,0xfe,0x88,0xfe,0xfe,0xfe,0xf8,0xfe,0xfe,0xfe,0x5d,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0x7b,0xfe,0xfe,0xfe,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xb7,0xfe,0xfe,0xfe,0xa9,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x38,0xfe,0xfe,0xfe,0x7a,0xfe,0xfe,0xfe,0x7a,0xff,0xff,0xff,0x28,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x3b,0xfe,0xfe,0xfe,0xfc,0xfe,0xfe,0xfe,0xc1,0xfe,0xfe,0xfe,0xd1,0xfe,0xfe,0xfe,0xf1,0xff,0xff,0xff,0x19,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xa6,0xfe,0xfe,0xfe,0xb9,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x08,0xfe,0xfe,0xfe,0xdb,0xfe,0xfe,0xfe,0x69,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xc1,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xc1,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x21,0xff,0xff,0xff,0x70,0xff,0xff,0xff,0x49,0xff,0xff,0xff,0x04,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xc1,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0xfe,0xfe,0xfe,0x45,0xfe,0xfe,0xfe,0xf9,0xfe,0xfe,0xfe,0xd8,0xfe,0xfe,0xfe,0xf6,0xfe,0xfe,0xfe,0xa4,0xff,0xff,0xff,0x03,0xfe,0xfe,0xfe,0xc1,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0xfe,0xfe,0xfe,0xc0,0xfe,0xfe,0xfe,0x9c,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x2d,0xfe,0xfe,0xfe,0xf9,0xff,0xff,0xff,0x2a,0xfe,0xfe,0xfe,0xc1,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0xfe,0xfe,0xfe,0xc2,0xff,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xeb,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xc1,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xad,0xfe,0xfe,0xfe,0xc1,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x70,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0xfe,0xfe,0xfe,0xc2,0xfe,0xfe,0xfe,0x6f,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x04,0xfe,0xfe,0xfe,0xee,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xba,0xfe,0xfe,0xfe,0xac,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xc3,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0x84,0xfe,0xfe,0xfe,0xc3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0xac,0xfe,0xfe,0xfe,0xba,0xff,0xff,0xff,0x47,0xfe,0xfe,0xfe,0xee,0xff,0xff,0xff,0x04,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0x6f,0xfe,0xfe,0xfe,0xc2,0x00,0x00,0x00,0x00,
-    0xfe,0xfe,0xfe,0xa9,0xfe,0xfe,0xfe,0xd6,0xfe,0xfe,0xfe,0x40,0xfe,0xfe,0xfe,0x86,0xfe,0xfe,0xfe,0xf7,0xff,0xff,0xff,0x1f,0xfe,0xfe,0xfe,0x6c,0xfe,0xfe,0xfe,0xf1,0xfe,0xfe,0xfe,0x4a,0xfe,0xfe,0xfe,0x63,0xfe,0xfe,0xfe,0xfd,0xff,0xff,0xff,0x45,0xff,0xff,0xff,0x45,0xfe,0xfe,0xfe,0xfd,0xfe,0xfe,0xfe,0x63,0xfe,0xfe,0xfe,0x4a,0xfe,0xfe,0xfe,0xf1,0xfe,0xfe,0xfe,0x6c,0xff,0xff,0xff,0x1f,0xfe,0xfe,0xfe,0xf7,0xfe,0xfe,0xfe,0x86,0xfe,0xfe,0xfe,0x40,0xfe,0xfe,0xfe,0xd6,0xfe,0xfe,0xfe,0xa9,0x00,0x00,0x00,0x00,
-    0xff,0xff,0xff,0x1e,0xfe,0xfe,0xfe,0xb4,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xea,0xff,0xff,0xff,0x4a,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x08,0xfe,0xfe,0xfe,0x95,0xfe,0xfe,0xfe,0xf6,0xfe,0xfe,0xfe,0xea,0xfe,0xfe,0xfe,0x7b,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xfe,0xfe,0xfe,0x7b,0xfe,0xfe,0xfe,0xea,0xfe,0xfe,0xfe,0xf6,0xfe,0xfe,0xfe,0x95,0xff,0xff,0xff,0x08,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x4a,0xfe,0xfe,0xfe,0xea,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xb4,0xff,0xff,0xff,0x1e,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x09,0xff,0xff,0xff,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x0b,0x01,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0xea,0xfe,0xb4,0x1e,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf7,0x86,0x40,0xd6,0xa9,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xee,0x04,0x00,0x6f,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xb8,0xc2,0x62,0x00,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2a,0xf3,0xa1,0x88,0xf8,0x5d,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0xc6,0x00,0x00,0xb7,0xa9,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x7a,0x7a,0x28,0x00,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0xfc,0xc1,0xd1,0xf1,0x19,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0xb9,0x00,0x08,0xdb,0x69,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xc1,0xad,0x00,0x00,0xad,0x84,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xc1,0xad,0x00,0x00,0xad,0x84,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x00,0x21,0x70,0x49,0x04,0x00,0xc1,0xad,0x00,0x00,0xad,0x84,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0x45,0xf9,0xd8,0xf6,0xa4,0x03,0xc1,0xad,0x00,0x00,0xad,0x84,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0xc0,0x9c,0x02,0x2d,0xf9,0x2a,0xc1,0xad,0x00,0x00,0xad,0x84,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0xc2,0x70,0x00,0x00,0xeb,0x47,0xc1,0xad,0x00,0x00,0xad,0x84,0x84,0xad,0x00,0x00,0xad,0xc1,0x47,0xeb,0x00,0x00,0x70,0xc2,
+    0xc2,0x6f,0x00,0x04,0xee,0x47,0xba,0xac,0x00,0x00,0xc3,0x84,0x84,0xc3,0x00,0x00,0xac,0xba,0x47,0xee,0x04,0x00,0x6f,0xc2,
+    0xa9,0xd6,0x40,0x86,0xf7,0x1f,0x6c,0xf1,0x4a,0x63,0xfd,0x45,0x45,0xfd,0x63,0x4a,0xf1,0x6c,0x1f,0xf7,0x86,0x40,0xd6,0xa9,
+    0x1e,0xb4,0xfe,0xea,0x4a,0x00,0x08,0x95,0xf6,0xea,0x7b,0x01,0x01,0x7b,0xea,0xf6,0x95,0x08,0x00,0x4a,0xea,0xfe,0xb4,0x1e,
+    0x00,0x01,0x0b,0x06,0x00,0x00,0x00,0x00,0x09,0x06,0x00,0x00,0x00,0x00,0x06,0x09,0x00,0x00,0x00,0x00,0x06,0x0b,0x01,0x00,
 
 };
 
 const lv_image_dsc_t img_signal = {
   .header = {
     .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_ARGB8888,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
     .flags = 0,
     .w = 24,
     .h = 24,
-    .stride = 100,
+    .stride = 48,
     .reserved_2 = 0,
   },
   .data_size = sizeof(img_signal_map),
@@ -24,63 +24,106 @@
 #define LV_ATTRIBUTE_IMG_SPOOL_CLEAN
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 5460 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SPOOL_CLEAN
 uint8_t img_spool_clean_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xb0,0xb0,0x1d,0xac,0xac,0xac,0x7e,0xab,0xab,0xab,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0x3f,0xab,0xab,0xab,0x80,0xae,0xae,0xae,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb1,0xb1,0xb1,0x0d,0xae,0xae,0xae,0xe5,0xc3,0xc3,0xc3,0xf9,0xb0,0xb0,0xb0,0xf8,0xad,0xad,0xad,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xab,0xab,0x40,0xaf,0xaf,0xaf,0xf8,0xc4,0xc4,0xc4,0xf9,0xae,0xae,0xae,0xf0,0xb1,0xb1,0xb1,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0xae,0xae,0x8e,0xbf,0xbf,0xbf,0xf7,0xf8,0xf8,0xf8,0xff,0xdf,0xdf,0xdf,0xff,0xae,0xae,0xae,0xef,0xb6,0xb6,0xb6,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x02,0xaf,0xaf,0xaf,0xde,0xd8,0xd8,0xd8,0xff,0xf8,0xf8,0xf8,0xff,0xc7,0xc7,0xc7,0xf8,0xaf,0xaf,0xaf,0xa9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0xb6,0xb6,0x07,0xae,0xae,0xae,0xf2,0xe7,0xe7,0xe7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb6,0xb6,0xb6,0xf5,0xac,0xac,0xac,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xab,0xab,0x46,0xb2,0xb2,0xb2,0xf6,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xed,0xed,0xed,0xff,0xae,0xae,0xae,0xfb,0xae,0xae,0xae,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0x51,0xb5,0xb5,0xb5,0xf5,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xcf,0xcf,0xcf,0xfe,0xaf,0xaf,0xaf,0xe1,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0xd4,0xb2,0xb2,0xb2,0xff,0xd3,0xd3,0xd3,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xbd,0xbd,0xbd,0xf4,0xac,0xac,0xac,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0x99,0xcd,0xcd,0xcd,0xfc,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xe1,0xe1,0xe1,0xff,0xac,0xac,0xac,0xff,0xac,0xac,0xac,0x90,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xad,0xad,0xad,0x88,0xac,0xac,0xac,0xbe,0xac,0xac,0xac,0xdf,0xad,0xad,0xad,0xfd,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xd4,0xd4,0xd4,0xff,0xaf,0xaf,0xaf,0xb5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xb0,0xb0,0xe1,0xe1,0xe1,0xe1,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xad,0xad,0xad,0xfe,0xac,0xac,0xac,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb2,0xb2,0xb2,0x2b,0xac,0xac,0xac,0xff,0xf0,0xf0,0xf0,0xff,0xf8,0xf8,0xf8,0xff,0xe8,0xe8,0xe8,0xff,0xad,0xad,0xad,0xf4,0x80,0x80,0x80,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb1,0xb1,0xb1,0x0d,0xad,0xad,0xad,0xfe,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb2,0xb2,0xb2,0xfc,0xad,0xad,0xad,0xaf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0xfd,0xd7,0xd7,0xd7,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xad,0xad,0xad,0xfc,0xaf,0xaf,0xaf,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xab,0xab,0x3a,0xb1,0xb1,0xb1,0xf6,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xbf,0xbf,0xbf,0xff,0xad,0xad,0xad,0xdc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0xea,0xc6,0xc6,0xc6,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb8,0xb8,0xb8,0xf3,0xad,0xad,0xad,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xab,0xab,0x67,0xbe,0xbe,0xbe,0xf4,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xcd,0xcd,0xcd,0xff,0xac,0xac,0xac,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xab,0xab,0xcf,0xbb,0xbb,0xbb,0xfe,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xc7,0xc7,0xc7,0xf8,0xac,0xac,0xac,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0x8b,0xcc,0xcc,0xcc,0xfc,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xdc,0xdc,0xdc,0xff,0xac,0xac,0xac,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xab,0xab,0xae,0xb3,0xb3,0xb3,0xfc,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xd2,0xd2,0xd2,0xff,0xaf,0xaf,0xaf,0xa6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xb0,0xb0,0xb1,0xd5,0xd5,0xd5,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xee,0xee,0xee,0xff,0xac,0xac,0xac,0xff,0xad,0xad,0xad,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0xae,0xae,0x84,0xae,0xae,0xae,0xfd,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xdc,0xdc,0xdc,0xff,0xaf,0xaf,0xaf,0xca,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xb0,0xb0,0xd2,0xde,0xde,0xde,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xac,0xac,0xac,0xff,0xad,0xad,0xad,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa9,0xa9,0xa9,0x5c,0xad,0xad,0xad,0xfe,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xe5,0xe5,0xe5,0xff,0xae,0xae,0xae,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xb0,0xb0,0xe8,0xe6,0xe6,0xe6,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xad,0xad,0xad,0xfd,0xae,0xae,0xae,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0xae,0xae,0x3f,0xac,0xac,0xac,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xed,0xed,0xed,0xff,0xad,0xad,0xad,0xfa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0xae,0xae,0xf6,0xeb,0xeb,0xeb,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xaf,0xaf,0xaf,0xfc,0xab,0xab,0xab,0x8c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0x1f,0xac,0xac,0xac,0xff,0xf0,0xf0,0xf0,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xac,0xac,0xac,0xff,0x9f,0x9f,0x9f,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0x03,0xac,0xac,0xac,0xfe,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb1,0xb1,0xb1,0xfc,0xab,0xab,0xab,0xa4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x04,0xac,0xac,0xac,0xff,0xe9,0xe9,0xe9,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xad,0xad,0xad,0xfe,0xad,0xad,0xad,0x19,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xae,0xae,0xae,0x13,0xac,0xac,0xac,0xff,0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb5,0xb5,0xb5,0xfc,0xab,0xab,0xab,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0xfe,0xe0,0xe0,0xe0,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xaf,0xaf,0xaf,0xf9,0xaa,0xaa,0xaa,0x2a,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xb0,0xb0,0xb0,0x1d,0xad,0xad,0xad,0xfe,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb8,0xb8,0xb8,0xfd,0xad,0xad,0xad,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0xfd,0xdc,0xdc,0xdc,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb1,0xb1,0xb1,0xf6,0xaa,0xaa,0xaa,0x36,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xaf,0xaf,0xaf,0x23,0xae,0xae,0xae,0xfb,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xe1,0xe1,0xe1,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xba,0xba,0xba,0xfe,0xab,0xab,0xab,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xab,0xab,0xfd,0xdb,0xdb,0xdb,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb4,0xb4,0xb4,0xf4,0xad,0xad,0xad,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xae,0xae,0xae,0x29,0xaf,0xaf,0xaf,0xf9,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xef,0xef,0xef,0xff,0xb7,0xb7,0xb7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xbc,0xbc,0xbc,0xff,0xab,0xab,0xab,0xcc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0xfc,0xd8,0xd8,0xd8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb4,0xb4,0xb4,0xf4,0xad,0xad,0xad,0x41,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xac,0xac,0xac,0x2e,0xb0,0xb0,0xb0,0xf8,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xe8,0xe8,0xe8,0xff,0xb0,0xb0,0xb0,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xbd,0xbd,0xbd,0xff,0xac,0xac,0xac,0xd3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0xfb,0xd5,0xd5,0xd5,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb6,0xb6,0xb6,0xf3,0xac,0xac,0xac,0x47,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xae,0xae,0xae,0x2f,0xb1,0xb1,0xb1,0xf7,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xe3,0xe3,0xe3,0xff,0xac,0xac,0xac,0xff,0xf7,0xf7,0xf7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xbe,0xbe,0xbe,0xff,0xab,0xab,0xab,0xd5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0xf9,0xd4,0xd4,0xd4,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb7,0xb7,0xb7,0xf3,0xae,0xae,0xae,0x48,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0x2a,0xaf,0xaf,0xaf,0xf9,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xe8,0xe8,0xe8,0xff,0xb2,0xb2,0xb2,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xbb,0xbb,0xbb,0xff,0xac,0xac,0xac,0xcd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0xfb,0xd7,0xd7,0xd7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb6,0xb6,0xb6,0xf3,0xae,0xae,0xae,0x42,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0x24,0xae,0xae,0xae,0xfb,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf1,0xf1,0xf1,0xff,0xba,0xba,0xba,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xba,0xba,0xba,0xfe,0xac,0xac,0xac,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0xfc,0xd9,0xd9,0xd9,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb3,0xb3,0xb3,0xf4,0xaa,0xaa,0xaa,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xad,0xad,0xad,0x1f,0xad,0xad,0xad,0xfd,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xe9,0xe9,0xe9,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb8,0xb8,0xb8,0xfd,0xac,0xac,0xac,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0xfd,0xdc,0xdc,0xdc,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb2,0xb2,0xb2,0xf5,0xaa,0xaa,0xaa,0x36,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0x15,0xac,0xac,0xac,0xff,0xf6,0xf6,0xf6,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb6,0xb6,0xb6,0xfc,0xab,0xab,0xab,0xba,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0xfe,0xdf,0xdf,0xdf,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb0,0xb0,0xb0,0xf8,0xaa,0xaa,0xaa,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xbf,0xbf,0xbf,0x04,0xac,0xac,0xac,0xfe,0xf2,0xf2,0xf2,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb2,0xb2,0xb2,0xfc,0xad,0xad,0xad,0xa7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x02,0xac,0xac,0xac,0xff,0xe5,0xe5,0xe5,0xff,0xf8,0xf8,0xf8,0xff,0xf7,0xf7,0xf7,0xff,0xad,0xad,0xad,0xfe,0xad,0xad,0xad,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0xf7,0xec,0xec,0xec,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb0,0xb0,0xb0,0xfc,0xac,0xac,0xac,0x8e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0xa7,0xa7,0x1d,0xac,0xac,0xac,0xff,0xf1,0xf1,0xf1,0xff,0xf8,0xf8,0xf8,0xff,0xf3,0xf3,0xf3,0xff,0xac,0xac,0xac,0xff,0xaa,0xaa,0xaa,0x09,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xb0,0xb0,0xeb,0xe7,0xe7,0xe7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xad,0xad,0xad,0xfd,0xac,0xac,0xac,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xaf,0xaf,0x40,0xac,0xac,0xac,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xee,0xee,0xee,0xff,0xac,0xac,0xac,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb1,0xb1,0xb1,0xd5,0xdf,0xdf,0xdf,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xac,0xac,0xac,0xff,0xae,0xae,0xae,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0x62,0xac,0xac,0xac,0xfe,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xe7,0xe7,0xe7,0xff,0xaf,0xaf,0xaf,0xea,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xb0,0xb0,0xb5,0xd7,0xd7,0xd7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf1,0xf1,0xf1,0xff,0xac,0xac,0xac,0xff,0xa8,0xa8,0xa8,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0xae,0xae,0x84,0xae,0xae,0xae,0xfd,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xdd,0xdd,0xdd,0xff,0xb1,0xb1,0xb1,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0x8f,0xce,0xce,0xce,0xfd,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xe0,0xe0,0xe0,0xff,0xad,0xad,0xad,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0xaf,0xb3,0xb3,0xb3,0xfc,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xd4,0xd4,0xd4,0xff,0xb0,0xb0,0xb0,0xab,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0x6e,0xc2,0xc2,0xc2,0xf5,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xd0,0xd0,0xd0,0xff,0xad,0xad,0xad,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0xd1,0xbb,0xbb,0xbb,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xc9,0xc9,0xc9,0xfa,0xad,0xad,0xad,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0x41,0xb3,0xb3,0xb3,0xf5,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xc1,0xc1,0xc1,0xff,0xad,0xad,0xad,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0xec,0xc5,0xc5,0xc5,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xbb,0xbb,0xbb,0xf2,0xac,0xac,0xac,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0x12,0xab,0xab,0xab,0xff,0xf3,0xf3,0xf3,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xb4,0xb4,0xb4,0xfc,0xac,0xac,0xac,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0xfc,0xd7,0xd7,0xd7,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xae,0xae,0xae,0xfa,0xac,0xac,0xac,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xaf,0xaf,0xea,0xe5,0xe5,0xe5,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xad,0xad,0xad,0xfe,0xab,0xab,0xab,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0x25,0xac,0xac,0xac,0xff,0xef,0xef,0xef,0xff,0xf8,0xf8,0xf8,0xff,0xec,0xec,0xec,0xff,0xad,0xad,0xad,0xf9,0x99,0x99,0x99,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xaf,0xaf,0xa6,0xd0,0xd0,0xd0,0xfe,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xe8,0xe8,0xe8,0xff,0xac,0xac,0xac,0xff,0xab,0xab,0xab,0x77,0xad,0xad,0xad,0x66,0xad,0xad,0xad,0x66,0xad,0xad,0xad,0x66,0xad,0xad,0xad,0x66,0xad,0xad,0xad,0x66,0xad,0xad,0xad,0x66,0xad,0xad,0xad,0x66,0xad,0xad,0xad,0x66,0xad,0xad,0xad,0x66,0xad,0xad,0xad,0x66,0xad,0xad,0xad,0x66,0xac,0xac,0xac,0x9d,0xac,0xac,0xac,0xc8,0xad,0xad,0xad,0xfe,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xd8,0xd8,0xd8,0xff,0xb0,0xb0,0xb0,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0x5d,0xba,0xba,0xba,0xf4,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xcf,0xcf,0xcf,0xff,0xae,0xae,0xae,0xf1,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xac,0xac,0xac,0xbb,0xad,0xad,0xad,0xea,0xae,0xae,0xae,0xfe,0xc6,0xc6,0xc6,0xfd,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xc1,0xc1,0xc1,0xf6,0xac,0xac,0xac,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0x0f,0xae,0xae,0xae,0xf9,0xeb,0xeb,0xeb,0xff,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xba,0xba,0xba,0xf5,0xab,0xab,0xab,0x6a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xac,0x56,0xb7,0xb7,0xb7,0xf4,0xf8,0xf8,0xf8,0xff,0xf8,0xf8,0xf8,0xff,0xf2,0xf2,0xf2,0xff,0xae,0xae,0xae,0xfb,0xaf,0xaf,0xaf,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xaf,0xaf,0xa5,0xc9,0xc9,0xc9,0xf9,0xf8,0xf8,0xf8,0xff,0xe7,0xe7,0xe7,0xff,0xae,0xae,0xae,0xf8,0xaa,0xaa,0xaa,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0x9f,0x9f,0x08,0xaf,0xaf,0xaf,0xec,0xe0,0xe0,0xe0,0xff,0xf8,0xf8,0xf8,0xff,0xcf,0xcf,0xcf,0xfc,0xaf,0xaf,0xaf,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xaa,0xaa,0x1b,0xae,0xae,0xae,0xf3,0xd1,0xd1,0xd1,0xfe,0xb3,0xb3,0xb3,0xf6,0xae,0xae,0xae,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0xae,0xae,0x5e,0xb1,0xb1,0xb1,0xf7,0xd2,0xd2,0xd2,0xff,0xae,0xae,0xae,0xf8,0xae,0xae,0xae,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0xad,0xad,0x38,0xb0,0xb0,0xb0,0xb4,0xae,0xae,0xae,0x77,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xab,0xab,0x67,0xaf,0xaf,0xaf,0xb6,0xab,0xab,0xab,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xb5,0x75,0xad,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0x55,0xad,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xb5,0x75,0xad,0x18,0xc6,0x96,0xb5,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0x75,0xad,0x38,0xc6,0x75,0xad,0x96,0xb5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xf7,0xbd,0xdf,0xff,0xfb,0xde,0x75,0xad,0xb6,0xb5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x75,0xad,0xdb,0xde,0xdf,0xff,0x38,0xc6,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0xb5,0x75,0xad,0x3c,0xe7,0xdf,0xff,0xdf,0xff,0xb6,0xb5,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0x96,0xb5,0xbe,0xf7,0xdf,0xff,0x7d,0xef,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xb6,0xb5,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x79,0xce,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x96,0xb5,0x9a,0xd6,0xdf,0xff,0xdf,0xff,0xf7,0xbd,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x79,0xce,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x1c,0xe7,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0xba,0xd6,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xb5,0x1c,0xe7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xb5,0x75,0xad,0x9e,0xf7,0xdf,0xff,0x5d,0xef,0x75,0xad,0x10,0x84,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x96,0xb5,0x75,0xad,0x9e,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x96,0xb5,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xba,0xd6,0xdf,0xff,0xbe,0xf7,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x55,0xad,0x96,0xb5,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xf7,0xbd,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x38,0xc6,0xdf,0xff,0xdf,0xff,0xd7,0xbd,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x55,0xad,0xf7,0xbd,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x79,0xce,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0xd7,0xbd,0xdf,0xff,0xdf,0xff,0x38,0xc6,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x75,0xad,0x79,0xce,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xfb,0xde,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0x96,0xb5,0xdf,0xff,0xdf,0xff,0x9a,0xd6,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x96,0xb5,0xba,0xd6,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x7d,0xef,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0xfb,0xde,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x96,0xb5,0xfb,0xde,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0x3c,0xe7,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x96,0xb5,0x3c,0xe7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0x7d,0xef,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x75,0xad,0x5d,0xef,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x75,0xad,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x75,0xad,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0x75,0xad,0xf3,0x9c,0x00,0x00,
+    0x00,0x00,0x55,0xad,0x75,0xad,0x9e,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x96,0xb5,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x75,0xad,0x5d,0xef,0xdf,0xff,0xbe,0xf7,0x75,0xad,0x75,0xad,0x00,0x00,
+    0x00,0x00,0x75,0xad,0x75,0xad,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xb6,0xb5,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x1c,0xe7,0xdf,0xff,0xdf,0xff,0x75,0xad,0x55,0xad,0x00,0x00,
+    0x00,0x00,0x96,0xb5,0x75,0xad,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xd7,0xbd,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xfb,0xde,0xdf,0xff,0xdf,0xff,0x96,0xb5,0x55,0xad,0x00,0x00,
+    0x00,0x00,0x75,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x1c,0xe7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xd7,0xbd,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0xdb,0xde,0xdf,0xff,0xdf,0xff,0xb6,0xb5,0x75,0xad,0x00,0x00,
+    0x00,0x00,0x75,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0x7d,0xef,0xb6,0xb5,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xf7,0xbd,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xdb,0xde,0xdf,0xff,0xdf,0xff,0xb6,0xb5,0x75,0xad,0x00,0x00,
+    0x00,0x00,0x75,0xad,0x96,0xb5,0xdf,0xff,0xdf,0xff,0x5d,0xef,0x96,0xb5,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xf7,0xbd,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xba,0xd6,0xdf,0xff,0xdf,0xff,0xb6,0xb5,0x75,0xad,0x00,0x00,
+    0x00,0x00,0x75,0xad,0x96,0xb5,0xdf,0xff,0xdf,0xff,0x1c,0xe7,0x75,0xad,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xf7,0xbd,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xba,0xd6,0xdf,0xff,0xdf,0xff,0xb6,0xb5,0x75,0xad,0x00,0x00,
+    0x00,0x00,0x55,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0x5d,0xef,0x96,0xb5,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xd7,0xbd,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xba,0xd6,0xdf,0xff,0xdf,0xff,0xb6,0xb5,0x75,0xad,0x00,0x00,
+    0x00,0x00,0x55,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0x9e,0xf7,0xd7,0xbd,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xd7,0xbd,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xdb,0xde,0xdf,0xff,0xdf,0xff,0x96,0xb5,0x55,0xad,0x00,0x00,
+    0x00,0x00,0x75,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x5d,0xef,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xd7,0xbd,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xfb,0xde,0xdf,0xff,0xdf,0xff,0x96,0xb5,0x55,0xad,0x00,0x00,
+    0x00,0x00,0x55,0xad,0x75,0xad,0xbe,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xb6,0xb5,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xfb,0xde,0xdf,0xff,0xdf,0xff,0x96,0xb5,0x55,0xad,0x00,0x00,
+    0x00,0x00,0xf7,0xbd,0x75,0xad,0x9e,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x96,0xb5,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x75,0xad,0x3c,0xe7,0xdf,0xff,0xbe,0xf7,0x75,0xad,0x75,0xad,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x75,0xad,0x7d,0xef,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x96,0xb5,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xa5,0x75,0xad,0x9e,0xf7,0xdf,0xff,0x9e,0xf7,0x75,0xad,0x55,0xad,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x96,0xb5,0x3c,0xe7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0x7d,0xef,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x96,0xb5,0xfb,0xde,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0x3c,0xe7,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x96,0xb5,0xba,0xd6,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x9e,0xf7,0x75,0xad,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0xfb,0xde,0x96,0xb5,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x75,0xad,0x79,0xce,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x1c,0xe7,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x96,0xb5,0xdf,0xff,0xdf,0xff,0xba,0xd6,0x96,0xb5,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x75,0xad,0x18,0xc6,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x9a,0xd6,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xd7,0xbd,0xdf,0xff,0xdf,0xff,0x59,0xce,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x75,0xad,0x96,0xb5,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x18,0xc6,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x38,0xc6,0xdf,0xff,0xdf,0xff,0xd7,0xbd,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x55,0xad,0x55,0xad,0x9e,0xf7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xb6,0xb5,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xba,0xd6,0xdf,0xff,0xdf,0xff,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x3c,0xe7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x75,0xad,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x75,0xad,0x7d,0xef,0xdf,0xff,0x7d,0xef,0x75,0xad,0xd3,0x9c,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x9a,0xd6,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x5d,0xef,0x75,0xad,0x55,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0xdf,0xff,0xdf,0xff,0xdb,0xde,0x96,0xb5,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xd7,0xbd,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x79,0xce,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x75,0xad,0x38,0xc6,0xdf,0xff,0xdf,0xff,0x18,0xc6,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0x75,0xad,0x5d,0xef,0xdf,0xff,0xdf,0xff,0xd7,0xbd,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0xb6,0xb5,0xdf,0xff,0xdf,0xff,0x9e,0xf7,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x59,0xce,0xdf,0xff,0x3c,0xe7,0x75,0xad,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0x9c,0x75,0xad,0x1c,0xe7,0xdf,0xff,0x79,0xce,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0x75,0xad,0x9a,0xd6,0x96,0xb5,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x96,0xb5,0x9a,0xd6,0x75,0xad,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x96,0xb5,0x75,0xad,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0x75,0xad,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x1d,0x7e,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x26,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x0d,0xe5,0xf9,0xf8,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xf8,0xf9,0xf0,0x17,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x8e,0xf7,0xff,0xff,0xef,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xde,0xff,0xff,0xf8,0xa9,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0xf2,0xff,0xff,0xff,0xf5,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xf6,0xff,0xff,0xff,0xfb,0x13,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x51,0xf5,0xff,0xff,0xff,0xfe,0xe1,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xd4,0xff,0xff,0xff,0xff,0xf4,0x68,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x99,0xfc,0xff,0xff,0xff,0xff,0xff,0x90,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xbe,0xdf,0xfd,0xff,0xff,0xff,0xb5,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xe1,0xff,0xff,0xff,0xff,0xff,0xfe,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0xff,0xff,0xff,0xff,0xf4,0x02,0x00,0x00,
+    0x00,0x00,0x0d,0xfe,0xff,0xff,0xff,0xff,0xff,0xfc,0xaf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfd,0xff,0xff,0xff,0xfc,0x23,0x00,0x00,
+    0x00,0x00,0x3a,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xdc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xea,0xff,0xff,0xff,0xf3,0x51,0x00,0x00,
+    0x00,0x00,0x67,0xf4,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xfe,0xff,0xff,0xf8,0x7e,0x00,0x00,
+    0x00,0x00,0x8b,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0xfc,0xff,0xff,0xff,0xa6,0x00,0x00,
+    0x00,0x00,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xfd,0xff,0xff,0xff,0xca,0x00,0x00,
+    0x00,0x00,0xd2,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0xfe,0xff,0xff,0xff,0xe7,0x00,0x00,
+    0x00,0x00,0xe8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,0xff,0xfa,0x00,0x00,
+    0x00,0x00,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x8c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0xff,0xff,0xff,0x08,0x00,
+    0x00,0x03,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xa4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xff,0xff,0xff,0xff,0xfe,0x19,0x00,
+    0x00,0x13,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xf9,0x2a,0x00,
+    0x00,0x1d,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfd,0xff,0xff,0xff,0xf6,0x36,0x00,
+    0x00,0x23,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfd,0xff,0xff,0xff,0xf4,0x3b,0x00,
+    0x00,0x29,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xcc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,0xff,0xff,0xf4,0x41,0x00,
+    0x00,0x2e,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xff,0xff,0xff,0xf3,0x47,0x00,
+    0x00,0x2f,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xff,0xff,0xff,0xf3,0x48,0x00,
+    0x00,0x2a,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xcd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xff,0xff,0xff,0xf3,0x42,0x00,
+    0x00,0x24,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,0xff,0xff,0xf4,0x3c,0x00,
+    0x00,0x1f,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfd,0xff,0xff,0xff,0xf5,0x36,0x00,
+    0x00,0x15,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xba,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xf8,0x2d,0x00,
+    0x00,0x04,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xa7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xff,0xff,0xff,0xfe,0x1c,0x00,
+    0x00,0x00,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x8e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0xff,0xff,0xff,0xff,0xff,0x09,0x00,
+    0x00,0x00,0xeb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,
+    0x00,0x00,0xd5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xfe,0xff,0xff,0xff,0xea,0x00,0x00,
+    0x00,0x00,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xfd,0xff,0xff,0xff,0xcf,0x00,0x00,
+    0x00,0x00,0x8f,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xfc,0xff,0xff,0xff,0xab,0x00,0x00,
+    0x00,0x00,0x6e,0xf5,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd1,0xff,0xff,0xff,0xfa,0x85,0x00,0x00,
+    0x00,0x00,0x41,0xf5,0xff,0xff,0xff,0xff,0xff,0xff,0xe2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xec,0xff,0xff,0xff,0xf2,0x59,0x00,0x00,
+    0x00,0x00,0x12,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,0xff,0xff,0xfa,0x2b,0x00,0x00,
+    0x00,0x00,0x00,0xea,0xff,0xff,0xff,0xff,0xff,0xfe,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xff,0xff,0xff,0xff,0xf9,0x05,0x00,0x00,
+    0x00,0x00,0x00,0xa6,0xfe,0xff,0xff,0xff,0xff,0xff,0x77,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x9d,0xc8,0xfe,0xff,0xff,0xff,0xc2,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x5d,0xf4,0xff,0xff,0xff,0xff,0xf1,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xea,0xfe,0xfd,0xff,0xff,0xf6,0x75,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0f,0xf9,0xff,0xff,0xff,0xf5,0x6a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0xf4,0xff,0xff,0xff,0xfb,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xa5,0xf9,0xff,0xff,0xf8,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xec,0xff,0xff,0xfc,0xc0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1b,0xf3,0xfe,0xf6,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5e,0xf7,0xff,0xf8,0x29,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x38,0xb4,0x77,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xb6,0x46,0x00,0x00,0x00,0x00,0x00,
 
 };
 
 const lv_image_dsc_t img_spool_clean = {
   .header = {
     .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_ARGB8888,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
     .flags = 0,
     .w = 32,
     .h = 42,
-    .stride = 130,
+    .stride = 64,
     .reserved_2 = 0,
   },
   .data_size = sizeof(img_spool_clean_map),
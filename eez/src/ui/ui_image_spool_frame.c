@@ -24,63 +24,65 @@
 #define LV_ATTRIBUTE_IMG_SPOOL_FRAME
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 5460 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SPOOL_FRAME
 uint8_t img_spool_frame_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0x64,0x64,0x64,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0x64,0x64,0x64,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0x64,0x64,0x64,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0x64,0x64,0x64,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0x64,0x64,0x64,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0x64,0x64,0x64,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0x64,0x64,0x64,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xa0,0xa0,0xa0,0xff,0xdc,0xdc,0xdc,0xff,0x64,0x64,0x64,0xff,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x10,0x00,0x00,0x00,0x00,0x04,0x00,
+    0x00,0x64,0x00,0x00,0x00,0x00,0x19,0x00,
+    0x01,0xa9,0x00,0x00,0x00,0x00,0x6a,0x40,
+    0x01,0xa9,0x00,0x00,0x00,0x00,0x6a,0x40,
+    0x01,0xa9,0x00,0x00,0x00,0x00,0x6a,0x40,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xba,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xba,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xba,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xba,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xba,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xba,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xba,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x1a,0xaa,0x90,0x00,0x00,0x06,0xaa,0xa4,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x06,0xaa,0x40,0x00,0x00,0x01,0xaa,0x90,
+    0x01,0xa9,0x00,0x00,0x00,0x00,0x6a,0x40,
+    0x01,0xa9,0x00,0x00,0x00,0x00,0x6a,0x40,
+    0x01,0xa9,0x00,0x00,0x00,0x00,0x6a,0x40,
+    0x00,0x64,0x00,0x00,0x00,0x00,0x19,0x00,
+    0x00,0x10,0x00,0x00,0x00,0x00,0x04,0x00,
 
 };
 
 const lv_image_dsc_t img_spool_frame = {
   .header = {
     .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_ARGB8888,
+    .cf = LV_COLOR_FORMAT_I2,
     .flags = 0,
     .w = 32,
     .h = 42,
-    .stride = 130,
+    .stride = 8,
     .reserved_2 = 0,
   },
   .data_size = sizeof(img_spool_frame_map),
@@ -24,67 +24,114 @@
 #define LV_ATTRIBUTE_IMG_SPOOLBUDDY_LOGO_DARK
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 33120 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SPOOLBUDDY_LOGO_DARK
 uint8_t img_spoolbuddy_logo_dark_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x8b,0x4a,0x11,0x47,0xa3,0x4b,0x27,0x45,0x9d,0x47,0x2e,0x44,0xa4,0x45,0x26,0x43,0x89,0x42,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x77,0x48,0x02,0x45,0xa1,0x4b,0x44,0x45,0xa7,0x4c,0x9c,0x45,0xa7,0x4c,0xde,0x45,0xa8,0x4d,0xfe,0x45,0xa6,0x4c,0xff,0x45,0xa4,0x4b,0xff,0x45,0xa3,0x49,0xfb,0x47,0x9f,0x47,0x93,0x49,0x6e,0x49,0x05,0x4e,0x4d,0x4e,0x42,0x53,0x53,0x53,0x92,0x5b,0x5b,0x5b,0xc7,0x65,0x65,0x65,0xee,0x68,0x68,0x68,0xfc,0x67,0x67,0x67,0xfc,0x63,0x62,0x63,0xee,0x5e,0x5e,0x5e,0xc6,0x5e,0x5d,0x5e,0x8e,0x5e,0x5d,0x5e,0x3a,0x4e,0x4b,0x4e,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x89,0x4b,0x01,0x43,0x9f,0x4a,0x55,0x42,0xa0,0x4a,0xd5,0x43,0xa2,0x4c,0xff,0x42,0xa4,0x4c,0xff,0x43,0xa7,0x4d,0xff,0x45,0xa8,0x4e,0xff,0x45,0xa8,0x4d,0xff,0x45,0xa6,0x4c,0xe1,0x45,0x98,0x4a,0x3a,0x48,0x48,0x49,0x5f,0x50,0x51,0x51,0xda,0x76,0x76,0x76,0xff,0x8d,0x8d,0x8d,0xff,0x98,0x98,0x98,0xff,0x96,0x95,0x96,0xff,0x8f,0x8f,0x8f,0xff,0x8b,0x8a,0x8a,0xff,0x87,0x87,0x87,0xff,0x84,0x84,0x85,0xff,0x7a,0x7a,0x7b,0xff,0x6d,0x6c,0x6d,0xff,0x60,0x60,0x60,0xd5,0x5e,0x5e,0x5f,0x5a,0x5c,0x59,0x58,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xa5,0x4b,0x19,0x44,0xa8,0x4b,0xb9,0x42,0xa5,0x4c,0xff,0x42,0xa3,0x4c,0xff,0x42,0xa0,0x4a,0xfa,0x42,0x9e,0x49,0xac,0x42,0x9d,0x49,0x5e,0x43,0x91,0x47,0x3b,0x3d,0x81,0x40,0x2c,0x3a,0x46,0x3b,0x3c,0x47,0x48,0x48,0xca,0x7c,0x7c,0x7c,0xff,0x9d,0x9d,0x9d,0xff,0xa0,0xa0,0xa0,0xff,0x9c,0x9c,0x9c,0xff,0x8d,0x8d,0x8d,0xff,0x7e,0x7e,0x7e,0xff,0x78,0x77,0x77,0xff,0x75,0x75,0x75,0xff,0x77,0x77,0x78,0xff,0x7e,0x7d,0x7e,0xff,0x7f,0x7f,0x80,0xff,0x7b,0x7b,0x7c,0xff,0x78,0x77,0x77,0xff,0x6c,0x6d,0x6d,0xff,0x63,0x64,0x63,0xc3,0x63,0x63,0x62,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xa3,0x4c,0x32,0x46,0xa8,0x4c,0xe3,0x44,0xa7,0x4d,0xff,0x44,0xa8,0x4c,0xfe,0x43,0xa2,0x4a,0xa2,0x41,0x93,0x46,0x27,0x43,0x9e,0x45,0x64,0x43,0x9d,0x46,0xc6,0x42,0x96,0x44,0xc1,0x34,0x45,0x35,0x7d,0x53,0x53,0x53,0xf2,0x92,0x93,0x92,0xff,0xa1,0xa1,0xa0,0xff,0x9b,0x9b,0x9a,0xff,0x79,0x79,0x79,0xfd,0x53,0x52,0x52,0xc5,0x3c,0x3c,0x3c,0x85,0x3f,0x3d,0x3e,0x57,0x40,0x3f,0x40,0x43,0x40,0x40,0x40,0x45,0x44,0x43,0x43,0x62,0x40,0x40,0x40,0x93,0x4e,0x4e,0x4e,0xda,0x63,0x64,0x64,0xff,0x76,0x77,0x76,0xff,0x76,0x77,0x76,0xff,0x71,0x71,0x71,0xff,0x65,0x65,0x65,0xef,0x61,0x61,0x62,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x9f,0x48,0x39,0x45,0xa2,0x4b,0xf1,0x45,0xa4,0x4c,0xff,0x45,0xa5,0x4c,0xeb,0x45,0xa1,0x4a,0x49,0x42,0xa5,0x46,0x52,0x42,0xa6,0x46,0xe1,0x43,0xa0,0x47,0xff,0x42,0x99,0x44,0xae,0x2e,0x34,0x2e,0x5a,0x55,0x55,0x54,0xfa,0x96,0x96,0x95,0xff,0x9e,0x9e,0x9e,0xff,0x7d,0x7d,0x7d,0xff,0x42,0x41,0x41,0xaf,0x37,0x36,0x37,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x32,0x32,0x01,0x43,0x43,0x43,0x48,0x4d,0x4e,0x4d,0xc4,0x66,0x66,0x65,0xff,0x6f,0x6f,0x6f,0xff,0x6b,0x6b,0x6b,0xff,0x63,0x62,0x62,0xfa,0x60,0x5f,0x60,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xa0,0x4a,0x25,0x45,0xa1,0x4c,0xed,0x46,0xa1,0x4c,0xff,0x44,0x9e,0x49,0xdf,0x43,0x92,0x46,0x26,0x41,0xa0,0x44,0x8f,0x41,0xa6,0x48,0xff,0x42,0xa6,0x49,0xff,0x42,0xa1,0x47,0xd5,0x2f,0x3f,0x2f,0x54,0x4e,0x4f,0x4e,0xf3,0x91,0x90,0x8f,0xff,0x93,0x92,0x92,0xff,0x60,0x60,0x5f,0xe8,0x32,0x32,0x32,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x3d,0x3c,0x01,0x46,0x45,0x45,0x64,0x55,0x54,0x54,0xf6,0x67,0x66,0x67,0xff,0x65,0x65,0x65,0xff,0x61,0x61,0x61,0xf8,0x61,0x60,0x61,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x9d,0x47,0x06,0x45,0xa5,0x4a,0xcd,0x45,0xa3,0x4c,0xff,0x44,0x9f,0x4b,0xe8,0x42,0x93,0x45,0x23,0x41,0x9d,0x44,0x96,0x3e,0x94,0x42,0xff,0x3f,0x9f,0x47,0xff,0x41,0xa5,0x48,0xfb,0x3b,0x88,0x3f,0x40,0x40,0x40,0x40,0xda,0x8d,0x8d,0x8d,0xff,0x91,0x90,0x91,0xff,0x54,0x53,0x53,0xdd,0x2c,0x2b,0x2b,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x58,0x58,0x1a,0x61,0x61,0x61,0xef,0x68,0x67,0x67,0xf3,0x67,0x67,0x67,0xf3,0x63,0x63,0x63,0x7a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x44,0x45,0x38,0x50,0x4f,0x50,0xeb,0x62,0x61,0x61,0xff,0x61,0x61,0x61,0xff,0x62,0x62,0x63,0xe5,0x61,0x61,0x62,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xa3,0x4a,0x80,0x45,0xa5,0x4c,0xff,0x44,0xa5,0x4b,0xfe,0x44,0x9b,0x48,0x48,0x43,0x9f,0x48,0x70,0x3f,0x94,0x44,0xf9,0x3d,0x93,0x44,0xfd,0x41,0x9f,0x48,0xff,0x3f,0x97,0x44,0x94,0x2d,0x2d,0x2d,0x56,0x7b,0x7a,0x7a,0xfc,0x92,0x91,0x92,0xff,0x61,0x60,0x60,0xf1,0x2d,0x2d,0x2d,0x2a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0x5f,0x5f,0x62,0x7e,0x7e,0x7e,0xff,0x83,0x83,0x82,0xff,0x81,0x80,0x80,0xff,0x69,0x69,0x69,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x49,0x4a,0x35,0x56,0x55,0x56,0xf4,0x5e,0x5e,0x5e,0xff,0x5f,0x5e,0x5e,0xff,0x65,0x64,0x64,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x9c,0x4a,0x1c,0x44,0xa2,0x4c,0xf6,0x44,0xa4,0x4c,0xff,0x44,0xa2,0x4b,0x96,0x44,0xa2,0x49,0x2c,0x44,0xa4,0x4a,0xf2,0x3f,0x92,0x44,0xd5,0x40,0x97,0x46,0xff,0x40,0x9c,0x47,0xf2,0x35,0x6d,0x38,0x20,0x56,0x56,0x56,0xdb,0x89,0x88,0x88,0xff,0x73,0x73,0x72,0xff,0x2e,0x2c,0x2d,0x61,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x0b,0x4b,0x4b,0x4b,0x7a,0x4e,0x4e,0x4e,0x15,0x00,0x00,0x00,0x00,0x51,0x51,0x52,0x0c,0x5f,0x5f,0x60,0xbb,0x91,0x91,0x91,0xff,0x8b,0x8b,0x8b,0xff,0x87,0x87,0x87,0xff,0x75,0x75,0x75,0xfe,0x60,0x5e,0x5f,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x62,0x62,0x44,0x67,0x67,0x67,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x50,0x50,0x5f,0x57,0x57,0x57,0xff,0x58,0x58,0x58,0xff,0x61,0x60,0x61,0xfc,0x66,0x65,0x65,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xa0,0x4b,0x8e,0x44,0xa0,0x4c,0xff,0x43,0xa1,0x4b,0xf0,0x41,0x93,0x46,0x15,0x45,0xa3,0x4a,0xc5,0x42,0x97,0x47,0xac,0x45,0xa2,0x4a,0xf8,0x3e,0x90,0x42,0xfb,0x40,0x98,0x46,0x96,0x2c,0x2d,0x2e,0x62,0x78,0x78,0x78,0xff,0x81,0x80,0x7f,0xff,0x3a,0x39,0x3a,0xb9,0x28,0x28,0x28,0x01,0x3d,0x41,0x3d,0x02,0x4d,0x4d,0x4e,0xae,0x83,0x83,0x83,0xff,0x6a,0x6a,0x6a,0xea,0x57,0x57,0x57,0x94,0x6c,0x6c,0x6d,0xe9,0x90,0x90,0x90,0xff,0x9e,0x9d,0x9d,0xff,0x94,0x94,0x94,0xff,0x8c,0x8b,0x8c,0xff,0x82,0x82,0x82,0xff,0x6f,0x6f,0x6f,0xff,0x63,0x63,0x63,0xc0,0x66,0x66,0x67,0xba,0x6c,0x6c,0x6c,0xff,0x6f,0x6f,0x6f,0xf7,0x6b,0x6b,0x6b,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x4f,0x4f,0xba,0x54,0x54,0x54,0xff,0x56,0x56,0x56,0xff,0x69,0x68,0x68,0xaa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x94,0x4a,0x09,0x45,0xa0,0x4c,0xed,0x44,0x9f,0x4c,0xff,0x43,0x9c,0x4a,0x88,0x43,0x9e,0x48,0x4c,0x44,0xa1,0x4b,0xe4,0x43,0x99,0x48,0xa1,0x3c,0x8a,0x41,0xfa,0x41,0x9e,0x46,0xfd,0x39,0x77,0x3b,0x3f,0x52,0x52,0x52,0xdb,0x81,0x81,0x81,0xff,0x61,0x60,0x61,0xfd,0x29,0x28,0x27,0x36,0x00,0x00,0x00,0x00,0x3f,0x40,0x3f,0x83,0x75,0x75,0x75,0xff,0x96,0x97,0x96,0xff,0xa5,0xa5,0xa5,0xff,0xa4,0xa5,0xa4,0xff,0xb7,0xb7,0xb7,0xff,0xa0,0x9f,0x9f,0xff,0x7d,0x7c,0x7c,0xff,0x6b,0x6a,0x6a,0xff,0x66,0x66,0x66,0xff,0x6e,0x6d,0x6d,0xff,0x7b,0x7a,0x7a,0xff,0x78,0x78,0x78,0xff,0x72,0x72,0x72,0xff,0x70,0x70,0x71,0xff,0x6e,0x6e,0x6e,0xff,0x69,0x69,0x69,0xf0,0x64,0x64,0x63,0x25,0x00,0x00,0x00,0x00,0x4e,0x4d,0x4d,0x31,0x52,0x52,0x52,0xfd,0x53,0x53,0x53,0xff,0x64,0x64,0x64,0xfa,0x69,0x68,0x69,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x9c,0x47,0x1f,0x41,0x9e,0x49,0x4d,0x42,0x9e,0x49,0x61,0x42,0x9f,0x49,0x51,0x43,0xa0,0x48,0x2f,0x44,0x8c,0x46,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xa3,0x4c,0xc4,0x43,0xa2,0x4c,0xf9,0x44,0xa4,0x4d,0xf9,0x45,0x85,0x4a,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf2,0xf2,0xf1,0x06,0xf8,0xf8,0xf8,0x18,0xf8,0xf9,0xf8,0x18,0xf7,0xf8,0xf7,0x18,0xf6,0xf7,0xf6,0x18,0xf6,0xf5,0xf5,0x18,0xf6,0xf6,0xf5,0x18,0xf8,0xf7,0xf7,0x18,0xe2,0xe2,0xe2,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe5,0xe6,0xe6,0x0d,0xfa,0xfa,0xf9,0xf6,0xfb,0xfa,0xfb,0xf9,0xfc,0xfb,0xfb,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0x84,0xfb,0xfb,0xfb,0xf9,0xfc,0xfc,0xfc,0xf9,0xf4,0xf2,0xf2,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xa0,0x4a,0x52,0x44,0xa1,0x4b,0xff,0x44,0xa0,0x4b,0xfd,0x41,0x96,0x46,0x20,0x44,0x9d,0x49,0xb5,0x43,0x9a,0x49,0x74,0x44,0xa1,0x4a,0xeb,0x3b,0x87,0x3f,0xdb,0x3f,0x9a,0x45,0xd5,0x2d,0x2d,0x2d,0x34,0x67,0x68,0x67,0xfa,0x7b,0x7c,0x7c,0xff,0x3b,0x3b,0x3b,0xb0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x46,0x45,0xbc,0x82,0x82,0x81,0xff,0x92,0x92,0x91,0xff,0xa2,0xa2,0xa2,0xff,0xab,0xab,0xab,0xff,0x76,0x76,0x76,0xf0,0x3c,0x3c,0x3d,0x87,0x38,0x37,0x37,0x2d,0x35,0x35,0x34,0x0f,0x38,0x37,0x37,0x15,0x3c,0x3a,0x3a,0x51,0x48,0x48,0x48,0xbb,0x66,0x67,0x66,0xff,0x71,0x71,0x71,0xff,0x6d,0x6e,0x6d,0xff,0x66,0x67,0x65,0xff,0x62,0x62,0x61,0xfa,0x61,0x62,0x60,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0x55,0x55,0xbb,0x50,0x50,0x50,0xff,0x59,0x59,0x59,0xff,0x6c,0x6b,0x6c,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x9d,0x47,0x2c,0x41,0x9f,0x49,0xc3,0x40,0xa2,0x4a,0xfe,0x40,0xa2,0x4b,0xff,0x41,0xa3,0x4a,0xff,0x41,0xa4,0x4b,0xff,0x41,0xa3,0x4a,0xff,0x41,0xa0,0x49,0xef,0x41,0x9e,0x4a,0x9b,0x43,0x9b,0x4a,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xa4,0x4c,0xca,0x43,0xa3,0x4d,0xff,0x43,0xa2,0x4d,0xff,0x43,0x80,0x46,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xfb,0xfa,0x4b,0xfe,0xff,0xff,0xff,0xfe,0xfe,0xfe,0xff,0xfe,0xfe,0xfe,0xff,0xfe,0xff,0xfd,0xff,0xfe,0xfe,0xfe,0xff,0xff,0xfe,0xfe,0xff,0xff,0xfe,0xff,0xff,0xfe,0xfe,0xfe,0xfe,0xfc,0xfc,0xfc,0xea,0xf5,0xf7,0xf7,0x99,0xe6,0xe6,0xe6,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7,0xe7,0x0d,0xfd,0xfd,0xfd,0xfd,0xfe,0xfe,0xff,0xff,0xfd,0xfd,0xfd,0xbc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfd,0xfd,0xfd,0x88,0xfe,0xfe,0xfe,0xff,0xfe,0xfe,0xff,0xff,0xf4,0xf4,0xf4,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xa1,0x4a,0x9f,0x43,0xa1,0x4b,0xff,0x43,0x9e,0x49,0xcf,0x40,0x92,0x46,0x15,0x44,0x9a,0x4b,0xf6,0x41,0x95,0x45,0x5a,0x42,0x99,0x47,0xdb,0x3f,0x94,0x44,0xc8,0x40,0x96,0x45,0x89,0x31,0x31,0x32,0x75,0x73,0x73,0x72,0xff,0x66,0x66,0x66,0xff,0x2b,0x2b,0x2b,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x43,0x43,0x3f,0x6c,0x6c,0x6c,0xff,0x8e,0x8e,0x8d,0xff,0x94,0x94,0x93,0xff,0x53,0x53,0x53,0xc9,0x35,0x35,0x35,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x32,0x2e,0x01,0x41,0x41,0x41,0x6d,0x58,0x58,0x57,0xfd,0x67,0x68,0x66,0xff,0x59,0x59,0x58,0xff,0x64,0x64,0x64,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x59,0x58,0x60,0x4f,0x4f,0x4f,0xff,0x4b,0x4a,0x4b,0xff,0x69,0x69,0x6a,0xb9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x9e,0x47,0x28,0x40,0x9f,0x48,0xee,0x40,0x9f,0x49,0xff,0x40,0xa0,0x4a,0xff,0x41,0xa3,0x4b,0xff,0x41,0xa4,0x4b,0xff,0x41,0xa2,0x4a,0xff,0x40,0x9f,0x49,0xff,0x40,0x9f,0x49,0xff,0x41,0xa1,0x4a,0xff,0x43,0xa1,0x4b,0x7d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xa2,0x4c,0xcb,0x41,0xa3,0x4c,0xff,0x43,0xa4,0x4d,0xff,0x43,0x7e,0x47,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xfa,0xf9,0x4b,0xfd,0xfe,0xfe,0xff,0xfc,0xfd,0xfe,0xff,0xfc,0xfe,0xfe,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfd,0xff,0xfe,0xff,0xfd,0xfe,0xfe,0xff,0xfc,0xfd,0xfe,0xff,0xfa,0xfb,0xfb,0xe2,0xe6,0xe7,0xe7,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe6,0xe6,0xe6,0x0e,0xfd,0xfd,0xfd,0xfe,0xfe,0xfe,0xff,0xff,0xfd,0xfd,0xfd,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0x88,0xfe,0xfe,0xff,0xff,0xfe,0xfe,0xfe,0xff,0xf3,0xf4,0xf3,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xa2,0x49,0xd7,0x43,0xa3,0x4a,0xff,0x44,0x9e,0x49,0x86,0x44,0x99,0x49,0x5b,0x45,0x99,0x4b,0xba,0x43,0x97,0x47,0x8e,0x3f,0x8f,0x43,0x9c,0x40,0x9b,0x46,0xed,0x3e,0x8f,0x43,0x49,0x4b,0x4b,0x4b,0xa9,0x73,0x73,0x73,0xff,0x52,0x52,0x51,0xfa,0x2a,0x2c,0x2b,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x39,0x39,0x07,0x5e,0x5e,0x5e,0xf8,0x90,0x90,0x90,0xff,0x59,0x59,0x59,0xe3,0x33,0x33,0x33,0x15,0x36,0x8b,0x34,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x8a,0x40,0x0b,0x3d,0x70,0x3d,0x02,0x48,0x48,0x48,0x7c,0x55,0x55,0x55,0xff,0x57,0x56,0x56,0xff,0x68,0x67,0x67,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x53,0x53,0x18,0x52,0x51,0x52,0xfd,0x47,0x47,0x47,0xff,0x64,0x64,0x64,0xf2,0x55,0x56,0x56,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xa1,0x49,0xb0,0x40,0xa1,0x4a,0xff,0x40,0xa0,0x4a,0xff,0x40,0x9e,0x49,0xbc,0x41,0x9b,0x48,0x47,0x3d,0x8a,0x41,0x32,0x3f,0x97,0x46,0x43,0x3f,0x99,0x47,0x81,0x40,0x9c,0x48,0xdd,0x40,0x9e,0x49,0xf8,0x42,0x97,0x47,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x79,0x41,0x06,0x43,0x4d,0x41,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x73,0x43,0x04,0x41,0x72,0x41,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x72,0x42,0x03,0x43,0x79,0x42,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xa1,0x4b,0xcc,0x41,0xa3,0x4c,0xff,0x42,0xa4,0x4c,0xff,0x3f,0x7e,0x45,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xfa,0xf9,0x4c,0xfd,0xfe,0xff,0xff,0xfc,0xfd,0xfe,0xff,0xf7,0xf7,0xf7,0xb7,0xdb,0xdb,0xdb,0x35,0xdd,0xdc,0xdc,0x35,0xdb,0xdb,0xda,0x35,0xe3,0xe3,0xe1,0x35,0xf1,0xf3,0xf3,0x61,0xfa,0xfb,0xfb,0xea,0xfd,0xfe,0xfe,0xff,0xfd,0xff,0xff,0xff,0xf3,0xf5,0xf4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0x95,0x93,0x02,0xb1,0xb1,0xb2,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe1,0xe2,0xe2,0x0e,0xfb,0xfc,0xfc,0xfe,0xfd,0xfe,0xfe,0xff,0xfc,0xfd,0xfd,0xbe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xb1,0xb2,0x06,0x9c,0x9b,0x9c,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfd,0x89,0xfe,0xfe,0xff,0xff,0xfd,0xff,0xfe,0xff,0xf3,0xf4,0xf3,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x87,0x44,0x0d,0x43,0xa2,0x49,0xfc,0x43,0xa1,0x4a,0xff,0x42,0x9c,0x48,0x52,0x46,0x9b,0x48,0x8c,0x45,0x9a,0x49,0x7d,0x42,0x98,0x47,0xc4,0x3c,0x8b,0x41,0x85,0x3f,0x9c,0x45,0xfe,0x34,0x6a,0x38,0x22,0x54,0x54,0x54,0xd3,0x6e,0x6e,0x6e,0xff,0x42,0x41,0x41,0xd8,0x23,0x23,0x23,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x40,0x41,0x54,0x73,0x73,0x74,0xff,0x79,0x79,0x79,0xff,0x34,0x33,0x34,0x55,0x3b,0x8f,0x3a,0x18,0x37,0x92,0x39,0xd7,0x36,0x84,0x38,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x90,0x3f,0x6d,0x41,0x94,0x42,0x85,0x44,0x44,0x44,0x05,0x54,0x54,0x54,0xdc,0x55,0x54,0x54,0xff,0x63,0x62,0x63,0xee,0x5a,0x59,0x59,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0x56,0x56,0xe0,0x45,0x46,0x46,0xff,0x5e,0x5e,0x5e,0xff,0x68,0x69,0x68,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x3a,0x01,0x3f,0xa2,0x49,0xef,0x40,0xa2,0x4a,0xff,0x40,0xa4,0x4a,0xff,0x3c,0x8c,0x43,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x7d,0x41,0x05,0x3d,0x93,0x45,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9b,0x47,0xc3,0x3f,0x9d,0x47,0xd3,0x40,0x9e,0x47,0xac,0x44,0x99,0x46,0x09,0x42,0xa2,0x47,0x89,0x42,0xa3,0x47,0xe2,0x41,0xa1,0x48,0xf6,0x42,0xa3,0x49,0xe8,0x42,0xa3,0x49,0xa2,0x42,0x9c,0x48,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x99,0x46,0x10,0x42,0xa1,0x49,0x7f,0x41,0xa3,0x4a,0xd6,0x41,0xa1,0x49,0xf2,0x41,0x9f,0x49,0xf5,0x42,0xa2,0x49,0xda,0x42,0xa2,0x49,0x8c,0x41,0x9b,0x47,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x96,0x47,0x08,0x43,0xa1,0x49,0x72,0x42,0xa5,0x4a,0xce,0x42,0xa3,0x4a,0xf0,0x43,0xa2,0x4a,0xf5,0x43,0xa5,0x4b,0xdf,0x43,0xa5,0x4a,0x94,0x42,0x9d,0x49,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xa2,0x4c,0xcc,0x41,0xa3,0x4c,0xff,0x42,0xa4,0x4c,0xff,0x40,0x82,0x45,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xfb,0xfa,0x4c,0xfd,0xfe,0xfe,0xff,0xfe,0xfe,0xff,0xff,0xfa,0xfa,0xfa,0xa3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xf9,0xf9,0x66,0xfe,0xff,0xfe,0xff,0xfd,0xff,0xfe,0xff,0xf2,0xf5,0xf5,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0xf5,0xf4,0x8f,0xfa,0xfc,0xfb,0xcc,0xfd,0xfd,0xfd,0xcb,0xda,0xda,0xda,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xf9,0xf8,0x9f,0xfc,0xfd,0xfc,0xcb,0xfb,0xfc,0xfa,0xcb,0xab,0xab,0xab,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0xf4,0xf3,0x38,0xfa,0xfb,0xfb,0xb4,0xfd,0xfd,0xfd,0xee,0xfc,0xfc,0xfc,0xf5,0xfa,0xfb,0xfb,0xd7,0xf3,0xf3,0xf3,0x71,0xe1,0xe2,0xe2,0x12,0xfb,0xfc,0xfc,0xfe,0xfe,0xff,0xfe,0xff,0xfc,0xfc,0xfc,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd2,0xd2,0xd3,0x03,0xf4,0xf7,0xf5,0x6f,0xfa,0xfb,0xfb,0xd5,0xfc,0xfc,0xfc,0xf5,0xfd,0xfc,0xfd,0xf0,0xf9,0xf9,0xf9,0xb8,0xee,0xf0,0xef,0x35,0xf7,0xfa,0xfa,0x8b,0xfc,0xfe,0xfe,0xff,0xf9,0xfd,0xfe,0xff,0xee,0xf2,0xf2,0x44,0xed,0xef,0xee,0x33,0xfd,0xfe,0xfd,0xc8,0xfe,0xfe,0xfe,0xc8,0xf8,0xf8,0xf8,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xf9,0xf8,0x72,0xfe,0xfe,0xfd,0xc8,0xfd,0xfe,0xfd,0xc8,0xea,0xe9,0xe9,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xa0,0x48,0x29,0x43,0xa0,0x49,0xff,0x43,0xa0,0x4a,0xff,0x41,0x8e,0x46,0x32,0x46,0x9b,0x49,0xad,0x45,0x99,0x48,0x54,0x42,0x99,0x46,0xe7,0x3d,0x8d,0x41,0x75,0x3e,0x9b,0x44,0xf7,0x30,0x33,0x2f,0x2a,0x55,0x56,0x55,0xe9,0x67,0x67,0x67,0xff,0x30,0x30,0x30,0xb9,0x36,0x36,0x37,0x04,0x43,0x43,0x43,0x36,0x43,0x42,0x43,0x8c,0x4a,0x49,0x4a,0xe8,0x7f,0x7e,0x7e,0xff,0x57,0x56,0x57,0xec,0x30,0x30,0x30,0x05,0x3d,0x98,0x40,0x84,0x3a,0x97,0x3f,0x70,0x3c,0x8c,0x3d,0x74,0x3a,0x89,0x38,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x8f,0x3f,0x85,0x3e,0x8a,0x3d,0x1e,0x41,0x9b,0x43,0xd9,0x40,0x8e,0x44,0x12,0x58,0x57,0x57,0x73,0x53,0x52,0x53,0xff,0x56,0x55,0x56,0xff,0x62,0x61,0x62,0xbf,0x66,0x66,0x66,0x6b,0x67,0x66,0x67,0x0f,0x00,0x00,0x00,0x00,0x5b,0x5b,0x5b,0xb6,0x44,0x44,0x44,0xff,0x5a,0x5a,0x59,0xff,0x6d,0x6d,0x6c,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x39,0x39,0x02,0x40,0xa2,0x48,0xf2,0x3f,0x9f,0x49,0xff,0x40,0x9e,0x48,0xff,0x3f,0x95,0x44,0x61,0x38,0x67,0x3a,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9b,0x47,0xec,0x40,0x9f,0x48,0xff,0x40,0x9b,0x47,0xe9,0x41,0x9e,0x48,0xc0,0x41,0xa0,0x49,0xff,0x41,0xa2,0x49,0xff,0x41,0xa2,0x4a,0xff,0x41,0xa2,0x4a,0xff,0x41,0x9f,0x4a,0xff,0x41,0x9e,0x49,0xf0,0x41,0x9b,0x49,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x9b,0x48,0x2f,0x40,0x9d,0x48,0xe1,0x40,0x9f,0x49,0xff,0x41,0xa0,0x4a,0xff,0x41,0xa2,0x4b,0xff,0x41,0xa2,0x4c,0xff,0x41,0xa2,0x4b,0xff,0x41,0xa0,0x4a,0xff,0x40,0x9e,0x49,0xe9,0x41,0x9c,0x49,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x9f,0x48,0x19,0x41,0x9f,0x48,0xd1,0x41,0xa0,0x49,0xff,0x42,0xa2,0x4b,0xff,0x42,0xa3,0x4c,0xff,0x43,0xa3,0x4c,0xff,0x43,0xa3,0x4c,0xff,0x42,0xa2,0x4b,0xff,0x41,0xa0,0x49,0xf0,0x41,0x9c,0x48,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xa2,0x4c,0xcc,0x42,0xa3,0x4c,0xff,0x42,0xa4,0x4c,0xff,0x3e,0x81,0x44,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfc,0xfb,0x4c,0xfd,0xfe,0xfe,0xff,0xfc,0xfe,0xff,0xff,0xf8,0xf9,0xf9,0xa3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf5,0xf6,0xf5,0x69,0xfd,0xfe,0xfe,0xff,0xfe,0xff,0xff,0xff,0xf7,0xf7,0xf7,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xf7,0xf7,0xb6,0xfd,0xfe,0xff,0xff,0xfe,0xfe,0xff,0xff,0xd9,0xda,0xda,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfc,0xfb,0xc5,0xfe,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xa8,0xa9,0xa8,0x1b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0xf6,0xf5,0x58,0xfb,0xfd,0xfd,0xfb,0xfe,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xfe,0xff,0xfc,0xfe,0xfd,0xff,0xf4,0xf6,0xf5,0xbb,0xfd,0xfe,0xfd,0xff,0xfe,0xff,0xfe,0xff,0xfa,0xfb,0xfb,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd6,0xd6,0xd6,0x04,0xfa,0xfa,0xfa,0xb4,0xfc,0xfe,0xff,0xff,0xfc,0xfe,0xff,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xf9,0xfc,0xfd,0xf6,0xf3,0xf5,0xf5,0xca,0xfc,0xfe,0xfe,0xff,0xfd,0xfe,0xff,0xff,0xf4,0xf5,0xf4,0x45,0xc2,0xc1,0xc2,0x05,0xfc,0xfc,0xfc,0xe0,0xfe,0xfe,0xff,0xff,0xf8,0xfa,0xfc,0xf8,0xd9,0xdb,0xdc,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc3,0xc5,0xc4,0x02,0xf8,0xfa,0xf9,0xe2,0xfc,0xfd,0xfd,0xff,0xf9,0xfa,0xfa,0xd9,0xb0,0xae,0xaf,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x9b,0x48,0x3c,0x43,0x9f,0x49,0xff,0x43,0x9f,0x49,0xff,0x42,0x8e,0x44,0x10,0x46,0x9c,0x4a,0xc8,0x47,0x98,0x4b,0x40,0x44,0x99,0x47,0xf6,0x3e,0x8e,0x41,0x6b,0x3e,0x99,0x44,0xee,0x2d,0x2d,0x2d,0x52,0x54,0x54,0x53,0xfc,0x5f,0x5e,0x5e,0xff,0x2b,0x2b,0x2b,0xa2,0x33,0x35,0x36,0x0c,0x49,0x49,0x49,0xe2,0x66,0x65,0x66,0xff,0x74,0x73,0x74,0xff,0x7c,0x7b,0x7b,0xff,0x3e,0x3e,0x3e,0xbc,0x00,0x00,0x00,0x00,0x3c,0x93,0x40,0xb9,0x3c,0x8d,0x3d,0x1b,0x3a,0x8d,0x3d,0xd0,0x3d,0x8f,0x3d,0x12,0x3e,0x99,0x41,0xb2,0x3f,0x97,0x44,0x5f,0x43,0x8d,0x41,0x6f,0x41,0x8e,0x3f,0x74,0x3e,0x91,0x3e,0x97,0x3d,0x8e,0x3e,0x4d,0x59,0x58,0x58,0x30,0x54,0x54,0x54,0xff,0x4c,0x4c,0x4c,0xff,0x4d,0x4d,0x4d,0xff,0x5a,0x5a,0x5a,0xff,0x66,0x66,0x66,0x66,0x00,0x00,0x00,0x00,0x5e,0x5e,0x5f,0xa0,0x42,0x42,0x42,0xff,0x55,0x55,0x56,0xff,0x6d,0x6d,0x6d,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9c,0x47,0xb6,0x40,0x9c,0x48,0xff,0x40,0x9c,0x49,0xff,0x41,0x9c,0x48,0xff,0x41,0x9b,0x47,0xcf,0x40,0x9c,0x47,0x7c,0x42,0x9c,0x45,0x39,0x43,0x7e,0x40,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x9a,0x47,0xea,0x40,0x9f,0x48,0xff,0x41,0xa1,0x49,0xff,0x42,0xa1,0x4a,0xff,0x41,0xa0,0x49,0xd4,0x41,0x9b,0x47,0x8d,0x40,0x9c,0x47,0x96,0x40,0x9c,0x47,0xea,0x40,0x9e,0x49,0xff,0x40,0xa0,0x4a,0xff,0x41,0xa3,0x49,0xe4,0x41,0x96,0x48,0x0d,0x00,0x00,0x00,0x00,0x40,0x9a,0x45,0x0e,0x41,0xa4,0x4b,0xdf,0x41,0xa1,0x4b,0xff,0x41,0x9e,0x4a,0xff,0x40,0x9b,0x48,0xdf,0x41,0x9c,0x4a,0x92,0x42,0x9e,0x4a,0x91,0x40,0x9d,0x49,0xdd,0x41,0x9e,0x4a,0xff,0x41,0xa0,0x4b,0xff,0x41,0xa3,0x4c,0xeb,0x42,0x9d,0x4a,0x1a,0x00,0x00,0x00,0x00,0x43,0x92,0x48,0x03,0x42,0xa4,0x4b,0xc9,0x41,0xa2,0x4b,0xff,0x42,0xa0,0x4b,0xff,0x42,0x9f,0x49,0xe6,0x43,0xa0,0x4b,0x95,0x42,0x9e,0x4a,0x8e,0x41,0x9d,0x49,0xd5,0x41,0xa0,0x4a,0xff,0x42,0xa2,0x4b,0xff,0x42,0xa5,0x4c,0xf5,0x42,0xa1,0x4a,0x2a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xa1,0x4c,0xcc,0x43,0xa2,0x4c,0xff,0x43,0xa3,0x4c,0xff,0x3f,0x7f,0x44,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfc,0xfb,0x4c,0xfd,0xfe,0xfe,0xff,0xfc,0xfd,0xff,0xff,0xf8,0xf9,0xf9,0xc0,0xe4,0xe4,0xe4,0x45,0xe8,0xe8,0xe7,0x3f,0xe6,0xe6,0xe3,0x3f,0xe5,0xe4,0xe2,0x43,0xf4,0xf5,0xf4,0x68,0xfc,0xfc,0xfc,0xea,0xfd,0xfe,0xff,0xff,0xf9,0xfb,0xfb,0xea,0xe2,0xe3,0xe3,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xf7,0xf7,0xb5,0xfd,0xfe,0xff,0xff,0xfe,0xff,0xff,0xff,0xda,0xdb,0xda,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfd,0xfc,0xc5,0xfd,0xfe,0xfe,0xff,0xfd,0xfe,0xfe,0xff,0xa5,0xa5,0xa5,0x1b,0x00,0x00,0x00,0x00,0xf2,0xf1,0xf2,0x1f,0xfd,0xfd,0xfe,0xf4,0xfd,0xfd,0xfe,0xff,0xfc,0xfe,0xfe,0xff,0xf9,0xf8,0xf8,0xcf,0xf4,0xf4,0xf4,0x7c,0xf0,0xf2,0xf2,0x85,0xf7,0xf9,0xf7,0xde,0xfe,0xfe,0xfe,0xff,0xfe,0xfe,0xfe,0xff,0xfd,0xfe,0xfe,0xff,0xf8,0xf9,0xf9,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xf9,0xf9,0x7e,0xff,0xff,0xff,0xff,0xfe,0xfe,0xff,0xff,0xfa,0xfd,0xfd,0xfa,0xf4,0xf5,0xf5,0x9e,0xf3,0xf4,0xf4,0x73,0xf2,0xf4,0xf4,0xa4,0xf9,0xfb,0xfa,0xfc,0xfc,0xfe,0xfe,0xff,0xfd,0xfe,0xfe,0xff,0xff,0xff,0xff,0xff,0xf7,0xf8,0xf7,0x45,0x00,0x00,0x00,0x00,0xf2,0xf4,0xf5,0x7c,0xfb,0xfd,0xfe,0xff,0xf9,0xfc,0xfe,0xff,0xf2,0xf3,0xf3,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xf4,0xf3,0x48,0xfc,0xfc,0xfd,0xff,0xfb,0xfc,0xfd,0xff,0xf0,0xf1,0xf1,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x9d,0x49,0x46,0x42,0x9f,0x49,0xff,0x43,0x9f,0x48,0xff,0x48,0x93,0x4a,0x0b,0x46,0x9c,0x4a,0xcc,0x44,0x8d,0x47,0x3f,0x43,0x98,0x47,0xfb,0x40,0x95,0x44,0x67,0x3e,0x96,0x43,0xe9,0x2d,0x2c,0x2c,0x73,0x51,0x51,0x50,0xff,0x59,0x58,0x58,0xff,0x2d,0x2d,0x2d,0x95,0x36,0x3d,0x3d,0x03,0x4b,0x4b,0x4b,0xe1,0x64,0x63,0x64,0xff,0x69,0x69,0x69,0xff,0x6f,0x6f,0x6f,0xff,0x37,0x37,0x37,0xb0,0x00,0x00,0x00,0x00,0x3d,0x8d,0x41,0xc5,0x3b,0x80,0x3d,0x12,0x39,0x86,0x3b,0xcc,0x3d,0x99,0x3f,0x32,0x3c,0x9b,0x41,0xff,0x3e,0x9a,0x43,0xb9,0x3f,0x8d,0x3e,0x5a,0x40,0x8b,0x3f,0x85,0x3c,0x88,0x3c,0x86,0x3a,0x84,0x3b,0x5d,0x5a,0x59,0x5a,0x1f,0x5b,0x5b,0x5b,0xff,0x48,0x48,0x48,0xff,0x48,0x48,0x48,0xff,0x4f,0x4f,0x4f,0xff,0x65,0x66,0x65,0x69,0x00,0x00,0x00,0x00,0x60,0x60,0x60,0x9a,0x3f,0x40,0x40,0xff,0x53,0x52,0x53,0xff,0x6d,0x6c,0x6c,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x96,0x45,0x25,0x40,0x9c,0x48,0xe1,0x40,0x9d,0x48,0xff,0x41,0x9d,0x48,0xff,0x41,0x9e,0x49,0xff,0x41,0xa0,0x49,0xff,0x41,0xa2,0x49,0xff,0x41,0xa2,0x48,0xeb,0x41,0xa0,0x47,0x96,0x3e,0x98,0x44,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x9c,0x47,0xe4,0x40,0x9f,0x49,0xff,0x41,0xa1,0x4a,0xff,0x42,0xa1,0x49,0xb3,0x3f,0x8d,0x46,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x93,0x42,0x16,0x40,0xa2,0x48,0xd8,0x40,0xa2,0x4b,0xff,0x41,0xa1,0x4b,0xff,0x41,0x9d,0x49,0x6d,0x00,0x00,0x00,0x00,0x3f,0x9d,0x47,0x6f,0x40,0xa0,0x4a,0xff,0x40,0xa2,0x4b,0xff,0x40,0xa1,0x4a,0xc7,0x3c,0x91,0x42,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x8e,0x40,0x09,0x40,0xa1,0x4a,0xc2,0x41,0xa2,0x4c,0xff,0x41,0xa1,0x4b,0xff,0x41,0x9e,0x49,0x91,0x00,0x00,0x00,0x00,0x40,0x9e,0x47,0x55,0x41,0xa0,0x4a,0xff,0x41,0xa3,0x4c,0xff,0x42,0xa3,0x4c,0xd5,0x3f,0x94,0x43,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x82,0x3f,0x04,0x40,0xa0,0x49,0xa8,0x41,0xa4,0x4d,0xff,0x42,0xa4,0x4c,0xff,0x42,0xa1,0x4a,0xae,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xa1,0x4c,0xcb,0x43,0xa2,0x4c,0xff,0x43,0xa3,0x4d,0xff,0x3e,0x7e,0x43,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xfb,0xfb,0x4c,0xfd,0xfe,0xfe,0xff,0xfd,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xfe,0xfe,0xfc,0xff,0xfd,0xfe,0xfe,0xff,0xff,0xff,0xff,0xff,0xfa,0xfa,0xfb,0xec,0xe8,0xe8,0xe9,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xf7,0xf7,0xb5,0xfe,0xfe,0xff,0xff,0xfe,0xff,0xff,0xff,0xdd,0xdd,0xdc,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfd,0xfd,0xc5,0xfd,0xfd,0xfe,0xff,0xfd,0xfd,0xfe,0xff,0xa2,0xa1,0xa2,0x19,0x00,0x00,0x00,0x00,0xf9,0xf9,0xfa,0x8b,0xfe,0xfe,0xfe,0xff,0xfe,0xfe,0xff,0xff,0xf7,0xf8,0xf8,0xb3,0xb7,0xb6,0xb3,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd6,0xd7,0xd5,0x0e,0xfb,0xfb,0xfb,0xce,0xfe,0xfe,0xff,0xff,0xfe,0xfe,0xff,0xff,0xf9,0xf9,0xf9,0xc5,0x00,0x00,0x00,0x00,0xd8,0xd9,0xda,0x07,0xf9,0xfb,0xfb,0xee,0xfc,0xfd,0xfe,0xff,0xfe,0xfe,0xfe,0xfe,0xee,0xee,0xee,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xee,0xef,0xee,0x4f,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xff,0xfe,0xff,0xff,0xff,0xf6,0xf6,0xf6,0x45,0x00,0x00,0x00,0x00,0xdf,0xe0,0xe1,0x15,0xf8,0xfb,0xfb,0xf6,0xfd,0xfe,0xff,0xff,0xf9,0xf9,0xf9,0xd4,0xb8,0xb8,0xba,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xfa,0xfa,0xaa,0xfd,0xfe,0xfe,0xff,0xf8,0xfb,0xfb,0xf2,0xd6,0xd8,0xd6,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x9b,0x48,0x44,0x42,0x9f,0x48,0xff,0x43,0x9f,0x48,0xff,0x45,0x94,0x47,0x0c,0x46,0x9b,0x49,0xca,0x42,0x8d,0x47,0x3d,0x43,0x96,0x46,0xf8,0x40,0x90,0x42,0x67,0x3e,0x95,0x42,0xeb,0x2d,0x2d,0x2d,0x70,0x4d,0x4d,0x4c,0xff,0x55,0x55,0x55,0xff,0x2f,0x2f,0x30,0x91,0x00,0x00,0x00,0x00,0x48,0x47,0x47,0xdf,0x5c,0x5c,0x5c,0xff,0x60,0x60,0x60,0xff,0x65,0x65,0x65,0xff,0x3f,0x3f,0x3f,0xb9,0x00,0x00,0x00,0x00,0x3f,0x91,0x43,0xa5,0x3c,0x92,0x40,0x2e,0x37,0x8a,0x3a,0xb8,0x34,0x83,0x34,0x20,0x3a,0x91,0x3c,0xce,0x3b,0x90,0x3d,0x3b,0x3b,0x8d,0x3b,0x89,0x3c,0x87,0x3d,0x3f,0x3d,0x90,0x3b,0xb9,0x3a,0x82,0x3a,0x36,0x62,0x63,0x62,0x27,0x5a,0x5a,0x5a,0xff,0x42,0x42,0x42,0xff,0x43,0x43,0x43,0xff,0x50,0x51,0x50,0xff,0x68,0x68,0x68,0x68,0x00,0x00,0x00,0x00,0x62,0x62,0x62,0x9d,0x3d,0x3e,0x3d,0xff,0x53,0x53,0x53,0xff,0x6e,0x6d,0x6d,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x95,0x44,0x0d,0x40,0x9c,0x46,0x73,0x3f,0x9e,0x46,0xd1,0x40,0xa0,0x47,0xff,0x41,0x9f,0x49,0xff,0x41,0x9f,0x49,0xff,0x41,0x9e,0x49,0xff,0x41,0x9d,0x49,0xff,0x40,0x9c,0x47,0xf3,0x40,0x9c,0x47,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9c,0x47,0xe0,0x40,0x9f,0x4a,0xff,0x42,0xa0,0x49,0xff,0x41,0x96,0x46,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9c,0x47,0x59,0x40,0x9f,0x4a,0xff,0x41,0x9d,0x4b,0xff,0x41,0x9c,0x4a,0xb3,0x00,0x00,0x00,0x00,0x40,0x9d,0x49,0xc3,0x40,0x9d,0x4a,0xff,0x40,0x9e,0x49,0xff,0x3f,0x98,0x46,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x9b,0x47,0x31,0x40,0xa1,0x4a,0xff,0x41,0x9e,0x4a,0xff,0x42,0x9f,0x4a,0xdc,0x00,0x00,0x00,0x00,0x40,0x9d,0x49,0xa8,0x41,0x9e,0x4a,0xff,0x41,0x9f,0x4a,0xff,0x41,0x9e,0x4a,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x96,0x46,0x15,0x41,0xa2,0x4b,0xfa,0x42,0xa0,0x4c,0xff,0x43,0xa0,0x4b,0xf5,0x43,0x80,0x45,0x05,0x00,0x00,0x00,0x00,0x43,0xa0,0x4c,0xcb,0x43,0xa1,0x4d,0xff,0x44,0xa2,0x4d,0xff,0x3e,0x7d,0x44,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xfb,0xfb,0x4c,0xfe,0xfe,0xff,0xff,0xfd,0xfe,0xff,0xff,0xfd,0xfe,0xfe,0xff,0xfc,0xfc,0xfc,0xfe,0xfc,0xfc,0xfc,0xfe,0xfc,0xfc,0xfc,0xfe,0xfa,0xfb,0xfa,0xfe,0xfc,0xfd,0xfd,0xfe,0xff,0xfe,0xff,0xff,0xfe,0xfe,0xff,0xff,0xf8,0xf9,0xfa,0xd8,0xec,0xef,0xf0,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xf7,0xf7,0xb5,0xfd,0xfe,0xfe,0xff,0xfe,0xff,0xff,0xff,0xdc,0xdc,0xdc,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xc5,0xfd,0xfd,0xfe,0xff,0xfe,0xfe,0xff,0xff,0xa2,0xa2,0xa3,0x19,0x00,0x00,0x00,0x00,0xf6,0xf8,0xf9,0xd4,0xfc,0xfd,0xfe,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xed,0xed,0xed,0x50,0xfc,0xfd,0xfe,0xff,0xfd,0xfd,0xff,0xff,0xf7,0xf7,0xf7,0xcb,0x00,0x00,0x00,0x00,0xea,0xea,0xeb,0x3c,0xfc,0xfd,0xfe,0xff,0xfb,0xfd,0xfe,0xff,0xf6,0xf7,0xf8,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xf9,0xf9,0xbf,0xfc,0xfd,0xfe,0xff,0xfd,0xfe,0xff,0xff,0xf4,0xf5,0xf5,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xf8,0xf8,0x9d,0xfe,0xfe,0xff,0xff,0xfe,0xfe,0xff,0xff,0xe7,0xe9,0xea,0x3c,0x00,0x00,0x00,0x00,0xec,0xec,0xec,0x12,0xfe,0xfe,0xfe,0xf7,0xfe,0xfe,0xff,0xff,0xf6,0xf6,0xf6,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x9c,0x48,0x30,0x41,0x9f,0x48,0xff,0x42,0xa0,0x48,0xff,0x3d,0x82,0x41,0x29,0x44,0x97,0x48,0xc2,0x43,0x96,0x48,0x42,0x41,0x96,0x44,0xe8,0x3c,0x86,0x3f,0x72,0x3e,0x97,0x43,0xf2,0x2f,0x2e,0x2e,0x63,0x47,0x46,0x47,0xff,0x52,0x52,0x52,0xff,0x33,0x34,0x34,0xa4,0x00,0x00,0x00,0x00,0x3a,0x3a,0x39,0x87,0x40,0x40,0x40,0xf1,0x4d,0x4d,0x4c,0xff,0x5d,0x5d,0x5c,0xff,0x4a,0x4a,0x49,0xe4,0x36,0x39,0x37,0x02,0x3f,0x8f,0x43,0x4c,0x3b,0x96,0x3f,0xb2,0x32,0x66,0x32,0x0f,0x31,0x7d,0x30,0x49,0x36,0x80,0x35,0xdd,0x34,0x7d,0x33,0x91,0x30,0x78,0x30,0x17,0x37,0x89,0x36,0x42,0x3a,0x8f,0x39,0xca,0x3e,0x44,0x3f,0x03,0x70,0x71,0x70,0x5e,0x54,0x55,0x54,0xff,0x45,0x46,0x46,0xff,0x57,0x57,0x58,0xfc,0x64,0x64,0x64,0xcc,0x66,0x66,0x65,0x34,0x00,0x00,0x00,0x00,0x65,0x65,0x65,0xab,0x3a,0x3a,0x3a,0xff,0x55,0x55,0x55,0xff,0x6d,0x6c,0x6c,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x93,0x41,0x1f,0x40,0x9c,0x45,0x5e,0x3f,0x99,0x46,0xb2,0x3f,0x9b,0x48,0xfc,0x40,0x9d,0x4a,0xff,0x41,0x9d,0x4a,0xff,0x43,0xa0,0x49,0xe1,0x3f,0x7e,0x44,0x05,0x00,0x00,0x00,0x00,0x40,0x9b,0x46,0xe9,0x40,0x9e,0x49,0xff,0x42,0x9f,0x49,0xfb,0x37,0x51,0x39,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x94,0x46,0x26,0x3f,0x9c,0x4a,0xff,0x40,0x9d,0x4a,0xff,0x41,0xa0,0x4a,0xcd,0x00,0x00,0x00,0x00,0x40,0xa1,0x48,0xde,0x3f,0x9d,0x49,0xff,0x40,0x9a,0x48,0xff,0x3e,0x90,0x43,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x77,0x3b,0x05,0x3f,0x9b,0x48,0xf8,0x41,0x9f,0x4a,0xff,0x43,0xa0,0x4b,0xfb,0x40,0x79,0x43,0x08,0x40,0xa3,0x4a,0xc8,0x41,0xa0,0x4b,0xff,0x41,0x9e,0x49,0xff,0x3a,0x77,0x3d,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x9b,0x4a,0xd7,0x42,0x9f,0x4b,0xff,0x43,0xa2,0x4c,0xff,0x40,0x8e,0x45,0x26,0x00,0x00,0x00,0x00,0x43,0x9f,0x4b,0xca,0x43,0xa0,0x4c,0xff,0x43,0xa2,0x4d,0xff,0x3f,0x7f,0x42,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xfb,0xfb,0x4c,0xfd,0xfe,0xfe,0xff,0xfd,0xfe,0xff,0xff,0xf7,0xf8,0xf7,0xa3,0xed,0xed,0xed,0x01,0xec,0xed,0xec,0x01,0xea,0xe9,0xe9,0x01,0xe2,0xe1,0xe1,0x01,0xc3,0xc4,0xc4,0x0c,0xf3,0xf4,0xf4,0x6b,0xf9,0xfb,0xfd,0xfb,0xfa,0xfc,0xfe,0xff,0xf7,0xf9,0xfa,0xde,0xca,0xcc,0xcd,0x06,0x00,0x00,0x00,0x00,0xf7,0xf7,0xf7,0xb5,0xfd,0xfe,0xfe,0xff,0xfe,0xff,0xff,0xff,0xda,0xda,0xda,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfd,0xfd,0xfd,0xc6,0xfe,0xfe,0xfe,0xff,0xfd,0xfe,0xff,0xff,0xa3,0xa3,0xa3,0x17,0x00,0x00,0x00,0x00,0xfb,0xfd,0xfd,0xe8,0xfb,0xfd,0xfe,0xff,0xf6,0xf8,0xf9,0xfe,0xc5,0xc5,0xc5,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdd,0xdf,0xdf,0x17,0xfb,0xfb,0xfd,0xff,0xfd,0xfd,0xff,0xff,0xf5,0xf5,0xf5,0xd0,0x00,0x00,0x00,0x00,0xef,0xf0,0xf0,0x5a,0xfe,0xfe,0xff,0xff,0xfa,0xfe,0xff,0xff,0xf1,0xf4,0xf5,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xf8,0xf9,0x8c,0xfb,0xfc,0xfe,0xff,0xfb,0xfd,0xff,0xff,0xf5,0xf7,0xf7,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xed,0xed,0xed,0x2d,0xfd,0xfe,0xfe,0xfd,0xf9,0xfd,0xff,0xff,0xf0,0xf4,0xf6,0xa4,0x00,0x00,0x00,0x00,0xf4,0xf6,0xf6,0x6d,0xfe,0xfe,0xfe,0xff,0xfd,0xfd,0xfe,0xfe,0xe5,0xe7,0xe7,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x8e,0x43,0x1a,0x41,0x9f,0x47,0xfe,0x42,0x9e,0x48,0xff,0x41,0x95,0x45,0x43,0x43,0x96,0x47,0x9f,0x3f,0x94,0x46,0x64,0x40,0x94,0x42,0xcd,0x3b,0x85,0x3d,0x7f,0x3f,0x98,0x42,0xfe,0x2d,0x3c,0x2e,0x61,0x40,0x40,0x40,0xfe,0x4d,0x4d,0x4d,0xff,0x3a,0x3a,0x39,0xd2,0x35,0x36,0x36,0x05,0x00,0x00,0x00,0x00,0x34,0x34,0x34,0x08,0x3a,0x3a,0x39,0xa1,0x53,0x53,0x52,0xff,0x51,0x51,0x51,0xff,0x47,0x47,0x47,0x45,0x00,0x00,0x00,0x00,0x38,0x8d,0x38,0x55,0x37,0x6d,0x32,0x07,0x35,0x86,0x35,0xf1,0x31,0x69,0x31,0xec,0x32,0x72,0x30,0xf1,0x34,0x7e,0x31,0x72,0x36,0x80,0x36,0x26,0x37,0x80,0x35,0x28,0x46,0x46,0x46,0x02,0x80,0x80,0x7f,0xb8,0x45,0x46,0x45,0xff,0x5f,0x5f,0x5f,0xf5,0x5b,0x5b,0x5b,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x64,0x64,0xd6,0x38,0x38,0x38,0xff,0x5a,0x5a,0x5b,0xff,0x6a,0x6a,0x6a,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x94,0x45,0x39,0x40,0x9e,0x49,0xfc,0x42,0x9f,0x4b,0xff,0x43,0xa0,0x4b,0xff,0x42,0x98,0x48,0x26,0x00,0x00,0x00,0x00,0x40,0x9b,0x46,0xe9,0x40,0x9e,0x49,0xff,0x41,0x9e,0x48,0xfe,0x3e,0x8d,0x44,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x99,0x46,0x35,0x40,0x9c,0x49,0xff,0x40,0x9c,0x4a,0xff,0x41,0x9d,0x49,0xc7,0x00,0x00,0x00,0x00,0x3f,0x9e,0x48,0xd6,0x40,0x9d,0x49,0xff,0x40,0x9b,0x49,0xff,0x3e,0x92,0x45,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x8c,0x41,0x11,0x41,0x9d,0x4a,0xff,0x42,0x9d,0x4b,0xff,0x43,0x9e,0x4b,0xf0,0x3c,0x6a,0x3f,0x04,0x3f,0xa1,0x49,0xc0,0x40,0x9e,0x4a,0xff,0x40,0x9d,0x49,0xff,0x3f,0x94,0x46,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x7b,0x3e,0x03,0x41,0x9e,0x4a,0xed,0x43,0x9e,0x4b,0xff,0x43,0x9f,0x4b,0xff,0x3e,0x82,0x41,0x15,0x00,0x00,0x00,0x00,0x42,0x9f,0x4b,0xca,0x42,0xa0,0x4c,0xff,0x43,0xa2,0x4c,0xff,0x41,0x84,0x47,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xfa,0xf9,0x4c,0xfd,0xfe,0xfe,0xff,0xfd,0xfe,0xff,0xff,0xf8,0xf8,0xf8,0xa3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf5,0xf6,0xf7,0xba,0xfc,0xfe,0xfe,0xff,0xfb,0xfd,0xfe,0xff,0xe2,0xe5,0xe5,0x42,0x00,0x00,0x00,0x00,0xf7,0xf8,0xf7,0xb4,0xfc,0xfe,0xfe,0xff,0xfd,0xff,0xff,0xff,0xe6,0xe6,0xe6,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfa,0xfb,0xfb,0xd7,0xfe,0xfe,0xfe,0xff,0xff,0xff,0xff,0xff,0xa3,0xa3,0xa2,0x19,0x00,0x00,0x00,0x00,0xf7,0xf9,0xf9,0xe2,0xfb,0xfd,0xfd,0xff,0xfa,0xfc,0xfd,0xff,0xd0,0xd1,0xd2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe3,0xe4,0xe5,0x26,0xfc,0xfd,0xfe,0xff,0xfc,0xfd,0xfe,0xff,0xf5,0xf6,0xf6,0xce,0x00,0x00,0x00,0x00,0xec,0xed,0xed,0x49,0xfb,0xfe,0xfe,0xff,0xfb,0xfe,0xfe,0xff,0xf4,0xf6,0xf6,0xaf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0xf8,0xf8,0x9c,0xfb,0xfd,0xfe,0xff,0xfc,0xfe,0xff,0xff,0xf6,0xf6,0xf6,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0xf8,0xf8,0xba,0xf8,0xfc,0xfe,0xff,0xf4,0xf9,0xfb,0xf8,0xcb,0xce,0xd0,0x18,0xf6,0xf7,0xf8,0xcf,0xfa,0xfd,0xfe,0xff,0xf4,0xf9,0xf8,0xbb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9c,0x47,0xe7,0x41,0x9c,0x48,0xff,0x42,0x98,0x46,0x70,0x42,0x95,0x46,0x74,0x3f,0x93,0x43,0x97,0x3f,0x93,0x41,0xa9,0x3b,0x83,0x3d,0x96,0x3f,0x98,0x42,0xfe,0x36,0x74,0x37,0x4a,0x3a,0x3a,0x3a,0xef,0x44,0x44,0x44,0xff,0x3b,0x3b,0x3b,0xfb,0x31,0x30,0x30,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x3c,0x3c,0x24,0x46,0x46,0x46,0xfd,0x4f,0x4f,0x4f,0xff,0x4d,0x4d,0x4d,0xce,0x48,0x47,0x45,0x0a,0x00,0x00,0x00,0x00,0x34,0x7e,0x32,0x4e,0x35,0x7c,0x33,0xfe,0x2e,0x4e,0x2e,0xfb,0x30,0x61,0x2e,0xfb,0x36,0x7d,0x33,0xd4,0x3d,0x3e,0x3d,0x04,0x24,0x24,0x24,0x01,0x91,0x91,0x92,0x48,0x75,0x76,0x76,0xfe,0x44,0x44,0x44,0xff,0x6c,0x6c,0x6c,0xa8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x65,0x67,0x0d,0x5f,0x5f,0x5f,0xfc,0x35,0x35,0x35,0xff,0x63,0x63,0x63,0xf2,0x4b,0x4e,0x4b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xa0,0x47,0x79,0x43,0x9e,0x48,0x67,0x43,0x7b,0x47,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x52,0x2e,0x01,0x41,0x9c,0x48,0xea,0x42,0x9d,0x4a,0xff,0x42,0x9e,0x4b,0xff,0x41,0x96,0x46,0x29,0x00,0x00,0x00,0x00,0x40,0x9d,0x47,0xe2,0x40,0x9e,0x49,0xff,0x41,0x9c,0x48,0xff,0x41,0x9a,0x47,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xa0,0x48,0x9c,0x40,0xa0,0x4a,0xff,0x40,0x9c,0x49,0xff,0x3f,0x99,0x47,0x95,0x00,0x00,0x00,0x00,0x3e,0x9a,0x45,0x9e,0x3f,0x9c,0x48,0xff,0x40,0x9f,0x4a,0xff,0x41,0xa0,0x4a,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xa0,0x49,0x75,0x42,0xa1,0x4b,0xff,0x43,0x9f,0x4b,0xff,0x42,0x9c,0x49,0xb7,0x00,0x00,0x00,0x00,0x3e,0x9a,0x45,0x82,0x3f,0x9d,0x49,0xff,0x40,0xa0,0x4b,0xff,0x42,0xa2,0x4c,0xa0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x9e,0x4a,0x57,0x43,0xa3,0x4d,0xff,0x43,0xa0,0x4d,0xff,0x43,0x9d,0x4a,0xd6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x9f,0x4b,0xca,0x42,0xa0,0x4c,0xff,0x43,0xa2,0x4c,0xff,0x3f,0x80,0x43,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xf9,0xf9,0x4c,0xfd,0xfe,0xfe,0xff,0xfc,0xfe,0xfe,0xff,0xf8,0xf9,0xf8,0xa3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xf7,0xf7,0xc0,0xfd,0xfe,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xe8,0xe9,0xe9,0x55,0x00,0x00,0x00,0x00,0xf6,0xf7,0xf7,0xa6,0xfb,0xfd,0xfd,0xff,0xfc,0xfd,0xfe,0xff,0xef,0xf1,0xf1,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xee,0xf0,0xf0,0x34,0xfb,0xfd,0xfc,0xfd,0xfc,0xfd,0xfd,0xff,0xfe,0xff,0xfe,0xff,0xa3,0xa4,0xa3,0x17,0x00,0x00,0x00,0x00,0xf5,0xf9,0xf8,0xad,0xfd,0xfe,0xfe,0xff,0xfe,0xff,0xff,0xff,0xf2,0xf3,0xf3,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf6,0xf6,0xf6,0x84,0xfe,0xfe,0xfe,0xff,0xfd,0xfe,0xff,0xff,0xf4,0xf7,0xf7,0xc9,0x00,0x00,0x00,0x00,0xd4,0xd6,0xd7,0x17,0xfa,0xfd,0xfd,0xfb,0xfd,0xff,0xff,0xff,0xfc,0xfd,0xfd,0xf5,0xe1,0xe2,0xe3,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe5,0xe6,0xe6,0x11,0xf9,0xfb,0xfb,0xeb,0xfc,0xfd,0xfe,0xff,0xfd,0xfe,0xff,0xff,0xf6,0xf6,0xf6,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0xea,0xeb,0x4a,0xf9,0xfc,0xfe,0xff,0xf9,0xfd,0xfe,0xff,0xea,0xed,0xee,0xa4,0xf8,0xfb,0xfd,0xff,0xf8,0xfd,0xfe,0xff,0xed,0xed,0xed,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x9b,0x47,0xb0,0x41,0x9b,0x48,0xff,0x41,0x97,0x47,0xad,0x3e,0x90,0x41,0x3a,0x40,0x95,0x43,0xd8,0x41,0x93,0x42,0x69,0x3f,0x91,0x40,0xb3,0x3f,0x92,0x41,0xdc,0x3c,0x90,0x3e,0x6c,0x37,0x36,0x37,0xb9,0x3f,0x3e,0x3f,0xff,0x3c,0x3c,0x3c,0xff,0x36,0x36,0x36,0x8c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x3a,0x3a,0x0d,0x40,0x40,0x40,0xf3,0x48,0x47,0x48,0xff,0x49,0x49,0x4a,0xff,0x54,0x52,0x52,0xb1,0x56,0x54,0x54,0x0a,0x33,0x7b,0x32,0x8d,0x36,0x81,0x35,0xff,0x34,0x75,0x35,0xff,0x36,0x7e,0x35,0xff,0x36,0x80,0x34,0xff,0x36,0x6e,0x33,0x16,0x9e,0x9e,0x9f,0x35,0x96,0x97,0x97,0xec,0x3f,0x3e,0x3f,0xff,0x44,0x44,0x45,0xff,0x68,0x68,0x69,0xa3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x77,0x78,0x51,0x50,0x50,0x51,0xff,0x33,0x33,0x33,0xff,0x6b,0x6b,0x6b,0xbe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x99,0x45,0x17,0x40,0x9f,0x47,0xf5,0x40,0x9d,0x48,0xff,0x40,0x99,0x47,0xdc,0x40,0x97,0x46,0x83,0x42,0x97,0x46,0x42,0x41,0x90,0x45,0x25,0x41,0x94,0x46,0x38,0x41,0x99,0x47,0x9b,0x41,0x9c,0x49,0xff,0x42,0x9c,0x49,0xff,0x42,0x9c,0x49,0xe7,0x40,0x80,0x41,0x06,0x00,0x00,0x00,0x00,0x3f,0x9c,0x47,0xdd,0x40,0x9e,0x49,0xff,0x41,0x9c,0x48,0xff,0x41,0x9d,0x48,0xfd,0x41,0x9d,0x48,0x89,0x43,0x94,0x46,0x2e,0x42,0x94,0x47,0x2e,0x41,0x99,0x47,0x94,0x41,0x9f,0x49,0xfe,0x41,0x9f,0x4a,0xff,0x40,0xa0,0x49,0xfe,0x3e,0x96,0x44,0x37,0x00,0x00,0x00,0x00,0x3d,0x99,0x43,0x34,0x3f,0xa1,0x48,0xfd,0x40,0x9e,0x49,0xff,0x40,0x9d,0x47,0xfd,0x3f,0x99,0x45,0x88,0x40,0x94,0x45,0x28,0x44,0x94,0x46,0x25,0x43,0x9c,0x49,0x79,0x43,0xa0,0x4a,0xfa,0x42,0xa0,0x4b,0xff,0x42,0x9f,0x49,0xff,0x40,0x98,0x46,0x47,0x00,0x00,0x00,0x00,0x3d,0x96,0x43,0x1f,0x3f,0xa1,0x4b,0xf6,0x40,0x9f,0x4a,0xff,0x41,0x9f,0x49,0xff,0x40,0x9b,0x47,0x98,0x41,0x97,0x47,0x2b,0x46,0x97,0x47,0x23,0x43,0x9b,0x48,0x70,0x41,0x9c,0x48,0xf4,0x42,0x9e,0x4a,0xff,0x42,0xa2,0x4c,0xff,0x42,0xa1,0x4c,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x9c,0x4b,0xcb,0x43,0x9e,0x4c,0xff,0x44,0xa1,0x4c,0xff,0x3f,0x7f,0x44,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xf8,0xf7,0x4c,0xfc,0xfe,0xfd,0xff,0xfa,0xfc,0xfe,0xff,0xf3,0xf4,0xf5,0xb8,0xdc,0xdc,0xdd,0x3a,0xdd,0xdd,0xdd,0x3a,0xdd,0xde,0xde,0x3b,0xde,0xdf,0xdf,0x3b,0xed,0xed,0xed,0x3e,0xf4,0xf5,0xf4,0x90,0xfb,0xfc,0xfb,0xfe,0xfc,0xfe,0xfd,0xff,0xfe,0xfe,0xfe,0xfd,0xe4,0xe4,0xe4,0x21,0x00,0x00,0x00,0x00,0xf3,0xf5,0xf5,0x71,0xfd,0xfe,0xfe,0xff,0xfd,0xfe,0xfe,0xff,0xfb,0xfc,0xfc,0xf2,0xf1,0xf3,0xf3,0x65,0xdc,0xdb,0xdc,0x37,0xf1,0xf2,0xf3,0x63,0xfc,0xfd,0xfd,0xe7,0xfe,0xfe,0xfe,0xff,0xfc,0xfd,0xfd,0xff,0xfa,0xfc,0xfc,0xff,0xa6,0xa7,0xa6,0x13,0x00,0x00,0x00,0x00,0xf3,0xf3,0xf3,0x4d,0xff,0xff,0xff,0xff,0xfd,0xfe,0xff,0xff,0xf9,0xfc,0xfd,0xfb,0xef,0xf3,0xf3,0x78,0xde,0xde,0xdf,0x1e,0xe0,0xe1,0xe1,0x20,0xf5,0xf6,0xf6,0x7e,0xfe,0xfe,0xfe,0xfc,0xfd,0xfe,0xfe,0xff,0xfc,0xfe,0xfe,0xff,0xf3,0xf6,0xf6,0xc9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xf8,0xf8,0xb0,0xff,0xff,0xff,0xff,0xfd,0xfe,0xff,0xff,0xf6,0xf8,0xf9,0xd9,0xe9,0xeb,0xec,0x49,0xdd,0xde,0xdd,0x18,0xeb,0xed,0xed,0x3b,0xf9,0xfb,0xfb,0xca,0xfe,0xff,0xfe,0xff,0xfd,0xfe,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xf6,0xf6,0xf6,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xaa,0xab,0x01,0xf9,0xfa,0xfa,0xd6,0xfe,0xfe,0xff,0xff,0xfc,0xfe,0xfe,0xff,0xfc,0xfd,0xfe,0xff,0xf4,0xf8,0xf9,0xdf,0x90,0x96,0x95,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x99,0x46,0x6d,0x42,0x9a,0x48,0xff,0x42,0x9a,0x48,0xef,0x3f,0x84,0x42,0x0a,0x3f,0x97,0x42,0xe7,0x3d,0x8c,0x40,0x56,0x40,0x97,0x44,0xee,0x3c,0x8e,0x3f,0xa5,0x3c,0x8f,0x3e,0xad,0x35,0x35,0x35,0x76,0x3a,0x3a,0x3a,0xff,0x3c,0x3c,0x3c,0xff,0x3a,0x3a,0x3a,0xd5,0x3e,0x3d,0x3e,0x02,0x00,0x00,0x00,0x00,0x3c,0x3b,0x3c,0x76,0x41,0x40,0x41,0xff,0x42,0x41,0x42,0xff,0x42,0x41,0x42,0xff,0x48,0x47,0x48,0xff,0x5e,0x5e,0x5e,0xdf,0x4d,0x54,0x4d,0xbf,0x2e,0x49,0x2e,0xed,0x2c,0x48,0x2c,0xfc,0x2d,0x4c,0x2d,0xf8,0x43,0x5e,0x43,0xa1,0xa6,0xa6,0xa6,0x81,0x99,0x99,0x9a,0xf6,0x47,0x47,0x47,0xff,0x38,0x37,0x38,0xff,0x37,0x36,0x38,0xff,0x5b,0x5b,0x5c,0xfb,0x66,0x65,0x65,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x81,0xae,0x38,0x38,0x38,0xfe,0x47,0x47,0x47,0xff,0x6d,0x6d,0x6d,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x99,0x46,0x48,0x40,0x9a,0x46,0xf9,0x3f,0x99,0x46,0xff,0x40,0x9b,0x47,0xff,0x41,0x9d,0x48,0xff,0x41,0x9e,0x48,0xff,0x41,0x9d,0x48,0xff,0x40,0x9c,0x48,0xff,0x41,0x9d,0x49,0xff,0x41,0x9e,0x49,0xff,0x41,0x9e,0x49,0xfe,0x42,0x99,0x48,0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x9b,0x47,0xd9,0x40,0x9e,0x48,0xff,0x42,0xa0,0x49,0xff,0x40,0x9d,0x47,0xf8,0x42,0x9f,0x49,0xff,0x43,0x9e,0x49,0xff,0x42,0x9e,0x4a,0xff,0x41,0x9c,0x48,0xff,0x40,0x9c,0x48,0xff,0x41,0x9d,0x48,0xff,0x40,0x9e,0x47,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x9c,0x46,0x77,0x3f,0x9a,0x45,0xff,0x40,0x9b,0x47,0xff,0x41,0x9c,0x47,0xff,0x42,0x9e,0x48,0xff,0x41,0x9d,0x47,0xff,0x41,0x9c,0x48,0xff,0x41,0x9e,0x48,0xff,0x41,0xa0,0x49,0xff,0x41,0x9e,0x47,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x9d,0x47,0x5c,0x3e,0x9b,0x47,0xfc,0x40,0x9b,0x48,0xff,0x41,0x9d,0x48,0xff,0x42,0x9f,0x49,0xff,0x42,0xa1,0x4a,0xff,0x42,0x9f,0x4b,0xff,0x42,0x9e,0x49,0xff,0x41,0x9c,0x49,0xff,0x40,0x9a,0x47,0xa7,0x3b,0x7c,0x41,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x9f,0x4c,0xce,0x43,0x9f,0x4c,0xff,0x44,0x9f,0x4c,0xff,0x3f,0x7b,0x43,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xf7,0xf8,0x4c,0xfe,0xfe,0xfe,0xff,0xfd,0xfe,0xfe,0xff,0xfc,0xfe,0xfe,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xfe,0xff,0xfe,0xff,0xfd,0xfe,0xfd,0xff,0xfd,0xfe,0xfd,0xff,0xfc,0xfd,0xfd,0xff,0xf2,0xf3,0xf3,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe2,0xe3,0xe3,0x17,0xfd,0xfd,0xfd,0xed,0xfe,0xff,0xff,0xff,0xfd,0xfe,0xfe,0xff,0xfc,0xfe,0xfe,0xff,0xfe,0xfe,0xfe,0xff,0xfb,0xfd,0xfd,0xff,0xfa,0xfc,0xfc,0xfd,0xf8,0xf9,0xf8,0xe4,0xfc,0xfe,0xfd,0xff,0xfd,0xfe,0xfe,0xff,0xa7,0xa7,0xa7,0x14,0x00,0x00,0x00,0x00,0xac,0xaf,0xad,0x01,0xf5,0xf6,0xf6,0xa8,0xfc,0xfd,0xfe,0xff,0xfd,0xfe,0xff,0xff,0xfe,0xff,0xff,0xff,0xfe,0xfe,0xfe,0xff,0xfe,0xfe,0xfe,0xff,0xfc,0xfe,0xfe,0xff,0xf6,0xf8,0xf9,0xe9,0xfb,0xfc,0xfa,0xf9,0xfd,0xfe,0xfe,0xff,0xf6,0xf7,0xf7,0xcc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xea,0xea,0xeb,0x1f,0xfa,0xfb,0xfb,0xe8,0xfc,0xfe,0xff,0xff,0xfc,0xfe,0xff,0xff,0xfe,0xfe,0xff,0xff,0xfe,0xfe,0xfe,0xff,0xfc,0xfd,0xfd,0xff,0xfc,0xfe,0xfe,0xff,0xf7,0xf8,0xf7,0xe5,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xff,0xf6,0xf6,0xf5,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xf3,0xf4,0x67,0xfe,0xfe,0xfe,0xff,0xfd,0xfe,0xfe,0xff,0xfe,0xff,0xff,0xff,0xf3,0xf5,0xf5,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x93,0x45,0x1a,0x41,0x9a,0x47,0xfb,0x41,0x9a,0x48,0xff,0x42,0x96,0x46,0x56,0x3f,0x95,0x42,0x85,0x3d,0x94,0x40,0x9d,0x3f,0x94,0x44,0xc5,0x39,0x85,0x3d,0xbc,0x3c,0x90,0x3e,0xf5,0x34,0x4c,0x35,0x2f,0x38,0x37,0x37,0xfc,0x3a,0x3a,0x3a,0xff,0x3d,0x3d,0x3d,0xfc,0x3f,0x3d,0x3e,0x28,0x00,0x00,0x00,0x00,0x3b,0x3a,0x3c,0xc2,0x3d,0x3d,0x3e,0xff,0x3e,0x3e,0x3e,0xff,0x3f,0x3f,0x3f,0xff,0x3f,0x3f,0x40,0xff,0x43,0x43,0x43,0xff,0x58,0x58,0x58,0xff,0x66,0x67,0x67,0xfe,0x6e,0x6e,0x6e,0xff,0x78,0x79,0x79,0xff,0x85,0x85,0x86,0xff,0x6b,0x6b,0x6c,0xff,0x3a,0x39,0x3a,0xff,0x38,0x37,0x38,0xff,0x37,0x36,0x37,0xff,0x36,0x35,0x36,0xff,0x57,0x57,0x58,0xfe,0x68,0x67,0x69,0x44,0x00,0x00,0x00,0x00,0x82,0x83,0x84,0x1e,0x74,0x75,0x75,0xf0,0x33,0x34,0x34,0xf9,0x61,0x61,0x61,0xfb,0x6a,0x69,0x69,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x8e,0x42,0x22,0x3f,0x98,0x45,0x90,0x40,0x9d,0x46,0xe7,0x41,0x9c,0x47,0xff,0x40,0x99,0x48,0xff,0x41,0x9a,0x48,0xff,0x40,0x9c,0x48,0xff,0x40,0x9e,0x48,0xff,0x41,0x9e,0x49,0xe0,0x41,0x9c,0x47,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x9b,0x46,0xd5,0x3f,0x9d,0x48,0xff,0x41,0xa0,0x48,0xfd,0x3c,0x8d,0x41,0x42,0x40,0x9a,0x47,0xd7,0x42,0x9d,0x49,0xff,0x42,0x9e,0x4a,0xff,0x42,0x9e,0x49,0xff,0x41,0x9c,0x47,0xf3,0x40,0x95,0x43,0x7d,0x39,0x7b,0x39,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x94,0x42,0x53,0x40,0x9b,0x45,0xdb,0x41,0x9d,0x47,0xff,0x42,0x9c,0x48,0xff,0x41,0x9d,0x48,0xff,0x41,0x9c,0x48,0xff,0x40,0x99,0x45,0xe5,0x40,0x97,0x45,0x65,0x36,0x71,0x3b,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x94,0x43,0x40,0x40,0x9b,0x46,0xce,0x41,0x9f,0x48,0xff,0x41,0x9c,0x48,0xff,0x41,0x9c,0x49,0xff,0x41,0x9d,0x4a,0xff,0x41,0xa0,0x49,0xea,0x41,0x9c,0x48,0x74,0x38,0x7f,0x3b,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xa0,0x4c,0xd1,0x43,0xa2,0x4c,0xff,0x44,0xa0,0x4b,0xff,0x3c,0x79,0x3f,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xf7,0xf7,0x4b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xfe,0xfe,0xff,0xfe,0xfe,0xfe,0xff,0xfc,0xfd,0xfd,0xfb,0xf9,0xfa,0xfa,0xce,0xf3,0xf3,0xf2,0x65,0xb1,0xb0,0xad,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xf3,0xf3,0x3d,0xfb,0xfb,0xfb,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xfe,0xfe,0xff,0xf7,0xf9,0xf9,0xee,0xed,0xee,0xee,0x5f,0xfe,0xfe,0xfe,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xac,0xaa,0xab,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0xbb,0xb9,0x06,0xf6,0xf7,0xf6,0x89,0xfd,0xfd,0xfd,0xf7,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xfd,0xfe,0xff,0xff,0xf5,0xf7,0xf7,0xcd,0xe2,0xe2,0xe2,0x29,0xfc,0xfd,0xfa,0xef,0xff,0xff,0xfe,0xff,0xf7,0xf6,0xf6,0xcd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe4,0xe4,0xe6,0x24,0xf7,0xf8,0xf7,0xbe,0xfe,0xfe,0xfe,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xfd,0xfd,0xfb,0xf4,0xf4,0xf4,0x89,0xf7,0xf7,0xf7,0x6b,0xff,0xff,0xfe,0xff,0xfe,0xfe,0xfd,0xff,0xf6,0xf6,0xf6,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd5,0xd5,0xd5,0x0b,0xfb,0xfb,0xfc,0xf0,0xfd,0xfe,0xff,0xff,0xfc,0xfd,0xfd,0xf8,0xdd,0xdd,0xdc,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x98,0x46,0xaf,0x41,0x99,0x46,0xff,0x40,0x97,0x45,0xcb,0x3d,0x8a,0x40,0x1b,0x3e,0x93,0x41,0xef,0x3a,0x8a,0x3f,0x90,0x3a,0x87,0x3e,0xeb,0x3b,0x8a,0x3e,0xf8,0x3b,0x88,0x3d,0x63,0x38,0x38,0x38,0xbb,0x39,0x38,0x39,0xff,0x3a,0x39,0x3a,0xff,0x41,0x40,0x41,0x91,0x00,0x00,0x00,0x00,0x38,0x38,0x39,0x25,0x3a,0x3a,0x3a,0xe4,0x3d,0x3d,0x3d,0xff,0x3d,0x3d,0x3d,0xfe,0x42,0x42,0x42,0xe8,0x43,0x43,0x43,0xff,0x3c,0x3d,0x3d,0xff,0x39,0x39,0x3a,0xff,0x38,0x38,0x39,0xff,0x37,0x36,0x37,0xff,0x36,0x35,0x36,0xff,0x43,0x43,0x44,0xff,0x5c,0x5c,0x5c,0xec,0x63,0x63,0x63,0xed,0x48,0x47,0x48,0xff,0x4f,0x4f,0x4f,0xff,0x6b,0x6b,0x6b,0x7a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,0x90,0x91,0x9b,0x4a,0x4a,0x4a,0xce,0x3b,0x3c,0x3c,0xe7,0x72,0x72,0x72,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x74,0x3c,0x03,0x3d,0x91,0x41,0x25,0x3e,0x93,0x43,0x50,0x3f,0x98,0x44,0x5e,0x3f,0x95,0x43,0x58,0x3f,0x96,0x44,0x2b,0x3c,0x78,0x3c,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x9a,0x45,0xd9,0x3f,0x9c,0x47,0xff,0x40,0x9d,0x47,0xfe,0x36,0x69,0x38,0x18,0x3e,0x86,0x41,0x04,0x3e,0x95,0x43,0x39,0x40,0x97,0x43,0x5e,0x40,0x99,0x45,0x4a,0x3d,0x8d,0x40,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x6f,0x3a,0x02,0x3c,0x93,0x41,0x29,0x3e,0x95,0x40,0x58,0x3f,0x99,0x43,0x5d,0x3e,0x97,0x43,0x34,0x39,0x82,0x3f,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x44,0x24,0x01,0x3d,0x97,0x43,0x25,0x3f,0x97,0x43,0x55,0x3e,0x93,0x43,0x5c,0x3d,0x91,0x41,0x35,0x3a,0x87,0x41,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x7f,0x40,0x1f,0x3c,0x7a,0x3d,0x2d,0x3d,0x80,0x3e,0x28,0x47,0x85,0x48,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd4,0xd3,0xd2,0x08,0xbf,0xbe,0xbe,0x2b,0xc1,0xc0,0xc0,0x29,0xbc,0xbd,0xbc,0x2c,0xbc,0xbc,0xbb,0x2c,0xbc,0xbd,0xbd,0x2a,0xc0,0xc0,0xc0,0x27,0xc7,0xc8,0xc7,0x22,0xe4,0xe5,0xe4,0x15,0xcd,0xce,0xce,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xce,0xce,0x05,0xe7,0xe7,0xe8,0x41,0xf3,0xf4,0xf4,0x5e,0xe6,0xe8,0xe9,0x49,0xcc,0xcd,0xcd,0x0a,0x00,0x00,0x00,0x00,0xc4,0xc4,0xc3,0x16,0xbf,0xbf,0xbf,0x2a,0xc5,0xc5,0xc4,0x24,0xac,0xac,0xab,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd6,0xd6,0xd6,0x10,0xed,0xed,0xed,0x4d,0xef,0xf1,0xf1,0x5e,0xe4,0xe5,0xe6,0x33,0x92,0x91,0x91,0x02,0x00,0x00,0x00,0x00,0xc2,0xc2,0xc2,0x21,0xbe,0xbd,0xbd,0x28,0xc3,0xc1,0xc1,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe4,0xe4,0xe4,0x25,0xea,0xeb,0xea,0x5a,0xe9,0xea,0xea,0x54,0xda,0xdc,0xda,0x1a,0x00,0x00,0x00,0x00,0xcd,0xcc,0xcb,0x0c,0xb7,0xb7,0xb5,0x2c,0xbc,0xbc,0xb9,0x28,0xc6,0xc6,0xc4,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe9,0xea,0xea,0x1d,0xf9,0xfb,0xfb,0xf9,0xfa,0xfe,0xff,0xff,0xf3,0xf7,0xf6,0xa3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x95,0x44,0x38,0x40,0x98,0x46,0xfe,0x40,0x97,0x45,0xff,0x3e,0x93,0x43,0x4f,0x3e,0x8e,0x3f,0x7c,0x3c,0x8a,0x3e,0xd4,0x39,0x89,0x3d,0xe5,0x38,0x82,0x3c,0xfb,0x3a,0x8d,0x3e,0xcd,0x38,0x38,0x38,0x3c,0x38,0x37,0x38,0xff,0x36,0x36,0x36,0xff,0x3e,0x3e,0x3e,0xfa,0x43,0x43,0x43,0x39,0x00,0x00,0x00,0x00,0x39,0x39,0x39,0x2d,0x3a,0x3b,0x3a,0xb2,0x3d,0x3c,0x3d,0x47,0x2f,0x2d,0x2f,0x01,0x47,0x46,0x47,0x45,0x4a,0x4a,0x4a,0xd7,0x3a,0x3a,0x3a,0xff,0x38,0x37,0x38,0xff,0x36,0x36,0x37,0xff,0x49,0x48,0x49,0xff,0x5b,0x5a,0x5b,0x70,0x57,0x56,0x57,0x09,0x68,0x67,0x68,0x10,0x6d,0x6d,0x6d,0x8e,0x6d,0x6d,0x6d,0x8c,0x51,0x54,0x4d,0x01,0x00,0x00,0x00,0x00,0x9b,0x9d,0x9e,0x40,0x7c,0x7d,0x7d,0xf6,0x30,0x30,0x31,0xf3,0x5f,0x60,0x60,0xe6,0x6f,0x6f,0x6f,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x98,0x45,0xda,0x3f,0x9b,0x47,0xff,0x41,0x9c,0x47,0xfe,0x37,0x6c,0x3a,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf2,0xf4,0xf5,0x78,0xf7,0xf7,0xf8,0x86,0xfa,0xfa,0xfa,0x5e,0xfa,0xfb,0xfb,0xce,0xfc,0xfd,0xff,0xff,0xf7,0xfd,0xfd,0xfd,0xe4,0xe7,0xe8,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x96,0x43,0xaa,0x3f,0x96,0x44,0xff,0x3e,0x95,0x43,0xe1,0x3b,0x84,0x3f,0x17,0x3c,0x8d,0x3e,0xca,0x37,0x7f,0x3a,0xef,0x3a,0x88,0x3d,0xff,0x3a,0x8a,0x3d,0xff,0x3a,0x83,0x3b,0x54,0x38,0x39,0x39,0xb0,0x35,0x36,0x36,0xff,0x37,0x37,0x37,0xff,0x45,0x45,0x45,0xda,0x44,0x45,0x44,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0x4c,0x4c,0x63,0x3d,0x3d,0x3d,0xff,0x37,0x37,0x37,0xff,0x37,0x37,0x37,0xff,0x51,0x51,0x51,0xe4,0x43,0x44,0x43,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xac,0xac,0xad,0x1a,0xa4,0xa5,0xa5,0xe3,0x3b,0x3c,0x3c,0xfc,0x41,0x41,0x42,0xfd,0x71,0x71,0x71,0xb3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x99,0x45,0xd7,0x3f,0x99,0x46,0xff,0x41,0x99,0x46,0xfd,0x39,0x6b,0x3a,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xe1,0xe3,0x10,0xf9,0xfa,0xfb,0xee,0xfd,0xfe,0xfe,0xff,0xff,0xfe,0xff,0xff,0xfe,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xf3,0xf6,0xf5,0x9a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x8d,0x41,0x1b,0x3e,0x94,0x42,0xeb,0x3d,0x93,0x42,0xff,0x3c,0x90,0x41,0xaf,0x3a,0x84,0x3c,0x21,0x3a,0x8a,0x3d,0xe4,0x38,0x82,0x3a,0xff,0x39,0x88,0x3c,0xff,0x3a,0x89,0x3c,0xdd,0x39,0x52,0x39,0x2b,0x39,0x39,0x39,0xef,0x34,0x35,0x35,0xff,0x39,0x39,0x39,0xff,0x48,0x48,0x48,0xc3,0x46,0x47,0x46,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x49,0x49,0x19,0x48,0x49,0x49,0xfc,0x47,0x47,0x47,0xff,0x49,0x49,0x49,0xff,0x54,0x55,0x54,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb2,0xb3,0xb3,0x18,0xb8,0xb9,0xb9,0xd2,0x56,0x56,0x56,0xfd,0x39,0x39,0x39,0xfe,0x6e,0x6e,0x6e,0xf0,0x71,0x71,0x72,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x9b,0x45,0xb1,0x3f,0x9a,0x44,0xd7,0x40,0x99,0x45,0xd2,0x3a,0x68,0x3b,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe2,0xe4,0xe5,0x10,0xf8,0xf8,0xf9,0x96,0xf8,0xf9,0xf8,0xeb,0xfb,0xfd,0xfc,0xfc,0xf9,0xf9,0xf9,0xe4,0xf7,0xf8,0xf8,0x7c,0xc3,0xc3,0xc3,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x90,0x40,0x4c,0x3d,0x90,0x41,0xfd,0x3c,0x8f,0x41,0xff,0x3a,0x8a,0x3e,0x9b,0x39,0x82,0x3a,0x2c,0x38,0x89,0x3a,0xe2,0x39,0x89,0x3a,0xff,0x39,0x89,0x3b,0xff,0x39,0x87,0x3a,0x99,0x38,0x3a,0x39,0x58,0x36,0x36,0x36,0xfe,0x33,0x33,0x33,0xff,0x3a,0x3a,0x3a,0xff,0x4e,0x4e,0x4e,0xd2,0x4d,0x4c,0x4d,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0x4d,0x4d,0x2c,0x50,0x4f,0x4f,0x34,0x51,0x51,0x51,0x34,0x51,0x50,0x50,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xaf,0xb0,0x30,0xb4,0xb5,0xb6,0xde,0x5a,0x5b,0x5b,0xfe,0x33,0x33,0x34,0xfe,0x65,0x65,0x65,0xfd,0x77,0x76,0x77,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x8c,0x3e,0x6c,0x3c,0x8e,0x3f,0xfe,0x3b,0x8d,0x3f,0xff,0x39,0x8a,0x3d,0xad,0x37,0x83,0x3a,0x24,0x38,0x88,0x39,0xba,0x38,0x86,0x3a,0xff,0x38,0x84,0x39,0xfe,0x38,0x7f,0x36,0x59,0x39,0x39,0x39,0x83,0x37,0x38,0x38,0xff,0x34,0x34,0x34,0xff,0x38,0x38,0x39,0xff,0x4e,0x4e,0x4e,0xf1,0x57,0x56,0x57,0x6c,0x49,0x4c,0x4d,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8e,0x8f,0x90,0x0f,0xb8,0xb8,0xb9,0x83,0xa0,0xa0,0xa1,0xf8,0x47,0x47,0x48,0xff,0x32,0x32,0x33,0xff,0x5e,0x5c,0x5e,0xfe,0x72,0x71,0x72,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x8a,0x3e,0x6b,0x3a,0x8c,0x3d,0xfc,0x39,0x8c,0x3c,0xff,0x38,0x8b,0x3b,0xd9,0x38,0x84,0x3a,0x41,0x37,0x81,0x39,0x5a,0x38,0x80,0x38,0xda,0x39,0x82,0x38,0xf8,0x39,0x7e,0x37,0x55,0x3d,0x3d,0x3e,0x84,0x39,0x38,0x39,0xfe,0x32,0x32,0x33,0xff,0x32,0x31,0x32,0xff,0x46,0x45,0x46,0xff,0x5e,0x5d,0x5e,0xdf,0x69,0x68,0x68,0x85,0x62,0x62,0x62,0x41,0x42,0x42,0x43,0x19,0x36,0x36,0x37,0x07,0x39,0x38,0x39,0x08,0x54,0x54,0x54,0x22,0x87,0x87,0x88,0x4f,0xa1,0xa1,0xa2,0x94,0x9f,0x9f,0x9f,0xef,0x70,0x6f,0x70,0xff,0x36,0x35,0x36,0xff,0x39,0x39,0x39,0xff,0x62,0x62,0x63,0xfd,0x71,0x70,0x71,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x89,0x3b,0x48,0x38,0x8b,0x3b,0xe8,0x37,0x8a,0x3a,0xff,0x38,0x89,0x3a,0xfe,0x38,0x84,0x3a,0xb8,0x38,0x7f,0x39,0x49,0x38,0x7e,0x38,0x4a,0x3b,0x7f,0x37,0x89,0x33,0x70,0x33,0x30,0x3c,0x3c,0x3d,0x5e,0x3d,0x3d,0x3e,0xef,0x36,0x36,0x36,0xff,0x34,0x34,0x34,0xff,0x36,0x36,0x36,0xff,0x44,0x44,0x44,0xff,0x52,0x52,0x53,0xff,0x5e,0x5e,0x5f,0xfe,0x69,0x69,0x69,0xfd,0x72,0x71,0x72,0xfd,0x75,0x76,0x76,0xff,0x6c,0x6d,0x6e,0xff,0x50,0x50,0x52,0xff,0x33,0x33,0x33,0xff,0x34,0x33,0x34,0xff,0x48,0x47,0x48,0xff,0x69,0x69,0x69,0xe7,0x71,0x70,0x71,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x7f,0x39,0x15,0x37,0x87,0x39,0x9a,0x38,0x86,0x39,0xfb,0x38,0x85,0x3a,0xff,0x39,0x84,0x3a,0xff,0x39,0x82,0x39,0xf0,0x39,0x7f,0x38,0xba,0x38,0x7c,0x37,0xa7,0x36,0x7f,0x36,0x8e,0x3c,0x5a,0x3c,0x31,0x41,0x41,0x42,0xae,0x3d,0x3d,0x3d,0xfd,0x36,0x36,0x36,0xff,0x32,0x33,0x33,0xff,0x32,0x33,0x34,0xff,0x34,0x34,0x34,0xff,0x35,0x35,0x35,0xff,0x36,0x35,0x36,0xff,0x35,0x35,0x35,0xff,0x34,0x34,0x34,0xff,0x33,0x33,0x33,0xff,0x3f,0x3f,0x40,0xff,0x54,0x54,0x55,0xfa,0x64,0x63,0x64,0x97,0x65,0x63,0x64,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x7c,0x37,0x22,0x38,0x82,0x39,0x89,0x39,0x83,0x39,0xe2,0x3a,0x84,0x39,0xff,0x3a,0x83,0x38,0xff,0x38,0x82,0x38,0xff,0x37,0x83,0x37,0xff,0x36,0x80,0x35,0xe9,0x35,0x79,0x32,0x60,0x3d,0x41,0x3e,0x30,0x40,0x41,0x41,0x97,0x42,0x42,0x43,0xe8,0x41,0x42,0x41,0xff,0x41,0x41,0x41,0xff,0x40,0x40,0x40,0xff,0x41,0x41,0x41,0xff,0x46,0x47,0x47,0xff,0x50,0x4f,0x50,0xfd,0x57,0x57,0x57,0xd8,0x58,0x58,0x58,0x81,0x56,0x55,0x57,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x44,0x30,0x01,0x37,0x81,0x37,0x2a,0x38,0x83,0x36,0x5c,0x38,0x81,0x36,0x7e,0x37,0x7d,0x36,0x8a,0x36,0x7b,0x33,0x7b,0x34,0x7a,0x31,0x57,0x34,0x75,0x32,0x08,0x00,0x00,0x00,0x00,0x2f,0x2f,0x2e,0x02,0x44,0x43,0x44,0x25,0x47,0x47,0x47,0x43,0x48,0x48,0x47,0x5b,0x4a,0x49,0x4a,0x57,0x4e,0x4e,0x4f,0x3e,0x4e,0x4f,0x4f,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4c,0x08,0x4d,0xe8,0x44,0x28,0x45,0x48,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x4b,0x08,0x4d,0x28,0x4d,0x28,0x4d,0x48,0x4d,0x28,0x4d,0x28,0x4d,0x08,0x4d,0xe8,0x44,0x69,0x4b,0x69,0x4a,0x8a,0x52,0xcb,0x5a,0x2c,0x63,0x4d,0x6b,0x2c,0x63,0x0c,0x63,0xeb,0x5a,0xeb,0x5a,0xeb,0x5a,0x49,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4c,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x28,0x4d,0x28,0x4d,0x48,0x4d,0x48,0x4d,0x28,0x4d,0xc8,0x4c,0x49,0x4a,0x8a,0x52,0xae,0x73,0x71,0x8c,0xd3,0x9c,0xb2,0x94,0x71,0x8c,0x51,0x8c,0x30,0x84,0x30,0x84,0xcf,0x7b,0x6d,0x6b,0x0c,0x63,0xeb,0x5a,0xcb,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4d,0x48,0x4d,0x28,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xe8,0x4c,0x88,0x44,0x07,0x44,0x27,0x3a,0x48,0x4a,0xef,0x7b,0xf3,0x9c,0x14,0xa5,0xf3,0x9c,0x71,0x8c,0xef,0x7b,0xaf,0x73,0xae,0x73,0xae,0x7b,0xef,0x7b,0xef,0x83,0xcf,0x7b,0xaf,0x73,0x6d,0x6b,0x2c,0x63,0x0c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x48,0x4d,0x28,0x4d,0x48,0x4d,0x08,0x4d,0x88,0x44,0xe8,0x44,0xe8,0x44,0xa8,0x44,0x26,0x32,0x8a,0x52,0x92,0x94,0x14,0xa5,0xd3,0x9c,0xcf,0x7b,0x8a,0x52,0xe7,0x39,0xe7,0x39,0xe8,0x41,0x08,0x42,0x08,0x42,0x08,0x42,0x69,0x4a,0x2c,0x63,0xae,0x73,0xae,0x73,0x8e,0x73,0x2c,0x63,0x0c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x4c,0x08,0x4d,0x28,0x4d,0x28,0x4d,0x08,0x4d,0x28,0x45,0x28,0x45,0x08,0x45,0xc8,0x44,0xa5,0x29,0xaa,0x52,0xb2,0x94,0xf3,0x9c,0xef,0x7b,0x08,0x42,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x08,0x42,0x69,0x4a,0x2c,0x63,0x6d,0x6b,0x4d,0x6b,0x0c,0x63,0xec,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0x88,0x44,0x08,0x45,0x28,0x4d,0x28,0x4d,0x08,0x45,0xe5,0x29,0x69,0x4a,0x92,0x8c,0x92,0x94,0x0c,0x5b,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x39,0x28,0x42,0xaa,0x52,0x2c,0x63,0x2c,0x63,0x0c,0x63,0x0c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x44,0x28,0x4d,0x08,0x4d,0xe8,0x4c,0x88,0x44,0xe8,0x44,0xa7,0x44,0xe7,0x44,0x28,0x4d,0x47,0x3c,0x08,0x42,0x71,0x8c,0x92,0x94,0x8a,0x52,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0x5a,0x0c,0x63,0x2d,0x63,0x2c,0x63,0x0c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x6a,0x52,0x0c,0x63,0x0c,0x63,0x0c,0x63,0x0c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x28,0x4d,0x28,0x4d,0xc8,0x4c,0xe8,0x4c,0xa7,0x44,0x87,0x44,0xe8,0x4c,0xa7,0x44,0x65,0x29,0xcf,0x7b,0x92,0x94,0x0c,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xeb,0x5a,0xef,0x7b,0x10,0x84,0x10,0x84,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4a,0xaa,0x52,0xeb,0x5a,0xeb,0x5a,0x2c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x4c,0x08,0x4d,0x28,0x4d,0x08,0x4d,0x08,0x4d,0x28,0x4d,0x87,0x44,0xa8,0x44,0xe8,0x44,0x66,0x3b,0xaa,0x52,0x51,0x8c,0x8e,0x73,0x65,0x29,0x00,0x00,0x08,0x42,0x49,0x4a,0x69,0x4a,0x00,0x00,0x8a,0x52,0xeb,0x62,0x92,0x94,0x51,0x8c,0x30,0x84,0xae,0x73,0xec,0x5a,0x00,0x00,0x00,0x00,0x0c,0x63,0x2c,0x63,0x00,0x00,0x00,0x00,0x8a,0x52,0xaa,0x52,0xcb,0x5a,0x0c,0x63,0x2c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x88,0x44,0x08,0x4d,0xa8,0x44,0x08,0x4d,0x87,0x44,0xc8,0x44,0x65,0x29,0xcf,0x7b,0x10,0x7c,0xc7,0x39,0x45,0x29,0x07,0x3a,0x69,0x4a,0x10,0x84,0x4d,0x6b,0xaa,0x52,0x6d,0x6b,0x92,0x94,0xf3,0x9c,0xb2,0x94,0x51,0x8c,0x10,0x84,0x6d,0x6b,0x0c,0x63,0x2c,0x63,0x6d,0x6b,0x6d,0x6b,0x4d,0x6b,0x00,0x00,0x00,0x00,0x6a,0x4a,0xaa,0x52,0xaa,0x52,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x4c,0x08,0x4d,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0xc8,0x4c,0x47,0x44,0xe8,0x44,0xa7,0x3b,0x8a,0x52,0x10,0x84,0x0c,0x63,0x45,0x21,0x00,0x00,0x07,0x3a,0xae,0x73,0xb2,0x94,0x34,0xa5,0x34,0xa5,0xb6,0xb5,0xf4,0x9c,0xef,0x7b,0x4d,0x6b,0x2c,0x63,0x6d,0x6b,0xcf,0x7b,0xcf,0x7b,0x8e,0x73,0x8e,0x73,0x6d,0x6b,0x4d,0x6b,0x2c,0x63,0x00,0x00,0x69,0x4a,0x8a,0x52,0x8a,0x52,0x2c,0x63,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0x68,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x28,0x4d,0x28,0x4c,0x00,0x00,0x00,0x00,0x9e,0xf7,0xdf,0xff,0xdf,0xff,0xde,0xf7,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xbf,0xf7,0x1c,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xdf,0xff,0xdf,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xdf,0xff,0xff,0xff,0x9e,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xa8,0x44,0xe8,0x4c,0xc8,0x4c,0x08,0x4d,0x27,0x3c,0xc7,0x44,0x65,0x29,0x4c,0x63,0xef,0x7b,0xc7,0x39,0x00,0x00,0x00,0x00,0x28,0x42,0x10,0x84,0x92,0x94,0x14,0xa5,0x55,0xad,0xae,0x73,0xe7,0x39,0xa7,0x31,0xa6,0x31,0xa7,0x31,0xc7,0x39,0x49,0x4a,0x2c,0x63,0x8e,0x73,0x6d,0x6b,0x2c,0x63,0x0c,0x63,0x0c,0x63,0x00,0x00,0x00,0x00,0xaa,0x52,0x8a,0x52,0xcb,0x5a,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x44,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x28,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xc8,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x4d,0x08,0x4d,0x08,0x4d,0x08,0x44,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x3c,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0x88,0x44,0xc8,0x4c,0xa8,0x44,0xc8,0x44,0xa7,0x44,0xa8,0x44,0x86,0x31,0x8e,0x73,0x2c,0x63,0x45,0x29,0x00,0x00,0x00,0x00,0x08,0x42,0x6d,0x6b,0x71,0x8c,0xb2,0x94,0x8a,0x52,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0x08,0x42,0xcb,0x52,0x4c,0x63,0xcb,0x5a,0x2c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0x5a,0x69,0x4a,0x49,0x4a,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x44,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x28,0x4d,0x08,0x4d,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x28,0x4d,0xe8,0x43,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x3c,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xc8,0x4c,0xc8,0x4c,0xa8,0x44,0x67,0x44,0xc8,0x44,0x67,0x44,0x49,0x4a,0x8e,0x73,0x8a,0x52,0x65,0x29,0x00,0x00,0x00,0x00,0xc7,0x39,0xeb,0x5a,0x92,0x94,0xcb,0x5a,0x86,0x31,0x46,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x44,0x87,0x3b,0x49,0x4a,0xaa,0x52,0xaa,0x52,0x2d,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x8a,0x52,0x8a,0x52,0x28,0x42,0x2c,0x63,0xaa,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xc8,0x4c,0x47,0x44,0xa7,0x44,0xc7,0x44,0xe8,0x4c,0xe8,0x4c,0xa8,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x43,0x68,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x43,0x88,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x43,0xc8,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x28,0x4d,0xe7,0x43,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0xdb,0xde,0xfb,0xde,0xdb,0xde,0x1c,0xe7,0x9e,0xf7,0xdf,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb2,0x94,0x96,0xb5,0x00,0x00,0x00,0x00,0x1c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xb5,0xd3,0x9c,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x44,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xc8,0x4c,0xc8,0x4c,0xc8,0x44,0x47,0x44,0xe7,0x44,0x46,0x3b,0xaa,0x52,0x6d,0x6b,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x08,0x42,0x8e,0x73,0xcf,0x7b,0x86,0x31,0x67,0x3c,0x86,0x3c,0x26,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x3c,0xa8,0x44,0x28,0x42,0xaa,0x52,0xaa,0x52,0x0c,0x63,0xcb,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x52,0x28,0x42,0xeb,0x5a,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x38,0x07,0x4d,0x08,0x4d,0x28,0x4d,0x67,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x43,0x87,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x44,0xe7,0x44,0xe8,0x44,0xc8,0x44,0x08,0x45,0x08,0x45,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x44,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0xc8,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x44,0x08,0x4d,0x28,0x4d,0x08,0x4d,0x08,0x4d,0x28,0x4d,0x28,0x4d,0xe8,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x28,0x4d,0x08,0x44,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0xdb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0x55,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xf7,0xdf,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x9e,0xf7,0x1c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x9a,0xd6,0xbe,0xf7,0xdf,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x9d,0xef,0xde,0xff,0xff,0xff,0xff,0xff,0x9d,0xf7,0x7d,0xef,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0x5d,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x68,0x44,0xc8,0x4c,0xc8,0x4c,0xc8,0x44,0x67,0x44,0xc7,0x44,0x86,0x29,0xaa,0x52,0x2c,0x63,0x86,0x31,0xa6,0x31,0x08,0x42,0x08,0x42,0x49,0x4a,0xef,0x7b,0xaa,0x52,0x86,0x31,0xc7,0x44,0xa7,0x3c,0x67,0x3c,0x47,0x3c,0x00,0x00,0x00,0x00,0x68,0x3c,0x47,0x3c,0xc8,0x44,0x68,0x44,0xab,0x52,0x8a,0x52,0xaa,0x52,0x0c,0x63,0x2c,0x63,0x2c,0x63,0x00,0x00,0xcb,0x5a,0x28,0x42,0xcb,0x5a,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x39,0x08,0x4d,0xe7,0x4c,0xe8,0x4c,0xa7,0x44,0x27,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x44,0xe8,0x4c,0xc8,0x44,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xe8,0x4c,0xc8,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x4c,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xe8,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x28,0x4d,0x07,0x44,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0xdb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x55,0xad,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0xba,0xd6,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0xff,0xff,0xff,0xff,0xbe,0xf7,0x18,0xc6,0xff,0xff,0xff,0xff,0xdf,0xff,0xdb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xc6,0xdf,0xff,0xff,0xff,0xdf,0xff,0x76,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x4c,0xe8,0x4c,0xe8,0x4c,0x68,0x44,0xe8,0x4c,0xc8,0x4c,0xc8,0x44,0x67,0x44,0xc7,0x44,0x65,0x29,0xaa,0x52,0xeb,0x5a,0x45,0x29,0xa6,0x31,0x49,0x4a,0x2c,0x63,0x8e,0x73,0xcf,0x7b,0xe7,0x39,0x00,0x00,0x87,0x44,0x67,0x3c,0x67,0x3c,0x67,0x3c,0xc7,0x44,0xa7,0x44,0x68,0x44,0x68,0x3c,0x87,0x3c,0x67,0x3c,0xcb,0x5a,0xaa,0x52,0x69,0x4a,0x69,0x4a,0xcb,0x5a,0x2c,0x63,0x00,0x00,0xeb,0x5a,0x08,0x42,0xaa,0x52,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xc8,0x44,0xe8,0x44,0xe8,0x44,0xe8,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x44,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xc8,0x44,0xe8,0x44,0xe8,0x44,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0xa8,0x4c,0x00,0x00,0xc8,0x44,0x28,0x4d,0x08,0x4d,0xe8,0x4c,0xc8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0x00,0x00,0x88,0x4c,0x28,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0x08,0x4d,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x28,0x4d,0x08,0x4d,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe7,0x43,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x3c,0xe7,0x5d,0xe7,0x3c,0xe7,0x3c,0xe7,0xbe,0xf7,0xff,0xff,0xff,0xff,0xdf,0xff,0x1c,0xe7,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0xdb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x34,0xa5,0x00,0x00,0x9e,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xbe,0xf7,0x9e,0xf7,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0xbe,0xf7,0xbe,0xf7,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0x9e,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0x9e,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x89,0x4c,0xe8,0x4c,0x68,0x44,0xc8,0x44,0xa8,0x44,0xa7,0x44,0x65,0x29,0x8a,0x52,0xcb,0x5a,0x65,0x29,0xe6,0x39,0x49,0x4a,0x0c,0x63,0x4d,0x6b,0x6d,0x6b,0xa6,0x31,0x00,0x00,0x67,0x44,0x07,0x3c,0x27,0x3c,0xc7,0x3c,0xc7,0x44,0xc7,0x44,0x67,0x3c,0x48,0x3c,0x47,0x3c,0x27,0x3c,0xcb,0x5a,0xcb,0x5a,0x49,0x4a,0x49,0x4a,0x69,0x4a,0x2c,0x63,0x00,0x00,0x0c,0x63,0x07,0x42,0x8a,0x52,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x08,0x45,0xc7,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x44,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x67,0x44,0x00,0x00,0x00,0x00,0x87,0x44,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0x00,0x00,0xe7,0x44,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x87,0x44,0x00,0x00,0x00,0x00,0x67,0x44,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0x00,0x00,0xe8,0x44,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xa7,0x44,0x00,0x00,0x00,0x00,0x07,0x3c,0x08,0x4d,0x28,0x4d,0x28,0x4d,0x08,0x4d,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe7,0x43,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x5d,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0xa5,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0xb6,0xb5,0x00,0x00,0x00,0x00,0xba,0xd6,0xdf,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0xdb,0xde,0xdf,0xff,0xff,0xff,0xff,0xff,0x7d,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x7d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x1b,0xe7,0xdf,0xff,0xff,0xff,0xdf,0xff,0xd7,0xbd,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xdf,0xff,0xda,0xd6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x4c,0xe8,0x4c,0xe8,0x4c,0xa8,0x44,0xc8,0x4c,0x68,0x44,0xa8,0x44,0x88,0x44,0xa7,0x44,0x65,0x29,0x69,0x4a,0xaa,0x52,0x65,0x31,0x00,0x00,0x29,0x42,0xeb,0x5a,0x0c,0x63,0x2c,0x63,0xe7,0x39,0x00,0x00,0x87,0x44,0x87,0x44,0x46,0x3c,0x06,0x34,0x87,0x3c,0x87,0x3c,0x67,0x3c,0x27,0x3c,0x87,0x3c,0x07,0x3c,0x0c,0x63,0xcb,0x5a,0x08,0x42,0x08,0x42,0x8a,0x52,0x4d,0x6b,0x00,0x00,0x0c,0x63,0xe7,0x39,0x8a,0x52,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x44,0xe8,0x44,0xe7,0x44,0x08,0x45,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x44,0xe8,0x44,0x00,0x00,0x00,0x00,0xe8,0x44,0xe8,0x4c,0x08,0x4d,0xa8,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x00,0x00,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xc7,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x44,0x08,0x4d,0xe8,0x4c,0xe8,0x4c,0x00,0x00,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x44,0x08,0x4d,0x08,0x4d,0x08,0x4d,0x08,0x44,0x00,0x00,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xe7,0x43,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x7d,0xf7,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0xa5,0x00,0x00,0xde,0xff,0xff,0xff,0xff,0xff,0x3c,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7d,0xef,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x5d,0xef,0xff,0xff,0xff,0xff,0xbe,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0xde,0xff,0xff,0xff,0xff,0xff,0x5c,0xef,0x00,0x00,0x7d,0xef,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0x07,0x44,0xa8,0x4c,0xa8,0x4c,0xa8,0x44,0x27,0x3c,0xa7,0x44,0x65,0x29,0x28,0x42,0x8a,0x52,0xa6,0x31,0x00,0x00,0xc7,0x39,0x08,0x42,0x69,0x4a,0xeb,0x5a,0x49,0x4a,0xc6,0x31,0x67,0x44,0xa7,0x3c,0x26,0x33,0xe6,0x33,0x06,0x34,0xe6,0x33,0xc6,0x33,0x46,0x34,0x67,0x3c,0x27,0x3a,0x8e,0x73,0xaa,0x52,0x28,0x42,0xaa,0x5a,0x2c,0x63,0x2c,0x63,0x00,0x00,0x2c,0x63,0xc7,0x39,0xaa,0x52,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x44,0xe8,0x44,0xc7,0x44,0xc7,0x4c,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0xe7,0x43,0x00,0x00,0xc8,0x44,0xe8,0x4c,0xe8,0x4c,0x86,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x44,0xe7,0x4c,0xe8,0x4c,0x08,0x4d,0x00,0x00,0x08,0x4d,0xe7,0x4c,0xc8,0x4c,0x87,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x3b,0xc7,0x4c,0xe8,0x4c,0x08,0x4d,0xc8,0x43,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xa7,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x4c,0xe8,0x4c,0x08,0x4d,0x68,0x44,0x00,0x00,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0xe7,0x43,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0x7d,0xef,0x7d,0xef,0x5d,0xef,0x1c,0xe7,0x38,0xc6,0xbe,0xf7,0xdf,0xff,0xff,0xff,0xde,0xff,0x79,0xce,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0xdb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0xa5,0x00,0x00,0xff,0xff,0xff,0xff,0xde,0xff,0x38,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xde,0xdf,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x9d,0xf7,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x7d,0xef,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0x3c,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x44,0xe8,0x44,0xe8,0x4c,0xa8,0x44,0xa8,0x44,0xa7,0x44,0xa8,0x44,0x27,0x3c,0xc7,0x44,0xe5,0x29,0x08,0x42,0x69,0x4a,0xc7,0x39,0xa6,0x31,0x00,0x00,0xa6,0x31,0xc7,0x39,0x8a,0x52,0x8a,0x52,0x28,0x42,0x00,0x00,0x67,0x3c,0x66,0x33,0x26,0x34,0x46,0x33,0x86,0x33,0xe6,0x33,0x06,0x34,0x06,0x34,0x28,0x42,0x10,0x7c,0x28,0x42,0xeb,0x5a,0xcb,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x63,0xc7,0x39,0xcb,0x5a,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x44,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0xc8,0x4c,0x00,0x00,0xc8,0x44,0xe8,0x4c,0xe8,0x4c,0x67,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x00,0x00,0xe7,0x4c,0xe8,0x4c,0xc8,0x4c,0x87,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x47,0x3b,0x07,0x4d,0xe8,0x4c,0xe8,0x4c,0xa7,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x3b,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x07,0x44,0x00,0x00,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x28,0x44,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0x3c,0xe7,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0x3c,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0x14,0xa5,0x00,0x00,0xde,0xff,0xff,0xff,0xff,0xff,0x9a,0xd6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x7d,0xef,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0xff,0xff,0xff,0xde,0xff,0x79,0xd6,0xbe,0xff,0xff,0xff,0xde,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x44,0xe8,0x4c,0xc8,0x44,0xa8,0x44,0x87,0x44,0x87,0x44,0x07,0x3c,0xc7,0x44,0xa6,0x33,0xc7,0x39,0x28,0x42,0xc7,0x39,0x86,0x31,0x00,0x00,0x00,0x00,0xe7,0x39,0x28,0x42,0x69,0x4a,0x69,0x4a,0x29,0x42,0x00,0x00,0xe6,0x33,0xe6,0x33,0x65,0x2a,0x06,0x2b,0xe6,0x33,0xe7,0x39,0x24,0x21,0x92,0x94,0xae,0x73,0x28,0x42,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x63,0xeb,0x5a,0xa6,0x31,0x0c,0x63,0x69,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x45,0xe8,0x4c,0xc8,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x2a,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xa8,0x44,0x00,0x00,0xe8,0x44,0xe8,0x4c,0xe8,0x4c,0xc8,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xc7,0x44,0x00,0x00,0xc7,0x44,0xe7,0x4c,0xe8,0x4c,0x08,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xe8,0x4c,0x00,0x00,0xc7,0x44,0xe7,0x4c,0x08,0x4d,0x08,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0x00,0x00,0x00,0x00,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x07,0x44,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0x5d,0xef,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0x9d,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x9d,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0x34,0xa5,0x00,0x00,0xde,0xff,0xff,0xff,0xff,0xff,0x9e,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0xba,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0x1c,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xdf,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xef,0xff,0xff,0xff,0xff,0x7d,0xef,0xdf,0xff,0xff,0xff,0x7d,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x44,0xc8,0x4c,0xa8,0x44,0x87,0x44,0xa8,0x44,0x88,0x44,0x87,0x44,0x87,0x44,0x87,0x3c,0xa6,0x31,0xe7,0x39,0xe7,0x39,0xa6,0x31,0x00,0x00,0x00,0x00,0xc7,0x39,0x08,0x42,0x29,0x4a,0x49,0x4a,0x8a,0x52,0xaa,0x52,0xc6,0x33,0x06,0x34,0xa6,0x33,0xe6,0x33,0x06,0x34,0x66,0x33,0xf3,0x9c,0xb2,0x94,0xe7,0x39,0x28,0x42,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0x7b,0x8a,0x52,0x86,0x31,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x44,0xe8,0x44,0xe8,0x4c,0xc8,0x44,0xa8,0x44,0xa8,0x44,0x88,0x44,0xa8,0x44,0xc8,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x08,0x44,0x00,0x00,0xe7,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xa8,0x44,0xa8,0x44,0xc8,0x44,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0xa7,0x44,0x00,0x00,0xc7,0x44,0x07,0x4d,0xe8,0x4c,0xe8,0x44,0xc7,0x44,0xa8,0x44,0xa8,0x44,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0xe8,0x4c,0xc8,0x44,0x00,0x00,0xa7,0x44,0x07,0x4d,0xe8,0x4c,0xe8,0x4c,0xc8,0x44,0xa8,0x44,0xa8,0x44,0xc8,0x4c,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0x08,0x4d,0x00,0x00,0x00,0x00,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0xe7,0x43,0x00,0x00,0x00,0x00,0xde,0xf7,0xff,0xff,0xff,0xff,0xbe,0xf7,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x7d,0xef,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xe7,0x00,0x00,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xf7,0xdb,0xde,0x9e,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x34,0xa5,0x00,0x00,0x9e,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0xf7,0xfb,0xde,0x1c,0xe7,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0xdf,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0x5d,0xef,0xfb,0xde,0x7d,0xef,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xad,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0xb2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x44,0xc8,0x4c,0xc8,0x4c,0x27,0x44,0xa7,0x44,0x67,0x44,0xa8,0x44,0x67,0x3c,0x67,0x3c,0xa6,0x31,0xc7,0x39,0xe7,0x39,0xc7,0x39,0xe7,0x39,0x00,0x00,0xc7,0x39,0x08,0x42,0x08,0x42,0x08,0x42,0x29,0x4a,0xeb,0x5a,0xa9,0x4a,0x45,0x2a,0x45,0x2a,0x65,0x2a,0xe8,0x42,0x34,0xa5,0xd3,0x9c,0x28,0x42,0xa7,0x39,0xa6,0x39,0xcb,0x5a,0x2c,0x63,0x00,0x00,0x00,0x00,0x10,0x84,0xc7,0x39,0x28,0x42,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x44,0xc8,0x44,0xc7,0x44,0xc8,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xc8,0x4c,0x00,0x00,0x00,0x00,0xc7,0x44,0xe8,0x4c,0x08,0x4d,0xe8,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x44,0xc7,0x44,0xc8,0x44,0xe8,0x44,0xe8,0x4c,0xe8,0x44,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0xe8,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x44,0xc7,0x44,0xc8,0x4c,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xc8,0x44,0xe7,0x43,0x00,0x00,0x00,0x00,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xc7,0x43,0x00,0x00,0x00,0x00,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xf7,0x00,0x00,0x00,0x00,0x1c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0x34,0xa5,0x00,0x00,0x75,0xad,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x5d,0xef,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9e,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x44,0xc8,0x44,0xc8,0x4c,0xa8,0x44,0xa7,0x44,0xa7,0x44,0xa7,0x44,0x27,0x3c,0x87,0x3c,0x66,0x32,0xa7,0x31,0xc7,0x39,0xe7,0x39,0xe7,0x39,0x00,0x00,0xc7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x41,0x08,0x42,0xcb,0x5a,0x2c,0x63,0x6d,0x6b,0xcf,0x7b,0x30,0x84,0x4d,0x6b,0xc7,0x39,0xa7,0x39,0xa6,0x31,0xa6,0x31,0xaa,0x5a,0x2d,0x6b,0x00,0x00,0x10,0x84,0xae,0x73,0xa6,0x31,0x0c,0x63,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x44,0xc7,0x44,0xe8,0x44,0xe8,0x44,0xc8,0x4c,0xc8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x44,0xe7,0x4c,0x08,0x4d,0x67,0x44,0xc8,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x44,0xa8,0x44,0xc7,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x44,0xc8,0x44,0xe8,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xc8,0x44,0xa8,0x44,0x86,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x44,0xc8,0x44,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0xe8,0x4c,0x08,0x4d,0xe8,0x4c,0xe7,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4d,0x08,0x4d,0x08,0x4d,0xc7,0x3b,0x00,0x00,0x00,0x00,0xbf,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x9e,0xf7,0x96,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x9e,0xf7,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xff,0x7d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0x55,0xad,0x00,0x00,0x00,0x00,0xd7,0xbd,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x1c,0xe7,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xde,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0xbe,0xf7,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xba,0xd6,0xdf,0xff,0xff,0xff,0xff,0xff,0xfb,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x44,0xc8,0x44,0xa8,0x44,0x47,0x44,0x87,0x44,0x47,0x3c,0x27,0x3c,0x47,0x3c,0x47,0x3c,0xc7,0x39,0xc7,0x39,0xc7,0x39,0x08,0x42,0x00,0x00,0xc7,0x39,0xc7,0x39,0xe7,0x39,0xe7,0x39,0x08,0x42,0x08,0x42,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xa6,0x31,0xa6,0x31,0x08,0x42,0xeb,0x5a,0x0c,0x63,0x29,0x4a,0x69,0x4a,0x4d,0x6b,0x00,0x00,0x00,0x00,0x91,0x94,0x49,0x4a,0xe7,0x39,0x8e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x3b,0x87,0x44,0x87,0x44,0xc7,0x44,0xa7,0x44,0xa7,0x44,0xc7,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x44,0xe7,0x44,0xe8,0x44,0x46,0x3b,0x27,0x44,0xa7,0x44,0xa8,0x44,0xc8,0x44,0x67,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x3b,0x87,0x44,0xa7,0x44,0xc7,0x44,0xa7,0x44,0x07,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x22,0xa7,0x44,0xa7,0x44,0x87,0x44,0x87,0x44,0x27,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x43,0xc7,0x3b,0x07,0x3c,0x28,0x4c,0x00,0x00,0x00,0x00,0x9a,0xd6,0xf7,0xbd,0x18,0xc6,0xf7,0xbd,0xf7,0xbd,0xf7,0xbd,0x18,0xc6,0x58,0xc6,0x3c,0xe7,0x79,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xce,0x3c,0xef,0xbe,0xf7,0x5c,0xef,0x79,0xce,0x00,0x00,0x38,0xc6,0xf7,0xbd,0x38,0xc6,0x75,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xba,0xd6,0x7d,0xef,0x9d,0xf7,0x3c,0xe7,0x92,0x94,0x00,0x00,0x18,0xc6,0xf7,0xbd,0x18,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0xfb,0xde,0x00,0x00,0x79,0xce,0xb6,0xb5,0xf7,0xbd,0x38,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xef,0xdf,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x44,0xc8,0x44,0xa8,0x44,0x87,0x44,0x67,0x3c,0x47,0x3c,0x47,0x3c,0x07,0x3c,0x67,0x3c,0xc7,0x39,0xa7,0x39,0xa6,0x31,0xe7,0x39,0x08,0x42,0x00,0x00,0xc7,0x39,0xc7,0x39,0xe7,0x39,0x65,0x29,0x28,0x42,0x49,0x4a,0xc7,0x39,0xa7,0x39,0xa6,0x31,0x49,0x4a,0xcb,0x5a,0xaa,0x52,0x2d,0x6b,0x6d,0x6b,0x6d,0x6b,0xaa,0x4a,0x00,0x00,0xf3,0x9c,0xef,0x7b,0x86,0x31,0x0b,0x63,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x44,0xc7,0x44,0xe8,0x44,0x66,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xf7,0xbe,0xff,0xdf,0xff,0xdf,0xff,0xff,0xff,0xfe,0xff,0x3c,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x44,0xa7,0x44,0xa7,0x44,0x27,0x3c,0x67,0x3c,0xe6,0x3b,0x47,0x3c,0x47,0x3c,0x07,0x3c,0xc7,0x39,0xa6,0x31,0xa6,0x31,0x28,0x42,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4a,0xe7,0x39,0xa6,0x31,0xa6,0x31,0x8a,0x52,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xad,0x34,0xa5,0xe7,0x39,0x08,0x42,0x8e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x44,0xc7,0x44,0xc8,0x44,0x47,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0xe7,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x44,0xa7,0x44,0x87,0x44,0x87,0x44,0x27,0x3c,0x47,0x3c,0x07,0x3c,0x47,0x3c,0x47,0x3c,0x87,0x3a,0xc7,0x39,0xa6,0x31,0xc7,0x39,0x49,0x4a,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4a,0x49,0x4a,0x28,0x42,0x49,0x4a,0xaa,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xb5,0xd7,0xbd,0xaa,0x52,0xc7,0x39,0x6d,0x6b,0x8e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x44,0xc7,0x44,0xc8,0x44,0x47,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xdf,0xff,0xdf,0xff,0xff,0xff,0xdf,0xff,0xde,0xff,0x18,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x44,0x87,0x44,0x67,0x44,0x47,0x3c,0x07,0x3c,0x47,0x3c,0x47,0x3c,0x47,0x3c,0x27,0x3c,0xc7,0x39,0xa6,0x31,0x86,0x31,0xc7,0x39,0x69,0x4a,0x69,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4a,0x6a,0x4a,0x8a,0x52,0x8a,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xb5,0xb6,0xb5,0xcb,0x5a,0x86,0x31,0x2c,0x63,0xae,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x3c,0x67,0x3c,0x67,0x3c,0x47,0x3c,0x06,0x3c,0x47,0x3c,0x27,0x3c,0x27,0x3c,0xe7,0x33,0xc7,0x39,0xc6,0x39,0xa6,0x31,0xc7,0x39,0x69,0x4a,0xaa,0x52,0x69,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x94,0xd7,0xbd,0x14,0xa5,0x28,0x4a,0x86,0x31,0xeb,0x5a,0x8e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x3c,0x67,0x3c,0x67,0x3c,0x47,0x3c,0x27,0x3c,0x06,0x3c,0x07,0x3c,0x07,0x3c,0xe7,0x33,0xe7,0x39,0xc7,0x39,0x86,0x31,0x86,0x31,0x28,0x42,0xeb,0x5a,0x4d,0x6b,0x0c,0x63,0x08,0x42,0xa6,0x31,0xc7,0x39,0xaa,0x52,0x30,0x8c,0x14,0xa5,0xf3,0x9c,0x6e,0x73,0xa6,0x31,0xc7,0x39,0x0c,0x63,0x8e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x3c,0x47,0x3c,0x46,0x3c,0x47,0x3c,0x27,0x3c,0xe7,0x3b,0xe7,0x3b,0xe7,0x33,0x86,0x33,0xe7,0x39,0xe7,0x39,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x28,0x42,0x8a,0x52,0xeb,0x5a,0x4d,0x6b,0x8e,0x73,0xae,0x73,0x6d,0x6b,0x8a,0x52,0x86,0x31,0x86,0x31,0x29,0x4a,0x4d,0x6b,0x8e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x3b,0x26,0x3c,0x27,0x3c,0x27,0x3c,0x27,0x3c,0x07,0x3c,0xe7,0x3b,0xe7,0x33,0xe6,0x33,0xc7,0x3a,0x08,0x42,0xe7,0x39,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0xe7,0x41,0xaa,0x52,0x0c,0x63,0x0c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe6,0x33,0x07,0x3c,0x07,0x3c,0x27,0x3c,0x07,0x3c,0x07,0x3c,0x06,0x34,0x06,0x34,0xc6,0x33,0x07,0x3a,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x28,0x42,0x6a,0x52,0xaa,0x52,0xcb,0x5a,0xaa,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x32,0x06,0x34,0x07,0x34,0x07,0x34,0xe6,0x33,0xc6,0x33,0xc6,0x33,0xa6,0x33,0x00,0x00,0x65,0x29,0x08,0x42,0x28,0x42,0x49,0x42,0x49,0x4a,0x69,0x4a,0x69,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x27,0x2e,0x26,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x44,0x9c,0xde,0xfe,0xff,0xff,0xfb,0x93,0x05,0x42,0x92,0xc7,0xee,0xfc,0xfc,0xee,0xc6,0x8e,0x3a,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x55,0xd5,0xff,0xff,0xff,0xff,0xff,0xe1,0x3a,0x5f,0xda,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd5,0x5a,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0xb9,0xff,0xff,0xfa,0xac,0x5e,0x3b,0x2c,0x3c,0xca,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc3,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0xe3,0xff,0xfe,0xa2,0x27,0x64,0xc6,0xc1,0x7d,0xf2,0xff,0xff,0xff,0xfd,0xc5,0x85,0x57,0x43,0x45,0x62,0x93,0xda,0xff,0xff,0xff,0xff,0xef,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xf1,0xff,0xeb,0x49,0x52,0xe1,0xff,0xae,0x5a,0xfa,0xff,0xff,0xff,0xaf,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x48,0xc4,0xff,0xff,0xff,0xfa,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xed,0xff,0xdf,0x26,0x8f,0xff,0xff,0xd5,0x54,0xf3,0xff,0xff,0xe8,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x64,0xf6,0xff,0xff,0xf8,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xcd,0xff,0xe8,0x23,0x96,0xff,0xff,0xfb,0x40,0xda,0xff,0xff,0xdd,0x21,0x00,0x00,0x00,0x00,0x1a,0xef,0xf3,0xf3,0x7a,0x00,0x00,0x00,0x00,0x00,0x38,0xeb,0xff,0xff,0xe5,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xfe,0x48,0x70,0xf9,0xfd,0xff,0x94,0x56,0xfc,0xff,0xf1,0x2a,0x00,0x00,0x00,0x00,0x00,0x62,0xff,0xff,0xff,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xf4,0xff,0xff,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xf6,0xff,0x96,0x2c,0xf2,0xd5,0xff,0xf2,0x20,0xdb,0xff,0xff,0x61,0x00,0x0b,0x7a,0x15,0x00,0x0c,0xbb,0xff,0xff,0xff,0xfe,0x4a,0x00,0x00,0x44,0x44,0x00,0x00,0x5f,0xff,0xff,0xfc,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8e,0xff,0xf0,0x15,0xc5,0xac,0xf8,0xfb,0x96,0x62,0xff,0xff,0xb9,0x01,0x02,0xae,0xff,0xea,0x94,0xe9,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,0xba,0xff,0xf7,0x41,0x00,0x00,0xba,0xff,0xff,0xaa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xed,0xff,0x88,0x4c,0xe4,0xa1,0xfa,0xfd,0x3f,0xdb,0xff,0xfd,0x36,0x00,0x83,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0x25,0x00,0x31,0xfd,0xff,0xfa,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x4d,0x61,0x51,0x2f,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc4,0xf9,0xf9,0x0b,0x00,0x00,0x06,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xf6,0xf9,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xf9,0xf9,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xff,0xfd,0x20,0xb5,0x74,0xeb,0xdb,0xd5,0x34,0xfa,0xff,0xb0,0x00,0x00,0xbc,0xff,0xff,0xff,0xff,0xf0,0x87,0x2d,0x0f,0x15,0x51,0xbb,0xff,0xff,0xff,0xff,0xfa,0x23,0x00,0x00,0xbb,0xff,0xff,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0xc3,0xfe,0xff,0xff,0xff,0xff,0xef,0x9b,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xca,0xff,0xff,0x0c,0x00,0x00,0x4b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xea,0x99,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xfd,0xff,0xbc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0xff,0xff,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xcf,0x15,0xf6,0x5a,0xdb,0xc8,0x89,0x75,0xff,0xff,0x53,0x00,0x00,0x3f,0xff,0xff,0xff,0xc9,0x1e,0x00,0x00,0x00,0x00,0x00,0x01,0x6d,0xfd,0xff,0xff,0xa0,0x00,0x00,0x00,0x60,0xff,0xff,0xb9,0x00,0x00,0x00,0x00,0x00,0x28,0xee,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0xff,0xff,0x0d,0x00,0x00,0x4b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe2,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0xfe,0xff,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0xff,0xff,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0xff,0x86,0x5b,0xba,0x8e,0x9c,0xed,0x49,0xa9,0xff,0xfa,0x12,0x00,0x00,0x07,0xf8,0xff,0xe3,0x15,0x11,0x00,0x00,0x00,0x00,0x00,0x0b,0x02,0x7c,0xff,0xff,0x98,0x00,0x00,0x00,0x18,0xfd,0xff,0xf2,0x04,0x00,0x00,0x00,0x00,0xb0,0xff,0xff,0xbc,0x47,0x32,0x43,0x81,0xdd,0xf8,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcc,0xff,0xff,0x0f,0x00,0x00,0x4c,0xff,0xff,0xb7,0x35,0x35,0x35,0x35,0x61,0xea,0xff,0xff,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x05,0x00,0x00,0x0e,0xfe,0xff,0xbe,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x03,0x00,0x00,0x89,0xff,0xff,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x0d,0xfc,0xff,0x52,0x8c,0x7d,0xc4,0x85,0xfe,0x22,0xd3,0xff,0xd8,0x01,0x00,0x00,0x54,0xff,0xff,0x55,0x18,0xd7,0x08,0x00,0x00,0x00,0x00,0x6d,0x85,0x05,0xdc,0xff,0xee,0x07,0x00,0x00,0x00,0xe0,0xff,0xff,0x22,0x00,0x00,0x00,0x01,0xef,0xff,0xff,0x14,0x00,0x00,0x00,0x00,0x05,0x3a,0x00,0x00,0x00,0xc3,0xd3,0xac,0x09,0x89,0xe2,0xf6,0xe8,0xa2,0x22,0x00,0x00,0x00,0x00,0x00,0x10,0x7f,0xd6,0xf2,0xf5,0xda,0x8c,0x17,0x00,0x00,0x00,0x00,0x00,0x08,0x72,0xce,0xf0,0xf5,0xdf,0x94,0x1e,0x00,0x00,0x00,0x00,0xcc,0xff,0xff,0x0c,0x00,0x00,0x4c,0xff,0xff,0xa3,0x00,0x00,0x00,0x00,0x00,0x66,0xff,0xff,0x9e,0x00,0x00,0x8f,0xcc,0xcb,0x28,0x00,0x00,0x00,0x00,0x9f,0xcb,0xcb,0x11,0x00,0x00,0x00,0x38,0xb4,0xee,0xf5,0xd7,0x71,0x12,0xfe,0xff,0xc0,0x00,0x00,0x00,0x03,0x6f,0xd5,0xf5,0xf0,0xb8,0x35,0x8b,0xff,0xff,0x44,0x33,0xc8,0xc8,0x8f,0x00,0x00,0x00,0x00,0x00,0x72,0xc8,0xc8,0x30,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x29,0xff,0xff,0x32,0xad,0x54,0xe7,0x75,0xf7,0x2a,0xe9,0xff,0xb9,0x04,0x36,0x8c,0xe8,0xff,0xec,0x05,0x84,0x70,0x74,0x2d,0x00,0x00,0x85,0x1e,0xd9,0x12,0x73,0xff,0xff,0xbf,0x6b,0x0f,0x00,0xb6,0xff,0xff,0x3d,0x00,0x00,0x00,0x02,0xf2,0xff,0xff,0x61,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xec,0xff,0xe9,0xc0,0xff,0xff,0xff,0xff,0xff,0xf0,0x38,0x00,0x00,0x00,0x2f,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,0xe9,0x39,0x00,0x00,0x00,0x19,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0x4b,0x00,0x00,0x00,0xcc,0xff,0xff,0x0c,0x00,0x00,0x4c,0xff,0xff,0xa3,0x00,0x00,0x00,0x00,0x00,0x69,0xff,0xff,0x77,0x00,0x00,0xb6,0xff,0xff,0x34,0x00,0x00,0x00,0x00,0xc5,0xff,0xff,0x1b,0x00,0x00,0x58,0xfb,0xff,0xff,0xff,0xff,0xff,0xbb,0xff,0xff,0xc1,0x00,0x00,0x04,0xb4,0xff,0xff,0xff,0xff,0xff,0xf6,0xca,0xff,0xff,0x45,0x05,0xe0,0xff,0xf8,0x15,0x00,0x00,0x00,0x02,0xe2,0xff,0xd9,0x03,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x3c,0xff,0xff,0x10,0xc8,0x40,0xf6,0x6b,0xee,0x52,0xfc,0xff,0xa2,0x0c,0xe2,0xff,0xff,0xff,0xbc,0x00,0xb9,0x1b,0xd0,0x12,0xb2,0x5f,0x6f,0x74,0x97,0x4d,0x30,0xff,0xff,0xff,0xff,0x66,0x00,0xa0,0xff,0xff,0x48,0x00,0x00,0x00,0x00,0xb6,0xff,0xff,0xff,0xcf,0x7c,0x39,0x03,0x00,0x00,0x00,0x00,0x00,0xea,0xff,0xff,0xff,0xd4,0x8d,0x96,0xea,0xff,0xff,0xe4,0x0d,0x00,0x0e,0xdf,0xff,0xff,0xdf,0x92,0x91,0xdd,0xff,0xff,0xeb,0x1a,0x00,0x03,0xc9,0xff,0xff,0xe6,0x95,0x8e,0xd5,0xff,0xff,0xf5,0x2a,0x00,0x00,0xcc,0xff,0xff,0x0c,0x00,0x00,0x4c,0xff,0xff,0xc0,0x45,0x3f,0x3f,0x43,0x68,0xea,0xff,0xea,0x17,0x00,0x00,0xb5,0xff,0xff,0x35,0x00,0x00,0x00,0x00,0xc5,0xff,0xff,0x1b,0x00,0x1f,0xf4,0xff,0xff,0xcf,0x7c,0x85,0xde,0xff,0xff,0xff,0xc1,0x00,0x00,0x7e,0xff,0xff,0xfa,0x9e,0x73,0xa4,0xfc,0xff,0xff,0xff,0x45,0x00,0x7c,0xff,0xff,0x70,0x00,0x00,0x00,0x48,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x46,0xff,0xff,0x0b,0xcc,0x3f,0xfb,0x67,0xe9,0x73,0xff,0xff,0x95,0x03,0xe1,0xff,0xff,0xff,0xb0,0x00,0xc5,0x12,0xcc,0x32,0xff,0xb9,0x5a,0x85,0x86,0x5d,0x1f,0xff,0xff,0xff,0xff,0x69,0x00,0x9a,0xff,0xff,0x4e,0x00,0x00,0x00,0x00,0x25,0xe1,0xff,0xff,0xff,0xff,0xff,0xeb,0x96,0x21,0x00,0x00,0x00,0xe4,0xff,0xff,0xb3,0x05,0x00,0x00,0x16,0xd8,0xff,0xff,0x6d,0x00,0x6f,0xff,0xff,0xc7,0x0b,0x00,0x00,0x09,0xc2,0xff,0xff,0x91,0x00,0x55,0xff,0xff,0xd5,0x13,0x00,0x00,0x04,0xa8,0xff,0xff,0xae,0x00,0x00,0xcb,0xff,0xff,0x0d,0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0x2d,0x00,0x00,0x00,0xb5,0xff,0xff,0x36,0x00,0x00,0x00,0x00,0xc5,0xff,0xff,0x19,0x00,0x8b,0xff,0xff,0xb3,0x04,0x00,0x00,0x0e,0xce,0xff,0xff,0xc5,0x00,0x07,0xee,0xff,0xfe,0x48,0x00,0x00,0x00,0x4f,0xfe,0xff,0xff,0x45,0x00,0x15,0xf6,0xff,0xd4,0x01,0x00,0x00,0xaa,0xff,0xf2,0x0e,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x44,0xff,0xff,0x0c,0xca,0x3d,0xf8,0x67,0xeb,0x70,0xff,0xff,0x91,0x00,0xdf,0xff,0xff,0xff,0xb9,0x00,0xa5,0x2e,0xb8,0x20,0xce,0x3b,0x89,0x3f,0xb9,0x36,0x27,0xff,0xff,0xff,0xff,0x68,0x00,0x9d,0xff,0xff,0x47,0x00,0x00,0x00,0x00,0x00,0x0d,0x73,0xd1,0xff,0xff,0xff,0xff,0xff,0xf3,0x42,0x00,0x00,0xe0,0xff,0xff,0x31,0x00,0x00,0x00,0x00,0x59,0xff,0xff,0xb3,0x00,0xc3,0xff,0xff,0x45,0x00,0x00,0x00,0x00,0x31,0xff,0xff,0xdc,0x00,0xa8,0xff,0xff,0x4f,0x00,0x00,0x00,0x00,0x15,0xfa,0xff,0xf5,0x05,0x00,0xcb,0xff,0xff,0x0c,0x00,0x00,0x4c,0xff,0xff,0xff,0xfe,0xfe,0xfe,0xfe,0xfe,0xff,0xff,0xd8,0x28,0x00,0x00,0xb5,0xff,0xff,0x36,0x00,0x00,0x00,0x00,0xc5,0xff,0xff,0x19,0x00,0xd4,0xff,0xff,0x32,0x00,0x00,0x00,0x00,0x50,0xff,0xff,0xcb,0x00,0x3c,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xff,0x45,0x00,0x00,0x9d,0xff,0xff,0x3c,0x00,0x12,0xf7,0xff,0x96,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x30,0xff,0xff,0x29,0xc2,0x42,0xe8,0x72,0xf2,0x63,0xff,0xff,0xa4,0x00,0x87,0xf1,0xff,0xff,0xe4,0x02,0x4c,0xb2,0x0f,0x49,0xdd,0x91,0x17,0x42,0xca,0x03,0x5e,0xff,0xff,0xfc,0xcc,0x34,0x00,0xab,0xff,0xff,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x5e,0xb2,0xfc,0xff,0xff,0xe1,0x05,0x00,0xe9,0xff,0xfb,0x09,0x00,0x00,0x00,0x00,0x26,0xff,0xff,0xcd,0x00,0xde,0xff,0xff,0x11,0x00,0x00,0x00,0x00,0x05,0xf8,0xff,0xfb,0x08,0xc8,0xff,0xff,0x23,0x00,0x00,0x00,0x00,0x00,0xd7,0xff,0xff,0x26,0x00,0xca,0xff,0xff,0x0b,0x00,0x00,0x4c,0xff,0xff,0xa3,0x01,0x01,0x01,0x01,0x0c,0x6b,0xfb,0xff,0xde,0x06,0x00,0xb5,0xff,0xff,0x36,0x00,0x00,0x00,0x00,0xc6,0xff,0xff,0x17,0x00,0xe8,0xff,0xfe,0x06,0x00,0x00,0x00,0x00,0x17,0xff,0xff,0xd0,0x00,0x5a,0xff,0xff,0x97,0x00,0x00,0x00,0x00,0x00,0x8c,0xff,0xff,0x45,0x00,0x00,0x2d,0xfd,0xff,0xa4,0x00,0x6d,0xff,0xfe,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x1a,0xfe,0xff,0x43,0x9f,0x64,0xcd,0x7f,0xfe,0x61,0xfe,0xff,0xd2,0x05,0x00,0x08,0xa1,0xff,0xff,0x45,0x00,0x55,0x07,0xf1,0xec,0xf1,0x72,0x26,0x28,0x02,0xb8,0xff,0xf5,0x20,0x00,0x00,0x00,0xd6,0xff,0xff,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xfc,0xff,0xff,0x26,0x00,0xe9,0xff,0xfe,0x23,0x00,0x00,0x00,0x00,0x35,0xff,0xff,0xc7,0x00,0xd6,0xff,0xff,0x28,0x00,0x00,0x00,0x00,0x11,0xff,0xff,0xf0,0x04,0xc0,0xff,0xff,0x35,0x00,0x00,0x00,0x00,0x03,0xed,0xff,0xff,0x15,0x00,0xca,0xff,0xff,0x08,0x00,0x00,0x4c,0xff,0xff,0xa3,0x00,0x00,0x00,0x00,0x00,0x00,0xba,0xff,0xff,0x42,0x00,0xb4,0xff,0xff,0x38,0x00,0x00,0x00,0x00,0xd7,0xff,0xff,0x19,0x00,0xe2,0xff,0xff,0x18,0x00,0x00,0x00,0x00,0x26,0xff,0xff,0xce,0x00,0x49,0xff,0xff,0xaf,0x00,0x00,0x00,0x00,0x00,0x9c,0xff,0xff,0x46,0x00,0x00,0x00,0xba,0xff,0xf8,0x18,0xcf,0xff,0xbb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xff,0x70,0x74,0x97,0xa9,0x96,0xfe,0x4a,0xef,0xff,0xfb,0x3c,0x00,0x00,0x24,0xfd,0xff,0xce,0x0a,0x00,0x4e,0xfe,0xfb,0xfb,0xd4,0x04,0x01,0x48,0xfe,0xff,0xa8,0x00,0x00,0x00,0x0d,0xfc,0xff,0xf2,0x03,0x00,0x00,0x00,0x00,0x79,0x67,0x05,0x00,0x00,0x00,0x00,0x01,0xea,0xff,0xff,0x29,0x00,0xe2,0xff,0xff,0x87,0x00,0x00,0x00,0x00,0x9c,0xff,0xff,0x95,0x00,0x9e,0xff,0xff,0x90,0x00,0x00,0x00,0x00,0x75,0xff,0xff,0xb7,0x00,0x82,0xff,0xff,0xa0,0x00,0x00,0x00,0x00,0x57,0xff,0xff,0xd6,0x00,0x00,0xca,0xff,0xff,0x0a,0x00,0x00,0x4c,0xff,0xff,0xa3,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0xff,0x55,0x00,0xa6,0xff,0xff,0x70,0x00,0x00,0x00,0x34,0xfd,0xff,0xff,0x17,0x00,0xad,0xff,0xff,0x7c,0x00,0x00,0x00,0x00,0x84,0xff,0xff,0xc9,0x00,0x17,0xfb,0xff,0xf5,0x1e,0x00,0x00,0x00,0x11,0xeb,0xff,0xff,0x46,0x00,0x00,0x00,0x4a,0xff,0xff,0xa4,0xff,0xff,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xff,0xad,0x3a,0xd8,0x69,0xb3,0xdc,0x6c,0xb9,0xff,0xff,0x8c,0x00,0x00,0x0d,0xf3,0xff,0xff,0xb1,0x0a,0x8d,0xff,0xff,0xff,0xff,0x16,0x35,0xec,0xff,0xff,0xa3,0x00,0x00,0x00,0x51,0xff,0xff,0xbe,0x00,0x00,0x00,0x00,0x17,0xf5,0xff,0xdc,0x83,0x42,0x25,0x38,0x9b,0xff,0xff,0xe7,0x06,0x00,0xdd,0xff,0xff,0xfd,0x89,0x2e,0x2e,0x94,0xfe,0xff,0xfe,0x37,0x00,0x34,0xfd,0xff,0xfd,0x88,0x28,0x25,0x79,0xfa,0xff,0xff,0x47,0x00,0x1f,0xf6,0xff,0xff,0x98,0x2b,0x23,0x70,0xf4,0xff,0xff,0x66,0x00,0x00,0xcb,0xff,0xff,0x0a,0x00,0x00,0x4c,0xff,0xff,0xb8,0x3a,0x3a,0x3b,0x3b,0x3e,0x90,0xfe,0xff,0xfd,0x21,0x00,0x71,0xff,0xff,0xf2,0x65,0x37,0x63,0xe7,0xff,0xff,0xff,0x13,0x00,0x4d,0xff,0xff,0xfb,0x78,0x1e,0x20,0x7e,0xfc,0xff,0xff,0xc9,0x00,0x00,0xb0,0xff,0xff,0xd9,0x49,0x18,0x3b,0xca,0xff,0xff,0xff,0x46,0x00,0x00,0x00,0x01,0xd6,0xff,0xff,0xff,0xdf,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0xff,0xef,0x0a,0xe7,0x56,0xee,0xa5,0xad,0x76,0xff,0xff,0xd5,0x02,0x00,0x76,0xff,0xff,0xff,0xff,0xdf,0xbf,0xed,0xfc,0xf8,0xa1,0x81,0xf6,0xff,0xff,0xff,0xfb,0x24,0x00,0x00,0xae,0xfe,0xff,0x7c,0x00,0x00,0x00,0x00,0x48,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x5e,0x00,0x00,0xd9,0xff,0xff,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0x00,0x00,0x00,0x77,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8f,0x00,0x00,0x00,0x5c,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa7,0x02,0x00,0x00,0xce,0xff,0xff,0x0a,0x00,0x00,0x4c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x96,0x00,0x00,0x17,0xed,0xff,0xff,0xff,0xff,0xff,0xfd,0xe4,0xff,0xff,0x14,0x00,0x01,0xa8,0xff,0xff,0xff,0xff,0xff,0xff,0xe9,0xf9,0xff,0xcc,0x00,0x00,0x1f,0xe8,0xff,0xff,0xff,0xff,0xff,0xff,0xe5,0xff,0xff,0x47,0x00,0x00,0x00,0x00,0x67,0xff,0xff,0xff,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0xfb,0xff,0x56,0x85,0x9d,0xc5,0xbc,0xf5,0x2f,0xfc,0xff,0xfc,0x28,0x00,0xc2,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x44,0x00,0x1e,0xf0,0xf9,0xfb,0x25,0x00,0x00,0x00,0x00,0x00,0x22,0x90,0xe7,0xff,0xff,0xff,0xff,0xff,0xe0,0x59,0x00,0x00,0x00,0xd5,0xff,0xfd,0x42,0xd7,0xff,0xff,0xff,0xf3,0x7d,0x03,0x00,0x00,0x00,0x00,0x53,0xdb,0xff,0xff,0xff,0xff,0xe5,0x65,0x01,0x00,0x00,0x00,0x00,0x40,0xce,0xff,0xff,0xff,0xff,0xea,0x74,0x02,0x00,0x00,0x00,0xd1,0xff,0xff,0x0c,0x00,0x00,0x4b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0xce,0x65,0x02,0x00,0x00,0x00,0x3d,0xe1,0xff,0xff,0xff,0xee,0x5f,0x9d,0xff,0xff,0x11,0x00,0x00,0x06,0x89,0xf7,0xff,0xff,0xff,0xcd,0x29,0xef,0xff,0xcd,0x00,0x00,0x00,0x24,0xbe,0xfe,0xff,0xff,0xfb,0x89,0x6b,0xff,0xff,0x47,0x00,0x00,0x00,0x00,0x0b,0xf0,0xff,0xf8,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xff,0xcb,0x1b,0xef,0x90,0xeb,0xf8,0x63,0xbb,0xff,0xff,0x91,0x00,0x25,0xe4,0xff,0xfe,0xe8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xed,0xff,0xff,0x7a,0x00,0x00,0x9b,0xce,0xe7,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x25,0x50,0x5e,0x58,0x2b,0x03,0x00,0x00,0x00,0x00,0xd9,0xff,0xfe,0x18,0x04,0x39,0x5e,0x4a,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x29,0x58,0x5d,0x34,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x25,0x55,0x5c,0x35,0x05,0x00,0x00,0x00,0x00,0x00,0x1f,0x2d,0x28,0x01,0x00,0x00,0x08,0x2b,0x29,0x2c,0x2c,0x2a,0x27,0x22,0x15,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x41,0x5e,0x49,0x0a,0x00,0x16,0x2a,0x24,0x01,0x00,0x00,0x00,0x00,0x10,0x4d,0x5e,0x33,0x02,0x00,0x21,0x28,0x1a,0x00,0x00,0x00,0x00,0x00,0x25,0x5a,0x54,0x1a,0x00,0x0c,0x2c,0x28,0x09,0x00,0x00,0x00,0x00,0x1d,0xf9,0xff,0xa3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xfe,0xff,0x4f,0x7c,0xd4,0xe5,0xfb,0xcd,0x3c,0xff,0xff,0xfa,0x39,0x00,0x2d,0xb2,0x47,0x01,0x45,0xd7,0xff,0xff,0xff,0xff,0x70,0x09,0x10,0x8e,0x8c,0x01,0x00,0x40,0xf6,0xf3,0xe6,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xda,0xff,0xfe,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x86,0x5e,0xce,0xff,0xfd,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0xe1,0x17,0xca,0xef,0xff,0xff,0x54,0xb0,0xff,0xff,0xda,0x10,0x00,0x00,0x00,0x00,0x00,0x63,0xff,0xff,0xff,0xe4,0x02,0x00,0x00,0x00,0x00,0x00,0x1a,0xe3,0xfc,0xfd,0xb3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0xff,0xfd,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xee,0xff,0xff,0xff,0xff,0x9a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0xeb,0xff,0xaf,0x21,0xe4,0xff,0xff,0xdd,0x2b,0xef,0xff,0xff,0xc3,0x0e,0x00,0x00,0x00,0x00,0x19,0xfc,0xff,0xff,0x9c,0x00,0x00,0x00,0x00,0x00,0x18,0xd2,0xfd,0xfe,0xf0,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb1,0xd7,0xd2,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x96,0xeb,0xfc,0xe4,0x7c,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xfd,0xff,0x9b,0x2c,0xe2,0xff,0xff,0x99,0x58,0xfe,0xff,0xff,0xd2,0x26,0x00,0x00,0x00,0x00,0x2c,0x34,0x34,0x14,0x00,0x00,0x00,0x00,0x30,0xde,0xfe,0xfe,0xfd,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0xfe,0xff,0xad,0x24,0xba,0xff,0xfe,0x59,0x83,0xff,0xff,0xff,0xf1,0x6c,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x83,0xf8,0xff,0xff,0xfe,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0xfc,0xff,0xd9,0x41,0x5a,0xda,0xf8,0x55,0x84,0xfe,0xff,0xff,0xff,0xdf,0x85,0x41,0x19,0x07,0x08,0x22,0x4f,0x94,0xef,0xff,0xff,0xff,0xfd,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xe8,0xff,0xfe,0xb8,0x49,0x4a,0x89,0x30,0x5e,0xef,0xff,0xff,0xff,0xff,0xff,0xfe,0xfd,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x9a,0xfb,0xff,0xff,0xf0,0xba,0xa7,0x8e,0x31,0xae,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x97,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x89,0xe2,0xff,0xff,0xff,0xff,0xe9,0x60,0x30,0x97,0xe8,0xff,0xff,0xff,0xff,0xff,0xfd,0xd8,0x81,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x2a,0x5c,0x7e,0x8a,0x7b,0x57,0x08,0x00,0x02,0x25,0x43,0x5b,0x57,0x3e,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 };
 
 const lv_image_dsc_t img_spoolbuddy_logo_dark = {
   .header = {
     .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_ARGB8888,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
     .flags = 0,
     .w = 180,
     .h = 46,
-    .stride = 720,
+    .stride = 360,
     .reserved_2 = 0,
   },
   .data_size = sizeof(img_spoolbuddy_logo_dark_map),
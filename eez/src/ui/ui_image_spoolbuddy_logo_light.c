@@ -24,66 +24,112 @@
 #define LV_ATTRIBUTE_IMG_SPOOLBUDDY_LOGO_LIGHT
 #endif
 
+// Converted by convert_eez_images.py (ARGB8888, 32400 bytes)
 static const
 LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_SPOOLBUDDY_LOGO_LIGHT
 uint8_t img_spoolbuddy_logo_light_map[] = {
 
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x7e,0x52,0x03,0x40,0x75,0x35,0x04,0x50,0x81,0x47,0x03,0x92,0xb4,0x8d,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x75,0x36,0x18,0x3b,0x73,0x33,0x70,0x39,0x6e,0x30,0xa6,0x39,0x6c,0x31,0xcc,0x3b,0x6d,0x32,0xd4,0x3c,0x6e,0x33,0xc2,0x3e,0x70,0x36,0xac,0x44,0x74,0x3c,0x3c,0x70,0x9c,0x6d,0x01,0x55,0x53,0x53,0x0a,0x50,0x50,0x50,0x58,0x51,0x4f,0x4f,0x9a,0x5a,0x59,0x59,0xc3,0x63,0x62,0x61,0xd7,0x65,0x65,0x64,0xd8,0x60,0x5f,0x5f,0xcc,0x58,0x57,0x57,0xa7,0x57,0x55,0x56,0x7b,0x5b,0x5b,0x5a,0x35,0x67,0x64,0x64,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x71,0x33,0x2d,0x3c,0x73,0x34,0xab,0x3c,0x72,0x33,0xf5,0x3c,0x72,0x33,0xf8,0x3d,0x71,0x33,0xf1,0x3c,0x6f,0x33,0xf1,0x3b,0x6c,0x32,0xee,0x3b,0x6b,0x33,0xb6,0x3c,0x6d,0x35,0x32,0x49,0x49,0x49,0x20,0x4b,0x4a,0x4b,0x8b,0x71,0x6f,0x70,0xed,0x86,0x86,0x86,0xff,0x90,0x90,0x8f,0xff,0x90,0x8e,0x8e,0xff,0x8b,0x89,0x89,0xff,0x87,0x85,0x84,0xff,0x84,0x82,0x81,0xff,0x7f,0x7e,0x7d,0xff,0x77,0x77,0x77,0xff,0x6e,0x6d,0x6e,0xff,0x62,0x62,0x62,0xd8,0x5c,0x5c,0x5d,0x66,0x5d,0x5e,0x5b,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x72,0x3b,0x04,0x39,0x6b,0x2f,0x7e,0x37,0x6c,0x30,0xf1,0x39,0x6e,0x31,0xf7,0x3c,0x70,0x33,0xda,0x40,0x73,0x37,0x97,0x41,0x75,0x37,0x50,0x43,0x76,0x39,0x21,0x73,0x99,0x6f,0x0a,0x57,0x59,0x54,0x04,0x3c,0x3b,0x3a,0x7c,0x61,0x60,0x60,0xf2,0x8e,0x8e,0x8d,0xff,0x9b,0x9a,0x99,0xff,0x9b,0x9b,0x9a,0xff,0x93,0x93,0x93,0xff,0x84,0x83,0x83,0xff,0x78,0x77,0x76,0xff,0x74,0x72,0x72,0xff,0x76,0x75,0x75,0xff,0x7c,0x7b,0x7b,0xff,0x7f,0x7f,0x7e,0xff,0x7b,0x7b,0x7a,0xff,0x77,0x76,0x76,0xff,0x69,0x69,0x68,0xff,0x5a,0x5a,0x59,0xd4,0x59,0x59,0x57,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x75,0x37,0x16,0x3b,0x6e,0x30,0xb8,0x39,0x6c,0x30,0xf4,0x39,0x6c,0x31,0xd7,0x3a,0x6c,0x32,0x66,0x3f,0x70,0x38,0x13,0x00,0x00,0x00,0x00,0x54,0x83,0x48,0x01,0x00,0x00,0x00,0x00,0x42,0x45,0x42,0x12,0x41,0x41,0x41,0xbd,0x7b,0x7c,0x7b,0xff,0x97,0x97,0x96,0xff,0x98,0x97,0x96,0xff,0x7f,0x7d,0x7e,0xff,0x5e,0x5d,0x5d,0xdf,0x40,0x40,0x40,0x95,0x3d,0x3c,0x3c,0x61,0x3a,0x39,0x39,0x46,0x3d,0x3c,0x3c,0x41,0x40,0x40,0x3f,0x56,0x42,0x42,0x42,0x7e,0x4f,0x4f,0x4f,0xbf,0x5e,0x5e,0x5d,0xfa,0x6e,0x6e,0x6d,0xff,0x72,0x72,0x70,0xff,0x6e,0x6d,0x6c,0xff,0x60,0x60,0x5f,0xfa,0x5e,0x5e,0x5e,0x70,0x6e,0x71,0x6e,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x73,0x35,0x1a,0x3d,0x71,0x31,0xd2,0x3c,0x70,0x32,0xfa,0x3c,0x71,0x32,0xcd,0x3e,0x6f,0x37,0x1c,0x39,0x6f,0x30,0x0f,0x38,0x6c,0x31,0x4a,0x3a,0x6e,0x31,0x4e,0x3f,0x70,0x35,0x13,0x36,0x3a,0x36,0x11,0x42,0x43,0x43,0xce,0x88,0x88,0x87,0xff,0x99,0x99,0x98,0xff,0x8a,0x8a,0x89,0xff,0x55,0x55,0x55,0xcd,0x33,0x33,0x32,0x46,0x40,0x42,0x40,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x3f,0x3c,0x1e,0x3f,0x40,0x3e,0x94,0x58,0x58,0x57,0xf9,0x6e,0x6d,0x6c,0xff,0x6c,0x6c,0x6c,0xff,0x65,0x65,0x65,0xff,0x61,0x60,0x61,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x72,0x3d,0x0c,0x3b,0x6e,0x30,0xcb,0x3c,0x6f,0x32,0xfb,0x3e,0x71,0x34,0xd1,0x46,0x76,0x3e,0x27,0x41,0x74,0x38,0x21,0x3b,0x6f,0x32,0x7d,0x38,0x6d,0x30,0xb8,0x3a,0x6c,0x30,0x76,0x3c,0x55,0x3a,0x0e,0x38,0x3a,0x39,0xc0,0x84,0x83,0x82,0xff,0x96,0x95,0x94,0xff,0x78,0x78,0x77,0xfc,0x3b,0x3a,0x39,0x7b,0x4c,0x4a,0x4b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x47,0x46,0x2d,0x4f,0x4f,0x4f,0xd4,0x68,0x67,0x67,0xff,0x67,0x67,0x67,0xff,0x62,0x62,0x62,0xfe,0x5f,0x5e,0x5e,0x6a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x6a,0x2f,0x9d,0x37,0x6b,0x2f,0xfb,0x3b,0x6d,0x32,0xe2,0x40,0x75,0x38,0x22,0x68,0x8d,0x58,0x01,0x60,0x88,0x5b,0x34,0x45,0x78,0x3b,0x61,0x3f,0x72,0x33,0x3a,0x46,0x76,0x34,0x05,0x32,0x32,0x32,0x97,0x77,0x76,0x75,0xff,0x8e,0x8d,0x8d,0xff,0x6d,0x6b,0x6a,0xf9,0x31,0x2f,0x2e,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x62,0x62,0x83,0x6a,0x69,0x69,0xbb,0x68,0x67,0x66,0xb5,0x5f,0x5e,0x5d,0x7b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0x4c,0x4a,0x10,0x4c,0x4c,0x4b,0xbb,0x60,0x5e,0x5f,0xff,0x60,0x60,0x5f,0xff,0x5e,0x5d,0x5d,0xf7,0x5f,0x5e,0x5e,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x6b,0x31,0x49,0x37,0x6a,0x30,0xfb,0x38,0x6a,0x30,0xf8,0x3e,0x6e,0x35,0x50,0x6a,0x89,0x62,0x01,0x98,0xaa,0x9a,0x0f,0x80,0x9d,0x7f,0x44,0x42,0x74,0x34,0x38,0x44,0x75,0x37,0x19,0x33,0x32,0x33,0x3b,0x64,0x63,0x63,0xfe,0x89,0x89,0x89,0xff,0x70,0x6e,0x6e,0xfe,0x2c,0x2a,0x2a,0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0x6d,0x6d,0x06,0x71,0x70,0x70,0xef,0x85,0x83,0x82,0xff,0x7f,0x7d,0x7c,0xff,0x6c,0x6b,0x69,0xf3,0x67,0x67,0x65,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0x4c,0x4c,0x0a,0x4c,0x4b,0x4b,0xcb,0x5d,0x5c,0x5c,0xff,0x5c,0x5b,0x5b,0xff,0x61,0x61,0x61,0xcc,0x6e,0x6b,0x6e,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0x78,0x43,0x05,0x3a,0x6f,0x33,0xd4,0x39,0x6d,0x32,0xfc,0x3b,0x6b,0x33,0x9e,0x61,0x80,0x5c,0x01,0x59,0x75,0x4d,0x04,0x98,0xab,0x9e,0x1e,0x56,0x7e,0x52,0x38,0x3e,0x71,0x32,0x90,0x3f,0x74,0x34,0x18,0x43,0x42,0x42,0xca,0x85,0x84,0x84,0xff,0x80,0x7f,0x7f,0xff,0x37,0x36,0x36,0x8b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x4e,0x4f,0x31,0x63,0x66,0x63,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x61,0x61,0x45,0x80,0x7e,0x7d,0xff,0x89,0x86,0x85,0xff,0x82,0x80,0x7f,0xff,0x77,0x76,0x74,0xff,0x60,0x60,0x5f,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0x79,0x79,0x02,0x66,0x65,0x65,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x4f,0x4e,0x1a,0x53,0x53,0x53,0xeb,0x5a,0x59,0x5a,0xff,0x5d,0x5d,0x5d,0xff,0x67,0x67,0x67,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x72,0x36,0x5b,0x3a,0x6f,0x33,0xfc,0x3b,0x70,0x33,0xf1,0x48,0x73,0x3f,0x1e,0x5e,0x7c,0x5c,0x02,0x93,0xa5,0x90,0x05,0x81,0x95,0x83,0x09,0x71,0x8e,0x73,0x69,0x3b,0x6b,0x31,0x4a,0x2e,0x2e,0x2e,0x56,0x66,0x65,0x65,0xff,0x82,0x81,0x81,0xff,0x54,0x54,0x54,0xdc,0x32,0x36,0x37,0x07,0x00,0x00,0x00,0x00,0x50,0x50,0x50,0x41,0x6a,0x69,0x69,0xf9,0x65,0x65,0x65,0xd5,0x58,0x59,0x5a,0x51,0x5e,0x5e,0x5e,0x8a,0x7d,0x7c,0x7c,0xf3,0x99,0x99,0x98,0xff,0x91,0x8f,0x8e,0xff,0x88,0x86,0x85,0xff,0x83,0x82,0x82,0xff,0x6f,0x6f,0x6f,0xfd,0x62,0x62,0x63,0xa8,0x68,0x68,0x69,0x60,0x65,0x64,0x65,0xc7,0x68,0x67,0x67,0xfc,0x6d,0x6d,0x6d,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x53,0x53,0x61,0x56,0x56,0x56,0xff,0x56,0x56,0x56,0xff,0x63,0x64,0x63,0xe2,0x6d,0x6e,0x6d,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x74,0x3b,0x05,0x44,0x75,0x38,0x11,0x42,0x74,0x37,0x0d,0x3d,0x6e,0x31,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x38,0x39,0x07,0x38,0x37,0x39,0x15,0x37,0x35,0x37,0x13,0x30,0x2c,0x2e,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x37,0x38,0x0e,0x3b,0x38,0x3a,0x13,0x3c,0x3c,0x3c,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x6f,0x32,0xbf,0x39,0x70,0x32,0xfc,0x3f,0x73,0x36,0x84,0x00,0x00,0x00,0x00,0x8d,0xac,0x81,0x01,0xb1,0xc2,0xb1,0x02,0x96,0xa4,0x9d,0x11,0x8b,0x9e,0x8e,0x1c,0x3e,0x6e,0x38,0x04,0x35,0x35,0x35,0xb9,0x77,0x76,0x76,0xff,0x6e,0x6d,0x6c,0xff,0x2c,0x2b,0x2b,0x58,0x00,0x00,0x00,0x00,0x4d,0x4e,0x4d,0x27,0x65,0x66,0x65,0xec,0x8c,0x8c,0x8c,0xff,0x97,0x97,0x97,0xff,0x8c,0x8d,0x8d,0xff,0xa5,0xa5,0xa5,0xff,0xa9,0xa8,0xa8,0xff,0x90,0x8e,0x8e,0xff,0x7a,0x7a,0x79,0xff,0x71,0x70,0x70,0xff,0x73,0x72,0x72,0xff,0x7a,0x78,0x79,0xff,0x75,0x74,0x74,0xff,0x6d,0x6d,0x6d,0xff,0x6f,0x6f,0x6f,0xff,0x6e,0x6e,0x6e,0xff,0x6c,0x6d,0x6c,0xf6,0x6e,0x6e,0x6d,0x3b,0x00,0x00,0x00,0x00,0x69,0x68,0x69,0x02,0x53,0x54,0x53,0xce,0x53,0x53,0x53,0xff,0x5c,0x5c,0x5b,0xff,0x69,0x69,0x69,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x8b,0x54,0x01,0x43,0x72,0x3a,0x1e,0x3e,0x70,0x34,0x50,0x41,0x77,0x36,0x65,0x43,0x76,0x38,0x5d,0x40,0x71,0x35,0x34,0x4d,0x7c,0x44,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x70,0x35,0x50,0x3c,0x72,0x34,0xfc,0x3b,0x74,0x34,0xfa,0x43,0x78,0x3c,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x44,0x44,0x11,0x40,0x40,0x40,0x12,0x40,0x3f,0x40,0x11,0x40,0x41,0x42,0x13,0x42,0x41,0x42,0x13,0x44,0x41,0x44,0x12,0x40,0x3f,0x3f,0x10,0x3e,0x3e,0x3f,0x0e,0x35,0x33,0x34,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x37,0x38,0x62,0x34,0x34,0x34,0xfe,0x34,0x33,0x33,0xfd,0x33,0x31,0x30,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x33,0x34,0xbd,0x34,0x34,0x34,0xfd,0x39,0x38,0x38,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x70,0x34,0x25,0x38,0x6d,0x30,0xf5,0x38,0x6f,0x30,0xf7,0x40,0x74,0x39,0x27,0x42,0x7e,0x39,0x01,0x7e,0x87,0x7e,0x02,0x00,0x00,0x00,0x00,0xad,0xb6,0xaf,0x05,0x00,0x00,0x00,0x00,0x32,0x32,0x33,0x1e,0x51,0x50,0x51,0xfd,0x75,0x75,0x75,0xff,0x4c,0x4b,0x4a,0xdb,0x3f,0x3c,0x3a,0x03,0x00,0x00,0x00,0x00,0x42,0x43,0x43,0x7f,0x79,0x7a,0x79,0xff,0x8a,0x8b,0x8a,0xff,0x9a,0x9b,0x9a,0xff,0xab,0xab,0xab,0xff,0x92,0x92,0x93,0xff,0x53,0x53,0x53,0xbf,0x3b,0x39,0x3a,0x5f,0x48,0x47,0x45,0x35,0x4a,0x49,0x47,0x31,0x3f,0x3e,0x3e,0x53,0x42,0x42,0x42,0xad,0x60,0x5f,0x60,0xfe,0x71,0x71,0x71,0xff,0x6e,0x6e,0x6e,0xff,0x6b,0x6c,0x6b,0xff,0x60,0x61,0x60,0xff,0x69,0x69,0x67,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x59,0x59,0x5c,0x53,0x53,0x53,0xff,0x51,0x51,0x51,0xff,0x69,0x69,0x69,0xb4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x79,0x38,0x22,0x3f,0x75,0x34,0xb8,0x3c,0x72,0x32,0xf9,0x3d,0x71,0x33,0xfb,0x3e,0x72,0x34,0xfb,0x3e,0x72,0x34,0xfb,0x3e,0x73,0x34,0xfb,0x3f,0x75,0x33,0xee,0x40,0x76,0x36,0xa9,0x43,0x74,0x39,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x72,0x35,0x53,0x3c,0x71,0x34,0xff,0x3c,0x71,0x34,0xff,0x3e,0x74,0x37,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x30,0xbd,0x32,0x32,0x32,0xff,0x33,0x33,0x32,0xff,0x33,0x33,0x33,0xff,0x34,0x34,0x33,0xff,0x33,0x33,0x33,0xff,0x32,0x32,0x32,0xff,0x32,0x31,0x32,0xff,0x31,0x31,0x32,0xf8,0x33,0x34,0x34,0xc2,0x37,0x36,0x37,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x34,0x34,0x61,0x32,0x30,0x31,0xff,0x32,0x31,0x31,0xff,0x33,0x31,0x30,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x32,0x32,0xbd,0x33,0x32,0x32,0xff,0x35,0x33,0x34,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x6c,0x30,0x6c,0x37,0x6c,0x2f,0xfc,0x38,0x6c,0x30,0xd0,0x7f,0x9c,0x7f,0x01,0x4d,0x7d,0x4d,0x01,0x00,0x00,0x00,0x00,0x71,0x89,0x6e,0x01,0x77,0x8c,0x72,0x03,0x00,0x00,0x00,0x00,0x2b,0x2a,0x2b,0x5e,0x63,0x62,0x62,0xff,0x6c,0x6c,0x6a,0xff,0x2c,0x2c,0x2c,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x46,0x43,0x16,0x60,0x61,0x60,0xf0,0x87,0x87,0x87,0xff,0x9a,0x9a,0x9a,0xff,0x7b,0x7b,0x7b,0xf9,0x3b,0x3b,0x3b,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x45,0x45,0x4a,0x56,0x56,0x56,0xf0,0x6a,0x6a,0x69,0xff,0x61,0x61,0x60,0xff,0x5e,0x5d,0x5c,0xe7,0x67,0x67,0x66,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x66,0x68,0x0b,0x57,0x57,0x57,0xed,0x4e,0x4e,0x4f,0xff,0x62,0x62,0x62,0xf8,0x78,0x78,0x75,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x73,0x34,0x13,0x3d,0x73,0x32,0xdc,0x3d,0x73,0x33,0xfb,0x3e,0x74,0x33,0xfb,0x3e,0x73,0x34,0xfb,0x3e,0x72,0x34,0xf8,0x3f,0x73,0x34,0xf9,0x40,0x75,0x34,0xfb,0x40,0x74,0x35,0xfb,0x40,0x73,0x35,0xfb,0x41,0x72,0x37,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x74,0x36,0x61,0x3e,0x72,0x35,0xff,0x3c,0x71,0x34,0xff,0x3e,0x72,0x35,0x6d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x35,0x34,0xbd,0x33,0x34,0x33,0xff,0x34,0x34,0x34,0xff,0x33,0x33,0x33,0xff,0x32,0x31,0x32,0xff,0x32,0x32,0x33,0xff,0x33,0x33,0x33,0xff,0x34,0x34,0x34,0xff,0x34,0x34,0x34,0xff,0x34,0x34,0x34,0xff,0x33,0x34,0x34,0xff,0x33,0x33,0x34,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x36,0x36,0x63,0x32,0x32,0x32,0xff,0x34,0x33,0x33,0xff,0x35,0x34,0x33,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x32,0x33,0xbf,0x33,0x32,0x32,0xff,0x37,0x36,0x36,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x6e,0x32,0xab,0x36,0x6b,0x2e,0xfd,0x38,0x6a,0x31,0x94,0x60,0x7d,0x5e,0x02,0x4a,0x6e,0x42,0x0b,0x6b,0x87,0x58,0x01,0x93,0xa0,0x90,0x06,0x64,0x87,0x5c,0x0a,0x5f,0x98,0x4d,0x01,0x35,0x35,0x35,0xa9,0x6d,0x6d,0x6c,0xff,0x5a,0x59,0x58,0xff,0x2b,0x2c,0x2b,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x46,0x46,0xa7,0x88,0x87,0x87,0xff,0x79,0x79,0x79,0xfc,0x36,0x36,0x37,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x47,0x47,0x3e,0x53,0x53,0x52,0xfa,0x55,0x54,0x54,0xff,0x5e,0x5d,0x5d,0xc9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x5b,0x5b,0xa3,0x4a,0x4a,0x4a,0xff,0x56,0x56,0x56,0xff,0x69,0x69,0x68,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x71,0x34,0x7c,0x3c,0x72,0x33,0xfb,0x3c,0x73,0x32,0xfb,0x3d,0x76,0x33,0xb8,0x45,0x78,0x3b,0x3b,0x61,0x83,0x58,0x23,0x49,0x77,0x40,0x27,0x44,0x77,0x3a,0x61,0x41,0x74,0x37,0xb8,0x41,0x74,0x36,0xf8,0x47,0x75,0x3c,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x73,0x34,0x61,0x3d,0x72,0x34,0xff,0x3d,0x72,0x33,0xff,0x3c,0x73,0x33,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x35,0x34,0xbc,0x33,0x34,0x33,0xff,0x35,0x34,0x34,0xf7,0x4d,0x4a,0x49,0x2d,0x4b,0x4a,0x49,0x2a,0x4e,0x4c,0x4d,0x2b,0x4d,0x4b,0x4c,0x2a,0x40,0x40,0x3f,0x36,0x38,0x38,0x38,0x99,0x34,0x34,0x34,0xff,0x32,0x33,0x33,0xff,0x32,0x33,0x33,0xd9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x3b,0x3b,0x62,0x34,0x35,0x34,0xff,0x34,0x34,0x33,0xff,0x32,0x32,0x31,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x35,0x35,0xc0,0x35,0x35,0x34,0xff,0x38,0x38,0x37,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x6e,0x32,0xd8,0x38,0x6e,0x30,0xfd,0x3d,0x70,0x37,0x5c,0x40,0x6c,0x3c,0x13,0x3f,0x6d,0x39,0x24,0x35,0x84,0x2d,0x01,0x8b,0x9e,0x8b,0x0a,0x42,0x77,0x38,0x31,0x44,0x88,0x40,0x03,0x45,0x45,0x45,0xe2,0x6c,0x6c,0x6c,0xff,0x4f,0x4e,0x4e,0xec,0x50,0x50,0x50,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x4f,0x50,0x0b,0x64,0x64,0x65,0xe8,0x88,0x87,0x88,0xff,0x42,0x40,0x41,0x9e,0x00,0x00,0x00,0x00,0x43,0x71,0x3c,0x47,0x46,0x76,0x3e,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x84,0x56,0x07,0x4d,0x79,0x42,0x14,0x00,0x00,0x00,0x00,0x51,0x50,0x51,0x99,0x53,0x51,0x52,0xff,0x5a,0x5a,0x59,0xfe,0x69,0x69,0x69,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x5a,0x5b,0x6c,0x48,0x47,0x47,0xff,0x4c,0x4c,0x4c,0xff,0x6a,0x6a,0x6a,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x6f,0x34,0xbd,0x3d,0x70,0x33,0xfc,0x39,0x71,0x30,0xf8,0x43,0x74,0x3b,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x7a,0x3d,0x25,0x88,0x99,0x7d,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x6e,0x35,0x58,0x3d,0x73,0x34,0x9d,0x3e,0x77,0x35,0x81,0x5c,0x8a,0x58,0x01,0x42,0x76,0x37,0x47,0x3f,0x73,0x34,0xb1,0x3e,0x74,0x34,0xd6,0x3e,0x72,0x34,0xd4,0x3f,0x71,0x35,0x98,0x45,0x78,0x3c,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x71,0x33,0x40,0x3d,0x70,0x33,0x9c,0x3e,0x76,0x34,0xcb,0x3e,0x77,0x34,0xd1,0x3f,0x74,0x35,0xbb,0x3e,0x73,0x34,0x80,0x44,0x77,0x3b,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x72,0x35,0x32,0x3c,0x6e,0x31,0xa1,0x3c,0x73,0x32,0xdf,0x3b,0x74,0x31,0xe4,0x3e,0x73,0x34,0xda,0x3d,0x6f,0x34,0xa1,0x41,0x75,0x38,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x72,0x34,0x61,0x3d,0x71,0x35,0xff,0x3d,0x72,0x33,0xff,0x3c,0x74,0x33,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x33,0x33,0xbc,0x32,0x33,0x32,0xff,0x34,0x34,0x34,0xf5,0x76,0x6e,0x71,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x4f,0x4f,0x01,0x31,0x32,0x32,0xe3,0x32,0x33,0x33,0xff,0x33,0x34,0x33,0xfa,0x84,0x87,0x87,0x03,0x00,0x00,0x00,0x00,0x4b,0x4a,0x49,0x0d,0x33,0x34,0x34,0xaf,0x34,0x34,0x34,0xa8,0x36,0x36,0x36,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x36,0x37,0x15,0x32,0x34,0x33,0xb4,0x32,0x33,0x32,0xb2,0x33,0x34,0x33,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x31,0x31,0x51,0x31,0x30,0x30,0xb5,0x32,0x32,0x31,0xcf,0x32,0x32,0x31,0xc9,0x34,0x33,0x33,0x94,0x39,0x38,0x37,0x23,0x39,0x38,0x38,0x61,0x33,0x33,0x32,0xff,0x32,0x32,0x31,0xff,0x31,0x30,0x2e,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x36,0x37,0x0b,0x34,0x33,0x33,0x7a,0x32,0x32,0x31,0xcf,0x32,0x33,0x33,0xd8,0x33,0x32,0x33,0xc8,0x34,0x34,0x34,0x6c,0x41,0x41,0x40,0x06,0x37,0x37,0x36,0xc0,0x35,0x35,0x34,0xff,0x36,0x36,0x35,0xf0,0x00,0x00,0x00,0x00,0x33,0x34,0x34,0x4a,0x33,0x33,0x34,0xb0,0x33,0x33,0x34,0xab,0x33,0x34,0x34,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x35,0x36,0x7f,0x36,0x35,0x34,0xb2,0x37,0x36,0x36,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x79,0x4c,0x08,0x37,0x6d,0x31,0xf2,0x38,0x6f,0x31,0xfa,0x3d,0x71,0x37,0x28,0x40,0x70,0x39,0x16,0x40,0x6e,0x3d,0x0f,0x49,0x75,0x3c,0x0a,0x52,0x7d,0x4b,0x15,0x38,0x6e,0x2e,0x9e,0x54,0x70,0x53,0x07,0x49,0x49,0x49,0xf1,0x67,0x67,0x67,0xff,0x46,0x46,0x46,0xc8,0x00,0x00,0x00,0x00,0x6e,0x6f,0x6f,0x02,0x46,0x45,0x46,0x27,0x46,0x45,0x47,0x95,0x7b,0x7a,0x7b,0xff,0x73,0x73,0x73,0xff,0x3a,0x39,0x3a,0x33,0x50,0x7c,0x49,0x07,0x40,0x70,0x39,0x3d,0x56,0x7e,0x50,0x03,0x4b,0x79,0x42,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8f,0x70,0x01,0x48,0x77,0x41,0x1d,0x51,0x7d,0x49,0x04,0x5c,0x5a,0x5a,0x24,0x53,0x52,0x53,0xfb,0x53,0x52,0x53,0xff,0x64,0x63,0x64,0xae,0x63,0x63,0x64,0x30,0x82,0x83,0x82,0x02,0x00,0x00,0x00,0x00,0x5d,0x5b,0x5b,0x3f,0x4b,0x4a,0x4a,0xff,0x46,0x45,0x45,0xff,0x6b,0x6b,0x6a,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x73,0x36,0xc6,0x3d,0x72,0x34,0xfb,0x3d,0x74,0x32,0xfb,0x40,0x74,0x36,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x70,0x35,0x9b,0x3e,0x75,0x35,0xfb,0x3e,0x78,0x34,0xf8,0x46,0x7b,0x3d,0x81,0x40,0x76,0x35,0xf9,0x3f,0x75,0x34,0xfb,0x3f,0x72,0x34,0xfb,0x3e,0x72,0x34,0xfc,0x3d,0x73,0x33,0xfd,0x3c,0x75,0x33,0xf4,0x44,0x7a,0x3b,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x7a,0x40,0x04,0x40,0x77,0x33,0x98,0x3e,0x74,0x32,0xfc,0x3e,0x73,0x33,0xfb,0x3f,0x73,0x34,0xfb,0x3f,0x73,0x35,0xfb,0x3f,0x74,0x35,0xfb,0x3f,0x75,0x34,0xfc,0x3c,0x74,0x32,0xf5,0x41,0x78,0x38,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x76,0x32,0x76,0x3d,0x73,0x30,0xfa,0x3c,0x71,0x30,0xff,0x3c,0x70,0x31,0xff,0x3d,0x70,0x32,0xff,0x3d,0x71,0x33,0xff,0x3e,0x72,0x32,0xff,0x3d,0x74,0x32,0xfb,0x41,0x78,0x36,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x72,0x34,0x61,0x3e,0x70,0x34,0xff,0x3d,0x71,0x33,0xff,0x3e,0x74,0x34,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x32,0x32,0xbd,0x32,0x32,0x32,0xff,0x33,0x33,0x33,0xf5,0x74,0x6e,0x73,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x53,0x53,0x01,0x32,0x32,0x32,0xe3,0x31,0x31,0x31,0xff,0x32,0x32,0x32,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0x4b,0x4c,0x14,0x34,0x34,0x33,0xff,0x34,0x34,0x34,0xff,0x37,0x37,0x37,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x37,0x37,0x1f,0x34,0x34,0x33,0xff,0x32,0x32,0x31,0xff,0x30,0x30,0x2f,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x5c,0x5c,0x01,0x33,0x32,0x32,0x8f,0x31,0x31,0x30,0xff,0x31,0x31,0x30,0xff,0x31,0x31,0x30,0xff,0x32,0x32,0x31,0xff,0x33,0x33,0x33,0xff,0x34,0x34,0x33,0xf3,0x35,0x35,0x34,0xa5,0x31,0x31,0x30,0xff,0x34,0x33,0x32,0xff,0x34,0x33,0x31,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x33,0x32,0x16,0x32,0x32,0x31,0xd3,0x32,0x31,0x31,0xff,0x32,0x32,0x32,0xff,0x32,0x31,0x31,0xff,0x33,0x32,0x32,0xff,0x33,0x33,0x33,0xff,0x34,0x34,0x34,0xba,0x38,0x37,0x37,0xd3,0x34,0x34,0x33,0xff,0x33,0x33,0x31,0xf1,0x00,0x00,0x00,0x00,0x35,0x36,0x37,0x1c,0x32,0x32,0x33,0xfa,0x33,0x34,0x34,0xff,0x37,0x37,0x37,0xaa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x39,0x38,0x0e,0x35,0x35,0x34,0xf5,0x36,0x35,0x35,0xff,0x37,0x36,0x35,0x8b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x6d,0x36,0x13,0x38,0x6d,0x31,0xf7,0x37,0x6f,0x31,0xf7,0x46,0x74,0x41,0x15,0x48,0x72,0x42,0x0a,0x4f,0x75,0x4f,0x05,0x4c,0x74,0x40,0x0b,0x50,0x78,0x48,0x0c,0x3b,0x6e,0x31,0xa6,0x30,0x39,0x31,0x15,0x4b,0x4b,0x4b,0xfd,0x61,0x61,0x61,0xff,0x39,0x38,0x38,0xae,0x00,0x00,0x00,0x00,0x47,0x46,0x46,0x8d,0x59,0x58,0x59,0xfe,0x6c,0x6c,0x6c,0xff,0x80,0x80,0x80,0xff,0x5e,0x5d,0x5e,0xf0,0x67,0x68,0x69,0x04,0x5c,0x84,0x57,0x08,0x5f,0x79,0x5a,0x04,0x60,0x87,0x5c,0x02,0x7b,0x8a,0x73,0x01,0x42,0x76,0x3c,0x08,0x6a,0x8d,0x60,0x02,0x77,0x99,0x74,0x02,0x5b,0x7c,0x55,0x06,0x4b,0x79,0x45,0x04,0x52,0x7a,0x4e,0x07,0x00,0x00,0x00,0x00,0x54,0x53,0x53,0xcf,0x4e,0x4d,0x4e,0xff,0x51,0x50,0x50,0xff,0x57,0x56,0x56,0xff,0x62,0x61,0x61,0x98,0x00,0x00,0x00,0x00,0x65,0x64,0x65,0x23,0x4f,0x4f,0x4f,0xfe,0x42,0x41,0x41,0xff,0x69,0x68,0x67,0xa4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x74,0x35,0x8e,0x3d,0x71,0x33,0xfb,0x3d,0x6f,0x32,0xfd,0x3d,0x70,0x32,0xfa,0x40,0x73,0x34,0xb3,0x40,0x74,0x34,0x5b,0x47,0x79,0x3d,0x1b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x75,0x36,0x9c,0x3e,0x73,0x35,0xfb,0x3d,0x73,0x33,0xfc,0x3f,0x76,0x35,0xfb,0x40,0x73,0x34,0xe9,0x41,0x73,0x36,0x9b,0x42,0x74,0x37,0x95,0x41,0x78,0x36,0xdd,0x3f,0x76,0x35,0xfc,0x3d,0x73,0x34,0xfd,0x3a,0x71,0x32,0xf0,0x46,0x77,0x40,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x70,0x2f,0x7f,0x3d,0x73,0x32,0xfb,0x3d,0x74,0x31,0xfe,0x40,0x77,0x33,0xf3,0x43,0x75,0x37,0xa4,0x48,0x77,0x3e,0x95,0x42,0x79,0x38,0xc4,0x3f,0x76,0x35,0xfb,0x3c,0x72,0x32,0xff,0x3b,0x71,0x31,0xfa,0x40,0x73,0x39,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x71,0x2f,0x54,0x3c,0x70,0x30,0xfe,0x3d,0x72,0x31,0xff,0x3e,0x75,0x31,0xfe,0x40,0x74,0x34,0xbc,0x43,0x73,0x38,0x9b,0x41,0x76,0x37,0xbd,0x3f,0x75,0x33,0xfd,0x3e,0x72,0x33,0xff,0x3c,0x70,0x31,0xff,0x3e,0x70,0x35,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x73,0x34,0x59,0x3f,0x71,0x35,0xff,0x3d,0x71,0x33,0xff,0x3d,0x72,0x33,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x34,0x34,0xbd,0x33,0x33,0x34,0xff,0x32,0x32,0x32,0xf7,0x4a,0x49,0x4a,0x0b,0x32,0x30,0x2e,0x04,0x32,0x30,0x31,0x06,0x35,0x34,0x34,0x06,0x44,0x44,0x44,0x1f,0x36,0x36,0x35,0x90,0x33,0x33,0x33,0xff,0x34,0x33,0x33,0xff,0x36,0x36,0x36,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x47,0x49,0x15,0x33,0x32,0x33,0xff,0x33,0x33,0x33,0xff,0x37,0x37,0x37,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x34,0x33,0x1f,0x32,0x32,0x31,0xff,0x33,0x32,0x32,0xff,0x33,0x33,0x32,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x2f,0x30,0x5c,0x31,0x30,0x30,0xff,0x32,0x31,0x31,0xff,0x34,0x33,0x33,0xfc,0x35,0x35,0x34,0xa8,0x31,0x31,0x31,0x6d,0x37,0x36,0x36,0xa1,0x33,0x33,0x32,0xfa,0x33,0x32,0x31,0xff,0x33,0x32,0x31,0xff,0x35,0x34,0x33,0xff,0x36,0x35,0x34,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x30,0x30,0xb0,0x31,0x30,0x31,0xff,0x32,0x31,0x32,0xff,0x33,0x33,0x33,0xeb,0x35,0x35,0x35,0x88,0x36,0x36,0x36,0x75,0x36,0x36,0x36,0xcd,0x34,0x34,0x33,0xff,0x34,0x33,0x33,0xff,0x34,0x32,0x32,0xff,0x33,0x32,0x31,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x37,0x38,0xaf,0x35,0x35,0x35,0xff,0x36,0x36,0x36,0xf8,0x3d,0x3d,0x3c,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x33,0x33,0x66,0x34,0x33,0x33,0xff,0x37,0x36,0x35,0xfd,0x3e,0x3e,0x3d,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x6e,0x34,0x12,0x39,0x6d,0x32,0xf1,0x37,0x6f,0x31,0xea,0x45,0x78,0x3f,0x06,0x44,0x70,0x3e,0x0f,0x67,0x83,0x65,0x06,0x5a,0x7c,0x4b,0x03,0x3c,0x71,0x37,0x04,0x3c,0x70,0x33,0x87,0x31,0x32,0x31,0x14,0x4b,0x4a,0x4b,0xfd,0x5d,0x5c,0x5c,0xff,0x35,0x34,0x34,0xa0,0x00,0x00,0x00,0x00,0x4a,0x4a,0x4a,0xa0,0x62,0x61,0x62,0xff,0x67,0x67,0x67,0xff,0x6f,0x6e,0x6e,0xff,0x4f,0x4e,0x4f,0xd0,0x00,0x00,0x00,0x00,0x4b,0x7a,0x45,0x10,0x5d,0x8a,0x55,0x04,0x58,0x83,0x55,0x06,0x00,0x00,0x00,0x00,0x49,0x75,0x41,0x07,0x57,0x77,0x4e,0x06,0x00,0x00,0x00,0x00,0x6a,0x8d,0x61,0x04,0x00,0x00,0x00,0x00,0x69,0x8d,0x65,0x03,0x00,0x00,0x00,0x00,0x56,0x54,0x55,0xab,0x48,0x47,0x48,0xff,0x48,0x48,0x48,0xff,0x49,0x48,0x48,0xff,0x62,0x62,0x61,0xa9,0x00,0x00,0x00,0x00,0x64,0x66,0x66,0x1a,0x4d,0x4e,0x4e,0xfd,0x40,0x40,0x3f,0xff,0x6b,0x6a,0x6a,0xb4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x72,0x36,0x18,0x3c,0x6e,0x32,0xda,0x3d,0x70,0x32,0xfc,0x3d,0x71,0x31,0xfd,0x3e,0x72,0x33,0xfb,0x3f,0x74,0x34,0xfb,0x3e,0x74,0x34,0xf8,0x3d,0x72,0x34,0xc6,0x3d,0x70,0x34,0x74,0x44,0x74,0x3c,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x75,0x36,0x9b,0x3d,0x71,0x33,0xfd,0x3c,0x6f,0x31,0xfe,0x3d,0x71,0x32,0xe0,0x47,0x75,0x3a,0x1d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x7f,0x45,0x09,0x3f,0x76,0x36,0xb2,0x3d,0x71,0x35,0xfd,0x3b,0x70,0x34,0xfd,0x3e,0x75,0x37,0x91,0x00,0x00,0x00,0x00,0x46,0x78,0x37,0x18,0x3c,0x71,0x32,0xf1,0x3b,0x6e,0x30,0xfe,0x3b,0x71,0x30,0xef,0x42,0x7a,0x37,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x8f,0x5e,0x01,0x3f,0x76,0x35,0x7a,0x3c,0x71,0x32,0xff,0x3c,0x71,0x33,0xff,0x3f,0x76,0x35,0xc5,0x00,0x00,0x00,0x00,0x50,0x7b,0x47,0x06,0x3b,0x70,0x31,0xde,0x3c,0x6e,0x31,0xff,0x3b,0x6f,0x2f,0xfd,0x41,0x77,0x33,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x77,0x38,0x5b,0x3c,0x71,0x32,0xfe,0x3d,0x70,0x33,0xff,0x3c,0x72,0x32,0xec,0x4c,0x7f,0x44,0x0a,0x00,0x00,0x00,0x00,0x3e,0x73,0x34,0x5d,0x3e,0x70,0x34,0xff,0x3d,0x70,0x33,0xff,0x3c,0x71,0x32,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x35,0x35,0xbd,0x34,0x34,0x34,0xff,0x35,0x35,0x35,0xff,0x35,0x35,0x35,0xf5,0x34,0x34,0x33,0xf1,0x33,0x33,0x33,0xf4,0x34,0x34,0x34,0xf4,0x34,0x34,0x34,0xff,0x34,0x34,0x33,0xff,0x33,0x32,0x33,0xff,0x3b,0x39,0x3a,0x89,0x4f,0x4f,0x50,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x46,0x46,0x16,0x33,0x32,0x33,0xff,0x33,0x33,0x33,0xff,0x36,0x36,0x36,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x36,0x36,0x1e,0x33,0x32,0x33,0xff,0x33,0x32,0x32,0xff,0x33,0x32,0x32,0x91,0x00,0x00,0x00,0x00,0x40,0x3e,0x40,0x01,0x32,0x31,0x32,0xd8,0x31,0x30,0x31,0xff,0x32,0x32,0x32,0xfd,0x39,0x38,0x38,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x37,0x36,0x41,0x33,0x32,0x32,0xf9,0x32,0x31,0x31,0xff,0x33,0x32,0x32,0xff,0x33,0x33,0x31,0x54,0x00,0x00,0x00,0x00,0x35,0x35,0x35,0x2d,0x34,0x33,0x34,0xfe,0x32,0x31,0x32,0xff,0x32,0x32,0x32,0xe1,0x3b,0x3a,0x3a,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x48,0x49,0x03,0x35,0x34,0x34,0xa4,0x33,0x32,0x31,0xff,0x34,0x32,0x32,0xff,0x37,0x35,0x35,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x3b,0x3b,0x4a,0x36,0x35,0x36,0xff,0x34,0x34,0x34,0xff,0x35,0x34,0x34,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x32,0x31,0xc1,0x34,0x33,0x33,0xff,0x38,0x37,0x36,0xb8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x6e,0x35,0x11,0x39,0x6d,0x32,0xf0,0x37,0x6f,0x30,0xeb,0x47,0x79,0x3d,0x06,0x4c,0x72,0x43,0x0d,0x72,0x8f,0x6c,0x05,0x49,0x69,0x40,0x01,0x47,0x76,0x3e,0x02,0x3e,0x71,0x36,0x72,0x36,0x3a,0x37,0x11,0x4b,0x4b,0x4b,0xfb,0x5b,0x59,0x5a,0xff,0x3b,0x3a,0x3a,0xa1,0x00,0x00,0x00,0x00,0x4a,0x4a,0x4a,0xa2,0x5b,0x5b,0x5b,0xff,0x5e,0x5d,0x5e,0xff,0x65,0x64,0x64,0xff,0x4d,0x4c,0x4d,0xd0,0x00,0x00,0x00,0x00,0x55,0x81,0x4e,0x0b,0x51,0x78,0x4c,0x03,0x64,0x8a,0x64,0x02,0x61,0xa3,0x5a,0x01,0x5a,0x7e,0x57,0x01,0x75,0x94,0x6f,0x02,0x00,0x00,0x00,0x00,0x60,0x7f,0x59,0x03,0x4e,0x76,0x42,0x02,0x51,0x7a,0x49,0x0a,0x00,0x00,0x00,0x00,0x5d,0x5d,0x5e,0xab,0x43,0x43,0x42,0xff,0x44,0x43,0x43,0xff,0x44,0x43,0x43,0xff,0x60,0x60,0x5f,0xa7,0x00,0x00,0x00,0x00,0x6d,0x6d,0x6c,0x1d,0x51,0x51,0x51,0xfd,0x3e,0x3e,0x3e,0xff,0x6b,0x69,0x69,0xb1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x74,0x3b,0x11,0x40,0x75,0x34,0x81,0x3f,0x74,0x34,0xdd,0x3d,0x71,0x32,0xfd,0x3d,0x72,0x32,0xfd,0x3e,0x72,0x33,0xfc,0x3e,0x72,0x34,0xfb,0x3d,0x70,0x34,0xfc,0x3d,0x73,0x34,0xe6,0x41,0x77,0x38,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x70,0x35,0x9a,0x3d,0x6f,0x34,0xfd,0x3b,0x70,0x31,0xfe,0x3f,0x72,0x35,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x72,0x39,0x1f,0x3c,0x72,0x35,0xf8,0x3c,0x72,0x34,0xff,0x3e,0x75,0x36,0xe1,0x8c,0xa6,0x89,0x01,0x3f,0x76,0x36,0x60,0x3e,0x74,0x33,0xfc,0x3b,0x70,0x30,0xff,0x3d,0x70,0x32,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x7f,0x4d,0x04,0x3c,0x72,0x34,0xe3,0x3d,0x72,0x33,0xff,0x3c,0x73,0x33,0xfc,0x52,0x7e,0x4b,0x16,0x41,0x73,0x37,0x41,0x3c,0x70,0x32,0xff,0x3c,0x71,0x31,0xff,0x3c,0x6f,0x31,0xaf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x71,0x33,0xb3,0x3d,0x72,0x32,0xff,0x3e,0x73,0x33,0xff,0x43,0x78,0x37,0x4c,0x00,0x00,0x00,0x00,0x3d,0x71,0x32,0x57,0x3d,0x6f,0x34,0xff,0x3d,0x70,0x33,0xff,0x3c,0x72,0x32,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x34,0x35,0xbc,0x34,0x34,0x34,0xff,0x35,0x35,0x35,0xff,0x34,0x34,0x34,0xff,0x32,0x32,0x32,0xff,0x33,0x32,0x33,0xff,0x35,0x34,0x35,0xff,0x35,0x34,0x35,0xff,0x34,0x33,0x34,0xff,0x34,0x33,0x34,0xff,0x36,0x35,0x36,0xd8,0x36,0x36,0x36,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x45,0x47,0x17,0x32,0x32,0x32,0xff,0x33,0x33,0x33,0xff,0x37,0x37,0x37,0x9a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x36,0x36,0x20,0x33,0x32,0x33,0xff,0x32,0x32,0x33,0xff,0x33,0x32,0x32,0x90,0x00,0x00,0x00,0x00,0x35,0x35,0x35,0x1f,0x33,0x33,0x34,0xff,0x32,0x32,0x32,0xff,0x34,0x33,0x33,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x34,0x34,0x9d,0x32,0x32,0x32,0xff,0x33,0x31,0x33,0xff,0x32,0x30,0x2f,0x53,0x00,0x00,0x00,0x00,0x32,0x32,0x33,0x75,0x32,0x32,0x33,0xff,0x32,0x32,0x33,0xff,0x35,0x35,0x36,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x3b,0x3c,0x13,0x34,0x33,0x33,0xfa,0x35,0x34,0x35,0xff,0x38,0x36,0x37,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x44,0x03,0x33,0x33,0x34,0xdb,0x32,0x32,0x33,0xff,0x32,0x33,0x33,0xcf,0x4d,0x4d,0x50,0x01,0x00,0x00,0x00,0x00,0x31,0x32,0x31,0x25,0x32,0x31,0x31,0xfc,0x34,0x33,0x33,0xff,0x37,0x36,0x36,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x6f,0x3c,0x14,0x3a,0x6d,0x32,0xf5,0x37,0x70,0x30,0xf6,0x45,0x75,0x3c,0x15,0x46,0x70,0x40,0x0c,0x52,0x77,0x4c,0x05,0x5a,0x7d,0x52,0x04,0x6b,0x87,0x62,0x03,0x3d,0x71,0x35,0x65,0x3a,0x3f,0x3a,0x13,0x47,0x47,0x48,0xfc,0x56,0x55,0x55,0xff,0x3f,0x3e,0x3e,0xb4,0x00,0x00,0x00,0x00,0x42,0x42,0x41,0x89,0x49,0x48,0x48,0xfe,0x53,0x53,0x52,0xff,0x5e,0x5e,0x5e,0xff,0x52,0x53,0x53,0xf2,0x60,0x5f,0x60,0x05,0x6d,0x8c,0x5d,0x02,0x62,0x8c,0x55,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x9a,0x7e,0x02,0x7e,0x9f,0x75,0x05,0x88,0x9e,0x84,0x01,0x73,0x86,0x70,0x01,0x47,0x74,0x3f,0x0d,0x55,0x81,0x4e,0x02,0x00,0x00,0x00,0x00,0x64,0x65,0x64,0xd3,0x42,0x42,0x41,0xff,0x4b,0x4a,0x49,0xff,0x55,0x55,0x55,0xfc,0x63,0x63,0x62,0x85,0x00,0x00,0x00,0x00,0x6c,0x6c,0x6c,0x29,0x50,0x50,0x50,0xfe,0x3d,0x3d,0x3d,0xff,0x6c,0x6b,0x6b,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x7c,0x4a,0x01,0x44,0x74,0x3a,0x2d,0x3f,0x72,0x35,0x76,0x3d,0x72,0x33,0xc5,0x3d,0x73,0x33,0xfb,0x3d,0x72,0x33,0xfd,0x3d,0x72,0x33,0xfc,0x3e,0x74,0x34,0xe4,0x4f,0x76,0x49,0x09,0x00,0x00,0x00,0x00,0x3f,0x6e,0x34,0x9a,0x3d,0x6f,0x34,0xfd,0x3b,0x74,0x33,0xfd,0x47,0x7a,0x40,0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xa0,0x83,0x01,0x3f,0x77,0x36,0xd8,0x3d,0x73,0x34,0xff,0x3c,0x73,0x33,0xf0,0x40,0x74,0x36,0x04,0x3c,0x70,0x34,0x78,0x3d,0x72,0x33,0xfc,0x3c,0x74,0x31,0xfe,0x40,0x78,0x36,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x75,0x38,0xa7,0x3c,0x71,0x32,0xff,0x3c,0x6f,0x32,0xff,0x41,0x73,0x37,0x35,0x3c,0x71,0x33,0x65,0x3c,0x70,0x32,0xff,0x3c,0x72,0x31,0xff,0x3f,0x76,0x35,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x77,0x37,0x71,0x3d,0x72,0x33,0xff,0x3e,0x71,0x33,0xff,0x41,0x72,0x35,0x71,0x00,0x00,0x00,0x00,0x3d,0x72,0x33,0x5a,0x3d,0x70,0x34,0xff,0x3c,0x71,0x33,0xff,0x3b,0x72,0x31,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x34,0x34,0xbd,0x33,0x34,0x34,0xff,0x35,0x35,0x35,0xf7,0x41,0x40,0x3e,0x2a,0x39,0x38,0x38,0x24,0x3c,0x3a,0x3a,0x24,0x42,0x3f,0x3f,0x22,0x3c,0x39,0x39,0x22,0x38,0x37,0x38,0x52,0x35,0x35,0x35,0xdb,0x33,0x32,0x33,0xff,0x31,0x31,0x31,0xf5,0x30,0x30,0x2f,0x26,0x00,0x00,0x00,0x00,0x46,0x45,0x46,0x19,0x33,0x32,0x32,0xff,0x33,0x33,0x33,0xff,0x35,0x36,0x35,0x9a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x36,0x35,0x21,0x33,0x32,0x32,0xff,0x32,0x32,0x33,0xff,0x33,0x32,0x33,0x90,0x00,0x00,0x00,0x00,0x33,0x33,0x34,0x3a,0x32,0x32,0x32,0xff,0x32,0x32,0x32,0xff,0x37,0x37,0x38,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x34,0x34,0x64,0x33,0x33,0x33,0xff,0x34,0x34,0x34,0xff,0x35,0x33,0x33,0x53,0x00,0x00,0x00,0x00,0x30,0x30,0x31,0x9b,0x30,0x30,0x31,0xff,0x32,0x32,0x32,0xff,0x3c,0x3b,0x3b,0x2c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x37,0x37,0xca,0x35,0x34,0x35,0xff,0x37,0x36,0x36,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x32,0x34,0x74,0x32,0x32,0x33,0xff,0x33,0x33,0x33,0xff,0x3a,0x3a,0x3a,0x31,0x00,0x00,0x00,0x00,0x34,0x34,0x34,0x82,0x32,0x32,0x32,0xff,0x34,0x33,0x33,0xe0,0x45,0x42,0x42,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x7e,0x4c,0x08,0x39,0x6e,0x31,0xee,0x37,0x6f,0x30,0xf9,0x3f,0x71,0x35,0x29,0x3f,0x70,0x3a,0x12,0x3d,0x6b,0x3a,0x09,0x47,0x75,0x3c,0x0b,0x5e,0x80,0x59,0x05,0x3c,0x70,0x32,0x84,0x48,0x5c,0x46,0x09,0x42,0x42,0x42,0xf5,0x4f,0x4f,0x4e,0xff,0x41,0x41,0x40,0xd1,0x00,0x00,0x00,0x00,0x76,0x75,0x76,0x01,0x3d,0x3d,0x3b,0x22,0x3e,0x3f,0x3e,0x9a,0x54,0x55,0x54,0xff,0x57,0x57,0x57,0xff,0x4d,0x4d,0x4d,0x41,0x00,0x00,0x00,0x00,0x6e,0x89,0x67,0x03,0x72,0x81,0x69,0x01,0x6f,0x8a,0x6d,0x02,0xbf,0xbd,0xbf,0x25,0xaa,0xb5,0xac,0x34,0x65,0x8e,0x5d,0x05,0x6f,0x96,0x6f,0x02,0x5f,0x82,0x56,0x05,0x00,0x00,0x00,0x00,0x81,0x81,0x81,0x26,0x5c,0x5c,0x5b,0xfb,0x44,0x44,0x43,0xff,0x69,0x69,0x69,0x90,0x65,0x64,0x64,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6c,0x6d,0x6c,0x48,0x48,0x47,0x48,0xff,0x42,0x41,0x41,0xff,0x6f,0x6e,0x6e,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x7b,0x3c,0x42,0x3e,0x75,0x34,0xea,0x3e,0x71,0x34,0xfc,0x3c,0x70,0x33,0xfb,0x3f,0x71,0x36,0x41,0x00,0x00,0x00,0x00,0x3f,0x71,0x36,0x9a,0x3e,0x73,0x34,0xfc,0x3d,0x76,0x34,0xfd,0x45,0x7b,0x3d,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x9c,0x74,0x01,0x40,0x76,0x36,0xdb,0x3d,0x73,0x33,0xff,0x3d,0x76,0x33,0xee,0x43,0x7a,0x3d,0x03,0x3b,0x6f,0x32,0x72,0x3c,0x70,0x32,0xfc,0x3c,0x72,0x32,0xfe,0x41,0x79,0x38,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x76,0x37,0xa9,0x3d,0x72,0x31,0xff,0x3e,0x74,0x32,0xff,0x42,0x79,0x37,0x30,0x3b,0x71,0x33,0x62,0x3c,0x70,0x32,0xff,0x3c,0x71,0x32,0xff,0x3f,0x77,0x36,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x76,0x36,0x73,0x3e,0x72,0x32,0xff,0x3e,0x71,0x32,0xff,0x3f,0x73,0x34,0x6c,0x00,0x00,0x00,0x00,0x3d,0x73,0x33,0x62,0x3c,0x70,0x33,0xff,0x3c,0x70,0x33,0xff,0x3c,0x72,0x33,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x33,0x32,0xbd,0x31,0x32,0x32,0xff,0x33,0x33,0x33,0xf5,0x77,0x76,0x78,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x36,0x37,0x3a,0x32,0x31,0x32,0xff,0x34,0x33,0x34,0xff,0x36,0x36,0x35,0x97,0x00,0x00,0x00,0x00,0x46,0x46,0x46,0x1a,0x33,0x33,0x32,0xff,0x32,0x32,0x32,0xff,0x36,0x35,0x35,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x34,0x33,0x25,0x32,0x32,0x32,0xff,0x32,0x32,0x32,0xff,0x34,0x33,0x33,0x90,0x00,0x00,0x00,0x00,0x31,0x33,0x32,0x38,0x30,0x30,0x31,0xff,0x32,0x32,0x32,0xff,0x37,0x38,0x37,0x8c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x33,0x34,0x64,0x32,0x32,0x33,0xff,0x34,0x33,0x34,0xff,0x34,0x33,0x32,0x52,0x00,0x00,0x00,0x00,0x31,0x31,0x32,0x96,0x31,0x32,0x32,0xff,0x32,0x32,0x32,0xff,0x39,0x39,0x39,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x35,0x35,0xc9,0x34,0x33,0x33,0xff,0x35,0x34,0x33,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x3a,0x3c,0x14,0x33,0x33,0x33,0xf4,0x34,0x35,0x34,0xff,0x37,0x37,0x37,0x99,0x47,0x47,0x47,0x04,0x35,0x34,0x35,0xe2,0x34,0x33,0x34,0xff,0x36,0x35,0x35,0x7a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x6e,0x31,0xd6,0x39,0x6d,0x30,0xfb,0x3c,0x6e,0x35,0x55,0x41,0x70,0x3c,0x13,0x41,0x6e,0x39,0x1b,0x4c,0x74,0x48,0x06,0x74,0x91,0x71,0x04,0x44,0x77,0x3c,0x32,0x57,0x8b,0x4c,0x02,0x3d,0x3d,0x3d,0xdc,0x46,0x46,0x46,0xff,0x3c,0x3c,0x3b,0xf5,0x43,0x42,0x42,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x48,0x47,0x12,0x45,0x46,0x46,0xed,0x51,0x51,0x51,0xff,0x4c,0x4c,0x4c,0xc0,0x5e,0x61,0x5e,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6a,0x97,0x6a,0x02,0xca,0xd2,0xcd,0x81,0xc7,0xd1,0xca,0x71,0x70,0x99,0x70,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8b,0x8b,0x8a,0x9e,0x42,0x42,0x42,0xff,0x53,0x53,0x53,0xed,0x6e,0x6b,0x6f,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6f,0x6f,0x6f,0x75,0x39,0x39,0x39,0xff,0x4a,0x49,0x49,0xff,0x6e,0x6d,0x6d,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x6f,0x36,0x28,0x42,0x70,0x38,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x6f,0x32,0xa5,0x3d,0x6f,0x34,0xfc,0x3e,0x72,0x34,0xfa,0x43,0x76,0x39,0x46,0x00,0x00,0x00,0x00,0x41,0x78,0x38,0x9a,0x3f,0x76,0x35,0xfc,0x3d,0x74,0x33,0xfd,0x40,0x75,0x35,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x75,0x39,0x2a,0x3e,0x71,0x34,0xfb,0x3d,0x71,0x32,0xff,0x3f,0x77,0x34,0xd4,0x00,0x00,0x00,0x00,0x3d,0x76,0x33,0x55,0x3e,0x75,0x33,0xfb,0x3d,0x73,0x32,0xff,0x40,0x75,0x34,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x78,0x3d,0x08,0x3c,0x70,0x31,0xe8,0x3d,0x71,0x31,0xff,0x3f,0x76,0x31,0xf8,0x55,0x84,0x4a,0x0e,0x40,0x76,0x36,0x39,0x3c,0x71,0x32,0xff,0x3d,0x72,0x32,0xff,0x3e,0x73,0x33,0xbf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x71,0x32,0xc0,0x3e,0x71,0x32,0xff,0x40,0x74,0x32,0xff,0x45,0x7a,0x39,0x3b,0x00,0x00,0x00,0x00,0x3d,0x73,0x32,0x61,0x3c,0x71,0x33,0xff,0x3c,0x71,0x32,0xff,0x3c,0x73,0x33,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x32,0x32,0xbe,0x32,0x32,0x32,0xff,0x34,0x33,0x34,0xf5,0x78,0x75,0x77,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x38,0x37,0x1f,0x33,0x33,0x33,0xff,0x34,0x35,0x34,0xff,0x39,0x38,0x38,0xb8,0x00,0x00,0x00,0x00,0x41,0x40,0x41,0x12,0x32,0x32,0x31,0xff,0x32,0x32,0x32,0xff,0x35,0x34,0x34,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x33,0x33,0x64,0x33,0x33,0x32,0xff,0x32,0x32,0x32,0xff,0x31,0x31,0x30,0x90,0x00,0x00,0x00,0x00,0x39,0x3a,0x3b,0x16,0x33,0x33,0x33,0xfd,0x31,0x32,0x32,0xff,0x33,0x33,0x33,0xcd,0x45,0x40,0x3e,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x32,0x32,0xa8,0x32,0x32,0x31,0xff,0x32,0x32,0x31,0xff,0x31,0x31,0x30,0x51,0x00,0x00,0x00,0x00,0x36,0x37,0x36,0x66,0x33,0x34,0x33,0xff,0x32,0x32,0x32,0xff,0x33,0x33,0x33,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x3f,0x3d,0x19,0x36,0x35,0x35,0xfb,0x34,0x33,0x33,0xff,0x35,0x34,0x33,0xf1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x38,0x39,0x9c,0x34,0x35,0x35,0xff,0x35,0x35,0x35,0xee,0x37,0x37,0x37,0x4f,0x35,0x34,0x34,0xff,0x36,0x35,0x35,0xf8,0x3f,0x3f,0x3f,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x6b,0x31,0xa3,0x38,0x6c,0x30,0xfa,0x38,0x6b,0x32,0x8a,0x50,0x78,0x4f,0x05,0x42,0x72,0x3b,0x1d,0x44,0x7f,0x44,0x01,0x73,0x8c,0x69,0x04,0x66,0x86,0x5d,0x02,0x00,0x00,0x00,0x00,0x35,0x35,0x36,0xa3,0x3f,0x3f,0x3e,0xff,0x3d,0x3c,0x3c,0xff,0x39,0x39,0x39,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x3c,0x3d,0xa9,0x49,0x49,0x49,0xff,0x4e,0x4d,0x4e,0xff,0x56,0x56,0x56,0x85,0x00,0x00,0x00,0x00,0x4d,0x79,0x48,0x07,0x44,0x71,0x3d,0x27,0xaa,0xba,0xad,0x76,0xa3,0xaf,0xa5,0x67,0x3e,0x6d,0x35,0x43,0x47,0x72,0x3d,0x0d,0x00,0x00,0x00,0x00,0xa1,0xa1,0xa1,0x5a,0x70,0x70,0x70,0xfd,0x3d,0x3c,0x3c,0xff,0x66,0x66,0x67,0xc1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x64,0x65,0xaf,0x31,0x31,0x31,0xff,0x55,0x53,0x54,0xfe,0x6d,0x6c,0x6c,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0x94,0x64,0x01,0x3d,0x70,0x34,0xbb,0x3c,0x70,0x33,0xf4,0x3f,0x76,0x36,0x96,0x46,0x7c,0x3c,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x76,0x37,0x24,0x3d,0x6f,0x32,0xe1,0x3e,0x70,0x32,0xfd,0x3f,0x76,0x34,0xec,0x48,0x7c,0x3e,0x18,0x00,0x00,0x00,0x00,0x40,0x7a,0x37,0x99,0x3e,0x75,0x35,0xfb,0x3d,0x72,0x33,0xfc,0x3d,0x71,0x32,0xf4,0x42,0x76,0x37,0x52,0x85,0xa4,0x81,0x01,0x00,0x00,0x00,0x00,0x4b,0x7d,0x3e,0x1d,0x40,0x74,0x33,0xcd,0x3e,0x70,0x33,0xfc,0x3d,0x70,0x32,0xfd,0x40,0x73,0x35,0x7c,0x00,0x00,0x00,0x00,0x4e,0x7f,0x41,0x11,0x3f,0x77,0x32,0xe7,0x3e,0x71,0x33,0xfd,0x3d,0x71,0x32,0xf7,0x41,0x77,0x36,0x59,0x78,0x99,0x77,0x01,0x00,0x00,0x00,0x00,0x52,0x84,0x46,0x0a,0x40,0x75,0x32,0x95,0x3d,0x6e,0x30,0xff,0x3d,0x6f,0x30,0xff,0x40,0x74,0x32,0xa8,0x00,0x00,0x00,0x00,0x72,0x98,0x69,0x01,0x3e,0x75,0x32,0xd0,0x3d,0x71,0x31,0xff,0x3b,0x6f,0x31,0xff,0x3e,0x74,0x33,0x83,0x57,0x87,0x4f,0x05,0x00,0x00,0x00,0x00,0x55,0x86,0x49,0x04,0x43,0x76,0x34,0x80,0x3e,0x6f,0x31,0xff,0x3e,0x6f,0x31,0xff,0x3f,0x72,0x31,0xd8,0x52,0x82,0x45,0x03,0x00,0x00,0x00,0x00,0x3f,0x74,0x34,0x61,0x3c,0x71,0x33,0xff,0x3c,0x70,0x31,0xff,0x3c,0x72,0x32,0x6c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x35,0x35,0xbf,0x34,0x34,0x34,0xff,0x35,0x34,0x34,0xf5,0x79,0x79,0x79,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4a,0x47,0x09,0x36,0x36,0x35,0x9e,0x33,0x33,0x32,0xff,0x33,0x33,0x32,0xff,0x35,0x34,0x33,0x9a,0x00,0x00,0x00,0x00,0x3e,0x3e,0x3e,0x03,0x30,0x30,0x30,0xe7,0x32,0x32,0x32,0xff,0x34,0x34,0x34,0xfb,0x37,0x36,0x35,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x36,0x35,0x38,0x32,0x31,0x30,0xe8,0x32,0x32,0x31,0xff,0x33,0x33,0x32,0xff,0x34,0x34,0x32,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x34,0x34,0xbf,0x31,0x31,0x31,0xff,0x30,0x31,0x31,0xff,0x35,0x34,0x34,0x7b,0x42,0x42,0x42,0x02,0x00,0x00,0x00,0x00,0x5d,0x5b,0x5b,0x01,0x33,0x31,0x30,0x62,0x32,0x31,0x30,0xfe,0x33,0x33,0x32,0xff,0x34,0x34,0x33,0xff,0x35,0x34,0x32,0x52,0x00,0x00,0x00,0x00,0x38,0x39,0x38,0x19,0x31,0x31,0x31,0xf6,0x30,0x31,0x31,0xff,0x32,0x32,0x31,0xf6,0x38,0x37,0x37,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x39,0x39,0x0e,0x34,0x33,0x33,0xb4,0x34,0x33,0x33,0xff,0x35,0x35,0x34,0xff,0x37,0x37,0x35,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x3b,0x3c,0x2b,0x34,0x34,0x34,0xfd,0x33,0x33,0x33,0xff,0x35,0x34,0x35,0xf2,0x33,0x33,0x33,0xff,0x38,0x37,0x37,0xa7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x6b,0x32,0x59,0x39,0x6a,0x31,0xf5,0x3a,0x6b,0x32,0xb2,0x84,0x97,0x82,0x01,0x54,0x77,0x4b,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x34,0x35,0x5b,0x3a,0x39,0x3a,0xff,0x3d,0x3c,0x3c,0xff,0x3d,0x3c,0x3c,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x40,0x41,0x17,0x41,0x40,0x41,0xf1,0x45,0x45,0x45,0xff,0x46,0x46,0x46,0xff,0x4f,0x4e,0x4e,0xff,0x5e,0x5e,0x5f,0xa2,0x68,0x75,0x68,0x25,0x6a,0x83,0x67,0x71,0x85,0x94,0x83,0x60,0x7f,0x91,0x7c,0x44,0x4e,0x74,0x46,0x62,0x6c,0x84,0x6a,0x12,0xa3,0xa2,0xa3,0x73,0x7c,0x7b,0x7b,0xfb,0x3b,0x3b,0x3b,0xff,0x3c,0x3b,0x3c,0xff,0x58,0x58,0x58,0xfc,0x75,0x74,0x74,0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x79,0x79,0x0d,0x59,0x59,0x5a,0xf2,0x2f,0x2f,0x2f,0xff,0x61,0x5f,0x60,0xea,0x80,0x7f,0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x6e,0x36,0x2f,0x3d,0x70,0x34,0xfb,0x3f,0x74,0x35,0xfb,0x3f,0x75,0x34,0xfc,0x3f,0x77,0x34,0xfa,0x3e,0x74,0x34,0xde,0x3e,0x70,0x33,0xb1,0x3f,0x72,0x35,0xc4,0x40,0x75,0x34,0xf6,0x3f,0x73,0x33,0xfb,0x3d,0x71,0x32,0xfc,0x42,0x73,0x35,0xa1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x75,0x36,0x99,0x3e,0x73,0x34,0xfb,0x3d,0x72,0x33,0xfc,0x3f,0x73,0x34,0xfa,0x40,0x76,0x34,0xf8,0x41,0x77,0x36,0xcf,0x40,0x73,0x35,0xbb,0x3f,0x75,0x34,0xf1,0x40,0x75,0x33,0xfa,0x40,0x74,0x34,0xfb,0x41,0x71,0x32,0xdd,0x42,0x71,0x37,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x73,0x33,0x5f,0x3e,0x72,0x33,0xfa,0x3f,0x74,0x33,0xfc,0x40,0x77,0x34,0xfa,0x40,0x76,0x35,0xc7,0x3f,0x72,0x34,0xa3,0x40,0x74,0x35,0xde,0x41,0x75,0x32,0xee,0x40,0x72,0x31,0xff,0x40,0x6f,0x30,0xed,0x43,0x70,0x33,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x71,0x33,0x3a,0x3c,0x6f,0x31,0xf7,0x3e,0x71,0x32,0xff,0x3f,0x74,0x32,0xff,0x40,0x76,0x35,0xe5,0x40,0x71,0x35,0xc5,0x3f,0x72,0x33,0xe7,0x3f,0x73,0x31,0xff,0x40,0x72,0x32,0xff,0x3f,0x71,0x31,0xfb,0x41,0x70,0x32,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x75,0x35,0x62,0x3e,0x73,0x34,0xff,0x3c,0x71,0x32,0xff,0x3d,0x72,0x33,0x6d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x36,0x35,0xbf,0x34,0x34,0x34,0xff,0x35,0x35,0x35,0xfe,0x36,0x36,0x36,0xcf,0x32,0x30,0x31,0xca,0x31,0x30,0x30,0xca,0x32,0x32,0x31,0xca,0x35,0x35,0x35,0xcc,0x37,0x37,0x36,0xef,0x35,0x35,0x34,0xff,0x35,0x35,0x34,0xff,0x34,0x33,0x33,0xfc,0x35,0x35,0x33,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x33,0x32,0x94,0x32,0x31,0x32,0xff,0x32,0x32,0x32,0xff,0x34,0x33,0x33,0xfd,0x33,0x33,0x32,0xd1,0x35,0x34,0x34,0xcc,0x35,0x35,0x35,0xfc,0x35,0x34,0x34,0xf6,0x33,0x32,0x31,0xfe,0x34,0x33,0x32,0xff,0x36,0x35,0x34,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x31,0x32,0x3a,0x31,0x30,0x30,0xfa,0x32,0x31,0x32,0xff,0x33,0x33,0x33,0xff,0x33,0x33,0x33,0xd2,0x35,0x34,0x35,0xa5,0x36,0x35,0x35,0xce,0x33,0x32,0x32,0xfe,0x32,0x32,0x31,0xf4,0x32,0x32,0x31,0xff,0x34,0x34,0x33,0xff,0x35,0x35,0x33,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x30,0x30,0x7d,0x31,0x31,0x31,0xff,0x32,0x32,0x32,0xff,0x34,0x33,0x34,0xfb,0x34,0x33,0x34,0xc1,0x37,0x36,0x37,0xaa,0x35,0x34,0x34,0xe7,0x33,0x33,0x32,0xff,0x33,0x33,0x32,0xf5,0x34,0x33,0x32,0xff,0x38,0x37,0x36,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x32,0x33,0xba,0x32,0x31,0x32,0xff,0x32,0x32,0x32,0xff,0x32,0x31,0x31,0xff,0x36,0x35,0x34,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x71,0x38,0x18,0x3a,0x6d,0x32,0xe2,0x3b,0x6f,0x33,0xda,0x43,0x76,0x3a,0x17,0x56,0x85,0x56,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x41,0x41,0x11,0x39,0x39,0x39,0xf7,0x3c,0x3b,0x3b,0xff,0x3e,0x3e,0x3e,0xeb,0x4d,0x4d,0x4d,0x0a,0x00,0x00,0x00,0x00,0x41,0x40,0x42,0x82,0x42,0x41,0x42,0xff,0x42,0x41,0x42,0xff,0x41,0x41,0x42,0xff,0x41,0x40,0x41,0xff,0x45,0x45,0x46,0xff,0x5a,0x5a,0x5b,0xf5,0x7b,0x7c,0x7c,0xc0,0x8d,0x8d,0x8d,0x9a,0x95,0x95,0x94,0x9b,0x98,0x98,0x99,0xac,0x8b,0x8b,0x8c,0xe4,0x63,0x62,0x63,0xff,0x36,0x36,0x36,0xff,0x38,0x37,0x38,0xff,0x39,0x39,0x3a,0xff,0x41,0x41,0x41,0xff,0x72,0x72,0x73,0x9a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x83,0x83,0x63,0x43,0x43,0x43,0xff,0x38,0x38,0x38,0xff,0x6b,0x68,0x69,0x9d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0x88,0x65,0x01,0x45,0x77,0x3b,0x59,0x41,0x77,0x37,0xd4,0x3e,0x72,0x33,0xfd,0x3d,0x6f,0x32,0xfe,0x3d,0x6f,0x32,0xfe,0x3d,0x70,0x32,0xfd,0x3f,0x74,0x34,0xfc,0x40,0x75,0x33,0xfb,0x3f,0x75,0x33,0xfc,0x3f,0x72,0x31,0xaf,0x3f,0x74,0x36,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x6f,0x33,0x9a,0x3d,0x70,0x33,0xfc,0x3b,0x73,0x31,0xfc,0x43,0x79,0x38,0x6d,0x40,0x78,0x34,0xe5,0x3f,0x75,0x34,0xfb,0x3f,0x72,0x34,0xfb,0x3f,0x72,0x34,0xfb,0x40,0x74,0x33,0xfb,0x42,0x77,0x33,0xdd,0x45,0x7b,0x38,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x79,0x37,0x63,0x41,0x77,0x35,0xeb,0x3f,0x75,0x34,0xfb,0x3f,0x74,0x34,0xfb,0x3e,0x73,0x34,0xfa,0x40,0x72,0x34,0xf8,0x40,0x72,0x33,0xf7,0x42,0x75,0x32,0xda,0x44,0x79,0x36,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x77,0x37,0x43,0x41,0x76,0x34,0xe6,0x3e,0x73,0x32,0xff,0x3e,0x71,0x33,0xff,0x3d,0x70,0x33,0xff,0x3e,0x70,0x32,0xff,0x3e,0x70,0x31,0xff,0x40,0x74,0x32,0xe9,0x45,0x79,0x36,0x4e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x72,0x31,0x62,0x3e,0x71,0x33,0xff,0x3e,0x74,0x33,0xff,0x41,0x77,0x38,0x6d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x30,0x30,0xbf,0x32,0x32,0x31,0xff,0x33,0x33,0x33,0xff,0x34,0x34,0x34,0xff,0x34,0x33,0x34,0xff,0x33,0x32,0x33,0xff,0x33,0x33,0x32,0xff,0x33,0x33,0x32,0xff,0x34,0x33,0x33,0xff,0x34,0x34,0x33,0xff,0x37,0x37,0x36,0xdd,0x3a,0x3a,0x39,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x32,0x31,0x11,0x31,0x30,0x30,0xd2,0x32,0x31,0x31,0xff,0x32,0x31,0x31,0xff,0x31,0x31,0x31,0xff,0x33,0x33,0x33,0xff,0x37,0x37,0x37,0xee,0x39,0x39,0x38,0x43,0x35,0x34,0x34,0xf6,0x34,0x33,0x32,0xff,0x33,0x32,0x31,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x37,0x36,0x5a,0x33,0x33,0x33,0xf3,0x31,0x31,0x31,0xff,0x31,0x30,0x31,0xff,0x32,0x32,0x32,0xff,0x33,0x33,0x33,0xff,0x36,0x35,0x36,0xd2,0x35,0x36,0x34,0x51,0x32,0x32,0x31,0xff,0x33,0x32,0x32,0xff,0x32,0x31,0x30,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x4c,0x4f,0x03,0x36,0x35,0x36,0x8f,0x33,0x32,0x33,0xfb,0x31,0x31,0x32,0xff,0x32,0x32,0x32,0xff,0x33,0x34,0x33,0xff,0x34,0x34,0x34,0xfe,0x35,0x35,0x35,0x8b,0x31,0x30,0x30,0xa2,0x34,0x33,0x32,0xff,0x37,0x35,0x34,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x33,0x33,0x59,0x31,0x30,0x31,0xff,0x32,0x31,0x32,0xff,0x32,0x31,0x31,0xd3,0x59,0x52,0x59,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x70,0x34,0x8a,0x3b,0x70,0x32,0xe1,0x3d,0x72,0x35,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xab,0xbb,0xab,0x01,0x9f,0xa9,0x9f,0x03,0x94,0xa0,0x90,0x07,0x00,0x00,0x00,0x00,0x3d,0x3d,0x3d,0xa9,0x3a,0x39,0x3a,0xff,0x3c,0x3b,0x3c,0xff,0x42,0x41,0x41,0x6c,0x00,0x00,0x00,0x00,0x47,0x46,0x47,0x21,0x3e,0x3e,0x3e,0xe7,0x3d,0x3e,0x3e,0xff,0x3c,0x3c,0x3d,0xff,0x3d,0x3d,0x3e,0xff,0x3d,0x3d,0x3e,0xff,0x3c,0x3c,0x3c,0xff,0x43,0x43,0x43,0xff,0x54,0x53,0x53,0xff,0x59,0x58,0x58,0xff,0x4b,0x4b,0x4c,0xff,0x39,0x38,0x39,0xff,0x3f,0x3f,0x40,0xff,0x4e,0x4d,0x4e,0xff,0x39,0x38,0x39,0xff,0x35,0x34,0x35,0xff,0x59,0x59,0x5a,0xe6,0x74,0x74,0x74,0x21,0x00,0x00,0x00,0x00,0x96,0x97,0x97,0x07,0x74,0x74,0x75,0xdf,0x33,0x33,0x33,0xff,0x59,0x57,0x57,0xfe,0x70,0x6f,0x6f,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x87,0x64,0x01,0x41,0x72,0x39,0x38,0x3e,0x70,0x34,0x76,0x3f,0x71,0x35,0x9d,0x41,0x73,0x36,0xb4,0x43,0x77,0x38,0xac,0x42,0x79,0x37,0x86,0x47,0x7b,0x3a,0x3f,0x6e,0x86,0x5d,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x6f,0x33,0x9b,0x3c,0x71,0x32,0xfc,0x3c,0x77,0x32,0xfb,0x43,0x78,0x3c,0x30,0x44,0x7a,0x3a,0x1a,0x3f,0x74,0x34,0x79,0x41,0x75,0x36,0xab,0x41,0x74,0x36,0xa2,0x41,0x72,0x33,0x66,0x4c,0x76,0x3e,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x78,0x40,0x16,0x3e,0x72,0x35,0x69,0x41,0x76,0x37,0x9c,0x44,0x79,0x39,0xae,0x41,0x75,0x36,0x89,0x40,0x70,0x33,0x4b,0x51,0x74,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0x7d,0x44,0x0c,0x41,0x74,0x37,0x64,0x40,0x73,0x36,0xa0,0x44,0x78,0x39,0xbf,0x43,0x76,0x39,0xa5,0x41,0x72,0x35,0x68,0x4a,0x74,0x3e,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x71,0x31,0x2b,0x42,0x70,0x38,0x74,0x45,0x76,0x38,0x74,0x41,0x78,0x35,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x2d,0x2e,0x4c,0x2e,0x2e,0x2e,0x6c,0x31,0x31,0x30,0x6c,0x34,0x34,0x33,0x6c,0x33,0x34,0x34,0x6c,0x32,0x33,0x33,0x6c,0x31,0x32,0x31,0x6c,0x31,0x31,0x31,0x6b,0x36,0x36,0x36,0x65,0x38,0x37,0x37,0x39,0x53,0x4f,0x4f,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x3b,0x38,0x0b,0x33,0x33,0x32,0x68,0x32,0x32,0x32,0x9e,0x36,0x37,0x36,0xa8,0x35,0x35,0x35,0x76,0x3b,0x3b,0x39,0x16,0x37,0x37,0x37,0x01,0x34,0x34,0x34,0x67,0x31,0x30,0x30,0x70,0x30,0x30,0x2f,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x38,0x36,0x1a,0x33,0x32,0x32,0x74,0x34,0x34,0x35,0xa4,0x34,0x35,0x35,0xa2,0x34,0x34,0x34,0x64,0x41,0x41,0x41,0x08,0x35,0x36,0x35,0x18,0x34,0x33,0x33,0x70,0x31,0x30,0x2f,0x6f,0x30,0x2f,0x2f,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x34,0x33,0x2f,0x32,0x32,0x32,0x85,0x37,0x37,0x37,0xaa,0x35,0x35,0x35,0x8f,0x38,0x38,0x36,0x3c,0x00,0x00,0x00,0x00,0x31,0x31,0x31,0x41,0x31,0x31,0x30,0x6c,0x33,0x32,0x31,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x38,0x37,0x27,0x34,0x32,0x33,0xff,0x34,0x33,0x33,0xff,0x35,0x35,0x35,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x73,0x38,0x3e,0x3b,0x70,0x32,0xed,0x38,0x6f,0x30,0xd6,0x3a,0x6e,0x30,0x14,0x00,0x00,0x00,0x00,0xa4,0xb1,0xa7,0x06,0xaa,0xb4,0xaa,0x05,0x92,0xa3,0x91,0x2e,0x00,0x00,0x00,0x00,0x3f,0x3f,0x3e,0x3e,0x3a,0x39,0x3a,0xfe,0x39,0x38,0x39,0xff,0x3f,0x3f,0x3f,0xe8,0x4a,0x49,0x4a,0x10,0x00,0x00,0x00,0x00,0x3e,0x3e,0x3f,0x39,0x37,0x38,0x39,0xf5,0x3a,0x3b,0x3c,0xb5,0x3f,0x41,0x41,0x41,0x42,0x43,0x43,0x7b,0x47,0x47,0x47,0xe9,0x3c,0x3c,0x3c,0xff,0x39,0x39,0x39,0xff,0x38,0x38,0x39,0xff,0x3c,0x3b,0x3c,0xff,0x56,0x56,0x56,0xdd,0x64,0x64,0x64,0x61,0x67,0x67,0x69,0x19,0x5c,0x5c,0x5c,0x9a,0x54,0x54,0x55,0xf1,0x65,0x66,0x66,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0x94,0x94,0x78,0x4f,0x4f,0x4e,0xff,0x39,0x38,0x38,0xff,0x70,0x6f,0x6f,0xbe,0x83,0x7f,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x72,0x35,0x9c,0x3d,0x72,0x33,0xfc,0x3c,0x75,0x32,0xfb,0x44,0x77,0x3b,0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x3d,0x3c,0x29,0x5a,0x5a,0x5a,0x04,0x41,0x41,0x41,0x04,0x36,0x35,0x35,0xa6,0x34,0x34,0x33,0xff,0x36,0x35,0x35,0xf3,0x40,0x40,0x40,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x84,0x5a,0x01,0x3c,0x6e,0x32,0xa8,0x37,0x6b,0x2f,0xf0,0x38,0x6b,0x2f,0x8d,0x49,0x7f,0x49,0x01,0x00,0x00,0x00,0x00,0x99,0xb1,0x9c,0x25,0x6e,0x92,0x6a,0x20,0x50,0x7c,0x48,0x0b,0x4b,0x74,0x3e,0x02,0x3c,0x3b,0x3b,0xbe,0x37,0x37,0x37,0xff,0x39,0x39,0x39,0xff,0x42,0x42,0x42,0xa2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x41,0x41,0x14,0x72,0x73,0x73,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x4f,0x4f,0x3e,0x3e,0x3e,0x3f,0xff,0x36,0x36,0x36,0xff,0x36,0x36,0x36,0xff,0x41,0x41,0x41,0xfe,0x51,0x50,0x51,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x66,0x66,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa4,0xa2,0xa2,0x2f,0x73,0x73,0x74,0xf5,0x32,0x31,0x31,0xff,0x5b,0x5a,0x5a,0xfe,0x75,0x74,0x74,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x76,0x36,0x9b,0x3f,0x73,0x33,0xfb,0x3c,0x70,0x31,0xf9,0x43,0x73,0x38,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x3b,0x3b,0x10,0x33,0x32,0x33,0xf0,0x31,0x30,0x31,0xeb,0x31,0x30,0x30,0xe6,0x32,0x30,0x30,0xff,0x34,0x33,0x33,0xff,0x39,0x38,0x38,0x8a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x6d,0x35,0x24,0x39,0x6b,0x2f,0xe4,0x38,0x6b,0x2f,0xea,0x3a,0x6d,0x32,0x52,0x68,0x8d,0x68,0x01,0x76,0x9d,0x75,0x0c,0x5e,0x8b,0x59,0x1d,0x51,0x75,0x45,0x07,0x44,0x73,0x3c,0x0e,0x44,0x44,0x44,0x32,0x39,0x39,0x39,0xfb,0x34,0x34,0x34,0xff,0x39,0x3a,0x39,0xff,0x48,0x49,0x49,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0x5b,0x5a,0x04,0x41,0x41,0x42,0xe8,0x39,0x39,0x39,0xff,0x39,0x39,0x39,0xff,0x48,0x47,0x47,0xea,0x59,0x57,0x57,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xb1,0xb1,0x15,0x8e,0x8f,0x90,0xdc,0x34,0x34,0x34,0xff,0x3f,0x3e,0x3d,0xff,0x6e,0x6c,0x6c,0xa4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x74,0x35,0x9b,0x3f,0x73,0x32,0xfb,0x3f,0x73,0x33,0xf7,0x47,0x77,0x3b,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x37,0x38,0x4d,0x33,0x32,0x32,0xfe,0x32,0x32,0x31,0xff,0x32,0x31,0x31,0xff,0x31,0x30,0x30,0xff,0x34,0x32,0x31,0xbf,0x3b,0x37,0x36,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x6b,0x30,0x59,0x3a,0x6b,0x31,0xe9,0x3b,0x6f,0x33,0xdb,0x3f,0x74,0x38,0x29,0x4b,0x7a,0x45,0x08,0x3e,0x72,0x36,0x4b,0x3c,0x6f,0x33,0x8a,0x3a,0x6d,0x32,0xaa,0x39,0x6d,0x34,0x49,0x3c,0x3c,0x3d,0x81,0x36,0x36,0x37,0xff,0x33,0x33,0x33,0xff,0x3e,0x3f,0x3e,0xfd,0x56,0x56,0x56,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x49,0x49,0x57,0x4f,0x4f,0x4e,0x92,0x52,0x52,0x52,0x8f,0x52,0x52,0x51,0x5d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbe,0xbe,0xbf,0x19,0xa1,0xa1,0xa1,0xcb,0x41,0x40,0x40,0xff,0x38,0x36,0x36,0xff,0x65,0x63,0x63,0xdd,0x6c,0x6b,0x69,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x70,0x33,0x29,0x3f,0x6f,0x32,0x4b,0x41,0x73,0x33,0x3b,0x4e,0x7f,0x40,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x3d,0x3c,0x27,0x37,0x36,0x36,0x69,0x34,0x34,0x34,0x73,0x37,0x36,0x35,0x46,0x4e,0x46,0x44,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x7c,0x54,0x01,0x3f,0x71,0x34,0x8b,0x3c,0x6f,0x32,0xf2,0x3c,0x70,0x34,0xd7,0x3f,0x74,0x39,0x2f,0x3f,0x75,0x3a,0x2b,0x3b,0x6d,0x33,0xb4,0x39,0x6b,0x32,0xea,0x38,0x6a,0x32,0xd2,0x3d,0x6c,0x38,0x1b,0x3c,0x3c,0x3c,0xb0,0x37,0x37,0x36,0xff,0x36,0x36,0x36,0xff,0x44,0x44,0x44,0xff,0x5b,0x5b,0x5b,0xa1,0x6a,0x6c,0x6a,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0xb8,0xb9,0x4a,0x98,0x97,0x98,0xe4,0x41,0x3f,0x40,0xff,0x39,0x37,0x37,0xff,0x67,0x65,0x65,0xf0,0x71,0x71,0x6f,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x77,0x3e,0x06,0x3f,0x72,0x35,0x92,0x3c,0x70,0x32,0xef,0x3a,0x6f,0x32,0xd6,0x3a,0x6d,0x33,0x59,0x41,0x6d,0x3b,0x11,0x3a,0x6b,0x34,0x68,0x3a,0x6b,0x33,0xbc,0x3c,0x6f,0x35,0x6b,0x4c,0x60,0x4b,0x0f,0x3d,0x3d,0x3e,0xb9,0x38,0x37,0x38,0xff,0x36,0x35,0x36,0xff,0x3d,0x3d,0x3d,0xff,0x52,0x51,0x51,0xe3,0x5e,0x5d,0x5e,0x63,0x6b,0x6b,0x6a,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa4,0xa2,0xa2,0x33,0x9d,0x9b,0x9c,0xaf,0x70,0x6f,0x6f,0xfe,0x36,0x34,0x35,0xff,0x3d,0x3b,0x3b,0xff,0x66,0x64,0x65,0xf0,0x73,0x72,0x73,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x7a,0x4d,0x04,0x3d,0x6e,0x33,0x78,0x3b,0x6c,0x31,0xee,0x38,0x6c,0x30,0xf3,0x39,0x6b,0x32,0xa9,0x3b,0x6d,0x33,0x27,0x4b,0x78,0x41,0x06,0x46,0x76,0x3c,0x0f,0x48,0x76,0x3f,0x06,0x47,0x45,0x47,0x07,0x3f,0x3f,0x40,0x9e,0x38,0x37,0x39,0xff,0x34,0x33,0x34,0xff,0x34,0x33,0x34,0xff,0x41,0x40,0x40,0xff,0x57,0x56,0x56,0xf2,0x6d,0x6c,0x6d,0xb3,0x79,0x79,0x79,0x7c,0x78,0x77,0x77,0x61,0x79,0x77,0x78,0x5f,0x86,0x85,0x85,0x6a,0x8f,0x8f,0x8f,0x92,0x87,0x86,0x86,0xd2,0x6f,0x6e,0x6e,0xfe,0x3a,0x39,0x39,0xff,0x35,0x32,0x33,0xff,0x42,0x3f,0x40,0xff,0x62,0x5f,0x60,0xd9,0x6d,0x6e,0x6d,0x2c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x6d,0x36,0x4b,0x3a,0x6e,0x33,0xd7,0x3b,0x70,0x33,0xf8,0x3c,0x70,0x34,0xf0,0x3e,0x72,0x35,0xa3,0x3e,0x74,0x35,0x50,0x3f,0x75,0x37,0x1d,0x51,0x79,0x49,0x05,0x5a,0x7b,0x56,0x05,0x3c,0x3b,0x3d,0x61,0x3a,0x3a,0x3b,0xed,0x38,0x37,0x38,0xff,0x36,0x36,0x36,0xff,0x37,0x37,0x37,0xff,0x39,0x39,0x38,0xff,0x41,0x40,0x40,0xff,0x48,0x47,0x47,0xff,0x4a,0x48,0x49,0xff,0x45,0x44,0x44,0xff,0x3b,0x3a,0x3a,0xff,0x38,0x37,0x37,0xff,0x38,0x37,0x37,0xff,0x3f,0x3d,0x3e,0xff,0x52,0x50,0x51,0xfb,0x5f,0x5d,0x5d,0x93,0x60,0x63,0x63,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x78,0x40,0x0b,0x40,0x76,0x39,0x73,0x3e,0x74,0x36,0xdc,0x3d,0x73,0x34,0xf7,0x3c,0x72,0x33,0xed,0x3b,0x70,0x33,0xe0,0x3b,0x6e,0x32,0xd9,0x3b,0x6d,0x33,0xcb,0x3d,0x70,0x32,0x75,0x45,0x5d,0x44,0x1b,0x47,0x47,0x47,0x82,0x46,0x46,0x46,0xe8,0x41,0x41,0x41,0xff,0x3b,0x3b,0x3a,0xff,0x35,0x35,0x35,0xff,0x34,0x33,0x33,0xff,0x35,0x34,0x34,0xff,0x35,0x34,0x34,0xff,0x3a,0x39,0x39,0xff,0x46,0x45,0x45,0xff,0x54,0x53,0x53,0xf3,0x5f,0x5f,0x5f,0xa1,0x5e,0x5d,0x5d,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x83,0x4f,0x04,0x3f,0x75,0x38,0x46,0x3a,0x70,0x34,0x85,0x3b,0x70,0x34,0xbf,0x3c,0x70,0x33,0xdf,0x3e,0x74,0x35,0xe5,0x40,0x76,0x35,0xe0,0x44,0x78,0x3a,0x87,0x5a,0x86,0x53,0x02,0x5d,0x60,0x5d,0x05,0x4a,0x4b,0x4a,0x40,0x49,0x49,0x48,0x7f,0x4b,0x4a,0x4a,0xab,0x4d,0x4c,0x4c,0xc6,0x52,0x51,0x51,0xc7,0x54,0x53,0x53,0xb4,0x56,0x54,0x55,0x8e,0x55,0x54,0x53,0x55,0x5d,0x5d,0x5c,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xa5,0x7f,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xea,0x53,0xa8,0x33,0x0a,0x44,0xb2,0x8d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x33,0x87,0x33,0x67,0x33,0x67,0x33,0x67,0x33,0x67,0x33,0x87,0x33,0xa8,0x3b,0xee,0x6c,0x8a,0x52,0x8a,0x52,0x6a,0x4a,0xcb,0x5a,0x0c,0x63,0x2c,0x63,0xec,0x5a,0xab,0x52,0xaa,0x52,0xcb,0x5a,0x2c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x67,0x33,0x67,0x33,0x47,0x33,0x67,0x33,0x49,0x4a,0x49,0x4a,0x6e,0x73,0x30,0x84,0x92,0x8c,0x72,0x8c,0x51,0x8c,0x30,0x84,0x10,0x84,0xef,0x7b,0xae,0x73,0x6d,0x6b,0x0c,0x63,0xeb,0x5a,0xeb,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x3b,0x47,0x2b,0x66,0x33,0x67,0x33,0x87,0x33,0x88,0x33,0xa8,0x33,0xa8,0x3b,0xce,0x6c,0xca,0x52,0xc7,0x39,0x0c,0x63,0x71,0x8c,0xd3,0x9c,0xd3,0x9c,0x92,0x94,0x10,0x84,0xaf,0x73,0x8e,0x73,0xae,0x73,0xcf,0x7b,0xef,0x7b,0xcf,0x7b,0xae,0x73,0x4d,0x6b,0xcb,0x5a,0xcb,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x67,0x33,0x67,0x33,0x67,0x33,0x67,0x33,0x87,0x3b,0x00,0x00,0x0a,0x4c,0x00,0x00,0x28,0x42,0x08,0x42,0xef,0x7b,0xb2,0x94,0xb3,0x94,0xef,0x7b,0xeb,0x5a,0x08,0x42,0xe7,0x39,0xc7,0x39,0xe7,0x39,0x08,0x3a,0x08,0x42,0x69,0x4a,0xeb,0x5a,0x6d,0x6b,0x8e,0x73,0x6d,0x6b,0x0c,0x5b,0xeb,0x5a,0x8d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x67,0x33,0x67,0x33,0x67,0x33,0x67,0x33,0x87,0x33,0xc6,0x31,0x08,0x42,0x51,0x84,0xd3,0x9c,0x51,0x8c,0xaa,0x52,0x86,0x31,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x39,0x07,0x3a,0xcb,0x52,0x6d,0x6b,0x6d,0x6b,0x2c,0x63,0x0c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x3b,0x67,0x33,0x67,0x33,0x87,0x33,0xa8,0x3b,0xa8,0x3b,0x67,0x33,0x67,0x33,0x67,0x33,0xa7,0x3a,0xc7,0x39,0x10,0x84,0xb2,0x94,0xcf,0x73,0xc7,0x39,0x49,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x69,0x4a,0x2d,0x63,0x2c,0x63,0x0c,0x63,0xeb,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x2b,0x46,0x2b,0x67,0x33,0xa8,0x3b,0x6d,0x5c,0x4c,0x5c,0xc8,0x3b,0x87,0x33,0xa8,0x33,0x86,0x31,0xae,0x73,0x71,0x8c,0x4d,0x6b,0x66,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x63,0x4d,0x6b,0x2d,0x63,0xeb,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4a,0x69,0x4a,0xec,0x5a,0x0c,0x5b,0xeb,0x5a,0xeb,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x33,0x46,0x33,0x47,0x33,0x67,0x33,0x4d,0x64,0x53,0x9d,0xf0,0x7c,0xa8,0x33,0xa8,0x33,0x86,0x31,0x0c,0x63,0x51,0x8c,0x6e,0x6b,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0x6b,0x8e,0x73,0x10,0x84,0xef,0x7b,0x4d,0x6b,0x2c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4a,0x49,0x4a,0xeb,0x5a,0xcb,0x5a,0x0c,0x63,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0x43,0x67,0x33,0x67,0x33,0x47,0x33,0x0c,0x5c,0xab,0x4b,0x53,0x9d,0xea,0x53,0x87,0x33,0xa7,0x33,0x08,0x42,0x30,0x84,0xf0,0x7b,0xa6,0x31,0x00,0x00,0x00,0x00,0x69,0x4a,0x2c,0x63,0x00,0x00,0x00,0x00,0x0c,0x63,0xf0,0x7b,0x31,0x84,0x10,0x7c,0xae,0x73,0x0c,0x5b,0x00,0x00,0x00,0x00,0xce,0x7b,0x2c,0x63,0x00,0x00,0x00,0x00,0x69,0x4a,0x8a,0x52,0xcb,0x5a,0xeb,0x5a,0x2c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x67,0x33,0x87,0x33,0x89,0x3b,0xeb,0x5b,0x32,0x95,0xb0,0x84,0x6e,0x74,0x47,0x33,0x65,0x29,0x2c,0x63,0x10,0x84,0xaa,0x52,0xa6,0x31,0x00,0x00,0x8a,0x52,0x4d,0x6b,0x2c,0x63,0xcb,0x5a,0xeb,0x5a,0xef,0x7b,0xd3,0x9c,0x72,0x8c,0x31,0x84,0x10,0x84,0x6d,0x6b,0x0c,0x63,0x4d,0x6b,0x2c,0x63,0x2d,0x63,0x6d,0x6b,0x00,0x00,0x00,0x00,0x8a,0x52,0xaa,0x52,0xaa,0x52,0x2c,0x63,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x3b,0xa8,0x3b,0xa8,0x33,0x67,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x39,0xa7,0x39,0xa6,0x31,0x66,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x39,0xc7,0x39,0xe7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x71,0x85,0x16,0xb6,0x32,0x9d,0xf1,0x8c,0x67,0x3b,0xa6,0x31,0xae,0x73,0x6d,0x6b,0x45,0x29,0x00,0x00,0x69,0x4a,0x2c,0x63,0x71,0x8c,0xb2,0x94,0x71,0x8c,0x34,0xa5,0x55,0xad,0x72,0x8c,0xcf,0x7b,0x8e,0x73,0x8e,0x73,0xcf,0x7b,0xae,0x73,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x6d,0x6b,0x00,0x00,0x4d,0x6b,0xaa,0x52,0x8a,0x52,0xeb,0x5a,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0x54,0x88,0x3b,0x87,0x33,0xa8,0x33,0xa8,0x3b,0x88,0x33,0xe9,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0xa7,0x33,0xc8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x08,0x42,0xe8,0x41,0x08,0x42,0x08,0x42,0x08,0x42,0xe8,0x39,0xe7,0x39,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x39,0xa6,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xa6,0x31,0xc7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x67,0x33,0x67,0x33,0xa8,0x3b,0xe8,0x3b,0x2f,0x7c,0x00,0x00,0xb5,0xad,0x00,0x00,0x86,0x31,0x8a,0x52,0xae,0x73,0x49,0x4a,0xe7,0x39,0x00,0x00,0x08,0x42,0xcf,0x7b,0x51,0x8c,0xd3,0x9c,0x55,0xad,0x92,0x94,0x8a,0x52,0xc7,0x39,0x29,0x42,0x49,0x42,0xe7,0x39,0x08,0x42,0xec,0x62,0x8e,0x73,0x6d,0x6b,0x6d,0x6b,0x0c,0x63,0x4d,0x63,0x00,0x00,0x00,0x00,0xcb,0x5a,0x8a,0x52,0x8a,0x52,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x3b,0xa7,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0xa8,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x66,0x2b,0x67,0x33,0xef,0x7c,0xe9,0x4b,0x00,0x00,0x4e,0x6c,0x6e,0x74,0x00,0x00,0x45,0x29,0x0c,0x63,0x6d,0x6b,0x65,0x29,0x00,0x00,0x00,0x00,0x28,0x42,0x0c,0x63,0x30,0x84,0xd3,0x9c,0xcf,0x7b,0xc7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xaa,0x52,0x4d,0x6b,0x0c,0x63,0xeb,0x5a,0x2c,0x63,0x00,0x00,0x00,0x00,0x2d,0x6b,0xaa,0x52,0x69,0x4a,0x0c,0x63,0xcf,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa8,0x33,0xa8,0x33,0x88,0x33,0x88,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x46,0x2b,0x47,0x33,0xec,0x5b,0x69,0x43,0x2d,0x5c,0x12,0x95,0x2c,0x5c,0xcb,0x4c,0xa6,0x31,0x6d,0x6b,0xcb,0x5a,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x31,0x84,0xcf,0x7b,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x8a,0x52,0xaa,0x52,0xeb,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0x5a,0x49,0x4a,0xaa,0x52,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0xc8,0x3b,0x0c,0x5c,0xa9,0x43,0xa8,0x3b,0xa8,0x33,0xa8,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x49,0x4a,0x49,0x4a,0x69,0x4a,0x49,0x4a,0x08,0x3a,0xc7,0x39,0xa6,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x39,0xa6,0x31,0xa6,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0xc7,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x67,0x33,0x87,0x33,0x68,0x3b,0x67,0x3b,0x26,0x2c,0xf1,0x8c,0xa8,0x3b,0x48,0x44,0x28,0x42,0x6d,0x6b,0x69,0x4a,0x8a,0x52,0x00,0x00,0x00,0x00,0x6a,0x52,0x2c,0x63,0x31,0x8c,0x08,0x42,0x00,0x00,0x88,0x3b,0xa8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2b,0x54,0xc9,0x43,0x00,0x00,0x8a,0x52,0x8a,0x52,0xcb,0x5a,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0x5a,0x29,0x42,0x69,0x4a,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x87,0x33,0x87,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0x3b,0xd1,0x7c,0x00,0x00,0x00,0x00,0x67,0x33,0x87,0x33,0xa7,0x33,0x4b,0x5c,0xa8,0x33,0x87,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0xc8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0xa7,0x33,0xa7,0x33,0xa7,0x33,0x87,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x33,0x67,0x33,0x87,0x33,0xa7,0x33,0x87,0x33,0x67,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0xa6,0x31,0x6e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4a,0x86,0x31,0x86,0x31,0xa6,0x31,0x30,0x84,0x00,0x00,0x49,0x4a,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xc7,0x31,0xc7,0x39,0x86,0x31,0x86,0x31,0x86,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x08,0x42,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xca,0x4b,0x66,0x33,0x67,0x33,0x87,0x33,0x88,0x3b,0x68,0x3b,0xa9,0x3b,0xea,0x4b,0x67,0x2b,0x8a,0x53,0x49,0x4a,0x2c,0x63,0x28,0x42,0x00,0x00,0x6d,0x6b,0x28,0x42,0x28,0x42,0xcf,0x7b,0x8e,0x73,0xc7,0x39,0xea,0x4b,0x88,0x3b,0xea,0x53,0xc9,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0x74,0xa9,0x43,0xea,0x4b,0xcb,0x5a,0x8a,0x52,0x8a,0x52,0x0c,0x63,0x0c,0x63,0x10,0x84,0x00,0x00,0xcb,0x5a,0x49,0x4a,0x28,0x42,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0xa7,0x33,0xa8,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0xa7,0x33,0xc7,0x33,0xc8,0x3b,0xa8,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0xc8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0xca,0x43,0xa8,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0xa7,0x33,0xa7,0x33,0xc8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0xc8,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x6e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8a,0x52,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x49,0x4a,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x29,0x00,0x00,0x00,0x00,0xed,0x5a,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa7,0x31,0xa6,0x31,0x86,0x31,0x00,0x00,0xa6,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x39,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x67,0x33,0x66,0x33,0xa8,0x43,0x89,0x43,0xa9,0x4b,0xa9,0x43,0xca,0x4b,0x67,0x33,0xc6,0x31,0x49,0x4a,0x0c,0x63,0xc7,0x39,0x00,0x00,0x28,0x42,0xcb,0x5a,0x6d,0x6b,0x10,0x84,0xeb,0x5a,0x4c,0x6b,0x2b,0x54,0xcb,0x5b,0x2c,0x5c,0x4f,0x74,0xa8,0x3b,0x6d,0x64,0xce,0x74,0xeb,0x53,0xc9,0x43,0xca,0x4b,0x00,0x00,0x8a,0x52,0x69,0x4a,0x8a,0x52,0xaa,0x52,0x0c,0x63,0x00,0x00,0x2c,0x63,0x69,0x4a,0x08,0x42,0x4d,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x33,0x87,0x33,0x67,0x33,0x87,0x33,0x88,0x33,0xa8,0x33,0xc8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0x88,0x33,0x88,0x33,0xa8,0x33,0xc8,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0xa8,0x43,0x00,0x00,0x00,0x00,0x87,0x2b,0x87,0x33,0xa7,0x33,0xa8,0x33,0xa8,0x33,0xa9,0x3b,0xc8,0x3b,0xa7,0x33,0x87,0x33,0x87,0x33,0x88,0x3b,0x00,0x00,0x00,0x00,0x87,0x2b,0x87,0x33,0x87,0x33,0xa7,0x33,0xa8,0x33,0x88,0x3b,0xa8,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x49,0x4a,0x86,0x29,0x86,0x31,0xa6,0x31,0x28,0x42,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x29,0x4a,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x66,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x86,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0xa6,0x39,0xa6,0x31,0xa6,0x31,0xe7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0xa6,0x31,0xe7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x67,0x33,0x66,0x33,0xc8,0x3b,0x88,0x3b,0x0c,0x64,0xeb,0x4b,0x87,0x33,0x87,0x33,0x86,0x31,0x49,0x4a,0xeb,0x5a,0xa6,0x31,0x00,0x00,0x49,0x4a,0x0c,0x63,0x2c,0x63,0x6d,0x6b,0x69,0x4a,0x00,0x00,0xc9,0x43,0x4b,0x54,0x0b,0x54,0x00,0x00,0xa9,0x43,0xaa,0x4b,0x00,0x00,0x6d,0x64,0x00,0x00,0x6d,0x64,0x00,0x00,0xaa,0x52,0x29,0x4a,0x49,0x4a,0x49,0x4a,0x0c,0x63,0x00,0x00,0x2c,0x63,0x69,0x4a,0x08,0x3a,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x33,0x67,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x87,0x33,0x67,0x33,0x87,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0xea,0x43,0xa7,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0x00,0x00,0xc8,0x33,0x87,0x33,0x67,0x33,0x87,0x33,0xc8,0x33,0x00,0x00,0x00,0x00,0x6c,0x5c,0xa7,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0x00,0x00,0xca,0x43,0x87,0x33,0x67,0x33,0x67,0x2b,0xa8,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x3b,0x87,0x33,0x87,0x33,0x87,0x33,0xe9,0x43,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0xc7,0x39,0x69,0x52,0x00,0x00,0x00,0x00,0x28,0x42,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0xe8,0x41,0x86,0x31,0x86,0x31,0x86,0x31,0xc7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xc7,0x39,0x00,0x00,0x00,0x00,0x49,0x4a,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0xc7,0x39,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0xa7,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x67,0x33,0x66,0x33,0xc8,0x3b,0x89,0x43,0x6e,0x6c,0x49,0x43,0xa8,0x3b,0x87,0x33,0xc6,0x31,0x49,0x4a,0xcb,0x5a,0xc7,0x39,0x00,0x00,0x49,0x4a,0xcb,0x5a,0xeb,0x5a,0x2c,0x63,0x69,0x4a,0x00,0x00,0x0a,0x4c,0xca,0x4b,0x4c,0x64,0x0c,0x5d,0xeb,0x53,0xae,0x6c,0x00,0x00,0xec,0x5b,0xa9,0x43,0xca,0x4b,0x00,0x00,0xeb,0x5a,0x08,0x42,0x08,0x42,0x08,0x42,0x0c,0x5b,0x00,0x00,0x6d,0x6b,0x8a,0x52,0xe7,0x39,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x3b,0xa8,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0x87,0x33,0x67,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x3b,0x87,0x33,0x87,0x33,0xa7,0x33,0x31,0x8d,0xa7,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xea,0x4b,0x87,0x33,0x87,0x33,0x87,0x33,0xea,0x4b,0x88,0x33,0x87,0x33,0x87,0x33,0x67,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0xc8,0x33,0x00,0x00,0x87,0x33,0x67,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x28,0x42,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x29,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x39,0x86,0x31,0xa6,0x31,0xa7,0x31,0x00,0x00,0x00,0x00,0x28,0x42,0x86,0x31,0x86,0x31,0x86,0x31,0x69,0x52,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x3b,0x67,0x33,0x86,0x33,0xa8,0x3b,0x88,0x43,0xaa,0x4b,0xeb,0x53,0x2d,0x64,0x87,0x33,0xe7,0x39,0x28,0x4a,0xaa,0x52,0xe7,0x39,0x00,0x00,0x08,0x42,0x49,0x4a,0x8a,0x52,0xeb,0x5a,0x8a,0x52,0xec,0x62,0x6d,0x5c,0x6c,0x54,0x00,0x00,0x00,0x00,0xd0,0x7c,0xef,0x74,0xf1,0x84,0x2e,0x74,0xa8,0x3b,0x0a,0x4c,0x00,0x00,0x2c,0x63,0x08,0x42,0x49,0x4a,0xaa,0x52,0x0c,0x63,0x00,0x00,0x6d,0x6b,0x8a,0x52,0xe7,0x39,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xea,0x4b,0xa8,0x3b,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0xa9,0x4b,0x00,0x00,0x67,0x33,0x67,0x33,0xa7,0x33,0xc8,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x85,0xa7,0x33,0x87,0x33,0x87,0x33,0xa8,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0xc8,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x3b,0x87,0x33,0x67,0x33,0x88,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x87,0x33,0x87,0x33,0x88,0x33,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x08,0x3a,0xc7,0x39,0xc7,0x39,0xe8,0x39,0xc7,0x39,0xa7,0x39,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x29,0x00,0x00,0x28,0x42,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0xa6,0x31,0x86,0x31,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0xc7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0xc7,0x39,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xea,0x4b,0x67,0x33,0x66,0x33,0x87,0x33,0x87,0x3b,0x47,0x3b,0xa8,0x3b,0x0b,0x5c,0x87,0x33,0xe9,0x42,0x08,0x42,0x69,0x4a,0x08,0x42,0x00,0x00,0xae,0x73,0xe7,0x39,0xe7,0x39,0xaa,0x52,0xaa,0x52,0x69,0x4a,0x00,0x00,0x4d,0x64,0x0e,0x6c,0x4d,0x6c,0xf7,0xbd,0xb5,0xad,0x6c,0x5c,0xad,0x6c,0x0b,0x54,0x00,0x00,0x10,0x84,0xeb,0x5a,0x28,0x42,0x4d,0x6b,0x2c,0x63,0x00,0x00,0x00,0x00,0x6d,0x6b,0x29,0x4a,0x08,0x42,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x3b,0xa7,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x87,0x33,0x87,0x33,0xa7,0x33,0xc8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xee,0x74,0xa8,0x33,0x87,0x33,0xa7,0x33,0xc8,0x3b,0x67,0x33,0x87,0x33,0x87,0x33,0xc8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x87,0x33,0xa7,0x33,0xc8,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0xae,0x7b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x28,0x42,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0xc6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0xc7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x39,0x86,0x31,0xa6,0x31,0xa6,0x31,0x28,0x42,0xa6,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x67,0x33,0x67,0x33,0x88,0x3b,0x68,0x3b,0xa9,0x4b,0x8e,0x74,0xa8,0x3b,0x4a,0x4c,0xe7,0x39,0x28,0x42,0xe7,0x39,0x08,0x42,0x00,0x00,0x00,0x00,0x48,0x42,0x28,0x42,0x8a,0x52,0x69,0x4a,0x0b,0x5b,0x00,0x00,0x00,0x00,0xad,0x6c,0x99,0xce,0x98,0xce,0xce,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8c,0x08,0x42,0x8a,0x52,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0x6b,0xc7,0x39,0x49,0x4a,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x88,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x67,0x33,0x87,0x33,0xa8,0x3b,0x00,0x00,0xc8,0x3b,0xa7,0x33,0xa7,0x33,0xa8,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x3b,0x87,0x33,0x87,0x33,0xa7,0x33,0x00,0x00,0xa7,0x33,0xa7,0x33,0x87,0x33,0xa8,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x3b,0x87,0x33,0x87,0x33,0xa7,0x33,0x2a,0x4c,0xa8,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0xa8,0x33,0xc8,0x3b,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0xaf,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc6,0x31,0x86,0x31,0xa6,0x31,0xc7,0x39,0x00,0x00,0x08,0x42,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0xc7,0x39,0x86,0x31,0x86,0x31,0x86,0x31,0x08,0x3a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x39,0xa6,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x39,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xe7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x33,0x67,0x33,0x47,0x33,0xca,0x4b,0x88,0x3b,0xe8,0x43,0x6e,0x6c,0x2c,0x5c,0x00,0x00,0xa6,0x31,0xe7,0x39,0xe7,0x39,0xc7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x39,0x49,0x4a,0x69,0x4a,0xaa,0x52,0x00,0x00,0xc9,0x4b,0x88,0x3b,0xd5,0xad,0x74,0xa5,0x67,0x33,0x88,0x3b,0x00,0x00,0x14,0xa5,0x8e,0x73,0xe7,0x39,0x2c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x63,0x86,0x31,0x8a,0x52,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xad,0x64,0x87,0x33,0x87,0x33,0xa7,0x33,0xe8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x67,0x33,0x87,0x33,0xa7,0x33,0xe9,0x3b,0x00,0x00,0xc8,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0xa8,0x33,0x30,0x85,0x00,0x00,0xe9,0x3b,0xa8,0x33,0x87,0x33,0x87,0x33,0x88,0x33,0x00,0x00,0xe9,0x43,0xa7,0x33,0x87,0x33,0x87,0x33,0xa8,0x33,0xcf,0x74,0x00,0x00,0x2a,0x44,0xa8,0x33,0x67,0x33,0x67,0x33,0xa8,0x33,0x00,0x00,0xce,0x6c,0xa7,0x33,0x87,0x33,0x67,0x33,0xa7,0x33,0x2a,0x4c,0x00,0x00,0x2a,0x4c,0xa8,0x33,0x67,0x33,0x67,0x33,0x87,0x33,0x0a,0x44,0x00,0x00,0xa7,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xcf,0x7b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x42,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0xe7,0x39,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x08,0x42,0x00,0x00,0xcb,0x5a,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0xc7,0x39,0x86,0x31,0x86,0x31,0x86,0x31,0xa7,0x31,0x00,0x00,0x00,0x00,0xc7,0x39,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x39,0xa6,0x31,0x86,0x31,0xa6,0x31,0x86,0x31,0xa7,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x33,0x47,0x33,0x47,0x33,0xb0,0x84,0xaa,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xc7,0x39,0xe7,0x39,0xe7,0x39,0x00,0x00,0x00,0x00,0x08,0x42,0x08,0x42,0x28,0x42,0x28,0x42,0x69,0x4a,0xeb,0x5a,0xad,0x6b,0x0d,0x64,0xb0,0x84,0x8f,0x7c,0xa9,0x43,0x2d,0x6c,0x14,0xa5,0xcf,0x7b,0xc7,0x39,0xc7,0x39,0xcb,0x5a,0xae,0x73,0x00,0x00,0x00,0x00,0xcf,0x7b,0xcb,0x5a,0x65,0x29,0xec,0x62,0xf0,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x87,0x33,0xa7,0x33,0xa7,0x33,0xa7,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0xa8,0x33,0x87,0x33,0x87,0x33,0x88,0x33,0x00,0x00,0x00,0x00,0xa7,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa8,0x33,0xa8,0x33,0x88,0x33,0xa7,0x33,0xa8,0x33,0xa8,0x33,0x88,0x33,0x88,0x33,0x00,0x00,0x00,0x00,0x88,0x33,0x87,0x33,0xa7,0x33,0xa8,0x33,0xa8,0x33,0x87,0x33,0xa8,0x33,0xa8,0x33,0x88,0x33,0x68,0x33,0x88,0x33,0x00,0x00,0x00,0x00,0x87,0x33,0x67,0x33,0x87,0x33,0xa7,0x33,0xa8,0x33,0x88,0x33,0x87,0x33,0x87,0x33,0x88,0x33,0x87,0x33,0x88,0x33,0x00,0x00,0x00,0x00,0xa8,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa7,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x3b,0x67,0x33,0x67,0x33,0xa8,0x3b,0x2a,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xc7,0x39,0xc7,0x39,0xe7,0x39,0x69,0x4a,0x00,0x00,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x28,0x42,0xcb,0x5a,0xef,0x7b,0x71,0x8c,0xb2,0x94,0xd3,0x9c,0x51,0x8c,0x0c,0x63,0xa6,0x31,0xa7,0x39,0xc7,0x39,0x08,0x42,0x8e,0x73,0x00,0x00,0x00,0x00,0x10,0x84,0x08,0x42,0xc7,0x39,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0x64,0xa8,0x3b,0xa8,0x33,0x87,0x33,0x67,0x33,0x67,0x33,0x87,0x33,0xa7,0x33,0xa8,0x33,0xa7,0x33,0x87,0x33,0xa7,0x33,0x00,0x00,0x00,0x00,0x67,0x33,0x87,0x33,0x87,0x33,0xc8,0x3b,0xc8,0x33,0xa7,0x33,0x87,0x33,0x87,0x33,0xa8,0x33,0xa8,0x33,0xc8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x33,0xa8,0x33,0xa7,0x33,0xa7,0x33,0x87,0x33,0x88,0x33,0x88,0x33,0xa8,0x33,0xc8,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0xa8,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa8,0x33,0xc8,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0xa7,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xc7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xc7,0x39,0xa6,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xa7,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x6a,0x4a,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x8b,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x87,0x33,0x87,0x33,0x00,0x00,0x00,0x00,0xd5,0xad,0x53,0x9d,0x12,0x95,0x00,0x00,0xe7,0x39,0xc7,0x39,0xc7,0x39,0x08,0x42,0x00,0x00,0x28,0x42,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xe7,0x39,0x08,0x42,0x8a,0x52,0xcb,0x5a,0x49,0x4a,0xc7,0x39,0xe7,0x41,0x69,0x4a,0xc7,0x39,0xa6,0x31,0xcb,0x5a,0xae,0x73,0x00,0x00,0xb2,0x94,0xae,0x73,0x86,0x31,0xab,0x52,0x6e,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x64,0x88,0x3b,0x87,0x33,0x87,0x33,0x88,0x33,0xa8,0x3b,0xc8,0x33,0xc8,0x3b,0x2d,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x87,0x33,0xa7,0x33,0xc8,0x3b,0xc8,0x3b,0xa7,0x33,0xa8,0x33,0xa8,0x33,0x88,0x33,0xa9,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0x43,0x87,0x33,0xa8,0x33,0xc8,0x3b,0xa8,0x33,0x88,0x33,0xaa,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe9,0x43,0xa8,0x33,0x88,0x33,0xc8,0x3b,0xa8,0x3b,0x88,0x33,0xa9,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x33,0x88,0x3b,0xa8,0x3b,0xc8,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x65,0x29,0x86,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0xa7,0x31,0x6a,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x39,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xc7,0x39,0xa6,0x31,0xa6,0x31,0x86,0x31,0x86,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x08,0x42,0xa6,0x31,0x86,0x31,0x86,0x29,0x66,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xc7,0x31,0x00,0x00,0x86,0x31,0x86,0x31,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x31,0x86,0x31,0x86,0x31,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x3b,0x87,0x33,0x67,0x33,0x67,0x33,0x00,0x00,0x94,0xa5,0xb5,0xad,0x12,0x95,0x00,0x00,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xe7,0x39,0x49,0x4a,0x00,0x00,0xe7,0x39,0xc6,0x39,0xc7,0x39,0x07,0x42,0x08,0x42,0x28,0x42,0xe7,0x39,0xc7,0x39,0xc7,0x39,0xc7,0x39,0xaa,0x52,0x2c,0x63,0x2c,0x6b,0xeb,0x5a,0xaa,0x52,0x2c,0x63,0x00,0x00,0x00,0x00,0xb2,0x94,0x69,0x4a,0xc7,0x39,0x6e,0x6b,0xf0,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x33,0x87,0x33,0xa7,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x39,0xcb,0x5a,0x08,0x42,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x5c,0x67,0x33,0x46,0x2b,0x47,0x2b,0xe9,0x4b,0x00,0x00,0x93,0x9d,0x8d,0x6c,0xea,0x4b,0xa9,0x3b,0xc7,0x39,0xa6,0x31,0xc7,0x39,0x08,0x42,0x00,0x00,0x00,0x00,0x08,0x42,0x8e,0x73,0x00,0x00,0x00,0x00,0x69,0x4a,0xe7,0x39,0xa6,0x31,0xa6,0x31,0x08,0x42,0x8a,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x63,0x00,0x00,0x00,0x00,0x14,0xa5,0x8e,0x73,0x86,0x31,0xcb,0x5a,0xae,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x87,0x33,0x87,0x33,0x88,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x39,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xc7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x47,0x2b,0x47,0x2b,0x67,0x33,0x6d,0x6c,0xee,0x74,0x4b,0x5c,0xaa,0x43,0x88,0x3b,0x28,0x42,0xc7,0x39,0xa6,0x31,0xc7,0x39,0x49,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0x5a,0x08,0x42,0xc7,0x39,0xc7,0x39,0x29,0x42,0xab,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xb5,0x71,0x94,0xa6,0x31,0xe7,0x39,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x33,0x87,0x33,0x87,0x33,0xa8,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x39,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa7,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x33,0x47,0x33,0x67,0x33,0xa7,0x3b,0xc9,0x43,0x87,0x33,0x67,0x33,0x67,0x33,0x67,0x33,0xe7,0x39,0xa6,0x31,0x86,0x31,0xe7,0x39,0xaa,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4a,0x69,0x4a,0x8a,0x52,0x8a,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0xbd,0x14,0xa5,0x08,0x42,0xa7,0x31,0x0c,0x63,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x33,0x67,0x33,0x88,0x33,0xe9,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x39,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x29,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xeb,0x53,0x87,0x33,0x67,0x33,0x87,0x33,0xa7,0x3b,0xa7,0x3b,0x67,0x33,0x47,0x33,0x47,0x33,0x67,0x3b,0xe7,0x39,0xa6,0x31,0xa6,0x31,0x28,0x42,0xcb,0x5a,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd7,0xbd,0xb3,0x9c,0xe8,0x41,0xa7,0x31,0x2c,0x63,0x8e,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa9,0x3b,0x87,0x33,0x87,0x33,0x67,0x33,0x67,0x33,0x68,0x3b,0x47,0x33,0x47,0x33,0x67,0x33,0x09,0x4b,0xe7,0x39,0xa7,0x39,0xa6,0x31,0xe7,0x39,0x8a,0x52,0xeb,0x5a,0x4d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xa5,0xd3,0x9c,0x6e,0x6b,0xa6,0x31,0xc7,0x39,0x2c,0x63,0x8e,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xca,0x4b,0x67,0x33,0x67,0x33,0x67,0x33,0x47,0x33,0x67,0x33,0xc9,0x43,0xa8,0x3b,0xa9,0x3b,0x28,0x42,0xe7,0x41,0xa7,0x39,0x86,0x31,0x86,0x31,0x08,0x42,0xaa,0x52,0x6d,0x6b,0xcf,0x7b,0xaf,0x73,0xaf,0x7b,0x30,0x84,0x71,0x8c,0x30,0x84,0x6d,0x6b,0xc7,0x39,0x86,0x31,0xe8,0x41,0xec,0x62,0x6d,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x33,0x67,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0xa7,0x33,0xca,0x4b,0xcb,0x53,0xc7,0x39,0xc7,0x39,0xa7,0x39,0xa6,0x31,0xa6,0x31,0xc7,0x39,0x08,0x42,0x29,0x42,0x49,0x4a,0x28,0x42,0xc7,0x39,0xa7,0x31,0xa7,0x31,0xe7,0x39,0x8a,0x52,0xeb,0x5a,0x0c,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc8,0x43,0xa8,0x3b,0xa7,0x33,0x87,0x33,0x87,0x33,0x87,0x33,0x67,0x33,0x67,0x33,0x87,0x33,0xe8,0x42,0x28,0x42,0x28,0x42,0x08,0x42,0xc7,0x39,0xa6,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xc7,0x39,0x28,0x42,0x8a,0x52,0xeb,0x5a,0xeb,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x4c,0xa7,0x3b,0x87,0x33,0x87,0x33,0x87,0x33,0xa7,0x33,0xa8,0x33,0xc8,0x3b,0x2b,0x54,0x0b,0x5b,0x49,0x4a,0x49,0x4a,0x49,0x4a,0x69,0x4a,0x8a,0x52,0x8a,0x52,0xaa,0x52,0xaa,0x52,0xeb,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x7d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x04,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x70,0xa6,0xcc,0xd4,0xc2,0xac,0x3c,0x01,0x0a,0x58,0x9a,0xc3,0xd7,0xd8,0xcc,0xa7,0x7b,0x35,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xab,0xf5,0xf8,0xf1,0xf1,0xee,0xb6,0x32,0x20,0x8b,0xed,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd8,0x66,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x7e,0xf1,0xf7,0xda,0x97,0x50,0x21,0x0a,0x04,0x7c,0xf2,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd4,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0xb8,0xf4,0xd7,0x66,0x13,0x00,0x01,0x00,0x12,0xbd,0xff,0xff,0xff,0xff,0xdf,0x95,0x61,0x46,0x41,0x56,0x7e,0xbf,0xfa,0xff,0xff,0xff,0xfa,0x70,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0xd2,0xfa,0xcd,0x1c,0x0f,0x4a,0x4e,0x13,0x11,0xce,0xff,0xff,0xff,0xcd,0x46,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x94,0xf9,0xff,0xff,0xff,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xcb,0xfb,0xd1,0x27,0x21,0x7d,0xb8,0x76,0x0e,0xc0,0xff,0xff,0xfc,0x7b,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xd4,0xff,0xff,0xfe,0x6a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9d,0xfb,0xe2,0x22,0x01,0x34,0x61,0x3a,0x05,0x97,0xff,0xff,0xf9,0x55,0x00,0x00,0x00,0x00,0x00,0x83,0xbb,0xb5,0x7b,0x00,0x00,0x00,0x00,0x00,0x10,0xbb,0xff,0xff,0xf7,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0xfb,0xf8,0x50,0x01,0x0f,0x44,0x38,0x19,0x3b,0xfe,0xff,0xfe,0x5e,0x00,0x00,0x00,0x00,0x00,0x06,0xef,0xff,0xff,0xf3,0x0c,0x00,0x00,0x00,0x00,0x00,0x0a,0xcb,0xff,0xff,0xcc,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xd4,0xfc,0x9e,0x01,0x04,0x1e,0x38,0x90,0x18,0xca,0xff,0xff,0x8b,0x00,0x00,0x31,0x0a,0x00,0x00,0x45,0xff,0xff,0xff,0xff,0x61,0x00,0x00,0x02,0x27,0x00,0x00,0x1a,0xeb,0xff,0xff,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0xfc,0xf1,0x1e,0x02,0x05,0x09,0x69,0x4a,0x56,0xff,0xff,0xdc,0x07,0x00,0x41,0xf9,0xd5,0x51,0x8a,0xf3,0xff,0xff,0xff,0xff,0xfd,0xa8,0x60,0xc7,0xfc,0x51,0x00,0x00,0x61,0xff,0xff,0xe2,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x11,0x0d,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x15,0x13,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x13,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xfc,0x84,0x00,0x01,0x02,0x11,0x1c,0x04,0xb9,0xff,0xff,0x58,0x00,0x27,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0x3b,0x00,0x02,0xce,0xff,0xff,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x1e,0x50,0x65,0x5d,0x34,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xfc,0xfa,0x6e,0x00,0x00,0x00,0x11,0x12,0x11,0x13,0x13,0x12,0x10,0x0e,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xfe,0xfd,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbd,0xfd,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x25,0xf5,0xf7,0x27,0x01,0x02,0x00,0x05,0x00,0x1e,0xfd,0xff,0xdb,0x03,0x00,0x7f,0xff,0xff,0xff,0xff,0xff,0xbf,0x5f,0x35,0x31,0x53,0xad,0xfe,0xff,0xff,0xff,0xff,0x73,0x00,0x00,0x5c,0xff,0xff,0xb4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0xb8,0xf9,0xfb,0xfb,0xfb,0xfb,0xee,0xa9,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0xff,0xff,0x6e,0x00,0x00,0x00,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0xc2,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xff,0xff,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbd,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x6c,0xfc,0xd0,0x01,0x01,0x00,0x01,0x03,0x00,0x5e,0xff,0xff,0x79,0x00,0x00,0x16,0xf0,0xff,0xff,0xf9,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0xf0,0xff,0xff,0xe7,0x0d,0x00,0x00,0x0b,0xed,0xff,0xf8,0x0e,0x00,0x00,0x00,0x00,0x00,0x13,0xdc,0xfb,0xfb,0xfb,0xf8,0xf9,0xfb,0xfb,0xfb,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xff,0xff,0x6d,0x00,0x00,0x00,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xff,0xff,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xab,0xfd,0x94,0x02,0x0b,0x01,0x06,0x0a,0x01,0xa9,0xff,0xff,0x31,0x00,0x00,0x00,0xa7,0xff,0xfc,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xfa,0xff,0xc9,0x00,0x00,0x00,0x00,0xa3,0xff,0xff,0x3f,0x00,0x00,0x00,0x00,0x00,0x7c,0xfb,0xfb,0xb8,0x3b,0x23,0x27,0x61,0xb8,0xf8,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xff,0xff,0x6c,0x00,0x00,0x00,0xbc,0xff,0xf7,0x2d,0x2a,0x2b,0x2a,0x36,0x99,0xff,0xff,0xd9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xff,0xff,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xd8,0xfd,0x5c,0x13,0x24,0x01,0x0a,0x31,0x03,0xe2,0xff,0xec,0x04,0x00,0x00,0x0b,0xe8,0xff,0x9e,0x00,0x47,0x12,0x00,0x00,0x00,0x00,0x07,0x14,0x00,0x99,0xff,0xfe,0x2b,0x00,0x00,0x00,0x6c,0xff,0xff,0x72,0x00,0x00,0x00,0x00,0x00,0xbd,0xfc,0xf8,0x20,0x00,0x00,0x00,0x00,0x00,0x25,0x01,0x00,0x00,0x58,0x9d,0x81,0x01,0x47,0xb1,0xd6,0xd4,0x98,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x9c,0xcb,0xd1,0xbb,0x80,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0xa1,0xdf,0xe4,0xda,0xa1,0x33,0x00,0x00,0x00,0x00,0x61,0xff,0xff,0x6c,0x00,0x00,0x00,0xbc,0xff,0xf5,0x02,0x00,0x00,0x00,0x00,0x01,0xe3,0xff,0xfa,0x03,0x00,0x0d,0xaf,0xa8,0x67,0x00,0x00,0x00,0x00,0x15,0xb4,0xb2,0x61,0x00,0x00,0x00,0x00,0x51,0xb5,0xcf,0xc9,0x94,0x23,0x61,0xff,0xff,0x54,0x00,0x00,0x00,0x0b,0x7a,0xcf,0xd8,0xc8,0x6c,0x06,0xc0,0xff,0xf0,0x00,0x4a,0xb0,0xab,0x34,0x00,0x00,0x00,0x00,0x00,0x7f,0xb2,0x95,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x08,0xf2,0xfa,0x28,0x16,0x0f,0x0a,0x15,0x9e,0x07,0xf1,0xff,0xc8,0x00,0x02,0x27,0x95,0xff,0xff,0x33,0x07,0x3d,0x03,0x02,0x00,0x00,0x00,0x01,0x1d,0x04,0x24,0xfb,0xff,0xae,0x30,0x02,0x00,0x3f,0xff,0xff,0x93,0x00,0x00,0x00,0x00,0x00,0xc6,0xfb,0xfb,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9b,0xfb,0xf8,0x81,0xf9,0xfb,0xfb,0xfc,0xfd,0xf4,0x4d,0x00,0x00,0x00,0x04,0x98,0xfc,0xfb,0xfb,0xfb,0xfb,0xfc,0xf5,0x57,0x00,0x00,0x00,0x00,0x76,0xfa,0xff,0xff,0xff,0xff,0xff,0xfb,0x79,0x00,0x00,0x00,0x61,0xff,0xff,0x6c,0x00,0x00,0x00,0xbd,0xff,0xf5,0x02,0x00,0x00,0x00,0x00,0x01,0xe3,0xff,0xdf,0x00,0x00,0x14,0xff,0xff,0x9c,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0x8f,0x00,0x00,0x01,0x8f,0xff,0xff,0xff,0xff,0xff,0xf3,0xa5,0xff,0xff,0x54,0x00,0x00,0x16,0xd3,0xff,0xff,0xff,0xff,0xff,0xba,0xd3,0xff,0xf1,0x00,0x1c,0xfa,0xff,0xaa,0x00,0x00,0x00,0x00,0x0e,0xf5,0xff,0x8b,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x13,0xf7,0xf7,0x15,0x0a,0x05,0x0b,0x0c,0xa6,0x15,0xfd,0xff,0xae,0x00,0x8d,0xfe,0xff,0xff,0xf0,0x04,0x08,0x04,0x02,0x01,0x08,0x02,0x02,0x06,0x04,0x07,0x00,0xcf,0xff,0xff,0xff,0x98,0x00,0x23,0xfe,0xff,0xa4,0x00,0x00,0x00,0x00,0x00,0x8e,0xfb,0xfd,0xfa,0xb3,0x5b,0x1b,0x00,0x00,0x00,0x00,0x00,0x00,0x9c,0xfb,0xfc,0xfb,0xe9,0x9b,0x95,0xdd,0xfc,0xfd,0xf0,0x21,0x00,0x00,0x7f,0xfb,0xfe,0xf3,0xa4,0x95,0xc4,0xfb,0xff,0xfa,0x3d,0x00,0x00,0x54,0xfe,0xff,0xfe,0xbc,0x9b,0xbd,0xfd,0xff,0xff,0x64,0x00,0x00,0x59,0xff,0xff,0x6c,0x00,0x00,0x00,0xbd,0xff,0xf7,0x0b,0x04,0x06,0x06,0x1f,0x90,0xff,0xff,0x72,0x00,0x00,0x15,0xff,0xff,0x9c,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0x91,0x00,0x00,0x5c,0xff,0xff,0xfc,0xa8,0x6d,0xa1,0xfa,0xff,0xff,0xff,0x54,0x00,0x00,0xb0,0xff,0xff,0xeb,0x88,0x75,0xcd,0xff,0xff,0xff,0xf1,0x00,0x00,0xaf,0xff,0xf8,0x16,0x00,0x00,0x00,0x66,0xff,0xfd,0x25,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x12,0xf1,0xea,0x06,0x0f,0x06,0x03,0x04,0x87,0x14,0xfd,0xff,0xa0,0x00,0xa0,0xff,0xff,0xff,0xd0,0x00,0x10,0x04,0x06,0x00,0x07,0x06,0x00,0x04,0x00,0x03,0x00,0xab,0xff,0xff,0xff,0xa9,0x00,0x1a,0xfd,0xff,0xb4,0x00,0x00,0x00,0x00,0x00,0x18,0xda,0xfc,0xfd,0xfb,0xfb,0xf8,0xc6,0x74,0x0f,0x00,0x00,0x00,0x9b,0xfd,0xfe,0xe0,0x1d,0x00,0x00,0x09,0xb2,0xfd,0xfd,0x91,0x00,0x18,0xf1,0xfe,0xef,0x2e,0x00,0x00,0x01,0x7a,0xff,0xff,0xc5,0x00,0x06,0xde,0xff,0xfd,0x59,0x00,0x00,0x00,0x5b,0xfe,0xff,0xec,0x0a,0x00,0x5d,0xff,0xff,0x6c,0x00,0x00,0x00,0xbd,0xff,0xff,0xf5,0xf1,0xf4,0xf4,0xff,0xff,0xff,0x89,0x02,0x00,0x00,0x16,0xff,0xff,0x9c,0x00,0x00,0x00,0x00,0x1e,0xff,0xff,0x91,0x00,0x01,0xd8,0xff,0xfd,0x5a,0x00,0x00,0x00,0x41,0xf9,0xff,0xff,0x54,0x00,0x2d,0xfe,0xff,0xe1,0x1a,0x00,0x00,0x03,0xa4,0xff,0xff,0xf0,0x00,0x00,0x4a,0xff,0xff,0x6f,0x00,0x00,0x00,0xc1,0xff,0xb8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0xf0,0xeb,0x06,0x0d,0x05,0x01,0x02,0x72,0x11,0xfb,0xff,0xa1,0x00,0xa2,0xff,0xff,0xff,0xd0,0x00,0x0b,0x03,0x02,0x01,0x01,0x02,0x00,0x03,0x02,0x0a,0x00,0xab,0xff,0xff,0xff,0xa7,0x00,0x1d,0xfd,0xff,0xb1,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x81,0xdd,0xfd,0xfd,0xfc,0xfb,0xfc,0xe6,0x3f,0x00,0x00,0x9a,0xfd,0xfe,0x63,0x00,0x00,0x00,0x00,0x1f,0xf8,0xff,0xe1,0x01,0x60,0xfc,0xff,0x87,0x00,0x00,0x00,0x00,0x04,0xe3,0xff,0xfc,0x16,0x41,0xff,0xff,0xaf,0x00,0x00,0x00,0x00,0x00,0xb3,0xff,0xff,0x4c,0x00,0x57,0xff,0xff,0x6b,0x00,0x00,0x00,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd8,0x3c,0x00,0x00,0x17,0xff,0xff,0x9a,0x00,0x00,0x00,0x00,0x20,0xff,0xff,0x90,0x00,0x1f,0xff,0xff,0xbd,0x00,0x00,0x00,0x00,0x00,0x9d,0xff,0xff,0x53,0x00,0x75,0xff,0xff,0x63,0x00,0x00,0x00,0x00,0x13,0xfa,0xff,0xf1,0x00,0x00,0x03,0xdb,0xff,0xcf,0x01,0x00,0x25,0xfc,0xff,0x51,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x14,0xf5,0xf6,0x15,0x0c,0x05,0x04,0x03,0x65,0x13,0xfc,0xff,0xb4,0x00,0x89,0xfe,0xff,0xff,0xf2,0x05,0x02,0x02,0x00,0x00,0x02,0x05,0x01,0x01,0x0d,0x02,0x00,0xd3,0xff,0xff,0xfc,0x85,0x00,0x29,0xfe,0xff,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x2d,0x76,0xc5,0xfb,0xfd,0xfc,0xe4,0x09,0x00,0x9a,0xfd,0xfd,0x2f,0x00,0x00,0x00,0x00,0x01,0xd8,0xff,0xf0,0x04,0x78,0xfc,0xfe,0x43,0x00,0x00,0x00,0x00,0x00,0xa7,0xff,0xff,0x35,0x65,0xff,0xff,0x76,0x00,0x00,0x00,0x00,0x00,0x71,0xff,0xff,0x71,0x00,0x5a,0xff,0xff,0x6b,0x00,0x00,0x00,0xbd,0xff,0xf7,0x2a,0x24,0x24,0x22,0x22,0x52,0xdb,0xff,0xf5,0x26,0x00,0x19,0xff,0xff,0x9a,0x00,0x00,0x00,0x00,0x21,0xff,0xff,0x90,0x00,0x3a,0xff,0xff,0x86,0x00,0x00,0x00,0x00,0x00,0x64,0xff,0xff,0x53,0x00,0x9b,0xff,0xff,0x2c,0x00,0x00,0x00,0x00,0x00,0xca,0xff,0xf0,0x00,0x00,0x00,0x74,0xff,0xff,0x31,0x00,0x82,0xff,0xe0,0x05,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x08,0xee,0xf9,0x29,0x12,0x09,0x0b,0x05,0x84,0x09,0xf5,0xff,0xd1,0x00,0x01,0x22,0x9a,0xff,0xff,0x41,0x00,0x03,0x01,0x02,0x25,0x34,0x05,0x02,0x05,0x00,0x26,0xfb,0xff,0x90,0x1c,0x00,0x00,0x48,0xff,0xff,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xea,0xfc,0xfb,0x41,0x00,0x9a,0xfc,0xfd,0x38,0x00,0x00,0x00,0x00,0x01,0xdb,0xff,0xee,0x03,0x72,0xfc,0xfe,0x4b,0x00,0x00,0x00,0x00,0x00,0xa9,0xff,0xff,0x30,0x62,0xff,0xff,0x79,0x00,0x00,0x00,0x00,0x00,0x73,0xff,0xff,0x6c,0x00,0x62,0xff,0xff,0x6c,0x00,0x00,0x00,0xbd,0xff,0xf5,0x02,0x00,0x00,0x00,0x00,0x00,0x3a,0xff,0xff,0x97,0x00,0x1a,0xff,0xff,0x9e,0x00,0x00,0x00,0x00,0x25,0xff,0xff,0x90,0x00,0x38,0xff,0xff,0x8c,0x00,0x00,0x00,0x00,0x00,0x64,0xff,0xff,0x52,0x00,0x96,0xff,0xff,0x33,0x00,0x00,0x00,0x00,0x00,0xc9,0xff,0xf0,0x00,0x00,0x00,0x14,0xf4,0xff,0x99,0x04,0xe2,0xff,0x7a,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xd6,0xfb,0x55,0x13,0x1b,0x06,0x04,0x32,0x02,0xdc,0xff,0xf5,0x09,0x00,0x00,0x12,0xed,0xff,0xc0,0x02,0x00,0x00,0x02,0x81,0x71,0x01,0x00,0x00,0x00,0x9e,0xff,0xed,0x0a,0x00,0x00,0x00,0x75,0xff,0xff,0x59,0x00,0x00,0x00,0x00,0x00,0x28,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0xa5,0xfc,0xfa,0x46,0x00,0x9a,0xfc,0xfd,0x86,0x00,0x00,0x00,0x00,0x2a,0xfb,0xff,0xd4,0x00,0x55,0xfb,0xff,0x9c,0x00,0x00,0x00,0x00,0x08,0xe8,0xff,0xf8,0x0e,0x39,0xff,0xff,0xbf,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0xff,0x3b,0x00,0x61,0xff,0xff,0x6c,0x00,0x00,0x00,0xbe,0xff,0xf5,0x03,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0xb8,0x00,0x12,0xff,0xff,0xc2,0x00,0x00,0x00,0x00,0x64,0xff,0xff,0x90,0x00,0x16,0xfd,0xff,0xcd,0x01,0x00,0x00,0x00,0x00,0xa8,0xff,0xff,0x51,0x00,0x66,0xff,0xff,0x82,0x00,0x00,0x00,0x00,0x19,0xfb,0xff,0xf1,0x00,0x00,0x00,0x00,0x9c,0xff,0xee,0x4f,0xff,0xf8,0x19,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xa3,0xfa,0x8a,0x05,0x1d,0x01,0x04,0x02,0x00,0xa3,0xff,0xff,0x42,0x00,0x00,0x00,0xa9,0xff,0xff,0x85,0x00,0x07,0x27,0x76,0x67,0x43,0x0d,0x00,0x5a,0xfd,0xff,0xc1,0x00,0x00,0x00,0x00,0xaf,0xff,0xfe,0x2d,0x00,0x00,0x00,0x00,0x01,0xbb,0xf4,0x96,0x28,0x00,0x00,0x00,0x24,0xe1,0xfd,0xec,0x18,0x00,0x99,0xfb,0xfc,0xf4,0x52,0x01,0x00,0x1d,0xcd,0xfc,0xfd,0x7c,0x00,0x11,0xe7,0xfd,0xf7,0x59,0x01,0x00,0x0a,0x95,0xff,0xff,0xa8,0x00,0x01,0xd0,0xff,0xff,0x83,0x05,0x00,0x04,0x80,0xff,0xff,0xd8,0x03,0x00,0x61,0xff,0xff,0x6c,0x00,0x00,0x00,0xbf,0xff,0xf5,0x03,0x00,0x00,0x00,0x00,0x09,0x9e,0xff,0xff,0x9a,0x00,0x03,0xe7,0xff,0xfb,0x4e,0x00,0x00,0x38,0xe8,0xff,0xff,0x8f,0x00,0x00,0xbf,0xff,0xff,0x7b,0x02,0x00,0x01,0x62,0xfe,0xff,0xff,0x52,0x00,0x19,0xf6,0xff,0xf6,0x41,0x00,0x00,0x0e,0xb4,0xff,0xff,0xf2,0x00,0x00,0x00,0x00,0x2b,0xfd,0xff,0xf2,0xff,0xa7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x59,0xf5,0xb2,0x01,0x06,0x00,0x00,0x00,0x00,0x5b,0xff,0xff,0x8f,0x00,0x00,0x17,0xf1,0xff,0xff,0xff,0xa2,0x25,0x71,0x60,0x44,0x62,0x12,0x73,0xfb,0xff,0xff,0xfc,0x2f,0x00,0x00,0x0d,0xf2,0xff,0xea,0x03,0x00,0x00,0x00,0x00,0x2f,0xfb,0xfb,0xfc,0xfa,0xde,0xb1,0xc4,0xf6,0xfb,0xfc,0xa1,0x00,0x00,0x99,0xfb,0xfc,0xfa,0xf8,0xcf,0xbb,0xf1,0xfa,0xfb,0xdd,0x12,0x00,0x00,0x5f,0xfa,0xfc,0xfa,0xc7,0xa3,0xde,0xee,0xff,0xed,0x21,0x00,0x00,0x3a,0xf7,0xff,0xff,0xe5,0xc5,0xe7,0xff,0xff,0xfb,0x42,0x00,0x00,0x62,0xff,0xff,0x6d,0x00,0x00,0x00,0xbf,0xff,0xfe,0xcf,0xca,0xca,0xca,0xcc,0xef,0xff,0xff,0xfc,0x36,0x00,0x00,0x94,0xff,0xff,0xfd,0xd1,0xcc,0xfc,0xf6,0xfe,0xff,0x8f,0x00,0x00,0x3a,0xfa,0xff,0xff,0xd2,0xa5,0xce,0xfe,0xf4,0xff,0xff,0x52,0x00,0x00,0x7d,0xff,0xff,0xfb,0xc1,0xaa,0xe7,0xff,0xf5,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0xba,0xff,0xff,0xff,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x18,0xe2,0xda,0x17,0x01,0x00,0x00,0x00,0x00,0x11,0xf7,0xff,0xeb,0x0a,0x00,0x82,0xff,0xff,0xff,0xff,0xff,0xf5,0xc0,0x9a,0x9b,0xac,0xe4,0xff,0xff,0xff,0xff,0xff,0x9a,0x00,0x00,0x63,0xff,0xff,0x9d,0x00,0x00,0x00,0x00,0x00,0x01,0x59,0xd4,0xfd,0xfe,0xfe,0xfd,0xfc,0xfb,0xfc,0xaf,0x0c,0x00,0x00,0x9a,0xfc,0xfc,0x6d,0xe5,0xfb,0xfb,0xfb,0xfb,0xdd,0x2e,0x00,0x00,0x00,0x00,0x63,0xeb,0xfb,0xfb,0xfa,0xf8,0xf7,0xda,0x32,0x00,0x00,0x00,0x00,0x43,0xe6,0xff,0xff,0xff,0xff,0xff,0xe9,0x4e,0x00,0x00,0x00,0x62,0xff,0xff,0x6d,0x00,0x00,0x00,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdd,0x51,0x00,0x00,0x00,0x11,0xd2,0xff,0xff,0xff,0xff,0xee,0x43,0xf6,0xff,0x91,0x00,0x00,0x00,0x5a,0xf3,0xff,0xff,0xff,0xff,0xd2,0x51,0xff,0xff,0x52,0x00,0x00,0x03,0x8f,0xfb,0xff,0xff,0xff,0xfe,0x8b,0xa2,0xff,0xf2,0x00,0x00,0x00,0x00,0x00,0x59,0xff,0xff,0xd3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x8a,0xe1,0x67,0x00,0x00,0x01,0x03,0x07,0x00,0xa9,0xff,0xff,0x6c,0x00,0x21,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe6,0x21,0x00,0x07,0xdf,0xff,0xfe,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x38,0x76,0x9d,0xb4,0xac,0x86,0x3f,0x01,0x00,0x00,0x00,0x9b,0xfc,0xfb,0x30,0x1a,0x79,0xab,0xa2,0x66,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x69,0x9c,0xae,0x89,0x4b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x64,0xa0,0xbf,0xa5,0x68,0x0e,0x00,0x00,0x00,0x00,0x2b,0x74,0x74,0x30,0x00,0x00,0x00,0x4c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6b,0x65,0x39,0x04,0x00,0x00,0x00,0x00,0x00,0x0b,0x68,0x9e,0xa8,0x76,0x16,0x01,0x67,0x70,0x3c,0x00,0x00,0x00,0x00,0x1a,0x74,0xa4,0xa2,0x64,0x08,0x18,0x70,0x6f,0x21,0x00,0x00,0x00,0x00,0x2f,0x85,0xaa,0x8f,0x3c,0x00,0x41,0x6c,0x65,0x00,0x00,0x00,0x00,0x00,0x27,0xff,0xff,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xed,0xd6,0x14,0x00,0x06,0x05,0x2e,0x00,0x3e,0xfe,0xff,0xe8,0x10,0x00,0x39,0xf5,0xb5,0x41,0x7b,0xe9,0xff,0xff,0xff,0xff,0xdd,0x61,0x19,0x9a,0xf1,0x36,0x00,0x00,0x78,0xff,0xff,0xbe,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9c,0xfc,0xfb,0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x04,0x04,0xa6,0xff,0xf3,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xa8,0xf0,0x8d,0x01,0x00,0x25,0x20,0x0b,0x02,0xbe,0xff,0xff,0xa2,0x00,0x00,0x14,0x01,0x00,0x00,0x3e,0xff,0xff,0xff,0xfe,0x31,0x00,0x00,0x00,0x0f,0x00,0x00,0x2f,0xf5,0xff,0xfe,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9b,0xfb,0xf9,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xf0,0xeb,0xe6,0xff,0xff,0x8a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xe4,0xea,0x52,0x01,0x0c,0x1d,0x07,0x0e,0x32,0xfb,0xff,0xff,0x72,0x00,0x00,0x00,0x00,0x00,0x04,0xe8,0xff,0xff,0xea,0x03,0x00,0x00,0x00,0x00,0x00,0x15,0xdc,0xff,0xff,0xa4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9b,0xfb,0xf7,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0xfe,0xff,0xff,0xff,0xbf,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xe9,0xdb,0x29,0x08,0x4b,0x8a,0xaa,0x49,0x81,0xff,0xff,0xfd,0x75,0x00,0x00,0x00,0x00,0x00,0x57,0x92,0x8f,0x5d,0x00,0x00,0x00,0x00,0x00,0x19,0xcb,0xff,0xff,0xdd,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4b,0x3b,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x69,0x73,0x46,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x8b,0xf2,0xd7,0x2f,0x2b,0xb4,0xea,0xd2,0x1b,0xb0,0xff,0xff,0xff,0xa1,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0xe4,0xff,0xff,0xf0,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x92,0xef,0xd6,0x59,0x11,0x68,0xbc,0x6b,0x0f,0xb9,0xff,0xff,0xff,0xe3,0x63,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xaf,0xfe,0xff,0xff,0xf0,0x3d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x78,0xee,0xf3,0xa9,0x27,0x06,0x0f,0x06,0x07,0x9e,0xff,0xff,0xff,0xff,0xf2,0xb3,0x7c,0x61,0x5f,0x6a,0x92,0xd2,0xfe,0xff,0xff,0xff,0xd9,0x2c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0xd7,0xf8,0xf0,0xa3,0x50,0x1d,0x05,0x05,0x61,0xed,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x93,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x73,0xdc,0xf7,0xed,0xe0,0xd9,0xcb,0x75,0x1b,0x82,0xe8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0xa1,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x46,0x85,0xbf,0xdf,0xe5,0xe0,0x87,0x02,0x05,0x40,0x7f,0xab,0xc6,0xc7,0xb4,0x8e,0x55,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 
 };
 
 const lv_image_dsc_t img_spoolbuddy_logo_light = {
   .header = {
     .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_ARGB8888,
+    .cf = LV_COLOR_FORMAT_RGB565A8,
     .flags = 0,
     .w = 180,
     .h = 45,
-    .stride = 720,
+    .stride = 360,
     .reserved_2 = 0,
   },
   .data_size = sizeof(img_spoolbuddy_logo_light_map),
@@ -7,15 +7,25 @@
 #include "display_driver.h"
 #include "lvgl.h"
 #include "ui.h"  // EEZ generated UI
+#include "ui_internal.h"  // pendingScreen, for the render benchmark
+#include "ui_async.h"     // UI_RENDER_TASK_PRIO
 
 #include <string.h>
+#include "esp_attr.h"
+#include "esp_async_memcpy.h"
+#include "esp_cache.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_rgb.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "nvs.h"
 #include "driver/gpio.h"
-#include "driver/i2c.h"
+#include "hal/i2c_types.h"
+#include "i2c_bus.h"
 #include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
 
 static const char *TAG = "display";
@@ -52,8 +62,34 @@ static const char *TAG = "display";
 #define TOUCH_I2C_PORT      I2C_NUM_0
 #define TOUCH_I2C_SDA       15
 #define TOUCH_I2C_SCL       16
+// Standard mode: the legacy driver clocks every device at the bus speed, and
+// the STC8H backlight controller and the Pico NFC bridge haven't been
+// verified at 400 kHz (only the GT911 is specified for fast mode)
+#ifndef TOUCH_I2C_FREQ_HZ
+#define TOUCH_I2C_FREQ_HZ   100000
+#endif
+#define CONTROL_I2C_FREQ_HZ 100000
+// GT911 device clock - only applied with CONFIG_I2C_BUS_DRIVER_NG (per-device
+// clocks). With the default legacy driver the GT911 runs at TOUCH_I2C_FREQ_HZ.
+#define GT911_I2C_FREQ_HZ   400000
 #define GT911_ADDR          0x5D
 
+// GT911 INT line. The CrowPanel Advance routes it through the STC8H, so it
+// is not wired to the ESP32 by default (-1): the touch task then polls the
+// status register at TOUCH_POLL_MS. Set to the GPIO on boards that wire it.
+#ifndef TOUCH_INT_PIN
+#define TOUCH_INT_PIN       -1
+#endif
+#define TOUCH_POLL_MS       10      // Poll period without INT, and while a finger is down
+#define TOUCH_STALE_MS      50      // Report release after bus errors for this long
+#define TOUCH_TASK_STACK    3072
+#define TOUCH_TASK_PRIO     5
+
+// GT911 registers
+#define GT911_REG_STATUS    0x814E  // bit7 = buffer ready, bits 0-3 = point count
+#define GT911_REG_POINTS    0x814F  // First point, GT911_POINT_SIZE bytes each
+#define GT911_POINT_SIZE    8       // track id, x(2), y(2), size(2), reserved
+
 // Backlight control - CrowPanel uses GPIO1 and GPIO2
 #define PIN_BACKLIGHT1      1
 #define PIN_BACKLIGHT2      2
@@ -64,20 +100,263 @@ static esp_lcd_panel_handle_t panel_handle = NULL;
 // LVGL display
 static lv_display_t *display = NULL;
 
-// Draw buffers (in internal SRAM for reliability)
+// Render mode selection
+// 0 = partial: LVGL renders 40-line bands in SRAM, flush_cb copies them into
+//     the single PSRAM framebuffer (default, lowest PSRAM bandwidth)
+// 1 = direct: LVGL renders straight into two PSRAM panel framebuffers and
+//     flush_cb swaps them on VSYNC (no tearing, no CPU copy pass)
+#ifndef DISPLAY_DIRECT_MODE
+#define DISPLAY_DIRECT_MODE 0
+#endif
+
+#if DISPLAY_DIRECT_MODE
+// Double-buffered panel framebuffers (allocated by the RGB driver in PSRAM)
+#define DISPLAY_NUM_FBS     2
+#define VSYNC_TIMEOUT_MS    100  // ~3 frames at 14MHz pclk (~29Hz refresh)
+static void *panel_fbs[DISPLAY_NUM_FBS] = {NULL, NULL};
+static SemaphoreHandle_t vsync_sem = NULL;
+static int vsync_timeouts = 0;
+#else
+// Draw buffers (internal SRAM by default, see buf_cfg)
 // For RGB565, each pixel is 2 bytes. LVGL 9.x uses byte buffers.
-#define DRAW_BUF_LINES  40
-static uint8_t draw_buf1[DISPLAY_WIDTH * DRAW_BUF_LINES * 2];  // RGB565 = 2 bytes/pixel
-static uint8_t draw_buf2[DISPLAY_WIDTH * DRAW_BUF_LINES * 2];  // RGB565 = 2 bytes/pixel
-
-// Touch state
+// 64-byte aligned so GDMA can read them directly.
+#define DISPLAY_NUM_FBS     1
+static uint8_t *draw_buf1 = NULL;
+static uint8_t *draw_buf2 = NULL;
+
+// Async flush: full-width bands are copied to the PSRAM framebuffer by the
+// GDMA async memcpy engine, so LVGL renders into the other draw buffer while
+// the copy runs. Narrower areas are not contiguous in the framebuffer and
+// still use the CPU row copy.
+#ifndef DISPLAY_ASYNC_FLUSH
+#define DISPLAY_ASYNC_FLUSH 1
+#endif
+#endif
+
+// Buffer geometry defaults - overridden by the autotune result stored in NVS
+#define DRAW_BUF_LINES      40      // LVGL band height (partial mode)
+#define BOUNCE_BUF_LINES    10      // RGB panel bounce buffer height
+#define DISPLAY_NVS_NAMESPACE   "display"
+#define BUF_CFG_NVS_KEY         "buf_cfg"
+#define BUF_CFG_NVS_VERSION     1
+
+#ifndef DISPLAY_AUTOTUNE
+#define DISPLAY_AUTOTUNE 0      // 1 = calibrate once after boot if NVS has no result
+#endif
+#define AUTOTUNE_FRAMES     10  // Full redraws per reference screen per candidate
+
+static display_buf_config_t buf_cfg = {
+    .band_lines = DRAW_BUF_LINES,
+    .bounce_lines = BOUNCE_BUF_LINES,
+    .bands_in_psram = false,
+};
+static bool buf_cfg_from_nvs = false;
+
+// Bounce buffer refill tracking. The RGB driver refills its bounce buffers
+// from the PSRAM framebuffer in an ISR and reports when the last one of a
+// frame is filled. A VSYNC without a finished refill since the previous one
+// means PSRAM couldn't keep up with scanout (visible as shifted/torn lines).
+static volatile uint32_t panel_vsyncs = 0;
+static volatile uint32_t panel_underruns = 0;
+static volatile bool bounce_frame_done = false;
+
+#if !DISPLAY_DIRECT_MODE && DISPLAY_ASYNC_FLUSH
+static async_memcpy_handle_t async_mcp = NULL;
+
+// In-flight DMA band (LVGL waits for flush_ready before reusing a buffer,
+// so at most one copy is ever pending)
+typedef struct {
+    lv_display_t *disp;
+    void *dst;
+    size_t size;
+    int64_t start_us;
+    volatile int64_t done_us;
+    bool pending;
+    bool synced;    // Destination band invalidated after the copy finished
+} async_flush_ctx_t;
+static async_flush_ctx_t async_ctx;
+#endif
+
+// Flush statistics (see display_get_flush_stats). copy_us is also added to
+// from the GDMA ISR, so the 64-bit counters are updated and read under
+// flush_stats_lock
+static display_flush_stats_t flush_stats;
+static portMUX_TYPE flush_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t last_flush_exit_us = 0;
+static bool last_flush_was_last = true;
+
+// Touch state - written by touch_task, read by touch_read_cb and
+// display_get_touch_points under touch_lock
+static portMUX_TYPE touch_lock = portMUX_INITIALIZER_UNLOCKED;
+static display_touch_point_t touch_points[DISPLAY_TOUCH_MAX_POINTS];
+static uint8_t touch_point_count = 0;
 static bool touch_pressed = false;
 static int16_t touch_x = 0;
 static int16_t touch_y = 0;
+static TaskHandle_t touch_task_handle = NULL;
 
 // Tick timer
 static uint32_t tick_start = 0;
 
+// Boot timeline - display_init phases up to the first frame on the panel
+#define BOOT_MAX_PHASES     12
+typedef struct {
+    const char *name;
+    int64_t us;             // esp_timer time (since power-on)
+} boot_phase_t;
+static boot_phase_t boot_phases[BOOT_MAX_PHASES];
+static int boot_phase_count = 0;
+static portMUX_TYPE boot_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool boot_first_frame = false;
+static int64_t boot_first_frame_us = 0;
+static bool boot_timeline_logged = false;
+static void boot_phase(const char *name);
+
+// I2C bring-up runs in its own task, overlapping panel and LVGL init. The
+// device map is cached in NVS so later boots skip the bus scan and the NFC
+// bridge diagnostics.
+#ifndef DISPLAY_BOOT_DIAGNOSTICS
+#define DISPLAY_BOOT_DIAGNOSTICS 0  // 1 = always scan the bus and test the NFC bridge
+#endif
+#define BACKLIGHT_SETTLE_MS     200
+#define I2C_BOOT_TASK_STACK     4096
+#define I2C_BOOT_TASK_PRIO      5
+#define I2C_BOOT_TIMEOUT_MS     3000
+#define BACKLIGHT_I2C_ADDR      0x30    // STC8H1K28 backlight controller
+#define NFC_BRIDGE_I2C_ADDR     0x55    // Pico NFC bridge
+#define I2C_MAP_NVS_KEY         "i2c_map"
+#define I2C_MAP_VERSION         1
+
+typedef struct {
+    uint8_t version;
+    uint8_t present[16];    // One bit per 7-bit address
+} i2c_map_t;
+static i2c_map_t i2c_map;
+static bool i2c_map_cached = false;
+static SemaphoreHandle_t i2c_boot_done = NULL;
+// Set under boot_lock: i2c_boot_finished by the boot task, touch_start_deferred
+// by display_init when it stops waiting - the boot task then starts touch
+static bool i2c_boot_finished = false;
+static bool touch_start_deferred = false;
+
+// I2C0 devices - all transfers go through the shared bus manager so touch
+// reads never wait behind a backlight write or the boot-time NFC bridge
+// probe (runtime NFC traffic is on I2C1, outside the manager)
+#define GT911_I2C_TIMEOUT_MS    10
+#define CONTROL_I2C_TIMEOUT_MS  100
+static i2c_bus_dev_t gt911_dev = NULL;
+static i2c_bus_dev_t backlight_dev = NULL;
+static i2c_bus_dev_t nfc_dev = NULL;
+
+// Render task - owns LVGL once started. Core 0 runs WiFi and the Rust main
+// loop (NFC, scale, backend polling), so LVGL gets core 1 to itself.
+// With DISPLAY_DRAW_UNITS > 1 (lv_conf.h) LVGL's draw threads are unpinned,
+// so the second draw unit rasterizes on whichever core is idle.
+#define RENDER_TASK_CORE    1
+#define RENDER_TASK_PRIO    UI_RENDER_TASK_PRIO    // ui_async workers run below it
+#define RENDER_TASK_STACK   8192
+#define RENDER_PERIOD_MS    LV_DEF_REFR_PERIOD
+#define UI_QUEUE_LEN        16
+#define RENDER_STOP_TIMEOUT_MS  500     // display_shutdown() waits this long for the task
+
+// Render benchmark - times full-screen redraws of the main screens. Build once
+// with DISPLAY_DRAW_UNITS 1 and once with 2 (lv_conf.h) to compare.
+#ifndef DISPLAY_RENDER_BENCHMARK
+#define DISPLAY_RENDER_BENCHMARK 0      // 1 = run once from the render task after boot
+#endif
+#define RENDER_BENCH_DELAY_MS   10000   // Let the splash screen and first backend poll finish
+#define RENDER_BENCH_FRAMES     20
+
+// Idle mode - entered from the render task after the screen timeout passes
+// without touch input. LVGL stops rendering; ui_tick and posted UI commands
+// keep the data model current so the first frame after wake is up to date.
+#define DISPLAY_PCLK_HZ         14000000
+#define IDLE_BACKLIGHT_PERCENT  0           // 0 = off, or e.g. 10 to dim instead
+#define IDLE_POLL_MS            500         // Data-model update period while idle
+#ifndef DISPLAY_IDLE_PCLK_HZ
+#define DISPLAY_IDLE_PCLK_HZ    4000000     // 0 = keep the normal pixel clock
+#endif
+
+static volatile uint32_t idle_timeout_ms = 0;   // 0 = never
+static volatile bool display_idle = false;
+static volatile bool activity_pending = false;  // display_wake() from another task
+static SemaphoreHandle_t wake_sem = NULL;
+static uint8_t backlight_percent = 100;         // User level, restored on wake
+static bool touch_wake_suppress = false;        // Swallow the waking touch until release
+
+typedef struct {
+    display_ui_cb_t cb;
+    void *arg;
+} ui_cmd_t;
+
+static SemaphoreHandle_t lvgl_mutex = NULL;   // Recursive - posted callbacks may lock again
+static QueueHandle_t ui_queue = NULL;
+static TaskHandle_t render_task_handle = NULL;
+static volatile bool render_stop = false;       // display_shutdown(): exit between frames
+static TaskHandle_t render_stop_waiter = NULL;  // Notified when the task has exited
+static display_render_stats_t render_stats;
+
+#if !DISPLAY_DIRECT_MODE && DISPLAY_ASYNC_FLUSH
+// A flush call within this window after the DMA finished means LVGL was
+// spinning on the copy instead of rendering
+#define FLUSH_STALL_THRESHOLD_US  100
+
+/**
+ * GDMA async memcpy completion callback (ISR context)
+ * Releases the draw buffer back to LVGL
+ */
+static bool IRAM_ATTR async_flush_done_cb(async_memcpy_handle_t mcp, async_memcpy_event_t *event, void *cb_args)
+{
+    async_flush_ctx_t *ctx = (async_flush_ctx_t *)cb_args;
+
+    // The cache invalidate for this band is left to sync_flushed_band(),
+    // which runs in task context
+    ctx->done_us = esp_timer_get_time();
+    taskENTER_CRITICAL_ISR(&flush_stats_lock);
+    flush_stats.copy_us += (uint64_t)(ctx->done_us - ctx->start_us);
+    taskEXIT_CRITICAL_ISR(&flush_stats_lock);
+
+    lv_display_flush_ready(ctx->disp);
+    return false;
+}
+
+/**
+ * Drop cached lines of the last DMA'd band (task context)
+ * The bounce buffer ISR reads the framebuffer through the cache and may have
+ * pulled stale lines of the band in while the DMA was running. Called before
+ * the next band is started and after every lv_timer_handler() pass, so the
+ * last band of a frame is not left stale until the next refresh.
+ */
+static void sync_flushed_band(void)
+{
+    if (!async_ctx.pending || async_ctx.synced || async_ctx.done_us < async_ctx.start_us) {
+        return;
+    }
+    esp_cache_msync(async_ctx.dst, async_ctx.size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+    async_ctx.synced = true;
+}
+
+/**
+ * Install the GDMA async memcpy engine for band copies
+ * Falls back to CPU copies if no DMA channel is available
+ */
+static void init_async_flush(void)
+{
+    async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+    config.backlog = 4;
+    config.sram_trans_align = 4;
+    config.psram_trans_align = 64;  // Must match the panel's psram_trans_align
+
+    esp_err_t err = esp_async_memcpy_install(&config, &async_mcp);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Async memcpy install failed: %d (using CPU copy)", err);
+        async_mcp = NULL;
+        return;
+    }
+    ESP_LOGI(TAG, "Async GDMA flush enabled");
+}
+#endif
+
 /**
  * LVGL flush callback - copies rendered pixels to display
  */
@@ -98,11 +377,74 @@ static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
     }
 
     if (panel_handle == NULL) {
-        ESP_LOGE(TAG, "flush_cb: panel_handle is NULL!");
+        // No panel (init or an autotune restore failed) - drop the frame
+        static bool logged = false;
+        if (!logged) {
+            ESP_LOGE(TAG, "flush_cb: panel_handle is NULL, not flushing");
+            logged = true;
+        }
         lv_display_flush_ready(disp);
         return;
     }
 
+    if (!boot_first_frame && lv_display_flush_is_last(disp)) {
+        boot_first_frame = true;
+        boot_first_frame_us = esp_timer_get_time();
+        boot_phase("first frame");
+    }
+
+#if DISPLAY_DIRECT_MODE
+    // px_map is one of the panel framebuffers and already holds the whole frame.
+    // Only the last flush of a refresh cycle swaps buffers. LVGL itself copies
+    // this frame's dirty areas into the other buffer before rendering the next
+    // frame (direct mode area sync), so no full-frame copy is needed here.
+    if (lv_display_flush_is_last(disp)) {
+        // Drop a VSYNC that fired before the swap was queued
+        xSemaphoreTake(vsync_sem, 0);
+
+        // Passing a panel framebuffer makes the RGB driver switch to it
+        // at the next frame instead of copying
+        esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, px_map);
+
+        // Block until the panel scans out the new buffer so LVGL never draws
+        // into the buffer that is currently on screen
+        if (xSemaphoreTake(vsync_sem, pdMS_TO_TICKS(VSYNC_TIMEOUT_MS)) != pdTRUE) {
+            vsync_timeouts++;
+            if (vsync_timeouts <= 5) {
+                ESP_LOGW(TAG, "flush_cb: VSYNC timeout (%d)", vsync_timeouts);
+            }
+        }
+    }
+
+    lv_display_flush_ready(disp);
+    return;
+#endif
+
+    // Account the time LVGL spent rendering since the previous band of
+    // this frame (includes any stall waiting for that band's copy)
+    int64_t entry_us = esp_timer_get_time();
+    taskENTER_CRITICAL(&flush_stats_lock);
+    flush_stats.flushes++;
+    if (!last_flush_was_last && last_flush_exit_us != 0) {
+        flush_stats.render_us += (uint64_t)(entry_us - last_flush_exit_us);
+    }
+    taskEXIT_CRITICAL(&flush_stats_lock);
+    last_flush_was_last = lv_display_flush_is_last(disp);
+
+#if DISPLAY_ASYNC_FLUSH
+    // LVGL only calls us once the previous DMA has signalled flush_ready. If
+    // that happened just before this call, LVGL was blocked on the copy.
+    if (async_ctx.pending) {
+        sync_flushed_band();
+        async_ctx.pending = false;
+        if (entry_us - async_ctx.done_us < FLUSH_STALL_THRESHOLD_US) {
+            taskENTER_CRITICAL(&flush_stats_lock);
+            flush_stats.dma_stalls++;
+            taskEXIT_CRITICAL(&flush_stats_lock);
+        }
+    }
+#endif
+
     // Get the panel's framebuffer
     void *fb = NULL;
     esp_lcd_rgb_panel_get_frame_buffer(panel_handle, 1, &fb);
@@ -123,11 +465,49 @@ static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
     int width = area->x2 - area->x1 + 1;
     int height = area->y2 - area->y1 + 1;
 
+#if DISPLAY_ASYNC_FLUSH
+    // Full-width bands are one contiguous block in the framebuffer
+    if (async_mcp != NULL && width == DISPLAY_WIDTH) {
+        async_ctx.disp = disp;
+        async_ctx.dst = fb16 + area->y1 * DISPLAY_WIDTH;
+        async_ctx.size = (size_t)width * height * sizeof(uint16_t);
+
+        // Write back any CPU-dirty lines so they can't overwrite the DMA data later
+        esp_cache_msync(async_ctx.dst, async_ctx.size,
+                        ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_INVALIDATE);
+
+        // Bands rendered into PSRAM may still sit in the cache
+        if (buf_cfg.bands_in_psram) {
+            esp_cache_msync(px_map, async_ctx.size, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+        }
+
+        async_ctx.start_us = esp_timer_get_time();
+        async_ctx.synced = false;
+        async_ctx.pending = true;
+        if (esp_async_memcpy(async_mcp, async_ctx.dst, px_map, async_ctx.size,
+                             async_flush_done_cb, &async_ctx) == ESP_OK) {
+            taskENTER_CRITICAL(&flush_stats_lock);
+            flush_stats.dma_flushes++;
+            taskEXIT_CRITICAL(&flush_stats_lock);
+            if (flush_count <= 5) {
+                ESP_LOGI(TAG, "flush_cb #%d: DMA started, %d rows (%u bytes)",
+                         flush_count, height, (unsigned)async_ctx.size);
+            }
+            // lv_display_flush_ready() is called from async_flush_done_cb
+            last_flush_exit_us = esp_timer_get_time();
+            return;
+        }
+        async_ctx.pending = false;
+        ESP_LOGW(TAG, "flush_cb: async memcpy failed, falling back to CPU copy");
+    }
+#endif
+
     if (flush_count <= 5) {
         ESP_LOGI(TAG, "flush_cb #%d: copying %d rows, width=%d, src=%p",
                  flush_count, height, width, src);
     }
 
+    int64_t copy_start_us = esp_timer_get_time();
     for (int y = area->y1; y <= area->y2; y++) {
         uint16_t *dst_row = fb16 + y * DISPLAY_WIDTH + area->x1;
         memcpy(dst_row, src, width * sizeof(uint16_t));
@@ -138,12 +518,18 @@ static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
             ESP_LOGI(TAG, "flush_cb #%d: row %d done", flush_count, y);
         }
     }
+    int64_t copy_us = esp_timer_get_time() - copy_start_us;
+    taskENTER_CRITICAL(&flush_stats_lock);
+    flush_stats.cpu_flushes++;
+    flush_stats.copy_us += (uint64_t)copy_us;
+    taskEXIT_CRITICAL(&flush_stats_lock);
 
     if (flush_count <= 5) {
         ESP_LOGI(TAG, "flush_cb #%d: memcpy done, calling flush_ready", flush_count);
     }
 
     lv_display_flush_ready(disp);
+    last_flush_exit_us = esp_timer_get_time();
 
     if (flush_count <= 5) {
         ESP_LOGI(TAG, "flush_cb #%d: flush_ready returned", flush_count);
@@ -151,83 +537,266 @@ static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
 }
 
 /**
- * Read GT911 touch data
+ * RGB panel VSYNC callback (ISR context)
+ * Counts bounce buffer underruns; in direct mode also signals flush_cb that
+ * the queued framebuffer swap has taken effect
+ */
+static bool IRAM_ATTR on_vsync_cb(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx)
+{
+    panel_vsyncs++;
+    if (!bounce_frame_done && panel_vsyncs > 1) {
+        panel_underruns++;
+    }
+    bounce_frame_done = false;
+
+#if DISPLAY_DIRECT_MODE
+    BaseType_t need_yield = pdFALSE;
+    xSemaphoreGiveFromISR(vsync_sem, &need_yield);
+    return need_yield == pdTRUE;
+#else
+    return false;
+#endif
+}
+
+/**
+ * RGB panel bounce buffer frame-finished callback (ISR context)
  */
-static bool read_gt911_touch(int16_t *x, int16_t *y)
+static bool IRAM_ATTR on_bounce_frame_finish_cb(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx)
 {
-    uint8_t buf[7];
-    uint8_t reg_addr[2] = {0x81, 0x4E};  // Touch status register
+    bounce_frame_done = true;
+    return false;
+}
 
-    // Write register address
-    if (i2c_master_write_to_device(TOUCH_I2C_PORT, GT911_ADDR, reg_addr, 2, 10) != ESP_OK) {
-        return false;
+/**
+ * Read GT911 touch points
+ * Reads the status byte, and the point block only when the controller has
+ * new points - an idle poll is a 1-byte read.
+ *
+ * @return number of points (0 = released), -1 if no new data, -2 on bus error
+ */
+static int read_gt911_points(display_touch_point_t *points)
+{
+    uint8_t buf[DISPLAY_TOUCH_MAX_POINTS * GT911_POINT_SIZE];
+    uint8_t status_reg[2] = {GT911_REG_STATUS >> 8, GT911_REG_STATUS & 0xFF};
+    uint8_t status;
+
+    // Status byte only - this is all the bus sees while nothing is touched
+    if (i2c_bus_write_read(gt911_dev, status_reg, 2, &status, 1,
+                           GT911_I2C_TIMEOUT_MS) != ESP_OK) {
+        return -2;
     }
 
-    // Read touch data
-    if (i2c_master_read_from_device(TOUCH_I2C_PORT, GT911_ADDR, buf, 7, 10) != ESP_OK) {
-        return false;
+    // Buffer not ready - controller has nothing new for us
+    if ((status & 0x80) == 0) {
+        return -1;
     }
 
-    // Check if touch is valid
-    uint8_t status = buf[0];
-    if ((status & 0x80) == 0 || (status & 0x0F) == 0) {
-        // Clear status flag
-        uint8_t clear[3] = {0x81, 0x4E, 0x00};
-        i2c_master_write_to_device(TOUCH_I2C_PORT, GT911_ADDR, clear, 3, 10);
-        return false;
+    int count = status & 0x0F;
+    if (count > DISPLAY_TOUCH_MAX_POINTS) {
+        count = DISPLAY_TOUCH_MAX_POINTS;
+    }
+
+    // Point block only when there are points (count 0 = finger lifted)
+    if (count > 0) {
+        uint8_t points_reg[2] = {GT911_REG_POINTS >> 8, GT911_REG_POINTS & 0xFF};
+        if (i2c_bus_write_read(gt911_dev, points_reg, 2, buf, count * GT911_POINT_SIZE,
+                               GT911_I2C_TIMEOUT_MS) != ESP_OK) {
+            return -2;
+        }
     }
 
-    // Extract coordinates (little endian)
-    *x = buf[2] | (buf[3] << 8);
-    *y = buf[4] | (buf[5] << 8);
+    for (int i = 0; i < count; i++) {
+        const uint8_t *p = &buf[i * GT911_POINT_SIZE];
+        int16_t x = p[1] | (p[2] << 8);  // little endian
+        int16_t y = p[3] | (p[4] << 8);
+
+        // Bounds check
+        if (x >= DISPLAY_WIDTH) x = DISPLAY_WIDTH - 1;
+        if (y >= DISPLAY_HEIGHT) y = DISPLAY_HEIGHT - 1;
 
-    // Bounds check
-    if (*x >= DISPLAY_WIDTH) *x = DISPLAY_WIDTH - 1;
-    if (*y >= DISPLAY_HEIGHT) *y = DISPLAY_HEIGHT - 1;
+        points[i].id = p[0];
+        points[i].x = x;
+        points[i].y = y;
+    }
 
-    // Clear status flag
-    uint8_t clear[3] = {0x81, 0x4E, 0x00};
-    i2c_master_write_to_device(TOUCH_I2C_PORT, GT911_ADDR, clear, 3, 10);
+    // Clear status flag so the controller reports the next sample
+    uint8_t clear[3] = {GT911_REG_STATUS >> 8, GT911_REG_STATUS & 0xFF, 0x00};
+    i2c_bus_write(gt911_dev, clear, 3, GT911_I2C_TIMEOUT_MS);
 
-    return true;
+    return count;
+}
+
+#if TOUCH_INT_PIN >= 0
+/**
+ * GT911 INT line ISR - wakes the touch task
+ */
+static void IRAM_ATTR touch_int_isr(void *arg)
+{
+    BaseType_t need_yield = pdFALSE;
+    vTaskNotifyGiveFromISR(touch_task_handle, &need_yield);
+    if (need_yield) {
+        portYIELD_FROM_ISR();
+    }
+}
+#endif
+
+/**
+ * Touch task - reads the GT911 off the render loop and caches the result
+ * With INT wired it sleeps until the controller signals new data; while a
+ * finger is down (or without INT) it samples every TOUCH_POLL_MS.
+ * If the bus keeps failing for TOUCH_STALE_MS while pressed, it reports a
+ * release rather than holding a press (or drag) the finger may have ended.
+ */
+static void touch_task(void *arg)
+{
+    display_touch_point_t points[DISPLAY_TOUCH_MAX_POINTS];
+    int64_t last_read_us = esp_timer_get_time();
+
+    while (1) {
+#if TOUCH_INT_PIN >= 0
+        TickType_t wait = touch_pressed ? pdMS_TO_TICKS(TOUCH_POLL_MS) : portMAX_DELAY;
+        ulTaskNotifyTake(pdTRUE, wait);
+#else
+        vTaskDelay(pdMS_TO_TICKS(TOUCH_POLL_MS));
+#endif
+
+        int count = read_gt911_points(points);
+        int64_t now_us = esp_timer_get_time();
+        if (count != -2) {
+            last_read_us = now_us;
+        } else if (touch_pressed && now_us - last_read_us >= TOUCH_STALE_MS * 1000LL) {
+            ESP_LOGW(TAG, "Touch reads failing, releasing");
+            count = 0;
+        }
+        if (count < 0) {
+            continue;
+        }
+
+        taskENTER_CRITICAL(&touch_lock);
+        memcpy(touch_points, points, count * sizeof(display_touch_point_t));
+        touch_point_count = (uint8_t)count;
+        touch_pressed = count > 0;
+        if (count > 0) {
+            touch_x = points[0].x;
+            touch_y = points[0].y;
+        }
+        taskEXIT_CRITICAL(&touch_lock);
+
+        // The render task sleeps while idle - wake it for this touch
+        if (count > 0 && display_idle && wake_sem != NULL) {
+            xSemaphoreGive(wake_sem);
+        }
+    }
 }
 
 /**
  * LVGL touch input callback
+ * Returns the state cached by touch_task - no bus traffic in the render loop
  */
 static void touch_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
 {
-    if (read_gt911_touch(&touch_x, &touch_y)) {
-        data->point.x = touch_x;
-        data->point.y = touch_y;
-        data->state = LV_INDEV_STATE_PRESSED;
-        touch_pressed = true;
-    } else {
-        data->point.x = touch_x;  // Report last known position
-        data->point.y = touch_y;
+    taskENTER_CRITICAL(&touch_lock);
+    data->point.x = touch_x;  // Last known position when released
+    data->point.y = touch_y;
+    data->state = touch_pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    taskEXIT_CRITICAL(&touch_lock);
+
+    // The touch that woke the display must not also press whatever is under it
+    if (touch_wake_suppress) {
+        if (data->state == LV_INDEV_STATE_RELEASED) {
+            touch_wake_suppress = false;
+        }
         data->state = LV_INDEV_STATE_RELEASED;
-        touch_pressed = false;
     }
 }
 
 /**
- * Initialize I2C for touch controller
+ * Get all current touch points (for multi-touch gestures)
+ */
+int display_get_touch_points(display_touch_point_t *points, int max_points)
+{
+    if (points == NULL || max_points <= 0) {
+        return 0;
+    }
+
+    taskENTER_CRITICAL(&touch_lock);
+    int count = touch_point_count < max_points ? touch_point_count : max_points;
+    memcpy(points, touch_points, count * sizeof(display_touch_point_t));
+    taskEXIT_CRITICAL(&touch_lock);
+
+    return count;
+}
+
+/**
+ * Start the touch task (and INT interrupt if wired)
+ */
+static esp_err_t init_touch_task(void)
+{
+    if (xTaskCreate(touch_task, "touch", TOUCH_TASK_STACK, NULL, TOUCH_TASK_PRIO,
+                    &touch_task_handle) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+#if TOUCH_INT_PIN >= 0
+    gpio_config_t int_conf = {
+        .pin_bit_mask = (1ULL << TOUCH_INT_PIN),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_ENABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_NEGEDGE,
+    };
+    esp_err_t err = gpio_config(&int_conf);
+    if (err != ESP_OK) return err;
+
+    err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) return err;  // Already installed is fine
+
+    err = gpio_isr_handler_add(TOUCH_INT_PIN, touch_int_isr, NULL);
+    if (err != ESP_OK) return err;
+    ESP_LOGI(TAG, "Touch task started (INT on GPIO%d)", TOUCH_INT_PIN);
+#else
+    ESP_LOGI(TAG, "Touch task started (polling every %dms)", TOUCH_POLL_MS);
+#endif
+
+    return ESP_OK;
+}
+
+/**
+ * Initialize the touch I2C bus and register the always-present devices
  */
 static esp_err_t init_touch_i2c(void)
 {
-    i2c_config_t conf = {
-        .mode = I2C_MODE_MASTER,
-        .sda_io_num = TOUCH_I2C_SDA,
-        .scl_io_num = TOUCH_I2C_SCL,
-        .sda_pullup_en = GPIO_PULLUP_ENABLE,
-        .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master.clk_speed = 100000,
+    i2c_bus_config_t conf = {
+        .port = TOUCH_I2C_PORT,
+        .sda_gpio = TOUCH_I2C_SDA,
+        .scl_gpio = TOUCH_I2C_SCL,
+        .freq_hz = TOUCH_I2C_FREQ_HZ,
     };
 
-    esp_err_t err = i2c_param_config(TOUCH_I2C_PORT, &conf);
+    esp_err_t err = i2c_bus_init(&conf);
     if (err != ESP_OK) return err;
 
-    return i2c_driver_install(TOUCH_I2C_PORT, conf.mode, 0, 0, 0);
+    gt911_dev = i2c_bus_add_device(GT911_ADDR, "gt911", I2C_BUS_PRIO_TOUCH, GT911_I2C_FREQ_HZ);
+    backlight_dev = i2c_bus_add_device(BACKLIGHT_I2C_ADDR, "backlight", I2C_BUS_PRIO_CONTROL,
+                                       CONTROL_I2C_FREQ_HZ);
+    return ESP_OK;
+}
+
+/**
+ * Start the touch task once the bus and GT911 are set up
+ * Called from display_init, or from the I2C boot task if it finished late.
+ */
+static void start_touch_task(void)
+{
+    if (gt911_dev == NULL) {
+        ESP_LOGW(TAG, "Touch I2C not initialized, touch disabled");
+        return;
+    }
+
+    esp_err_t err = init_touch_task();
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Touch task init failed: %d", err);
+    }
 }
 
 /**
@@ -237,7 +806,8 @@ static esp_err_t init_rgb_panel(void)
 {
     ESP_LOGI(TAG, "=== RGB PANEL INIT ===");
     ESP_LOGI(TAG, "Resolution: %dx%d", DISPLAY_WIDTH, DISPLAY_HEIGHT);
-    ESP_LOGI(TAG, "Pixel clock: 14MHz");
+    ESP_LOGI(TAG, "Pixel clock: 14MHz, framebuffers: %d, bounce buffer: %d lines",
+             DISPLAY_NUM_FBS, buf_cfg.bounce_lines);
     ESP_LOGI(TAG, "PCLK=%d HSYNC=%d VSYNC=%d DE=%d", PIN_PCLK, PIN_HSYNC, PIN_VSYNC, PIN_DE);
     ESP_LOGI(TAG, "B: %d,%d,%d,%d,%d", PIN_B0, PIN_B1, PIN_B2, PIN_B3, PIN_B4);
     ESP_LOGI(TAG, "G: %d,%d,%d,%d,%d,%d", PIN_G0, PIN_G1, PIN_G2, PIN_G3, PIN_G4, PIN_G5);
@@ -246,7 +816,7 @@ static esp_err_t init_rgb_panel(void)
     esp_lcd_rgb_panel_config_t panel_config = {
         .clk_src = LCD_CLK_SRC_DEFAULT,
         .timings = {
-            .pclk_hz = 14000000,  // 14MHz pixel clock (from working firmware)
+            .pclk_hz = DISPLAY_PCLK_HZ,  // 14MHz pixel clock (from working firmware)
             .h_res = DISPLAY_WIDTH,
             .v_res = DISPLAY_HEIGHT,
             .hsync_pulse_width = 48,
@@ -260,8 +830,8 @@ static esp_err_t init_rgb_panel(void)
             },
         },
         .data_width = 16,
-        .num_fbs = 1,
-        .bounce_buffer_size_px = 10 * DISPLAY_WIDTH,  // Bounce buffer for PSRAM
+        .num_fbs = DISPLAY_NUM_FBS,
+        .bounce_buffer_size_px = buf_cfg.bounce_lines * DISPLAY_WIDTH,  // Bounce buffer for PSRAM
         .psram_trans_align = 64,
         .hsync_gpio_num = PIN_HSYNC,
         .vsync_gpio_num = PIN_VSYNC,
@@ -278,18 +848,71 @@ static esp_err_t init_rgb_panel(void)
         },
     };
 
-    ESP_ERROR_CHECK(esp_lcd_new_rgb_panel(&panel_config, &panel_handle));
-    ESP_ERROR_CHECK(esp_lcd_panel_reset(panel_handle));
-    ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle));
+    // Not fatal: the autotuner may ask for a bounce buffer that doesn't fit
+    esp_err_t err = esp_lcd_new_rgb_panel(&panel_config, &panel_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "esp_lcd_new_rgb_panel failed: %d", err);
+        panel_handle = NULL;
+        return err;
+    }
+
+#if DISPLAY_DIRECT_MODE
+    // Get both framebuffers for LVGL and hook VSYNC for tear-free swaps
+    err = esp_lcd_rgb_panel_get_frame_buffer(panel_handle, DISPLAY_NUM_FBS,
+                                             &panel_fbs[0], &panel_fbs[1]);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "esp_lcd_rgb_panel_get_frame_buffer failed: %d", err);
+        goto fail;
+    }
+    ESP_LOGI(TAG, "Direct mode framebuffers: %p, %p", panel_fbs[0], panel_fbs[1]);
+
+    if (vsync_sem == NULL) {
+        vsync_sem = xSemaphoreCreateBinary();
+    }
+    if (vsync_sem == NULL) {
+        ESP_LOGE(TAG, "Failed to create VSYNC semaphore");
+        err = ESP_ERR_NO_MEM;
+        goto fail;
+    }
+#endif
+
+    // A new panel starts a new frame sequence - don't count its first VSYNC
+    panel_vsyncs = 0;
+    bounce_frame_done = false;
+
+    esp_lcd_rgb_panel_event_callbacks_t cbs = {
+        .on_vsync = on_vsync_cb,
+        .on_bounce_frame_finish = on_bounce_frame_finish_cb,
+    };
+    err = esp_lcd_rgb_panel_register_event_callbacks(panel_handle, &cbs, NULL);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "esp_lcd_rgb_panel_register_event_callbacks failed: %d", err);
+        goto fail;
+    }
+
+    err = esp_lcd_panel_reset(panel_handle);
+    if (err == ESP_OK) {
+        err = esp_lcd_panel_init(panel_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "RGB panel reset/init failed: %d", err);
+        goto fail;
+    }
 
     // Turn on display (from working firmware)
-    esp_err_t err = esp_lcd_panel_disp_on_off(panel_handle, true);
+    err = esp_lcd_panel_disp_on_off(panel_handle, true);
     if (err != ESP_OK) {
         ESP_LOGW(TAG, "esp_lcd_panel_disp_on_off failed: %d (continuing anyway)", err);
     }
 
     ESP_LOGI(TAG, "RGB panel initialized");
     return ESP_OK;
+
+fail:
+    // Callers (boot, autotune) treat a NULL panel_handle as "no panel"
+    esp_lcd_panel_del(panel_handle);
+    panel_handle = NULL;
+    return err;
 }
 
 /**
@@ -327,188 +950,1247 @@ static void init_backlight(void)
  * Uses I2C to STC8H1K28 at address 0x30
  * Called from Rust via FFI
  */
-void display_set_backlight_hw(uint8_t brightness_percent)
+static void apply_backlight(uint8_t brightness_percent)
 {
     // Convert 0-100% to 0-255
     uint8_t hw_brightness = (uint8_t)((brightness_percent * 255) / 100);
 
     // Send to I2C backlight controller
-    esp_err_t err = i2c_master_write_to_device(TOUCH_I2C_PORT, 0x30, &hw_brightness, 1, 100);
+    esp_err_t err = i2c_bus_write(backlight_dev, &hw_brightness, 1, CONTROL_I2C_TIMEOUT_MS);
     if (err != ESP_OK) {
         ESP_LOGW(TAG, "Backlight I2C write failed: %d", err);
     }
 }
 
-/**
- * LVGL tick callback
- */
-static uint32_t tick_get_cb(void)
+void display_set_backlight_hw(uint8_t brightness_percent)
 {
-    return (uint32_t)((esp_timer_get_time() - tick_start) / 1000);
+    backlight_percent = brightness_percent;
+
+    // While idle the new level takes effect on wake
+    if (!display_idle) {
+        apply_backlight(brightness_percent);
+    }
 }
 
+// =============================================================================
+// Buffer Geometry (band height, bounce buffer, placement)
+// =============================================================================
+
+typedef struct {
+    uint8_t version;
+    display_buf_config_t cfg;
+} buf_cfg_record_t;
+
 /**
- * Initialize display, touch, and LVGL
+ * Read a fixed-size blob from the display NVS namespace
+ *
+ * @return true if the key exists and has exactly this size
  */
-int display_init(void)
+static bool nvs_load_blob(const char *key, void *buf, size_t size)
 {
-    ESP_LOGI(TAG, "========================================");
-    ESP_LOGI(TAG, "SpoolBuddy Display Driver Init");
-    ESP_LOGI(TAG, "LVGL 9.x + EEZ Studio UI");
-    ESP_LOGI(TAG, "========================================");
+    nvs_handle_t handle;
+    if (nvs_open(DISPLAY_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        return false;
+    }
 
-    // Record start time for tick
-    tick_start = esp_timer_get_time();
+    size_t stored_size = size;
+    esp_err_t err = nvs_get_blob(handle, key, buf, &stored_size);
+    nvs_close(handle);
 
-    // Initialize backlight
-    init_backlight();
-    vTaskDelay(pdMS_TO_TICKS(200));  // 200ms delay like working firmware
+    return err == ESP_OK && stored_size == size;
+}
 
-    // Initialize I2C for touch
-    esp_err_t err = init_touch_i2c();
+/**
+ * Write a blob to the display NVS namespace
+ */
+static esp_err_t nvs_save_blob(const char *key, const void *buf, size_t size)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(DISPLAY_NVS_NAMESPACE, NVS_READWRITE, &handle);
     if (err != ESP_OK) {
-        ESP_LOGW(TAG, "Touch I2C init failed: %d", err);
-    } else {
-        ESP_LOGI(TAG, "Touch I2C initialized");
-
-        // Try I2C backlight commands (for v1.3+ boards)
-        ESP_LOGI(TAG, "=== I2C BACKLIGHT COMMANDS ===");
-        uint8_t brightness = 0xFF;
-        esp_err_t i2c_err;
-
-        // Scan I2C bus first
-        ESP_LOGI(TAG, "Scanning I2C bus (GPIO15/16)...");
-        for (uint8_t addr = 0x08; addr < 0x78; addr++) {
-            uint8_t dummy;
-            if (i2c_master_read_from_device(TOUCH_I2C_PORT, addr, &dummy, 1, 10) == ESP_OK) {
-                ESP_LOGI(TAG, "  Found device at 0x%02X", addr);
-            }
-        }
-
-        // Check for Pico NFC Bridge at 0x55
-        ESP_LOGI(TAG, "Checking Pico NFC Bridge at 0x55...");
-        uint8_t nfc_cmd = 0x01;  // CMD_GET_PRODUCT_VERSION
-        uint8_t nfc_resp[16] = {0};
-        esp_err_t nfc_err = i2c_master_write_to_device(TOUCH_I2C_PORT, 0x55, &nfc_cmd, 1, 100);
-        if (nfc_err == ESP_OK) {
-            vTaskDelay(pdMS_TO_TICKS(50));  // Give Pico time to process
-            nfc_err = i2c_master_read_from_device(TOUCH_I2C_PORT, 0x55, nfc_resp, 3, 100);
-            if (nfc_err == ESP_OK && nfc_resp[0] == 0) {
-                ESP_LOGI(TAG, "  Pico NFC Bridge FOUND! PN5180 version: %d.%d", nfc_resp[1], nfc_resp[2]);
-
-                // Test tag scan
-                ESP_LOGI(TAG, "  Testing tag scan...");
-                nfc_cmd = 0x10;  // CMD_SCAN_TAG
-                nfc_err = i2c_master_write_to_device(TOUCH_I2C_PORT, 0x55, &nfc_cmd, 1, 100);
-                if (nfc_err == ESP_OK) {
-                    vTaskDelay(pdMS_TO_TICKS(200));  // Tag scan takes longer
-                    nfc_err = i2c_master_read_from_device(TOUCH_I2C_PORT, 0x55, nfc_resp, 9, 100);
-                    if (nfc_err == ESP_OK && nfc_resp[0] == 0) {
-                        ESP_LOGI(TAG, "  TAG FOUND! UID: %02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-                            nfc_resp[1], nfc_resp[2], nfc_resp[3], nfc_resp[4],
-                            nfc_resp[5], nfc_resp[6], nfc_resp[7], nfc_resp[8]);
-                    } else {
-                        ESP_LOGI(TAG, "  No tag present (status=%d)", nfc_resp[0]);
-                    }
-                }
-            } else {
-                ESP_LOGW(TAG, "  Pico NFC Bridge read failed (err=%d, status=%d)", nfc_err, nfc_resp[0]);
-            }
-        } else {
-            ESP_LOGW(TAG, "  Pico NFC Bridge NOT found at 0x55 (err=%d)", nfc_err);
-        }
-
-        // Set backlight via 0x30 (STC8H1K28)
-        i2c_err = i2c_master_write_to_device(TOUCH_I2C_PORT, 0x30, &brightness, 1, 100);
-        ESP_LOGI(TAG, "Backlight set (0x30): %s", i2c_err == ESP_OK ? "OK" : "FAIL");
+        ESP_LOGE(TAG, "Failed to open NVS for %s: %s", key, esp_err_to_name(err));
+        return err;
     }
 
-    // Initialize RGB panel
-    err = init_rgb_panel();
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "RGB panel init failed: %d", err);
-        return -1;
+    err = nvs_set_blob(handle, key, buf, size);
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
     }
-
-    // Initialize LVGL
-    ESP_LOGI(TAG, "Initializing LVGL 9.x...");
-    lv_init();
-    lv_tick_set_cb(tick_get_cb);
-
-    // Create display
-    display = lv_display_create(DISPLAY_WIDTH, DISPLAY_HEIGHT);
-    if (display == NULL) {
-        ESP_LOGE(TAG, "Failed to create LVGL display");
-        return -2;
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save %s: %s", key, esp_err_to_name(err));
     }
 
-    // Set color format (RGB565)
-    lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565);
-
-    // Set draw buffers
-    lv_display_set_buffers(display, draw_buf1, draw_buf2,
-                           sizeof(draw_buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
-
-    // Set flush callback
-    lv_display_set_flush_cb(display, flush_cb);
-
-    ESP_LOGI(TAG, "LVGL display created");
+    nvs_close(handle);
+    return err;
+}
 
-    // Create touch input device
-    lv_indev_t *indev = lv_indev_create();
-    if (indev != NULL) {
-        lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
-        lv_indev_set_read_cb(indev, touch_read_cb);
-        ESP_LOGI(TAG, "Touch input device created");
+/**
+ * Load the autotuned buffer geometry from NVS (keeps defaults if none)
+ */
+static void load_buf_config(void)
+{
+    buf_cfg_record_t rec;
+    if (!nvs_load_blob(BUF_CFG_NVS_KEY, &rec, sizeof(rec)) ||
+        rec.version != BUF_CFG_NVS_VERSION ||
+        rec.cfg.band_lines == 0 || rec.cfg.bounce_lines == 0) {
+        ESP_LOGI(TAG, "No valid stored buffer config, using defaults");
+        return;
     }
 
-    // Initialize EEZ UI
-    ESP_LOGI(TAG, "Initializing EEZ UI...");
-    ui_init();
-    ESP_LOGI(TAG, "EEZ UI initialized");
-
-    ESP_LOGI(TAG, "Display driver init complete!");
-    return 0;
+    buf_cfg = rec.cfg;
+    buf_cfg_from_nvs = true;
+    ESP_LOGI(TAG, "Buffer config from NVS: %d-line %s bands, %d-line bounce buffer",
+             buf_cfg.band_lines, buf_cfg.bands_in_psram ? "PSRAM" : "SRAM", buf_cfg.bounce_lines);
 }
 
+#if !DISPLAY_DIRECT_MODE
 /**
- * Run LVGL timer handler
+ * Store the buffer geometry in NVS for later boots
  */
-static int tick_count = 0;
-static int flush_before_timer = 0;
-
-void display_tick(void)
+static esp_err_t save_buf_config(const display_buf_config_t *cfg)
 {
-    tick_count++;
-    flush_before_timer = flush_count;
-
-    if (tick_count <= 10 || tick_count % 200 == 0) {
-        ESP_LOGI(TAG, "tick #%d before lv_timer_handler, flush=%d, active=%p",
-                 tick_count, flush_count, lv_screen_active());
-    }
-
-    lv_timer_handler();
+    buf_cfg_record_t rec = { .version = BUF_CFG_NVS_VERSION, .cfg = *cfg };
+    return nvs_save_blob(BUF_CFG_NVS_KEY, &rec, sizeof(rec));
+}
 
-    // Log if any flushes happened during timer_handler
-    int flushes_this_tick = flush_count - flush_before_timer;
-    if (tick_count <= 10 || tick_count % 200 == 0 || flushes_this_tick > 0) {
-        ESP_LOGI(TAG, "tick #%d after lv_timer, flush=%d (+%d this tick), active=%p",
-                 tick_count, flush_count, flushes_this_tick, lv_screen_active());
+/**
+ * Allocate draw buffers and hand them to LVGL, freeing the previous pair
+ * Leaves the current buffers in place if the allocation fails.
+ */
+static esp_err_t set_draw_buffers(uint16_t band_lines, bool in_psram)
+{
+    size_t size = (size_t)DISPLAY_WIDTH * band_lines * 2;  // RGB565 = 2 bytes/pixel
+    uint32_t caps = in_psram ? MALLOC_CAP_SPIRAM : (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+
+    uint8_t *buf1 = heap_caps_aligned_alloc(64, size, caps);
+    uint8_t *buf2 = heap_caps_aligned_alloc(64, size, caps);
+    if (buf1 == NULL || buf2 == NULL) {
+        heap_caps_free(buf1);
+        heap_caps_free(buf2);
+        ESP_LOGW(TAG, "Can't allocate 2x%u bytes for %d-line %s bands",
+                 (unsigned)size, band_lines, in_psram ? "PSRAM" : "SRAM");
+        return ESP_ERR_NO_MEM;
     }
 
-    ui_tick();
+    lv_display_set_buffers(display, buf1, buf2, size, LV_DISPLAY_RENDER_MODE_PARTIAL);
 
-    if (tick_count <= 10 || tick_count % 200 == 0) {
-        ESP_LOGI(TAG, "tick #%d after ui_tick", tick_count);
-    }
+    heap_caps_free(draw_buf1);
+    heap_caps_free(draw_buf2);
+    draw_buf1 = buf1;
+    draw_buf2 = buf2;
+    return ESP_OK;
 }
 
 /**
- * Get elapsed time in milliseconds
+ * Wait for an in-flight DMA band copy to finish
  */
-uint32_t display_get_tick_ms(void)
+static void wait_flush_idle(void)
 {
-    return tick_get_cb();
+#if DISPLAY_ASYNC_FLUSH
+    for (int i = 0; i < 50 && async_ctx.pending && async_ctx.done_us < async_ctx.start_us; i++) {
+        vTaskDelay(1);
+    }
+    sync_flushed_band();
+#endif
+}
+
+/**
+ * Switch to a new buffer geometry at runtime (LVGL must be locked)
+ * A bounce buffer change recreates the RGB panel, since its size is fixed
+ * at creation; the screen is redrawn afterwards.
+ */
+static esp_err_t apply_buf_config(const display_buf_config_t *cfg)
+{
+    wait_flush_idle();
+
+    if (cfg->bounce_lines != buf_cfg.bounce_lines) {
+        uint16_t old_bounce = buf_cfg.bounce_lines;
+
+        esp_lcd_panel_del(panel_handle);
+        panel_handle = NULL;
+
+        buf_cfg.bounce_lines = cfg->bounce_lines;
+        if (init_rgb_panel() != ESP_OK) {
+            buf_cfg.bounce_lines = old_bounce;
+            if (init_rgb_panel() != ESP_OK) {
+                // flush_cb drops frames while panel_handle is NULL
+                ESP_LOGE(TAG, "Failed to restore RGB panel, display stopped");
+                return ESP_ERR_INVALID_STATE;
+            }
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    if (cfg->band_lines != buf_cfg.band_lines || cfg->bands_in_psram != buf_cfg.bands_in_psram) {
+        esp_err_t err = set_draw_buffers(cfg->band_lines, cfg->bands_in_psram);
+        if (err != ESP_OK) {
+            return err;
+        }
+        buf_cfg.band_lines = cfg->band_lines;
+        buf_cfg.bands_in_psram = cfg->bands_in_psram;
+    }
+
+    lv_obj_invalidate(lv_screen_active());
+    return ESP_OK;
+}
+#endif
+
+// =============================================================================
+// Boot Timeline
+// =============================================================================
+
+/**
+ * Record the end of a boot phase (timestamps are since power-on)
+ */
+static void boot_phase(const char *name)
+{
+    int64_t now_us = esp_timer_get_time();
+
+    taskENTER_CRITICAL(&boot_lock);
+    if (boot_phase_count < BOOT_MAX_PHASES) {
+        boot_phases[boot_phase_count].name = name;
+        boot_phases[boot_phase_count].us = now_us;
+        boot_phase_count++;
+    }
+    taskEXIT_CRITICAL(&boot_lock);
+}
+
+/**
+ * Log the boot timeline once the first frame is on the panel
+ */
+static void log_boot_timeline(void)
+{
+    ESP_LOGI(TAG, "Boot timeline (%s boot):", i2c_map_cached ? "fast" : "full");
+    for (int i = 0; i < boot_phase_count; i++) {
+        int64_t prev_us = i > 0 ? boot_phases[i - 1].us : 0;
+        ESP_LOGI(TAG, "  %-14s %6lldms  (+%lldms)", boot_phases[i].name,
+                 (long long)(boot_phases[i].us / 1000),
+                 (long long)((boot_phases[i].us - prev_us) / 1000));
+    }
+    if (boot_phase_count > 0) {
+        ESP_LOGI(TAG, "Time to first frame: %lldms since power-on, %lldms after display_init",
+                 (long long)(boot_first_frame_us / 1000),
+                 (long long)((boot_first_frame_us - boot_phases[0].us) / 1000));
+    }
+}
+
+// =============================================================================
+// I2C Device Map and Boot Task
+// =============================================================================
+
+static inline bool i2c_map_has(const i2c_map_t *map, uint8_t addr)
+{
+    return (map->present[addr >> 3] >> (addr & 7)) & 1;
+}
+
+/**
+ * Check whether a device ACKs a one-byte read
+ */
+static bool i2c_probe(uint8_t addr)
+{
+    return i2c_bus_probe(addr, 10);
+}
+
+/**
+ * Scan the whole bus (0x08-0x77) - ~120 probes, slow when nothing answers
+ */
+static void scan_i2c_bus(i2c_map_t *map)
+{
+    memset(map, 0, sizeof(*map));
+    map->version = I2C_MAP_VERSION;
+
+    ESP_LOGI(TAG, "Scanning I2C bus (GPIO15/16)...");
+    for (uint8_t addr = 0x08; addr < 0x78; addr++) {
+        if (i2c_probe(addr)) {
+            map->present[addr >> 3] |= 1 << (addr & 7);
+            ESP_LOGI(TAG, "  Found device at 0x%02X", addr);
+        }
+    }
+}
+
+/**
+ * Verify a cached map by probing only the devices it lists
+ * A map without the touch controller is treated as stale.
+ */
+static bool verify_i2c_map(const i2c_map_t *map)
+{
+    if (!i2c_map_has(map, GT911_ADDR)) {
+        ESP_LOGI(TAG, "Cached I2C map has no touch controller - reprobing");
+        return false;
+    }
+    for (uint8_t addr = 0x08; addr < 0x78; addr++) {
+        if (i2c_map_has(map, addr) && !i2c_probe(addr)) {
+            ESP_LOGI(TAG, "Cached I2C device 0x%02X missing - reprobing", addr);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Probe just the devices this board is built with
+ * @return true if all of them answered
+ */
+static bool probe_expected_i2c(i2c_map_t *map)
+{
+    static const uint8_t expected[] = { GT911_ADDR, BACKLIGHT_I2C_ADDR, NFC_BRIDGE_I2C_ADDR };
+
+    memset(map, 0, sizeof(*map));
+    map->version = I2C_MAP_VERSION;
+
+    bool all_found = true;
+    for (size_t i = 0; i < sizeof(expected); i++) {
+        uint8_t addr = expected[i];
+        if (i2c_probe(addr)) {
+            map->present[addr >> 3] |= 1 << (addr & 7);
+            ESP_LOGI(TAG, "  Found device at 0x%02X", addr);
+        } else {
+            ESP_LOGI(TAG, "  No device at 0x%02X", addr);
+            all_found = false;
+        }
+    }
+    return all_found;
+}
+
+/**
+ * Pico NFC bridge diagnostics: version query and a test tag scan (~250ms)
+ */
+static void probe_nfc_bridge(void)
+{
+    // Check for Pico NFC Bridge at 0x55
+    ESP_LOGI(TAG, "Checking Pico NFC Bridge at 0x55...");
+    if (nfc_dev == NULL) {
+        nfc_dev = i2c_bus_add_device(NFC_BRIDGE_I2C_ADDR, "nfc", I2C_BUS_PRIO_BULK, CONTROL_I2C_FREQ_HZ);
+    }
+
+    // Command and response are separate transactions, so touch reads run
+    // in between instead of waiting out the bridge's processing time
+    uint8_t nfc_cmd = 0x01;  // CMD_GET_PRODUCT_VERSION
+    uint8_t nfc_resp[16] = {0};
+    esp_err_t nfc_err = i2c_bus_write(nfc_dev, &nfc_cmd, 1, CONTROL_I2C_TIMEOUT_MS);
+    if (nfc_err == ESP_OK) {
+        vTaskDelay(pdMS_TO_TICKS(50));  // Give Pico time to process
+        nfc_err = i2c_bus_read(nfc_dev, nfc_resp, 3, CONTROL_I2C_TIMEOUT_MS);
+        if (nfc_err == ESP_OK && nfc_resp[0] == 0) {
+            ESP_LOGI(TAG, "  Pico NFC Bridge FOUND! PN5180 version: %d.%d", nfc_resp[1], nfc_resp[2]);
+
+            // Test tag scan
+            ESP_LOGI(TAG, "  Testing tag scan...");
+            nfc_cmd = 0x10;  // CMD_SCAN_TAG
+            nfc_err = i2c_bus_write(nfc_dev, &nfc_cmd, 1, CONTROL_I2C_TIMEOUT_MS);
+            if (nfc_err == ESP_OK) {
+                vTaskDelay(pdMS_TO_TICKS(200));  // Tag scan takes longer
+                nfc_err = i2c_bus_read(nfc_dev, nfc_resp, 9, CONTROL_I2C_TIMEOUT_MS);
+                if (nfc_err == ESP_OK && nfc_resp[0] == 0) {
+                    ESP_LOGI(TAG, "  TAG FOUND! UID: %02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
+                        nfc_resp[1], nfc_resp[2], nfc_resp[3], nfc_resp[4],
+                        nfc_resp[5], nfc_resp[6], nfc_resp[7], nfc_resp[8]);
+                } else {
+                    ESP_LOGI(TAG, "  No tag present (status=%d)", nfc_resp[0]);
+                }
+            }
+        } else {
+            ESP_LOGW(TAG, "  Pico NFC Bridge read failed (err=%d, status=%d)", nfc_err, nfc_resp[0]);
+        }
+    } else {
+        ESP_LOGW(TAG, "  Pico NFC Bridge NOT found at 0x55 (err=%d)", nfc_err);
+    }
+}
+
+/**
+ * Bring up the touch/backlight I2C bus
+ * Uses the device map cached in NVS when all cached devices still answer;
+ * otherwise probes the expected addresses (full bus scan only if one of them
+ * is missing), runs the NFC bridge diagnostics and caches the result.
+ */
+static void i2c_boot(void)
+{
+    // 200ms delay like working firmware (backlight controller power-up)
+    int64_t settle_us = BACKLIGHT_SETTLE_MS * 1000 - (esp_timer_get_time() - tick_start);
+    if (settle_us > 0) {
+        vTaskDelay(pdMS_TO_TICKS(settle_us / 1000) + 1);
+    }
+    boot_phase("i2c settle");
+
+    esp_err_t err = init_touch_i2c();
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Touch I2C init failed: %d", err);
+    } else {
+        ESP_LOGI(TAG, "Touch I2C initialized");
+
+        bool cached = !DISPLAY_BOOT_DIAGNOSTICS &&
+                      nvs_load_blob(I2C_MAP_NVS_KEY, &i2c_map, sizeof(i2c_map)) &&
+                      i2c_map.version == I2C_MAP_VERSION &&
+                      verify_i2c_map(&i2c_map);
+
+        if (cached) {
+            ESP_LOGI(TAG, "I2C device map from NVS (skipping bus scan)");
+        } else {
+            // A missing device may answer at another address - scan for it
+            if (!probe_expected_i2c(&i2c_map) || DISPLAY_BOOT_DIAGNOSTICS) {
+                scan_i2c_bus(&i2c_map);
+            }
+            if (i2c_map_has(&i2c_map, NFC_BRIDGE_I2C_ADDR) || DISPLAY_BOOT_DIAGNOSTICS) {
+                probe_nfc_bridge();
+            }
+            nvs_save_blob(I2C_MAP_NVS_KEY, &i2c_map, sizeof(i2c_map));
+        }
+        i2c_map_cached = cached;
+        boot_phase(cached ? "i2c cached" : "i2c scan");
+
+        // Set backlight via 0x30 (STC8H1K28, v1.3+ boards)
+        if (i2c_map_has(&i2c_map, BACKLIGHT_I2C_ADDR)) {
+            uint8_t brightness = 0xFF;
+            err = i2c_bus_write(backlight_dev, &brightness, 1, CONTROL_I2C_TIMEOUT_MS);
+            ESP_LOGI(TAG, "Backlight set (0x30): %s", err == ESP_OK ? "OK" : "FAIL");
+        }
+    }
+}
+
+/**
+ * I2C bring-up task - runs while display_init sets up the panel and LVGL
+ */
+static void i2c_boot_task(void *arg)
+{
+    i2c_boot();
+
+    // display_init gave up waiting - touch is ours to start
+    taskENTER_CRITICAL(&boot_lock);
+    i2c_boot_finished = true;
+    bool start_touch = touch_start_deferred;
+    taskEXIT_CRITICAL(&boot_lock);
+    if (start_touch) {
+        ESP_LOGI(TAG, "I2C boot task finished late, starting touch");
+        start_touch_task();
+    }
+
+    xSemaphoreGive(i2c_boot_done);
+    vTaskDelete(NULL);
+}
+
+/**
+ * LVGL tick callback
+ */
+static uint32_t tick_get_cb(void)
+{
+    return (uint32_t)((esp_timer_get_time() - tick_start) / 1000);
+}
+
+/**
+ * Initialize display, touch, and LVGL
+ */
+int display_init(void)
+{
+    ESP_LOGI(TAG, "========================================");
+    ESP_LOGI(TAG, "SpoolBuddy Display Driver Init");
+    ESP_LOGI(TAG, "LVGL 9.x + EEZ Studio UI");
+    ESP_LOGI(TAG, "========================================");
+
+    // Record start time for tick
+    tick_start = esp_timer_get_time();
+    boot_phase("display_init");
+
+    // Initialize backlight
+    init_backlight();
+
+    // The touch/backlight/NFC bus comes up in parallel with the panel and
+    // LVGL - it needs the 200ms backlight settle time, the panel doesn't
+    i2c_boot_done = xSemaphoreCreateBinary();
+    if (i2c_boot_done == NULL ||
+        xTaskCreate(i2c_boot_task, "i2c_boot", I2C_BOOT_TASK_STACK, NULL,
+                    I2C_BOOT_TASK_PRIO, NULL) != pdPASS) {
+        ESP_LOGW(TAG, "I2C boot task failed to start, initializing inline");
+        if (i2c_boot_done != NULL) {
+            vSemaphoreDelete(i2c_boot_done);
+            i2c_boot_done = NULL;
+        }
+        i2c_boot();
+    }
+
+    // Buffer geometry from a previous autotune run, if any
+    load_buf_config();
+
+    // Initialize RGB panel
+    esp_err_t err = init_rgb_panel();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "RGB panel init failed: %d", err);
+        return -1;
+    }
+    boot_phase("rgb panel");
+
+    // Initialize LVGL
+    ESP_LOGI(TAG, "Initializing LVGL 9.x...");
+    lv_init();
+    lv_tick_set_cb(tick_get_cb);
+
+    // Create display
+    display = lv_display_create(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    if (display == NULL) {
+        ESP_LOGE(TAG, "Failed to create LVGL display");
+        return -2;
+    }
+
+    // Set color format (RGB565)
+    lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565);
+
+    // Set draw buffers
+#if DISPLAY_DIRECT_MODE
+    lv_display_set_buffers(display, panel_fbs[0], panel_fbs[1],
+                           DISPLAY_WIDTH * DISPLAY_HEIGHT * 2, LV_DISPLAY_RENDER_MODE_DIRECT);
+    ESP_LOGI(TAG, "Render mode: DIRECT (double-buffered, VSYNC swap)");
+#else
+    if (set_draw_buffers(buf_cfg.band_lines, buf_cfg.bands_in_psram) != ESP_OK) {
+        // A stored PSRAM/large-band config that no longer fits - use the defaults
+        buf_cfg.band_lines = DRAW_BUF_LINES;
+        buf_cfg.bands_in_psram = false;
+        if (set_draw_buffers(buf_cfg.band_lines, buf_cfg.bands_in_psram) != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to allocate draw buffers");
+            return -3;
+        }
+    }
+    ESP_LOGI(TAG, "Render mode: PARTIAL (%d-line %s bands)",
+             buf_cfg.band_lines, buf_cfg.bands_in_psram ? "PSRAM" : "SRAM");
+#endif
+
+    // Set flush callback
+    lv_display_set_flush_cb(display, flush_cb);
+
+#if !DISPLAY_DIRECT_MODE && DISPLAY_ASYNC_FLUSH
+    init_async_flush();
+#endif
+
+    ESP_LOGI(TAG, "LVGL display created");
+    boot_phase("lvgl display");
+
+    // Create touch input device
+    lv_indev_t *indev = lv_indev_create();
+    if (indev != NULL) {
+        lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+        lv_indev_set_read_cb(indev, touch_read_cb);
+        ESP_LOGI(TAG, "Touch input device created");
+    }
+
+    // Initialize EEZ UI
+    ESP_LOGI(TAG, "Initializing EEZ UI...");
+    ui_init();
+    ESP_LOGI(TAG, "EEZ UI initialized");
+    boot_phase("ui_init");
+
+    // Touch needs the I2C bus - wait for the boot task
+    bool touch_now = true;
+    if (i2c_boot_done != NULL) {
+        if (xSemaphoreTake(i2c_boot_done, pdMS_TO_TICKS(I2C_BOOT_TIMEOUT_MS)) == pdTRUE) {
+            vSemaphoreDelete(i2c_boot_done);
+            i2c_boot_done = NULL;
+        } else {
+            // Leave the semaphore for the task to give; unless it finished
+            // just now, it starts touch itself once the GT911 is set up
+            taskENTER_CRITICAL(&boot_lock);
+            touch_now = i2c_boot_finished;
+            touch_start_deferred = !touch_now;
+            taskEXIT_CRITICAL(&boot_lock);
+            if (!touch_now) {
+                ESP_LOGW(TAG, "I2C boot task still running after %dms, touch starts when it finishes",
+                         I2C_BOOT_TIMEOUT_MS);
+            }
+        }
+    }
+    boot_phase("i2c join");
+
+    // Read the touch controller in its own task
+    if (touch_now) {
+        start_touch_task();
+    }
+
+    ESP_LOGI(TAG, "Display driver init complete!");
+    return 0;
+}
+
+/**
+ * Run LVGL timer handler
+ */
+static int tick_count = 0;
+static int flush_before_timer = 0;
+
+void display_tick(void)
+{
+    tick_count++;
+    flush_before_timer = flush_count;
+
+    if (tick_count <= 10 || tick_count % 200 == 0) {
+        ESP_LOGI(TAG, "tick #%d before lv_timer_handler, flush=%d, active=%p",
+                 tick_count, flush_count, lv_screen_active());
+    }
+
+    lv_timer_handler();
+#if !DISPLAY_DIRECT_MODE && DISPLAY_ASYNC_FLUSH
+    sync_flushed_band();
+#endif
+
+    // Log if any flushes happened during timer_handler
+    int flushes_this_tick = flush_count - flush_before_timer;
+    if (tick_count <= 10 || tick_count % 200 == 0 || flushes_this_tick > 0) {
+        ESP_LOGI(TAG, "tick #%d after lv_timer, flush=%d (+%d this tick), active=%p",
+                 tick_count, flush_count, flushes_this_tick, lv_screen_active());
+    }
+
+    ui_tick();
+
+    if (tick_count <= 10 || tick_count % 200 == 0) {
+        ESP_LOGI(TAG, "tick #%d after ui_tick", tick_count);
+    }
+
+    if (boot_first_frame && !boot_timeline_logged) {
+        boot_timeline_logged = true;
+        log_boot_timeline();
+    }
+
+    // Periodic copy/render overlap summary
+    if (tick_count % 2000 == 0) {
+        display_flush_stats_t fs;
+        display_get_flush_stats(&fs);
+        if (fs.flushes > 0) {
+            ESP_LOGI(TAG, "flush stats: %lu bands (%lu dma, %lu cpu), copy=%llums render=%llums, dma stalls=%lu",
+                     (unsigned long)fs.flushes, (unsigned long)fs.dma_flushes,
+                     (unsigned long)fs.cpu_flushes,
+                     (unsigned long long)(fs.copy_us / 1000),
+                     (unsigned long long)(fs.render_us / 1000),
+                     (unsigned long)fs.dma_stalls);
+            i2c_bus_log_stats();
+        }
+    }
+}
+
+// =============================================================================
+// Render Task and UI Command Queue
+// =============================================================================
+
+/**
+ * Lock LVGL for use outside the render task
+ */
+bool display_lock(int timeout_ms)
+{
+    if (lvgl_mutex == NULL) {
+        return true;  // Render task not started - caller is the only LVGL user
+    }
+    TickType_t ticks = timeout_ms < 0 ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    return xSemaphoreTakeRecursive(lvgl_mutex, ticks) == pdTRUE;
+}
+
+/**
+ * Release the LVGL lock
+ */
+void display_unlock(void)
+{
+    if (lvgl_mutex != NULL) {
+        xSemaphoreGiveRecursive(lvgl_mutex);
+    }
+}
+
+/**
+ * Queue a callback to run on the render task
+ */
+bool display_ui_post(display_ui_cb_t cb, void *arg)
+{
+    if (cb == NULL) {
+        return false;
+    }
+    if (ui_queue == NULL) {
+        // No render task yet - LVGL still runs from the caller's loop
+#if LV_USE_OS != LV_OS_NONE
+        lv_lock();
+        lv_async_call(cb, arg);
+        lv_unlock();
+#else
+        lv_async_call(cb, arg);
+#endif
+        return true;
+    }
+
+    ui_cmd_t cmd = { .cb = cb, .arg = arg };
+    if (xQueueSend(ui_queue, &cmd, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "UI queue full, dropping command");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Record one render loop period for the jitter statistics
+ */
+static void record_frame_period(int64_t period_us, int64_t cycle_us)
+{
+    uint32_t period = (uint32_t)period_us;
+    uint32_t target = render_stats.period_target_us;
+    uint32_t jitter = period > target ? period - target : target - period;
+
+    render_stats.frames++;
+    render_stats.period_sum_us += period;
+    render_stats.jitter_sum_us += jitter;
+    if (render_stats.frames == 1 || period < render_stats.period_min_us) {
+        render_stats.period_min_us = period;
+    }
+    if (period > render_stats.period_max_us) {
+        render_stats.period_max_us = period;
+    }
+    if (jitter > render_stats.jitter_max_us) {
+        render_stats.jitter_max_us = jitter;
+    }
+    if (period > 2 * target) {
+        render_stats.late_frames++;
+    }
+    if ((uint32_t)cycle_us > render_stats.cycle_max_us) {
+        render_stats.cycle_max_us = (uint32_t)cycle_us;
+    }
+}
+
+/**
+ * Run UI updates posted from other tasks (LVGL must be locked)
+ */
+static void drain_ui_queue(void)
+{
+    ui_cmd_t cmd;
+    while (xQueueReceive(ui_queue, &cmd, 0) == pdTRUE) {
+        cmd.cb(cmd.arg);
+    }
+}
+
+/**
+ * Enter idle mode - backlight down, slow pixel clock, no rendering
+ */
+static void enter_idle(void)
+{
+    ESP_LOGI(TAG, "Display idle after %lus without input",
+             (unsigned long)(idle_timeout_ms / 1000));
+
+    xSemaphoreTake(wake_sem, 0);  // Drop a stale wake
+    display_idle = true;
+
+    apply_backlight(IDLE_BACKLIGHT_PERCENT);
+
+    // Only with the backlight off - a slow scanout flickers visibly
+    if (DISPLAY_IDLE_PCLK_HZ > 0 && IDLE_BACKLIGHT_PERCENT == 0 && panel_handle != NULL) {
+        esp_lcd_rgb_panel_set_pclk(panel_handle, DISPLAY_IDLE_PCLK_HZ);
+    }
+}
+
+/**
+ * Leave idle mode (LVGL must be locked)
+ * The next display_tick renders everything invalidated while idle.
+ */
+static void exit_idle(void)
+{
+    if (DISPLAY_IDLE_PCLK_HZ > 0 && IDLE_BACKLIGHT_PERCENT == 0 && panel_handle != NULL) {
+        esp_lcd_rgb_panel_set_pclk(panel_handle, DISPLAY_PCLK_HZ);
+    }
+
+    lv_display_trigger_activity(display);
+
+    taskENTER_CRITICAL(&touch_lock);
+    touch_wake_suppress = touch_pressed;
+    taskEXIT_CRITICAL(&touch_lock);
+
+    display_idle = false;
+    ESP_LOGI(TAG, "Display wake");
+}
+
+/**
+ * Idle loop - keeps the data model current until a touch or display_wake()
+ */
+static void run_idle(void)
+{
+    enter_idle();
+
+    while (1) {
+        bool woken = xSemaphoreTake(wake_sem, pdMS_TO_TICKS(IDLE_POLL_MS)) == pdTRUE;
+
+        xSemaphoreTakeRecursive(lvgl_mutex, portMAX_DELAY);
+        if (render_stop) {
+            xSemaphoreGiveRecursive(lvgl_mutex);
+            return;
+        }
+        drain_ui_queue();
+        if (woken || activity_pending || idle_timeout_ms == 0) {
+            activity_pending = false;
+            exit_idle();
+            display_tick();
+            xSemaphoreGiveRecursive(lvgl_mutex);
+            // Backlight after the first frame so the stale image isn't shown
+            apply_backlight(backlight_percent);
+            return;
+        }
+        ui_tick();
+        xSemaphoreGiveRecursive(lvgl_mutex);
+    }
+}
+
+/**
+ * Render task - drains the UI queue, then runs LVGL and the UI tick
+ */
+static void render_task(void *arg)
+{
+    TickType_t period_ticks = pdMS_TO_TICKS(RENDER_PERIOD_MS);
+    if (period_ticks == 0) {
+        period_ticks = 1;
+    }
+    render_stats.period_target_us = period_ticks * portTICK_PERIOD_MS * 1000;
+
+    TickType_t last_wake = xTaskGetTickCount();
+    int64_t last_start_us = 0;
+
+    ESP_LOGI(TAG, "Render task running on core %d (period %lums, %d draw unit%s)",
+             xPortGetCoreID(), (unsigned long)(period_ticks * portTICK_PERIOD_MS),
+             LV_DRAW_SW_DRAW_UNIT_CNT, LV_DRAW_SW_DRAW_UNIT_CNT > 1 ? "s" : "");
+
+#if DISPLAY_RENDER_BENCHMARK || DISPLAY_AUTOTUNE
+    bool bench_done = false;
+#endif
+
+    while (1) {
+        int64_t start_us = esp_timer_get_time();
+
+        xSemaphoreTakeRecursive(lvgl_mutex, portMAX_DELAY);
+        // Checked under the lock: display_shutdown() may hold it while the
+        // panel goes away
+        if (render_stop) {
+            xSemaphoreGiveRecursive(lvgl_mutex);
+            break;
+        }
+
+        drain_ui_queue();
+
+        if (activity_pending) {
+            activity_pending = false;
+            lv_display_trigger_activity(display);
+        }
+
+        display_tick();
+
+        bool go_idle = idle_timeout_ms > 0 &&
+                       lv_display_get_inactive_time(display) >= idle_timeout_ms;
+
+        xSemaphoreGiveRecursive(lvgl_mutex);
+
+        if (go_idle) {
+            run_idle();
+            if (render_stop) break;
+            // Restart period/jitter tracking - the idle gap isn't a late frame
+            last_wake = xTaskGetTickCount();
+            last_start_us = 0;
+            continue;
+        }
+
+        if (last_start_us != 0) {
+            record_frame_period(start_us - last_start_us, esp_timer_get_time() - start_us);
+        }
+        last_start_us = start_us;
+
+        if (render_stats.frames > 0 && render_stats.frames % 3000 == 0) {
+            ESP_LOGI(TAG, "render stats: %lu frames, period avg=%lluus min=%luus max=%luus, "
+                     "jitter avg=%lluus max=%luus, late=%lu, max cycle=%luus",
+                     (unsigned long)render_stats.frames,
+                     (unsigned long long)(render_stats.period_sum_us / render_stats.frames),
+                     (unsigned long)render_stats.period_min_us,
+                     (unsigned long)render_stats.period_max_us,
+                     (unsigned long long)(render_stats.jitter_sum_us / render_stats.frames),
+                     (unsigned long)render_stats.jitter_max_us,
+                     (unsigned long)render_stats.late_frames,
+                     (unsigned long)render_stats.cycle_max_us);
+        }
+
+#if DISPLAY_RENDER_BENCHMARK || DISPLAY_AUTOTUNE
+        if (!bench_done && tick_get_cb() >= RENDER_BENCH_DELAY_MS) {
+            bench_done = true;
+#if DISPLAY_AUTOTUNE
+            if (!buf_cfg_from_nvs) {
+                display_autotune(AUTOTUNE_FRAMES);
+            }
+#endif
+#if DISPLAY_RENDER_BENCHMARK
+            display_run_render_benchmark(RENDER_BENCH_FRAMES);
+#endif
+            // Don't count the benchmark as one giant late frame
+            last_wake = xTaskGetTickCount();
+            last_start_us = 0;
+        }
+#endif
+
+        // Fixed-rate loop; if a heavy frame overran, catch up without sleeping
+        if (xTaskDelayUntil(&last_wake, period_ticks) == pdFALSE) {
+            last_wake = xTaskGetTickCount();
+        }
+    }
+
+    // Stopped by display_shutdown(), between frames and without the lock
+    ESP_LOGI(TAG, "Render task stopped");
+    if (render_stop_waiter != NULL) {
+        xTaskNotifyGive(render_stop_waiter);
+    }
+    vTaskDelete(NULL);
+}
+
+/**
+ * Start the LVGL render task
+ */
+int display_start_render_task(void)
+{
+    if (render_task_handle != NULL) {
+        return 0;
+    }
+
+    lvgl_mutex = xSemaphoreCreateRecursiveMutex();
+    ui_queue = xQueueCreate(UI_QUEUE_LEN, sizeof(ui_cmd_t));
+    wake_sem = xSemaphoreCreateBinary();
+    if (lvgl_mutex == NULL || ui_queue == NULL || wake_sem == NULL) {
+        ESP_LOGE(TAG, "Failed to create render task lock/queue");
+        return -1;
+    }
+
+    memset(&render_stats, 0, sizeof(render_stats));
+    if (xTaskCreatePinnedToCore(render_task, "lvgl_render", RENDER_TASK_STACK, NULL,
+                                RENDER_TASK_PRIO, &render_task_handle, RENDER_TASK_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create render task");
+        render_task_handle = NULL;
+        return -2;
+    }
+
+    return 0;
+}
+
+// =============================================================================
+// Render Benchmark
+// =============================================================================
+
+static const enum ScreensEnum bench_screens[] = {
+    SCREEN_ID_MAIN_SCREEN,
+    SCREEN_ID_AMS_OVERVIEW,
+    SCREEN_ID_SCAN_RESULT,
+    SCREEN_ID_SPOOL_DETAILS,
+    SCREEN_ID_SETTINGS_SCREEN,
+    SCREEN_ID_SETTINGS_DISPLAY_SCREEN,
+};
+
+typedef struct {
+    uint64_t sum_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t frames;
+} bench_result_t;
+
+/**
+ * Load a screen and time full-screen redraws of it (LVGL must be locked)
+ * Frame time includes the flush; in DISPLAY_DIRECT_MODE that means it is
+ * rounded up to the next VSYNC.
+ */
+static void bench_screen(enum ScreensEnum screen, int frames, bench_result_t *res)
+{
+    // Navigate the same way a button press does, then let the screen settle
+    pendingScreen = screen;
+    ui_tick();
+    lv_timer_handler();
+
+    res->sum_us = 0;
+    res->min_us = UINT32_MAX;
+    res->max_us = 0;
+    res->frames = frames;
+
+    for (int f = 0; f < frames; f++) {
+        lv_obj_invalidate(lv_screen_active());
+        int64_t start_us = esp_timer_get_time();
+        lv_refr_now(display);
+        uint32_t frame_us = (uint32_t)(esp_timer_get_time() - start_us);
+
+        res->sum_us += frame_us;
+        if (frame_us < res->min_us) res->min_us = frame_us;
+        if (frame_us > res->max_us) res->max_us = frame_us;
+    }
+}
+
+/**
+ * Time full-screen redraws of each benchmark screen
+ * Ends on the main screen.
+ */
+int32_t display_run_render_benchmark(int frames_per_screen)
+{
+    if (display == NULL || frames_per_screen <= 0) {
+        return -1;
+    }
+    if (!display_lock(-1)) {
+        return -1;
+    }
+
+    ESP_LOGI(TAG, "Render benchmark: %d draw unit(s), %d frames/screen",
+             LV_DRAW_SW_DRAW_UNIT_CNT, frames_per_screen);
+
+    uint64_t total_us = 0;
+    uint32_t total_frames = 0;
+
+    for (size_t i = 0; i < sizeof(bench_screens) / sizeof(bench_screens[0]); i++) {
+        bench_result_t res;
+        bench_screen(bench_screens[i], frames_per_screen, &res);
+
+        ESP_LOGI(TAG, "  screen %d: avg=%lluus min=%luus max=%luus",
+                 bench_screens[i], (unsigned long long)(res.sum_us / res.frames),
+                 (unsigned long)res.min_us, (unsigned long)res.max_us);
+
+        total_us += res.sum_us;
+        total_frames += res.frames;
+    }
+
+    pendingScreen = SCREEN_ID_MAIN_SCREEN;
+    ui_tick();
+
+    display_unlock();
+
+    int32_t avg_us = (int32_t)(total_us / total_frames);
+    ESP_LOGI(TAG, "Render benchmark done: %d draw unit(s), avg frame %ldus (%lu frames)",
+             LV_DRAW_SW_DRAW_UNIT_CNT, (long)avg_us, (unsigned long)total_frames);
+    return avg_us;
+}
+
+// =============================================================================
+// Buffer Autotune
+// =============================================================================
+
+#if !DISPLAY_DIRECT_MODE
+// Candidate geometries - combinations that don't fit in memory are skipped
+static const uint16_t tune_band_lines[] = { 20, 40, 60, 80 };
+static const uint16_t tune_bounce_lines[] = { 10, 20 };
+
+typedef struct {
+    display_buf_config_t cfg;
+    bool ok;                // Geometry could be allocated
+    uint32_t avg_us;
+    uint32_t max_us;
+    uint32_t underruns;
+} tune_result_t;
+
+#define TUNE_NUM_RESULTS    (2 * sizeof(tune_band_lines) / sizeof(tune_band_lines[0]) * \
+                             sizeof(tune_bounce_lines) / sizeof(tune_bounce_lines[0]))
+
+/**
+ * Measure one candidate geometry over all reference screens
+ */
+static void tune_measure(tune_result_t *res, int frames_per_screen)
+{
+    res->ok = panel_handle != NULL && apply_buf_config(&res->cfg) == ESP_OK;
+    if (!res->ok) {
+        return;
+    }
+
+    uint64_t sum_us = 0;
+    uint32_t frames = 0;
+    uint32_t underruns_before = panel_underruns;
+
+    res->max_us = 0;
+    for (size_t i = 0; i < sizeof(bench_screens) / sizeof(bench_screens[0]); i++) {
+        bench_result_t bench;
+        bench_screen(bench_screens[i], frames_per_screen, &bench);
+        sum_us += bench.sum_us;
+        frames += bench.frames;
+        if (bench.max_us > res->max_us) {
+            res->max_us = bench.max_us;
+        }
+    }
+
+    res->avg_us = (uint32_t)(sum_us / frames);
+    res->underruns = panel_underruns - underruns_before;
+}
+
+/**
+ * True if candidate a beats candidate b (no underruns first, then frame time)
+ */
+static bool tune_better(const tune_result_t *a, const tune_result_t *b)
+{
+    if (!a->ok) return false;
+    if (!b->ok) return true;
+    if ((a->underruns == 0) != (b->underruns == 0)) {
+        return a->underruns == 0;
+    }
+    if (a->underruns != b->underruns && a->underruns > 0) {
+        return a->underruns < b->underruns;
+    }
+    return a->avg_us < b->avg_us;
+}
+
+/**
+ * Try every candidate geometry, log a comparison table, keep and store the best
+ */
+int display_autotune(int frames_per_screen)
+{
+    if (display == NULL || frames_per_screen <= 0) {
+        return -1;
+    }
+    if (!display_lock(-1)) {
+        return -1;
+    }
+
+    static tune_result_t results[TUNE_NUM_RESULTS];
+    display_buf_config_t start_cfg = buf_cfg;
+    size_t n = 0;
+    size_t best = 0;
+
+    ESP_LOGI(TAG, "Buffer autotune: %u candidates, %d frames/screen",
+             (unsigned)TUNE_NUM_RESULTS, frames_per_screen);
+
+    for (int psram = 0; psram <= 1; psram++) {
+        for (size_t b = 0; b < sizeof(tune_bounce_lines) / sizeof(tune_bounce_lines[0]); b++) {
+            for (size_t l = 0; l < sizeof(tune_band_lines) / sizeof(tune_band_lines[0]); l++) {
+                tune_result_t *res = &results[n];
+                memset(res, 0, sizeof(*res));
+                res->cfg.band_lines = tune_band_lines[l];
+                res->cfg.bounce_lines = tune_bounce_lines[b];
+                res->cfg.bands_in_psram = psram;
+
+                tune_measure(res, frames_per_screen);
+                if (tune_better(res, &results[best])) {
+                    best = n;
+                }
+                n++;
+            }
+        }
+    }
+
+    if (panel_handle == NULL) {
+        // A candidate's panel couldn't be created and the old one neither
+        ESP_LOGE(TAG, "Autotune lost the RGB panel, skipping the rest");
+        display_unlock();
+        return -3;
+    }
+
+    ESP_LOGI(TAG, "+-------+--------+-------+----------+----------+-----------+");
+    ESP_LOGI(TAG, "| bands | bounce | place |   avg us |   max us | underruns |");
+    ESP_LOGI(TAG, "+-------+--------+-------+----------+----------+-----------+");
+    for (size_t i = 0; i < n; i++) {
+        const tune_result_t *res = &results[i];
+        if (!res->ok) {
+            ESP_LOGI(TAG, "| %5d | %6d | %-5s |   (does not fit in memory)       |",
+                     res->cfg.band_lines, res->cfg.bounce_lines,
+                     res->cfg.bands_in_psram ? "PSRAM" : "SRAM");
+            continue;
+        }
+        ESP_LOGI(TAG, "| %5d | %6d | %-5s | %8lu | %8lu | %9lu |%s",
+                 res->cfg.band_lines, res->cfg.bounce_lines,
+                 res->cfg.bands_in_psram ? "PSRAM" : "SRAM",
+                 (unsigned long)res->avg_us, (unsigned long)res->max_us,
+                 (unsigned long)res->underruns, i == best ? " <- best" : "");
+    }
+    ESP_LOGI(TAG, "+-------+--------+-------+----------+----------+-----------+");
+
+    int ret = 0;
+    if (!results[best].ok || apply_buf_config(&results[best].cfg) != ESP_OK) {
+        ESP_LOGE(TAG, "Autotune found no usable geometry, restoring previous");
+        apply_buf_config(&start_cfg);
+        ret = -2;
+    } else if (save_buf_config(&buf_cfg) == ESP_OK) {
+        buf_cfg_from_nvs = true;
+    }
+
+    pendingScreen = SCREEN_ID_MAIN_SCREEN;
+    ui_tick();
+
+    display_unlock();
+    return ret;
+}
+#else
+int display_autotune(int frames_per_screen)
+{
+    // Direct mode renders into the panel framebuffers - no band geometry to tune
+    ESP_LOGW(TAG, "Buffer autotune is only available in partial render mode");
+    return -1;
+}
+#endif
+
+/**
+ * Get the buffer geometry in use
+ */
+void display_get_buf_config(display_buf_config_t *cfg)
+{
+    if (cfg != NULL) {
+        *cfg = buf_cfg;
+    }
+}
+
+/**
+ * Get the number of bounce buffer underruns since boot
+ */
+uint32_t display_get_underrun_count(void)
+{
+    return panel_underruns;
+}
+
+/**
+ * Set the screen timeout (0 = never)
+ */
+void display_set_idle_timeout(uint32_t timeout_ms)
+{
+    idle_timeout_ms = timeout_ms;
+
+    // Let the render task re-evaluate (wakes it if the timeout was disabled)
+    if (display_idle && timeout_ms == 0 && wake_sem != NULL) {
+        xSemaphoreGive(wake_sem);
+    }
+}
+
+/**
+ * Wake the display / reset the screen timeout
+ */
+void display_wake(void)
+{
+    activity_pending = true;
+    if (display_idle && wake_sem != NULL) {
+        xSemaphoreGive(wake_sem);
+    }
+}
+
+/**
+ * Check whether the display is idle
+ */
+bool display_is_idle(void)
+{
+    return display_idle;
+}
+
+/**
+ * Get render loop period/jitter statistics
+ */
+void display_get_render_stats(display_render_stats_t *stats)
+{
+    if (stats != NULL) {
+        *stats = render_stats;
+    }
+}
+
+/**
+ * Get flush pipeline statistics
+ */
+void display_get_flush_stats(display_flush_stats_t *stats)
+{
+    if (stats != NULL) {
+        taskENTER_CRITICAL(&flush_stats_lock);
+        *stats = flush_stats;
+        taskEXIT_CRITICAL(&flush_stats_lock);
+    }
+}
+
+/**
+ * Reset flush pipeline statistics
+ */
+void display_reset_flush_stats(void)
+{
+    taskENTER_CRITICAL(&flush_stats_lock);
+    memset(&flush_stats, 0, sizeof(flush_stats));
+    taskEXIT_CRITICAL(&flush_stats_lock);
+    last_flush_exit_us = 0;
+    last_flush_was_last = true;
+}
+
+/**
+ * Get elapsed time in milliseconds
+ */
+uint32_t display_get_tick_ms(void)
+{
+    return tick_get_cb();
 }
 
 /**
@@ -519,6 +2201,29 @@ void display_shutdown(void)
 {
     ESP_LOGI(TAG, "Shutting down display...");
 
+    // Stop rendering - the task exits on its own between frames, so it can't
+    // die mid-frame or while holding lvgl_mutex
+    if (render_task_handle != NULL) {
+        render_stop_waiter = xTaskGetCurrentTaskHandle();
+        render_stop = true;
+        xSemaphoreGive(wake_sem);  // Out of idle
+        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RENDER_STOP_TIMEOUT_MS)) > 0) {
+            render_task_handle = NULL;
+        } else {
+            // Still in a frame; it stops at its next lock (held below)
+            ESP_LOGW(TAG, "Render task didn't stop within %dms", RENDER_STOP_TIMEOUT_MS);
+        }
+    }
+
+    // Keep display_lock() users out of LVGL while the panel goes away
+    bool locked = false;
+    if (lvgl_mutex != NULL) {
+        locked = xSemaphoreTakeRecursive(lvgl_mutex, pdMS_TO_TICKS(RENDER_STOP_TIMEOUT_MS)) == pdTRUE;
+        if (!locked) {
+            ESP_LOGW(TAG, "LVGL lock busy, shutting the panel down without it");
+        }
+    }
+
     // Turn off backlight first
     gpio_set_level(PIN_BACKLIGHT1, 0);
 
@@ -536,6 +2241,10 @@ void display_shutdown(void)
         panel_handle = NULL;
     }
 
+    if (locked) {
+        xSemaphoreGiveRecursive(lvgl_mutex);
+    }
+
     // Short delay to let everything settle
     vTaskDelay(pdMS_TO_TICKS(100));
 
@@ -14,6 +14,63 @@
 extern "C" {
 #endif
 
+/**
+ * Callback posted to the render task (runs with LVGL locked)
+ */
+typedef void (*display_ui_cb_t)(void *arg);
+
+/**
+ * Render loop statistics
+ * Period is measured between the starts of consecutive render iterations;
+ * jitter is its deviation from the target period.
+ */
+typedef struct {
+    uint32_t frames;            // Render loop iterations measured
+    uint32_t period_target_us;  // Nominal loop period
+    uint32_t period_min_us;
+    uint32_t period_max_us;
+    uint64_t period_sum_us;     // Divide by frames for the average
+    uint64_t jitter_sum_us;     // Divide by frames for the mean absolute jitter
+    uint32_t jitter_max_us;
+    uint32_t late_frames;       // Iterations that took more than twice the target period
+    uint32_t cycle_max_us;      // Longest LVGL + ui_tick cycle
+} display_render_stats_t;
+
+/**
+ * Touch point reported by the GT911
+ */
+#define DISPLAY_TOUCH_MAX_POINTS 5
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    uint8_t id;             // GT911 track id (stable while the finger is down)
+} display_touch_point_t;
+
+/**
+ * Flush pipeline statistics
+ * Compare copy_us with render_us to see how much of the framebuffer copy
+ * is hidden behind LVGL rendering the next band
+ */
+typedef struct {
+    uint32_t flushes;       // Bands flushed
+    uint32_t dma_flushes;   // Bands copied by the GDMA async memcpy engine
+    uint32_t cpu_flushes;   // Bands copied by the CPU (narrow areas, fallback)
+    uint32_t dma_stalls;    // Bands where LVGL had to wait for the previous DMA copy
+    uint64_t copy_us;       // Total time spent copying bands to the framebuffer
+    uint64_t render_us;     // Total time LVGL spent between bands of a frame
+} display_flush_stats_t;
+
+/**
+ * Draw/bounce buffer geometry
+ * Chosen by display_autotune() and stored in NVS for later boots.
+ */
+typedef struct {
+    uint16_t band_lines;    // LVGL draw buffer height (partial render mode)
+    uint16_t bounce_lines;  // RGB panel bounce buffer height
+    bool bands_in_psram;    // Draw buffers in PSRAM instead of internal SRAM
+} display_buf_config_t;
+
 /**
  * Initialize the display, touch, and LVGL
  * This must be called before any LVGL operations
@@ -24,10 +81,106 @@ int display_init(void);
 
 /**
  * Run LVGL timer handler
- * Call this periodically (every 5-10ms) from the main loop
+ * Call this periodically (every 5-10ms) from the main loop, unless the
+ * render task has been started with display_start_render_task()
  */
 void display_tick(void);
 
+/**
+ * Start the LVGL render task (pinned to core 1)
+ * From then on LVGL must only be used from the render task, from inside
+ * display_lock()/display_unlock(), or through display_ui_post().
+ *
+ * @return 0 on success, negative on error (keep calling display_tick)
+ */
+int display_start_render_task(void);
+
+/**
+ * Lock LVGL for direct use from another task
+ *
+ * @param timeout_ms Maximum wait, negative to wait forever
+ * @return true if the lock was taken
+ */
+bool display_lock(int timeout_ms);
+
+/**
+ * Release the LVGL lock taken with display_lock()
+ */
+void display_unlock(void);
+
+/**
+ * Queue a UI update to run on the render task
+ * Safe to call from any task (not from ISRs).
+ *
+ * @return false if the queue is full
+ */
+bool display_ui_post(display_ui_cb_t cb, void *arg);
+
+/**
+ * Set the screen timeout
+ * After this long without touch input the render task goes idle: LVGL stops
+ * rendering (ui_tick and display_ui_post callbacks keep running at a slow
+ * rate), the backlight is turned off and the pixel clock lowered. A touch or
+ * display_wake() resumes normal rendering within one frame.
+ * Needs the render task (display_start_render_task).
+ *
+ * @param timeout_ms Inactivity timeout, 0 = never
+ */
+void display_set_idle_timeout(uint32_t timeout_ms);
+
+/**
+ * Wake the display from idle and restart the screen timeout
+ * Safe to call from any task, e.g. when an NFC tag is detected.
+ */
+void display_wake(void);
+
+/**
+ * Check whether the display is idle (backlight off, not rendering)
+ */
+bool display_is_idle(void);
+
+/**
+ * Get render loop period/jitter statistics
+ */
+void display_get_render_stats(display_render_stats_t *stats);
+
+/**
+ * Run the render benchmark
+ * Loads each main screen and times full-screen redraws (render + flush).
+ * Results are logged with the number of software draw units, so run it in a
+ * DISPLAY_DRAW_UNITS=1 and a DISPLAY_DRAW_UNITS=2 build to compare.
+ * Build with DISPLAY_RENDER_BENCHMARK=1 to run it automatically after boot.
+ *
+ * @param frames_per_screen Full redraws timed on each screen
+ * @return Average frame time in microseconds, negative on error
+ */
+int32_t display_run_render_benchmark(int frames_per_screen);
+
+/**
+ * Calibrate the buffer geometry
+ * Renders the reference screens with every combination of band height,
+ * bounce buffer size and draw buffer placement, logs a comparison table
+ * (frame time, PSRAM underruns) and stores the best geometry in NVS.
+ * The best geometry is applied immediately. The screen flickers while the
+ * panel is recreated for each bounce buffer size.
+ * Build with DISPLAY_AUTOTUNE=1 to run it after boot when NVS has no result.
+ *
+ * @param frames_per_screen Full redraws timed per screen and candidate
+ * @return 0 on success, negative on error
+ */
+int display_autotune(int frames_per_screen);
+
+/**
+ * Get the buffer geometry in use
+ */
+void display_get_buf_config(display_buf_config_t *cfg);
+
+/**
+ * Get the number of bounce buffer underruns since boot
+ * (frames where refilling the bounce buffers from PSRAM fell behind scanout)
+ */
+uint32_t display_get_underrun_count(void);
+
 /**
  * Get elapsed time in milliseconds
  * Used for LVGL tick
@@ -37,9 +190,29 @@ uint32_t display_get_tick_ms(void);
 /**
  * Set backlight brightness (0-100%)
  * Uses I2C to STC8H1K28 at address 0x30
+ * While the display is idle the level is stored and applied on wake.
  */
 void display_set_backlight_hw(uint8_t brightness_percent);
 
+/**
+ * Get all current touch points (for multi-touch gestures)
+ * LVGL itself only receives the first point.
+ *
+ * @return number of points copied (0 = no finger down)
+ */
+int display_get_touch_points(display_touch_point_t *points, int max_points);
+
+/**
+ * Get flush pipeline statistics (copy vs render time)
+ */
+void display_get_flush_stats(display_flush_stats_t *stats);
+
+/**
+ * Reset flush pipeline statistics
+ * Call before a screen transition to measure that screen alone
+ */
+void display_reset_flush_stats(void);
+
 /**
  * Shutdown display before reboot
  * Properly deinitializes the LCD panel to prevent display shift on soft restart
@@ -14,6 +14,9 @@
 #include "ui_nfc.h"
 #include "ui_nfc_card.h"
 #include "ui_status_bar.h"
+#include "ui_state.h"
+#include "ui_shadow.h"
+#include "ui_mem.h"
 #include "screens.h"
 #include "images.h"
 #include "actions.h"
@@ -34,9 +37,10 @@ static const char *TAG = "ui";
 // =============================================================================
 //
 // The EEZ-generated `objects` struct contains pointers to ALL widgets across
-// ALL screens. However, we only keep ONE screen in memory at a time to save RAM.
-// When a screen is deleted via delete_all_screens(), its child widget pointers
-// in `objects` become STALE (pointing to freed memory).
+// ALL screens. Only the screen cache (main, AMS overview, scan result) keeps
+// more than ONE screen in memory, and cached screens can be evicted at any
+// transition. When a screen is deleted, its child widget pointers in `objects`
+// become STALE (pointing to freed memory).
 //
 // RULE: Only access `objects.xxx` if the parent screen is currently active.
 //
@@ -52,7 +56,7 @@ static const char *TAG = "ui";
 //       lv_obj_set_style_...            // Accessing freed memory!
 //   }
 //
-// The NULL check doesn't help because delete_all_screens() only NULLs the
+// The NULL check doesn't help because screen deletion only NULLs the
 // screen pointers, not every child widget pointer.
 //
 // When adding new code that accesses objects:
@@ -259,36 +263,259 @@ void wire_spool_details_buttons(void) {
 }
 
 // =============================================================================
-// Screen Lifecycle
+// Screen Lifecycle and Screen Cache
 // =============================================================================
+// The screens operators tap between constantly stay alive when they navigate
+// away, so going back only reloads the screen instead of rebuilding thousands
+// of objects and re-wiring every handler. LVGL doesn't render screens that
+// aren't loaded, so a cached screen costs heap but no drawing time. Cached
+// screens are evicted least recently used first once their combined heap
+// cost exceeds UI_SCREEN_CACHE_BUDGET, or when internal SRAM runs low (the
+// PSRAM heap would hide that).
+
+#ifndef UI_SCREEN_CACHE
+#define UI_SCREEN_CACHE 1  // 0 = rebuild every screen on every navigation
+#endif
+#define UI_SCREEN_CACHE_BUDGET      (256U * 1024U)
+#define UI_SCREEN_CACHE_MIN_FREE    (64U * 1024U)
+
+typedef struct {
+    enum ScreensEnum id;
+    lv_obj_t **screen;      // Screen pointer in `objects`
+    bool cacheable;
+    uint32_t cost;          // Heap used when the screen was built
+    uint32_t last_used;     // Navigation sequence number
+    lv_obj_t **clock;       // Top bar clock label (bound to ui_subject_clock)
+    lv_obj_t **wifi_icon;   // Top bar WiFi icon (bound to ui_subject_wifi)
+} screen_slot_t;
+
+static screen_slot_t screen_slots[] = {
+    {SCREEN_ID_MAIN_SCREEN, &objects.main_screen, true, 0, 0,
+     &objects.top_bar_clock, &objects.top_bar_wifi_signal},
+    {SCREEN_ID_AMS_OVERVIEW, &objects.ams_overview, true, 0, 0,
+     &objects.ams_screen_top_bar_clock, &objects.ams_screen_top_bar_wifi_signal},
+    {SCREEN_ID_SCAN_RESULT, &objects.scan_result, true, 0, 0,
+     &objects.scan_screen_top_bar_label_clock, &objects.scan_screen_top_bar_icon_wifi_signal},
+    {SCREEN_ID_SPOOL_DETAILS, &objects.spool_details, false, 0, 0,
+     &objects.spool_screen_top_bar_label_clock, &objects.spool_screen_top_bar_icon_wifi_signal},
+    {SCREEN_ID_SETTINGS_SCREEN, &objects.settings_screen, false, 0, 0,
+     &objects.settings_screen_top_bar_label_clock, &objects.settings_screen_top_bar_icon_wifi_signal},
+    {SCREEN_ID_SETTINGS_WIFI_SCREEN, &objects.settings_wifi_screen, false, 0, 0,
+     &objects.settings_wifi_screen_top_bar_label_clock, &objects.settings_wifi_screen_top_bar_icon_wifi_signal},
+    {SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN, &objects.settings_printer_add_screen, false, 0, 0,
+     &objects.settings_printer_add_screen_top_bar_label_clock, &objects.settings_printer_add_screen_top_bar_icon_wifi_signal},
+    {SCREEN_ID_SETTINGS_DISPLAY_SCREEN, &objects.settings_display_screen, false, 0, 0,
+     &objects.settings_display_screen_top_bar_label_clock, &objects.settings_display_screen_top_bar_icon_wifi_signal},
+    {SCREEN_ID_SETTINGS_UPDATE_SCREEN, &objects.settings_update_screen, false, 0, 0,
+     &objects.settings_update_screen_top_bar_label_clock, &objects.settings_update_screen_top_bar_icon_wifi_signal},
+};
+#define SCREEN_SLOT_COUNT (sizeof(screen_slots) / sizeof(screen_slots[0]))
+
+static uint32_t nav_seq = 0;
+static ui_nav_stats_t nav_stats;
+
+// Transition waiting for its first display refresh (nav_refr_ready_cb)
+static struct {
+    bool active;
+    enum ScreensEnum from;
+    enum ScreensEnum to;
+    uint32_t start;
+    bool cached;
+} nav_pending;
+
+static screen_slot_t *find_screen_slot(enum ScreensEnum id) {
+    for (size_t i = 0; i < SCREEN_SLOT_COUNT; i++) {
+        if (screen_slots[i].id == id) {
+            return &screen_slots[i];
+        }
+    }
+    return NULL;
+}
+
+static void delete_screen(screen_slot_t *slot) {
+    if (!*slot->screen) return;
+    reset_backend_screen_state(slot->id);
+    lv_obj_delete(*slot->screen);
+    *slot->screen = NULL;
+    slot->cost = 0;
+}
+
+/**
+ * Evict cached screens (least recently used first) until the cache fits its
+ * budget. The screen being navigated to is never evicted.
+ */
+static void evict_screens(enum ScreensEnum keep) {
+    while (1) {
+        uint32_t total = 0;
+        screen_slot_t *lru = NULL;
+        for (size_t i = 0; i < SCREEN_SLOT_COUNT; i++) {
+            screen_slot_t *slot = &screen_slots[i];
+            if (!*slot->screen || !slot->cacheable) continue;
+            total += slot->cost;
+            if (slot->id != keep && (!lru || slot->last_used < lru->last_used)) {
+                lru = slot;
+            }
+        }
+        if (!lru || (total <= UI_SCREEN_CACHE_BUDGET && ui_mem_internal_free() >= UI_SCREEN_CACHE_MIN_FREE)) {
+            return;
+        }
+        UI_LOGI("Screen cache: evicting screen %d (%lu bytes, cache %lu bytes)",
+                (int)lru->id, (unsigned long)lru->cost, (unsigned long)total);
+        delete_screen(lru);
+    }
+}
 
-void delete_all_screens(void) {
-    // Clear module state via cleanup functions
+/**
+ * Delete the screens that aren't kept in the cache
+ * The target screen is kept only when it is cacheable (revisiting a settings
+ * page rebuilds it, as before).
+ */
+static void release_screens(enum ScreensEnum target) {
+    // Clear module state for the screens being deleted
     ui_wifi_cleanup();
     ui_printer_cleanup();
     ui_settings_cleanup();       // Clear keyboard row pointer
     ui_nfc_card_cleanup();       // Clear NFC card dynamic elements
-    reset_notification_state();  // Clear notification dots before deleting screens
-    reset_backend_ui_state();    // Clear all dynamic UI state (AMS widgets, labels, etc.)
     cleanup_hardware_screens();  // Delete programmatic NFC/Scale screens
 
-    lv_obj_t **screens[] = {
-        &objects.main_screen,
-        &objects.ams_overview,
-        &objects.scan_result,
-        &objects.spool_details,
-        &objects.settings_screen,
-        &objects.settings_wifi_screen,
-        &objects.settings_printer_add_screen,
-        &objects.settings_display_screen,
-        &objects.settings_update_screen,
-    };
-    for (size_t i = 0; i < sizeof(screens)/sizeof(screens[0]); i++) {
-        if (*screens[i]) {
-            lv_obj_delete(*screens[i]);
-            *screens[i] = NULL;
+    for (size_t i = 0; i < SCREEN_SLOT_COUNT; i++) {
+        screen_slot_t *slot = &screen_slots[i];
+        if (*slot->screen && (!UI_SCREEN_CACHE || !slot->cacheable)) {
+            delete_screen(slot);
         }
     }
+    evict_screens(target);
+}
+
+/**
+ * Create an EEZ screen and wire its handlers (once per screen instance)
+ */
+static void build_screen(enum ScreensEnum screen) {
+    switch ((int)screen) {
+        case SCREEN_ID_MAIN_SCREEN:
+            create_screen_main_screen();
+            wire_main_buttons();
+            ui_shadow_bake_tree(objects.main_screen);
+            break;
+        case SCREEN_ID_AMS_OVERVIEW:
+            create_screen_ams_overview();
+            // Hide AMS panel immediately after creation to prevent flicker
+            // Must happen BEFORE any potential render cycle
+            if (objects.ams_screen_ams_panel) {
+                lv_obj_add_flag(objects.ams_screen_ams_panel, LV_OBJ_FLAG_HIDDEN);
+            }
+            wire_ams_overview_buttons();
+            ui_shadow_bake_tree(objects.ams_overview);
+            break;
+        case SCREEN_ID_SCAN_RESULT:
+            create_screen_scan_result();
+            wire_scan_result_buttons();
+            ui_shadow_bake_tree(objects.scan_result);
+            break;
+        case SCREEN_ID_SPOOL_DETAILS:
+            create_screen_spool_details();
+            wire_spool_details_buttons();
+            break;
+        case SCREEN_ID_SETTINGS_SCREEN:
+            create_screen_settings_screen();
+            wire_settings_buttons();
+            wire_printers_tab();
+            update_printers_list();  // Refresh printer list after returning from edit
+            update_wifi_ui_state();
+            if (pending_settings_tab >= 0) {
+                select_settings_tab(pending_settings_tab);
+                pending_settings_tab = -1;
+            }
+            break;
+        case SCREEN_ID_SETTINGS_WIFI_SCREEN:
+            create_screen_settings_wifi_screen();
+            wire_settings_subpage_buttons(objects.settings_wifi_screen_top_bar_icon_back);
+            wire_wifi_settings_buttons();
+            break;
+        case SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN:
+            create_screen_settings_printer_add_screen();
+            wire_settings_subpage_buttons(objects.settings_printer_add_screen_top_bar_icon_back);
+            wire_printer_add_buttons();
+            break;
+        case SCREEN_ID_SETTINGS_DISPLAY_SCREEN:
+            create_screen_settings_display_screen();
+            wire_settings_subpage_buttons(objects.settings_display_screen_top_bar_icon_back);
+            wire_display_buttons();
+            break;
+        case SCREEN_ID_SETTINGS_UPDATE_SCREEN:
+            create_screen_settings_update_screen();
+            wire_settings_subpage_buttons(objects.settings_update_screen_top_bar_icon_back);
+            wire_update_buttons();
+            break;
+    }
+}
+
+/**
+ * Make an EEZ screen ready to load - from the cache or freshly built
+ *
+ * @return true if the screen came from the cache
+ */
+static bool prepare_screen(enum ScreensEnum screen) {
+    screen_slot_t *slot = find_screen_slot(screen);
+    bool cached = slot && *slot->screen;
+
+    if (!cached) {
+        uint32_t free_before = ui_mem_heap_free();
+        build_screen(screen);
+        uint32_t free_after = ui_mem_heap_free();
+        if (slot) {
+            slot->cost = free_before > free_after ? free_before - free_after : 0;
+            // Top bar follows the published state for the screen's lifetime
+            ui_state_bind_clock(*slot->clock);
+            ui_state_bind_wifi_icon(*slot->wifi_icon);
+        }
+    }
+    if (slot) {
+        slot->last_used = ++nav_seq;
+    }
+
+    // Per-visit state (the screen may have been shown before)
+    if (screen == SCREEN_ID_MAIN_SCREEN) {
+        ui_nfc_card_init();
+    } else if (screen == SCREEN_ID_SCAN_RESULT) {
+        ui_scan_result_init();
+    }
+    return cached;
+}
+
+static void record_nav_latency(enum ScreensEnum from, enum ScreensEnum to, uint32_t ms, bool cached) {
+    if (cached) {
+        nav_stats.hits++;
+        nav_stats.hit_total_ms += ms;
+    } else {
+        nav_stats.misses++;
+        nav_stats.miss_total_ms += ms;
+    }
+    nav_stats.last_ms = ms;
+    if (ms > nav_stats.max_ms) {
+        nav_stats.max_ms = ms;
+    }
+    UI_LOGI("Navigation %d -> %d: %lums (%s)", (int)from, (int)to, (unsigned long)ms,
+            cached ? "cached" : "built");
+}
+
+/**
+ * End of a navigation measurement: LVGL finished the first refresh after
+ * the screen load, i.e. the new screen is rendered and handed to flush_cb
+ */
+static void nav_refr_ready_cb(lv_event_t *e) {
+    (void)e;
+    if (nav_pending.active) {
+        nav_pending.active = false;
+        record_nav_latency(nav_pending.from, nav_pending.to, lv_tick_elaps(nav_pending.start),
+                           nav_pending.cached);
+    }
+}
+
+void ui_get_nav_stats(ui_nav_stats_t *stats) {
+    if (stats) {
+        *stats = nav_stats;
+    }
 }
 
 // =============================================================================
@@ -299,11 +526,16 @@ void ui_init() {
     // Load saved printers from NVS
     load_printers_from_nvs();
 
+    // Published backend/WiFi/NFC/scale state - screens bind to it when built
+    ui_state_init();
+    ui_backend_bind_state();
+
     // Initialize theme
     lv_display_t *dispp = lv_display_get_default();
     if (dispp) {
         lv_theme_t *theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED), true, LV_FONT_DEFAULT);
         lv_display_set_theme(dispp, theme);
+        lv_display_add_event_cb(dispp, nav_refr_ready_cb, LV_EVENT_REFR_READY, NULL);
     }
 
     // Show splash screen first
@@ -336,9 +568,14 @@ void ui_tick() {
 
         // Track which screen we're leaving for splash cleanup
         enum ScreensEnum leavingScreen = (enum ScreensEnum)(currentScreen + 1);
+        uint32_t nav_start = lv_tick_get();
+        bool nav_cached = false;
+        ui_mem_screen_begin();
 
-        // Clean up status bar before any screen transition
-        ui_status_bar_cleanup();
+        // Clean up status bar and notification dots before any screen transition
+        // (the screen being left may stay alive in the screen cache)
+        ui_status_bar_detach();
+        reset_backend_refresh_state();
 
         // For programmatic screens, create and load BEFORE deleting old screens
         // This prevents LVGL from having an invalid active screen during transition
@@ -354,74 +591,19 @@ void ui_tick() {
             }
             // Load it immediately so LVGL has a valid active screen
             loadScreen(screen);
-            // Now delete old EEZ screens (programmatic screens are protected in cleanup)
-            delete_all_screens();
+            // Now release old EEZ screens (programmatic screens are protected in cleanup)
+            release_screens(screen);
             // Clean up splash if we were on it
             if ((int)leavingScreen == SCREEN_ID_SPLASH_SCREEN) {
                 cleanup_splash_screen();
             }
         } else {
             // Standard EEZ screen transition
-            delete_all_screens();
-
-            switch ((int)screen) {
-                case SCREEN_ID_MAIN_SCREEN:
-                    create_screen_main_screen();
-                    wire_main_buttons();
-                    ui_nfc_card_init();
-                    break;
-                case SCREEN_ID_AMS_OVERVIEW:
-                    create_screen_ams_overview();
-                    // Hide AMS panel immediately after creation to prevent flicker
-                    // Must happen BEFORE any potential render cycle
-                    if (objects.ams_screen_ams_panel) {
-                        lv_obj_add_flag(objects.ams_screen_ams_panel, LV_OBJ_FLAG_HIDDEN);
-                    }
-                    wire_ams_overview_buttons();
-                    break;
-                case SCREEN_ID_SCAN_RESULT:
-                    create_screen_scan_result();
-                    wire_scan_result_buttons();
-                    ui_scan_result_init();
-                    break;
-                case SCREEN_ID_SPOOL_DETAILS:
-                    create_screen_spool_details();
-                    wire_spool_details_buttons();
-                    break;
-                case SCREEN_ID_SETTINGS_SCREEN:
-                    create_screen_settings_screen();
-                    wire_settings_buttons();
-                    wire_printers_tab();
-                    update_printers_list();  // Refresh printer list after returning from edit
-                    update_wifi_ui_state();
-                    if (pending_settings_tab >= 0) {
-                        select_settings_tab(pending_settings_tab);
-                        pending_settings_tab = -1;
-                    }
-                    break;
-                case SCREEN_ID_SETTINGS_WIFI_SCREEN:
-                    create_screen_settings_wifi_screen();
-                    wire_settings_subpage_buttons(objects.settings_wifi_screen_top_bar_icon_back);
-                    wire_wifi_settings_buttons();
-                    break;
-                case SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN:
-                    create_screen_settings_printer_add_screen();
-                    wire_settings_subpage_buttons(objects.settings_printer_add_screen_top_bar_icon_back);
-                    wire_printer_add_buttons();
-                    break;
-                case SCREEN_ID_SETTINGS_DISPLAY_SCREEN:
-                    create_screen_settings_display_screen();
-                    wire_settings_subpage_buttons(objects.settings_display_screen_top_bar_icon_back);
-                    wire_display_buttons();
-                    break;
-                case SCREEN_ID_SETTINGS_UPDATE_SCREEN:
-                    create_screen_settings_update_screen();
-                    wire_settings_subpage_buttons(objects.settings_update_screen_top_bar_icon_back);
-                    wire_update_buttons();
-                    break;
-            }
+            release_screens(screen);
+            nav_cached = prepare_screen(screen);
 
             loadScreen(screen);
+            evict_screens(screen);
 
             // Initialize status bar AFTER screen is loaded (so lv_scr_act() returns correct screen)
             if (screen == SCREEN_ID_MAIN_SCREEN) {
@@ -436,18 +618,19 @@ void ui_tick() {
             }
         }
 
-        // Force immediate backend UI update for the new screen
-        // This ensures clock, dropdown, etc. are populated immediately
-        update_backend_ui();
+        // Recorded once the next display refresh has drawn the new screen
+        nav_pending.active = true;
+        nav_pending.from = leavingScreen;
+        nav_pending.to = screen;
+        nav_pending.start = nav_start;
+        nav_pending.cached = nav_cached;
+        ui_mem_screen_loaded(screen, lv_screen_active());
     }
 
-    // Poll backend/UI status (every ~20 ticks = 100ms for faster updates)
-    static int wifi_poll_counter = 0;
-    wifi_poll_counter++;
-    if (wifi_poll_counter >= 20) {
-        wifi_poll_counter = 0;
-
-        // Update WiFi settings screen if active
+    // Sample backend/WiFi/NFC/scale state (every UI_STATE_POLL_MS). Widgets
+    // bound to ui_state subjects update themselves when a value changes.
+    if (ui_state_poll()) {
+        // Screens that show live readings rather than published state
         int screen_id = currentScreen + 1;
         if (screen_id == SCREEN_ID_SETTINGS_SCREEN || screen_id == SCREEN_ID_SETTINGS_WIFI_SCREEN) {
             update_wifi_ui_state();
@@ -456,15 +639,9 @@ void ui_tick() {
         // Update firmware update screen if active
         update_firmware_ui();
 
-        // Update backend status UI (main screen printer info)
-        UI_LOGI("Calling update_backend_ui");
-        update_backend_ui();
-        UI_LOGI("update_backend_ui returned");
-
         // Update NFC card on main screen and AMS overview (tag popup should appear on both)
         if (screen_id == SCREEN_ID_MAIN_SCREEN || screen_id == SCREEN_ID_AMS_OVERVIEW) {
             ui_nfc_card_update();
-            ui_status_bar_update();
         }
 
         // Update weight display on scan_result screen
@@ -483,76 +660,12 @@ void ui_tick() {
         if (screen_id == SCREEN_ID_KEYBOARD_LAYOUT_SCREEN) {
             update_keyboard_layout_screen();
         }
-
-        // Update WiFi icon for CURRENT screen only (other screen objects are freed)
-        WifiStatus status;
-        wifi_get_status(&status);
-
-        // Get the WiFi icon for the current screen
-        lv_obj_t *wifi_icon = NULL;
-        switch ((int)screen_id) {
-            case SCREEN_ID_MAIN_SCREEN:
-                wifi_icon = objects.top_bar_wifi_signal;
-                break;
-            case SCREEN_ID_AMS_OVERVIEW:
-                wifi_icon = objects.ams_screen_top_bar_wifi_signal;
-                break;
-            case SCREEN_ID_SCAN_RESULT:
-                wifi_icon = objects.scan_screen_top_bar_icon_wifi_signal;
-                break;
-            case SCREEN_ID_SPOOL_DETAILS:
-                wifi_icon = objects.spool_screen_top_bar_icon_wifi_signal;
-                break;
-            case SCREEN_ID_SETTINGS_SCREEN:
-                wifi_icon = objects.settings_screen_top_bar_icon_wifi_signal;
-                break;
-            case SCREEN_ID_SETTINGS_WIFI_SCREEN:
-                wifi_icon = objects.settings_wifi_screen_top_bar_icon_wifi_signal;
-                break;
-            case SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN:
-                wifi_icon = objects.settings_printer_add_screen_top_bar_icon_wifi_signal;
-                break;
-            case SCREEN_ID_SETTINGS_DISPLAY_SCREEN:
-                wifi_icon = objects.settings_display_screen_top_bar_icon_wifi_signal;
-                break;
-            case SCREEN_ID_SETTINGS_UPDATE_SCREEN:
-                wifi_icon = objects.settings_update_screen_top_bar_icon_wifi_signal;
-                break;
-            default:
-                break;
-        }
-
-        // Style the WiFi icon based on connection state and signal strength
-        if (wifi_icon) {
-            if (status.state == 3) {
-                // Connected - color based on RSSI signal strength
-                int8_t rssi = status.rssi;
-                lv_color_t color;
-                if (rssi > -50) {
-                    color = lv_color_hex(0xff00ff00);  // Excellent - bright green
-                } else if (rssi > -65) {
-                    color = lv_color_hex(0xff88ff00);  // Good - yellow-green
-                } else if (rssi > -75) {
-                    color = lv_color_hex(0xffffaa00);  // Fair - orange/yellow
-                } else {
-                    color = lv_color_hex(0xffff5555);  // Poor - red
-                }
-                lv_obj_set_style_image_recolor(wifi_icon, color, LV_PART_MAIN);
-                lv_obj_set_style_image_recolor_opa(wifi_icon, 255, LV_PART_MAIN);
-                lv_obj_set_style_opa(wifi_icon, 255, LV_PART_MAIN);
-            } else if (status.state == 2) {
-                // Connecting - yellow, full opacity
-                lv_obj_set_style_image_recolor(wifi_icon, lv_color_hex(0xffffaa00), LV_PART_MAIN);
-                lv_obj_set_style_image_recolor_opa(wifi_icon, 255, LV_PART_MAIN);
-                lv_obj_set_style_opa(wifi_icon, 255, LV_PART_MAIN);
-            } else {
-                // Disconnected - dimmed (30% opacity), no recolor
-                lv_obj_set_style_image_recolor_opa(wifi_icon, 0, LV_PART_MAIN);
-                lv_obj_set_style_opa(wifi_icon, 80, LV_PART_MAIN);
-            }
-        }
     }
 
+    // Backend UI (printer info, AMS, dropdowns) - no-op unless a subject it
+    // observes changed or the screen changed
+    update_backend_ui();
+
     // Only tick EEZ screens (0-8), not programmatic screens (99+)
     if (currentScreen >= 0 && currentScreen < 9) {
         tick_screen(currentScreen);
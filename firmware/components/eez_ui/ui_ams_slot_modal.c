@@ -4,6 +4,9 @@
  */
 
 #include "ui_ams_slot_modal.h"
+#include "ui_mem.h"
+#include "ui_preset_search.h"
+#include "ui_async.h"
 #include "screens.h"
 #include "lvgl.h"
 #include <stdio.h>
@@ -14,8 +17,6 @@
 #ifdef ESP_PLATFORM
 #include "ui_internal.h"
 #include "esp_log.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #else
 #include "backend_client.h"
 #define ESP_LOGI(tag, fmt, ...) printf("[%s] " fmt "\n", tag, ##__VA_ARGS__)
@@ -28,12 +29,25 @@ static const char *TAG = "ui_ams_slot_modal";
 // Constants
 // =============================================================================
 
-#define MAX_PRESETS 100
+#define MAX_PRESETS UI_PRESET_SEARCH_MAX_PRESETS
 #define MAX_K_PROFILES 50
 #define MAX_CATALOG_COLORS 50
+#define CATALOG_SWATCHES 20                        // Catalog colors shown
+#define CATALOG_CACHE_SIZE 8                       // Brand/material searches kept
+#define CATALOG_CACHE_TTL_MS (10 * 60 * 1000)      // Kept across modal sessions
 #define QUICK_COLORS_COUNT 8
 #define EXTENDED_COLORS_COUNT 24
 
+// Preset list geometry (rows are recycled, see populate_preset_list)
+#define PRESET_LIST_WIDTH 440
+#define PRESET_LIST_HEIGHT 250
+#define PRESET_LIST_PAD 8
+#define PRESET_ROW_HEIGHT 42
+#define PRESET_ROW_GAP 6
+#define PRESET_ROW_PITCH (PRESET_ROW_HEIGHT + PRESET_ROW_GAP)
+// Enough rows to cover the full-height viewport with one partially visible row at each edge
+#define PRESET_ROW_POOL ((PRESET_LIST_HEIGHT - 2 * PRESET_LIST_PAD + PRESET_ROW_PITCH - 1) / PRESET_ROW_PITCH + 1)
+
 // PSRAM attribute for large arrays on ESP32
 #ifdef ESP_PLATFORM
 #include "esp_attr.h"
@@ -100,10 +114,9 @@ static lv_obj_t *g_success_overlay = NULL;
 static lv_obj_t *g_loading_spinner = NULL;
 static lv_obj_t *g_loading_label = NULL;
 static bool g_data_loaded = false;
-#ifdef ESP_PLATFORM
-static volatile bool g_data_fetch_complete = false;  // Set by task when HTTP done
-static TaskHandle_t g_fetch_task_handle = NULL;
-#endif
+static bool g_fetch_in_flight = false;
+static uint32_t g_modal_generation = 0;  // Bumped on open/close, drops stale ui_async results
+static lv_obj_t *g_busy_overlay = NULL;
 
 // Slot info
 static char g_printer_serial[32] = {0};
@@ -119,6 +132,8 @@ static EXT_RAM_BSS_ATTR SlicerPreset g_presets[MAX_PRESETS];
 static int g_preset_count = 0;
 static int g_selected_preset_idx = -1;
 static char g_search_query[64] = {0};
+static const int16_t *g_filtered_presets = NULL;  // Indices into g_presets matching the search
+static int g_filtered_count = 0;
 
 // K-profile data (in PSRAM on ESP32)
 static EXT_RAM_BSS_ATTR KProfileInfo g_k_profiles[MAX_K_PROFILES];
@@ -134,6 +149,24 @@ static lv_obj_t *g_color_name_label = NULL;  // Label showing selected color nam
 // Catalog colors (from database, in PSRAM on ESP32)
 static EXT_RAM_BSS_ATTR ColorCatalogEntry g_catalog_colors[MAX_CATALOG_COLORS];
 static int g_catalog_color_count = 0;
+static bool g_catalog_loading = false;     // Waiting for the selected brand/material
+static bool g_catalog_fetching = false;    // One search in flight at a time
+static bool g_catalog_prefetch_paused = false;  // Set by a failed search
+static int g_catalog_highlight_idx = -1;   // Preset row last pressed
+
+// Catalog search results by brand/material (in PSRAM on ESP32)
+typedef struct {
+    bool used;
+    char brand[64];
+    char material[32];
+    int count;
+    uint32_t fetched;       // lv_tick_get() of the search
+    uint32_t last_use;      // LRU clock
+    ColorCatalogEntry colors[MAX_CATALOG_COLORS];
+} catalog_cache_entry_t;
+
+static EXT_RAM_BSS_ATTR catalog_cache_entry_t g_catalog_cache[CATALOG_CACHE_SIZE];
+static uint32_t g_catalog_cache_clock = 0;
 
 // Parsed preset info (for K-profile and color filtering)
 static char g_selected_brand[64] = {0};
@@ -141,11 +174,36 @@ static char g_selected_material[32] = {0};
 
 // UI elements
 static lv_obj_t *g_preset_list = NULL;
+static lv_obj_t *g_preset_spacer = NULL;  // Gives the list the scroll height of all matches
+
+// Recycled preset list row
+typedef struct {
+    lv_obj_t *btn;
+    lv_obj_t *name;
+    lv_obj_t *badge;
+    int pos;            // Position in g_filtered_presets, -1 = unbound
+    int preset_idx;     // Index into g_presets, -1 = unbound
+    bool selected;
+} preset_row_t;
+
+static preset_row_t g_preset_rows[PRESET_ROW_POOL];
 static lv_obj_t *g_k_dropdown = NULL;
 static lv_obj_t *g_color_preview = NULL;
 static lv_obj_t *g_configure_btn = NULL;
 static lv_obj_t *g_error_label = NULL;
 static lv_obj_t *g_colors_container = NULL;
+
+// Color swatches, created once per modal and recolored on every rebuild
+typedef struct {
+    lv_obj_t *catalog_label;
+    lv_obj_t *catalog_grid;
+    lv_obj_t *catalog[CATALOG_SWATCHES];
+    lv_obj_t *quick_label;
+    lv_obj_t *quick_row;
+} color_swatches_t;
+
+static color_swatches_t g_swatches;
+static char g_catalog_swatch_hex[CATALOG_SWATCHES][8];  // Click handler user_data
 static lv_obj_t *g_keyboard = NULL;
 static lv_obj_t *g_search_ta = NULL;
 static lv_obj_t *g_left_col = NULL;
@@ -315,19 +373,23 @@ static void parse_brand(const char *name, char *brand_out, size_t brand_len) {
     }
 }
 
-// Parse preset name into brand and material, store in globals
-static void parse_preset_info(const char *name) {
-    g_selected_brand[0] = '\0';
-    g_selected_material[0] = '\0';
+// Parse preset name into brand and material
+static void parse_preset_key(const char *name, char *brand, size_t brand_len,
+                             char *material, size_t material_len) {
+    brand[0] = '\0';
+    material[0] = '\0';
 
     if (!name || !name[0]) return;
 
-    // Parse brand
-    parse_brand(name, g_selected_brand, sizeof(g_selected_brand));
+    parse_brand(name, brand, brand_len);
+    strncpy(material, parse_material(name), material_len - 1);
+    material[material_len - 1] = '\0';
+}
 
-    // Parse material
-    const char *material = parse_material(name);
-    strncpy(g_selected_material, material, sizeof(g_selected_material) - 1);
+// Parse preset name into brand and material, store in globals
+static void parse_preset_info(const char *name) {
+    parse_preset_key(name, g_selected_brand, sizeof(g_selected_brand),
+                     g_selected_material, sizeof(g_selected_material));
 }
 
 // Get temperature range for material
@@ -503,7 +565,7 @@ static void show_keyboard(void) {
 
     // Shrink preset list to make room
     if (g_preset_list) {
-        lv_obj_set_height(g_preset_list, 120);  // Reduced from 250
+        lv_obj_set_height(g_preset_list, 120);  // Reduced from PRESET_LIST_HEIGHT
     }
 
     // Hide right column to give more space
@@ -526,7 +588,7 @@ static void hide_keyboard(void) {
 
     // Restore preset list height
     if (g_preset_list) {
-        lv_obj_set_height(g_preset_list, 250);
+        lv_obj_set_height(g_preset_list, PRESET_LIST_HEIGHT);
     }
 
     // Show right column again
@@ -537,7 +599,7 @@ static void hide_keyboard(void) {
     // Restore left column width
     if (g_left_col) {
         lv_obj_set_width(g_left_col, 440);
-        lv_obj_set_width(g_preset_list, 440);
+        lv_obj_set_width(g_preset_list, PRESET_LIST_WIDTH);
     }
 }
 
@@ -587,32 +649,6 @@ static void modal_close_handler(lv_event_t *e) {
     ui_ams_slot_modal_close();
 }
 
-static void preset_select_handler(lv_event_t *e) {
-    lv_obj_t *btn = lv_event_get_target(e);
-    int idx = (intptr_t)lv_event_get_user_data(e);
-
-    // Deselect previous
-    if (g_preset_list) {
-        uint32_t child_cnt = lv_obj_get_child_count(g_preset_list);
-        for (uint32_t i = 0; i < child_cnt; i++) {
-            lv_obj_t *child = lv_obj_get_child(g_preset_list, i);
-            lv_obj_set_style_bg_color(child, lv_color_hex(0x2a2a2a), 0);
-            lv_obj_set_style_border_color(child, lv_color_hex(0x444444), 0);
-        }
-    }
-
-    // Select new
-    g_selected_preset_idx = idx;
-    lv_obj_set_style_bg_color(btn, lv_color_hex(0x1a4a2a), 0);
-    lv_obj_set_style_border_color(btn, lv_color_hex(0x32CD32), 0);
-
-    ESP_LOGI(TAG, "Selected preset %d: %s", idx, g_presets[idx].name);
-
-    // Update K-profile filter
-    filter_k_profiles();
-    update_configure_button_state();
-}
-
 static void k_dropdown_handler(lv_event_t *e) {
     lv_obj_t *dropdown = lv_event_get_target(e);
     int selected = lv_dropdown_get_selected(dropdown);
@@ -702,246 +738,306 @@ static void toggle_extended_colors_handler(lv_event_t *e) {
     rebuild_colors_ui();
 }
 
-static void configure_handler(lv_event_t *e) {
-    (void)e;
+// =============================================================================
+// Slot Requests
+// =============================================================================
 
-    if (g_selected_preset_idx < 0) {
-        if (g_error_label) {
-            lv_label_set_text(g_error_label, "Please select a filament profile");
-            lv_obj_remove_flag(g_error_label, LV_OBJ_FLAG_HIDDEN);
-        }
-        return;
+// Configure / re-read / clear run on a ui_async worker; the modal shows a busy
+// overlay until the result is back on the LVGL thread.
+
+typedef enum {
+    SLOT_OP_CONFIGURE,
+    SLOT_OP_REREAD,
+    SLOT_OP_CLEAR,
+} slot_op_t;
+
+typedef struct {
+    uint32_t generation;
+    slot_op_t op;
+    char printer_serial[32];
+    int ams_id;
+    int tray_id;
+
+    // SLOT_OP_CONFIGURE
+    char setting_id[64];
+    bool user_preset;
+    char material[32];
+    char tray_sub_brands[64];
+    char tray_color[24];
+    int temp_min;
+    int temp_max;
+    bool has_k_profile;
+    int cali_idx;
+    char k_filament_id[32];
+    char k_setting_id[64];
+    float k_value;
+
+    bool success;
+} slot_request_t;
+
+static void show_busy_overlay(const char *text) {
+    if (!g_modal || g_busy_overlay) return;
+
+    // Full screen, absorbs clicks until the request is done
+    g_busy_overlay = lv_obj_create(g_modal);
+    lv_obj_set_size(g_busy_overlay, 800, 480);
+    lv_obj_set_pos(g_busy_overlay, -16, -16);  // Offset for modal padding
+    lv_obj_set_style_bg_color(g_busy_overlay, lv_color_hex(0x1a1a1a), 0);
+    lv_obj_set_style_bg_opa(g_busy_overlay, 200, 0);
+    lv_obj_set_style_radius(g_busy_overlay, 0, 0);
+    lv_obj_set_style_border_width(g_busy_overlay, 0, 0);
+    lv_obj_clear_flag(g_busy_overlay, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *msg = lv_label_create(g_busy_overlay);
+    lv_label_set_text(msg, text);
+    lv_obj_set_style_text_font(msg, &lv_font_montserrat_20, 0);
+    lv_obj_set_style_text_color(msg, lv_color_hex(0xfafafa), 0);
+    lv_obj_align(msg, LV_ALIGN_CENTER, 0, 0);
+}
+
+static void hide_busy_overlay(void) {
+    if (g_busy_overlay) {
+        lv_obj_delete(g_busy_overlay);
+        g_busy_overlay = NULL;
     }
+}
 
-    // Hide error
-    if (g_error_label) {
-        lv_obj_add_flag(g_error_label, LV_OBJ_FLAG_HIDDEN);
+// Full screen result overlay, then auto-close
+static void show_success_overlay(const char *symbol, const char *text) {
+    if (g_modal && !g_success_overlay) {
+        g_success_overlay = lv_obj_create(g_modal);
+        lv_obj_set_size(g_success_overlay, 800, 480);
+        lv_obj_set_pos(g_success_overlay, -16, -16);  // Offset for modal padding
+        lv_obj_set_style_bg_color(g_success_overlay, lv_color_hex(0x1a1a1a), 0);
+        lv_obj_set_style_bg_opa(g_success_overlay, 250, 0);
+        lv_obj_set_style_radius(g_success_overlay, 0, 0);
+        lv_obj_clear_flag(g_success_overlay, LV_OBJ_FLAG_SCROLLABLE);
+
+        lv_obj_t *check = lv_label_create(g_success_overlay);
+        lv_label_set_text(check, symbol);
+        lv_obj_set_style_text_font(check, &lv_font_montserrat_28, 0);
+        lv_obj_set_style_text_color(check, lv_color_hex(0x32CD32), 0);
+        lv_obj_align(check, LV_ALIGN_CENTER, 0, -30);
+
+        lv_obj_t *msg = lv_label_create(g_success_overlay);
+        lv_label_set_text(msg, text);
+        lv_obj_set_style_text_font(msg, &lv_font_montserrat_20, 0);
+        lv_obj_set_style_text_color(msg, lv_color_hex(0xfafafa), 0);
+        lv_obj_align(msg, LV_ALIGN_CENTER, 0, 30);
     }
 
-    SlicerPreset *preset = &g_presets[g_selected_preset_idx];
-    const char *material = parse_material(preset->name);
+    if (g_on_success) g_on_success();
 
-    // Get tray_info_idx and effective_setting_id
+    lv_timer_create(auto_close_timer_cb, 1500, NULL);
+}
+
+static void show_error(const char *text) {
+    if (g_error_label) {
+        lv_label_set_text(g_error_label, text);
+        lv_obj_remove_flag(g_error_label, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+// Worker: resolve tray_info_idx / setting_id, then set filament and calibration
+static void configure_slot(slot_request_t *req) {
     char tray_info_idx[64] = {0};
     char effective_setting_id[64] = {0};
 
     // For user presets, fetch detail to get filament_id or base_id
-    if (is_user_preset(preset->setting_id)) {
+    if (req->user_preset) {
         PresetDetail detail;
-        if (backend_get_preset_detail(preset->setting_id, &detail)) {
+        if (backend_get_preset_detail(req->setting_id, &detail)) {
             // Priority: filament_id first, then derive from base_id (matches frontend)
             if (detail.has_filament_id) {
                 // Use filament_id directly for tray_info_idx
                 strncpy(tray_info_idx, detail.filament_id, sizeof(tray_info_idx) - 1);
-                strncpy(effective_setting_id, preset->setting_id, sizeof(effective_setting_id) - 1);
+                strncpy(effective_setting_id, req->setting_id, sizeof(effective_setting_id) - 1);
                 ESP_LOGI(TAG, "User preset %s -> filament_id=%s",
-                         preset->setting_id, detail.filament_id);
+                         req->setting_id, detail.filament_id);
             } else if (detail.has_base_id) {
                 // Derive tray_info_idx from base_id (e.g., GFSA00 -> GFA00)
                 convert_to_tray_info_idx(detail.base_id, tray_info_idx, sizeof(tray_info_idx));
                 strncpy(effective_setting_id, detail.base_id, sizeof(effective_setting_id) - 1);
                 ESP_LOGI(TAG, "User preset %s -> base_id=%s, tray_info_idx=%s",
-                         preset->setting_id, detail.base_id, tray_info_idx);
+                         req->setting_id, detail.base_id, tray_info_idx);
             } else {
                 // Fallback - use preset setting_id
-                convert_to_tray_info_idx(preset->setting_id, tray_info_idx, sizeof(tray_info_idx));
-                strncpy(effective_setting_id, preset->setting_id, sizeof(effective_setting_id) - 1);
+                convert_to_tray_info_idx(req->setting_id, tray_info_idx, sizeof(tray_info_idx));
+                strncpy(effective_setting_id, req->setting_id, sizeof(effective_setting_id) - 1);
             }
         } else {
             // Cloud lookup failed - fallback
-            convert_to_tray_info_idx(preset->setting_id, tray_info_idx, sizeof(tray_info_idx));
-            strncpy(effective_setting_id, preset->setting_id, sizeof(effective_setting_id) - 1);
+            convert_to_tray_info_idx(req->setting_id, tray_info_idx, sizeof(tray_info_idx));
+            strncpy(effective_setting_id, req->setting_id, sizeof(effective_setting_id) - 1);
         }
     } else {
         // Bambu preset - use directly
-        convert_to_tray_info_idx(preset->setting_id, tray_info_idx, sizeof(tray_info_idx));
-        strncpy(effective_setting_id, preset->setting_id, sizeof(effective_setting_id) - 1);
+        convert_to_tray_info_idx(req->setting_id, tray_info_idx, sizeof(tray_info_idx));
+        strncpy(effective_setting_id, req->setting_id, sizeof(effective_setting_id) - 1);
     }
 
-    // Get color
-    const char *color_hex = g_selected_color_hex[0] ? g_selected_color_hex :
-                           (g_current_tray_color[0] ? g_current_tray_color : "FFFFFF");
-    char tray_color[24];
-    snprintf(tray_color, sizeof(tray_color), "%.8sFF", color_hex);  // Add alpha
-
-    // Get temp range
-    int temp_min, temp_max;
-    get_temp_range(material, &temp_min, &temp_max);
-
-    // Get preset name for tray_sub_brands (strip @ suffix)
-    char tray_sub_brands[64];
-    strncpy(tray_sub_brands, preset->name, sizeof(tray_sub_brands) - 1);
-    char *at_pos = strchr(tray_sub_brands, '@');
-    if (at_pos) *at_pos = '\0';
-    // Strip leading "# " if present
-    char *name_start = tray_sub_brands;
-    if (strncmp(name_start, "# ", 2) == 0) name_start += 2;
-
-    // Get selected K-profile (needed before setting filament to ensure tray_info_idx matches)
-    KProfileInfo *k_profile = (g_selected_k_idx >= 0) ? &g_k_profiles[g_selected_k_idx] : NULL;
-
     // IMPORTANT: If a K-profile is selected, use its filament_id as tray_info_idx
     // The printer requires tray_info_idx to match the K-profile's filament_id for calibration to apply
-    if (k_profile && k_profile->filament_id[0]) {
-        strncpy(tray_info_idx, k_profile->filament_id, sizeof(tray_info_idx) - 1);
+    if (req->k_filament_id[0]) {
+        strncpy(tray_info_idx, req->k_filament_id, sizeof(tray_info_idx) - 1);
         ESP_LOGI(TAG, "Using K-profile filament_id for tray_info_idx: %s", tray_info_idx);
     }
 
-    ESP_LOGI(TAG, "Configuring slot: preset=%s, setting_id=%s, tray_info_idx=%s, material=%s, tray_sub_brands=%s, color=%s",
-             preset->name, effective_setting_id, tray_info_idx, material, name_start, tray_color);
+    ESP_LOGI(TAG, "Configuring slot: setting_id=%s, tray_info_idx=%s, material=%s, tray_sub_brands=%s, color=%s",
+             effective_setting_id, tray_info_idx, req->material, req->tray_sub_brands, req->tray_color);
 
     // Set filament
-    bool success = backend_set_slot_filament(g_printer_serial, g_ams_id, g_tray_id,
-                                              tray_info_idx, effective_setting_id,
-                                              material, name_start,
-                                              tray_color, temp_min, temp_max);
-
-    if (!success) {
-        if (g_error_label) {
-            lv_label_set_text(g_error_label, "Failed to configure slot");
-            lv_obj_remove_flag(g_error_label, LV_OBJ_FLAG_HIDDEN);
-        }
-        return;
-    }
+    req->success = backend_set_slot_filament(req->printer_serial, req->ams_id, req->tray_id,
+                                             tray_info_idx, effective_setting_id,
+                                             req->material, req->tray_sub_brands,
+                                             req->tray_color, req->temp_min, req->temp_max);
+    if (!req->success) return;
+
+    ESP_LOGI(TAG, "Setting calibration: cali_idx=%d, filament_id='%s', setting_id='%s', k_value=%.4f, temp_max=%d",
+             req->cali_idx, req->k_filament_id, req->k_setting_id, req->k_value, req->temp_max);
+
+    backend_set_slot_calibration(req->printer_serial, req->ams_id, req->tray_id,
+                                 req->cali_idx, req->k_filament_id, req->k_setting_id,
+                                 "0.4", req->k_value, req->temp_max);
+}
 
-    // K-profile already retrieved above
-    float k_value = 0.0f;
-    if (k_profile && k_profile->k_value[0]) {
-        k_value = atof(k_profile->k_value);
+static void slot_request_work(void *ctx) {
+    slot_request_t *req = ctx;
+
+    switch (req->op) {
+    case SLOT_OP_CONFIGURE:
+        configure_slot(req);
+        break;
+    case SLOT_OP_REREAD:
+        // Reset slot triggers RFID re-read
+        req->success = backend_reset_slot(req->printer_serial, req->ams_id, req->tray_id);
+        break;
+    case SLOT_OP_CLEAR:
+        // Clear slot by setting empty filament info (NOT reset which triggers re-read)
+        req->success = backend_set_slot_filament(req->printer_serial, req->ams_id, req->tray_id,
+                                                 "", "",  // empty tray_info_idx and setting_id
+                                                 "", "",  // empty tray_type and tray_sub_brands
+                                                 "FFFFFFFF", 0, 0);  // white color, no temps
+        break;
     }
+}
 
-    ESP_LOGI(TAG, "Setting calibration: k_idx=%d, cali_idx=%d, filament_id='%s', setting_id='%s', k_value=%.4f, temp_max=%d",
-             g_selected_k_idx,
-             (int)(k_profile ? k_profile->cali_idx : -1),
-             k_profile ? k_profile->filament_id : "(none)",
-             k_profile ? k_profile->setting_id : "(none)",
-             k_value, temp_max);
+static void slot_request_done(void *ctx) {
+    slot_request_t *req = ctx;
 
-    backend_set_slot_calibration(g_printer_serial, g_ams_id, g_tray_id,
-                                  k_profile ? k_profile->cali_idx : -1,
-                                  k_profile ? k_profile->filament_id : "",
-                                  k_profile ? k_profile->setting_id : "",
-                                  "0.4", k_value, temp_max);
+    if (req->generation == g_modal_generation && g_modal_open) {
+        hide_busy_overlay();
 
-    // Show success overlay (full screen)
-    if (g_modal && !g_success_overlay) {
-        g_success_overlay = lv_obj_create(g_modal);
-        lv_obj_set_size(g_success_overlay, 800, 480);
-        lv_obj_set_pos(g_success_overlay, -16, -16);  // Offset for modal padding
-        lv_obj_set_style_bg_color(g_success_overlay, lv_color_hex(0x1a1a1a), 0);
-        lv_obj_set_style_bg_opa(g_success_overlay, 250, 0);
-        lv_obj_set_style_radius(g_success_overlay, 0, 0);
-        lv_obj_clear_flag(g_success_overlay, LV_OBJ_FLAG_SCROLLABLE);
+        static const struct { const char *symbol; const char *ok; const char *failed; } RESULTS[] = {
+            [SLOT_OP_CONFIGURE] = { LV_SYMBOL_OK, "Slot Configured!", "Failed to configure slot" },
+            [SLOT_OP_REREAD] = { LV_SYMBOL_REFRESH, "Re-reading Slot...", "Failed to re-read slot" },
+            [SLOT_OP_CLEAR] = { LV_SYMBOL_TRASH, "Slot Cleared!", "Failed to clear slot" },
+        };
+        if (req->success) {
+            show_success_overlay(RESULTS[req->op].symbol, RESULTS[req->op].ok);
+        } else {
+            show_error(RESULTS[req->op].failed);
+        }
+    }
+    free(req);
+}
 
-        lv_obj_t *check = lv_label_create(g_success_overlay);
-        lv_label_set_text(check, LV_SYMBOL_OK);
-        lv_obj_set_style_text_font(check, &lv_font_montserrat_28, 0);
-        lv_obj_set_style_text_color(check, lv_color_hex(0x32CD32), 0);
-        lv_obj_align(check, LV_ALIGN_CENTER, 0, -30);
+static slot_request_t *new_slot_request(slot_op_t op) {
+    if (g_busy_overlay || g_success_overlay) return NULL;  // Previous request still running
 
-        lv_obj_t *msg = lv_label_create(g_success_overlay);
-        lv_label_set_text(msg, "Slot Configured!");
-        lv_obj_set_style_text_font(msg, &lv_font_montserrat_20, 0);
-        lv_obj_set_style_text_color(msg, lv_color_hex(0xfafafa), 0);
-        lv_obj_align(msg, LV_ALIGN_CENTER, 0, 30);
+    slot_request_t *req = calloc(1, sizeof(*req));
+    if (!req) {
+        show_error("Out of memory");
+        return NULL;
     }
+    req->generation = g_modal_generation;
+    req->op = op;
+    strncpy(req->printer_serial, g_printer_serial, sizeof(req->printer_serial) - 1);
+    req->ams_id = g_ams_id;
+    req->tray_id = g_tray_id;
+    return req;
+}
 
-    // Call success callback
-    if (g_on_success) {
-        g_on_success();
+static void submit_slot_request(slot_request_t *req, const char *busy_text) {
+    if (!ui_async_submit(slot_request_work, slot_request_done, req)) {
+        free(req);
+        show_error("Busy - please try again");
+        return;
     }
-
-    // Auto-close after delay
-    lv_timer_create(auto_close_timer_cb, 1500, NULL);
+    show_busy_overlay(busy_text);
 }
 
-static void reread_handler(lv_event_t *e) {
+static void configure_handler(lv_event_t *e) {
     (void)e;
 
-    ESP_LOGI(TAG, "Re-reading slot %s AMS %d tray %d", g_printer_serial, g_ams_id, g_tray_id);
+    if (g_selected_preset_idx < 0) {
+        show_error("Please select a filament profile");
+        return;
+    }
 
-    // Reset slot triggers RFID re-read
-    bool success = backend_reset_slot(g_printer_serial, g_ams_id, g_tray_id);
-
-    if (success) {
-        // Show success and close (full screen overlay)
-        if (g_modal && !g_success_overlay) {
-            g_success_overlay = lv_obj_create(g_modal);
-            lv_obj_set_size(g_success_overlay, 800, 480);
-            lv_obj_set_pos(g_success_overlay, -16, -16);  // Offset for modal padding
-            lv_obj_set_style_bg_color(g_success_overlay, lv_color_hex(0x1a1a1a), 0);
-            lv_obj_set_style_bg_opa(g_success_overlay, 250, 0);
-            lv_obj_set_style_radius(g_success_overlay, 0, 0);
-            lv_obj_clear_flag(g_success_overlay, LV_OBJ_FLAG_SCROLLABLE);
-
-            lv_obj_t *check = lv_label_create(g_success_overlay);
-            lv_label_set_text(check, LV_SYMBOL_REFRESH);
-            lv_obj_set_style_text_font(check, &lv_font_montserrat_28, 0);
-            lv_obj_set_style_text_color(check, lv_color_hex(0x32CD32), 0);
-            lv_obj_align(check, LV_ALIGN_CENTER, 0, -30);
-
-            lv_obj_t *msg = lv_label_create(g_success_overlay);
-            lv_label_set_text(msg, "Re-reading Slot...");
-            lv_obj_set_style_text_font(msg, &lv_font_montserrat_20, 0);
-            lv_obj_set_style_text_color(msg, lv_color_hex(0xfafafa), 0);
-            lv_obj_align(msg, LV_ALIGN_CENTER, 0, 30);
-        }
+    slot_request_t *req = new_slot_request(SLOT_OP_CONFIGURE);
+    if (!req) return;
 
-        if (g_on_success) g_on_success();
+    // Hide error
+    if (g_error_label) {
+        lv_obj_add_flag(g_error_label, LV_OBJ_FLAG_HIDDEN);
+    }
 
-        lv_timer_create(auto_close_timer_cb, 1500, NULL);
-    } else {
-        if (g_error_label) {
-            lv_label_set_text(g_error_label, "Failed to re-read slot");
-            lv_obj_remove_flag(g_error_label, LV_OBJ_FLAG_HIDDEN);
+    SlicerPreset *preset = &g_presets[g_selected_preset_idx];
+    strncpy(req->setting_id, preset->setting_id, sizeof(req->setting_id) - 1);
+    req->user_preset = is_user_preset(preset->setting_id);
+    strncpy(req->material, parse_material(preset->name), sizeof(req->material) - 1);
+
+    // Get color
+    const char *color_hex = g_selected_color_hex[0] ? g_selected_color_hex :
+                           (g_current_tray_color[0] ? g_current_tray_color : "FFFFFF");
+    snprintf(req->tray_color, sizeof(req->tray_color), "%.8sFF", color_hex);  // Add alpha
+
+    // Get temp range
+    get_temp_range(req->material, &req->temp_min, &req->temp_max);
+
+    // Get preset name for tray_sub_brands (strip @ suffix and leading "# ")
+    char tray_sub_brands[64] = {0};
+    strncpy(tray_sub_brands, preset->name, sizeof(tray_sub_brands) - 1);
+    char *at_pos = strchr(tray_sub_brands, '@');
+    if (at_pos) *at_pos = '\0';
+    char *name_start = tray_sub_brands;
+    if (strncmp(name_start, "# ", 2) == 0) name_start += 2;
+    strncpy(req->tray_sub_brands, name_start, sizeof(req->tray_sub_brands) - 1);
+
+    // Selected K-profile (its filament_id also becomes tray_info_idx)
+    KProfileInfo *k_profile = (g_selected_k_idx >= 0) ? &g_k_profiles[g_selected_k_idx] : NULL;
+    req->cali_idx = k_profile ? k_profile->cali_idx : -1;
+    if (k_profile) {
+        strncpy(req->k_filament_id, k_profile->filament_id, sizeof(req->k_filament_id) - 1);
+        strncpy(req->k_setting_id, k_profile->setting_id, sizeof(req->k_setting_id) - 1);
+        if (k_profile->k_value[0]) {
+            req->k_value = atof(k_profile->k_value);
         }
     }
+
+    ESP_LOGI(TAG, "Configure slot: preset=%s, k_idx=%d", preset->name, g_selected_k_idx);
+    submit_slot_request(req, "Configuring slot...");
 }
 
-static void clear_handler(lv_event_t *e) {
+static void reread_handler(lv_event_t *e) {
     (void)e;
 
-    ESP_LOGI(TAG, "Clearing slot %s AMS %d tray %d", g_printer_serial, g_ams_id, g_tray_id);
+    slot_request_t *req = new_slot_request(SLOT_OP_REREAD);
+    if (!req) return;
 
-    // Clear slot by setting empty filament info (NOT reset which triggers re-read)
-    bool success = backend_set_slot_filament(g_printer_serial, g_ams_id, g_tray_id,
-                                              "", "",  // empty tray_info_idx and setting_id
-                                              "", "",  // empty tray_type and tray_sub_brands
-                                              "FFFFFFFF", 0, 0);  // white color, no temps
-
-    if (success) {
-        // Full screen success overlay
-        if (g_modal && !g_success_overlay) {
-            g_success_overlay = lv_obj_create(g_modal);
-            lv_obj_set_size(g_success_overlay, 800, 480);
-            lv_obj_set_pos(g_success_overlay, -16, -16);  // Offset for modal padding
-            lv_obj_set_style_bg_color(g_success_overlay, lv_color_hex(0x1a1a1a), 0);
-            lv_obj_set_style_bg_opa(g_success_overlay, 250, 0);
-            lv_obj_set_style_radius(g_success_overlay, 0, 0);
-            lv_obj_clear_flag(g_success_overlay, LV_OBJ_FLAG_SCROLLABLE);
-
-            lv_obj_t *check = lv_label_create(g_success_overlay);
-            lv_label_set_text(check, LV_SYMBOL_TRASH);
-            lv_obj_set_style_text_font(check, &lv_font_montserrat_28, 0);
-            lv_obj_set_style_text_color(check, lv_color_hex(0x32CD32), 0);
-            lv_obj_align(check, LV_ALIGN_CENTER, 0, -30);
-
-            lv_obj_t *msg = lv_label_create(g_success_overlay);
-            lv_label_set_text(msg, "Slot Cleared!");
-            lv_obj_set_style_text_font(msg, &lv_font_montserrat_20, 0);
-            lv_obj_set_style_text_color(msg, lv_color_hex(0xfafafa), 0);
-            lv_obj_align(msg, LV_ALIGN_CENTER, 0, 30);
-        }
+    ESP_LOGI(TAG, "Re-reading slot %s AMS %d tray %d", g_printer_serial, g_ams_id, g_tray_id);
+    submit_slot_request(req, "Re-reading slot...");
+}
 
-        if (g_on_success) g_on_success();
+static void clear_handler(lv_event_t *e) {
+    (void)e;
 
-        lv_timer_create(auto_close_timer_cb, 1500, NULL);
-    } else {
-        if (g_error_label) {
-            lv_label_set_text(g_error_label, "Failed to clear slot");
-            lv_obj_remove_flag(g_error_label, LV_OBJ_FLAG_HIDDEN);
-        }
-    }
+    slot_request_t *req = new_slot_request(SLOT_OP_CLEAR);
+    if (!req) return;
+
+    ESP_LOGI(TAG, "Clearing slot %s AMS %d tray %d", g_printer_serial, g_ams_id, g_tray_id);
+    submit_slot_request(req, "Clearing slot...");
 }
 
 // =============================================================================
@@ -1019,9 +1115,165 @@ static void update_k_profile_dropdown(void) {
 // Catalog Colors
 // =============================================================================
 
-// Fetch catalog colors from backend based on brand/material
+// Searches are cached per brand/material for CATALOG_CACHE_TTL_MS, also across
+// modal sessions. A single search runs at a time; when it finishes the next
+// uncached pair is fetched in this order: the selected preset, the preset row
+// last pressed, the visible preset rows. Selecting a preset the user just
+// looked at is then served from the cache.
+
+// Catalog color search (filled on a ui_async worker)
+typedef struct {
+    char brand[64];
+    char material[32];
+    int count;
+    ColorCatalogEntry colors[MAX_CATALOG_COLORS];
+} catalog_request_t;
+
+static void catalog_fetch_next(void);
+
+static catalog_cache_entry_t *catalog_cache_find(const char *brand, const char *material) {
+    for (int i = 0; i < CATALOG_CACHE_SIZE; i++) {
+        catalog_cache_entry_t *entry = &g_catalog_cache[i];
+        if (entry->used && strcmp(entry->brand, brand) == 0 && strcmp(entry->material, material) == 0) {
+            if (lv_tick_elaps(entry->fetched) >= CATALOG_CACHE_TTL_MS) {
+                entry->used = false;
+                return NULL;
+            }
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void catalog_cache_store(const catalog_request_t *req) {
+    // Free slot first, then the least recently used
+    catalog_cache_entry_t *entry = &g_catalog_cache[0];
+    for (int i = 0; i < CATALOG_CACHE_SIZE && entry->used; i++) {
+        catalog_cache_entry_t *e = &g_catalog_cache[i];
+        if (!e->used || (int32_t)(e->last_use - entry->last_use) < 0) entry = e;
+    }
+
+    entry->used = true;
+    memcpy(entry->brand, req->brand, sizeof(entry->brand));
+    memcpy(entry->material, req->material, sizeof(entry->material));
+    entry->count = req->count;
+    entry->fetched = lv_tick_get();
+    entry->last_use = ++g_catalog_cache_clock;
+    memcpy(entry->colors, req->colors, req->count * sizeof(ColorCatalogEntry));
+}
+
+static void apply_catalog_colors(catalog_cache_entry_t *entry) {
+    entry->last_use = ++g_catalog_cache_clock;
+    g_catalog_color_count = entry->count;
+    memcpy(g_catalog_colors, entry->colors, entry->count * sizeof(ColorCatalogEntry));
+}
+
+static bool is_selected_key(const char *brand, const char *material) {
+    return strcmp(brand, g_selected_brand) == 0 && strcmp(material, g_selected_material) == 0;
+}
+
+// Next brand/material to search for, false if everything wanted is cached
+static bool catalog_pick_next(char *brand, char *material) {
+    if (g_catalog_loading) {
+        strcpy(brand, g_selected_brand);
+        strcpy(material, g_selected_material);
+        return true;
+    }
+    if (!g_modal_open || !g_data_loaded || g_catalog_prefetch_paused) return false;
+
+    // Prefetch: pressed row first, then the rows on screen
+    int candidates[1 + PRESET_ROW_POOL];
+    int n = 0;
+    candidates[n++] = g_catalog_highlight_idx;
+    for (int i = 0; i < PRESET_ROW_POOL; i++) {
+        candidates[n++] = g_preset_rows[i].preset_idx;
+    }
+
+    for (int i = 0; i < n; i++) {
+        int idx = candidates[i];
+        if (idx < 0 || idx >= g_preset_count) continue;
+        parse_preset_key(g_presets[idx].name, brand, sizeof(g_selected_brand),
+                         material, sizeof(g_selected_material));
+        if ((brand[0] || material[0]) && !catalog_cache_find(brand, material)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void catalog_search_work(void *ctx) {
+    catalog_request_t *req = ctx;
+
+    // Search for colors matching brand and/or material
+    req->count = backend_search_colors(
+        req->brand[0] ? req->brand : NULL,
+        req->material[0] ? req->material : NULL,
+        req->colors,
+        MAX_CATALOG_COLORS
+    );
+}
+
+static void catalog_search_done(void *ctx) {
+    catalog_request_t *req = ctx;
+    g_catalog_fetching = false;
+
+    // Errors are not cached; stop prefetching until the user moves on
+    bool ok = req->count >= 0;
+    if (ok) {
+        catalog_cache_store(req);
+    } else {
+        req->count = 0;
+        g_catalog_prefetch_paused = true;
+    }
+
+    if (g_modal_open && g_catalog_loading && is_selected_key(req->brand, req->material)) {
+        g_catalog_loading = false;
+        g_catalog_color_count = req->count;
+        memcpy(g_catalog_colors, req->colors, req->count * sizeof(ColorCatalogEntry));
+
+        ESP_LOGI(TAG, "Found %d catalog colors for brand='%s' material='%s'",
+                 g_catalog_color_count, req->brand, req->material);
+
+        rebuild_colors_ui();
+    }
+    free(req);
+
+    if (g_modal_open) catalog_fetch_next();
+}
+
+// Start the next search unless one is running
+static void catalog_fetch_next(void) {
+    if (g_catalog_fetching) return;
+
+    catalog_request_t *req = malloc(sizeof(*req));
+    if (!req) return;
+    if (!catalog_pick_next(req->brand, req->material)) {
+        free(req);
+        return;
+    }
+
+    bool selected = g_catalog_loading;
+    if (ui_async_submit(catalog_search_work, catalog_search_done, req)) {
+        g_catalog_fetching = true;
+        if (!selected) {
+            ESP_LOGI(TAG, "Prefetching catalog colors for brand='%s' material='%s'",
+                     req->brand, req->material);
+        }
+        return;
+    }
+
+    free(req);
+    if (selected) {
+        // Quick colors for good
+        g_catalog_loading = false;
+        rebuild_colors_ui();
+    }
+}
+
+// Show catalog colors for the selected brand/material (cached or fetched)
 static void refresh_catalog_colors(void) {
     g_catalog_color_count = 0;
+    g_catalog_loading = false;
 
     // Only fetch if we have brand or material
     if (!g_selected_brand[0] && !g_selected_material[0]) {
@@ -1029,250 +1281,317 @@ static void refresh_catalog_colors(void) {
         return;
     }
 
-    // Search for colors matching brand and/or material
-    g_catalog_color_count = backend_search_colors(
-        g_selected_brand[0] ? g_selected_brand : NULL,
-        g_selected_material[0] ? g_selected_material : NULL,
-        g_catalog_colors,
-        MAX_CATALOG_COLORS
-    );
+    catalog_cache_entry_t *entry = catalog_cache_find(g_selected_brand, g_selected_material);
+    if (entry) {
+        apply_catalog_colors(entry);
+        ESP_LOGI(TAG, "Cached %d catalog colors for brand='%s' material='%s'",
+                 g_catalog_color_count, g_selected_brand, g_selected_material);
+    } else {
+        g_catalog_loading = true;
+        g_catalog_prefetch_paused = false;
+    }
 
-    if (g_catalog_color_count < 0) g_catalog_color_count = 0;
+    // Quick colors meanwhile if the search is still pending
+    rebuild_colors_ui();
+    catalog_fetch_next();
+}
 
-    ESP_LOGI(TAG, "Found %d catalog colors for brand='%s' material='%s'",
-             g_catalog_color_count, g_selected_brand, g_selected_material);
+// Prefetch catalog colors for the preset rows on screen
+static void prefetch_catalog_colors(void) {
+    g_catalog_prefetch_paused = false;
+    catalog_fetch_next();
+}
 
-    rebuild_colors_ui();
+static lv_obj_t *create_swatch(lv_obj_t *parent, int size, int radius, const char *hex) {
+    lv_obj_t *swatch = lv_obj_create(parent);
+    lv_obj_set_size(swatch, size, size);
+    lv_obj_set_style_bg_opa(swatch, 255, 0);
+    lv_obj_set_style_radius(swatch, radius, 0);
+    lv_obj_set_style_border_width(swatch, 1, 0);
+    lv_obj_set_style_border_color(swatch, lv_color_hex(0x666666), 0);
+    lv_obj_clear_flag(swatch, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(swatch, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(swatch, color_select_handler, LV_EVENT_CLICKED, (void *)hex);
+    return swatch;
 }
 
-// Rebuild the colors UI (catalog colors + quick colors)
+// Create both color sections once; rebuild_colors_ui only shows and recolors
+static void create_color_swatches(void) {
+    // Catalog colors section (brand/material search result)
+    g_swatches.catalog_label = lv_label_create(g_colors_container);
+    lv_obj_set_style_text_font(g_swatches.catalog_label, &lv_font_montserrat_10, 0);
+    lv_obj_set_style_text_color(g_swatches.catalog_label, lv_color_hex(0x888888), 0);
+    lv_obj_align(g_swatches.catalog_label, LV_ALIGN_TOP_LEFT, 0, 0);
+
+    g_swatches.catalog_grid = lv_obj_create(g_colors_container);
+    lv_obj_set_size(g_swatches.catalog_grid, 310, LV_SIZE_CONTENT);
+    lv_obj_align(g_swatches.catalog_grid, LV_ALIGN_TOP_LEFT, 0, 20);
+    lv_obj_set_style_bg_opa(g_swatches.catalog_grid, 0, 0);
+    lv_obj_set_style_border_width(g_swatches.catalog_grid, 0, 0);
+    lv_obj_set_style_pad_all(g_swatches.catalog_grid, 0, 0);
+    lv_obj_set_flex_flow(g_swatches.catalog_grid, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_gap(g_swatches.catalog_grid, 6, 0);
+    lv_obj_clear_flag(g_swatches.catalog_grid, LV_OBJ_FLAG_SCROLLABLE);
+
+    for (int i = 0; i < CATALOG_SWATCHES; i++) {
+        g_swatches.catalog[i] = create_swatch(g_swatches.catalog_grid, 28, 4, g_catalog_swatch_hex[i]);
+    }
+
+    // Quick colors section (shown when there are no catalog colors)
+    g_swatches.quick_label = lv_label_create(g_colors_container);
+    lv_obj_set_style_text_font(g_swatches.quick_label, &lv_font_montserrat_10, 0);
+    lv_obj_set_style_text_color(g_swatches.quick_label, lv_color_hex(0x888888), 0);
+
+    g_swatches.quick_row = lv_obj_create(g_colors_container);
+    lv_obj_set_size(g_swatches.quick_row, 310, LV_SIZE_CONTENT);
+    lv_obj_set_style_bg_opa(g_swatches.quick_row, 0, 0);
+    lv_obj_set_style_border_width(g_swatches.quick_row, 0, 0);
+    lv_obj_set_style_pad_all(g_swatches.quick_row, 0, 0);
+    lv_obj_set_flex_flow(g_swatches.quick_row, LV_FLEX_FLOW_ROW);
+    lv_obj_set_style_pad_gap(g_swatches.quick_row, 8, 0);
+    lv_obj_clear_flag(g_swatches.quick_row, LV_OBJ_FLAG_SCROLLABLE);
+
+    int max_colors = (QUICK_COLORS_COUNT > 8) ? 8 : QUICK_COLORS_COUNT;
+    for (int i = 0; i < max_colors; i++) {
+        lv_obj_t *swatch = create_swatch(g_swatches.quick_row, 32, 6, QUICK_COLORS[i].hex);
+        lv_obj_set_style_bg_color(swatch, lv_color_hex(hex_to_color(QUICK_COLORS[i].hex)), 0);
+    }
+}
+
+static void set_hidden(lv_obj_t *obj, bool hidden) {
+    if (hidden) {
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_remove_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+// Update the colors UI (catalog colors, or quick colors if there are none)
 static void rebuild_colors_ui(void) {
     if (!g_colors_container) {
         ESP_LOGE(TAG, "rebuild_colors_ui: g_colors_container is NULL!");
         return;
     }
 
-    ESP_LOGI(TAG, "rebuild_colors_ui: starting, catalog_count=%d", g_catalog_color_count);
+    if (!g_swatches.catalog_grid) {
+        create_color_swatches();
+    }
+
+    bool show_catalog = g_catalog_color_count > 0;
+    set_hidden(g_swatches.catalog_label, !show_catalog);
+    set_hidden(g_swatches.catalog_grid, !show_catalog);
+    set_hidden(g_swatches.quick_label, show_catalog);
+    set_hidden(g_swatches.quick_row, show_catalog);
+
+    if (!show_catalog) {
+        lv_label_set_text(g_swatches.quick_label, g_catalog_loading ? "Loading colors..." : "Select color");
+        return;
+    }
 
-    // Clear existing children
-    lv_obj_clean(g_colors_container);
-    ESP_LOGI(TAG, "rebuild_colors_ui: cleaned container");
+    char label_text[128];
+    if (g_selected_brand[0] && g_selected_material[0]) {
+        snprintf(label_text, sizeof(label_text), "%s %s colors", g_selected_brand, g_selected_material);
+    } else if (g_selected_brand[0]) {
+        snprintf(label_text, sizeof(label_text), "%s colors", g_selected_brand);
+    } else {
+        snprintf(label_text, sizeof(label_text), "%s colors", g_selected_material);
+    }
+    lv_label_set_text(g_swatches.catalog_label, label_text);
 
-    // -------------------------------------------------------------------------
-    // Catalog colors section (if any found from brand/material search)
-    // -------------------------------------------------------------------------
-    if (g_catalog_color_count > 0) {
-        // Section label
-        lv_obj_t *catalog_label = lv_label_create(g_colors_container);
-        if (!catalog_label) {
-            ESP_LOGE(TAG, "rebuild_colors_ui: failed to create catalog_label!");
-            return;
+    int shown = (g_catalog_color_count > CATALOG_SWATCHES) ? CATALOG_SWATCHES : g_catalog_color_count;
+    for (int i = 0; i < CATALOG_SWATCHES; i++) {
+        lv_obj_t *swatch = g_swatches.catalog[i];
+        if (i >= shown) {
+            lv_obj_add_flag(swatch, LV_OBJ_FLAG_HIDDEN);
+            continue;
         }
-        char label_text[128];
-        if (g_selected_brand[0] && g_selected_material[0]) {
-            snprintf(label_text, sizeof(label_text), "%s %s colors", g_selected_brand, g_selected_material);
-        } else if (g_selected_brand[0]) {
-            snprintf(label_text, sizeof(label_text), "%s colors", g_selected_brand);
+
+        // Hex color may have a # prefix
+        const char *hex = (const char*)g_catalog_colors[i].hex_color;
+        if (hex[0] == '#') hex++;
+        strncpy(g_catalog_swatch_hex[i], hex, sizeof(g_catalog_swatch_hex[i]) - 1);
+        g_catalog_swatch_hex[i][sizeof(g_catalog_swatch_hex[i]) - 1] = '\0';
+
+        lv_obj_set_style_bg_color(swatch, lv_color_hex(hex_to_color(hex)), 0);
+        lv_obj_remove_flag(swatch, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+// Index the fetched preset names for the search field (same order as g_presets)
+static void build_preset_search_index(void) {
+    ui_preset_search_reset();
+    for (int i = 0; i < g_preset_count; i++) {
+        ui_preset_search_add(g_presets[i].name);
+    }
+}
+
+// The list keeps a fixed pool of PRESET_ROW_POOL row widgets. Rows are placed
+// absolutely and rebound to the matching presets under the viewport whenever
+// the list scrolls or the search changes; a transparent spacer gives the list
+// the scroll height of all matches. Row i shows positions i, i + POOL, ... so
+// rows that stay visible during a scroll are not touched.
+
+static void preset_row_set_selected(preset_row_t *row, bool selected) {
+    if (row->selected == selected) return;
+    row->selected = selected;
+
+    lv_obj_set_style_bg_color(row->btn, lv_color_hex(selected ? 0x1a4a2a : 0x2a2a2a), 0);
+    lv_obj_set_style_border_color(row->btn, lv_color_hex(selected ? 0x32CD32 : 0x444444), 0);
+    lv_obj_set_style_border_width(row->btn, selected ? 2 : 1, 0);
+    // Only the selected row scrolls a long name, the others are truncated
+    lv_label_set_long_mode(row->name, selected ? LV_LABEL_LONG_SCROLL_CIRCULAR : LV_LABEL_LONG_DOT);
+}
+
+static void preset_row_bind(preset_row_t *row, int pos) {
+    int idx = g_filtered_presets[pos];
+
+    if (row->pos != pos) {
+        row->pos = pos;
+        lv_obj_set_y(row->btn, pos * PRESET_ROW_PITCH);
+    }
+    if (row->preset_idx != idx) {
+        row->preset_idx = idx;
+        lv_label_set_text(row->name, g_presets[idx].name);
+        if (is_user_preset(g_presets[idx].setting_id)) {
+            lv_obj_remove_flag(row->badge, LV_OBJ_FLAG_HIDDEN);
         } else {
-            snprintf(label_text, sizeof(label_text), "%s colors", g_selected_material);
-        }
-        lv_label_set_text(catalog_label, label_text);
-        lv_obj_set_style_text_font(catalog_label, &lv_font_montserrat_10, 0);
-        lv_obj_set_style_text_color(catalog_label, lv_color_hex(0x888888), 0);
-        lv_obj_align(catalog_label, LV_ALIGN_TOP_LEFT, 0, 0);
-        ESP_LOGI(TAG, "rebuild_colors_ui: catalog_label created");
-
-        // Catalog colors grid
-        lv_obj_t *catalog_colors = lv_obj_create(g_colors_container);
-        lv_obj_set_size(catalog_colors, 310, LV_SIZE_CONTENT);
-        lv_obj_align(catalog_colors, LV_ALIGN_TOP_LEFT, 0, 20);
-        lv_obj_set_style_bg_opa(catalog_colors, 0, 0);
-        lv_obj_set_style_border_width(catalog_colors, 0, 0);
-        lv_obj_set_style_pad_all(catalog_colors, 0, 0);
-        lv_obj_set_flex_flow(catalog_colors, LV_FLEX_FLOW_ROW_WRAP);
-        lv_obj_set_style_pad_gap(catalog_colors, 6, 0);
-        lv_obj_clear_flag(catalog_colors, LV_OBJ_FLAG_SCROLLABLE);
-
-        // Static storage for hex values (needed for event handler user_data)
-        static char hex_storage[MAX_CATALOG_COLORS][8];
-
-        int max_catalog = (g_catalog_color_count > 20) ? 20 : g_catalog_color_count;
-        for (int i = 0; i < max_catalog; i++) {
-            // Parse hex color (may have # prefix)
-            const char *hex = (const char*)g_catalog_colors[i].hex_color;
-            if (hex[0] == '#') hex++;
-
-            // Store for click handler
-            strncpy(hex_storage[i], hex, sizeof(hex_storage[i]) - 1);
-            hex_storage[i][sizeof(hex_storage[i]) - 1] = '\0';
-
-            lv_obj_t *color_btn = lv_obj_create(catalog_colors);
-            lv_obj_set_size(color_btn, 28, 28);
-            lv_obj_set_style_bg_color(color_btn, lv_color_hex(hex_to_color(hex)), 0);
-            lv_obj_set_style_bg_opa(color_btn, 255, 0);
-            lv_obj_set_style_radius(color_btn, 4, 0);
-            lv_obj_set_style_border_width(color_btn, 1, 0);
-            lv_obj_set_style_border_color(color_btn, lv_color_hex(0x666666), 0);
-            lv_obj_clear_flag(color_btn, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_add_flag(color_btn, LV_OBJ_FLAG_CLICKABLE);
-            lv_obj_add_event_cb(color_btn, color_select_handler, LV_EVENT_CLICKED, hex_storage[i]);
-        }
-        ESP_LOGI(TAG, "rebuild_colors_ui: %d catalog color buttons created", max_catalog);
-    }
-    // -------------------------------------------------------------------------
-    // Quick colors section (only shown if no catalog colors)
-    // -------------------------------------------------------------------------
-    else {
-        lv_obj_t *quick_label = lv_label_create(g_colors_container);
-        if (!quick_label) {
-            ESP_LOGE(TAG, "rebuild_colors_ui: failed to create quick_label!");
-            return;
-        }
-        lv_label_set_text(quick_label, "Select color");
-        lv_obj_set_style_text_font(quick_label, &lv_font_montserrat_10, 0);
-        lv_obj_set_style_text_color(quick_label, lv_color_hex(0x888888), 0);
-        ESP_LOGI(TAG, "rebuild_colors_ui: quick_label created successfully");
-
-        // Basic colors row
-        lv_obj_t *basic_colors = lv_obj_create(g_colors_container);
-        if (!basic_colors) {
-            ESP_LOGE(TAG, "rebuild_colors_ui: failed to create basic_colors!");
-            return;
+            lv_obj_add_flag(row->badge, LV_OBJ_FLAG_HIDDEN);
         }
-        lv_obj_set_size(basic_colors, 310, LV_SIZE_CONTENT);
-        lv_obj_set_style_bg_opa(basic_colors, 0, 0);
-        lv_obj_set_style_border_width(basic_colors, 0, 0);
-        lv_obj_set_style_pad_all(basic_colors, 0, 0);
-        lv_obj_set_flex_flow(basic_colors, LV_FLEX_FLOW_ROW);
-        lv_obj_set_style_pad_gap(basic_colors, 8, 0);
-        lv_obj_clear_flag(basic_colors, LV_OBJ_FLAG_SCROLLABLE);
-        ESP_LOGI(TAG, "rebuild_colors_ui: basic_colors container created");
-
-        int max_colors = (QUICK_COLORS_COUNT > 8) ? 8 : QUICK_COLORS_COUNT;
-        for (int i = 0; i < max_colors; i++) {
-            lv_obj_t *color_btn = lv_obj_create(basic_colors);
-            if (!color_btn) {
-                ESP_LOGE(TAG, "rebuild_colors_ui: failed to create color_btn[%d]!", i);
-                break;
-            }
-            lv_obj_set_size(color_btn, 32, 32);
-            lv_obj_set_style_bg_color(color_btn, lv_color_hex(hex_to_color(QUICK_COLORS[i].hex)), 0);
-            lv_obj_set_style_bg_opa(color_btn, 255, 0);
-            lv_obj_set_style_radius(color_btn, 6, 0);
-            lv_obj_set_style_border_width(color_btn, 1, 0);
-            lv_obj_set_style_border_color(color_btn, lv_color_hex(0x666666), 0);
-            lv_obj_clear_flag(color_btn, LV_OBJ_FLAG_SCROLLABLE);
-            lv_obj_add_flag(color_btn, LV_OBJ_FLAG_CLICKABLE);
-            lv_obj_add_event_cb(color_btn, color_select_handler, LV_EVENT_CLICKED, (void*)QUICK_COLORS[i].hex);
-        }
-        ESP_LOGI(TAG, "rebuild_colors_ui: %d quick color buttons created", max_colors);
     }
+    preset_row_set_selected(row, idx == g_selected_preset_idx);
+    lv_obj_remove_flag(row->btn, LV_OBJ_FLAG_HIDDEN);
+}
 
-    ESP_LOGI(TAG, "rebuild_colors_ui: done");
+static void preset_row_unbind(preset_row_t *row) {
+    row->pos = -1;
+    row->preset_idx = -1;
+    lv_obj_add_flag(row->btn, LV_OBJ_FLAG_HIDDEN);
 }
 
-// Check if preset name matches all search words (AND logic)
-static bool preset_matches_search(const char *name, const char *query) {
-    if (!query || !query[0]) return true;  // Empty query matches all
+// Bind the pool to the rows under the current scroll position
+static void refresh_preset_rows(void) {
+    if (!g_preset_list || !g_preset_spacer) return;
 
-    // Convert name to lowercase
-    char lower_name[128];
-    size_t len = strlen(name);
-    if (len >= sizeof(lower_name)) len = sizeof(lower_name) - 1;
-    for (size_t j = 0; j < len; j++) {
-        lower_name[j] = tolower((unsigned char)name[j]);
-    }
-    lower_name[len] = '\0';
+    int first = lv_obj_get_scroll_y(g_preset_list) / PRESET_ROW_PITCH;
+    if (first < 0) first = 0;  // Elastic overscroll at the top
 
-    // Split query by spaces and check ALL words match (AND logic)
-    char query_copy[64];
-    strncpy(query_copy, query, sizeof(query_copy) - 1);
-    query_copy[sizeof(query_copy) - 1] = '\0';
+    for (int pos = first; pos < first + PRESET_ROW_POOL; pos++) {
+        preset_row_t *row = &g_preset_rows[pos % PRESET_ROW_POOL];
+        if (pos < g_filtered_count) {
+            preset_row_bind(row, pos);
+        } else if (row->pos >= 0) {
+            preset_row_unbind(row);
+        }
+    }
+}
 
-    // Convert query to lowercase
-    for (size_t j = 0; query_copy[j]; j++) {
-        query_copy[j] = tolower((unsigned char)query_copy[j]);
+static void preset_list_scroll_handler(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_SCROLL_END) {
+        prefetch_catalog_colors();
+    } else {
+        refresh_preset_rows();
     }
+}
+
+// Touch down on a row: its colors are likely wanted next
+static void preset_press_handler(lv_event_t *e) {
+    preset_row_t *row = lv_event_get_user_data(e);
+    if (row->preset_idx < 0) return;
+
+    g_catalog_highlight_idx = row->preset_idx;
+    prefetch_catalog_colors();
+}
 
-    // Tokenize by space and check each word
-    char *saveptr;
-    char *word = strtok_r(query_copy, " ", &saveptr);
-    while (word) {
-        // Skip empty tokens
-        if (word[0] && !strstr(lower_name, word)) {
-            return false;  // Word not found - fail AND condition
+static void preset_select_handler(lv_event_t *e) {
+    preset_row_t *row = lv_event_get_user_data(e);
+    int idx = row->preset_idx;
+    if (idx < 0 || idx >= g_preset_count) return;
+
+    g_selected_preset_idx = idx;
+    for (int i = 0; i < PRESET_ROW_POOL; i++) {
+        if (g_preset_rows[i].pos >= 0) {
+            preset_row_set_selected(&g_preset_rows[i], g_preset_rows[i].preset_idx == idx);
         }
-        word = strtok_r(NULL, " ", &saveptr);
     }
 
-    return true;  // All words found
+    ESP_LOGI(TAG, "Selected preset %d: %s", idx, g_presets[idx].name);
+
+    // Update K-profile filter
+    filter_k_profiles();
+    update_configure_button_state();
 }
 
+// Create the spacer and the row pool once per modal
+static void create_preset_rows(void) {
+    g_preset_spacer = lv_obj_create(g_preset_list);
+    lv_obj_remove_style_all(g_preset_spacer);
+    lv_obj_set_size(g_preset_spacer, 1, 0);
+    lv_obj_remove_flag(g_preset_spacer, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+    int32_t line_height = lv_font_get_line_height(&lv_font_montserrat_14);
+    for (int i = 0; i < PRESET_ROW_POOL; i++) {
+        preset_row_t *row = &g_preset_rows[i];
+
+        row->btn = lv_obj_create(g_preset_list);
+        lv_obj_set_size(row->btn, LV_PCT(100), PRESET_ROW_HEIGHT);
+        lv_obj_set_style_bg_color(row->btn, lv_color_hex(0x2a2a2a), 0);
+        lv_obj_set_style_bg_opa(row->btn, 255, 0);
+        lv_obj_set_style_border_width(row->btn, 1, 0);
+        lv_obj_set_style_border_color(row->btn, lv_color_hex(0x444444), 0);
+        lv_obj_set_style_radius(row->btn, 8, 0);
+        lv_obj_set_style_pad_all(row->btn, 10, 0);
+        lv_obj_clear_flag(row->btn, LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_add_flag(row->btn, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_event_cb(row->btn, preset_select_handler, LV_EVENT_CLICKED, row);
+        lv_obj_add_event_cb(row->btn, preset_press_handler, LV_EVENT_PRESSED, row);
+
+        // Preset name (one line, fixed height so LONG_DOT truncates instead of wrapping)
+        row->name = lv_label_create(row->btn);
+        lv_obj_set_style_text_font(row->name, &lv_font_montserrat_14, 0);
+        lv_obj_set_style_text_color(row->name, lv_color_hex(0xfafafa), 0);
+        lv_label_set_long_mode(row->name, LV_LABEL_LONG_DOT);
+        lv_obj_set_size(row->name, 340, line_height);
+        lv_obj_align(row->name, LV_ALIGN_LEFT_MID, 0, 0);
+
+        // Custom badge for user presets
+        row->badge = lv_label_create(row->btn);
+        lv_label_set_text(row->badge, "Custom");
+        lv_obj_set_style_text_font(row->badge, &lv_font_montserrat_12, 0);
+        lv_obj_set_style_text_color(row->badge, lv_color_hex(0x6699FF), 0);
+        lv_obj_align(row->badge, LV_ALIGN_RIGHT_MID, 0, 0);
+
+        row->pos = -1;
+        row->preset_idx = -1;
+        row->selected = false;
+    }
+
+    lv_obj_add_event_cb(g_preset_list, preset_list_scroll_handler, LV_EVENT_SCROLL, NULL);
+    lv_obj_add_event_cb(g_preset_list, preset_list_scroll_handler, LV_EVENT_SCROLL_END, NULL);
+}
+
+// Re-filter by the search query and show the result from the top
 static void populate_preset_list(void) {
-    if (!g_preset_list) {
+    if (!g_preset_list || !g_preset_spacer) {
         ESP_LOGI(TAG, "populate_preset_list: g_preset_list is NULL!");
         return;
     }
 
-    ESP_LOGI(TAG, "populate_preset_list: g_preset_count=%d, query='%s'", g_preset_count, g_search_query);
-
-    // Clear existing children
-    lv_obj_clean(g_preset_list);
-    ESP_LOGI(TAG, "populate_preset_list: cleaned list");
-
-    // Limit to 2 rendered items to reduce memory usage
-    #define MAX_RENDERED_PRESETS 50
-
-    int rendered = 0;
     // Filter by search query (AND logic - all words must match)
-    for (int i = 0; i < g_preset_count && rendered < MAX_RENDERED_PRESETS; i++) {
-        // Check search filter with AND logic
-        if (!preset_matches_search(g_presets[i].name, g_search_query)) {
-            continue;
-        }
-
-        ESP_LOGI(TAG, "populate_preset_list: creating btn %d", rendered);
-
-        // Create preset button
-        lv_obj_t *btn = lv_obj_create(g_preset_list);
-        lv_obj_set_size(btn, LV_PCT(100), 42);
-        lv_obj_set_style_bg_color(btn, lv_color_hex(0x2a2a2a), 0);
-        lv_obj_set_style_bg_opa(btn, 255, 0);
-        lv_obj_set_style_border_width(btn, 1, 0);
-        lv_obj_set_style_border_color(btn, lv_color_hex(0x444444), 0);
-        lv_obj_set_style_radius(btn, 8, 0);
-        lv_obj_set_style_pad_all(btn, 10, 0);
-        lv_obj_clear_flag(btn, LV_OBJ_FLAG_SCROLLABLE);
-        lv_obj_add_flag(btn, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(btn, preset_select_handler, LV_EVENT_CLICKED, (void*)(intptr_t)i);
-
-        // Selected state
-        if (i == g_selected_preset_idx) {
-            lv_obj_set_style_bg_color(btn, lv_color_hex(0x1a4a2a), 0);
-            lv_obj_set_style_border_color(btn, lv_color_hex(0x32CD32), 0);
-            lv_obj_set_style_border_width(btn, 2, 0);
-        }
+    g_filtered_count = ui_preset_search_query(g_search_query, &g_filtered_presets);
 
-        // Preset name
-        lv_obj_t *name_lbl = lv_label_create(btn);
-        lv_label_set_text(name_lbl, g_presets[i].name);
-        lv_obj_set_style_text_font(name_lbl, &lv_font_montserrat_14, 0);
-        lv_obj_set_style_text_color(name_lbl, lv_color_hex(0xfafafa), 0);
-        lv_label_set_long_mode(name_lbl, LV_LABEL_LONG_SCROLL_CIRCULAR);
-        lv_obj_set_width(name_lbl, 340);
-        lv_obj_align(name_lbl, LV_ALIGN_LEFT_MID, 0, 0);
+    lv_obj_set_height(g_preset_spacer,
+                      g_filtered_count > 0 ? g_filtered_count * PRESET_ROW_PITCH - PRESET_ROW_GAP : 0);
 
-        // Custom badge for user presets
-        if (is_user_preset(g_presets[i].setting_id)) {
-            lv_obj_t *badge = lv_label_create(btn);
-            lv_label_set_text(badge, "Custom");
-            lv_obj_set_style_text_font(badge, &lv_font_montserrat_12, 0);
-            lv_obj_set_style_text_color(badge, lv_color_hex(0x6699FF), 0);
-            lv_obj_align(badge, LV_ALIGN_RIGHT_MID, 0, 0);
-        }
-        rendered++;
+    // The result changed - every row has to be rebound
+    for (int i = 0; i < PRESET_ROW_POOL; i++) {
+        preset_row_unbind(&g_preset_rows[i]);
     }
-    ESP_LOGI(TAG, "populate_preset_list: rendered %d presets (max %d)", rendered, MAX_RENDERED_PRESETS);
+    lv_obj_scroll_to_y(g_preset_list, 0, LV_ANIM_OFF);
+    refresh_preset_rows();
+    prefetch_catalog_colors();
+
+    ESP_LOGI(TAG, "populate_preset_list: %d of %d presets match '%s'",
+             g_filtered_count, g_preset_count, g_search_query);
 }
 
 static void search_input_handler(lv_event_t *e) {
@@ -1287,12 +1606,21 @@ static void search_input_handler(lv_event_t *e) {
 // Public API
 // =============================================================================
 
-// Called via lv_async_call when data fetch is complete - runs in LVGL thread
-static void on_data_fetch_complete(void *user_data) {
-    (void)user_data;
-
-    if (!g_modal || !g_modal_open) return;
-
+static void start_data_fetch(void);
+
+// One data fetch: owns its inputs and results, the worker touches nothing
+// else. ~80 KB, allocated from PSRAM on ESP32 (above the malloc threshold).
+typedef struct {
+    uint32_t generation;        // g_modal_generation when submitted
+    char printer_serial[32];
+    int preset_count;
+    int k_profile_count;
+    SlicerPreset presets[MAX_PRESETS];
+    KProfileInfo k_profiles[MAX_K_PROFILES];
+} data_fetch_t;
+
+// Presets and K-profiles are in place - replace the spinner with the content
+static void show_fetched_data(void) {
     ESP_LOGI(TAG, "Data fetch complete: %d presets, %d K-profiles", g_preset_count, g_k_profile_count);
 
     g_data_loaded = true;
@@ -1311,37 +1639,71 @@ static void on_data_fetch_complete(void *user_data) {
     build_modal_content();
 }
 
-#ifdef ESP_PLATFORM
-// FreeRTOS task to fetch data without blocking UI
-static void data_fetch_task(void *pvParameters) {
-    (void)pvParameters;
+// ui_async done callback - runs in LVGL thread
+static void on_data_fetch_complete(void *user_data) {
+    data_fetch_t *fetch = user_data;
+    g_fetch_in_flight = false;
 
-    ESP_LOGI(TAG, "Data fetch task started");
+    if (!g_modal || !g_modal_open || g_data_loaded) {
+        free(fetch);
+        return;
+    }
 
-    // Fetch presets (blocking HTTP call - but in separate task)
-    g_preset_count = backend_get_slicer_presets(g_presets, MAX_PRESETS);
-    if (g_preset_count < 0) g_preset_count = 0;
-    ESP_LOGI(TAG, "Loaded %d presets", g_preset_count);
+    // Fetched for a modal that has been closed since - fetch again for this one
+    if (fetch->generation != g_modal_generation) {
+        free(fetch);
+        start_data_fetch();
+        return;
+    }
 
-    // Fetch K-profiles (blocking HTTP call - but in separate task)
-    g_k_profile_count = backend_get_k_profiles(g_printer_serial, "0.4", g_k_profiles, MAX_K_PROFILES);
-    if (g_k_profile_count < 0) g_k_profile_count = 0;
-    ESP_LOGI(TAG, "Loaded %d K-profiles", g_k_profile_count);
+    g_preset_count = fetch->preset_count;
+    memcpy(g_presets, fetch->presets, g_preset_count * sizeof(g_presets[0]));
+    g_k_profile_count = fetch->k_profile_count;
+    memcpy(g_k_profiles, fetch->k_profiles, g_k_profile_count * sizeof(g_k_profiles[0]));
+    free(fetch);
 
-    // Debug: log first few profiles
-    for (int i = 0; i < g_k_profile_count && i < 5; i++) {
-        ESP_LOGI(TAG, "K-profile[%d]: cali_idx=%d extruder=%d name='%s'",
-                 i, (int)g_k_profiles[i].cali_idx, (int)g_k_profiles[i].extruder_id,
-                 g_k_profiles[i].name);
-    }
+    build_preset_search_index();
+    show_fetched_data();
+}
+
+// ui_async worker - blocking HTTP calls, never touch LVGL or the g_* state here
+static void data_fetch_work(void *user_data) {
+    data_fetch_t *fetch = user_data;
 
-    // Signal UI thread that data is ready
-    lv_async_call(on_data_fetch_complete, NULL);
+    ESP_LOGI(TAG, "Data fetch started");
 
-    g_fetch_task_handle = NULL;
-    vTaskDelete(NULL);
+    fetch->preset_count = backend_get_slicer_presets(fetch->presets, MAX_PRESETS);
+    if (fetch->preset_count < 0) fetch->preset_count = 0;
+    ESP_LOGI(TAG, "Loaded %d presets", fetch->preset_count);
+
+    fetch->k_profile_count = backend_get_k_profiles(fetch->printer_serial, "0.4",
+                                                    fetch->k_profiles, MAX_K_PROFILES);
+    if (fetch->k_profile_count < 0) fetch->k_profile_count = 0;
+    ESP_LOGI(TAG, "Loaded %d K-profiles", fetch->k_profile_count);
+}
+
+static void start_data_fetch(void) {
+    // One fetch at a time; a running fetch restarts for the current modal
+    // when it completes
+    if (g_fetch_in_flight) return;
+
+    data_fetch_t *fetch = calloc(1, sizeof(*fetch));
+    if (fetch) {
+        fetch->generation = g_modal_generation;
+        strncpy(fetch->printer_serial, g_printer_serial, sizeof(fetch->printer_serial) - 1);
+        g_fetch_in_flight = true;
+        if (ui_async_submit(data_fetch_work, on_data_fetch_complete, fetch)) return;
+        g_fetch_in_flight = false;
+        free(fetch);
+    }
+
+    ESP_LOGE(TAG, "Failed to queue data fetch");
+    // Don't fallback to sync - just show empty data
+    g_preset_count = 0;
+    g_k_profile_count = 0;
+    build_preset_search_index();
+    show_fetched_data();
 }
-#endif
 
 // Timer callback to start async data loading
 static void load_data_timer_cb(lv_timer_t *t) {
@@ -1350,41 +1712,7 @@ static void load_data_timer_cb(lv_timer_t *t) {
     if (!g_modal || !g_modal_open) return;
 
     ESP_LOGI(TAG, "load_data_timer_cb: starting data fetch");
-
-#ifdef ESP_PLATFORM
-    // Spawn FreeRTOS task to fetch data without blocking UI
-    if (g_fetch_task_handle == NULL) {
-        ESP_LOGI(TAG, "Creating fetch task...");
-        BaseType_t ret = xTaskCreate(
-            data_fetch_task,
-            "modal_fetch",
-            4096,  // Stack size
-            NULL,
-            5,     // Priority (lower than UI)
-            &g_fetch_task_handle
-        );
-        if (ret != pdPASS) {
-            ESP_LOGE(TAG, "Failed to create fetch task, ret=%d", (int)ret);
-            // Don't fallback to sync - just show empty data
-            g_preset_count = 0;
-            g_k_profile_count = 0;
-            on_data_fetch_complete(NULL);
-        } else {
-            ESP_LOGI(TAG, "Fetch task created successfully");
-        }
-    }
-#else
-    // Simulator: load synchronously (no threading issues)
-    g_preset_count = backend_get_slicer_presets(g_presets, MAX_PRESETS);
-    if (g_preset_count < 0) g_preset_count = 0;
-    ESP_LOGI(TAG, "Loaded %d presets", g_preset_count);
-
-    g_k_profile_count = backend_get_k_profiles(g_printer_serial, "0.4", g_k_profiles, MAX_K_PROFILES);
-    if (g_k_profile_count < 0) g_k_profile_count = 0;
-    ESP_LOGI(TAG, "Loaded %d K-profiles", g_k_profile_count);
-
-    on_data_fetch_complete(NULL);
-#endif
+    start_data_fetch();
 }
 
 void ui_ams_slot_modal_open(const char *printer_serial, int ams_id, int tray_id,
@@ -1394,6 +1722,7 @@ void ui_ams_slot_modal_open(const char *printer_serial, int ams_id, int tray_id,
     if (g_modal_open) return;
 
     ESP_LOGI(TAG, "Opening AMS slot modal: %s AMS %d tray %d extruder %d", printer_serial, ams_id, tray_id, extruder_id);
+    ui_mem_modal_begin(UI_MEM_MODAL_AMS_SLOT);
 
     // Store params
     strncpy(g_printer_serial, printer_serial, sizeof(g_printer_serial) - 1);
@@ -1408,13 +1737,17 @@ void ui_ams_slot_modal_open(const char *printer_serial, int ams_id, int tray_id,
     g_on_success = on_success;
 
     // Reset state
+    g_modal_generation++;
     g_selected_preset_idx = -1;
     g_selected_k_idx = -1;
     g_search_query[0] = '\0';
     g_selected_color_hex[0] = '\0';
     g_show_extended_colors = false;
     g_success_overlay = NULL;
+    g_busy_overlay = NULL;
     g_data_loaded = false;
+    g_catalog_loading = false;
+    g_catalog_highlight_idx = -1;
 
     // Create full-screen modal with loading state
     // DEBUG: Use lv_scr_act() instead of lv_layer_top() to test
@@ -1560,19 +1893,18 @@ static void build_modal_content(void) {
     lv_obj_add_event_cb(g_search_ta, textarea_click_handler, LV_EVENT_CLICKED, NULL);
 
     g_preset_list = lv_obj_create(g_left_col);
-    lv_obj_set_size(g_preset_list, 440, 250);
+    lv_obj_set_size(g_preset_list, PRESET_LIST_WIDTH, PRESET_LIST_HEIGHT);
     lv_obj_align(g_preset_list, LV_ALIGN_TOP_LEFT, 0, 72);
     lv_obj_set_style_bg_color(g_preset_list, lv_color_hex(0x1a1a1a), 0);
     lv_obj_set_style_bg_opa(g_preset_list, 255, 0);
     lv_obj_set_style_border_width(g_preset_list, 1, 0);
     lv_obj_set_style_border_color(g_preset_list, lv_color_hex(0x333333), 0);
     lv_obj_set_style_radius(g_preset_list, 8, 0);
-    lv_obj_set_style_pad_all(g_preset_list, 8, 0);
-    lv_obj_set_flex_flow(g_preset_list, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_pad_row(g_preset_list, 6, 0);
+    lv_obj_set_style_pad_all(g_preset_list, PRESET_LIST_PAD, 0);
     lv_obj_add_flag(g_preset_list, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_scroll_dir(g_preset_list, LV_DIR_VER);
 
+    create_preset_rows();
     populate_preset_list();
 
     // Right column container (K-profile, color, buttons)
@@ -1742,6 +2074,7 @@ static void build_modal_content(void) {
     ESP_LOGI(TAG, "build_modal_content: keyboard done");
 
     ESP_LOGI(TAG, "build_modal_content: COMPLETE");
+    ui_mem_modal_opened(UI_MEM_MODAL_AMS_SLOT);
 }
 
 void ui_ams_slot_modal_close(void) {
@@ -1754,18 +2087,23 @@ void ui_ams_slot_modal_close(void) {
         g_modal = NULL;
     }
 
+    g_modal_generation++;  // Pending ui_async results are dropped
     g_card = NULL;
     g_preset_list = NULL;
+    g_preset_spacer = NULL;
+    memset(g_preset_rows, 0, sizeof(g_preset_rows));
     g_k_dropdown = NULL;
     g_color_preview = NULL;
     g_color_name_label = NULL;
     g_configure_btn = NULL;
     g_error_label = NULL;
     g_colors_container = NULL;
+    memset(&g_swatches, 0, sizeof(g_swatches));
     g_loading_spinner = NULL;
     g_loading_label = NULL;
     g_data_loaded = false;
     g_success_overlay = NULL;
+    g_busy_overlay = NULL;
     g_keyboard = NULL;
     g_search_ta = NULL;
     g_left_col = NULL;
@@ -1775,6 +2113,7 @@ void ui_ams_slot_modal_close(void) {
     g_selected_color_name[0] = '\0';
 
     g_modal_open = false;
+    ui_mem_modal_closed(UI_MEM_MODAL_AMS_SLOT);
 }
 
 bool ui_ams_slot_modal_is_open(void) {
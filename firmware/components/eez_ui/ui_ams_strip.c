@@ -0,0 +1,718 @@
+/**
+ * @file ui_ams_strip.c
+ * @brief One-object AMS unit widget
+ *
+ * A custom class on top of lv_obj: the base class draws background, border
+ * and shadow from the object's styles, DRAW_MAIN adds the unit itself with
+ * lv_draw_* calls. What is drawn where comes from a static layout per screen
+ * and slot count. The hatch masks and the scaled spool images are built from
+ * the layouts on first use and kept for the lifetime of the program
+ * (about 15 KB for all of them).
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#include "ui_ams_strip.h"
+#include "screens.h"
+#include "images.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+
+#if LVGL_VERSION_MAJOR > 9 || (LVGL_VERSION_MAJOR == 9 && LVGL_VERSION_MINOR >= 2)
+// lv_obj_t and lv_obj_class_t moved to the private headers in LVGL 9.2
+#include "lvgl_private.h"
+#endif
+
+static const char *TAG = "ui_ams_strip";
+
+#define MY_CLASS (&ui_ams_strip_class)
+
+// Accent green color - matches progress bar (#00FF00)
+#define ACCENT_GREEN 0x00FF00
+
+// Samples per pixel and axis for the anti-aliased hatch mask edges
+#define HATCH_SUBSAMPLES 4
+
+// lv_image_set_scale() of the EEZ spool images on the AMS overview
+#define SPOOL_SCALE 400
+
+// Overview slot name box (EEZ: 18x11 label, centered text)
+#define SLOT_LABEL_W 18
+
+// =============================================================================
+// Layouts
+// =============================================================================
+
+// Overview text rows, relative to the strip
+typedef struct {
+    int16_t material_x[UI_AMS_STRIP_MAX_SLOTS];
+    int16_t material_y;
+    int16_t label_x[UI_AMS_STRIP_MAX_SLOTS];   // Slot name ("A1"), 4-slot units only
+    int16_t label_y;
+    int16_t fill_x[UI_AMS_STRIP_MAX_SLOTS];
+    int16_t fill_y;
+} strip_text_layout_t;
+
+typedef struct {
+    int16_t w, h;
+    const lv_font_t *name_font;     // NULL = name not drawn
+    int16_t name_x, name_y;
+    int16_t slot_x[UI_AMS_STRIP_MAX_SLOTS];
+    int16_t slot_y[UI_AMS_STRIP_MAX_SLOTS];
+    int16_t slot_w, slot_h;
+    int16_t radius;                 // Slot corners (baked into the hatch mask)
+    uint32_t empty_color;           // Empty slot fill (overview: spool fill recolor)
+    uint32_t border_color;
+    uint8_t border_width;
+    uint8_t active_border_width;
+    // Empty slot hatching: hatch_count stripes of hatch_width px, centered on
+    // y = hatch_y + i * hatch_period + hatch_slope * x (slot coordinates)
+    uint32_t hatch_color;
+    float hatch_y;
+    float hatch_period;
+    float hatch_slope;
+    float hatch_width;
+    uint8_t hatch_count;
+    int16_t hit_pad;                // Press area around each slot
+    const strip_text_layout_t *text;  // Overview: spool images and text rows
+} strip_layout_t;
+
+static const strip_text_layout_t overview_quad_text = {
+    .material_x = {16, 68, 121, 173}, .material_y = 2,
+    .label_x = {17, 71, 124, 178}, .label_y = 88,
+    .fill_x = {16, 70, 123, 177}, .fill_y = 105,
+};
+
+static const strip_text_layout_t overview_single_text = {
+    .material_x = {35}, .material_y = 2,
+    .label_y = -1,
+    .fill_x = {38}, .fill_y = 89,
+};
+
+// [kind][single slot]. Positions are the EEZ ones: MAIN relative to the
+// container's outer edge (theme padding 20 + border 3), SCAN and OVERVIEW
+// relative to the strip, which takes the place of the replaced objects.
+// The stripes of the old objects were rotated by -20 degrees (slope -0.364).
+static const strip_layout_t layouts[3][2] = {
+    [UI_AMS_STRIP_MAIN] = {
+        {
+            .w = 120, .h = 50,
+            .name_font = &lv_font_montserrat_14, .name_x = 58, .name_y = 5,
+            .slot_x = {6, 34, 62, 91}, .slot_y = {20, 20, 20, 20},
+            .slot_w = 23, .slot_h = 24, .radius = 5,
+            .empty_color = 0x0a0a0a, .border_color = 0xbab1b1,
+            .border_width = 2, .active_border_width = 3,
+            .hatch_color = 0x3a3a3a, .hatch_y = 8.8f, .hatch_period = 10.0f,
+            .hatch_slope = -0.364f, .hatch_width = 3.0f, .hatch_count = 3,
+        },
+        {
+            .w = 56, .h = 50,
+            .name_font = &lv_font_montserrat_12, .name_x = 9, .name_y = 6,
+            .slot_x = {13}, .slot_y = {22},
+            .slot_w = 23, .slot_h = 24, .radius = 5,
+            .empty_color = 0x0a0a0a, .border_color = 0xbab1b1,
+            .border_width = 2, .active_border_width = 3,
+            .hatch_color = 0x3a3a3a, .hatch_y = 8.8f, .hatch_period = 10.0f,
+            .hatch_slope = -0.364f, .hatch_width = 3.0f, .hatch_count = 3,
+        },
+    },
+    [UI_AMS_STRIP_SCAN] = {
+        {
+            .w = 225, .h = 46,
+            .name_font = &lv_font_montserrat_20, .name_x = 0, .name_y = 1,
+            .slot_x = {22, 75, 127, 180}, .slot_y = {1, 1, 1, 1},
+            .slot_w = 45, .slot_h = 45, .radius = 5,
+            .empty_color = 0x2a2a2a, .border_color = 0x555555,
+            .border_width = 2, .active_border_width = 3,
+            .hatch_color = 0x3a3a3a, .hatch_y = 10.8f, .hatch_period = 12.0f,
+            .hatch_slope = -0.364f, .hatch_width = 3.0f, .hatch_count = 3,
+            .hit_pad = 3,
+        },
+        {
+            .w = 45, .h = 49,
+            .name_font = &lv_font_montserrat_12, .name_x = 0, .name_y = 0,
+            .slot_x = {15}, .slot_y = {19},
+            .slot_w = 30, .slot_h = 30, .radius = 5,
+            .empty_color = 0x2a2a2a, .border_color = 0x555555,
+            .border_width = 2, .active_border_width = 3,
+            .hatch_color = 0x3a3a3a, .hatch_y = 10.8f, .hatch_period = 12.0f,
+            .hatch_slope = -0.364f, .hatch_width = 3.0f, .hatch_count = 3,
+            .hit_pad = 3,
+        },
+    },
+    [UI_AMS_STRIP_OVERVIEW] = {
+        {
+            .w = 216, .h = 120,
+            .slot_x = {10, 62, 116, 171}, .slot_y = {29, 30, 30, 31},
+            .slot_w = 32, .slot_h = 42,
+            .empty_color = 0x1a1a1a, .border_color = 0x3d3d3d,
+            .border_width = 1, .active_border_width = 3,
+            .hatch_color = 0x4a4a4a, .hatch_y = 12.0f, .hatch_period = 12.0f,
+            .hatch_slope = -0.25f, .hatch_width = 3.0f, .hatch_count = 3,
+            .hit_pad = 10,
+            .text = &overview_quad_text,
+        },
+        {
+            .w = 80, .h = 104,
+            .slot_x = {30}, .slot_y = {29},
+            .slot_w = 32, .slot_h = 42,
+            .empty_color = 0x1a1a1a, .border_color = 0x3d3d3d,
+            .border_width = 1, .active_border_width = 3,
+            .hatch_color = 0x4a4a4a, .hatch_y = 12.0f, .hatch_period = 12.0f,
+            .hatch_slope = -0.25f, .hatch_width = 3.0f, .hatch_count = 3,
+            .hit_pad = 10,
+            .text = &overview_single_text,
+        },
+    },
+};
+
+// =============================================================================
+// Pre-rendered images
+// =============================================================================
+
+// Hatch mask per layout (A8, slot size), NULL data = not built yet
+static lv_image_dsc_t hatch_masks[3][2];
+
+// Overview spools at their displayed size, NULL data = draw the EEZ image scaled
+static lv_image_dsc_t spool_clean_scaled;
+static lv_image_dsc_t spool_fill_scaled;
+static bool spools_prepared = false;
+
+static bool in_hatch(const strip_layout_t *l, float x, float y) {
+    float half = l->hatch_width * 0.5f;
+    // Vertical half thickness of a slanted stripe: half / cos(angle)
+    half *= sqrtf(1.0f + l->hatch_slope * l->hatch_slope);
+    float d = y - l->hatch_y - l->hatch_slope * x;
+    for (int i = 0; i < l->hatch_count; i++) {
+        float di = d - i * l->hatch_period;
+        if (di >= -half && di < half) return true;
+    }
+    return false;
+}
+
+static bool in_slot(const strip_layout_t *l, float x, float y) {
+    float r = l->radius;
+    float cx = x < r ? r : (x > l->slot_w - r ? l->slot_w - r : x);
+    float cy = y < r ? r : (y > l->slot_h - r ? l->slot_h - r : y);
+    return (x - cx) * (x - cx) + (y - cy) * (y - cy) <= r * r;
+}
+
+static const lv_image_dsc_t *get_hatch_mask(ui_ams_strip_kind_t kind, int single) {
+    lv_image_dsc_t *dsc = &hatch_masks[kind][single];
+    if (dsc->data) return dsc;
+
+    const strip_layout_t *l = &layouts[kind][single];
+    uint8_t *mask = malloc(l->slot_w * l->slot_h);
+    if (!mask) return NULL;
+
+    const int n = HATCH_SUBSAMPLES;
+    for (int y = 0; y < l->slot_h; y++) {
+        for (int x = 0; x < l->slot_w; x++) {
+            int hits = 0;
+            for (int sy = 0; sy < n; sy++) {
+                for (int sx = 0; sx < n; sx++) {
+                    float px = x + (sx + 0.5f) / n;
+                    float py = y + (sy + 0.5f) / n;
+                    if (in_hatch(l, px, py) && in_slot(l, px, py)) hits++;
+                }
+            }
+            mask[y * l->slot_w + x] = (uint8_t)(hits * 255 / (n * n));
+        }
+    }
+
+    dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
+    dsc->header.cf = LV_COLOR_FORMAT_A8;
+    dsc->header.w = l->slot_w;
+    dsc->header.h = l->slot_h;
+    dsc->header.stride = l->slot_w;  // A8 = 1 byte per pixel
+    dsc->data_size = l->slot_w * l->slot_h;
+    dsc->data = mask;
+    return dsc;
+}
+
+// One pixel of an A8, RGB565, RGB565A8 or ARGB8888 image as 0xAARRGGBB
+static uint32_t read_pixel(const lv_image_dsc_t *src, int x, int y) {
+    const uint8_t *data = src->data;
+    uint32_t stride = src->header.stride;
+    uint32_t a = 0xff, rgb = 0;
+
+    switch (src->header.cf) {
+        case LV_COLOR_FORMAT_A8:
+            a = data[y * stride + x];
+            break;
+        case LV_COLOR_FORMAT_RGB565A8:
+            // Alpha plane after the color plane, half its stride
+            a = data[src->header.h * stride + y * (stride / 2) + x];
+            /* fall through */
+        case LV_COLOR_FORMAT_RGB565: {
+            uint16_t c = data[y * stride + x * 2] | (data[y * stride + x * 2 + 1] << 8);
+            rgb = ((c >> 11) * 255 / 31) << 16 | (((c >> 5) & 0x3f) * 255 / 63) << 8 | (c & 0x1f) * 255 / 31;
+            break;
+        }
+        default:  // ARGB8888: B, G, R, A
+            a = data[y * stride + x * 4 + 3];
+            rgb = data[y * stride + x * 4 + 2] << 16 | data[y * stride + x * 4 + 1] << 8 | data[y * stride + x * 4];
+            break;
+    }
+    return a << 24 | rgb;
+}
+
+static void write_pixel(lv_image_dsc_t *dst, uint8_t *data, int x, int y, uint32_t argb) {
+    uint32_t stride = dst->header.stride;
+    uint8_t a = argb >> 24;
+    uint16_t c = ((argb >> 8) & 0xf800) | ((argb >> 5) & 0x07e0) | ((argb >> 3) & 0x001f);
+
+    switch (dst->header.cf) {
+        case LV_COLOR_FORMAT_A8:
+            data[y * stride + x] = a;
+            break;
+        case LV_COLOR_FORMAT_RGB565A8:
+            data[dst->header.h * stride + y * (stride / 2) + x] = a;
+            /* fall through */
+        case LV_COLOR_FORMAT_RGB565:
+            data[y * stride + x * 2] = c & 0xff;
+            data[y * stride + x * 2 + 1] = c >> 8;
+            break;
+        default:
+            data[y * stride + x * 4] = argb & 0xff;
+            data[y * stride + x * 4 + 1] = (argb >> 8) & 0xff;
+            data[y * stride + x * 4 + 2] = (argb >> 16) & 0xff;
+            data[y * stride + x * 4 + 3] = a;
+            break;
+    }
+}
+
+/**
+ * Bilinear copy of src at scale/256 (colors weighted by alpha, like
+ * LVGL's own transform). Leaves dst->data NULL for other color formats.
+ */
+static void scale_image(const lv_image_dsc_t *src, int scale, lv_image_dsc_t *dst) {
+    uint32_t cf = src->header.cf;
+    int bpp;
+    switch (cf) {
+        case LV_COLOR_FORMAT_A8:       bpp = 1; break;
+        case LV_COLOR_FORMAT_RGB565:   bpp = 2; break;
+        case LV_COLOR_FORMAT_RGB565A8: bpp = 3; break;
+        case LV_COLOR_FORMAT_ARGB8888: bpp = 4; break;
+        default:
+            ESP_LOGW(TAG, "Can't prescale color format %u, scaling at draw time", (unsigned)cf);
+            return;
+    }
+
+    int sw = src->header.w, sh = src->header.h;
+    int dw = (sw * scale + 128) / 256, dh = (sh * scale + 128) / 256;
+    uint8_t *data = malloc(dw * dh * bpp);
+    if (!data) return;
+
+    memset(dst, 0, sizeof(*dst));
+    dst->header.magic = LV_IMAGE_HEADER_MAGIC;
+    dst->header.cf = cf;
+    dst->header.w = dw;
+    dst->header.h = dh;
+    dst->header.stride = dw * (bpp == 3 ? 2 : bpp);  // RGB565A8: stride of the color plane
+
+    for (int y = 0; y < dh; y++) {
+        float fy = (y + 0.5f) * sh / dh - 0.5f;
+        int y0 = fy < 0 ? 0 : (int)fy;
+        int y1 = y0 + 1 < sh ? y0 + 1 : sh - 1;
+        float wy = fy < 0 ? 0 : fy - y0;
+        for (int x = 0; x < dw; x++) {
+            float fx = (x + 0.5f) * sw / dw - 0.5f;
+            int x0 = fx < 0 ? 0 : (int)fx;
+            int x1 = x0 + 1 < sw ? x0 + 1 : sw - 1;
+            float wx = fx < 0 ? 0 : fx - x0;
+
+            uint32_t p[4] = {
+                read_pixel(src, x0, y0), read_pixel(src, x1, y0),
+                read_pixel(src, x0, y1), read_pixel(src, x1, y1),
+            };
+            float w[4] = {(1 - wx) * (1 - wy), wx * (1 - wy), (1 - wx) * wy, wx * wy};
+            float a = 0, r = 0, g = 0, b = 0;
+            for (int i = 0; i < 4; i++) {
+                float pa = (p[i] >> 24) * w[i];
+                a += pa;
+                r += ((p[i] >> 16) & 0xff) * pa;
+                g += ((p[i] >> 8) & 0xff) * pa;
+                b += (p[i] & 0xff) * pa;
+            }
+            uint32_t argb = 0;
+            if (a > 0) {
+                argb = (uint32_t)(a + 0.5f) << 24 | (uint32_t)(r / a + 0.5f) << 16 |
+                       (uint32_t)(g / a + 0.5f) << 8 | (uint32_t)(b / a + 0.5f);
+            }
+            write_pixel(dst, data, x, y, argb);
+        }
+    }
+
+    dst->data_size = dw * dh * bpp;
+    dst->data = data;
+}
+
+static void prepare_spools(void) {
+    if (spools_prepared) return;
+    spools_prepared = true;
+    scale_image(&img_spool_clean, SPOOL_SCALE, &spool_clean_scaled);
+    scale_image(&img_spool_fill, SPOOL_SCALE, &spool_fill_scaled);
+    ESP_LOGI(TAG, "Spool images prescaled to %dx%d",
+             (int)spool_clean_scaled.header.w, (int)spool_clean_scaled.header.h);
+}
+
+// =============================================================================
+// Widget
+// =============================================================================
+
+typedef struct {
+    uint32_t rgba;              // 0 = empty
+    char material[16];          // AmsTrayCInfo.tray_type
+    char fill[8];
+} strip_slot_t;
+
+typedef struct {
+    lv_obj_t obj;
+    const strip_layout_t *layout;
+    const lv_image_dsc_t *hatch;
+    uint8_t slot_count;
+    int8_t active;
+    int8_t pressed;
+    char name[8];
+    char slot_labels[UI_AMS_STRIP_MAX_SLOTS][8];
+    strip_slot_t slots[UI_AMS_STRIP_MAX_SLOTS];
+} ui_ams_strip_t;
+
+static void ui_ams_strip_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void ui_ams_strip_event(const lv_obj_class_t *class_p, lv_event_t *e);
+
+static const lv_obj_class_t ui_ams_strip_class = {
+    .base_class = &lv_obj_class,
+    .constructor_cb = ui_ams_strip_constructor,
+    .event_cb = ui_ams_strip_event,
+    .instance_size = sizeof(ui_ams_strip_t),
+};
+
+static void ui_ams_strip_constructor(const lv_obj_class_t *class_p, lv_obj_t *obj) {
+    LV_UNUSED(class_p);
+    ui_ams_strip_t *strip = (ui_ams_strip_t *)obj;
+    strip->active = -1;
+    strip->pressed = -1;
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+}
+
+static void slot_area(const lv_obj_t *obj, const strip_layout_t *l, int slot, lv_area_t *out) {
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    out->x1 = coords.x1 + l->slot_x[slot];
+    out->y1 = coords.y1 + l->slot_y[slot];
+    out->x2 = out->x1 + l->slot_w - 1;
+    out->y2 = out->y1 + l->slot_h - 1;
+}
+
+// Overview slots draw beyond their box (spool image, text) - redraw the whole strip
+static void invalidate_slot(lv_obj_t *obj, int slot) {
+    const ui_ams_strip_t *strip = (const ui_ams_strip_t *)obj;
+    if (strip->layout->text) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+    lv_area_t area;
+    slot_area(obj, strip->layout, slot, &area);
+    lv_obj_invalidate_area(obj, &area);
+}
+
+static lv_color_t rgba_to_color(uint32_t rgba) {
+    return lv_color_make((rgba >> 24) & 0xFF, (rgba >> 16) & 0xFF, (rgba >> 8) & 0xFF);
+}
+
+static void draw_text(lv_layer_t *layer, const lv_area_t *coords, const char *text,
+                      const lv_font_t *font, lv_color_t color, int x, int y, int w,
+                      lv_text_align_t align) {
+    if (!text || !text[0]) return;
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.text = text;
+    dsc.font = font;
+    dsc.color = color;
+    dsc.align = align;
+
+    lv_area_t area = {
+        .x1 = coords->x1 + x,
+        .y1 = coords->y1 + y,
+        .x2 = coords->x1 + x + w - 1,
+        .y2 = coords->y1 + y + lv_font_get_line_height(font) - 1,
+    };
+    lv_draw_label(layer, &dsc, &area);
+}
+
+static void draw_image(lv_layer_t *layer, const lv_image_dsc_t *src, const lv_area_t *area,
+                       const lv_color_t *recolor) {
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = src;
+    if (recolor) {
+        dsc.recolor = *recolor;
+        dsc.recolor_opa = LV_OPA_COVER;
+    }
+    lv_draw_image(layer, &dsc, area);
+}
+
+// Scaled copy when prepared, else the EEZ image transformed at draw time
+static void draw_spool(lv_layer_t *layer, const lv_image_dsc_t *scaled, const lv_image_dsc_t *orig,
+                       const lv_area_t *box, const lv_color_t *recolor) {
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    lv_area_t area;
+
+    if (scaled->data) {
+        dsc.src = scaled;
+        area.x1 = box->x1 + (lv_area_get_width(box) - (int)scaled->header.w) / 2;
+        area.y1 = box->y1 + (lv_area_get_height(box) - (int)scaled->header.h) / 2;
+        area.x2 = area.x1 + scaled->header.w - 1;
+        area.y2 = area.y1 + scaled->header.h - 1;
+    } else {
+        dsc.src = orig;
+        dsc.scale_x = SPOOL_SCALE;
+        dsc.scale_y = SPOOL_SCALE;
+        dsc.pivot.x = orig->header.w / 2;
+        dsc.pivot.y = orig->header.h / 2;
+        area.x1 = box->x1 + (lv_area_get_width(box) - (int)orig->header.w) / 2;
+        area.y1 = box->y1 + (lv_area_get_height(box) - (int)orig->header.h) / 2;
+        area.x2 = area.x1 + orig->header.w - 1;
+        area.y2 = area.y1 + orig->header.h - 1;
+    }
+    if (recolor) {
+        dsc.recolor = *recolor;
+        dsc.recolor_opa = LV_OPA_COVER;
+    }
+    lv_draw_image(layer, &dsc, &area);
+}
+
+static void draw_slot(lv_obj_t *obj, lv_layer_t *layer, int i) {
+    const ui_ams_strip_t *strip = (const ui_ams_strip_t *)obj;
+    const strip_layout_t *l = strip->layout;
+    const strip_slot_t *slot = &strip->slots[i];
+    bool empty = slot->rgba == 0;
+    bool active = strip->active == i;
+
+    lv_area_t box;
+    slot_area(obj, l, i, &box);
+
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.radius = l->radius;
+    rect.border_color = lv_color_hex(active ? ACCENT_GREEN : l->border_color);
+    rect.border_width = active ? l->active_border_width : l->border_width;
+    rect.border_opa = LV_OPA_COVER;
+    lv_color_t fill = empty ? lv_color_hex(l->empty_color) : rgba_to_color(slot->rgba);
+
+    if (l->text) {
+        // Overview: border under the spool images (as on the EEZ image objects)
+        rect.bg_opa = LV_OPA_TRANSP;
+        lv_draw_rect(layer, &rect, &box);
+        draw_spool(layer, &spool_clean_scaled, &img_spool_clean, &box, NULL);
+        draw_spool(layer, &spool_fill_scaled, &img_spool_fill, &box, &fill);
+        if (empty && strip->hatch) {
+            lv_color_t hatch = lv_color_hex(l->hatch_color);
+            draw_image(layer, strip->hatch, &box, &hatch);
+        }
+    } else if (!empty || !strip->hatch) {
+        rect.bg_color = fill;
+        rect.bg_opa = LV_OPA_COVER;
+        lv_draw_rect(layer, &rect, &box);
+    } else {
+        // Empty: background, hatching, then the border on top
+        lv_draw_rect_dsc_t bg;
+        lv_draw_rect_dsc_init(&bg);
+        bg.radius = l->radius;
+        bg.bg_color = fill;
+        bg.bg_opa = LV_OPA_COVER;
+        lv_draw_rect(layer, &bg, &box);
+
+        lv_color_t hatch = lv_color_hex(l->hatch_color);
+        draw_image(layer, strip->hatch, &box, &hatch);
+
+        rect.bg_opa = LV_OPA_TRANSP;
+        lv_draw_rect(layer, &rect, &box);
+    }
+
+    if (!l->text) return;
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_color_t text_color = lv_obj_get_style_text_color(obj, LV_PART_MAIN);
+    const strip_text_layout_t *t = l->text;
+    int w = lv_area_get_width(&coords);
+
+    draw_text(layer, &coords, slot->material, &lv_font_montserrat_10, text_color,
+              t->material_x[i], t->material_y, w - t->material_x[i], LV_TEXT_ALIGN_LEFT);
+    if (strip->slot_count > 1) {
+        draw_text(layer, &coords, strip->slot_labels[i], &lv_font_montserrat_10, text_color,
+                  t->label_x[i], t->label_y, SLOT_LABEL_W, LV_TEXT_ALIGN_CENTER);
+    }
+    draw_text(layer, &coords, slot->fill, &lv_font_montserrat_10, text_color,
+              t->fill_x[i], t->fill_y, w - t->fill_x[i], LV_TEXT_ALIGN_LEFT);
+}
+
+static void draw_strip(lv_obj_t *obj, lv_layer_t *layer) {
+    const ui_ams_strip_t *strip = (const ui_ams_strip_t *)obj;
+    const strip_layout_t *l = strip->layout;
+
+    if (l->name_font && strip->name[0]) {
+        lv_area_t coords;
+        lv_obj_get_coords(obj, &coords);
+        draw_text(layer, &coords, strip->name, l->name_font,
+                  lv_obj_get_style_text_color(obj, LV_PART_MAIN),
+                  l->name_x, l->name_y, lv_area_get_width(&coords) - l->name_x, LV_TEXT_ALIGN_LEFT);
+    }
+    for (int i = 0; i < strip->slot_count; i++) {
+        draw_slot(obj, layer, i);
+    }
+}
+
+static int slot_at(lv_obj_t *obj, const lv_point_t *p) {
+    const ui_ams_strip_t *strip = (const ui_ams_strip_t *)obj;
+    const strip_layout_t *l = strip->layout;
+    for (int i = 0; i < strip->slot_count; i++) {
+        lv_area_t area;
+        slot_area(obj, l, i, &area);
+        lv_area_increase(&area, l->hit_pad, l->hit_pad);
+        if (lv_area_is_point_on(&area, p, 0)) return i;
+    }
+    return -1;
+}
+
+static void ui_ams_strip_event(const lv_obj_class_t *class_p, lv_event_t *e) {
+    LV_UNUSED(class_p);
+
+    // Background, border and shadow from the styles
+    if (lv_obj_event_base(MY_CLASS, e) != LV_RESULT_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    ui_ams_strip_t *strip = (ui_ams_strip_t *)obj;
+
+    if (code == LV_EVENT_DRAW_MAIN) {
+        draw_strip(obj, lv_event_get_layer(e));
+    } else if (code == LV_EVENT_PRESSED) {
+        lv_indev_t *indev = lv_indev_active();
+        strip->pressed = -1;
+        if (indev) {
+            lv_point_t p;
+            lv_indev_get_point(indev, &p);
+            strip->pressed = slot_at(obj, &p);
+        }
+    }
+}
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+lv_obj_t *ui_ams_strip_create(lv_obj_t *parent, ui_ams_strip_kind_t kind, int slot_count) {
+    int single = slot_count == 1;
+    const strip_layout_t *l = &layouts[kind][single];
+
+    lv_obj_t *obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+
+    ui_ams_strip_t *strip = (ui_ams_strip_t *)obj;
+    strip->layout = l;
+    strip->slot_count = single ? 1 : UI_AMS_STRIP_MAX_SLOTS;
+    strip->hatch = get_hatch_mask(kind, single);
+    if (l->text) prepare_spools();
+
+    lv_obj_set_size(obj, l->w, l->h);
+    return obj;
+}
+
+int ui_ams_strip_get_slot_count(lv_obj_t *strip) {
+    LV_ASSERT_OBJ(strip, MY_CLASS);
+    return ((ui_ams_strip_t *)strip)->slot_count;
+}
+
+void ui_ams_strip_set_name(lv_obj_t *obj, const char *name) {
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    ui_ams_strip_t *strip = (ui_ams_strip_t *)obj;
+    if (!name) name = "";
+    if (strncmp(strip->name, name, sizeof(strip->name) - 1) == 0) return;
+
+    snprintf(strip->name, sizeof(strip->name), "%s", name);
+    for (int i = 0; i < strip->slot_count; i++) {
+        snprintf(strip->slot_labels[i], sizeof(strip->slot_labels[i]), "%.5s%d", name, i + 1);
+    }
+    lv_obj_invalidate(obj);
+}
+
+void ui_ams_strip_set_slot(lv_obj_t *obj, int slot, uint32_t rgba,
+                           const char *material, const char *fill) {
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    ui_ams_strip_t *strip = (ui_ams_strip_t *)obj;
+    if (slot < 0 || slot >= strip->slot_count) return;
+
+    strip_slot_t *s = &strip->slots[slot];
+    if (!material) material = "";
+    if (!fill) fill = "";
+    if (s->rgba == rgba &&
+        strncmp(s->material, material, sizeof(s->material) - 1) == 0 &&
+        strncmp(s->fill, fill, sizeof(s->fill) - 1) == 0) {
+        return;
+    }
+
+    s->rgba = rgba;
+    snprintf(s->material, sizeof(s->material), "%s", material);
+    snprintf(s->fill, sizeof(s->fill), "%s", fill);
+    invalidate_slot(obj, slot);
+}
+
+void ui_ams_strip_set_active(lv_obj_t *obj, int slot) {
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    ui_ams_strip_t *strip = (ui_ams_strip_t *)obj;
+    if (slot < 0 || slot >= strip->slot_count) slot = -1;
+    if (strip->active == slot) return;
+
+    if (strip->active >= 0) invalidate_slot(obj, strip->active);
+    strip->active = slot;
+    if (slot >= 0) invalidate_slot(obj, slot);
+}
+
+int ui_ams_strip_get_active(lv_obj_t *obj) {
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    return ((ui_ams_strip_t *)obj)->active;
+}
+
+int ui_ams_strip_get_pressed_slot(lv_obj_t *obj) {
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    return ((ui_ams_strip_t *)obj)->pressed;
+}
+
+// Clear every `objects` entry pointing at obj or one of its descendants
+// (the struct only holds lv_obj_t pointers)
+static void forget_eez_objects(lv_obj_t *obj) {
+    lv_obj_t **entry = (lv_obj_t **)&objects;
+    for (size_t i = 0; i < sizeof(objects) / sizeof(lv_obj_t *); i++) {
+        if (entry[i] == obj) entry[i] = NULL;
+    }
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) {
+        forget_eez_objects(lv_obj_get_child(obj, i));
+    }
+}
+
+int ui_ams_strip_replace(lv_obj_t *strip, lv_obj_t *const objs[], int count) {
+    lv_obj_t *parent = lv_obj_get_parent(strip);
+    int deleted = 0;
+    for (int i = 0; i < count; i++) {
+        lv_obj_t *obj = objs[i];
+        if (!obj) continue;
+        if (obj == strip || lv_obj_get_parent(obj) != parent) {
+            ESP_LOGW(TAG, "Not replacing %p: not a sibling of the strip", (void *)obj);
+            continue;
+        }
+
+        forget_eez_objects(obj);
+        lv_obj_delete(obj);
+        deleted++;
+    }
+    return deleted;
+}
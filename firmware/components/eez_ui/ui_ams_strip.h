@@ -0,0 +1,89 @@
+/**
+ * @file ui_ams_strip.h
+ * @brief One-object AMS unit widget (main screen, AMS overview, scan result)
+ *
+ * Draws a whole AMS unit in a single draw callback: unit name, slot fills,
+ * hatching of empty slots and the highlight of the active (or selected)
+ * slot. The hatching is a pre-rendered A8 mask per slot size with the slot's
+ * rounded corners baked in, so empty slots need neither stripe objects,
+ * transformed layers nor clip_corner. The overview spool images are scaled
+ * once at first use instead of on every redraw.
+ *
+ * Replaces the per-slot objects: 1 object per unit instead of up to 18
+ * (main screen), 32 (overview) or 17 (scan result).
+ *
+ * LVGL thread only. Shared between firmware and simulator.
+ */
+
+#ifndef UI_AMS_STRIP_H
+#define UI_AMS_STRIP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UI_AMS_STRIP_MAX_SLOTS 4
+
+// Screen the strip is laid out for (positions match the EEZ design)
+typedef enum {
+    UI_AMS_STRIP_MAIN,      // Main screen: bordered box, name above small square slots
+    UI_AMS_STRIP_SCAN,      // Scan result: name left of large square slots
+    UI_AMS_STRIP_OVERVIEW,  // AMS overview: spools with material, slot name and fill level
+} ui_ams_strip_kind_t;
+
+/**
+ * Create a strip
+ * @param kind Screen layout
+ * @param slot_count 1 (HT, external) or 4 (regular AMS)
+ * @return The strip; size is set by the layout, position by the caller.
+ *         MAIN strips are styled by the caller like any container (bg, border, shadow).
+ */
+lv_obj_t *ui_ams_strip_create(lv_obj_t *parent, ui_ams_strip_kind_t kind, int slot_count);
+
+int ui_ams_strip_get_slot_count(lv_obj_t *strip);
+
+/**
+ * Unit name ("A", "HT-A", ...). The overview doesn't draw it but labels its
+ * slots with it ("A1" to "A4").
+ */
+void ui_ams_strip_set_name(lv_obj_t *strip, const char *name);
+
+/**
+ * Set one slot, redraws only if something changed
+ * @param rgba Filament color (0xRRGGBBAA), 0 = empty (hatched)
+ * @param material Overview only, NULL or "" = none
+ * @param fill Overview only, NULL or "" = none
+ */
+void ui_ams_strip_set_slot(lv_obj_t *strip, int slot, uint32_t rgba,
+                           const char *material, const char *fill);
+
+/**
+ * Highlight one slot (active tray, or the selection on the scan result screen)
+ * @param slot Slot index, -1 = none
+ */
+void ui_ams_strip_set_active(lv_obj_t *strip, int slot);
+int ui_ams_strip_get_active(lv_obj_t *strip);
+
+/**
+ * Slot under the last press, for LV_EVENT_CLICKED handlers
+ * @return Slot index, -1 if the press was outside all slots
+ */
+int ui_ams_strip_get_pressed_slot(lv_obj_t *strip);
+
+/**
+ * Delete the EEZ objects a strip replaces. Only siblings of the strip are
+ * deleted; their `objects` entries and those of their descendants are cleared.
+ * @param objs EEZ objects, NULL entries are skipped
+ * @return Number of objects deleted
+ */
+int ui_ams_strip_replace(lv_obj_t *strip, lv_obj_t *const objs[], int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_AMS_STRIP_H */
@@ -0,0 +1,217 @@
+/**
+ * @file ui_async.c
+ * @brief Asynchronous backend requests for UI-thread callers
+ *
+ * Requests live in a fixed slot array. Workers take slot indices from a
+ * queue, run the work callback and post the slot to the LVGL thread, which
+ * runs the done callback and frees the slot. Slots are only claimed and
+ * released on the LVGL thread, so they need no lock.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#include "ui_async.h"
+#include <stdint.h>
+#include <stdio.h>
+#include "esp_log.h"
+
+#ifdef ESP_PLATFORM
+#include "ui_internal.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+extern bool display_ui_post(void (*cb)(void *arg), void *arg);
+#endif
+
+static const char *TAG = "ui_async";
+
+// Delay before retrying a post to a full UI queue
+#define POST_RETRY_MS 20
+
+typedef struct {
+    ui_async_cb_t work;
+    ui_async_cb_t done;
+    void *ctx;
+    bool used;
+} request_t;
+
+static request_t requests[UI_ASYNC_MAX_REQUESTS];
+static bool started = false;
+
+// =============================================================================
+// Platform
+// =============================================================================
+
+#ifdef ESP_PLATFORM
+
+static QueueHandle_t pending_queue;     // Slot indices waiting for a worker
+
+static void sleep_ms(int ms) { vTaskDelay(pdMS_TO_TICKS(ms)); }
+
+static void queue_push(uint8_t slot) {
+    xQueueSend(pending_queue, &slot, portMAX_DELAY);
+}
+
+static uint8_t queue_pop(void) {
+    uint8_t slot;
+    xQueueReceive(pending_queue, &slot, portMAX_DELAY);
+    return slot;
+}
+
+#else
+
+static pthread_mutex_t queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t queue_cond = PTHREAD_COND_INITIALIZER;
+static uint8_t pending[UI_ASYNC_MAX_REQUESTS];
+static int pending_head = 0;
+static int pending_count = 0;
+
+static void sleep_ms(int ms) { usleep(ms * 1000); }
+
+// Never full: at most one entry per slot
+static void queue_push(uint8_t slot) {
+    pthread_mutex_lock(&queue_mutex);
+    pending[(pending_head + pending_count) % UI_ASYNC_MAX_REQUESTS] = slot;
+    pending_count++;
+    pthread_cond_signal(&queue_cond);
+    pthread_mutex_unlock(&queue_mutex);
+}
+
+static uint8_t queue_pop(void) {
+    pthread_mutex_lock(&queue_mutex);
+    while (pending_count == 0) {
+        pthread_cond_wait(&queue_cond, &queue_mutex);
+    }
+    uint8_t slot = pending[pending_head];
+    pending_head = (pending_head + 1) % UI_ASYNC_MAX_REQUESTS;
+    pending_count--;
+    pthread_mutex_unlock(&queue_mutex);
+    return slot;
+}
+
+#endif
+
+// =============================================================================
+// Workers
+// =============================================================================
+
+// LVGL thread
+static void complete_request(void *arg) {
+    request_t *req = arg;
+    if (req->done) {
+        req->done(req->ctx);
+    }
+    req->used = false;
+}
+
+static void run_worker(void) {
+    for (;;) {
+        request_t *req = &requests[queue_pop()];
+        req->work(req->ctx);
+
+        // The UI queue drains every frame - keep trying rather than lose done
+        bool logged = false;
+        while (!display_ui_post(complete_request, req)) {
+            if (!logged) {
+                ESP_LOGI(TAG, "UI queue full, retrying completion");
+                logged = true;
+            }
+            sleep_ms(POST_RETRY_MS);
+        }
+    }
+}
+
+#ifdef ESP_PLATFORM
+static void worker_task(void *arg) {
+    (void)arg;
+    run_worker();
+}
+#else
+static void *worker_thread(void *arg) {
+    (void)arg;
+    run_worker();
+    return NULL;
+}
+#endif
+
+static bool start_workers(void) {
+#ifdef ESP_PLATFORM
+    pending_queue = xQueueCreate(UI_ASYNC_MAX_REQUESTS, sizeof(uint8_t));
+    if (!pending_queue) {
+        ESP_LOGE(TAG, "Failed to create request queue");
+        return false;
+    }
+#endif
+
+    int running = 0;
+    for (int i = 0; i < UI_ASYNC_WORKERS; i++) {
+#ifdef ESP_PLATFORM
+        char name[16];
+        snprintf(name, sizeof(name), "ui_async_%d", i);
+        // Lower priority than the render task
+        if (xTaskCreate(worker_task, name, UI_ASYNC_STACK_SIZE, NULL, UI_ASYNC_TASK_PRIO,
+                        NULL) == pdPASS) {
+            running++;
+        }
+#else
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, worker_thread, NULL) == 0) {
+            pthread_detach(thread);
+            running++;
+        }
+#endif
+    }
+
+    ESP_LOGI(TAG, "%d of %d workers started", running, UI_ASYNC_WORKERS);
+#ifdef ESP_PLATFORM
+    if (running == 0) {
+        // The next submit retries from scratch
+        vQueueDelete(pending_queue);
+        pending_queue = NULL;
+    }
+#endif
+    return running > 0;
+}
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+bool ui_async_submit(ui_async_cb_t work, ui_async_cb_t done, void *ctx) {
+    if (!work) return false;
+
+    if (!started) {
+        if (!start_workers()) return false;
+        started = true;
+    }
+
+    int slot = -1;
+    for (int i = 0; i < UI_ASYNC_MAX_REQUESTS; i++) {
+        if (!requests[i].used) {
+            requests[i].work = work;
+            requests[i].done = done;
+            requests[i].ctx = ctx;
+            requests[i].used = true;
+            slot = i;
+            break;
+        }
+    }
+
+    if (slot < 0) {
+        ESP_LOGE(TAG, "All %d request slots busy", UI_ASYNC_MAX_REQUESTS);
+        return false;
+    }
+
+    queue_push((uint8_t)slot);
+    return true;
+}
+
+bool ui_async_idle(void) {
+    for (int i = 0; i < UI_ASYNC_MAX_REQUESTS; i++) {
+        if (requests[i].used) return false;
+    }
+    return true;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file ui_async.h
+ * @brief Asynchronous backend requests for UI-thread callers
+ *
+ * Blocking backend calls (HTTP, up to the curl / client timeout) must not run
+ * on the LVGL thread. Submit them here instead: the work callback runs on a
+ * small pool of persistent worker tasks, the done callback is then posted to
+ * the LVGL thread with display_ui_post().
+ *
+ * - work must not touch LVGL; it fills the caller's context
+ * - done runs on the LVGL thread exactly once per accepted request and owns
+ *   the context (free it there). The UI that submitted the request may be
+ *   gone by then - compare a generation counter before using it.
+ *
+ * Shared between firmware (FreeRTOS tasks) and simulator (pthreads).
+ */
+
+#ifndef UI_ASYNC_H
+#define UI_ASYNC_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Persistent worker tasks
+#ifndef UI_ASYNC_WORKERS
+#define UI_ASYNC_WORKERS 2
+#endif
+
+// Requests queued or running at the same time
+#ifndef UI_ASYNC_MAX_REQUESTS
+#define UI_ASYNC_MAX_REQUESTS 8
+#endif
+
+// Worker task stack (bytes, firmware only)
+#ifndef UI_ASYNC_STACK_SIZE
+#define UI_ASYNC_STACK_SIZE 6144
+#endif
+
+// FreeRTOS priority of the LVGL render task (display_driver). Workers run
+// one below it so a burst of responses can't delay a frame.
+#ifndef UI_RENDER_TASK_PRIO
+#define UI_RENDER_TASK_PRIO 5
+#endif
+#define UI_ASYNC_TASK_PRIO (UI_RENDER_TASK_PRIO - 1)
+
+typedef void (*ui_async_cb_t)(void *ctx);
+
+/**
+ * Queue a request (LVGL thread). Workers are started on first use.
+ * @param work Runs on a worker task (required)
+ * @param done Runs on the LVGL thread afterwards (optional)
+ * @return false if all request slots are busy - neither callback will run
+ */
+bool ui_async_submit(ui_async_cb_t work, ui_async_cb_t done, void *ctx);
+
+/**
+ * No request queued, running or waiting for its done callback (LVGL thread)
+ */
+bool ui_async_idle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_ASYNC_H */
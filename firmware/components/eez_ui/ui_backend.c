@@ -9,6 +9,9 @@
  */
 
 #include "screens.h"
+#include "ui_state.h"
+#include "ui_ams_strip.h"
+#include "ui_shadow.h"
 #include <lvgl.h>
 #include <stdio.h>
 #include <string.h>
@@ -17,6 +20,7 @@
 // Firmware: use ESP-IDF and Rust FFI backend
 #include "ui_internal.h"
 #include "ui_ams_slot_modal.h"
+#include "ui_cover_cache.h"
 #include "esp_log.h"
 static const char *TAG = "ui_backend";
 #else
@@ -34,20 +38,16 @@ extern void ui_scan_result_init(void);
 extern void ui_scan_result_refresh_ams(void);
 #endif
 
-// Update counter for rate limiting UI updates
-static int backend_update_counter = 0;
+// Set by the ui_state observers when published backend state changes
+static bool backend_ui_dirty = true;
 // Track previous screen to detect navigation
 static int previous_screen = -1;
-// Flag to update more frequently when data is stale
-static bool needs_data_refresh = true;
-// Last displayed time (to avoid redundant updates)
-static int last_time_hhmm = -1;
 // Last printer count for dropdown update tracking
 static int last_printer_count = -1;
 static uint8_t last_connected_mask = 0;  // Bitmask of connected printers (up to 8)
 // Cover image state
-static bool cover_displayed = false;
-static lv_image_dsc_t cover_img_dsc;
+static const lv_image_dsc_t *cover_shown = NULL;  // Owned by ui_cover_cache
+static uint32_t cover_shown_gen = 0;
 // Selected printer index (changed via dropdown)
 static int selected_printer_index = 0;
 // Track if selected printer is dual-nozzle (default false, detected from AMS data)
@@ -55,6 +55,11 @@ static bool selected_printer_is_dual_nozzle = false;
 // Mapping from dropdown index to actual printer index (only connected printers in dropdown)
 static int dropdown_to_printer_index[8] = {0, 1, 2, 3, 4, 5, 6, 7};
 static int dropdown_printer_count = 0;
+static uint32_t last_dropdown_generation = 0;  // Snapshot generation the dropdown was checked against
+
+// Printer/AMS state, refreshed once per backend update. Reused across calls so
+// backend_get_snapshot() only copies entries whose generation changed.
+static BackendSnapshot backend_snapshot;
 
 // Dynamic UI labels (created on main screen - must be reset when screen changes)
 static lv_obj_t *status_eta_label = NULL;      // ETA on status row
@@ -79,8 +84,7 @@ void ui_set_status_message(const char *message) {
 
 // Forward declarations
 static void update_main_screen_backend_status(BackendStatus *status);
-static void update_clock_displays(void);
-static void update_printer_dropdowns(BackendStatus *status);
+static void update_printer_dropdowns(void);
 static void update_cover_image(void);
 static void update_ams_display(void);
 static void update_ams_overview_display(void);
@@ -91,51 +95,32 @@ static void reset_main_screen_dynamic_state(void);  // Reset stale pointers on s
 /**
  * @brief Update UI elements with backend printer status
  *
- * This function is called periodically from ui_tick() to refresh the UI
- * with the latest printer status from the backend server.
+ * Called from ui_tick() on every tick. Does nothing unless a subject it
+ * observes (backend, printers, cover, clock, update) changed or the screen
+ * changed since the last call.
  */
 void update_backend_ui(void) {
     // Get current screen ID
     int screen_id = currentScreen + 1;  // Convert to ScreensEnum (1-based)
 
-    // Detect any screen change
-    bool screen_changed = (screen_id != previous_screen);
-
-    // Force immediate update when navigating to main screen or AMS overview
-    bool force_update = ((screen_id == SCREEN_ID_MAIN_SCREEN || screen_id == SCREEN_ID_AMS_OVERVIEW) && screen_changed);
-    if (force_update) {
-        needs_data_refresh = true;
-    }
-    previous_screen = screen_id;
-
-    // Always update notification bell on screen change (no rate limiting)
-    // This ensures the notification dot appears on all screens
-    if (screen_changed) {
-        update_notification_bell();
-        // Force dropdown update on next tick for the new screen
+    // A new screen needs everything populated once
+    if (screen_id != previous_screen) {
+        previous_screen = screen_id;
+        backend_ui_dirty = true;
         // Each screen has its own dropdown which needs to be populated
         last_printer_count = -1;
         last_connected_mask = 0;
     }
 
-    // Rate limiting for other updates:
-    // - Every 20 ticks (~100ms) when waiting for data
-    // - Every 40 ticks (~200ms) when we have data (fast enough for responsive status updates)
-    int rate_limit = needs_data_refresh ? 20 : 40;
-    if (!force_update && ++backend_update_counter < rate_limit) {
+    if (!backend_ui_dirty) {
         return;
     }
-    backend_update_counter = 0;
+    backend_ui_dirty = false;
 
     // Get backend connection status
     BackendStatus status;
     backend_get_status(&status);
 
-    // Check if we got valid data
-    if (status.state == 2 && status.printer_count > 0) {
-        needs_data_refresh = false;
-    }
-
     // Update based on current screen
     if (screen_id == SCREEN_ID_MAIN_SCREEN) {
         update_main_screen_backend_status(&status);
@@ -145,11 +130,8 @@ void update_backend_ui(void) {
         update_ams_overview_display();
     }
 
-    // Update clock on all screens
-    update_clock_displays();
-
     // Update printer dropdowns
-    update_printer_dropdowns(&status);
+    update_printer_dropdowns();
 
     // Sync saved_printers with backend data (for settings page)
     sync_printers_from_backend();
@@ -159,14 +141,55 @@ void update_backend_ui(void) {
         update_printers_list();
     }
 
-    // Update notification bell periodically (in addition to screen changes)
+    // Firmware update indicators (bell dot, settings menu item)
     update_notification_bell();
+    update_settings_menu_indicator();
+}
 
-    // Note: Status bar is now managed by ui_status_bar.c
-    // The old update_status_bar() is no longer called
+static void backend_state_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
+    (void)observer;
+    (void)subject;
+    backend_ui_dirty = true;
+}
 
-    // Update settings menu firmware indicator
-    update_settings_menu_indicator();
+/**
+ * @brief Subscribe to the published state that backend UI elements show
+ *
+ * Call once after ui_state_init(). Clock labels and WiFi icons bind to
+ * their subjects directly (see ui_state.c).
+ */
+void ui_backend_bind_state(void) {
+    lv_subject_add_observer(&ui_subject_backend, backend_state_observer_cb, NULL);
+    lv_subject_add_observer(&ui_subject_printers, backend_state_observer_cb, NULL);
+    lv_subject_add_observer(&ui_subject_cover, backend_state_observer_cb, NULL);
+    lv_subject_add_observer(&ui_subject_clock, backend_state_observer_cb, NULL);   // Main screen ETA
+    lv_subject_add_observer(&ui_subject_update, backend_state_observer_cb, NULL);
+}
+
+/**
+ * @brief Refresh the printer/AMS snapshot
+ * @return Snapshot generation (changes whenever printer or AMS data changed)
+ */
+uint32_t ui_backend_refresh_snapshot(void) {
+    backend_get_snapshot(&backend_snapshot);
+    return backend_snapshot.generation;
+}
+
+/**
+ * @brief Get the printer/AMS snapshot taken by the last state sample
+ */
+const BackendSnapshot *ui_backend_get_snapshot(void) {
+    return &backend_snapshot;
+}
+
+/**
+ * @brief Get one printer from the snapshot, NULL if the index is out of range
+ */
+static const BackendPrinterSnapshot *snapshot_printer(int index) {
+    if (index < 0 || index >= backend_snapshot.printer_count) {
+        return NULL;
+    }
+    return &backend_snapshot.printers[index];
 }
 
 /**
@@ -373,72 +396,11 @@ static void update_main_screen_backend_status(BackendStatus *status) {
     }
 }
 
-/**
- * @brief Update clock display for current screen only
- *
- * IMPORTANT: Only updates the clock for the currently active screen.
- * Other screen objects are STALE after delete_all_screens() - checking
- * for NULL doesn't help because they point to freed memory.
- */
-static void update_clock_displays(void) {
-    int time_hhmm = time_get_hhmm();
-    int screen_id = currentScreen + 1;
-
-    // Only update if time changed or first valid time
-    if (time_hhmm < 0 || time_hhmm == last_time_hhmm) {
-        return;
-    }
-    last_time_hhmm = time_hhmm;
-
-    int hour = (time_hhmm >> 8) & 0xFF;
-    int minute = time_hhmm & 0xFF;
-
-    char time_str[8];
-    snprintf(time_str, sizeof(time_str), "%02d:%02d", hour, minute);
-
-    // Update clock for CURRENT screen only - other screen objects are stale!
-    lv_obj_t *clock = NULL;
-
-    switch (screen_id) {
-        case SCREEN_ID_MAIN_SCREEN:
-            clock = objects.top_bar_clock;
-            break;
-        case SCREEN_ID_AMS_OVERVIEW:
-            clock = objects.ams_screen_top_bar_clock;
-            break;
-        case SCREEN_ID_SCAN_RESULT:
-            clock = objects.scan_screen_top_bar_label_clock;
-            break;
-        case SCREEN_ID_SPOOL_DETAILS:
-            clock = objects.spool_screen_top_bar_label_clock;
-            break;
-        case SCREEN_ID_SETTINGS_SCREEN:
-            clock = objects.settings_screen_top_bar_label_clock;
-            break;
-        case SCREEN_ID_SETTINGS_WIFI_SCREEN:
-            clock = objects.settings_wifi_screen_top_bar_label_clock;
-            break;
-        case SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN:
-            clock = objects.settings_printer_add_screen_top_bar_label_clock;
-            break;
-        case SCREEN_ID_SETTINGS_DISPLAY_SCREEN:
-            clock = objects.settings_display_screen_top_bar_label_clock;
-            break;
-        case SCREEN_ID_SETTINGS_UPDATE_SCREEN:
-            clock = objects.settings_update_screen_top_bar_label_clock;
-            break;
-    }
-
-    if (clock) {
-        lv_label_set_text(clock, time_str);
-    }
-}
-
 /**
  * @brief Get the printer dropdown for the current screen
  *
  * IMPORTANT: Only returns the dropdown for the currently active screen.
- * Other screen objects are STALE after delete_all_screens().
+ * Other screen objects are STALE once their screen is deleted.
  */
 static lv_obj_t* get_current_printer_dropdown(int screen_id) {
     switch (screen_id) {
@@ -469,26 +431,30 @@ static lv_obj_t* get_current_printer_dropdown(int screen_id) {
  * @brief Update printer selection dropdown for current screen
  *
  * IMPORTANT: Only updates the dropdown for the currently active screen.
- * Other screen objects are STALE after delete_all_screens().
+ * Other screen objects are STALE once their screen is deleted.
  */
-static void update_printer_dropdowns(BackendStatus *status) {
+static void update_printer_dropdowns(void) {
+    // Nothing to check until the snapshot changes (a forced update resets last_printer_count)
+    if (last_printer_count >= 0 && backend_snapshot.generation == last_dropdown_generation) {
+        return;
+    }
+    last_dropdown_generation = backend_snapshot.generation;
+
     // Build current connected mask to detect connection status changes
+    int printer_count = backend_snapshot.printer_count;
     uint8_t connected_mask = 0;
-    for (int i = 0; i < status->printer_count && i < 8; i++) {
-        BackendPrinterInfo printer;
-        if (backend_get_printer(i, &printer) == 0) {
-            if (printer.connected) {
-                connected_mask |= (1 << i);
-            }
+    for (int i = 0; i < printer_count; i++) {
+        if (backend_snapshot.printers[i].info.connected) {
+            connected_mask |= (1 << i);
         }
     }
 
     // Only update when printer count OR connection status changes
-    if (status->printer_count == last_printer_count && connected_mask == last_connected_mask) {
+    if (printer_count == last_printer_count && connected_mask == last_connected_mask) {
         return;
     }
 
-    last_printer_count = status->printer_count;
+    last_printer_count = printer_count;
     last_connected_mask = connected_mask;
 
     // Build options string with connected printer names and track mapping
@@ -496,9 +462,9 @@ static void update_printer_dropdowns(BackendStatus *status) {
     int pos = 0;
     dropdown_printer_count = 0;
 
-    for (int i = 0; i < status->printer_count && i < 8; i++) {
-        BackendPrinterInfo printer;
-        if (backend_get_printer(i, &printer) == 0 && printer.connected) {
+    for (int i = 0; i < printer_count; i++) {
+        const BackendPrinterInfo *printer = &backend_snapshot.printers[i].info;
+        if (printer->connected) {
             // Track mapping: dropdown index -> actual printer index
             dropdown_to_printer_index[dropdown_printer_count] = i;
             dropdown_printer_count++;
@@ -506,7 +472,7 @@ static void update_printer_dropdowns(BackendStatus *status) {
             if (pos > 0) {
                 options[pos++] = '\n';
             }
-            const char *name = printer.name[0] ? printer.name : printer.serial;
+            const char *name = printer->name[0] ? printer->name : printer->serial;
             int len = strlen(name);
             if (pos + len < sizeof(options) - 1) {
                 strcpy(&options[pos], name);
@@ -539,12 +505,8 @@ static void update_printer_dropdowns(BackendStatus *status) {
     }
 }
 
-// Cover image dimensions (must match backend COVER_SIZE - 70x70 as per EEZ design)
-#define COVER_WIDTH 70
-#define COVER_HEIGHT 70
-
 /**
- * @brief Update cover image from downloaded raw RGB565 data
+ * @brief Show the selected printer's job cover (raw RGB565 from ui_cover_cache)
  *
  * EEZ design specifies:
  * - Size: 70x70
@@ -556,39 +518,26 @@ static void update_cover_image(void) {
         return;
     }
 
-    if (backend_has_cover()) {
-        if (!cover_displayed) {
-            // Get cover data from Rust (raw RGB565 pixels)
-            uint32_t size = 0;
-            const uint8_t *data = backend_get_cover_data(&size);
-
-            // Verify size matches expected RGB565 data (70x70x2 = 9800 bytes)
-            uint32_t expected_size = COVER_WIDTH * COVER_HEIGHT * 2;
-            if (data && size == expected_size) {
-                // Set up image descriptor for raw RGB565 data
-                memset(&cover_img_dsc, 0, sizeof(cover_img_dsc));
-                cover_img_dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
-                cover_img_dsc.header.cf = LV_COLOR_FORMAT_RGB565;
-                cover_img_dsc.header.w = COVER_WIDTH;
-                cover_img_dsc.header.h = COVER_HEIGHT;
-                cover_img_dsc.header.stride = COVER_WIDTH * 2;  // RGB565 = 2 bytes per pixel
-                cover_img_dsc.data_size = size;
-                cover_img_dsc.data = data;
+    const lv_image_dsc_t *cover = ui_cover_cache_get(selected_printer_index);
+    if (cover) {
+        // A cache slot can be refilled with the next job's cover in place
+        if (cover != cover_shown || ui_cover_cache_generation() != cover_shown_gen) {
+            // Zero-copy: the descriptor points into the cache
+            lv_image_set_src(objects.main_screen_printer_print_cover, cover);
 
-                // Set the image source
-                lv_image_set_src(objects.main_screen_printer_print_cover, &cover_img_dsc);
+            // Scale 256 = 100% (1:1 mapping for 70x70 image in 70x70 container)
+            lv_image_set_scale(objects.main_screen_printer_print_cover, 256);
 
-                // Scale 256 = 100% (1:1 mapping for 70x70 image in 70x70 container)
-                lv_image_set_scale(objects.main_screen_printer_print_cover, 256);
+            // Make fully opaque when showing actual cover
+            lv_obj_set_style_opa(objects.main_screen_printer_print_cover, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
 
-                // Make fully opaque when showing actual cover
-                lv_obj_set_style_opa(objects.main_screen_printer_print_cover, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+            lv_obj_invalidate(objects.main_screen_printer_print_cover);
 
-                cover_displayed = true;
-            }
+            cover_shown = cover;
+            cover_shown_gen = ui_cover_cache_generation();
         }
     } else {
-        if (cover_displayed) {
+        if (cover_shown) {
             // No cover available, revert to placeholder
             extern const lv_image_dsc_t img_filament_spool;
             lv_image_set_src(objects.main_screen_printer_print_cover, &img_filament_spool);
@@ -599,7 +548,7 @@ static void update_cover_image(void) {
             // Semi-transparent for placeholder (as per EEZ design)
             lv_obj_set_style_opa(objects.main_screen_printer_print_cover, 128, LV_PART_MAIN | LV_STATE_DEFAULT);
 
-            cover_displayed = false;
+            cover_shown = NULL;
         }
     }
 }
@@ -608,18 +557,31 @@ static void update_cover_image(void) {
 // Dynamic AMS Display - Matches EEZ static design exactly
 // =============================================================================
 
-// Track dynamically created AMS containers for cleanup
-#define MAX_AMS_WIDGETS 8  // 4 AMS + 2 HT + 2 Ext
-static lv_obj_t *ams_widgets_left[MAX_AMS_WIDGETS];
-static lv_obj_t *ams_widgets_right[MAX_AMS_WIDGETS];
-static int ams_widget_count_left = 0;
-static int ams_widget_count_right = 0;
+// Retained AMS widgets: each unit is one ui_ams_strip object, created once and
+// kept while the unit stays on the same nozzle. The strip compares every tray
+// update with what it shows and only invalidates slots that changed.
+#define MAX_AMS_WIDGETS 8      // Per nozzle: 4 AMS + 2 HT + 2 Ext
+#define AMS_UNIT_POOL (2 * MAX_AMS_WIDGETS)
+#define MAX_AMS_SLOTS 4
+
+typedef struct {
+    bool used;
+    int id;                    // AMS unit ID
+    bool left;                 // Parent is the left nozzle container
+    int slot_count;
+    lv_obj_t *container;       // ui_ams_strip, draws name and slots itself
+    bool active;               // Container border shows the active slot
+    int x, y;
+    bool seen;                 // Present in the current refresh
+} ams_unit_widget_t;
+
+static ams_unit_widget_t ams_units[AMS_UNIT_POOL];
 static bool ams_static_hidden = false;
+static int ams_layout_dual = -1;   // Nozzle header layout shown (-1 = none yet)
+static uint32_t ams_rendered_generation = 0;  // Printer snapshot generation shown (0 = none)
 
 // Dimensions matching EEZ static design exactly
 // NOTE: EEZ uses negative positions to account for default LVGL container padding (~15px)
-#define SLOT_SIZE 23           // 23x24 in EEZ but using square
-#define SLOT_SPACING 28        // Distance between slot centers (28px between slot starts)
 #define CONTAINER_4SLOT_W 120  // 4-slot container (regular AMS)
 #define CONTAINER_4SLOT_H 50
 #define CONTAINER_1SLOT_W 56   // Single slot - TWO fit one 4-slot: (120-8)/2 = 56
@@ -667,107 +629,38 @@ static int get_global_tray_index(int ams_id, int tray_idx) {
 }
 
 /**
- * @brief Create a color slot matching EEZ design
- * Uses lv_obj_create with lv_line_create for empty slot striping (matches simulator)
+ * @brief Show or hide an object
+ * Skips the call when nothing changes - clearing HIDDEN on a visible object
+ * still invalidates its whole area.
  */
-static lv_obj_t* create_slot(lv_obj_t *parent, int x, int y, uint32_t rgba, bool is_active) {
-    // Use container for slot to allow child objects (striping lines)
-    lv_obj_t *slot = lv_obj_create(parent);
-    lv_obj_set_pos(slot, x, y);
-    lv_obj_set_size(slot, SLOT_SIZE, SLOT_SIZE + 1);
-    lv_obj_clear_flag(slot, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_pad_all(slot, 0, 0);
-
-    // Extract RGB from RGBA
-    uint8_t r = (rgba >> 24) & 0xFF;
-    uint8_t g = (rgba >> 16) & 0xFF;
-    uint8_t b = (rgba >> 8) & 0xFF;
-    uint32_t color_hex = (r << 16) | (g << 8) | b;
-    bool is_empty = (rgba == 0);
-
-    if (!is_empty) {
-        // Use solid color (no gradient) for better color visibility
-        lv_obj_set_style_bg_color(slot, lv_color_hex(color_hex), 0);
-        lv_obj_set_style_bg_opa(slot, 255, 0);
-        // Add subtle dark border for depth instead of gradient
-        lv_obj_set_style_border_width(slot, 1, 0);
-        lv_obj_set_style_border_color(slot, lv_color_hex(0x000000), 0);
-        lv_obj_set_style_border_opa(slot, 80, 0);
+static void set_obj_hidden(lv_obj_t *obj, bool hidden) {
+    if (!obj || lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == hidden) return;
+    if (hidden) {
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
     } else {
-        // Empty slot: darker background with striping pattern
-        lv_obj_set_style_bg_color(slot, lv_color_hex(0x0a0a0a), 0);
-        lv_obj_set_style_bg_opa(slot, 255, 0);
-
-        // Use simple rectangle objects as diagonal stripes (more reliable than lv_line)
-        // Create 3 thin rectangles positioned diagonally
-        for (int i = 0; i < 3; i++) {
-            lv_obj_t *stripe = lv_obj_create(slot);
-            lv_obj_remove_style_all(stripe);
-            lv_obj_set_size(stripe, SLOT_SIZE + 8, 3);
-            lv_obj_set_pos(stripe, -4, 6 + i * 10);  // Offset positions
-            lv_obj_set_style_bg_color(stripe, lv_color_hex(0x3a3a3a), 0);
-            lv_obj_set_style_bg_opa(stripe, 255, 0);
-            lv_obj_set_style_transform_rotation(stripe, -200, 0);  // Slight angle (0.1 deg units)
-            lv_obj_clear_flag(stripe, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-        }
+        lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
     }
-
-    lv_obj_set_style_radius(slot, 5, 0);
-    lv_obj_set_style_clip_corner(slot, true, 0);
-
-    if (is_active) {
-        lv_obj_set_style_border_color(slot, lv_color_hex(ACCENT_GREEN), 0);
-        lv_obj_set_style_border_width(slot, 3, 0);
-    } else {
-        lv_obj_set_style_border_color(slot, lv_color_hex(0xbab1b1), 0);
-        lv_obj_set_style_border_width(slot, 2, 0);
-    }
-    lv_obj_set_style_border_opa(slot, 255, 0);
-
-    return slot;
 }
 
 /**
  * @brief Create AMS container matching EEZ design exactly
- * @param tray_now Global active tray index (used to highlight active slot)
+ * Slots start empty and inactive; sync_ams_unit() applies the tray data.
  */
-static lv_obj_t* create_ams_container(lv_obj_t *parent, AmsUnitCInfo *info, int tray_now) {
+static void create_ams_container(ams_unit_widget_t *unit, lv_obj_t *parent, int id, bool left, int slot_count) {
     char name_buf[16];
-    get_ams_unit_name(info->id, name_buf, sizeof(name_buf));
-
-    int slot_count = info->tray_count > 0 ? info->tray_count : 1;
-    bool is_single_slot = (slot_count == 1);
-
-    int width = is_single_slot ? CONTAINER_1SLOT_W : CONTAINER_4SLOT_W;
-    int height = is_single_slot ? CONTAINER_1SLOT_H : CONTAINER_4SLOT_H;
+    get_ams_unit_name(id, name_buf, sizeof(name_buf));
 
-    // Create container
-    lv_obj_t *container = lv_obj_create(parent);
-    lv_obj_set_size(container, width, height);
-    lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE);
+    // One object per unit: name label and slots are drawn by the strip
+    lv_obj_t *container = ui_ams_strip_create(parent, UI_AMS_STRIP_MAIN, slot_count);
 
-    // Container styling matching EEZ exactly
+    // Container styling matching EEZ exactly (the theme doesn't style custom classes)
     lv_obj_set_style_bg_color(container, lv_color_hex(0x000000), 0);
     lv_obj_set_style_bg_opa(container, 255, 0);  // Fully opaque
     lv_obj_set_style_layout(container, LV_LAYOUT_NONE, 0);
-
-    // Check if this container has the active slot
-    bool container_active = false;
-    for (int i = 0; i < slot_count; i++) {
-        int global_tray = get_global_tray_index(info->id, i);
-        if (global_tray == tray_now) {
-            container_active = true;
-            break;
-        }
-    }
-
-    // Container border - accent green if it contains the active slot
+    lv_obj_set_style_radius(container, 10, 0);   // Default theme card radius
     lv_obj_set_style_border_width(container, 3, 0);
-    if (container_active) {
-        lv_obj_set_style_border_color(container, lv_color_hex(ACCENT_GREEN), 0);
-    } else {
-        lv_obj_set_style_border_color(container, lv_color_hex(0x3d3d3d), 0);
-    }
+    lv_obj_set_style_border_color(container, lv_color_hex(0x3d3d3d), 0);
+    lv_obj_set_style_text_color(container, lv_color_hex(0xfafafa), 0);
 
     // Shadow matching EEZ
     lv_obj_set_style_shadow_width(container, 5, 0);
@@ -775,38 +668,18 @@ static lv_obj_t* create_ams_container(lv_obj_t *parent, AmsUnitCInfo *info, int
     lv_obj_set_style_shadow_ofs_y(container, 2, 0);
     lv_obj_set_style_shadow_spread(container, 2, 0);
     lv_obj_set_style_shadow_opa(container, 100, 0);
-
-    // Label
-    lv_obj_t *label = lv_label_create(container);
-    lv_label_set_text(label, name_buf);
-    lv_obj_set_style_text_color(label, lv_color_hex(0xfafafa), 0);
-    lv_obj_set_style_text_opa(label, 255, 0);
-
-    if (is_single_slot) {
-        // Single slot: label at top-left, slot below - EEZ positions
-        lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
-        lv_obj_set_pos(label, -14, -17);  // EEZ: HT-A label position
-
-        int global_tray = get_global_tray_index(info->id, 0);
-        bool slot_active = (tray_now == global_tray);
-        uint32_t color = info->tray_count > 0 ? info->trays[0].tray_color : 0;
-        create_slot(container, -10, -1, color, slot_active);  // EEZ: x=-10, y=-1
-    } else {
-        // 4-slot: label centered at top, slots in a row - EEZ positions
-        lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
-        lv_obj_set_pos(label, 35, -18);  // EEZ position
-
-        // EEZ slot positions: -17, 11, 39, 68 (spacing of 28px)
-        int slot_x_positions[4] = {-17, 11, 39, 68};
-        for (int i = 0; i < slot_count && i < 4; i++) {
-            int global_tray = get_global_tray_index(info->id, i);
-            bool slot_active = (tray_now == global_tray);
-            uint32_t color = (i < info->tray_count) ? info->trays[i].tray_color : 0;
-            create_slot(container, slot_x_positions[i], -3, color, slot_active);
-        }
-    }
-
-    return container;
+    // Every container has the same shadow shape: blurred once, then blitted
+    ui_shadow_bake(container);
+
+    ui_ams_strip_set_name(container, name_buf);
+
+    memset(unit, 0, sizeof(*unit));
+    unit->used = true;
+    unit->id = id;
+    unit->left = left;
+    unit->slot_count = slot_count;
+    unit->container = container;
+    unit->x = INT32_MIN;  // Force initial positioning
 }
 
 /**
@@ -853,26 +726,96 @@ static lv_obj_t* create_nozzle_label(lv_obj_t *parent, const char *text) {
 }
 
 /**
- * @brief Clear dynamically created AMS widgets
+ * @brief Forget all retained AMS widgets without deleting them
+ * (their screen is being deleted)
+ */
+static void reset_ams_units(void) {
+    memset(ams_units, 0, sizeof(ams_units));
+    ams_rendered_generation = 0;
+}
+
+/**
+ * @brief Delete one retained AMS unit
+ */
+static void delete_ams_unit(ams_unit_widget_t *unit) {
+    if (unit->container) {
+        lv_obj_delete(unit->container);
+    }
+    unit->container = NULL;
+    unit->used = false;
+}
+
+/**
+ * @brief Clear all retained AMS widgets (printer changed)
  */
 static void clear_ams_widgets(void) {
-    for (int i = 0; i < ams_widget_count_left; i++) {
-        if (ams_widgets_left[i]) {
-            lv_obj_delete(ams_widgets_left[i]);
-            ams_widgets_left[i] = NULL;
+    for (int i = 0; i < AMS_UNIT_POOL; i++) {
+        if (ams_units[i].used) {
+            delete_ams_unit(&ams_units[i]);
         }
     }
-    ams_widget_count_left = 0;
+    ams_rendered_generation = 0;
+}
+
+/**
+ * @brief Create or update the retained widget for one AMS unit
+ * @param tray_now Global active tray index for the unit's nozzle
+ */
+static void sync_ams_unit(const AmsUnitCInfo *info, bool left, int tray_now, int x, int y) {
+    lv_obj_t *parent = left ? objects.main_screen_ams_left_nozzle : objects.main_screen_ams_right_nozzle;
+    if (!parent) return;
 
-    for (int i = 0; i < ams_widget_count_right; i++) {
-        if (ams_widgets_right[i]) {
-            lv_obj_delete(ams_widgets_right[i]);
-            ams_widgets_right[i] = NULL;
+    int slot_count = info->tray_count > 0 ? info->tray_count : 1;
+    if (slot_count > MAX_AMS_SLOTS) slot_count = MAX_AMS_SLOTS;
+
+    ams_unit_widget_t *unit = NULL;
+    ams_unit_widget_t *free_unit = NULL;
+    for (int i = 0; i < AMS_UNIT_POOL; i++) {
+        if (ams_units[i].used && ams_units[i].id == info->id) {
+            unit = &ams_units[i];
+            break;
+        }
+        if (!ams_units[i].used && !free_unit) {
+            free_unit = &ams_units[i];
         }
     }
-    ams_widget_count_right = 0;
-}
 
+    // Moved to the other nozzle or changed shape - rebuild this unit only
+    if (unit && (unit->left != left || unit->slot_count != slot_count)) {
+        delete_ams_unit(unit);
+        free_unit = unit;
+        unit = NULL;
+    }
+    if (!unit) {
+        if (!free_unit) return;
+        unit = free_unit;
+        create_ams_container(unit, parent, info->id, left, slot_count);
+    }
+    unit->seen = true;
+
+    if (unit->x != x || unit->y != y) {
+        lv_obj_set_pos(unit->container, x, y);
+        unit->x = x;
+        unit->y = y;
+    }
+
+    // The strip skips trays that didn't change
+    int active_slot = -1;
+    for (int i = 0; i < slot_count; i++) {
+        uint32_t color = (i < info->tray_count) ? info->trays[i].tray_color : 0;
+        if (tray_now == get_global_tray_index(info->id, i)) active_slot = i;
+        ui_ams_strip_set_slot(unit->container, i, color, NULL, NULL);
+    }
+    ui_ams_strip_set_active(unit->container, active_slot);
+    bool container_active = active_slot >= 0;
+
+    // Container border - accent green if it contains the active slot
+    if (container_active != unit->active) {
+        lv_obj_set_style_border_color(unit->container,
+            lv_color_hex(container_active ? ACCENT_GREEN : 0x3d3d3d), 0);
+        unit->active = container_active;
+    }
+}
 
 // Store nozzle header objects
 static lv_obj_t *left_badge = NULL;
@@ -896,7 +839,8 @@ static void setup_ams_containers(void) {
     hide_all_children(objects.main_screen_ams_left_nozzle);
     hide_all_children(objects.main_screen_ams_right_nozzle);
 
-    // Create nozzle headers
+    // Create nozzle headers (layout applied by update_ams_display)
+    ams_layout_dual = -1;
     if (objects.main_screen_ams_left_nozzle) {
         left_badge = create_nozzle_badge(objects.main_screen_ams_left_nozzle, "L");
         left_label = create_nozzle_label(objects.main_screen_ams_left_nozzle, "Left Nozzle");
@@ -921,13 +865,9 @@ static void reset_main_screen_dynamic_state(void) {
     progress_pct_label = NULL;
 
     // Reset AMS widgets
-    for (int i = 0; i < MAX_AMS_WIDGETS; i++) {
-        ams_widgets_left[i] = NULL;
-        ams_widgets_right[i] = NULL;
-    }
-    ams_widget_count_left = 0;
-    ams_widget_count_right = 0;
+    reset_ams_units();
     ams_static_hidden = false;
+    ams_layout_dual = -1;
 
     // Reset nozzle headers
     left_badge = NULL;
@@ -936,7 +876,7 @@ static void reset_main_screen_dynamic_state(void) {
     right_label = NULL;
 
     // Reset cover image state
-    cover_displayed = false;
+    cover_shown = NULL;
 
     // Reset printer dropdown tracking to force update
     last_printer_count = -1;
@@ -956,42 +896,44 @@ static void update_ams_display(void) {
     // Check if there's a connected printer that is actually online
     BackendStatus ams_status;
     backend_get_status(&ams_status);
-    bool has_online_printer = false;
-
-    if (ams_status.state == 2 && ams_status.printer_count > 0) {
-        // Check if the selected printer is actually online
-        BackendPrinterInfo printer_info;
-        if (backend_get_printer(selected_printer_index, &printer_info) == 0) {
-            has_online_printer = printer_info.connected;
-        }
-    }
+    const BackendPrinterSnapshot *printer = snapshot_printer(selected_printer_index);
+    bool has_online_printer = ams_status.state == 2 && printer && printer->info.connected;
 
     // If no printer online, hide both AMS containers entirely
     if (!has_online_printer) {
-        if (objects.main_screen_ams_left_nozzle) {
-            lv_obj_add_flag(objects.main_screen_ams_left_nozzle, LV_OBJ_FLAG_HIDDEN);
-        }
-        if (objects.main_screen_ams_right_nozzle) {
-            lv_obj_add_flag(objects.main_screen_ams_right_nozzle, LV_OBJ_FLAG_HIDDEN);
-        }
+        set_obj_hidden(objects.main_screen_ams_left_nozzle, true);
+        set_obj_hidden(objects.main_screen_ams_right_nozzle, true);
+        ams_rendered_generation = 0;
+        return;
+    }
+
+    // Printer and AMS data unchanged since the last refresh - nothing to do
+    if (printer->generation == ams_rendered_generation) {
         return;
     }
 
     // Setup on first call
     setup_ams_containers();
 
-    // Clear previous dynamic widgets
-    clear_ams_widgets();
-
     // Get AMS data for selected printer
-    int ams_count = backend_get_ams_count(selected_printer_index);
-    int tray_now = backend_get_tray_now(selected_printer_index);  // Legacy single-nozzle
-    int tray_now_left = backend_get_tray_now_left(selected_printer_index);
-    int tray_now_right = backend_get_tray_now_right(selected_printer_index);
-    int active_extruder = backend_get_active_extruder(selected_printer_index);  // -1=unknown, 0=right, 1=left
-
-    ESP_LOGI(TAG, "AMS display: tray_now=%d, left=%d, right=%d, active_ext=%d",
-             tray_now, tray_now_left, tray_now_right, active_extruder);
+    int ams_count = printer->ams_count;
+    int tray_now = printer->tray_now;  // Legacy single-nozzle
+    int tray_now_left = printer->tray_now_left;
+    int tray_now_right = printer->tray_now_right;
+    int active_extruder = printer->active_extruder;  // -1=unknown, 0=right, 1=left
+
+    // Only log when the tray state changes (this runs on every refresh)
+    static int logged_trays[4] = {-2, -2, -2, -2};
+    bool trays_changed = tray_now != logged_trays[0] || tray_now_left != logged_trays[1] ||
+                         tray_now_right != logged_trays[2] || active_extruder != logged_trays[3];
+    if (trays_changed) {
+        logged_trays[0] = tray_now;
+        logged_trays[1] = tray_now_left;
+        logged_trays[2] = tray_now_right;
+        logged_trays[3] = active_extruder;
+        ESP_LOGI(TAG, "AMS display: tray_now=%d, left=%d, right=%d, active_ext=%d",
+                 tray_now, tray_now_left, tray_now_right, active_extruder);
+    }
 
     // Determine which tray is ACTIVELY printing (not just loaded)
     // For dual-nozzle printers: active_extruder indicates which nozzle (0=right, 1=left)
@@ -1003,12 +945,8 @@ static void update_ams_display(void) {
     // Only use AMS extruder assignment - active_extruder >= 0 is true for single-nozzle too
     bool has_left_extruder_ams = false;
     for (int i = 0; i < ams_count; i++) {
-        AmsUnitCInfo check_info;
-        if (backend_get_ams_unit(selected_printer_index, i, &check_info) == 0) {
-            if (check_info.extruder == 1) {
-                has_left_extruder_ams = true;
-                break;
-            }
+        if (printer->ams[i].info.extruder == 1) {
+            has_left_extruder_ams = true;
         }
     }
     // Dual-nozzle only if AMS units are assigned to left extruder
@@ -1021,36 +959,27 @@ static void update_ams_display(void) {
     // Handle AMS containers based on single/dual nozzle
     // Single-nozzle: use LEFT container, hide RIGHT
     // Dual-nozzle: use both containers
-    if (!is_dual_nozzle) {
-        // Single nozzle: hide RIGHT container, use LEFT for all AMS
-        if (objects.main_screen_ams_right_nozzle) {
-            lv_obj_add_flag(objects.main_screen_ams_right_nozzle, LV_OBJ_FLAG_HIDDEN);
-        }
-        if (objects.main_screen_ams_left_nozzle) {
-            lv_obj_clear_flag(objects.main_screen_ams_left_nozzle, LV_OBJ_FLAG_HIDDEN);
-        }
-        // Hide L badge, show simple "AMS" label aligned left (where badge was)
-        if (left_badge) lv_obj_add_flag(left_badge, LV_OBJ_FLAG_HIDDEN);
-        if (left_label) {
-            lv_label_set_text(left_label, "AMS");
-            lv_obj_set_pos(left_label, LR_BADGE_X, LR_BADGE_Y);  // Align with badge position
-        }
-    } else {
-        // Dual nozzle: show both containers with L/R labels
-        if (objects.main_screen_ams_left_nozzle) {
-            lv_obj_clear_flag(objects.main_screen_ams_left_nozzle, LV_OBJ_FLAG_HIDDEN);
-        }
-        if (objects.main_screen_ams_right_nozzle) {
-            lv_obj_clear_flag(objects.main_screen_ams_right_nozzle, LV_OBJ_FLAG_HIDDEN);
-        }
-        // Show L/R badges and full labels
-        if (left_badge) lv_obj_clear_flag(left_badge, LV_OBJ_FLAG_HIDDEN);
-        if (left_label) {
-            lv_label_set_text(left_label, "Left Nozzle");
-            lv_obj_set_pos(left_label, 0, LR_BADGE_Y);  // Reset to right of badge
+    set_obj_hidden(objects.main_screen_ams_left_nozzle, false);
+    set_obj_hidden(objects.main_screen_ams_right_nozzle, !is_dual_nozzle);
+    if (ams_layout_dual != (int)is_dual_nozzle) {
+        ams_layout_dual = is_dual_nozzle;
+        if (!is_dual_nozzle) {
+            // Hide L badge, show simple "AMS" label aligned left (where badge was)
+            if (left_badge) lv_obj_add_flag(left_badge, LV_OBJ_FLAG_HIDDEN);
+            if (left_label) {
+                lv_label_set_text(left_label, "AMS");
+                lv_obj_set_pos(left_label, LR_BADGE_X, LR_BADGE_Y);  // Align with badge position
+            }
+        } else {
+            // Show L/R badges and full labels
+            if (left_badge) lv_obj_clear_flag(left_badge, LV_OBJ_FLAG_HIDDEN);
+            if (left_label) {
+                lv_label_set_text(left_label, "Left Nozzle");
+                lv_obj_set_pos(left_label, 0, LR_BADGE_Y);  // Reset to right of badge
+            }
+            if (right_badge) lv_obj_clear_flag(right_badge, LV_OBJ_FLAG_HIDDEN);
+            if (right_label) lv_label_set_text(right_label, "Right Nozzle");
         }
-        if (right_badge) lv_obj_clear_flag(right_badge, LV_OBJ_FLAG_HIDDEN);
-        if (right_label) lv_label_set_text(right_label, "Right Nozzle");
     }
 
     if (is_dual_nozzle) {
@@ -1071,8 +1000,15 @@ static void update_ams_display(void) {
         }
     }
 
-    ESP_LOGI(TAG, "AMS active trays: dual=%d, active_left=%d, active_right=%d",
-             is_dual_nozzle, active_tray_left, active_tray_right);
+    if (trays_changed) {
+        ESP_LOGI(TAG, "AMS active trays: dual=%d, active_left=%d, active_right=%d",
+                 is_dual_nozzle, active_tray_left, active_tray_right);
+    }
+
+    // Units not seen in this refresh are deleted below
+    for (int i = 0; i < AMS_UNIT_POOL; i++) {
+        ams_units[i].seen = false;
+    }
 
     // Separate AMS units by type and nozzle
     // Left nozzle: top row for 4-slot, bottom row for 1-slot
@@ -1083,192 +1019,138 @@ static void update_ams_display(void) {
     int right_4slot_x = CONTAINER_START_X;
     int right_1slot_x = CONTAINER_START_X;
 
-    for (int i = 0; i < ams_count && i < MAX_AMS_WIDGETS; i++) {
-        AmsUnitCInfo info;
-        if (backend_get_ams_unit(selected_printer_index, i, &info) != 0) {
-            continue;
-        }
+    for (int i = 0; i < ams_count; i++) {
+        const AmsUnitCInfo *info = &printer->ams[i].info;
 
         // For single-nozzle printers, all AMS goes to LEFT side
         // For dual-nozzle, use extruder assignment (0=right, 1=left)
-        bool use_left = !is_dual_nozzle || (info.extruder == 1);
-        lv_obj_t *parent = use_left ? objects.main_screen_ams_left_nozzle : objects.main_screen_ams_right_nozzle;
-        if (!parent) continue;
-
-        // Use the active tray for this extruder (only if it's the active extruder)
-        int active_tray = use_left ? active_tray_left : active_tray_right;
-        lv_obj_t *widget = create_ams_container(parent, &info, active_tray);
+        bool use_left = !is_dual_nozzle || (info->extruder == 1);
 
         // Position based on slot count and nozzle
-        bool is_single = (info.tray_count <= 1);
+        bool is_single = (info->tray_count <= 1);
         int *x_pos;
-        int y_pos;
-        int step;
-
+        int y_pos = is_single ? ROW_BOTTOM_Y : ROW_TOP_Y;
+        int step = is_single ? CONTAINER_1SLOT_W + CONTAINER_1SLOT_GAP    // 56 + 8 = 64
+                             : CONTAINER_4SLOT_W + CONTAINER_4SLOT_GAP;   // 120 + 7 = 127
         if (use_left) {
-            if (is_single) {
-                x_pos = &left_1slot_x;
-                y_pos = ROW_BOTTOM_Y;
-                step = CONTAINER_1SLOT_W + CONTAINER_1SLOT_GAP;  // 47 + 7 = 54
-            } else {
-                x_pos = &left_4slot_x;
-                y_pos = ROW_TOP_Y;
-                step = CONTAINER_4SLOT_W + CONTAINER_4SLOT_GAP;  // 120 + 7 = 127
-            }
-            if (ams_widget_count_left < MAX_AMS_WIDGETS) {
-                ams_widgets_left[ams_widget_count_left++] = widget;
-            }
+            x_pos = is_single ? &left_1slot_x : &left_4slot_x;
         } else {
-            if (is_single) {
-                x_pos = &right_1slot_x;
-                y_pos = ROW_BOTTOM_Y;
-                step = CONTAINER_1SLOT_W + CONTAINER_1SLOT_GAP;
-            } else {
-                x_pos = &right_4slot_x;
-                y_pos = ROW_TOP_Y;
-                step = CONTAINER_4SLOT_W + CONTAINER_4SLOT_GAP;
-            }
-            if (ams_widget_count_right < MAX_AMS_WIDGETS) {
-                ams_widgets_right[ams_widget_count_right++] = widget;
-            }
+            x_pos = is_single ? &right_1slot_x : &right_4slot_x;
         }
 
-        lv_obj_set_pos(widget, *x_pos, y_pos);
+        // Use the active tray for this extruder (only if it's the active extruder)
+        sync_ams_unit(info, use_left, use_left ? active_tray_left : active_tray_right, *x_pos, y_pos);
         *x_pos += step;
     }
 
-    // Create external spool holder slots
+    // External spool holder slots
     // Single-nozzle: one "Ext" slot on LEFT
     // Dual-nozzle: EXT-R on right, EXT-L on left
     // (has_printer already checked at function start)
-    {
-        AmsUnitCInfo ext_info = {
-            .id = 254,  // External right (or just external for single-nozzle)
-            .humidity = -1,
-            .temperature = -1,
-            .extruder = 0,
-            .tray_count = 1,
-            .trays = {{.tray_color = 0}}  // Empty
-        };
+    AmsUnitCInfo ext_info = {
+        .id = 254,  // External right (or just external for single-nozzle)
+        .humidity = -1,
+        .temperature = -1,
+        .extruder = 0,
+        .tray_count = 1,
+        .trays = {{.tray_color = 0}}  // Empty
+    };
+    if (!is_dual_nozzle) {
+        sync_ams_unit(&ext_info, true, active_tray_left, left_1slot_x, ROW_BOTTOM_Y);
+    } else {
+        sync_ams_unit(&ext_info, false, active_tray_right, right_1slot_x, ROW_BOTTOM_Y);
 
-        if (!is_dual_nozzle) {
-            // Single-nozzle: create one "Ext" slot on LEFT side, use active_tray_left
-            if (objects.main_screen_ams_left_nozzle && ams_widget_count_left < MAX_AMS_WIDGETS) {
-                lv_obj_t *ext = create_ams_container(objects.main_screen_ams_left_nozzle, &ext_info, active_tray_left);
-                lv_obj_set_pos(ext, left_1slot_x, ROW_BOTTOM_Y);
-                ams_widgets_left[ams_widget_count_left++] = ext;
-            }
-        } else {
-            // Dual-nozzle: create EXT-R on right and EXT-L on left
-            if (objects.main_screen_ams_right_nozzle && ams_widget_count_right < MAX_AMS_WIDGETS) {
-                lv_obj_t *ext_r = create_ams_container(objects.main_screen_ams_right_nozzle, &ext_info, active_tray_right);
-                lv_obj_set_pos(ext_r, right_1slot_x, ROW_BOTTOM_Y);
-                ams_widgets_right[ams_widget_count_right++] = ext_r;
-            }
+        AmsUnitCInfo ext_l_info = ext_info;
+        ext_l_info.id = 255;  // External left
+        ext_l_info.extruder = 1;
+        sync_ams_unit(&ext_l_info, true, active_tray_left, left_1slot_x, ROW_BOTTOM_Y);
+    }
 
-            AmsUnitCInfo ext_l_info = {
-                .id = 255,  // External left
-                .humidity = -1,
-                .temperature = -1,
-                .extruder = 1,
-                .tray_count = 1,
-                .trays = {{.tray_color = 0}}  // Empty
-            };
-            if (objects.main_screen_ams_left_nozzle && ams_widget_count_left < MAX_AMS_WIDGETS) {
-                lv_obj_t *ext_l = create_ams_container(objects.main_screen_ams_left_nozzle, &ext_l_info, active_tray_left);
-                lv_obj_set_pos(ext_l, left_1slot_x, ROW_BOTTOM_Y);
-                ams_widgets_left[ams_widget_count_left++] = ext_l;
-            }
+    for (int i = 0; i < AMS_UNIT_POOL; i++) {
+        if (ams_units[i].used && !ams_units[i].seen) {
+            delete_ams_unit(&ams_units[i]);
         }
     }
+
+    ams_rendered_generation = printer->generation;
 }
 
 // =============================================================================
 // AMS Overview Screen Display
 // =============================================================================
 
-/**
- * @brief Update a single slot's color based on RGBA value
- */
-static void update_slot_color(lv_obj_t *slot_color, uint32_t rgba) {
-    if (!slot_color) return;
-
-    uint8_t r = (rgba >> 24) & 0xFF;
-    uint8_t g = (rgba >> 16) & 0xFF;
-    uint8_t b = (rgba >> 8) & 0xFF;
-    uint32_t color_hex = (r << 16) | (g << 8) | b;
-    bool is_empty = (rgba == 0);
-
-    // slot_color is an lv_image with img_spool_fill - use image recoloring
-    if (is_empty) {
-        // Empty/no filament - dark gray
-        lv_obj_set_style_image_recolor(slot_color, lv_color_hex(0x1a1a1a), 0);
-        lv_obj_set_style_image_recolor_opa(slot_color, 255, 0);
-    } else {
-        // Apply filament color via image recolor
-        lv_obj_set_style_image_recolor(slot_color, lv_color_hex(color_hex), 0);
-        lv_obj_set_style_image_recolor_opa(slot_color, 255, 0);
-    }
-}
-
-// Stripe line storage for slot empty state visualization
-// Each slot has 3 diagonal stripe lines
-#define STRIPE_COUNT 3
+// AMS overview panels drawn by a ui_ams_strip each. The strips are created by
+// wire_ams_slot_click_handlers() when the screen is built and replace the EEZ
+// slot, spool, material, slot name and fill level objects of their panel.
+#define AMS_OVERVIEW_SLOT_OBJECTS (4 * 5)
 
-// HT slots (HT-A, HT-B)
-static lv_obj_t *ht_a_stripes[STRIPE_COUNT] = {NULL};
-static lv_obj_t *ht_b_stripes[STRIPE_COUNT] = {NULL};
-
-// AMS slots (4 per AMS panel, 4 panels = 16 total)
-static lv_obj_t *ams_a_slot_stripes[4][STRIPE_COUNT] = {{NULL}};
-static lv_obj_t *ams_b_slot_stripes[4][STRIPE_COUNT] = {{NULL}};
-static lv_obj_t *ams_c_slot_stripes[4][STRIPE_COUNT] = {{NULL}};
-static lv_obj_t *ams_d_slot_stripes[4][STRIPE_COUNT] = {{NULL}};
-
-// Static line points for diagonal stripes on 32x42 slots
-static lv_point_precise_t stripe_pts_0[2] = {{0, 12}, {32, 4}};
-static lv_point_precise_t stripe_pts_1[2] = {{0, 24}, {32, 16}};
-static lv_point_precise_t stripe_pts_2[2] = {{0, 36}, {32, 28}};
-static lv_point_precise_t *stripe_pts[STRIPE_COUNT] = {stripe_pts_0, stripe_pts_1, stripe_pts_2};
-
-/**
- * @brief Create stripe lines for an empty slot
- * Creates diagonal lines as visual indicator for empty state
- * @param parent The panel containing the slot
- * @param stripes Array to store created line objects (STRIPE_COUNT elements)
- * @param slot_x X position of the slot within parent
- * @param slot_y Y position of the slot within parent
- */
-static void create_slot_stripes(lv_obj_t *parent, lv_obj_t **stripes, int slot_x, int slot_y) {
-    if (!parent) return;
-
-    for (int i = 0; i < STRIPE_COUNT; i++) {
-        if (!stripes[i]) {
-            stripes[i] = lv_line_create(parent);
-            lv_line_set_points(stripes[i], stripe_pts[i], 2);
-            lv_obj_set_pos(stripes[i], slot_x, slot_y);
-            lv_obj_set_style_line_color(stripes[i], lv_color_hex(0x4a4a4a), 0);
-            lv_obj_set_style_line_width(stripes[i], 3, 0);
-            lv_obj_set_style_line_opa(stripes[i], 255, 0);
-        }
-    }
-}
+typedef struct {
+    int ams_id;
+    int slot_count;
+    lv_obj_t *panel;
+    lv_obj_t *indicator;
+    lv_obj_t *label_name;
+    lv_obj_t *label_humidity;
+    lv_obj_t *label_temperature;   // NULL = none on the panel (AMS D)
+    lv_obj_t *slot_objects[AMS_OVERVIEW_SLOT_OBJECTS];  // Replaced by the strip
+} ams_overview_panel_t;
+
+#define AMS_OVERVIEW_PANELS 6
+
+// EEZ objects of one overview slot: spool, color, material, slot name, fill level
+#define OVERVIEW_SLOT_OBJECTS(unit, n, slot_name, fill_level) \
+    objects.ams_screen_ams_panel_##unit##_slot_##n, \
+    objects.ams_screen_ams_panel_##unit##_slot_##n##_color, \
+    objects.ams_screen_ams_panel_##unit##_slot_##n##_label_material, \
+    objects.ams_screen_ams_panel_##unit##_slot_##n##_##slot_name, \
+    objects.ams_screen_ams_panel_##unit##_slot_##n##_##fill_level
+
+#define OVERVIEW_QUAD_OBJECTS(unit, slot_name, fill_level) \
+    {OVERVIEW_SLOT_OBJECTS(unit, 1, slot_name, fill_level), \
+     OVERVIEW_SLOT_OBJECTS(unit, 2, slot_name, fill_level), \
+     OVERVIEW_SLOT_OBJECTS(unit, 3, slot_name, fill_level), \
+     OVERVIEW_SLOT_OBJECTS(unit, 4, slot_name, fill_level)}
+
+// HT units: no slot name
+#define OVERVIEW_HT_OBJECTS(unit) \
+    {objects.ams_screen_ams_panel_##unit##_slot, \
+     objects.ams_screen_ams_panel_##unit##_slot_color, \
+     objects.ams_screen_ams_panel_##unit##_label_material, \
+     objects.ams_screen_ams_panel_##unit##_label_fill_level}
+
+static lv_obj_t *ams_overview_strips[AMS_OVERVIEW_PANELS];
 
 /**
- * @brief Show or hide stripe lines for slot empty state
- * @param stripes Array of stripe line objects (STRIPE_COUNT elements)
- * @param show True to show stripes (empty slot), false to hide (has filament)
+ * @brief Current EEZ objects of the overview panels (A-D, HT-A, HT-B)
  */
-static void set_slot_stripes_visible(lv_obj_t **stripes, bool show) {
-    for (int i = 0; i < STRIPE_COUNT; i++) {
-        if (stripes[i]) {
-            if (show) {
-                lv_obj_clear_flag(stripes[i], LV_OBJ_FLAG_HIDDEN);
-            } else {
-                lv_obj_add_flag(stripes[i], LV_OBJ_FLAG_HIDDEN);
-            }
-        }
-    }
+static void get_ams_overview_panels(ams_overview_panel_t panels[AMS_OVERVIEW_PANELS]) {
+    // Field names as generated by EEZ, typos included ("amd_d", "labe_humidity")
+    const ams_overview_panel_t table[AMS_OVERVIEW_PANELS] = {
+        {0, 4, objects.ams_screen_ams_panel_ams_a, objects.ams_screen_ams_panel_ams_a_indicator,
+         objects.ams_screen_ams_panel_ams_a_label_name, objects.ams_screen_ams_panel_ams_a_label_humidity,
+         objects.ams_screen_ams_panel_ams_a_label_temperature,
+         OVERVIEW_QUAD_OBJECTS(ams_a, label_slot_name, label_slot_name_label_fill_level)},
+        {1, 4, objects.ams_screen_ams_panel_ams_b, objects.ams_screen_ams_panel_ams_b_indicator,
+         objects.ams_screen_ams_panel_ams_b_label_name, objects.ams_screen_ams_panel_ams_b_labe_humidity,
+         objects.ams_screen_ams_panel_ams_b_label_temperature,
+         OVERVIEW_QUAD_OBJECTS(ams_b, label_slot_name, label_fill_level)},
+        {2, 4, objects.ams_screen_ams_panel_ams_c, objects.ams_screen_ams_panel_ams_c_indicator,
+         objects.ams_screen_ams_panel_ams_c_label_name, objects.ams_screen_ams_panel_ams_c_label_humidity,
+         objects.ams_screen_ams_panel_ams_c_label_temperature,
+         OVERVIEW_QUAD_OBJECTS(ams_c, label_slot_name, label_fill_level)},
+        {3, 4, objects.ams_screen_ams_panel_amd_d, objects.ams_screen_ams_panel_amd_d_indicator,
+         objects.ams_screen_ams_panel_amd_label, objects.ams_screen_ams_panel_amd_d_label_humidity,
+         NULL, OVERVIEW_QUAD_OBJECTS(amd_d, label_slotname, label_fill_level)},
+        {128, 1, objects.ams_screen_ams_panel_ht_a, objects.ams_screen_ams_panel_ht_a_indicator,
+         objects.ams_screen_ams_panel_ht_a_label_name, objects.ams_screen_ams_panel_ht_a_label_humidity,
+         objects.ams_screen_ams_panel_ht_a_label_temperature,
+         OVERVIEW_HT_OBJECTS(ht_a)},
+        {129, 1, objects.ams_screen_ams_panel_ht_b, objects.ams_screen_ams_panel_ht_b_indicator,
+         objects.ams_screen_ams_panel_ht_b_label_name, objects.ams_screen_ams_panel_ht_b_label_humidity,
+         objects.ams_screen_ams_panel_ht_b_label_temperature,
+         OVERVIEW_HT_OBJECTS(ht_b)},
+    };
+    memcpy(panels, table, sizeof(table));
 }
 
 /**
@@ -1423,645 +1305,90 @@ static void update_ams_overview_display(void) {
     int tray_now_right = backend_get_tray_now_right(selected_printer_index);
     int active_extruder = backend_get_active_extruder(selected_printer_index);
 
-    // Build a set of which AMS IDs are present
-    bool has_ams[256] = {false};
-    AmsUnitCInfo ams_data[8];  // Cache AMS data
+    // Cache AMS data
+    AmsUnitCInfo ams_data[8];
     int ams_data_count = 0;
 
     for (int i = 0; i < ams_count && i < 8; i++) {
         AmsUnitCInfo info;
         if (backend_get_ams_unit(selected_printer_index, i, &info) == 0) {
-            has_ams[info.id] = true;
             ams_data[ams_data_count++] = info;
         }
     }
 
-    // Hide/show and update AMS A (id=0)
-    if (objects.ams_screen_ams_panel_ams_a) {
-        if (has_ams[0]) {
-            lv_obj_clear_flag(objects.ams_screen_ams_panel_ams_a, LV_OBJ_FLAG_HIDDEN);
-
-            // Find the data for this AMS
-            for (int i = 0; i < ams_data_count; i++) {
-                if (ams_data[i].id == 0) {
-                    AmsUnitCInfo *info = &ams_data[i];
-
-                    // Update L/R extruder indicator and label position
-                    update_panel_indicator(
-                        objects.ams_screen_ams_panel_ams_a_indicator,
-                        objects.ams_screen_ams_panel_ams_a_label_name,
-                        info->extruder,
-                        selected_printer_is_dual_nozzle
-                    );
-
-                    // Update humidity
-                    if (objects.ams_screen_ams_panel_ams_a_label_humidity) {
-                        if (info->humidity >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d%%", info->humidity);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_a_label_humidity, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_a_label_humidity, "--");
-                        }
-                    }
-
-                    // Update temperature
-                    if (objects.ams_screen_ams_panel_ams_a_label_temperature) {
-                        if (info->temperature >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d°C", info->temperature / 10);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_a_label_temperature, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_a_label_temperature, "--");
-                        }
-                    }
-
-                    // Update slot colors
-                    lv_obj_t *slot_colors[] = {
-                        objects.ams_screen_ams_panel_ams_a_slot_1_color,
-                        objects.ams_screen_ams_panel_ams_a_slot_2_color,
-                        objects.ams_screen_ams_panel_ams_a_slot_3_color,
-                        objects.ams_screen_ams_panel_ams_a_slot_4_color
-                    };
-                    lv_obj_t *slot_materials[] = {
-                        objects.ams_screen_ams_panel_ams_a_slot_1_label_material,
-                        objects.ams_screen_ams_panel_ams_a_slot_2_label_material,
-                        objects.ams_screen_ams_panel_ams_a_slot_3_label_material,
-                        objects.ams_screen_ams_panel_ams_a_slot_4_label_material
-                    };
-                    lv_obj_t *slot_fill_levels[] = {
-                        objects.ams_screen_ams_panel_ams_a_slot_1_label_slot_name_label_fill_level,
-                        objects.ams_screen_ams_panel_ams_a_slot_2_label_slot_name_label_fill_level,
-                        objects.ams_screen_ams_panel_ams_a_slot_3_label_slot_name_label_fill_level,
-                        objects.ams_screen_ams_panel_ams_a_slot_4_label_slot_name_label_fill_level
-                    };
-                    lv_obj_t *slots[] = {
-                        objects.ams_screen_ams_panel_ams_a_slot_1,
-                        objects.ams_screen_ams_panel_ams_a_slot_2,
-                        objects.ams_screen_ams_panel_ams_a_slot_3,
-                        objects.ams_screen_ams_panel_ams_a_slot_4
-                    };
-                    // Slot positions from EEZ (relative to panel)
-                    int slot_x[] = {-6, 46, 100, 155};
-                    int slot_y[] = {47, 48, 48, 49};
-
-                    for (int j = 0; j < 4 && j < info->tray_count; j++) {
-                        bool is_empty = (info->trays[j].tray_color == 0);
-                        update_slot_color(slot_colors[j], info->trays[j].tray_color);
-
-                        // Create/update stripes for empty slots
-                        create_slot_stripes(objects.ams_screen_ams_panel_ams_a, ams_a_slot_stripes[j], slot_x[j], slot_y[j]);
-                        set_slot_stripes_visible(ams_a_slot_stripes[j], is_empty);
-
-                        // Update material label
-                        if (slot_materials[j]) {
-                            if (!is_empty && info->trays[j].tray_type[0]) {
-                                lv_label_set_text(slot_materials[j], info->trays[j].tray_type);
-                            } else {
-                                lv_label_set_text(slot_materials[j], "");
-                            }
-                        }
+    ams_overview_panel_t panels[AMS_OVERVIEW_PANELS];
+    get_ams_overview_panels(panels);
 
-                        // Update fill level - empty slots show "---", loaded slots show percentage
-                        if (slot_fill_levels[j]) {
-                            if (is_empty) {
-                                lv_label_set_text(slot_fill_levels[j], "---");
-                            } else {
-                                char buf[16];
-                                format_fill_level(buf, sizeof(buf), info->trays[j].remain);
-                                lv_label_set_text(slot_fill_levels[j], buf);
-                            }
-                        }
+    for (int p = 0; p < AMS_OVERVIEW_PANELS; p++) {
+        const ams_overview_panel_t *panel = &panels[p];
+        if (!panel->panel) continue;
 
-                        // Highlight active slot (dual-nozzle aware)
-                        int global_tray = get_global_tray_index(0, j);
-                        if (slots[j]) {
-                            bool slot_active = is_slot_active_dual_aware(global_tray, info->extruder,
-                                tray_now, tray_now_left, tray_now_right, active_extruder);
-                            if (slot_active) {
-                                lv_obj_set_style_border_color(slots[j], lv_color_hex(ACCENT_GREEN), 0);
-                                lv_obj_set_style_border_width(slots[j], 3, 0);
-                            } else {
-                                lv_obj_set_style_border_color(slots[j], lv_color_hex(0x3d3d3d), 0);
-                                lv_obj_set_style_border_width(slots[j], 1, 0);
-                            }
-                        }
-                    }
-                    break;
-                }
+        // Find the data for this AMS
+        const AmsUnitCInfo *info = NULL;
+        for (int i = 0; i < ams_data_count; i++) {
+            if (ams_data[i].id == panel->ams_id) {
+                info = &ams_data[i];
+                break;
             }
-        } else {
-            lv_obj_add_flag(objects.ams_screen_ams_panel_ams_a, LV_OBJ_FLAG_HIDDEN);
         }
-    }
-
-    // Hide/show and update AMS B (id=1)
-    if (objects.ams_screen_ams_panel_ams_b) {
-        if (has_ams[1]) {
-            lv_obj_clear_flag(objects.ams_screen_ams_panel_ams_b, LV_OBJ_FLAG_HIDDEN);
-
-            for (int i = 0; i < ams_data_count; i++) {
-                if (ams_data[i].id == 1) {
-                    AmsUnitCInfo *info = &ams_data[i];
-
-                    // Update L/R extruder indicator and label position
-                    update_panel_indicator(
-                        objects.ams_screen_ams_panel_ams_b_indicator,
-                        objects.ams_screen_ams_panel_ams_b_label_name,
-                        info->extruder,
-                        selected_printer_is_dual_nozzle
-                    );
-
-                    if (objects.ams_screen_ams_panel_ams_b_labe_humidity) {
-                        if (info->humidity >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d%%", info->humidity);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_b_labe_humidity, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_b_labe_humidity, "--");
-                        }
-                    }
-
-                    if (objects.ams_screen_ams_panel_ams_b_label_temperature) {
-                        if (info->temperature >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d°C", info->temperature / 10);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_b_label_temperature, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_b_label_temperature, "--");
-                        }
-                    }
-
-                    lv_obj_t *slot_colors[] = {
-                        objects.ams_screen_ams_panel_ams_b_slot_1_color,
-                        objects.ams_screen_ams_panel_ams_b_slot_2_color,
-                        objects.ams_screen_ams_panel_ams_b_slot_3_color,
-                        objects.ams_screen_ams_panel_ams_b_slot_4_color
-                    };
-                    lv_obj_t *slot_materials[] = {
-                        objects.ams_screen_ams_panel_ams_b_slot_1_label_material,
-                        objects.ams_screen_ams_panel_ams_b_slot_2_label_material,
-                        objects.ams_screen_ams_panel_ams_b_slot_3_label_material,
-                        objects.ams_screen_ams_panel_ams_b_slot_4_label_material
-                    };
-                    lv_obj_t *slot_fill_levels[] = {
-                        objects.ams_screen_ams_panel_ams_b_slot_1_label_fill_level,
-                        objects.ams_screen_ams_panel_ams_b_slot_2_label_fill_level,
-                        objects.ams_screen_ams_panel_ams_b_slot_3_label_fill_level,
-                        objects.ams_screen_ams_panel_ams_b_slot_4_label_fill_level
-                    };
-                    lv_obj_t *slots[] = {
-                        objects.ams_screen_ams_panel_ams_b_slot_1,
-                        objects.ams_screen_ams_panel_ams_b_slot_2,
-                        objects.ams_screen_ams_panel_ams_b_slot_3,
-                        objects.ams_screen_ams_panel_ams_b_slot_4
-                    };
-                    // Slot positions from EEZ (same as AMS A)
-                    int slot_x[] = {-6, 46, 100, 155};
-                    int slot_y[] = {47, 48, 48, 49};
-
-                    for (int j = 0; j < 4 && j < info->tray_count; j++) {
-                        bool is_empty = (info->trays[j].tray_color == 0);
-                        update_slot_color(slot_colors[j], info->trays[j].tray_color);
-
-                        // Create/update stripes for empty slots
-                        create_slot_stripes(objects.ams_screen_ams_panel_ams_b, ams_b_slot_stripes[j], slot_x[j], slot_y[j]);
-                        set_slot_stripes_visible(ams_b_slot_stripes[j], is_empty);
-
-                        if (slot_materials[j]) {
-                            if (!is_empty && info->trays[j].tray_type[0]) {
-                                lv_label_set_text(slot_materials[j], info->trays[j].tray_type);
-                            } else {
-                                lv_label_set_text(slot_materials[j], "");
-                            }
-                        }
-
-                        // Update fill level - empty slots show "---", loaded slots show percentage
-                        if (slot_fill_levels[j]) {
-                            if (is_empty) {
-                                lv_label_set_text(slot_fill_levels[j], "---");
-                            } else {
-                                char buf[16];
-                                format_fill_level(buf, sizeof(buf), info->trays[j].remain);
-                                lv_label_set_text(slot_fill_levels[j], buf);
-                            }
-                        }
-
-                        // Highlight active slot (dual-nozzle aware)
-                        int global_tray = get_global_tray_index(1, j);
-                        if (slots[j]) {
-                            bool slot_active = is_slot_active_dual_aware(global_tray, info->extruder,
-                                tray_now, tray_now_left, tray_now_right, active_extruder);
-                            if (slot_active) {
-                                lv_obj_set_style_border_color(slots[j], lv_color_hex(ACCENT_GREEN), 0);
-                                lv_obj_set_style_border_width(slots[j], 3, 0);
-                            } else {
-                                lv_obj_set_style_border_color(slots[j], lv_color_hex(0x3d3d3d), 0);
-                                lv_obj_set_style_border_width(slots[j], 1, 0);
-                            }
-                        }
-                    }
-                    break;
-                }
-            }
-        } else {
-            lv_obj_add_flag(objects.ams_screen_ams_panel_ams_b, LV_OBJ_FLAG_HIDDEN);
+        if (!info) {
+            lv_obj_add_flag(panel->panel, LV_OBJ_FLAG_HIDDEN);
+            continue;
         }
-    }
+        lv_obj_clear_flag(panel->panel, LV_OBJ_FLAG_HIDDEN);
 
-    // Hide/show and update AMS C (id=2)
-    if (objects.ams_screen_ams_panel_ams_c) {
-        if (has_ams[2]) {
-            lv_obj_clear_flag(objects.ams_screen_ams_panel_ams_c, LV_OBJ_FLAG_HIDDEN);
-
-            for (int i = 0; i < ams_data_count; i++) {
-                if (ams_data[i].id == 2) {
-                    AmsUnitCInfo *info = &ams_data[i];
-
-                    // Update L/R extruder indicator and label position
-                    update_panel_indicator(
-                        objects.ams_screen_ams_panel_ams_c_indicator,
-                        objects.ams_screen_ams_panel_ams_c_label_name,
-                        info->extruder,
-                        selected_printer_is_dual_nozzle
-                    );
-
-                    if (objects.ams_screen_ams_panel_ams_c_label_humidity) {
-                        if (info->humidity >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d%%", info->humidity);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_c_label_humidity, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_c_label_humidity, "--");
-                        }
-                    }
-
-                    if (objects.ams_screen_ams_panel_ams_c_label_temperature) {
-                        if (info->temperature >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d°C", info->temperature / 10);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_c_label_temperature, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ams_c_label_temperature, "--");
-                        }
-                    }
-
-                    lv_obj_t *slot_colors[] = {
-                        objects.ams_screen_ams_panel_ams_c_slot_1_color,
-                        objects.ams_screen_ams_panel_ams_c_slot_2_color,
-                        objects.ams_screen_ams_panel_ams_c_slot_3_color,
-                        objects.ams_screen_ams_panel_ams_c_slot_4_color
-                    };
-                    lv_obj_t *slot_materials[] = {
-                        objects.ams_screen_ams_panel_ams_c_slot_1_label_material,
-                        objects.ams_screen_ams_panel_ams_c_slot_2_label_material,
-                        objects.ams_screen_ams_panel_ams_c_slot_3_label_material,
-                        objects.ams_screen_ams_panel_ams_c_slot_4_label_material
-                    };
-                    lv_obj_t *slot_fill_levels[] = {
-                        objects.ams_screen_ams_panel_ams_c_slot_1_label_fill_level,
-                        objects.ams_screen_ams_panel_ams_c_slot_2_label_fill_level,
-                        objects.ams_screen_ams_panel_ams_c_slot_3_label_fill_level,
-                        objects.ams_screen_ams_panel_ams_c_slot_4_label_fill_level
-                    };
-                    lv_obj_t *slots[] = {
-                        objects.ams_screen_ams_panel_ams_c_slot_1,
-                        objects.ams_screen_ams_panel_ams_c_slot_2,
-                        objects.ams_screen_ams_panel_ams_c_slot_3,
-                        objects.ams_screen_ams_panel_ams_c_slot_4
-                    };
-                    // Slot positions from EEZ (same as AMS A)
-                    int slot_x[] = {-6, 46, 100, 155};
-                    int slot_y[] = {47, 48, 48, 49};
-
-                    for (int j = 0; j < 4 && j < info->tray_count; j++) {
-                        bool is_empty = (info->trays[j].tray_color == 0);
-                        update_slot_color(slot_colors[j], info->trays[j].tray_color);
-
-                        // Create/update stripes for empty slots
-                        create_slot_stripes(objects.ams_screen_ams_panel_ams_c, ams_c_slot_stripes[j], slot_x[j], slot_y[j]);
-                        set_slot_stripes_visible(ams_c_slot_stripes[j], is_empty);
-
-                        if (slot_materials[j]) {
-                            if (!is_empty && info->trays[j].tray_type[0]) {
-                                lv_label_set_text(slot_materials[j], info->trays[j].tray_type);
-                            } else {
-                                lv_label_set_text(slot_materials[j], "");
-                            }
-                        }
-
-                        // Update fill level - empty slots show "---", loaded slots show percentage
-                        if (slot_fill_levels[j]) {
-                            if (is_empty) {
-                                lv_label_set_text(slot_fill_levels[j], "---");
-                            } else {
-                                char buf[16];
-                                format_fill_level(buf, sizeof(buf), info->trays[j].remain);
-                                lv_label_set_text(slot_fill_levels[j], buf);
-                            }
-                        }
+        // Update L/R extruder indicator and label position
+        update_panel_indicator(panel->indicator, panel->label_name, info->extruder,
+                               selected_printer_is_dual_nozzle);
 
-                        // Highlight active slot (dual-nozzle aware)
-                        int global_tray = get_global_tray_index(2, j);
-                        if (slots[j]) {
-                            bool slot_active = is_slot_active_dual_aware(global_tray, info->extruder,
-                                tray_now, tray_now_left, tray_now_right, active_extruder);
-                            if (slot_active) {
-                                lv_obj_set_style_border_color(slots[j], lv_color_hex(ACCENT_GREEN), 0);
-                                lv_obj_set_style_border_width(slots[j], 3, 0);
-                            } else {
-                                lv_obj_set_style_border_color(slots[j], lv_color_hex(0x3d3d3d), 0);
-                                lv_obj_set_style_border_width(slots[j], 1, 0);
-                            }
-                        }
-                    }
-                    break;
-                }
+        // Update humidity
+        if (panel->label_humidity) {
+            if (info->humidity >= 0) {
+                char buf[16];
+                snprintf(buf, sizeof(buf), "%d%%", info->humidity);
+                lv_label_set_text(panel->label_humidity, buf);
+            } else {
+                lv_label_set_text(panel->label_humidity, "--");
             }
-        } else {
-            lv_obj_add_flag(objects.ams_screen_ams_panel_ams_c, LV_OBJ_FLAG_HIDDEN);
         }
-    }
-
-    // Hide/show and update AMS D (id=3) - note the typo in EEZ: "amd_d"
-    if (objects.ams_screen_ams_panel_amd_d) {
-        if (has_ams[3]) {
-            lv_obj_clear_flag(objects.ams_screen_ams_panel_amd_d, LV_OBJ_FLAG_HIDDEN);
-
-            for (int i = 0; i < ams_data_count; i++) {
-                if (ams_data[i].id == 3) {
-                    AmsUnitCInfo *info = &ams_data[i];
-
-                    // Update L/R extruder indicator and label position
-                    update_panel_indicator(
-                        objects.ams_screen_ams_panel_amd_d_indicator,
-                        objects.ams_screen_ams_panel_amd_label,
-                        info->extruder,
-                        selected_printer_is_dual_nozzle
-                    );
-
-                    if (objects.ams_screen_ams_panel_amd_d_label_humidity) {
-                        if (info->humidity >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d%%", info->humidity);
-                            lv_label_set_text(objects.ams_screen_ams_panel_amd_d_label_humidity, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_amd_d_label_humidity, "--");
-                        }
-                    }
-
-                    lv_obj_t *slot_colors[] = {
-                        objects.ams_screen_ams_panel_amd_d_slot_1_color,
-                        objects.ams_screen_ams_panel_amd_d_slot_2_color,
-                        objects.ams_screen_ams_panel_amd_d_slot_3_color,
-                        objects.ams_screen_ams_panel_amd_d_slot_4_color
-                    };
-                    lv_obj_t *slot_materials[] = {
-                        objects.ams_screen_ams_panel_amd_d_slot_1_label_material,
-                        objects.ams_screen_ams_panel_amd_d_slot_2_label_material,
-                        objects.ams_screen_ams_panel_amd_d_slot_3_label_material,
-                        objects.ams_screen_ams_panel_amd_d_slot_4_label_material
-                    };
-                    lv_obj_t *slot_fill_levels[] = {
-                        objects.ams_screen_ams_panel_amd_d_slot_1_label_fill_level,
-                        objects.ams_screen_ams_panel_amd_d_slot_2_label_fill_level,
-                        objects.ams_screen_ams_panel_amd_d_slot_3_label_fill_level,
-                        objects.ams_screen_ams_panel_amd_d_slot_4_label_fill_level
-                    };
-                    lv_obj_t *slots[] = {
-                        objects.ams_screen_ams_panel_amd_d_slot_1,
-                        objects.ams_screen_ams_panel_amd_d_slot_2,
-                        objects.ams_screen_ams_panel_amd_d_slot_3,
-                        objects.ams_screen_ams_panel_amd_d_slot_4
-                    };
-
-                    for (int j = 0; j < 4 && j < info->tray_count; j++) {
-                        bool is_empty = (info->trays[j].tray_color == 0);
-                        update_slot_color(slot_colors[j], info->trays[j].tray_color);
-
-                        if (slot_materials[j]) {
-                            if (!is_empty && info->trays[j].tray_type[0]) {
-                                lv_label_set_text(slot_materials[j], info->trays[j].tray_type);
-                            } else {
-                                lv_label_set_text(slot_materials[j], "");
-                            }
-                        }
 
-                        // Update fill level - empty slots show "---", loaded slots show percentage
-                        if (slot_fill_levels[j]) {
-                            if (is_empty) {
-                                lv_label_set_text(slot_fill_levels[j], "---");
-                            } else {
-                                char buf[16];
-                                format_fill_level(buf, sizeof(buf), info->trays[j].remain);
-                                lv_label_set_text(slot_fill_levels[j], buf);
-                            }
-                        }
-
-                        // Highlight active slot (dual-nozzle aware)
-                        int global_tray = get_global_tray_index(3, j);
-                        if (slots[j]) {
-                            bool slot_active = is_slot_active_dual_aware(global_tray, info->extruder,
-                                tray_now, tray_now_left, tray_now_right, active_extruder);
-                            if (slot_active) {
-                                lv_obj_set_style_border_color(slots[j], lv_color_hex(ACCENT_GREEN), 0);
-                                lv_obj_set_style_border_width(slots[j], 3, 0);
-                            } else {
-                                lv_obj_set_style_border_color(slots[j], lv_color_hex(0x3d3d3d), 0);
-                                lv_obj_set_style_border_width(slots[j], 1, 0);
-                            }
-                        }
-                    }
-                    break;
-                }
+        // Update temperature
+        if (panel->label_temperature) {
+            if (info->temperature >= 0) {
+                char buf[16];
+                snprintf(buf, sizeof(buf), "%d°C", info->temperature / 10);
+                lv_label_set_text(panel->label_temperature, buf);
+            } else {
+                lv_label_set_text(panel->label_temperature, "--");
             }
-        } else {
-            lv_obj_add_flag(objects.ams_screen_ams_panel_amd_d, LV_OBJ_FLAG_HIDDEN);
         }
-    }
-
-    // Hide/show and update HT-A (id=128)
-    if (objects.ams_screen_ams_panel_ht_a) {
-        if (has_ams[128]) {
-            lv_obj_clear_flag(objects.ams_screen_ams_panel_ht_a, LV_OBJ_FLAG_HIDDEN);
-
-            for (int i = 0; i < ams_data_count; i++) {
-                if (ams_data[i].id == 128) {
-                    AmsUnitCInfo *info = &ams_data[i];
-
-                    // Update L/R extruder indicator and label position
-                    update_panel_indicator(
-                        objects.ams_screen_ams_panel_ht_a_indicator,
-                        objects.ams_screen_ams_panel_ht_a_label_name,
-                        info->extruder,
-                        selected_printer_is_dual_nozzle
-                    );
-
-                    if (objects.ams_screen_ams_panel_ht_a_label_humidity) {
-                        if (info->humidity >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d%%", info->humidity);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_a_label_humidity, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_a_label_humidity, "--");
-                        }
-                    }
-
-                    if (objects.ams_screen_ams_panel_ht_a_label_temperature) {
-                        if (info->temperature >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d°C", info->temperature / 10);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_a_label_temperature, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_a_label_temperature, "--");
-                        }
-                    }
-
-                    // Single slot for HT - create stripes on first run
-                    create_slot_stripes(objects.ams_screen_ams_panel_ht_a, ht_a_stripes, 14, 47);
-
-                    if (info->tray_count > 0 && info->trays[0].tray_color != 0) {
-                        // Has filament - hide stripes
-                        set_slot_stripes_visible(ht_a_stripes, false);
-                        update_slot_color(objects.ams_screen_ams_panel_ht_a_slot_color, info->trays[0].tray_color);
 
-                        if (objects.ams_screen_ams_panel_ht_a_label_material) {
-                            if (info->trays[0].tray_type[0]) {
-                                lv_label_set_text(objects.ams_screen_ams_panel_ht_a_label_material, info->trays[0].tray_type);
-                            } else {
-                                lv_label_set_text(objects.ams_screen_ams_panel_ht_a_label_material, "");
-                            }
-                        }
+        lv_obj_t *strip = ams_overview_strips[p];
+        if (!strip) continue;
 
-                        // Update fill level (255 = unknown -> "---")
-                        if (objects.ams_screen_ams_panel_ht_a_label_fill_level) {
-                            char buf[16];
-                            format_fill_level(buf, sizeof(buf), info->trays[0].remain);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_a_label_fill_level, buf);
-                        }
-                    } else {
-                        // Empty slot - show stripes
-                        set_slot_stripes_visible(ht_a_stripes, true);
-                        update_slot_color(objects.ams_screen_ams_panel_ht_a_slot_color, 0);
-                        if (objects.ams_screen_ams_panel_ht_a_label_material) {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_a_label_material, "");
-                        }
-                        if (objects.ams_screen_ams_panel_ht_a_label_fill_level) {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_a_label_fill_level, "");
-                        }
-                    }
+        int active_slot = -1;
+        for (int j = 0; j < panel->slot_count; j++) {
+            bool has_tray = j < info->tray_count;
+            uint32_t color = has_tray ? info->trays[j].tray_color : 0;
+            bool is_empty = (color == 0);
 
-                    // Highlight active slot (dual-nozzle aware)
-                    int global_tray = get_global_tray_index(128, 0);
-                    if (objects.ams_screen_ams_panel_ht_a_slot) {
-                        bool slot_active = is_slot_active_dual_aware(global_tray, info->extruder,
-                            tray_now, tray_now_left, tray_now_right, active_extruder);
-                        if (slot_active) {
-                            lv_obj_set_style_border_color(objects.ams_screen_ams_panel_ht_a_slot, lv_color_hex(ACCENT_GREEN), 0);
-                            lv_obj_set_style_border_width(objects.ams_screen_ams_panel_ht_a_slot, 3, 0);
-                        } else {
-                            lv_obj_set_style_border_color(objects.ams_screen_ams_panel_ht_a_slot, lv_color_hex(0x3d3d3d), 0);
-                            lv_obj_set_style_border_width(objects.ams_screen_ams_panel_ht_a_slot, 1, 0);
-                        }
-                    }
-                    break;
-                }
+            // Empty AMS slots show "---", empty HT slots nothing
+            char fill[16];
+            if (!is_empty) {
+                format_fill_level(fill, sizeof(fill), info->trays[j].remain);
+            } else {
+                snprintf(fill, sizeof(fill), "%s", panel->slot_count > 1 && has_tray ? "---" : "");
             }
-        } else {
-            lv_obj_add_flag(objects.ams_screen_ams_panel_ht_a, LV_OBJ_FLAG_HIDDEN);
-        }
-    }
-
-    // Hide/show and update HT-B (id=129)
-    if (objects.ams_screen_ams_panel_ht_b) {
-        if (has_ams[129]) {
-            lv_obj_clear_flag(objects.ams_screen_ams_panel_ht_b, LV_OBJ_FLAG_HIDDEN);
-
-            for (int i = 0; i < ams_data_count; i++) {
-                if (ams_data[i].id == 129) {
-                    AmsUnitCInfo *info = &ams_data[i];
-
-                    // Update L/R extruder indicator and label position
-                    update_panel_indicator(
-                        objects.ams_screen_ams_panel_ht_b_indicator,
-                        objects.ams_screen_ams_panel_ht_b_label_name,
-                        info->extruder,
-                        selected_printer_is_dual_nozzle
-                    );
-
-                    if (objects.ams_screen_ams_panel_ht_b_label_humidity) {
-                        if (info->humidity >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d%%", info->humidity);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_b_label_humidity, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_b_label_humidity, "--");
-                        }
-                    }
-
-                    if (objects.ams_screen_ams_panel_ht_b_label_temperature) {
-                        if (info->temperature >= 0) {
-                            char buf[16];
-                            snprintf(buf, sizeof(buf), "%d°C", info->temperature / 10);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_b_label_temperature, buf);
-                        } else {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_b_label_temperature, "--");
-                        }
-                    }
+            ui_ams_strip_set_slot(strip, j, color, is_empty ? "" : info->trays[j].tray_type, fill);
 
-                    // Single slot for HT - create stripes on first run
-                    create_slot_stripes(objects.ams_screen_ams_panel_ht_b, ht_b_stripes, 14, 47);
-
-                    if (info->tray_count > 0 && info->trays[0].tray_color != 0) {
-                        // Has filament - hide stripes
-                        set_slot_stripes_visible(ht_b_stripes, false);
-                        update_slot_color(objects.ams_screen_ams_panel_ht_b_slot_color, info->trays[0].tray_color);
-
-                        if (objects.ams_screen_ams_panel_ht_b_label_material) {
-                            if (info->trays[0].tray_type[0]) {
-                                lv_label_set_text(objects.ams_screen_ams_panel_ht_b_label_material, info->trays[0].tray_type);
-                            } else {
-                                lv_label_set_text(objects.ams_screen_ams_panel_ht_b_label_material, "");
-                            }
-                        }
-
-                        // Update fill level (255 = unknown -> "---")
-                        if (objects.ams_screen_ams_panel_ht_b_label_fill_level) {
-                            char buf[16];
-                            format_fill_level(buf, sizeof(buf), info->trays[0].remain);
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_b_label_fill_level, buf);
-                        }
-                    } else {
-                        // Empty slot - show stripes
-                        set_slot_stripes_visible(ht_b_stripes, true);
-                        update_slot_color(objects.ams_screen_ams_panel_ht_b_slot_color, 0);
-                        if (objects.ams_screen_ams_panel_ht_b_label_material) {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_b_label_material, "");
-                        }
-                        if (objects.ams_screen_ams_panel_ht_b_label_fill_level) {
-                            lv_label_set_text(objects.ams_screen_ams_panel_ht_b_label_fill_level, "");
-                        }
-                    }
-
-                    // Highlight active slot (dual-nozzle aware)
-                    int global_tray = get_global_tray_index(129, 0);
-                    if (objects.ams_screen_ams_panel_ht_b_slot) {
-                        bool slot_active = is_slot_active_dual_aware(global_tray, info->extruder,
-                            tray_now, tray_now_left, tray_now_right, active_extruder);
-                        if (slot_active) {
-                            lv_obj_set_style_border_color(objects.ams_screen_ams_panel_ht_b_slot, lv_color_hex(ACCENT_GREEN), 0);
-                            lv_obj_set_style_border_width(objects.ams_screen_ams_panel_ht_b_slot, 3, 0);
-                        } else {
-                            lv_obj_set_style_border_color(objects.ams_screen_ams_panel_ht_b_slot, lv_color_hex(0x3d3d3d), 0);
-                            lv_obj_set_style_border_width(objects.ams_screen_ams_panel_ht_b_slot, 1, 0);
-                        }
-                    }
-                    break;
-                }
+            // Highlight active slot (dual-nozzle aware)
+            int global_tray = get_global_tray_index(panel->ams_id, j);
+            if (is_slot_active_dual_aware(global_tray, info->extruder,
+                    tray_now, tray_now_left, tray_now_right, active_extruder)) {
+                active_slot = j;
             }
-        } else {
-            lv_obj_add_flag(objects.ams_screen_ams_panel_ht_b, LV_OBJ_FLAG_HIDDEN);
         }
+        ui_ams_strip_set_active(strip, active_slot);
     }
 
     // External spools handling
@@ -2224,89 +1551,46 @@ static void clear_notification_dots(void) {
 }
 
 /**
- * @brief Reset notification state when screens are deleted
+ * @brief Reset dynamic UI state owned by one screen
  *
- * Called from delete_all_screens() BEFORE screens are deleted.
- * The notification dots are children of screen objects, so they will be
- * auto-deleted when the parent screen is deleted. We just need to clear
- * our tracking state to avoid dangling pointers.
+ * Called right before that screen is deleted (screen cache eviction or
+ * leaving a screen that isn't cached). Memory reuse can give a recreated
+ * screen the same address as the old one, so the address-based detection
+ * alone isn't enough.
  */
-void reset_notification_state(void) {
-    // Don't try to delete - parents will be deleted which auto-deletes children
-    for (int i = 0; i < notification_dot_count; i++) {
-        notification_dots[i] = NULL;
+void reset_backend_screen_state(int screen_id) {
+    if (screen_id == SCREEN_ID_MAIN_SCREEN) {
+        reset_main_screen_dynamic_state();
+        last_main_screen = NULL;
+    } else if (screen_id == SCREEN_ID_AMS_OVERVIEW) {
+        // The strips are deleted with the screen
+        memset(ams_overview_strips, 0, sizeof(ams_overview_strips));
+        last_ams_screen = NULL;
+        ams_row2_positioned = false;
     }
-    notification_dot_count = 0;
-    // Reset tracking to force recreation on next screen
-    last_bell_screen = -1;
 }
 
 /**
- * @brief Reset all backend UI state when screens are deleted
+ * @brief Force a full refresh of the screen being navigated to
  *
- * Called from delete_all_screens() to clear all stale pointers.
- * This is critical because memory reuse can cause new screens to have
- * the same address as old ones, bypassing the address-based detection.
+ * Called at the start of every screen transition, while the screen being
+ * left still exists. Cached screens keep showing their old clock, dropdown
+ * and bell state until this forces them to update.
  */
-void reset_backend_ui_state(void) {
-    // Force reset on next main screen update by clearing last_main_screen
-    last_main_screen = NULL;
-
-    // Also directly reset all dynamic state to be safe
-    status_eta_label = NULL;
-    progress_pct_label = NULL;
-
-    // Reset AMS widgets - these become invalid when parent screen is deleted
-    for (int i = 0; i < MAX_AMS_WIDGETS; i++) {
-        ams_widgets_left[i] = NULL;
-        ams_widgets_right[i] = NULL;
-    }
-    ams_widget_count_left = 0;
-    ams_widget_count_right = 0;
-    ams_static_hidden = false;
-
-    // Reset nozzle headers
-    left_badge = NULL;
-    left_label = NULL;
-    right_badge = NULL;
-    right_label = NULL;
-
-    // Reset cover image state
-    cover_displayed = false;
-
-    // Reset slot stripes (become invalid when screen is deleted)
-    for (int i = 0; i < STRIPE_COUNT; i++) {
-        ht_a_stripes[i] = NULL;
-        ht_b_stripes[i] = NULL;
-    }
-    // Reset AMS slot stripes
-    for (int slot = 0; slot < 4; slot++) {
-        for (int i = 0; i < STRIPE_COUNT; i++) {
-            ams_a_slot_stripes[slot][i] = NULL;
-            ams_b_slot_stripes[slot][i] = NULL;
-            ams_c_slot_stripes[slot][i] = NULL;
-            ams_d_slot_stripes[slot][i] = NULL;
-        }
-    }
-
-    // Reset AMS overview screen tracking
-    last_ams_screen = NULL;
-    ams_row2_positioned = false;
+void reset_backend_refresh_state(void) {
+    // The dots sit on the screen being left - delete them while it's alive
+    clear_notification_dots();
+    last_bell_screen = -1;
 
     // Reset printer dropdown tracking
     last_printer_count = -1;
     last_connected_mask = 0;
 
-    // Reset clock tracking to force immediate update on new screen
-    last_time_hhmm = -1;
-
     // Reset screen tracking to force screen change detection
     previous_screen = -1;
 
-    // Force past rate limit on next update_backend_ui call
-    backend_update_counter = 1000;
-
-    ESP_LOGI(TAG, "Reset backend UI state - cleared all stale pointers");
+    // Refresh everything on the next update_backend_ui call
+    backend_ui_dirty = true;
 }
 
 /**
@@ -2403,21 +1687,18 @@ static void printer_dropdown_changed(lv_event_t *e) {
 
         // Check if new printer is dual-nozzle by looking at AMS extruder values
         // Only use AMS extruder assignment - active_extruder >= 0 is true for single-nozzle too
-        int ams_count = backend_get_ams_count(selected_printer_index);
+        const BackendPrinterSnapshot *printer = snapshot_printer(selected_printer_index);
+        int ams_count = printer ? printer->ams_count : 0;
         selected_printer_is_dual_nozzle = false;
         for (int i = 0; i < ams_count; i++) {
-            AmsUnitCInfo info;
-            if (backend_get_ams_unit(selected_printer_index, i, &info) == 0) {
-                if (info.extruder == 1) {  // Has left extruder AMS
-                    selected_printer_is_dual_nozzle = true;
-                    break;
-                }
+            if (printer->ams[i].info.extruder == 1) {  // Has left extruder AMS
+                selected_printer_is_dual_nozzle = true;
+                break;
             }
         }
 
-        // Force immediate update
-        needs_data_refresh = true;
-        backend_update_counter = 1000;  // Force past rate limit
+        // Re-render everything bound to printer data (status bar, main screen)
+        lv_subject_notify(&ui_subject_printers);
 
         // Reset AMS display state to rebuild with new printer
         ams_static_hidden = false;
@@ -2487,32 +1768,19 @@ typedef struct {
     int tray_count;
 } AmsSlotUserData;
 
-// Static storage for user data (slots are fixed, so we can use static storage)
-static AmsSlotUserData ams_a_slot_data[4] = {{0, 0, 4}, {0, 1, 4}, {0, 2, 4}, {0, 3, 4}};
-static AmsSlotUserData ams_b_slot_data[4] = {{1, 0, 4}, {1, 1, 4}, {1, 2, 4}, {1, 3, 4}};
-static AmsSlotUserData ams_c_slot_data[4] = {{2, 0, 4}, {2, 1, 4}, {2, 2, 4}, {2, 3, 4}};
-static AmsSlotUserData ams_d_slot_data[4] = {{3, 0, 4}, {3, 1, 4}, {3, 2, 4}, {3, 3, 4}};
-static AmsSlotUserData ams_ht_a_slot_data = {128, 0, 1};
+// Static storage for user data (external slots are fixed, so we can use static storage)
 static AmsSlotUserData ams_ext1_slot_data = {254, 0, 1};
 static AmsSlotUserData ams_ext2_slot_data = {255, 0, 1};
 
 // Success callback - trigger AMS display refresh
 static void ams_slot_config_success(void) {
     ESP_LOGI(TAG, "AMS slot configuration succeeded, refreshing display");
-    needs_data_refresh = true;
+    backend_ui_dirty = true;
 }
 
-// Click handler for AMS slots
-static void ams_slot_click_handler(lv_event_t *e) {
-    ESP_LOGI(TAG, "ams_slot_click_handler: ENTRY");
-
-    AmsSlotUserData *slot_data = (AmsSlotUserData *)lv_event_get_user_data(e);
-    if (!slot_data) {
-        ESP_LOGI(TAG, "ams_slot_click_handler: no slot_data");
-        return;
-    }
-
-    ESP_LOGI(TAG, "ams_slot_click_handler: slot ams=%d tray=%d", slot_data->ams_id, slot_data->tray_id);
+// Open the Configure Slot modal for one tray
+static void open_ams_slot_modal(const AmsSlotUserData *slot_data) {
+    ESP_LOGI(TAG, "open_ams_slot_modal: slot ams=%d tray=%d", slot_data->ams_id, slot_data->tray_id);
 
     // Get printer serial
     BackendPrinterInfo printer_info = {0};
@@ -2520,7 +1788,7 @@ static void ams_slot_click_handler(lv_event_t *e) {
         ESP_LOGI(TAG, "Failed to get printer info for slot click");
         return;
     }
-    ESP_LOGI(TAG, "ams_slot_click_handler: got printer info");
+    ESP_LOGI(TAG, "open_ams_slot_modal: got printer info");
 
     // Get current tray info
     AmsUnitCInfo ams_info = {0};
@@ -2557,94 +1825,69 @@ static void ams_slot_click_handler(lv_event_t *e) {
              printer_info.serial, slot_data->ams_id, slot_data->tray_id, extruder_id,
              tray_type ? tray_type : "empty", tray_color);
 
-    ESP_LOGI(TAG, "ams_slot_click_handler: calling ui_ams_slot_modal_open");
+    ESP_LOGI(TAG, "open_ams_slot_modal: calling ui_ams_slot_modal_open");
     ui_ams_slot_modal_open(printer_info.serial, slot_data->ams_id, slot_data->tray_id,
                            slot_data->tray_count, extruder_id,
                            tray_type, tray_color[0] ? tray_color : NULL,
                            ams_slot_config_success);
-    ESP_LOGI(TAG, "ams_slot_click_handler: modal_open returned");
+    ESP_LOGI(TAG, "open_ams_slot_modal: modal_open returned");
 }
 
-/**
- * @brief Wire up AMS slot click handlers on AMS overview screen
- *
- * Makes each AMS slot clickable to open the configuration modal.
- */
-void wire_ams_slot_click_handlers(void) {
-    // AMS A slots
-    lv_obj_t *ams_a_slots[] = {
-        objects.ams_screen_ams_panel_ams_a_slot_1,
-        objects.ams_screen_ams_panel_ams_a_slot_2,
-        objects.ams_screen_ams_panel_ams_a_slot_3,
-        objects.ams_screen_ams_panel_ams_a_slot_4
-    };
-    for (int i = 0; i < 4; i++) {
-        if (ams_a_slots[i]) {
-            lv_obj_add_flag(ams_a_slots[i], LV_OBJ_FLAG_CLICKABLE);
-            lv_obj_add_event_cb(ams_a_slots[i], ams_slot_click_handler, LV_EVENT_CLICKED,
-                               &ams_a_slot_data[i]);
-        }
-    }
-
-    // AMS B slots
-    lv_obj_t *ams_b_slots[] = {
-        objects.ams_screen_ams_panel_ams_b_slot_1,
-        objects.ams_screen_ams_panel_ams_b_slot_2,
-        objects.ams_screen_ams_panel_ams_b_slot_3,
-        objects.ams_screen_ams_panel_ams_b_slot_4
-    };
-    for (int i = 0; i < 4; i++) {
-        if (ams_b_slots[i]) {
-            lv_obj_add_flag(ams_b_slots[i], LV_OBJ_FLAG_CLICKABLE);
-            lv_obj_add_event_cb(ams_b_slots[i], ams_slot_click_handler, LV_EVENT_CLICKED,
-                               &ams_b_slot_data[i]);
-        }
+// Click handler for the external slot panels
+static void ams_slot_click_handler(lv_event_t *e) {
+    AmsSlotUserData *slot_data = (AmsSlotUserData *)lv_event_get_user_data(e);
+    if (!slot_data) {
+        ESP_LOGI(TAG, "ams_slot_click_handler: no slot_data");
+        return;
     }
+    open_ams_slot_modal(slot_data);
+}
 
-    // AMS C slots (if they exist)
-    lv_obj_t *ams_c_slots[] = {
-        objects.ams_screen_ams_panel_ams_c_slot_1,
-        objects.ams_screen_ams_panel_ams_c_slot_2,
-        objects.ams_screen_ams_panel_ams_c_slot_3,
-        objects.ams_screen_ams_panel_ams_c_slot_4
-    };
-    for (int i = 0; i < 4; i++) {
-        if (ams_c_slots[i]) {
-            lv_obj_add_flag(ams_c_slots[i], LV_OBJ_FLAG_CLICKABLE);
-            lv_obj_add_event_cb(ams_c_slots[i], ams_slot_click_handler, LV_EVENT_CLICKED,
-                               &ams_c_slot_data[i]);
-        }
-    }
+// Click handler for the AMS strips, user data = AMS unit ID
+static void ams_strip_click_handler(lv_event_t *e) {
+    lv_obj_t *strip = lv_event_get_target(e);
+    int slot = ui_ams_strip_get_pressed_slot(strip);
+    if (slot < 0) return;  // Between slots
 
-    // AMS D slots (note: typo in EEZ project - "amd_d" instead of "ams_d")
-    lv_obj_t *ams_d_slots[] = {
-        objects.ams_screen_ams_panel_amd_d_slot_1,
-        objects.ams_screen_ams_panel_amd_d_slot_2,
-        objects.ams_screen_ams_panel_amd_d_slot_3,
-        objects.ams_screen_ams_panel_amd_d_slot_4
+    AmsSlotUserData slot_data = {
+        .ams_id = (int)(intptr_t)lv_event_get_user_data(e),
+        .tray_id = slot,
+        .tray_count = ui_ams_strip_get_slot_count(strip),
     };
-    for (int i = 0; i < 4; i++) {
-        if (ams_d_slots[i]) {
-            lv_obj_add_flag(ams_d_slots[i], LV_OBJ_FLAG_CLICKABLE);
-            lv_obj_add_event_cb(ams_d_slots[i], ams_slot_click_handler, LV_EVENT_CLICKED,
-                               &ams_d_slot_data[i]);
-        }
-    }
-
-    // AMS HT-A slot (single slot AMS)
-    if (objects.ams_screen_ams_panel_ht_a_slot) {
-        lv_obj_add_flag(objects.ams_screen_ams_panel_ht_a_slot, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(objects.ams_screen_ams_panel_ht_a_slot, ams_slot_click_handler,
-                           LV_EVENT_CLICKED, &ams_ht_a_slot_data);
-    }
+    open_ams_slot_modal(&slot_data);
+}
 
-    // AMS HT-B slot (single slot AMS)
-    static AmsSlotUserData ams_ht_b_slot_data = {129, 0, 1};
-    if (objects.ams_screen_ams_panel_ht_b_slot) {
-        lv_obj_add_flag(objects.ams_screen_ams_panel_ht_b_slot, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(objects.ams_screen_ams_panel_ht_b_slot, ams_slot_click_handler,
-                           LV_EVENT_CLICKED, &ams_ht_b_slot_data);
-    }
+/**
+ * @brief Wire up AMS slot click handlers on AMS overview screen
+ *
+ * Replaces each AMS and HT panel's slot objects with one ui_ams_strip and
+ * makes its slots clickable to open the configuration modal.
+ */
+void wire_ams_slot_click_handlers(void) {
+    ams_overview_panel_t panels[AMS_OVERVIEW_PANELS];
+    get_ams_overview_panels(panels);
+
+    int replaced = 0;
+    for (int p = 0; p < AMS_OVERVIEW_PANELS; p++) {
+        ams_overview_strips[p] = NULL;
+        if (!panels[p].panel) continue;
+
+        // Strip origin = first slot (EEZ -6, 47 / HT 14, 47) minus the layout's slot offset
+        lv_obj_t *strip = ui_ams_strip_create(panels[p].panel, UI_AMS_STRIP_OVERVIEW,
+                                              panels[p].slot_count);
+        lv_obj_set_pos(strip, -16, 18);
+        replaced += ui_ams_strip_replace(strip, panels[p].slot_objects, AMS_OVERVIEW_SLOT_OBJECTS);
+
+        char name[16];
+        get_ams_unit_name(panels[p].ams_id, name, sizeof(name));
+        ui_ams_strip_set_name(strip, name);
+
+        lv_obj_add_flag(strip, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_add_event_cb(strip, ams_strip_click_handler, LV_EVENT_CLICKED,
+                            (void *)(intptr_t)panels[p].ams_id);
+        ams_overview_strips[p] = strip;
+    }
+    ESP_LOGI(TAG, "AMS overview: %d slot objects replaced by strips", replaced);
 
     // External slots - use the panel itself as the clickable area
     if (objects.ams_screen_ams_panel_ext_1) {
@@ -0,0 +1,226 @@
+/**
+ * @file ui_cover_cache.c
+ * @brief Print job cover images for all printers
+ *
+ * Each slot owns a fixed RGB565 buffer (in PSRAM on ESP32) and the image
+ * descriptor pointing at it. A download fills a temporary buffer on the
+ * worker; the LVGL thread copies it into the slot, so a displayed cover is
+ * never written while LVGL may be drawing it.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#include "ui_cover_cache.h"
+#include "ui_internal.h"
+#include "ui_async.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+
+// PSRAM attribute for large arrays on ESP32
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#else
+#define EXT_RAM_BSS_ATTR
+#endif
+
+static const char *TAG = "ui_cover_cache";
+
+typedef enum {
+    COVER_EMPTY,
+    COVER_LOADING,
+    COVER_READY,
+    COVER_FAILED,
+} cover_state_t;
+
+typedef struct {
+    cover_state_t state;
+    char serial[20];            // BackendPrinterInfo.serial
+    char subtask[64];           // BackendPrinterInfo.subtask_name
+    uint32_t failed_at;         // lv_tick_get() of the failed download
+    uint32_t last_use;          // LRU clock
+    lv_image_dsc_t dsc;
+} cover_slot_t;
+
+// Download in flight (buffer filled on a ui_async worker)
+typedef struct {
+    cover_slot_t *slot;
+    char serial[20];
+    char subtask[64];
+    int size;
+    uint8_t *pixels;
+} cover_request_t;
+
+static cover_slot_t slots[UI_COVER_CACHE_SLOTS];
+static EXT_RAM_BSS_ATTR uint8_t slot_pixels[UI_COVER_CACHE_SLOTS][UI_COVER_BYTES];
+static uint32_t use_clock = 0;
+static uint32_t generation = 0;
+
+// =============================================================================
+// Slots
+// =============================================================================
+
+// The backend only serves a cover while a job is running (see cover_url)
+static bool printer_has_job(const BackendPrinterInfo *info) {
+    if (!info->connected || !info->subtask_name[0]) return false;
+    return strcmp(info->gcode_state, "RUNNING") == 0 ||
+           strcmp(info->gcode_state, "PAUSE") == 0 ||
+           strcmp(info->gcode_state, "PAUSED") == 0;
+}
+
+static bool slot_matches(const cover_slot_t *slot, const char *serial, const char *subtask) {
+    return slot->state != COVER_EMPTY &&
+           strncmp(slot->serial, serial, sizeof(slot->serial)) == 0 &&
+           strncmp(slot->subtask, subtask, sizeof(slot->subtask)) == 0;
+}
+
+static cover_slot_t *find_slot(const char *serial, const char *subtask) {
+    for (int i = 0; i < UI_COVER_CACHE_SLOTS; i++) {
+        if (slot_matches(&slots[i], serial, subtask)) return &slots[i];
+    }
+    return NULL;
+}
+
+// A slot whose job is still running on some printer must not be reused
+static bool slot_wanted(const cover_slot_t *slot, const BackendSnapshot *snapshot) {
+    for (int i = 0; i < snapshot->printer_count; i++) {
+        const BackendPrinterInfo *info = &snapshot->printers[i].info;
+        if (printer_has_job(info) && slot_matches(slot, info->serial, info->subtask_name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Free slot first, then the least recently used one nobody needs
+static cover_slot_t *claim_slot(const BackendSnapshot *snapshot) {
+    cover_slot_t *victim = NULL;
+    for (int i = 0; i < UI_COVER_CACHE_SLOTS; i++) {
+        cover_slot_t *slot = &slots[i];
+        if (slot->state == COVER_EMPTY) return slot;
+        if (slot->state == COVER_LOADING || slot_wanted(slot, snapshot)) continue;
+        if (!victim || (int32_t)(slot->last_use - victim->last_use) < 0) victim = slot;
+    }
+    return victim;
+}
+
+// =============================================================================
+// Downloads
+// =============================================================================
+
+static void cover_fetch_work(void *ctx) {
+    cover_request_t *req = ctx;
+    req->size = backend_fetch_cover(req->serial, req->pixels, UI_COVER_BYTES);
+}
+
+static void cover_fetch_done(void *ctx) {
+    cover_request_t *req = ctx;
+    cover_slot_t *slot = req->slot;
+
+    if (req->size != UI_COVER_BYTES) {
+        ESP_LOGW(TAG, "No cover for %s '%s' (%d bytes)", req->serial, req->subtask, req->size);
+        slot->state = COVER_FAILED;
+        slot->failed_at = lv_tick_get();
+    } else {
+        uint8_t *pixels = slot_pixels[slot - slots];
+        memcpy(pixels, req->pixels, UI_COVER_BYTES);
+
+        memset(&slot->dsc, 0, sizeof(slot->dsc));
+        slot->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+        slot->dsc.header.cf = LV_COLOR_FORMAT_RGB565;
+        slot->dsc.header.w = UI_COVER_WIDTH;
+        slot->dsc.header.h = UI_COVER_HEIGHT;
+        slot->dsc.header.stride = UI_COVER_WIDTH * 2;  // RGB565 = 2 bytes per pixel
+        slot->dsc.data_size = UI_COVER_BYTES;
+        slot->dsc.data = pixels;
+        // The slot may have held another job's cover
+        lv_image_cache_drop(&slot->dsc);
+
+        slot->state = COVER_READY;
+        generation++;
+        ESP_LOGI(TAG, "Cover ready for %s '%s'", req->serial, req->subtask);
+    }
+
+    free(req->pixels);
+    free(req);
+}
+
+static void start_fetch(cover_slot_t *slot, const BackendPrinterInfo *info) {
+    cover_request_t *req = malloc(sizeof(*req));
+    uint8_t *pixels = malloc(UI_COVER_BYTES);
+    if (!req || !pixels) {
+        free(req);
+        free(pixels);
+        return;
+    }
+
+    strncpy(slot->serial, info->serial, sizeof(slot->serial) - 1);
+    slot->serial[sizeof(slot->serial) - 1] = '\0';
+    strncpy(slot->subtask, info->subtask_name, sizeof(slot->subtask) - 1);
+    slot->subtask[sizeof(slot->subtask) - 1] = '\0';
+
+    req->slot = slot;
+    memcpy(req->serial, slot->serial, sizeof(req->serial));
+    memcpy(req->subtask, slot->subtask, sizeof(req->subtask));
+    req->size = -1;
+    req->pixels = pixels;
+
+    if (ui_async_submit(cover_fetch_work, cover_fetch_done, req)) {
+        slot->state = COVER_LOADING;
+        slot->last_use = ++use_clock;
+    } else {
+        // Workers busy - the next sync tries again
+        slot->state = COVER_EMPTY;
+        free(pixels);
+        free(req);
+    }
+}
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+void ui_cover_cache_sync(void) {
+    const BackendSnapshot *snapshot = ui_backend_get_snapshot();
+
+    // One download at a time - keep the other workers free for user actions
+    for (int i = 0; i < UI_COVER_CACHE_SLOTS; i++) {
+        if (slots[i].state == COVER_LOADING) return;
+    }
+
+    for (int i = 0; i < snapshot->printer_count; i++) {
+        const BackendPrinterInfo *info = &snapshot->printers[i].info;
+        if (!printer_has_job(info)) continue;
+
+        cover_slot_t *slot = find_slot(info->serial, info->subtask_name);
+        if (slot) {
+            if (slot->state != COVER_FAILED || lv_tick_elaps(slot->failed_at) < UI_COVER_RETRY_MS) {
+                continue;
+            }
+        } else {
+            slot = claim_slot(snapshot);
+            if (!slot) continue;
+        }
+        start_fetch(slot, info);
+        return;
+    }
+}
+
+const lv_image_dsc_t *ui_cover_cache_get(int printer_index) {
+    const BackendSnapshot *snapshot = ui_backend_get_snapshot();
+    if (printer_index < 0 || printer_index >= snapshot->printer_count) return NULL;
+
+    const BackendPrinterInfo *info = &snapshot->printers[printer_index].info;
+    if (!printer_has_job(info)) return NULL;
+
+    cover_slot_t *slot = find_slot(info->serial, info->subtask_name);
+    if (!slot || slot->state != COVER_READY) return NULL;
+
+    slot->last_use = ++use_clock;
+    return &slot->dsc;
+}
+
+uint32_t ui_cover_cache_generation(void) {
+    return generation;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file ui_cover_cache.h
+ * @brief Print job cover images for all printers
+ *
+ * Covers are keyed by (printer serial, subtask name) and downloaded once per
+ * job on a ui_async worker, as raw RGB565 (70x70, see COVER_SIZE in the
+ * backend). The UI gets an lv_image_dsc_t pointing into the cache, so
+ * switching printers shows the thumbnail without a download or a copy.
+ *
+ * LVGL thread only. Shared between firmware and simulator.
+ */
+
+#ifndef UI_COVER_CACHE_H
+#define UI_COVER_CACHE_H
+
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Cover image size (must match the backend's COVER_SIZE and the EEZ design)
+#define UI_COVER_WIDTH 70
+#define UI_COVER_HEIGHT 70
+#define UI_COVER_BYTES (UI_COVER_WIDTH * UI_COVER_HEIGHT * 2)
+
+// Covers kept (one per printer in the snapshot)
+#ifndef UI_COVER_CACHE_SLOTS
+#define UI_COVER_CACHE_SLOTS 4
+#endif
+
+// Delay before a failed download is tried again (ms)
+#ifndef UI_COVER_RETRY_MS
+#define UI_COVER_RETRY_MS 30000
+#endif
+
+/**
+ * Start downloads for printer jobs without a cached cover. Call after each
+ * snapshot refresh (ui_state.c).
+ */
+void ui_cover_cache_sync(void);
+
+/**
+ * Cover of a printer's current job
+ * @param printer_index Index into the backend snapshot
+ * @return Image descriptor owned by the cache (valid while the job runs),
+ *         NULL if the printer isn't printing or the cover isn't downloaded (yet)
+ */
+const lv_image_dsc_t *ui_cover_cache_get(int printer_index);
+
+/**
+ * Changes whenever a cover finished downloading
+ */
+uint32_t ui_cover_cache_generation(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_COVER_CACHE_H */
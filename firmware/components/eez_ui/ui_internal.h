@@ -96,8 +96,8 @@ extern int backend_set_url(const char *url);
 extern int backend_discover_server(void);
 extern int backend_is_connected(void);
 extern int backend_get_printer_count(void);
-extern int backend_has_cover(void);
-extern const uint8_t* backend_get_cover_data(uint32_t *size_out);
+// Download the current job's cover (raw RGB565) into buf; bytes read or -1 (blocking)
+extern int backend_fetch_cover(const char *serial, uint8_t *buf, uint32_t buf_size);
 
 // =============================================================================
 // AMS Data Types and Functions (implemented in Rust)
@@ -136,6 +136,55 @@ extern int backend_get_tray_now_left(int printer_index);
 extern int backend_get_tray_now_right(int printer_index);
 extern int backend_get_active_extruder(int printer_index);  // -1=unknown, 0=right, 1=left
 
+// =============================================================================
+// Backend Snapshot (implemented in Rust)
+// =============================================================================
+
+#define BACKEND_SNAPSHOT_MAX_PRINTERS 4
+#define BACKEND_SNAPSHOT_MAX_AMS 8
+
+// AMS unit entry of a snapshot (must match Rust BackendAmsSnapshot)
+typedef struct {
+    uint32_t generation;    // Changes whenever this unit's data changes
+    AmsUnitCInfo info;
+} BackendAmsSnapshot;
+
+// Printer entry of a snapshot (must match Rust BackendPrinterSnapshot)
+typedef struct {
+    uint32_t generation;    // Changes whenever the printer or any of its AMS units changes
+    BackendPrinterInfo info;
+    int tray_now;           // -1 if not available
+    int tray_now_left;
+    int tray_now_right;
+    int active_extruder;    // -1=unknown, 0=right, 1=left
+    uint8_t ams_count;
+    uint8_t _pad[3];
+    BackendAmsSnapshot ams[BACKEND_SNAPSHOT_MAX_AMS];
+} BackendPrinterSnapshot;
+
+// State of all printers and AMS units (must match Rust BackendSnapshot)
+typedef struct {
+    uint32_t generation;    // Latest generation handed out (0 = no data yet)
+    uint8_t printer_count;
+    uint8_t _pad[3];
+    BackendPrinterSnapshot printers[BACKEND_SNAPSHOT_MAX_PRINTERS];
+} BackendSnapshot;
+
+// Fill the snapshot under one lock. Entries whose generation already matches
+// are not copied again, so always pass the same zero-initialized buffer.
+extern void backend_get_snapshot(BackendSnapshot *snapshot);
+
+// =============================================================================
+// Display Task Functions (display_driver.c on firmware, main.c in simulator)
+// =============================================================================
+
+// Queue a callback to run on the LVGL thread - use this instead of calling
+// LVGL (or lv_async_call) from worker tasks. Returns false if the queue is full.
+extern bool display_ui_post(void (*cb)(void *arg), void *arg);
+// Lock/unlock LVGL for direct use from another task (timeout_ms < 0 = forever)
+extern bool display_lock(int timeout_ms);
+extern void display_unlock(void);
+
 // Time manager functions (implemented in Rust)
 // Returns hour in upper 8 bits, minute in lower 8 bits, or -1 if not synced
 extern int time_get_hhmm(void);
@@ -339,7 +388,21 @@ extern int editing_printer_index;
 
 void loadScreen(enum ScreensEnum screenId);
 void navigate_to_settings_detail(const char *title);
-void delete_all_screens(void);
+
+// Navigation latency, measured from handling pendingScreen to the end of the
+// first display refresh after the screen load (rendered and handed to the
+// flush callback; an async DMA copy of the last band may still be running).
+// Hits are served from the screen cache, misses build the screen.
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t hit_total_ms;
+    uint32_t miss_total_ms;
+    uint32_t last_ms;
+    uint32_t max_ms;
+} ui_nav_stats_t;
+
+void ui_get_nav_stats(ui_nav_stats_t *stats);
 
 // =============================================================================
 // Module Functions - ui_nvs.c
@@ -438,8 +501,11 @@ void wire_scan_printer_dropdown(void);
 void init_main_screen_ams(void);      // Hide static AMS content immediately on screen load
 int get_selected_printer_index(void);
 bool is_selected_printer_dual_nozzle(void);
-void reset_notification_state(void);  // Call before deleting screens
-void reset_backend_ui_state(void);    // Reset all dynamic UI state when screens deleted
+const BackendSnapshot *ui_backend_get_snapshot(void);  // Refreshed on every state sample (ui_state.c)
+uint32_t ui_backend_refresh_snapshot(void);  // Take a new snapshot, returns its generation
+void ui_backend_bind_state(void);  // Observe the ui_state subjects that drive update_backend_ui()
+void reset_backend_screen_state(int screen_id);  // Reset state owned by one screen before deleting it
+void reset_backend_refresh_state(void);  // Force a full refresh at the start of a screen transition
 void wire_ams_slot_click_handlers(void);  // Make AMS slots clickable (simulator only)
 
 // =============================================================================
@@ -0,0 +1,231 @@
+/**
+ * @file ui_mem.c
+ * @brief Per-screen and per-modal memory accounting
+ *
+ * Heap figures come from heap_caps on the firmware (LVGL is configured with
+ * LV_STDLIB_CLIB, so its objects live in the C heap together with other
+ * tasks' allocations) and from the LVGL builtin heap in the simulator.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#include "ui_mem.h"
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
+
+static const char *TAG = "ui_mem";
+
+#if UI_MEM_LOG_ENABLED
+#define MEM_LOG(fmt, ...) ESP_LOGI(TAG, fmt, ##__VA_ARGS__)
+#else
+#define MEM_LOG(fmt, ...) ((void)TAG)
+#endif
+
+// Screens recorded (EEZ screens plus programmatic screens)
+#define UI_MEM_MAX_SCREENS 16
+
+typedef struct {
+    int screen_id;
+    ui_mem_stats_t stats;
+} screen_record_t;
+
+static screen_record_t screen_records[UI_MEM_MAX_SCREENS];
+static int screen_record_count = 0;
+static ui_mem_sample_t screen_before;
+
+static const char *modal_names[UI_MEM_MODAL_COUNT] = {
+    "AMS slot modal",
+    "NFC popup",
+};
+static ui_mem_stats_t modal_stats[UI_MEM_MODAL_COUNT];
+static ui_mem_sample_t modal_before[UI_MEM_MODAL_COUNT];
+static bool modal_pending[UI_MEM_MODAL_COUNT];
+
+// =============================================================================
+// Sampling
+// =============================================================================
+
+static lv_obj_tree_walk_res_t count_cb(lv_obj_t *obj, void *user_data) {
+    (void)obj;
+    (*(uint32_t *)user_data)++;
+    return LV_OBJ_TREE_WALK_NEXT;
+}
+
+static uint32_t count_objects(lv_obj_t *root) {
+    uint32_t count = 0;
+    lv_obj_tree_walk(root, count_cb, &count);
+    return count;
+}
+
+uint32_t ui_mem_heap_free(void) {
+#ifdef ESP_PLATFORM
+    return heap_caps_get_free_size(MALLOC_CAP_8BIT);
+#else
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.free_size;
+#endif
+}
+
+uint32_t ui_mem_internal_free(void) {
+#ifdef ESP_PLATFORM
+    return heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+#else
+    return ui_mem_heap_free();
+#endif
+}
+
+void ui_mem_sample(ui_mem_sample_t *out) {
+    if (!out) return;
+
+#ifdef ESP_PLATFORM
+    out->heap_free = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    out->heap_used = heap_caps_get_total_size(MALLOC_CAP_8BIT) - out->heap_free;
+#else
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    out->heap_free = mon.free_size;
+    out->heap_used = mon.total_size - mon.free_size;
+#endif
+
+    // NULL walks every screen of every display; layers aren't screens
+    out->objects = count_objects(NULL);
+    out->objects += count_objects(lv_layer_top());
+    out->objects += count_objects(lv_layer_sys());
+}
+
+static void record(ui_mem_stats_t *stats, const ui_mem_sample_t *before, const ui_mem_sample_t *after) {
+    int32_t delta = (int32_t)after->heap_used - (int32_t)before->heap_used;
+    stats->count++;
+    stats->heap_delta = delta;
+    if (stats->count == 1 || delta > stats->heap_max_delta) {
+        stats->heap_max_delta = delta;
+    }
+    stats->heap_used = after->heap_used;
+}
+
+// =============================================================================
+// Screens
+// =============================================================================
+
+static ui_mem_stats_t *find_screen(int screen_id, bool create) {
+    for (int i = 0; i < screen_record_count; i++) {
+        if (screen_records[i].screen_id == screen_id) {
+            return &screen_records[i].stats;
+        }
+    }
+    if (!create || screen_record_count >= UI_MEM_MAX_SCREENS) {
+        return NULL;
+    }
+    screen_record_t *rec = &screen_records[screen_record_count++];
+    memset(rec, 0, sizeof(*rec));
+    rec->screen_id = screen_id;
+    return &rec->stats;
+}
+
+void ui_mem_screen_begin(void) {
+    if (!UI_MEM_TRACK_ENABLED) return;
+    ui_mem_sample(&screen_before);
+}
+
+void ui_mem_screen_loaded(int screen_id, lv_obj_t *screen) {
+    if (!UI_MEM_TRACK_ENABLED) return;
+    ui_mem_stats_t *stats = find_screen(screen_id, true);
+    if (!stats) return;
+
+    ui_mem_sample_t after;
+    ui_mem_sample(&after);
+    record(stats, &screen_before, &after);
+    stats->objects = screen ? count_objects(screen) : 0;
+
+    MEM_LOG("Screen %d: %lu objects, heap %+ld B (used %lu B, free %lu B, %lu objects total)",
+            screen_id, (unsigned long)stats->objects, (long)stats->heap_delta,
+            (unsigned long)after.heap_used, (unsigned long)after.heap_free,
+            (unsigned long)after.objects);
+}
+
+bool ui_mem_get_screen_stats(int screen_id, ui_mem_stats_t *out) {
+    ui_mem_stats_t *stats = find_screen(screen_id, false);
+    if (!stats || !out) return false;
+    *out = *stats;
+    return true;
+}
+
+// =============================================================================
+// Modals
+// =============================================================================
+
+void ui_mem_modal_begin(ui_mem_modal_t modal) {
+    if (!UI_MEM_TRACK_ENABLED || modal >= UI_MEM_MODAL_COUNT) return;
+    ui_mem_sample(&modal_before[modal]);
+    modal_pending[modal] = true;
+}
+
+void ui_mem_modal_opened(ui_mem_modal_t modal) {
+    if (modal >= UI_MEM_MODAL_COUNT || !modal_pending[modal]) return;
+
+    ui_mem_sample_t after;
+    ui_mem_sample(&after);
+    ui_mem_stats_t *stats = &modal_stats[modal];
+    record(stats, &modal_before[modal], &after);
+    stats->objects = after.objects - modal_before[modal].objects;
+
+    MEM_LOG("%s opened: %lu objects, heap %+ld B", modal_names[modal],
+            (unsigned long)stats->objects, (long)stats->heap_delta);
+}
+
+void ui_mem_modal_closed(ui_mem_modal_t modal) {
+    if (modal >= UI_MEM_MODAL_COUNT || !modal_pending[modal]) return;
+    modal_pending[modal] = false;
+
+    ui_mem_sample_t after;
+    ui_mem_sample(&after);
+    ui_mem_stats_t *stats = &modal_stats[modal];
+    stats->heap_leak = (int32_t)after.heap_used - (int32_t)modal_before[modal].heap_used;
+    stats->object_leak = (int32_t)after.objects - (int32_t)modal_before[modal].objects;
+
+    MEM_LOG("%s closed: %+ld objects, heap %+ld B since open", modal_names[modal],
+            (long)stats->object_leak, (long)stats->heap_leak);
+}
+
+bool ui_mem_get_modal_stats(ui_mem_modal_t modal, ui_mem_stats_t *out) {
+    if (modal >= UI_MEM_MODAL_COUNT || !out || modal_stats[modal].count == 0) return false;
+    *out = modal_stats[modal];
+    return true;
+}
+
+// =============================================================================
+// Summary
+// =============================================================================
+
+void ui_mem_log_summary(void) {
+    ui_mem_sample_t now;
+    ui_mem_sample(&now);
+    ESP_LOGI(TAG, "Heap used %lu B, free %lu B, %lu objects",
+             (unsigned long)now.heap_used, (unsigned long)now.heap_free, (unsigned long)now.objects);
+
+    for (int i = 0; i < screen_record_count; i++) {
+        const ui_mem_stats_t *s = &screen_records[i].stats;
+        ESP_LOGI(TAG, "  screen %3d: %4lu visits, %4lu objects, last %+ld B, max %+ld B",
+                 screen_records[i].screen_id, (unsigned long)s->count, (unsigned long)s->objects,
+                 (long)s->heap_delta, (long)s->heap_max_delta);
+    }
+    for (int i = 0; i < UI_MEM_MODAL_COUNT; i++) {
+        const ui_mem_stats_t *s = &modal_stats[i];
+        if (s->count == 0) continue;
+        ESP_LOGI(TAG, "  %s: %lu opens, %lu objects, max %+ld B, last close left %+ld B / %+ld objects",
+                 modal_names[i], (unsigned long)s->count, (unsigned long)s->objects,
+                 (long)s->heap_max_delta, (long)s->heap_leak, (long)s->object_leak);
+    }
+}
+
+void ui_mem_reset(void) {
+    screen_record_count = 0;
+    memset(modal_stats, 0, sizeof(modal_stats));
+    memset(modal_pending, 0, sizeof(modal_pending));
+}
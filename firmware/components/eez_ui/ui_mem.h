@@ -0,0 +1,119 @@
+/**
+ * @file ui_mem.h
+ * @brief Per-screen and per-modal memory accounting
+ *
+ * Records LVGL object count and heap usage around every screen transition
+ * and every modal open/close. Results are logged and can be queried, e.g.
+ * by the simulator soak test to detect leaks.
+ *
+ * Each record walks the whole LVGL object tree, so recording is off by
+ * default. Turn it on with CONFIG_UI_MEM_TRACK (firmware menuconfig), the
+ * UI_MEM_TRACK CMake option (simulator, on in Debug builds) or by defining
+ * UI_MEM_TRACK_ENABLED=1. The sample and heap queries always work.
+ *
+ * Shared between firmware and simulator.
+ */
+
+#ifndef UI_MEM_H
+#define UI_MEM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <lvgl.h>
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Record every transition / modal open and close (0 = hooks do nothing)
+#ifndef UI_MEM_TRACK_ENABLED
+#ifdef CONFIG_UI_MEM_TRACK
+#define UI_MEM_TRACK_ENABLED 1
+#else
+#define UI_MEM_TRACK_ENABLED 0
+#endif
+#endif
+
+// Log every recorded transition / modal open and close (0 = query only)
+#ifndef UI_MEM_LOG_ENABLED
+#define UI_MEM_LOG_ENABLED UI_MEM_TRACK_ENABLED
+#endif
+
+// Modals and popups that are tracked
+typedef enum {
+    UI_MEM_MODAL_AMS_SLOT = 0,  // ui_ams_slot_modal
+    UI_MEM_MODAL_NFC_POPUP,     // NFC tag detected popup
+    UI_MEM_MODAL_COUNT
+} ui_mem_modal_t;
+
+typedef struct {
+    uint32_t heap_used;     // Firmware: 8-bit capable heap (LVGL uses the C heap), simulator: LVGL heap
+    uint32_t heap_free;
+    uint32_t objects;       // LVGL objects on all screens plus the top and system layers
+} ui_mem_sample_t;
+
+typedef struct {
+    uint32_t count;         // Transitions to the screen / modal opens
+    uint32_t objects;       // Screen: objects in the screen tree, modal: objects created by the open
+    int32_t heap_delta;     // Heap change of the last transition / open
+    int32_t heap_max_delta; // Largest heap change of one transition / open
+    uint32_t heap_used;     // Heap in use after the last transition / open
+    int32_t heap_leak;      // Modal: heap not returned by the last open/close cycle
+    int32_t object_leak;    // Modal: objects not deleted by the last open/close cycle
+} ui_mem_stats_t;
+
+/**
+ * Take a sample now (walks the whole LVGL object tree)
+ */
+void ui_mem_sample(ui_mem_sample_t *out);
+
+/**
+ * Free heap in bytes (cheap, no object walk)
+ */
+uint32_t ui_mem_heap_free(void);
+
+/**
+ * Free internal SRAM in bytes (firmware; the simulator has no PSRAM and
+ * returns ui_mem_heap_free()). Small LVGL allocations and WiFi live here.
+ */
+uint32_t ui_mem_internal_free(void);
+
+/**
+ * Screen transitions: call before the old screen is released and after the
+ * new one is loaded.
+ */
+void ui_mem_screen_begin(void);
+void ui_mem_screen_loaded(int screen_id, lv_obj_t *screen);
+
+/**
+ * Modals: call before creating, once fully built, and after deleting.
+ */
+void ui_mem_modal_begin(ui_mem_modal_t modal);
+void ui_mem_modal_opened(ui_mem_modal_t modal);
+void ui_mem_modal_closed(ui_mem_modal_t modal);
+
+/**
+ * Query recorded stats
+ * @return false if the screen / modal hasn't been recorded yet
+ */
+bool ui_mem_get_screen_stats(int screen_id, ui_mem_stats_t *out);
+bool ui_mem_get_modal_stats(ui_mem_modal_t modal, ui_mem_stats_t *out);
+
+/**
+ * Log all recorded stats
+ */
+void ui_mem_log_summary(void);
+
+/**
+ * Forget all recorded stats
+ */
+void ui_mem_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_MEM_H */
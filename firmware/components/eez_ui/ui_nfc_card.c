@@ -4,26 +4,20 @@
  */
 
 #include "ui_nfc_card.h"
+#include "ui_mem.h"
+#include "ui_async.h"
+#include "ui_spool_cache.h"
 #include "screens.h"
 #include "lvgl.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "esp_log.h"
 
 #ifdef ESP_PLATFORM
 #include "ui_internal.h"
-// Type aliases for unified API
-typedef SpoolInfoC SpoolInfoLocal;
-typedef SpoolKProfileC SpoolKProfileLocal;
-#define spool_get_by_tag_local spool_get_by_tag
-#define spool_get_k_profile_local spool_get_k_profile_for_printer
 #else
 #include "backend_client.h"
-// Type aliases for unified API
-typedef SpoolInfo SpoolInfoLocal;
-typedef SpoolKProfile SpoolKProfileLocal;
-#define spool_get_by_tag_local spool_get_by_tag_full
-#define spool_get_k_profile_local spool_get_k_profile_for_printer_full
 #endif
 
 static const char *TAG = "ui_nfc_card";
@@ -67,6 +61,7 @@ static char dismissed_tag_uid[32] = {0};  // UID of tag that was dismissed (surv
 
 // Popup elements
 static lv_obj_t *tag_popup = NULL;
+static uint32_t popup_generation = 0;          // Bumped on close, drops stale results
 static lv_obj_t *popup_tag_label = NULL;
 static lv_obj_t *popup_weight_label = NULL;
 
@@ -74,10 +69,61 @@ static lv_obj_t *popup_weight_label = NULL;
 static lv_obj_t *link_popup = NULL;
 static UntaggedSpoolInfo untagged_spools[20];  // Cache of untagged spools
 static int untagged_spools_count = 0;
+static bool untagged_list_loading = false;
+
+// Tag popup requests (filled on a ui_async worker)
+typedef struct {
+    uint32_t generation;
+    char uid[32];
+    bool in_inventory;
+    SpoolInfoC spool;
+    int untagged_count;     // Only looked up for unknown tags
+} popup_lookup_t;
+
+typedef struct {
+    uint32_t generation;
+    char tag_id[32];
+    int weight;
+    bool success;
+} spool_add_request_t;
+
+typedef struct {
+    uint32_t generation;
+    UntaggedSpoolInfo spools[20];
+    int count;
+} untagged_list_request_t;
+
+typedef struct {
+    uint32_t generation;
+    char tag_id[32];
+    UntaggedSpoolInfo spool;
+    int result;             // spool_link_tag() result
+} link_request_t;
 
 // Tag details modal (read-only view)
 static lv_obj_t *details_modal = NULL;
 static char details_modal_spool_id[64] = {0};  // For sync button
+static uint32_t details_generation = 0;        // Bumped on close, drops stale lookups
+
+// Inventory lookup for the details modal (filled on a ui_async worker)
+typedef struct {
+    uint32_t generation;
+    char uid[32];
+    char printer_serial[32];    // Selected printer, empty if none
+    bool in_inventory;
+    SpoolInfoC spool;
+    SpoolKProfileC k_profile;
+    bool has_k_profile;
+} details_lookup_t;
+
+// Weight sync from the details modal (sent on a ui_async worker)
+typedef struct {
+    uint32_t generation;
+    char spool_id[64];
+    int weight;
+    lv_obj_t *button;       // Sync button, valid while generation matches
+    bool success;
+} weight_sync_request_t;
 
 // Close handler for details modal
 static void details_modal_close_handler(lv_event_t *e) {
@@ -85,12 +131,38 @@ static void details_modal_close_handler(lv_event_t *e) {
     if (details_modal) {
         lv_obj_delete(details_modal);
         details_modal = NULL;
+        details_generation++;
     }
 }
 
+// Worker: send the weight to the backend
+static void weight_sync_work(void *ctx) {
+    weight_sync_request_t *req = ctx;
+    req->success = spool_sync_weight(req->spool_id, req->weight);
+    if (req->success) {
+        ui_spool_cache_invalidate_spool(req->spool_id);
+    }
+}
+
+// LVGL thread: refresh the modal, or re-enable the button on failure
+static void weight_sync_done(void *ctx) {
+    weight_sync_request_t *req = ctx;
+    if (details_modal && req->generation == details_generation) {
+        if (req->success) {
+            ESP_LOGI(TAG, "Weight synced successfully");
+            // Close and reopen to refresh
+            details_modal_close_handler(NULL);
+            ui_nfc_card_show_details();
+        } else {
+            ESP_LOGE(TAG, "Failed to sync weight");
+            lv_obj_clear_state(req->button, LV_STATE_DISABLED);
+        }
+    }
+    free(req);
+}
+
 // Sync weight button handler
 static void sync_weight_click_handler(lv_event_t *e) {
-    (void)e;
     if (details_modal_spool_id[0] == '\0') return;
 
     float weight = scale_get_weight();
@@ -100,30 +172,27 @@ static void sync_weight_click_handler(lv_event_t *e) {
 
     ESP_LOGI(TAG, "Syncing weight %dg for spool %s", weight_int, details_modal_spool_id);
 
-    if (spool_sync_weight(details_modal_spool_id, weight_int)) {
-        ESP_LOGI(TAG, "Weight synced successfully");
-        // Close and reopen to refresh
-        details_modal_close_handler(NULL);
-        ui_nfc_card_show_details();
-    } else {
-        ESP_LOGE(TAG, "Failed to sync weight");
+    weight_sync_request_t *req = calloc(1, sizeof(*req));
+    if (!req) return;
+    req->generation = details_generation;
+    strncpy(req->spool_id, details_modal_spool_id, sizeof(req->spool_id) - 1);
+    req->weight = weight_int;
+    req->button = lv_event_get_target(e);
+
+    // Disabled until the result is in, so a second tap can't send it twice
+    if (!ui_async_submit(weight_sync_work, weight_sync_done, req)) {
+        ESP_LOGW(TAG, "Busy - weight not synced");
+        free(req);
+        return;
     }
+    lv_obj_add_state(req->button, LV_STATE_DISABLED);
 }
 
-// Show tag details modal (read-only, just Close button)
-void ui_nfc_card_show_details(void) {
-    if (details_modal) return;  // Already open
-
-    // Check if tag is present
-    bool tag_present = nfc_tag_present();
-
-    // Get tag UID if present
-    uint8_t uid_str[32] = {0};
-    bool tag_in_inventory = false;
-    if (tag_present) {
-        nfc_get_uid_hex(uid_str, sizeof(uid_str));
-        tag_in_inventory = spool_exists_by_tag((const char*)uid_str);
-    }
+// Build the details modal (lookup is NULL when no tag is present)
+static void build_details_modal(const details_lookup_t *lookup) {
+    bool tag_present = lookup != NULL;
+    bool tag_in_inventory = lookup && lookup->in_inventory;
+    const char *uid_str = lookup ? lookup->uid : "";
 
     // Get weight
     float weight = scale_get_weight();
@@ -272,24 +341,14 @@ void ui_nfc_card_show_details(void) {
         lv_obj_center(close_label);
 
     } else if (tag_in_inventory) {
-        // Get spool data from inventory
-        SpoolInfoLocal spool_info = {0};
-        spool_get_by_tag_local((const char*)uid_str, &spool_info);
+        // Spool data and K profile for the selected printer (looked up by the worker)
+        SpoolInfoC spool_info = lookup->spool;
+        SpoolKProfileC k_profile = lookup->k_profile;
+        bool has_k_profile = lookup->has_k_profile;
 
         // Store spool ID for sync button
         strncpy(details_modal_spool_id, spool_info.id, sizeof(details_modal_spool_id) - 1);
 
-        // Get K profile for selected printer
-        SpoolKProfileLocal k_profile = {0};
-        bool has_k_profile = false;
-        int printer_idx = get_selected_printer_index();
-        if (printer_idx >= 0 && spool_info.id[0]) {
-            BackendPrinterInfo printer_info = {0};
-            if (backend_get_printer(printer_idx, &printer_info) == 0) {
-                has_k_profile = spool_get_k_profile_local(spool_info.id, printer_info.serial, &k_profile);
-            }
-        }
-
         // Color from inventory
         uint32_t color_rgba = spool_info.color_rgba;
         uint8_t r = (color_rgba >> 24) & 0xFF;
@@ -610,6 +669,88 @@ void ui_nfc_card_show_details(void) {
     }
 }
 
+// Worker: inventory lookups (blocking backend calls)
+static void details_lookup_work(void *ctx) {
+    details_lookup_t *lookup = ctx;
+    lookup->in_inventory = ui_spool_cache_get_by_tag(lookup->uid, &lookup->spool);
+    if (!lookup->in_inventory) return;
+
+    if (lookup->printer_serial[0] && lookup->spool.id[0]) {
+        lookup->has_k_profile = ui_spool_cache_get_k_profile(lookup->spool.id, lookup->printer_serial,
+                                                             &lookup->k_profile);
+    }
+}
+
+// LVGL thread: replace the loading card unless it was closed meanwhile
+static void details_lookup_done(void *ctx) {
+    details_lookup_t *lookup = ctx;
+    if (details_modal && lookup->generation == details_generation) {
+        lv_obj_delete(details_modal);
+        details_modal = NULL;
+        build_details_modal(lookup);
+    }
+    free(lookup);
+}
+
+// Placeholder shown while the inventory lookup runs, or its error; tap closes
+static void show_details_status(const char *text) {
+    details_modal = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(details_modal, 800, 480);
+    lv_obj_set_pos(details_modal, 0, 0);
+    lv_obj_set_style_bg_color(details_modal, lv_color_hex(0x000000), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(details_modal, 180, LV_PART_MAIN);
+    lv_obj_set_style_border_width(details_modal, 0, LV_PART_MAIN);
+    lv_obj_clear_flag(details_modal, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(details_modal, details_modal_close_handler, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t *card = lv_obj_create(details_modal);
+    lv_obj_set_size(card, 480, 120);
+    lv_obj_center(card);
+    lv_obj_set_style_bg_color(card, lv_color_hex(0x1a1a1a), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(card, 255, LV_PART_MAIN);
+    lv_obj_set_style_border_color(card, lv_color_hex(0x666666), LV_PART_MAIN);
+    lv_obj_set_style_border_width(card, 2, LV_PART_MAIN);
+    lv_obj_set_style_radius(card, 12, LV_PART_MAIN);
+    lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *label = lv_label_create(card);
+    lv_label_set_text(label, text);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_14, LV_PART_MAIN);
+    lv_obj_set_style_text_color(label, lv_color_hex(0x888888), LV_PART_MAIN);
+    lv_obj_center(label);
+}
+
+// Show tag details modal (read-only, just Close button)
+void ui_nfc_card_show_details(void) {
+    if (details_modal) return;  // Already open (or loading)
+
+    if (!nfc_tag_present()) {
+        build_details_modal(NULL);
+        return;
+    }
+
+    details_lookup_t *lookup = calloc(1, sizeof(*lookup));
+    if (!lookup) return;
+    lookup->generation = details_generation;
+    nfc_get_uid_hex((uint8_t *)lookup->uid, sizeof(lookup->uid));
+
+    int printer_idx = get_selected_printer_index();
+    BackendPrinterInfo printer_info = {0};
+    if (printer_idx >= 0 && backend_get_printer(printer_idx, &printer_info) == 0) {
+        strncpy(lookup->printer_serial, printer_info.serial, sizeof(lookup->printer_serial) - 1);
+    }
+
+    if (!ui_async_submit(details_lookup_work, details_lookup_done, lookup)) {
+        // Don't fallback to sync - the lookup would block rendering
+        free(lookup);
+        show_details_status("Busy - please try again");
+        return;
+    }
+    show_details_status("Loading spool...");
+}
+
+static void close_popup(void);
+
 // Button click handlers
 static void popup_close_handler(lv_event_t *e) {
     (void)e;
@@ -618,12 +759,7 @@ static void popup_close_handler(lv_event_t *e) {
     // Remember which tag was dismissed (survives brief NFC reader glitches)
     strncpy(dismissed_tag_uid, (char*)popup_tag_uid, sizeof(dismissed_tag_uid) - 1);
     dismissed_tag_uid[sizeof(dismissed_tag_uid) - 1] = '\0';
-    if (tag_popup) {
-        lv_obj_delete(tag_popup);
-        tag_popup = NULL;
-        popup_tag_label = NULL;
-        popup_weight_label = NULL;
-    }
+    close_popup();
 }
 
 static void configure_ams_click_handler(lv_event_t *e) {
@@ -642,40 +778,67 @@ static void configure_ams_click_handler(lv_event_t *e) {
 // Forward declarations
 static void show_success_overlay(const char *message);
 static void show_link_spool_popup(void);
-
-static void add_spool_click_handler(lv_event_t *e) {
-    (void)e;
-    ESP_LOGI(TAG, "Add Spool clicked");
-
-    // Get current weight
-    float weight = scale_get_weight();
-    bool scale_ok = scale_is_initialized();
-    int weight_current = scale_ok ? (int)weight : 0;
-    if (weight_current >= -20 && weight_current <= 20) weight_current = 0;
-
-    // Add spool with minimal info - tag_id and weight only
-    // User will configure details via frontend
-    bool success = spool_add_to_inventory(
-        (const char*)popup_tag_uid,  // tag_id
+static void show_popup_status(const char *text);
+
+// Worker: add the spool with minimal info - tag_id and weight only
+// User will configure details via frontend
+static void spool_add_work(void *ctx) {
+    spool_add_request_t *req = ctx;
+    req->success = spool_add_to_inventory(
+        req->tag_id,                  // tag_id
         "Unknown",                    // vendor
         "Unknown",                    // material
         NULL,                         // subtype
         "Unknown",                    // color_name
         0x808080FF,                   // color_rgba (gray)
         1000,                         // label_weight (default 1kg)
-        weight_current,               // weight_current from scale
+        req->weight,                  // weight_current from scale
         "display_add",                // data_origin
         "generic",                    // tag_type
         NULL                          // slicer_filament
     );
+    if (req->success) {
+        ui_spool_cache_invalidate_tag(req->tag_id);
+    }
+}
 
-    if (success) {
+// LVGL thread: show the result unless the popup was closed meanwhile
+static void spool_add_done(void *ctx) {
+    spool_add_request_t *req = ctx;
+    if (req->success) {
         ESP_LOGI(TAG, "Spool added successfully");
-        show_success_overlay("Spool Added!\nConfigure details in web UI.");
     } else {
         ESP_LOGE(TAG, "Failed to add spool");
-        show_success_overlay("Failed to add spool.\nPlease try again.");
     }
+    if (tag_popup && req->generation == popup_generation) {
+        show_success_overlay(req->success ? "Spool Added!\nConfigure details in web UI."
+                                          : "Failed to add spool.\nPlease try again.");
+    }
+    free(req);
+}
+
+static void add_spool_click_handler(lv_event_t *e) {
+    (void)e;
+    ESP_LOGI(TAG, "Add Spool clicked");
+
+    // Get current weight
+    float weight = scale_get_weight();
+    bool scale_ok = scale_is_initialized();
+    int weight_current = scale_ok ? (int)weight : 0;
+    if (weight_current >= -20 && weight_current <= 20) weight_current = 0;
+
+    spool_add_request_t *req = calloc(1, sizeof(*req));
+    if (!req) return;
+    req->generation = popup_generation;
+    strncpy(req->tag_id, (const char*)popup_tag_uid, sizeof(req->tag_id) - 1);
+    req->weight = weight_current;
+
+    if (!ui_async_submit(spool_add_work, spool_add_done, req)) {
+        free(req);
+        show_success_overlay("Busy.\nPlease try again.");
+        return;
+    }
+    show_popup_status("Adding spool...");
 }
 
 static void link_spool_click_handler(lv_event_t *e) {
@@ -689,8 +852,10 @@ static void close_popup(void) {
     if (tag_popup) {
         lv_obj_delete(tag_popup);
         tag_popup = NULL;
+        popup_generation++;     // Pending ui_async results are dropped
         popup_tag_label = NULL;
         popup_weight_label = NULL;
+        ui_mem_modal_closed(UI_MEM_MODAL_NFC_POPUP);
     }
 }
 
@@ -703,12 +868,7 @@ static void success_overlay_timer_cb(lv_timer_t *timer) {
     lv_timer_delete(timer);
 
     // Close the main popup
-    if (tag_popup) {
-        lv_obj_delete(tag_popup);
-        tag_popup = NULL;
-        popup_tag_label = NULL;
-        popup_weight_label = NULL;
-    }
+    close_popup();
     popup_user_closed = true;
     // Remember which tag was dismissed (survives brief NFC reader glitches)
     strncpy(dismissed_tag_uid, (char*)popup_tag_uid, sizeof(dismissed_tag_uid) - 1);
@@ -760,6 +920,29 @@ static void show_success_overlay(const char *message) {
     lv_timer_create(success_overlay_timer_cb, 2000, tag_popup);
 }
 
+// Replace the popup card with a plain message while a request runs
+static void show_popup_status(const char *text) {
+    if (!tag_popup) return;
+    lv_obj_clean(tag_popup);
+
+    lv_obj_t *card = lv_obj_create(tag_popup);
+    lv_obj_set_size(card, 350, 120);
+    lv_obj_center(card);
+    lv_obj_set_style_bg_color(card, lv_color_hex(0x1a1a1a), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(card, 255, LV_PART_MAIN);
+    lv_obj_set_style_border_color(card, lv_color_hex(0x666666), LV_PART_MAIN);
+    lv_obj_set_style_border_width(card, 2, LV_PART_MAIN);
+    lv_obj_set_style_radius(card, 12, LV_PART_MAIN);
+    lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *label = lv_label_create(card);
+    lv_label_set_text(label, text);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_16, LV_PART_MAIN);
+    lv_obj_set_style_text_color(label, lv_color_hex(0x888888), LV_PART_MAIN);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    lv_obj_center(label);
+}
+
 // ============================================================================
 // Link spool popup - shows list of untagged spools to select from
 // ============================================================================
@@ -772,6 +955,19 @@ static void link_popup_close_handler(lv_event_t *e) {
     }
 }
 
+// Worker: link the tag to the chosen spool
+// result: 0 = success, -1 = connection error, 409 = already assigned, other = server error
+static void link_work(void *ctx) {
+    link_request_t *req = ctx;
+    req->result = spool_link_tag(req->spool.id, req->tag_id, "generic");
+    if (req->result == 0) {
+        ui_spool_cache_invalidate_tag(req->tag_id);
+        ui_spool_cache_invalidate_spool(req->spool.id);
+    }
+}
+
+static void link_done(void *ctx);
+
 static void spool_item_click_handler(lv_event_t *e) {
     int spool_index = (int)(intptr_t)lv_event_get_user_data(e);
 
@@ -784,9 +980,11 @@ static void spool_item_click_handler(lv_event_t *e) {
     ESP_LOGI(TAG, "Linking tag %s to spool %s (%s %s)",
              popup_tag_uid, spool->id, spool->brand, spool->material);
 
-    // Link the tag to this spool
-    // Returns: 0 = success, -1 = connection error, 409 = already assigned, other = server error
-    int result = spool_link_tag(spool->id, (const char*)popup_tag_uid, "generic");
+    link_request_t *req = calloc(1, sizeof(*req));
+    if (!req) return;
+    req->generation = popup_generation;
+    strncpy(req->tag_id, (const char*)popup_tag_uid, sizeof(req->tag_id) - 1);
+    req->spool = *spool;
 
     // Close link popup
     if (link_popup) {
@@ -794,6 +992,23 @@ static void spool_item_click_handler(lv_event_t *e) {
         link_popup = NULL;
     }
 
+    if (!ui_async_submit(link_work, link_done, req)) {
+        free(req);
+        show_success_overlay("Busy.\nPlease try again.");
+        return;
+    }
+    show_popup_status("Linking tag...");
+}
+
+static void link_done(void *ctx) {
+    link_request_t *req = ctx;
+    if (!tag_popup || req->generation != popup_generation) {
+        free(req);
+        return;
+    }
+
+    int result = req->result;
+    const UntaggedSpoolInfo *spool = &req->spool;
     if (result == 0) {
         char msg[128];
         snprintf(msg, sizeof(msg), "Tag Linked!\n%s %s", spool->brand, spool->material);
@@ -807,19 +1022,50 @@ static void spool_item_click_handler(lv_event_t *e) {
         snprintf(msg, sizeof(msg), "Server error (%d).\nPlease try again.", result);
         show_success_overlay(msg);
     }
+    free(req);
 }
 
-static void show_link_spool_popup(void) {
-    if (link_popup) return;  // Already open
+// Worker: fetch the untagged spools
+static void untagged_list_work(void *ctx) {
+    untagged_list_request_t *req = ctx;
+    req->count = spool_get_untagged_list(req->spools, 20);
+}
 
-    // Fetch untagged spools
-    untagged_spools_count = spool_get_untagged_list(untagged_spools, 20);
-    ESP_LOGI(TAG, "Found %d untagged spools", untagged_spools_count);
+static void build_link_spool_popup(void);
+
+// LVGL thread: open the list unless the tag popup was closed meanwhile
+static void untagged_list_done(void *ctx) {
+    untagged_list_request_t *req = ctx;
+    untagged_list_loading = false;
+    if (tag_popup && req->generation == popup_generation) {
+        untagged_spools_count = req->count > 0 ? req->count : 0;
+        memcpy(untagged_spools, req->spools, untagged_spools_count * sizeof(UntaggedSpoolInfo));
+        ESP_LOGI(TAG, "Found %d untagged spools", untagged_spools_count);
+        if (untagged_spools_count == 0) {
+            ESP_LOGW(TAG, "No untagged spools available");
+        } else {
+            build_link_spool_popup();
+        }
+    }
+    free(req);
+}
 
-    if (untagged_spools_count == 0) {
-        ESP_LOGW(TAG, "No untagged spools available");
+static void show_link_spool_popup(void) {
+    if (link_popup || untagged_list_loading) return;  // Already open or loading
+
+    untagged_list_request_t *req = calloc(1, sizeof(*req));
+    if (!req) return;
+    req->generation = popup_generation;
+    if (!ui_async_submit(untagged_list_work, untagged_list_done, req)) {
+        ESP_LOGW(TAG, "Busy - untagged spools not fetched");
+        free(req);
         return;
     }
+    untagged_list_loading = true;
+}
+
+static void build_link_spool_popup(void) {
+    if (link_popup) return;  // Already open
 
     // Create modal overlay
     link_popup = lv_obj_create(lv_layer_top());
@@ -922,21 +1168,21 @@ static void show_link_spool_popup(void) {
 // Material subtype
 extern const char* nfc_get_tag_material_subtype(void);
 
-// Create the tag detected popup - two views based on inventory status
-static void create_tag_popup(void) {
-    if (tag_popup) return;  // Already open
-
-    ESP_LOGI(TAG, "Creating tag popup");
-
-    // Get tag UID and store it
-    uint8_t uid_str[32];
-    nfc_get_uid_hex(uid_str, sizeof(uid_str));
-    strncpy((char*)popup_tag_uid, (char*)uid_str, sizeof(popup_tag_uid) - 1);
-    popup_tag_uid[sizeof(popup_tag_uid) - 1] = '\0';
+// Worker: inventory lookup for the tag popup (cache miss = HTTP request)
+static void popup_lookup_work(void *ctx) {
+    popup_lookup_t *lookup = ctx;
+    lookup->in_inventory = ui_spool_cache_get_by_tag(lookup->uid, &lookup->spool);
+    if (!lookup->in_inventory) {
+        lookup->untagged_count = spool_get_untagged_count();
+    }
+}
 
-    // Check if tag is in inventory FIRST
-    bool tag_in_inventory = spool_exists_by_tag((const char*)uid_str);
-    int untagged_count = spool_get_untagged_count();
+// Build the popup card - two views based on inventory status
+static void build_tag_popup_card(const popup_lookup_t *lookup) {
+    bool tag_in_inventory = lookup->in_inventory;
+    const SpoolInfoC *spool_info = &lookup->spool;
+    int untagged_count = lookup->untagged_count;
+    const char *uid_str = lookup->uid;
 
     ESP_LOGI(TAG, "Tag %s: in_inventory=%d, untagged_count=%d", uid_str, tag_in_inventory, untagged_count);
 
@@ -944,18 +1190,6 @@ static void create_tag_popup(void) {
     float weight = scale_get_weight();
     bool scale_ok = scale_is_initialized();
 
-    // Create modal background (semi-transparent overlay)
-    tag_popup = lv_obj_create(lv_layer_top());
-    lv_obj_set_size(tag_popup, 800, 480);
-    lv_obj_set_pos(tag_popup, 0, 0);
-    lv_obj_set_style_bg_color(tag_popup, lv_color_hex(0x000000), LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(tag_popup, 180, LV_PART_MAIN);
-    lv_obj_set_style_border_width(tag_popup, 0, LV_PART_MAIN);
-    lv_obj_clear_flag(tag_popup, LV_OBJ_FLAG_SCROLLABLE);
-
-    // Click on background closes popup
-    lv_obj_add_event_cb(tag_popup, popup_close_handler, LV_EVENT_CLICKED, NULL);
-
     // Create popup card (centered)
     lv_obj_t *card = lv_obj_create(tag_popup);
     lv_obj_set_size(card, 450, tag_in_inventory ? 300 : 250);
@@ -981,10 +1215,6 @@ static void create_tag_popup(void) {
         // VIEW 1: Tag found in inventory - show spool details
         // =====================================================================
 
-        // Get spool data from inventory (not from NFC tag)
-        SpoolInfoLocal spool_info = {0};
-        spool_get_by_tag_local((const char*)uid_str, &spool_info);
-
         // Title - green for known spool
         lv_obj_t *title = lv_label_create(card);
         lv_label_set_text(title, "Spool Recognized");
@@ -1023,7 +1253,7 @@ static void create_tag_popup(void) {
         lv_obj_set_pos(spool_fill, 0, 0);
 
         // Color from inventory
-        uint32_t color_rgba = spool_info.color_rgba;
+        uint32_t color_rgba = spool_info->color_rgba;
         uint8_t r = (color_rgba >> 24) & 0xFF;
         uint8_t g = (color_rgba >> 16) & 0xFF;
         uint8_t b = (color_rgba >> 8) & 0xFF;
@@ -1074,9 +1304,9 @@ static void create_tag_popup(void) {
             snprintf(weight_str, sizeof(weight_str), "N/A");
         }
 
-        CREATE_DETAIL_ROW("Brand:", spool_info.brand[0] ? spool_info.brand : "Unknown");
-        CREATE_DETAIL_ROW("Material:", spool_info.material[0] ? spool_info.material : "Unknown");
-        CREATE_DETAIL_ROW("Color:", spool_info.color_name[0] ? spool_info.color_name : "Unknown");
+        CREATE_DETAIL_ROW("Brand:", spool_info->brand[0] ? spool_info->brand : "Unknown");
+        CREATE_DETAIL_ROW("Material:", spool_info->material[0] ? spool_info->material : "Unknown");
+        CREATE_DETAIL_ROW("Color:", spool_info->color_name[0] ? spool_info->color_name : "Unknown");
         CREATE_DETAIL_ROW("Weight:", weight_str);
 
         #undef CREATE_DETAIL_ROW
@@ -1225,6 +1455,57 @@ static void create_tag_popup(void) {
     }
 
     ESP_LOGI(TAG, "Tag popup created successfully");
+    ui_mem_modal_opened(UI_MEM_MODAL_NFC_POPUP);
+}
+
+// LVGL thread: replace the loading card unless the popup was closed meanwhile
+static void popup_lookup_done(void *ctx) {
+    popup_lookup_t *lookup = ctx;
+    if (tag_popup && lookup->generation == popup_generation) {
+        lv_obj_clean(tag_popup);
+        build_tag_popup_card(lookup);
+    }
+    free(lookup);
+}
+
+// Create the tag detected popup: overlay with a loading card, filled in once
+// the inventory lookup is done
+static void create_tag_popup(void) {
+    if (tag_popup) return;  // Already open
+
+    ESP_LOGI(TAG, "Creating tag popup");
+    ui_mem_modal_begin(UI_MEM_MODAL_NFC_POPUP);
+
+    // Get tag UID and store it
+    uint8_t uid_str[32];
+    nfc_get_uid_hex(uid_str, sizeof(uid_str));
+    strncpy((char*)popup_tag_uid, (char*)uid_str, sizeof(popup_tag_uid) - 1);
+    popup_tag_uid[sizeof(popup_tag_uid) - 1] = '\0';
+
+    // Create modal background (semi-transparent overlay)
+    tag_popup = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(tag_popup, 800, 480);
+    lv_obj_set_pos(tag_popup, 0, 0);
+    lv_obj_set_style_bg_color(tag_popup, lv_color_hex(0x000000), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(tag_popup, 180, LV_PART_MAIN);
+    lv_obj_set_style_border_width(tag_popup, 0, LV_PART_MAIN);
+    lv_obj_clear_flag(tag_popup, LV_OBJ_FLAG_SCROLLABLE);
+
+    // Click on background closes popup
+    lv_obj_add_event_cb(tag_popup, popup_close_handler, LV_EVENT_CLICKED, NULL);
+
+    popup_lookup_t *lookup = calloc(1, sizeof(*lookup));
+    if (lookup) {
+        lookup->generation = popup_generation;
+        strncpy(lookup->uid, (const char*)uid_str, sizeof(lookup->uid) - 1);
+        if (ui_async_submit(popup_lookup_work, popup_lookup_done, lookup)) {
+            show_popup_status("Reading spool...");
+            return;
+        }
+        free(lookup);
+    }
+    // Don't fallback to sync - the lookup would block rendering
+    show_popup_status("Busy - please try again");
 }
 
 // Update weight display in popup if open
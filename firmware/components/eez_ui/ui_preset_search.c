@@ -0,0 +1,160 @@
+/**
+ * @file ui_preset_search.c
+ * @brief Search index for slicer preset names
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#include "ui_preset_search.h"
+#include <ctype.h>
+#include <string.h>
+
+// PSRAM attribute for large arrays on ESP32
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#else
+#define EXT_RAM_BSS_ATTR
+#endif
+
+// Words of a query that are checked (more are ignored)
+#define MAX_QUERY_WORDS 8
+
+typedef struct {
+    char name[UI_PRESET_SEARCH_NAME_LEN];   // Lowercased
+    uint32_t chars;                         // Bit per character (see char_bit)
+    uint64_t bigrams;                       // Bit per character pair (see bigram_bit)
+} search_entry_t;
+
+typedef struct {
+    const char *text;
+    uint32_t chars;
+    uint64_t bigrams;
+} query_word_t;
+
+static EXT_RAM_BSS_ATTR search_entry_t entries[UI_PRESET_SEARCH_MAX_PRESETS];
+static int entry_count = 0;
+
+// Result of the last query, narrowed in place when the query is extended
+static int16_t results[UI_PRESET_SEARCH_MAX_PRESETS];
+static int result_count = 0;
+static char last_query[UI_PRESET_SEARCH_NAME_LEN];
+static bool last_valid = false;
+
+// =============================================================================
+// Signatures
+// =============================================================================
+
+// A word can only be a substring of a name whose signatures contain all of
+// the word's bits. Collisions only cost a strstr, never a wrong result.
+
+static inline uint32_t char_bit(unsigned char c) {
+    return 1u << (c & 31);
+}
+
+static inline uint64_t bigram_bit(unsigned char a, unsigned char b) {
+    return 1ull << ((a * 7u + b) & 63);
+}
+
+static void signature(const char *text, uint32_t *chars, uint64_t *bigrams) {
+    *chars = 0;
+    *bigrams = 0;
+    for (size_t i = 0; text[i]; i++) {
+        *chars |= char_bit((unsigned char)text[i]);
+        if (text[i + 1]) {
+            *bigrams |= bigram_bit((unsigned char)text[i], (unsigned char)text[i + 1]);
+        }
+    }
+}
+
+static void lowercase_copy(char *dst, const char *src, size_t size) {
+    size_t i = 0;
+    for (; src && src[i] && i < size - 1; i++) {
+        dst[i] = (char)tolower((unsigned char)src[i]);
+    }
+    dst[i] = '\0';
+}
+
+// =============================================================================
+// Index
+// =============================================================================
+
+void ui_preset_search_reset(void) {
+    entry_count = 0;
+    result_count = 0;
+    last_valid = false;
+}
+
+int ui_preset_search_add(const char *name) {
+    if (entry_count >= UI_PRESET_SEARCH_MAX_PRESETS) return -1;
+
+    search_entry_t *entry = &entries[entry_count];
+    lowercase_copy(entry->name, name, sizeof(entry->name));
+    signature(entry->name, &entry->chars, &entry->bigrams);
+    last_valid = false;
+    return entry_count++;
+}
+
+int ui_preset_search_count(void) {
+    return entry_count;
+}
+
+// =============================================================================
+// Query
+// =============================================================================
+
+static bool entry_matches(const search_entry_t *entry, const query_word_t *words, int word_count) {
+    for (int w = 0; w < word_count; w++) {
+        if ((words[w].chars & ~entry->chars) || (words[w].bigrams & ~entry->bigrams)) {
+            return false;
+        }
+        if (!strstr(entry->name, words[w].text)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int ui_preset_search_query(const char *query, const int16_t **out) {
+    char lower[UI_PRESET_SEARCH_NAME_LEN];
+    lowercase_copy(lower, query, sizeof(lower));
+
+    // Typing another character can only remove matches: every previous word is
+    // still contained in the corresponding (possibly longer) word
+    bool narrow = last_valid && strncmp(lower, last_query, strlen(last_query)) == 0;
+    memcpy(last_query, lower, sizeof(last_query));
+    last_valid = true;
+
+    // Split into words (in place) and compute their signatures once
+    query_word_t words[MAX_QUERY_WORDS];
+    int word_count = 0;
+    char *p = lower;
+    while (*p && word_count < MAX_QUERY_WORDS) {
+        while (*p == ' ') *p++ = '\0';
+        if (!*p) break;
+        words[word_count].text = p;
+        while (*p && *p != ' ') p++;
+        if (*p) *p++ = '\0';
+        signature(words[word_count].text, &words[word_count].chars, &words[word_count].bigrams);
+        word_count++;
+    }
+
+    if (narrow) {
+        int kept = 0;
+        for (int i = 0; i < result_count; i++) {
+            if (entry_matches(&entries[results[i]], words, word_count)) {
+                results[kept++] = results[i];
+            }
+        }
+        result_count = kept;
+    } else {
+        result_count = 0;
+        for (int i = 0; i < entry_count; i++) {
+            if (entry_matches(&entries[i], words, word_count)) {
+                results[result_count++] = (int16_t)i;
+            }
+        }
+    }
+
+    if (out) *out = results;
+    return result_count;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file ui_preset_search.h
+ * @brief Search index for slicer preset names
+ *
+ * Built once when the presets have been fetched. Names are stored lowercased
+ * together with a character and a bigram signature, so most presets that
+ * can't match a query word are rejected without a substring search. A query
+ * that extends the previous one (the user typed another character) only
+ * re-checks the previous result.
+ *
+ * Matching: every space separated query word must be a case-insensitive
+ * substring of the name (AND logic).
+ *
+ * Shared between firmware and simulator (no LVGL dependency).
+ */
+
+#ifndef UI_PRESET_SEARCH_H
+#define UI_PRESET_SEARCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Presets the index can hold
+#ifndef UI_PRESET_SEARCH_MAX_PRESETS
+#define UI_PRESET_SEARCH_MAX_PRESETS 500
+#endif
+
+// Longest indexed name / query including the terminator (SlicerPreset.name)
+#define UI_PRESET_SEARCH_NAME_LEN 64
+
+/**
+ * Drop all indexed names
+ */
+void ui_preset_search_reset(void);
+
+/**
+ * Index a name; indices are assigned in call order starting at 0
+ * @return Index of the name, -1 if the index is full
+ */
+int ui_preset_search_add(const char *name);
+
+/**
+ * Number of indexed names
+ */
+int ui_preset_search_count(void);
+
+/**
+ * Find the names matching a query (NULL or empty matches everything)
+ * @param results Set to the matching indices in ascending order; valid until
+ *                the next query, add or reset
+ * @return Number of matches
+ */
+int ui_preset_search_query(const char *query, const int16_t **results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_PRESET_SEARCH_H */
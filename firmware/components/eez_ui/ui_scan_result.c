@@ -5,6 +5,8 @@
 
 #include "screens.h"
 #include "lvgl.h"
+#include "ui_ams_strip.h"
+#include "ui_spool_cache.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -28,9 +30,6 @@ extern void ui_nfc_card_set_configured_tag(const char *tag_id);
 
 // Accent green color - matches progress bar (#00FF00)
 #define ACCENT_GREEN 0x00FF00
-#define SLOT_BORDER_DEFAULT 0x555555
-#define SLOT_BORDER_WIDTH_DEFAULT 2
-#define SLOT_BORDER_WIDTH_SELECTED 3
 
 // External scale functions
 extern float scale_get_weight(void);
@@ -49,7 +48,7 @@ extern int32_t nfc_get_tag_spool_weight(void);
 // Currently selected AMS slot for encoding
 static int selected_ams_id = -1;      // AMS unit ID (-1 = none)
 static int selected_slot_index = -1;  // Slot index within AMS (0-3)
-static lv_obj_t *selected_slot_obj = NULL;  // Currently selected slot object
+static lv_obj_t *selected_strip = NULL;     // Strip showing the selection
 
 // Pre-set tag ID (set before navigating to this screen to avoid race conditions)
 static char preset_tag_id[32] = {0};
@@ -87,43 +86,29 @@ static lv_color_t rgba_to_lv_color(uint32_t rgba) {
     return lv_color_make(r, g, b);
 }
 
-// Clear selection highlight from a slot (restore default border)
-static void clear_slot_selection(lv_obj_t *slot) {
-    if (!slot) return;
-    lv_obj_set_style_border_width(slot, SLOT_BORDER_WIDTH_DEFAULT, LV_PART_MAIN);
-    lv_obj_set_style_border_color(slot, lv_color_hex(SLOT_BORDER_DEFAULT), LV_PART_MAIN);
-}
-
-// Apply selection highlight to a slot
-static void apply_slot_selection(lv_obj_t *slot) {
-    if (!slot) return;
-    lv_obj_set_style_border_width(slot, SLOT_BORDER_WIDTH_SELECTED, LV_PART_MAIN);
-    lv_obj_set_style_border_color(slot, lv_color_hex(ACCENT_GREEN), LV_PART_MAIN);
-}
-
 // Forward declaration
 static void update_assign_button_state(void);
 
-// Slot click handler - stores the selected slot for encoding
-static void slot_click_handler(lv_event_t *e) {
-    lv_obj_t *slot = lv_event_get_target(e);
+// Strip click handler - stores the selected slot for encoding
+static void strip_click_handler(lv_event_t *e) {
+    lv_obj_t *strip = lv_event_get_target(e);
     int32_t ams_id = (int32_t)(intptr_t)lv_event_get_user_data(e);
 
-    // Find which slot index was clicked (stored in object's user data)
-    int slot_idx = (int)(intptr_t)lv_obj_get_user_data(slot);
+    int slot_idx = ui_ams_strip_get_pressed_slot(strip);
+    if (slot_idx < 0) return;  // Between slots
 
     // Clear previous selection
-    if (selected_slot_obj) {
-        clear_slot_selection(selected_slot_obj);
+    if (selected_strip && selected_strip != strip) {
+        ui_ams_strip_set_active(selected_strip, -1);
     }
 
     // Set new selection
     selected_ams_id = ams_id;
     selected_slot_index = slot_idx;
-    selected_slot_obj = slot;
+    selected_strip = strip;
 
     // Apply visual highlight
-    apply_slot_selection(slot);
+    ui_ams_strip_set_active(strip, slot_idx);
 
     // Enable assign button now that a slot is selected
     update_assign_button_state();
@@ -131,55 +116,6 @@ static void slot_click_handler(lv_event_t *e) {
     ESP_LOGI("ui_scan_result", "Selected AMS %d, slot %d for encoding", (int)ams_id, slot_idx);
 }
 
-// Helper to set up a single slot with proper border
-static void setup_slot(lv_obj_t *slot, int ams_id, int slot_idx, AmsTrayCInfo *tray) {
-    if (!slot) return;
-
-    // Store slot index in user data for click handler
-    lv_obj_set_user_data(slot, (void*)(intptr_t)slot_idx);
-
-    // Remove any existing click callbacks to prevent accumulation
-    lv_obj_remove_event_cb(slot, slot_click_handler);
-
-    // Clear any existing children (stripe objects from previous state)
-    lv_obj_clean(slot);
-
-    // Make clickable
-    lv_obj_add_flag(slot, LV_OBJ_FLAG_CLICKABLE);
-    lv_obj_add_event_cb(slot, slot_click_handler, LV_EVENT_CLICKED, (void*)(intptr_t)ams_id);
-
-    // Set color from tray data
-    // Empty slot if: no tray, empty tray_type, or color is 0 (transparent)
-    // Note: 0xFFFFFFFF (white) is a valid filament color, not empty
-    bool is_empty = !tray || tray->tray_type[0] == '\0' || tray->tray_color == 0;
-
-    if (!is_empty) {
-        lv_obj_set_style_bg_color(slot, rgba_to_lv_color(tray->tray_color), LV_PART_MAIN);
-        lv_obj_set_style_bg_opa(slot, 255, LV_PART_MAIN);
-    } else {
-        // Empty slot - darker background with striping pattern
-        lv_obj_set_style_bg_color(slot, lv_color_hex(0x2a2a2a), LV_PART_MAIN);
-        lv_obj_set_style_bg_opa(slot, 255, LV_PART_MAIN);
-
-        // Add 3 diagonal stripe rectangles for visual indication of empty slot
-        for (int i = 0; i < 3; i++) {
-            lv_obj_t *stripe = lv_obj_create(slot);
-            lv_obj_remove_style_all(stripe);
-            lv_obj_set_size(stripe, 48, 3);  // Fixed width to cover slot
-            lv_obj_set_pos(stripe, -4, 8 + i * 12);
-            lv_obj_set_style_bg_color(stripe, lv_color_hex(0x3a3a3a), 0);
-            lv_obj_set_style_bg_opa(stripe, 255, 0);
-            lv_obj_set_style_transform_rotation(stripe, -200, 0);  // Slight angle
-            lv_obj_clear_flag(stripe, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-        }
-    }
-
-    // Set default border (gray, visible)
-    lv_obj_set_style_border_width(slot, SLOT_BORDER_WIDTH_DEFAULT, LV_PART_MAIN);
-    lv_obj_set_style_border_color(slot, lv_color_hex(SLOT_BORDER_DEFAULT), LV_PART_MAIN);
-    lv_obj_set_style_border_opa(slot, 255, LV_PART_MAIN);
-}
-
 // Indicator size constants
 #define INDICATOR_SIZE 16
 
@@ -221,43 +157,126 @@ static void update_extruder_indicator(lv_obj_t *indicator, int8_t extruder, bool
     }
 }
 
-// Helper to set up a single-slot AMS (HT or EXT)
-static void setup_single_slot_ams(lv_obj_t *container, lv_obj_t *slot, lv_obj_t *indicator,
-                                   int ams_id, AmsUnitCInfo *unit, bool is_dual_nozzle) {
-    if (!container) return;
+// AMS section panels, each drawn by one ui_ams_strip that replaces the EEZ
+// name label and slot objects of the panel (the L/R indicator stays)
+#define SCAN_AMS_PANELS 8
+#define SCAN_PANEL_EXT_R 7
+
+typedef struct {
+    int ams_id;
+    int slot_count;
+    int8_t empty_extruder;  // Indicator of an EXT panel without data (dual-nozzle)
+    const char *log_name;
+    lv_obj_t *panel;
+    lv_obj_t *label_name;   // EEZ name label, replaced by the strip
+    lv_obj_t *slots[UI_AMS_STRIP_MAX_SLOTS];  // EEZ slot objects, NULL once replaced
+    lv_obj_t *indicator;
+} scan_ams_panel_t;
+
+static lv_obj_t *scan_strips[SCAN_AMS_PANELS];
+
+// Current EEZ objects of the AMS panels
+static void get_scan_ams_panels(scan_ams_panel_t panels[SCAN_AMS_PANELS]) {
+    const scan_ams_panel_t table[SCAN_AMS_PANELS] = {
+        {0, 4, -1, "AMS A (id=0)", objects.scan_screen_main_panel_ams_panel_ams_a,
+         objects.scan_screen_main_panel_ams_panel_ams_a_label_name,
+         {objects.scan_screen_main_panel_ams_panel_ams_a_slot_1,
+          objects.scan_screen_main_panel_ams_panel_ams_a_slot_2,
+          objects.scan_screen_main_panel_ams_panel_ams_a_slot_3,
+          objects.scan_screen_main_panel_ams_panel_ams_a_slot_4},
+         objects.scan_screen_main_panel_ams_panel_ams_a_indicator},
+        {1, 4, -1, "AMS B (id=1)", objects.scan_screen_main_panel_ams_panel_ams_b,
+         objects.scan_screen_main_panel_ams_panel_ams_b_label_name,
+         {objects.scan_screen_main_panel_ams_panel_ams_b_slot_1,
+          objects.scan_screen_main_panel_ams_panel_ams_b_slot_2,
+          objects.scan_screen_main_panel_ams_panel_ams_b_slot_3,
+          objects.scan_screen_main_panel_ams_panel_ams_b_slot_4},
+         objects.scan_screen_main_panel_ams_panel_ams_b_indicator},
+        {2, 4, -1, "AMS C (id=2)", objects.scan_screen_main_panel_ams_panel_ams_c,
+         objects.scan_screen_main_panel_ams_panel_ams_c_label_name,
+         {objects.scan_screen_main_panel_ams_panel_ams_c_slot_1,
+          objects.scan_screen_main_panel_ams_panel_ams_c_slot_2,
+          objects.scan_screen_main_panel_ams_panel_ams_c_slot_3,
+          objects.scan_screen_main_panel_ams_panel_ams_c_slot_4},
+         objects.scan_screen_main_panel_ams_panel_ams_c_indicator},
+        {3, 4, -1, "AMS D (id=3)", objects.scan_screen_main_panel_ams_panel_ams_d,
+         objects.scan_screen_main_panel_ams_panel_ams_d_label_name,
+         {objects.scan_screen_main_panel_ams_panel_ams_d_slot_1,
+          objects.scan_screen_main_panel_ams_panel_ams_d_slot_2,
+          objects.scan_screen_main_panel_ams_panel_ams_d_slot_3,
+          objects.scan_screen_main_panel_ams_panel_ams_d_slot_4},
+         objects.scan_screen_main_panel_ams_panel_ams_d_indicator},
+        {128, 1, -1, "HT-A (id=128)", objects.scan_screen_main_panel_ams_panel_ht_a,
+         objects.scan_screen_main_panel_ams_panel_ht_a_label_name,
+         {objects.scan_screen_main_panel_ams_panel_ht_a_slot_color},
+         objects.scan_screen_main_panel_ams_panel_ht_a_indicator},
+        {129, 1, -1, "HT-B (id=129)", objects.scan_screen_main_panel_ams_panel_ht_b,
+         objects.scan_screen_main_panel_ams_panel_ht_b_label_name,
+         {objects.scan_screen_main_panel_ams_panel_ht_b_slot},
+         objects.scan_screen_main_panel_ams_panel_ht_b_indicator},
+        {254, 1, 1, "EXT-L (id=254)", objects.scan_screen_main_panel_ams_panel_ext_l,
+         objects.scan_screen_main_panel_ams_panel_ext_l_label_name,
+         {objects.scan_screen_main_panel_ams_panel_ext_l_slot},
+         objects.scan_screen_main_panel_ams_panel_ext_l_indicator},
+        {255, 1, 0, "EXT-R (id=255)", objects.scan_screen_main_panel_ams_panel_ext_r,
+         objects.scan_screen_main_panel_ams_panel_ext_r_label_name,
+         {objects.scan_screen_main_panel_ams_panel_ext_r_slot},
+         objects.scan_screen_main_panel_ams_panel_ext_r_indicator},
+    };
+    memcpy(panels, table, sizeof(table));
+}
+
+/**
+ * Strip of a panel, replacing the EEZ objects the first time the panel is
+ * set up. EEZ slot objects still present mean the screen was (re)created.
+ */
+static lv_obj_t *get_panel_strip(int index, const scan_ams_panel_t *panel) {
+    if (!panel->slots[0]) return scan_strips[index];
 
-    lv_obj_clear_flag(container, LV_OBJ_FLAG_HIDDEN);
+    // Keep the EEZ label text ("A", "HT-A", "EXT-L", ...)
+    char name[8] = "";
+    if (panel->label_name) {
+        snprintf(name, sizeof(name), "%s", lv_label_get_text(panel->label_name));
+    }
 
-    if (unit && unit->tray_count > 0) {
-        setup_slot(slot, ams_id, 0, &unit->trays[0]);
-        update_extruder_indicator(indicator, unit->extruder, is_dual_nozzle);
+    lv_obj_t *strip = ui_ams_strip_create(panel->panel, UI_AMS_STRIP_SCAN, panel->slot_count);
+    // Strip origin = EEZ name label position
+    if (panel->slot_count == 1) {
+        lv_obj_set_pos(strip, -14, -17);
     } else {
-        setup_slot(slot, ams_id, 0, NULL);
-        update_extruder_indicator(indicator, -1, is_dual_nozzle);
+        lv_obj_set_pos(strip, -11, -14);
     }
+    lv_obj_t *const replaced[] = {
+        panel->label_name, panel->slots[0], panel->slots[1], panel->slots[2], panel->slots[3],
+    };
+    ui_ams_strip_replace(strip, replaced, sizeof(replaced) / sizeof(replaced[0]));
+    ui_ams_strip_set_name(strip, name);
+
+    lv_obj_add_flag(strip, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(strip, strip_click_handler, LV_EVENT_CLICKED, (void*)(intptr_t)panel->ams_id);
+
+    scan_strips[index] = strip;
+    return strip;
 }
 
-// Helper to set up a 4-slot AMS (A, B, C, D)
-static void setup_quad_slot_ams(lv_obj_t *container, lv_obj_t *slots[4], lv_obj_t *indicator,
-                                 int ams_id, AmsUnitCInfo *unit, bool is_dual_nozzle) {
-    if (!container) return;
+// Show a panel with the unit's trays (unit NULL = no data, all slots empty)
+static void setup_ams_panel(int index, const scan_ams_panel_t *panel, const AmsUnitCInfo *unit,
+                            int8_t extruder, bool is_dual_nozzle) {
+    if (!panel->panel) return;
 
-    lv_obj_clear_flag(container, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(panel->panel, LV_OBJ_FLAG_HIDDEN);
+    update_extruder_indicator(panel->indicator, extruder, is_dual_nozzle);
 
-    // Update L/R indicator
-    update_extruder_indicator(indicator, unit ? unit->extruder : -1, is_dual_nozzle);
+    lv_obj_t *strip = get_panel_strip(index, panel);
+    for (int i = 0; i < panel->slot_count; i++) {
+        const AmsTrayCInfo *tray = (unit && i < unit->tray_count) ? &unit->trays[i] : NULL;
 
-    // Setup all 4 slots
-    for (int i = 0; i < 4; i++) {
-        if (slots[i]) {
-            lv_obj_clear_flag(slots[i], LV_OBJ_FLAG_HIDDEN);
-            if (unit && i < unit->tray_count) {
-                setup_slot(slots[i], ams_id, i, &unit->trays[i]);
-            } else {
-                setup_slot(slots[i], ams_id, i, NULL);
-            }
-        }
+        // Empty slot if: no tray, empty tray_type, or color is 0 (transparent)
+        // Note: 0xFFFFFFFF (white) is a valid filament color, not empty
+        bool is_empty = !tray || tray->tray_type[0] == '\0' || tray->tray_color == 0;
+        ui_ams_strip_set_slot(strip, i, is_empty ? 0 : tray->tray_color, NULL, NULL);
     }
+    ui_ams_strip_set_active(strip, -1);
 }
 
 // Hide all AMS panels
@@ -331,7 +350,7 @@ static void capture_tag_data(void) {
 
     // Try to look up spool in backend inventory first
     SpoolInfoC inventory_spool = {0};
-    captured_in_inventory = spool_get_by_tag(captured_tag_id, &inventory_spool);
+    captured_in_inventory = ui_spool_cache_get_by_tag(captured_tag_id, &inventory_spool);
 
     ESP_LOGI("ui_scan_result", "spool_get_by_tag('%s') returned %d, valid=%d",
              captured_tag_id, captured_in_inventory, inventory_spool.valid);
@@ -502,8 +521,8 @@ static void populate_spool_panel(void) {
             BackendPrinterInfo printer_info = {0};
             if (backend_get_printer(printer_idx, &printer_info) == 0 && printer_info.serial[0]) {
                 // Look up K-profile for this spool on this printer
-                k_profile_found = spool_get_k_profile_for_printer(captured_spool_id,
-                                                                   printer_info.serial, &k_profile);
+                k_profile_found = ui_spool_cache_get_k_profile(captured_spool_id,
+                                                               printer_info.serial, &k_profile);
                 ESP_LOGI("ui_scan_result", "K-profile lookup: spool=%s printer=%s found=%d",
                          captured_spool_id, printer_info.serial, k_profile_found);
             }
@@ -542,6 +561,33 @@ static bool find_and_setup_ams(int printer_idx, int ams_count, int target_id, Am
     return false;
 }
 
+// Show the panels of the printer's AMS units, plus the external slots
+// (EXT-L always, EXT-R on dual-nozzle printers)
+static void setup_ams_panels(int printer_idx, int ams_count, bool is_dual_nozzle) {
+    scan_ams_panel_t panels[SCAN_AMS_PANELS];
+    get_scan_ams_panels(panels);
+
+    // Process each AMS unit type - use single unit on stack (not array)
+    AmsUnitCInfo unit;
+
+    for (int p = 0; p < SCAN_AMS_PANELS; p++) {
+        const scan_ams_panel_t *panel = &panels[p];
+        bool is_ext = panel->ams_id >= 254;
+        if (p == SCAN_PANEL_EXT_R && !is_dual_nozzle) continue;
+
+        if (find_and_setup_ams(printer_idx, ams_count, panel->ams_id, &unit)) {
+            // Single-slot units without trays show no indicator
+            int8_t extruder = (panel->slot_count > 1 || unit.tray_count > 0) ? unit.extruder : -1;
+            setup_ams_panel(p, panel, &unit, extruder, is_dual_nozzle);
+            ESP_LOGI("ui_scan_result", "Setup %s, tray_count=%d", panel->log_name, unit.tray_count);
+        } else if (is_ext) {
+            // External slots are always shown, empty without data
+            setup_ams_panel(p, panel, NULL, is_dual_nozzle ? panel->empty_extruder : -1, is_dual_nozzle);
+            ESP_LOGI("ui_scan_result", "Setup %s empty", panel->log_name);
+        }
+    }
+}
+
 // Refresh only the AMS panels (called when printer changes, preserves tag data)
 void ui_scan_result_refresh_ams(void) {
     int printer_idx = get_selected_printer_index();
@@ -550,10 +596,10 @@ void ui_scan_result_refresh_ams(void) {
     // Reset slot selection (but NOT tag data)
     selected_ams_id = -1;
     selected_slot_index = -1;
-    if (selected_slot_obj) {
-        clear_slot_selection(selected_slot_obj);
+    if (selected_strip) {
+        ui_ams_strip_set_active(selected_strip, -1);
     }
-    selected_slot_obj = NULL;
+    selected_strip = NULL;
 
     // Disable assign button until slot is re-selected
     update_assign_button_state();
@@ -577,102 +623,7 @@ void ui_scan_result_refresh_ams(void) {
         lv_label_set_text(objects.scan_screen_main_panel_ams_panel_label, "Assign to AMS Slot");
     }
 
-    // Process each AMS unit type - use single unit on stack
-    AmsUnitCInfo unit;
-
-    // AMS A-D, HT-A/B, EXT setup (same code as ui_scan_result_init)
-    if (find_and_setup_ams(printer_idx, ams_count, 0, &unit)) {
-        lv_obj_t *slots[4] = {
-            objects.scan_screen_main_panel_ams_panel_ams_a_slot_1,
-            objects.scan_screen_main_panel_ams_panel_ams_a_slot_2,
-            objects.scan_screen_main_panel_ams_panel_ams_a_slot_3,
-            objects.scan_screen_main_panel_ams_panel_ams_a_slot_4
-        };
-        setup_quad_slot_ams(objects.scan_screen_main_panel_ams_panel_ams_a, slots,
-                            objects.scan_screen_main_panel_ams_panel_ams_a_indicator,
-                            0, &unit, is_dual_nozzle);
-    }
-    if (find_and_setup_ams(printer_idx, ams_count, 1, &unit)) {
-        lv_obj_t *slots[4] = {
-            objects.scan_screen_main_panel_ams_panel_ams_b_slot_1,
-            objects.scan_screen_main_panel_ams_panel_ams_b_slot_2,
-            objects.scan_screen_main_panel_ams_panel_ams_b_slot_3,
-            objects.scan_screen_main_panel_ams_panel_ams_b_slot_4
-        };
-        setup_quad_slot_ams(objects.scan_screen_main_panel_ams_panel_ams_b, slots,
-                            objects.scan_screen_main_panel_ams_panel_ams_b_indicator,
-                            1, &unit, is_dual_nozzle);
-    }
-    if (find_and_setup_ams(printer_idx, ams_count, 2, &unit)) {
-        lv_obj_t *slots[4] = {
-            objects.scan_screen_main_panel_ams_panel_ams_c_slot_1,
-            objects.scan_screen_main_panel_ams_panel_ams_c_slot_2,
-            objects.scan_screen_main_panel_ams_panel_ams_c_slot_3,
-            objects.scan_screen_main_panel_ams_panel_ams_c_slot_4
-        };
-        setup_quad_slot_ams(objects.scan_screen_main_panel_ams_panel_ams_c, slots,
-                            objects.scan_screen_main_panel_ams_panel_ams_c_indicator,
-                            2, &unit, is_dual_nozzle);
-    }
-    if (find_and_setup_ams(printer_idx, ams_count, 3, &unit)) {
-        lv_obj_t *slots[4] = {
-            objects.scan_screen_main_panel_ams_panel_ams_d_slot_1,
-            objects.scan_screen_main_panel_ams_panel_ams_d_slot_2,
-            objects.scan_screen_main_panel_ams_panel_ams_d_slot_3,
-            objects.scan_screen_main_panel_ams_panel_ams_d_slot_4
-        };
-        setup_quad_slot_ams(objects.scan_screen_main_panel_ams_panel_ams_d, slots,
-                            objects.scan_screen_main_panel_ams_panel_ams_d_indicator,
-                            3, &unit, is_dual_nozzle);
-    }
-    if (find_and_setup_ams(printer_idx, ams_count, 128, &unit)) {
-        setup_single_slot_ams(objects.scan_screen_main_panel_ams_panel_ht_a,
-                             objects.scan_screen_main_panel_ams_panel_ht_a_slot_color,
-                             objects.scan_screen_main_panel_ams_panel_ht_a_indicator,
-                             128, &unit, is_dual_nozzle);
-    }
-    if (find_and_setup_ams(printer_idx, ams_count, 129, &unit)) {
-        setup_single_slot_ams(objects.scan_screen_main_panel_ams_panel_ht_b,
-                             objects.scan_screen_main_panel_ams_panel_ht_b_slot,
-                             objects.scan_screen_main_panel_ams_panel_ht_b_indicator,
-                             129, &unit, is_dual_nozzle);
-    }
-
-    // External slots
-    bool has_ext_l = find_and_setup_ams(printer_idx, ams_count, 254, &unit);
-    if (is_dual_nozzle) {
-        if (has_ext_l) {
-            setup_single_slot_ams(objects.scan_screen_main_panel_ams_panel_ext_l,
-                                 objects.scan_screen_main_panel_ams_panel_ext_l_slot,
-                                 objects.scan_screen_main_panel_ams_panel_ext_l_indicator,
-                                 254, &unit, is_dual_nozzle);
-        } else if (objects.scan_screen_main_panel_ams_panel_ext_l) {
-            lv_obj_clear_flag(objects.scan_screen_main_panel_ams_panel_ext_l, LV_OBJ_FLAG_HIDDEN);
-            setup_slot(objects.scan_screen_main_panel_ams_panel_ext_l_slot, 254, 0, NULL);
-            update_extruder_indicator(objects.scan_screen_main_panel_ams_panel_ext_l_indicator, 1, is_dual_nozzle);
-        }
-        bool has_ext_r = find_and_setup_ams(printer_idx, ams_count, 255, &unit);
-        if (has_ext_r) {
-            setup_single_slot_ams(objects.scan_screen_main_panel_ams_panel_ext_r,
-                                 objects.scan_screen_main_panel_ams_panel_ext_r_slot,
-                                 objects.scan_screen_main_panel_ams_panel_ext_r_indicator,
-                                 255, &unit, is_dual_nozzle);
-        } else if (objects.scan_screen_main_panel_ams_panel_ext_r) {
-            lv_obj_clear_flag(objects.scan_screen_main_panel_ams_panel_ext_r, LV_OBJ_FLAG_HIDDEN);
-            setup_slot(objects.scan_screen_main_panel_ams_panel_ext_r_slot, 255, 0, NULL);
-            update_extruder_indicator(objects.scan_screen_main_panel_ams_panel_ext_r_indicator, 0, is_dual_nozzle);
-        }
-    } else {
-        if (has_ext_l) {
-            setup_single_slot_ams(objects.scan_screen_main_panel_ams_panel_ext_l,
-                                 objects.scan_screen_main_panel_ams_panel_ext_l_slot,
-                                 objects.scan_screen_main_panel_ams_panel_ext_l_indicator,
-                                 254, &unit, is_dual_nozzle);
-        } else if (objects.scan_screen_main_panel_ams_panel_ext_l) {
-            lv_obj_clear_flag(objects.scan_screen_main_panel_ams_panel_ext_l, LV_OBJ_FLAG_HIDDEN);
-            setup_slot(objects.scan_screen_main_panel_ams_panel_ext_l_slot, 254, 0, NULL);
-        }
-    }
+    setup_ams_panels(printer_idx, ams_count, is_dual_nozzle);
 }
 
 // Initialize the scan result screen with dynamic AMS data
@@ -683,7 +634,7 @@ void ui_scan_result_init(void) {
     // Reset selection state
     selected_ams_id = -1;
     selected_slot_index = -1;
-    selected_slot_obj = NULL;
+    selected_strip = NULL;
 
     // Capture tag data (freeze it for this screen session)
     capture_tag_data();
@@ -717,130 +668,7 @@ void ui_scan_result_init(void) {
         lv_label_set_text(objects.scan_screen_main_panel_ams_panel_label, "Assign to AMS Slot");
     }
 
-    // Process each AMS unit type - use single unit on stack (not array)
-    AmsUnitCInfo unit;
-
-    // AMS A (ID 0)
-    if (find_and_setup_ams(printer_idx, ams_count, 0, &unit)) {
-        lv_obj_t *slots[4] = {
-            objects.scan_screen_main_panel_ams_panel_ams_a_slot_1,
-            objects.scan_screen_main_panel_ams_panel_ams_a_slot_2,
-            objects.scan_screen_main_panel_ams_panel_ams_a_slot_3,
-            objects.scan_screen_main_panel_ams_panel_ams_a_slot_4
-        };
-        setup_quad_slot_ams(objects.scan_screen_main_panel_ams_panel_ams_a, slots,
-                            objects.scan_screen_main_panel_ams_panel_ams_a_indicator,
-                            0, &unit, is_dual_nozzle);
-        ESP_LOGI("ui_scan_result", "Setup AMS A (id=0), tray_count=%d", unit.tray_count);
-    }
-
-    // AMS B (ID 1)
-    if (find_and_setup_ams(printer_idx, ams_count, 1, &unit)) {
-        lv_obj_t *slots[4] = {
-            objects.scan_screen_main_panel_ams_panel_ams_b_slot_1,
-            objects.scan_screen_main_panel_ams_panel_ams_b_slot_2,
-            objects.scan_screen_main_panel_ams_panel_ams_b_slot_3,
-            objects.scan_screen_main_panel_ams_panel_ams_b_slot_4
-        };
-        setup_quad_slot_ams(objects.scan_screen_main_panel_ams_panel_ams_b, slots,
-                            objects.scan_screen_main_panel_ams_panel_ams_b_indicator,
-                            1, &unit, is_dual_nozzle);
-        ESP_LOGI("ui_scan_result", "Setup AMS B (id=1), tray_count=%d", unit.tray_count);
-    }
-
-    // AMS C (ID 2)
-    if (find_and_setup_ams(printer_idx, ams_count, 2, &unit)) {
-        lv_obj_t *slots[4] = {
-            objects.scan_screen_main_panel_ams_panel_ams_c_slot_1,
-            objects.scan_screen_main_panel_ams_panel_ams_c_slot_2,
-            objects.scan_screen_main_panel_ams_panel_ams_c_slot_3,
-            objects.scan_screen_main_panel_ams_panel_ams_c_slot_4
-        };
-        setup_quad_slot_ams(objects.scan_screen_main_panel_ams_panel_ams_c, slots,
-                            objects.scan_screen_main_panel_ams_panel_ams_c_indicator,
-                            2, &unit, is_dual_nozzle);
-        ESP_LOGI("ui_scan_result", "Setup AMS C (id=2), tray_count=%d", unit.tray_count);
-    }
-
-    // AMS D (ID 3)
-    if (find_and_setup_ams(printer_idx, ams_count, 3, &unit)) {
-        lv_obj_t *slots[4] = {
-            objects.scan_screen_main_panel_ams_panel_ams_d_slot_1,
-            objects.scan_screen_main_panel_ams_panel_ams_d_slot_2,
-            objects.scan_screen_main_panel_ams_panel_ams_d_slot_3,
-            objects.scan_screen_main_panel_ams_panel_ams_d_slot_4
-        };
-        setup_quad_slot_ams(objects.scan_screen_main_panel_ams_panel_ams_d, slots,
-                            objects.scan_screen_main_panel_ams_panel_ams_d_indicator,
-                            3, &unit, is_dual_nozzle);
-        ESP_LOGI("ui_scan_result", "Setup AMS D (id=3), tray_count=%d", unit.tray_count);
-    }
-
-    // HT-A (ID 128)
-    if (find_and_setup_ams(printer_idx, ams_count, 128, &unit)) {
-        setup_single_slot_ams(objects.scan_screen_main_panel_ams_panel_ht_a,
-                             objects.scan_screen_main_panel_ams_panel_ht_a_slot_color,
-                             objects.scan_screen_main_panel_ams_panel_ht_a_indicator,
-                             128, &unit, is_dual_nozzle);
-        ESP_LOGI("ui_scan_result", "Setup HT-A (id=128)");
-    }
-
-    // HT-B (ID 129)
-    if (find_and_setup_ams(printer_idx, ams_count, 129, &unit)) {
-        setup_single_slot_ams(objects.scan_screen_main_panel_ams_panel_ht_b,
-                             objects.scan_screen_main_panel_ams_panel_ht_b_slot,
-                             objects.scan_screen_main_panel_ams_panel_ht_b_indicator,
-                             129, &unit, is_dual_nozzle);
-        ESP_LOGI("ui_scan_result", "Setup HT-B (id=129)");
-    }
-
-    // External slots - always show based on printer type
-    bool has_ext_l = find_and_setup_ams(printer_idx, ams_count, 254, &unit);
-    if (is_dual_nozzle) {
-        // Dual-nozzle: show EXT-L and EXT-R
-        if (has_ext_l) {
-            setup_single_slot_ams(objects.scan_screen_main_panel_ams_panel_ext_l,
-                                 objects.scan_screen_main_panel_ams_panel_ext_l_slot,
-                                 objects.scan_screen_main_panel_ams_panel_ext_l_indicator,
-                                 254, &unit, is_dual_nozzle);
-            ESP_LOGI("ui_scan_result", "Setup EXT-L (id=254) with data");
-        } else if (objects.scan_screen_main_panel_ams_panel_ext_l) {
-            // Show empty EXT-L
-            lv_obj_clear_flag(objects.scan_screen_main_panel_ams_panel_ext_l, LV_OBJ_FLAG_HIDDEN);
-            setup_slot(objects.scan_screen_main_panel_ams_panel_ext_l_slot, 254, 0, NULL);
-            update_extruder_indicator(objects.scan_screen_main_panel_ams_panel_ext_l_indicator, 1, is_dual_nozzle);
-            ESP_LOGI("ui_scan_result", "Setup EXT-L (id=254) empty");
-        }
-
-        bool has_ext_r = find_and_setup_ams(printer_idx, ams_count, 255, &unit);
-        if (has_ext_r) {
-            setup_single_slot_ams(objects.scan_screen_main_panel_ams_panel_ext_r,
-                                 objects.scan_screen_main_panel_ams_panel_ext_r_slot,
-                                 objects.scan_screen_main_panel_ams_panel_ext_r_indicator,
-                                 255, &unit, is_dual_nozzle);
-            ESP_LOGI("ui_scan_result", "Setup EXT-R (id=255) with data");
-        } else if (objects.scan_screen_main_panel_ams_panel_ext_r) {
-            // Show empty EXT-R
-            lv_obj_clear_flag(objects.scan_screen_main_panel_ams_panel_ext_r, LV_OBJ_FLAG_HIDDEN);
-            setup_slot(objects.scan_screen_main_panel_ams_panel_ext_r_slot, 255, 0, NULL);
-            update_extruder_indicator(objects.scan_screen_main_panel_ams_panel_ext_r_indicator, 0, is_dual_nozzle);
-            ESP_LOGI("ui_scan_result", "Setup EXT-R (id=255) empty");
-        }
-    } else {
-        // Single-nozzle: show EXT (using EXT-L panel)
-        if (has_ext_l) {
-            setup_single_slot_ams(objects.scan_screen_main_panel_ams_panel_ext_l,
-                                 objects.scan_screen_main_panel_ams_panel_ext_l_slot,
-                                 objects.scan_screen_main_panel_ams_panel_ext_l_indicator,
-                                 254, &unit, is_dual_nozzle);
-            ESP_LOGI("ui_scan_result", "Setup EXT (id=254) with data");
-        } else if (objects.scan_screen_main_panel_ams_panel_ext_l) {
-            // Show empty EXT
-            lv_obj_clear_flag(objects.scan_screen_main_panel_ams_panel_ext_l, LV_OBJ_FLAG_HIDDEN);
-            setup_slot(objects.scan_screen_main_panel_ams_panel_ext_l_slot, 254, 0, NULL);
-            ESP_LOGI("ui_scan_result", "Setup EXT (id=254) empty");
-        }
-    }
+    setup_ams_panels(printer_idx, ams_count, is_dual_nozzle);
 
     ESP_LOGI("ui_scan_result", "ui_scan_result_init complete");
 }
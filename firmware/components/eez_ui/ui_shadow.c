@@ -0,0 +1,363 @@
+/**
+ * @file ui_shadow.c
+ * @brief Pre-rendered box shadows
+ *
+ * Same geometry as LVGL's software shadow: the object area grown by the
+ * spread is the core, blurred with a box of shadow_width px, radius clamped
+ * to half the core's short side. Only one corner is rendered (4x4
+ * supersampled, then box blurred); the bands are assembled from it by
+ * mirroring, since past the corner every row of a band is the same edge
+ * profile. Inside the bands the shadow is solid and drawn as a rect, and
+ * only where the object's background doesn't cover it.
+ *
+ * Shapes are kept for the lifetime of the program. The same shapes repeat
+ * on every screen (AMS containers, panels), so the cache stays small.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#include "ui_shadow.h"
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+
+static const char *TAG = "ui_shadow";
+
+// Distinct shapes and total band memory; shapes beyond either stay with LVGL
+#define UI_SHADOW_MAX_SHAPES 16
+#define UI_SHADOW_CACHE_BYTES (32 * 1024)
+
+// Samples per pixel and axis for the anti-aliased core corner
+#define SHADOW_SUBSAMPLES 4
+
+typedef struct {
+    // Key
+    int32_t w, h;               // Object size
+    int32_t radius;             // Clamped to the core like LVGL does
+    int32_t width;
+    int32_t spread;
+    // Geometry, relative to the core grown by pad on every side
+    int32_t pad;                // Blur extent outside the core
+    int32_t band;               // Band thickness, solid shadow inside
+    int32_t canvas_w, canvas_h;
+    // A8 bands, one allocation at top.data. Top/bottom are canvas_w wide,
+    // left/right fill the height between them.
+    lv_image_dsc_t top, bottom, left, right;
+} shadow_shape_t;
+
+// Per baked object, user data of its event callback
+typedef struct {
+    const shadow_shape_t *shape;  // NULL = no shape fits, LVGL draws the shadow
+    int32_t width;                // Shadow width of the styles
+} baked_shadow_t;
+
+static shadow_shape_t shapes[UI_SHADOW_MAX_SHAPES];
+static int shape_count = 0;
+static uint32_t cache_bytes = 0;
+
+// =============================================================================
+// Shape cache
+// =============================================================================
+
+static bool in_core(float x, float y, int32_t pad, int32_t r) {
+    if (x < pad || y < pad) return false;
+    float c = (float)(pad + r);
+    if (x >= c || y >= c) return true;
+    return (x - c) * (x - c) + (y - c) * (y - c) <= (float)r * r;
+}
+
+/* Top-left band x band corner of the canvas: core coverage, box blurred */
+static bool render_corner(const shadow_shape_t *s, uint8_t *corner) {
+    int32_t b = s->band;
+    int32_t k = s->width > 1 ? s->width : 1;
+    int32_t half = (k - 1) / 2;
+    int32_t n = b + k - 1;
+
+    uint8_t *cov = malloc(n * n);
+    if (!cov) return false;
+
+    const int ss = SHADOW_SUBSAMPLES;
+    for (int32_t v = 0; v < n; v++) {
+        for (int32_t u = 0; u < n; u++) {
+            int hits = 0;
+            for (int sy = 0; sy < ss; sy++) {
+                for (int sx = 0; sx < ss; sx++) {
+                    float px = u - half + (sx + 0.5f) / ss;
+                    float py = v - half + (sy + 0.5f) / ss;
+                    if (in_core(px, py, s->pad, s->radius)) hits++;
+                }
+            }
+            cov[v * n + u] = (uint8_t)(hits * 255 / (ss * ss));
+        }
+    }
+
+    for (int32_t y = 0; y < b; y++) {
+        for (int32_t x = 0; x < b; x++) {
+            uint32_t sum = 0;
+            for (int32_t j = 0; j < k; j++) {
+                for (int32_t i = 0; i < k; i++) sum += cov[(y + j) * n + x + i];
+            }
+            corner[y * b + x] = (uint8_t)(sum / (k * k));
+        }
+    }
+    free(cov);
+    return true;
+}
+
+static void init_a8(lv_image_dsc_t *dsc, uint8_t *data, int32_t w, int32_t h) {
+    dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
+    dsc->header.cf = LV_COLOR_FORMAT_A8;
+    dsc->header.w = w;
+    dsc->header.h = h;
+    dsc->header.stride = w;  // A8 = 1 byte per pixel
+    dsc->data_size = w * h;
+    dsc->data = data;
+}
+
+static bool build_bands(shadow_shape_t *s) {
+    int32_t b = s->band;
+    int32_t w = s->canvas_w;
+    int32_t mid = s->canvas_h - 2 * b;
+    uint32_t size = 2 * w * b + 2 * b * mid;
+
+    if (cache_bytes + size > UI_SHADOW_CACHE_BYTES) {
+        ESP_LOGW(TAG, "Cache full, %dx%d shadow left to LVGL", (int)s->w, (int)s->h);
+        return false;
+    }
+
+    uint8_t *corner = malloc(b * b);
+    uint8_t *data = malloc(size);
+    if (!corner || !data || !render_corner(s, corner)) {
+        free(corner);
+        free(data);
+        return false;
+    }
+
+    uint8_t *top = data;
+    uint8_t *bottom = top + w * b;
+    uint8_t *left = bottom + w * b;
+    uint8_t *right = left + b * mid;
+
+    for (int32_t y = 0; y < b; y++) {
+        for (int32_t x = 0; x < w; x++) {
+            int32_t cx = x < b ? x : (x >= w - b ? w - 1 - x : b - 1);
+            top[y * w + x] = corner[y * b + cx];
+        }
+    }
+    for (int32_t y = 0; y < b; y++) {
+        memcpy(&bottom[y * w], &top[(b - 1 - y) * w], w);
+    }
+    // Past the corner every row is the edge profile (last corner row)
+    for (int32_t y = 0; y < mid; y++) {
+        for (int32_t x = 0; x < b; x++) {
+            left[y * b + x] = corner[(b - 1) * b + x];
+            right[y * b + x] = corner[(b - 1) * b + b - 1 - x];
+        }
+    }
+    free(corner);
+
+    init_a8(&s->top, top, w, b);
+    init_a8(&s->bottom, bottom, w, b);
+    init_a8(&s->left, left, b, mid);
+    init_a8(&s->right, right, b, mid);
+    cache_bytes += size;
+    return true;
+}
+
+static const shadow_shape_t *get_shape(int32_t w, int32_t h, int32_t radius,
+                                       int32_t width, int32_t spread) {
+    int32_t core_w = w + 2 * spread;
+    int32_t core_h = h + 2 * spread;
+    int32_t short_side = core_w < core_h ? core_w : core_h;
+    if (radius > short_side / 2) radius = short_side / 2;
+
+    for (int i = 0; i < shape_count; i++) {
+        const shadow_shape_t *s = &shapes[i];
+        if (s->w == w && s->h == h && s->radius == radius &&
+            s->width == width && s->spread == spread) {
+            return s;
+        }
+    }
+    if (shape_count >= UI_SHADOW_MAX_SHAPES) return NULL;
+
+    shadow_shape_t *s = &shapes[shape_count];
+    memset(s, 0, sizeof(*s));
+    s->w = w;
+    s->h = h;
+    s->radius = radius;
+    s->width = width;
+    s->spread = spread;
+    s->pad = width / 2 + 1;
+    s->band = s->pad + radius + width / 2 + 1;
+    s->canvas_w = core_w + 2 * s->pad;
+    s->canvas_h = core_h + 2 * s->pad;
+
+    // Too small to have a solid middle: LVGL handles those
+    if (s->canvas_w <= 2 * s->band || s->canvas_h <= 2 * s->band) return NULL;
+    if (!build_bands(s)) return NULL;
+
+    shape_count++;
+    ESP_LOGI(TAG, "Shadow %dx%d r%d w%d s%d baked (%u bytes cached)", (int)w, (int)h,
+             (int)radius, (int)width, (int)spread, (unsigned)cache_bytes);
+    return s;
+}
+
+// =============================================================================
+// Drawing
+// =============================================================================
+
+static void draw_band(lv_layer_t *layer, const lv_image_dsc_t *src, int32_t x, int32_t y,
+                      lv_color_t color, lv_opa_t opa) {
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = src;
+    dsc.recolor = color;
+    dsc.recolor_opa = LV_OPA_COVER;
+    dsc.opa = opa;
+    lv_area_t area = {
+        .x1 = x,
+        .y1 = y,
+        .x2 = x + src->header.w - 1,
+        .y2 = y + src->header.h - 1,
+    };
+    lv_draw_image(layer, &dsc, &area);
+}
+
+static void draw_shadow(lv_obj_t *obj, const shadow_shape_t *s, lv_layer_t *layer) {
+    lv_opa_t opa = lv_obj_get_style_shadow_opa(obj, LV_PART_MAIN);
+    if (opa <= LV_OPA_MIN) return;
+    lv_color_t color = lv_obj_get_style_shadow_color(obj, LV_PART_MAIN);
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    int32_t x = coords.x1 + lv_obj_get_style_shadow_offset_x(obj, LV_PART_MAIN) - s->spread - s->pad;
+    int32_t y = coords.y1 + lv_obj_get_style_shadow_offset_y(obj, LV_PART_MAIN) - s->spread - s->pad;
+    int32_t b = s->band;
+
+    draw_band(layer, &s->top, x, y, color, opa);
+    draw_band(layer, &s->left, x, y + b, color, opa);
+    draw_band(layer, &s->right, x + s->canvas_w - b, y + b, color, opa);
+    draw_band(layer, &s->bottom, x, y + s->canvas_h - b, color, opa);
+
+    lv_area_t middle = {
+        .x1 = x + b,
+        .y1 = y + b,
+        .x2 = x + s->canvas_w - b - 1,
+        .y2 = y + s->canvas_h - b - 1,
+    };
+    // Hidden under an opaque background (an offset larger than the blur
+    // shows part of it)
+    if (lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) >= LV_OPA_COVER &&
+        lv_area_is_in(&middle, &coords, lv_obj_get_style_radius(obj, LV_PART_MAIN))) {
+        return;
+    }
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.bg_color = color;
+    rect.bg_opa = opa;
+    lv_draw_rect(layer, &rect, &middle);
+}
+
+// =============================================================================
+// Baking
+// =============================================================================
+
+/* Shape for the object's current size and styles, switches LVGL's shadow off or on */
+static void attach_shape(lv_obj_t *obj, baked_shadow_t *baked) {
+    const shadow_shape_t *shape = get_shape(lv_obj_get_width(obj), lv_obj_get_height(obj),
+                                            lv_obj_get_style_radius(obj, LV_PART_MAIN), baked->width,
+                                            lv_obj_get_style_shadow_spread(obj, LV_PART_MAIN));
+    if (shape == baked->shape && shape) return;
+
+    baked->shape = shape;
+    lv_obj_set_style_shadow_width(obj, shape ? 0 : baked->width, 0);
+    lv_obj_refresh_ext_draw_size(obj);
+}
+
+static void shadow_event_cb(lv_event_t *e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    baked_shadow_t *baked = lv_event_get_user_data(e);
+
+    if (code == LV_EVENT_DRAW_MAIN_BEGIN) {
+        // Before LVGL draws the background (LV_EVENT_DRAW_MAIN)
+        if (baked->shape) draw_shadow(obj, baked->shape, lv_event_get_layer(e));
+    } else if (code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
+        const shadow_shape_t *s = baked->shape;
+        if (!s) return;
+        int32_t ofs_x = LV_ABS(lv_obj_get_style_shadow_offset_x(obj, LV_PART_MAIN));
+        int32_t ofs_y = LV_ABS(lv_obj_get_style_shadow_offset_y(obj, LV_PART_MAIN));
+        lv_event_set_ext_draw_size(e, s->pad + s->spread + LV_MAX(ofs_x, ofs_y));
+    } else if (code == LV_EVENT_SIZE_CHANGED) {
+        attach_shape(obj, baked);
+    } else if (code == LV_EVENT_DELETE) {
+        free(baked);
+    }
+}
+
+static baked_shadow_t *find_baked(lv_obj_t *obj, uint32_t *index) {
+    uint32_t count = lv_obj_get_event_count(obj);
+    for (uint32_t i = 0; i < count; i++) {
+        lv_event_dsc_t *dsc = lv_obj_get_event_dsc(obj, i);
+        if (lv_event_dsc_get_cb(dsc) == shadow_event_cb) {
+            if (index) *index = i;
+            return lv_event_dsc_get_user_data(dsc);
+        }
+    }
+    return NULL;
+}
+
+bool ui_shadow_bake(lv_obj_t *obj) {
+    if (!obj) return false;
+    baked_shadow_t *baked = find_baked(obj, NULL);
+    if (baked) return baked->shape != NULL;
+
+    int32_t width = lv_obj_get_style_shadow_width(obj, LV_PART_MAIN);
+    if (width <= 0 || lv_obj_get_style_shadow_opa(obj, LV_PART_MAIN) <= LV_OPA_MIN) return false;
+
+    baked = calloc(1, sizeof(*baked));
+    if (!baked) return false;
+    baked->width = width;
+
+    lv_obj_update_layout(obj);
+    lv_obj_add_event_cb(obj, shadow_event_cb, LV_EVENT_ALL, baked);
+    attach_shape(obj, baked);
+    return baked->shape != NULL;
+}
+
+static int bake_children(lv_obj_t *obj) {
+    int count = 0;
+    if (!lv_obj_check_type(obj, &lv_button_class) && ui_shadow_bake(obj)) count++;
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) {
+        count += bake_children(lv_obj_get_child(obj, i));
+    }
+    return count;
+}
+
+int ui_shadow_bake_tree(lv_obj_t *root) {
+    if (!root) return 0;
+    lv_obj_update_layout(root);
+    return bake_children(root);
+}
+
+int ui_shadow_unbake_tree(lv_obj_t *root) {
+    if (!root) return 0;
+    int count = 0;
+    uint32_t index;
+    baked_shadow_t *baked = find_baked(root, &index);
+    if (baked) {
+        lv_obj_set_style_shadow_width(root, baked->width, 0);
+        lv_obj_remove_event(root, index);
+        free(baked);
+        lv_obj_refresh_ext_draw_size(root);
+        count++;
+    }
+    for (uint32_t i = 0; i < lv_obj_get_child_count(root); i++) {
+        count += ui_shadow_unbake_tree(lv_obj_get_child(root, i));
+    }
+    return count;
+}
+
+uint32_t ui_shadow_cache_bytes(void) {
+    return cache_bytes;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file ui_shadow.h
+ * @brief Pre-rendered box shadows
+ *
+ * LVGL's software renderer blurs a shadow corner on every redraw of the
+ * area, and its shadow cache (LV_DRAW_SW_SHADOW_CACHE_SIZE) only keeps the
+ * last shape per draw unit. A baked object gets its shadow rendered once per
+ * distinct shape (size, radius, width, spread) into four A8 bands around the
+ * object and drawn as plain images; the object's own shadow is switched off.
+ * Offset, color and opa are still read from the styles at draw time.
+ *
+ * Only the default state's shadow shape is baked. Objects whose shape doesn't
+ * fit (too small for the blur, or over the cache budget) keep LVGL's shadow.
+ *
+ * LVGL thread only. Shared between firmware and simulator.
+ */
+
+#ifndef UI_SHADOW_H
+#define UI_SHADOW_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Draw the object's shadow from the shape cache
+ * @return true if baked (or already baked), false if LVGL keeps drawing it
+ */
+bool ui_shadow_bake(lv_obj_t *obj);
+
+/**
+ * Bake every object with a shadow in a tree (buttons excluded: their
+ * shadow usually changes with the state)
+ * @return Number of objects baked
+ */
+int ui_shadow_bake_tree(lv_obj_t *root);
+
+/**
+ * Give the shadows of a tree back to LVGL (benchmark)
+ * @return Number of objects unbaked
+ */
+int ui_shadow_unbake_tree(lv_obj_t *root);
+
+/**
+ * Bytes held by the shape cache
+ */
+uint32_t ui_shadow_cache_bytes(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_SHADOW_H */
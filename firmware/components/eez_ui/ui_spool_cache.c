@@ -0,0 +1,269 @@
+/**
+ * @file ui_spool_cache.c
+ * @brief Display-side cache for inventory lookups
+ *
+ * Backend calls run outside the lock. Every invalidation bumps a generation
+ * counter; a result fetched across an invalidation is returned but not stored,
+ * so a slow lookup can't put back what was just dropped.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#include "ui_spool_cache.h"
+#include <string.h>
+
+#ifdef TESTING
+#include "mock_lvgl.h"
+#else
+#include "lvgl.h"
+#endif
+
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+static portMUX_TYPE cache_lock = portMUX_INITIALIZER_UNLOCKED;
+#define CACHE_LOCK()   taskENTER_CRITICAL(&cache_lock)
+#define CACHE_UNLOCK() taskEXIT_CRITICAL(&cache_lock)
+#else
+#include <pthread.h>
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#define CACHE_LOCK()   pthread_mutex_lock(&cache_lock)
+#define CACHE_UNLOCK() pthread_mutex_unlock(&cache_lock)
+#endif
+
+typedef struct {
+    bool used;
+    bool found;
+    uint32_t fetched;       // lv_tick_get() of the backend call
+    uint32_t last_use;      // use_clock of the last lookup (LRU)
+} entry_meta_t;
+
+typedef struct {
+    entry_meta_t meta;
+    char tag_id[32];
+    SpoolInfoC info;
+} spool_entry_t;
+
+typedef struct {
+    entry_meta_t meta;
+    char spool_id[64];
+    char printer_serial[32];
+    SpoolKProfileC profile;
+} k_profile_entry_t;
+
+static spool_entry_t spools[UI_SPOOL_CACHE_SPOOLS];
+static k_profile_entry_t k_profiles[UI_SPOOL_CACHE_K_PROFILES];
+static uint32_t use_clock = 0;
+static uint32_t generation = 0;
+static ui_spool_cache_stats_t stats;
+
+// =============================================================================
+// Entries
+// =============================================================================
+
+static bool key_equals(const char *stored, size_t size, const char *key) {
+    return strncmp(stored, key, size - 1) == 0 && strlen(key) < size;
+}
+
+static void copy_key(char *dst, size_t size, const char *key) {
+    strncpy(dst, key, size - 1);
+    dst[size - 1] = '\0';
+}
+
+static bool entry_fresh(const entry_meta_t *meta) {
+    uint32_t ttl = meta->found ? UI_SPOOL_CACHE_TTL_MS : UI_SPOOL_CACHE_MISS_TTL_MS;
+    return meta->used && lv_tick_elaps(meta->fetched) < ttl;
+}
+
+static void entry_touch(entry_meta_t *meta) {
+    meta->last_use = ++use_clock;
+}
+
+static void entry_fill(entry_meta_t *meta, bool found) {
+    meta->used = true;
+    meta->found = found;
+    meta->fetched = lv_tick_get();
+    entry_touch(meta);
+}
+
+// Replacement order: free slots first, then least recently used
+static bool evict_before(const entry_meta_t *a, const entry_meta_t *b) {
+    if (!a->used || !b->used) return !a->used && b->used;
+    return (int32_t)(a->last_use - b->last_use) < 0;
+}
+
+static spool_entry_t *evict_spool(void) {
+    spool_entry_t *victim = &spools[0];
+    for (int i = 1; i < UI_SPOOL_CACHE_SPOOLS; i++) {
+        if (evict_before(&spools[i].meta, &victim->meta)) victim = &spools[i];
+    }
+    return victim;
+}
+
+static k_profile_entry_t *evict_k_profile(void) {
+    k_profile_entry_t *victim = &k_profiles[0];
+    for (int i = 1; i < UI_SPOOL_CACHE_K_PROFILES; i++) {
+        if (evict_before(&k_profiles[i].meta, &victim->meta)) victim = &k_profiles[i];
+    }
+    return victim;
+}
+
+static spool_entry_t *find_spool(const char *tag_id) {
+    for (int i = 0; i < UI_SPOOL_CACHE_SPOOLS; i++) {
+        if (spools[i].meta.used && key_equals(spools[i].tag_id, sizeof(spools[i].tag_id), tag_id)) {
+            return &spools[i];
+        }
+    }
+    return NULL;
+}
+
+static k_profile_entry_t *find_k_profile(const char *spool_id, const char *printer_serial) {
+    for (int i = 0; i < UI_SPOOL_CACHE_K_PROFILES; i++) {
+        k_profile_entry_t *e = &k_profiles[i];
+        if (e->meta.used && key_equals(e->spool_id, sizeof(e->spool_id), spool_id) &&
+            key_equals(e->printer_serial, sizeof(e->printer_serial), printer_serial)) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+// =============================================================================
+// Lookups
+// =============================================================================
+
+bool ui_spool_cache_get_by_tag(const char *tag_id, SpoolInfoC *info) {
+    if (!tag_id || !tag_id[0]) {
+        if (info) memset(info, 0, sizeof(*info));
+        return false;
+    }
+
+    CACHE_LOCK();
+    spool_entry_t *entry = find_spool(tag_id);
+    if (entry && entry_fresh(&entry->meta)) {
+        entry_touch(&entry->meta);
+        bool found = entry->meta.found;
+        if (info) *info = entry->info;
+        stats.spool_hits++;
+        CACHE_UNLOCK();
+        return found;
+    }
+    stats.spool_misses++;
+    uint32_t fetch_generation = generation;
+    CACHE_UNLOCK();
+
+    SpoolInfoC fetched;
+    bool found = spool_get_by_tag(tag_id, &fetched);
+    if (!found) memset(&fetched, 0, sizeof(fetched));
+
+    CACHE_LOCK();
+    if (fetch_generation == generation) {
+        entry = find_spool(tag_id);
+        if (!entry) {
+            entry = evict_spool();
+            copy_key(entry->tag_id, sizeof(entry->tag_id), tag_id);
+        }
+        entry->info = fetched;
+        entry_fill(&entry->meta, found);
+    }
+    CACHE_UNLOCK();
+
+    if (info) *info = fetched;
+    return found;
+}
+
+bool ui_spool_cache_get_k_profile(const char *spool_id, const char *printer_serial,
+                                  SpoolKProfileC *profile) {
+    if (!spool_id || !spool_id[0] || !printer_serial || !printer_serial[0]) {
+        if (profile) memset(profile, 0, sizeof(*profile));
+        return false;
+    }
+
+    CACHE_LOCK();
+    k_profile_entry_t *entry = find_k_profile(spool_id, printer_serial);
+    if (entry && entry_fresh(&entry->meta)) {
+        entry_touch(&entry->meta);
+        bool found = entry->meta.found;
+        if (profile) *profile = entry->profile;
+        stats.k_profile_hits++;
+        CACHE_UNLOCK();
+        return found;
+    }
+    stats.k_profile_misses++;
+    uint32_t fetch_generation = generation;
+    CACHE_UNLOCK();
+
+    SpoolKProfileC fetched;
+    bool found = spool_get_k_profile_for_printer(spool_id, printer_serial, &fetched);
+    if (!found) memset(&fetched, 0, sizeof(fetched));
+
+    CACHE_LOCK();
+    if (fetch_generation == generation) {
+        entry = find_k_profile(spool_id, printer_serial);
+        if (!entry) {
+            entry = evict_k_profile();
+            copy_key(entry->spool_id, sizeof(entry->spool_id), spool_id);
+            copy_key(entry->printer_serial, sizeof(entry->printer_serial), printer_serial);
+        }
+        entry->profile = fetched;
+        entry_fill(&entry->meta, found);
+    }
+    CACHE_UNLOCK();
+
+    if (profile) *profile = fetched;
+    return found;
+}
+
+// =============================================================================
+// Invalidation
+// =============================================================================
+
+void ui_spool_cache_invalidate_tag(const char *tag_id) {
+    if (!tag_id) return;
+
+    CACHE_LOCK();
+    generation++;
+    spool_entry_t *entry = find_spool(tag_id);
+    if (entry) entry->meta.used = false;
+    CACHE_UNLOCK();
+}
+
+void ui_spool_cache_invalidate_spool(const char *spool_id) {
+    if (!spool_id || !spool_id[0]) return;
+
+    CACHE_LOCK();
+    generation++;
+    for (int i = 0; i < UI_SPOOL_CACHE_SPOOLS; i++) {
+        if (spools[i].meta.used && spools[i].meta.found &&
+            key_equals(spools[i].info.id, sizeof(spools[i].info.id), spool_id)) {
+            spools[i].meta.used = false;
+        }
+    }
+    for (int i = 0; i < UI_SPOOL_CACHE_K_PROFILES; i++) {
+        if (k_profiles[i].meta.used &&
+            key_equals(k_profiles[i].spool_id, sizeof(k_profiles[i].spool_id), spool_id)) {
+            k_profiles[i].meta.used = false;
+        }
+    }
+    CACHE_UNLOCK();
+}
+
+void ui_spool_cache_clear(void) {
+    CACHE_LOCK();
+    generation++;
+    for (int i = 0; i < UI_SPOOL_CACHE_SPOOLS; i++) {
+        spools[i].meta.used = false;
+    }
+    for (int i = 0; i < UI_SPOOL_CACHE_K_PROFILES; i++) {
+        k_profiles[i].meta.used = false;
+    }
+    CACHE_UNLOCK();
+}
+
+void ui_spool_cache_get_stats(ui_spool_cache_stats_t *out) {
+    if (!out) return;
+
+    CACHE_LOCK();
+    *out = stats;
+    CACHE_UNLOCK();
+}
@@ -0,0 +1,97 @@
+/**
+ * @file ui_spool_cache.h
+ * @brief Display-side cache for inventory lookups
+ *
+ * While a tag sits on the reader the popup, the details modal and the scan
+ * result screen all ask the backend about the same UID. Results are kept in
+ * two small LRU tables:
+ * - spools by tag UID (including "not in inventory")
+ * - K-profiles by spool id + printer serial
+ *
+ * Entries expire after a TTL; callers that change a spool on the backend
+ * invalidate it right away. Safe to call from ui_async workers.
+ *
+ * Shared between firmware and simulator.
+ */
+
+#ifndef UI_SPOOL_CACHE_H
+#define UI_SPOOL_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "ui_internal.h"
+#else
+#include "backend_client.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Spools (tag UIDs) kept
+#ifndef UI_SPOOL_CACHE_SPOOLS
+#define UI_SPOOL_CACHE_SPOOLS 8
+#endif
+
+// K-profiles (spool + printer) kept
+#ifndef UI_SPOOL_CACHE_K_PROFILES
+#define UI_SPOOL_CACHE_K_PROFILES 8
+#endif
+
+// Lifetime of a found entry (ms)
+#ifndef UI_SPOOL_CACHE_TTL_MS
+#define UI_SPOOL_CACHE_TTL_MS 30000
+#endif
+
+// Lifetime of a "not found" entry (ms) - also covers backend errors
+#ifndef UI_SPOOL_CACHE_MISS_TTL_MS
+#define UI_SPOOL_CACHE_MISS_TTL_MS 5000
+#endif
+
+typedef struct {
+    uint32_t spool_hits;
+    uint32_t spool_misses;
+    uint32_t k_profile_hits;
+    uint32_t k_profile_misses;
+} ui_spool_cache_stats_t;
+
+/**
+ * Cached spool_get_by_tag()
+ * @return true if the tag is in the inventory (replaces spool_exists_by_tag)
+ */
+bool ui_spool_cache_get_by_tag(const char *tag_id, SpoolInfoC *info);
+
+/**
+ * Cached spool_get_k_profile_for_printer()
+ * @return true if the spool has a K-profile for the printer
+ */
+bool ui_spool_cache_get_k_profile(const char *spool_id, const char *printer_serial,
+                                  SpoolKProfileC *profile);
+
+/**
+ * Drop the entry for a tag (after adding or linking it)
+ */
+void ui_spool_cache_invalidate_tag(const char *tag_id);
+
+/**
+ * Drop every entry of a spool (after syncing its weight or linking a tag)
+ */
+void ui_spool_cache_invalidate_spool(const char *spool_id);
+
+/**
+ * Drop all entries (statistics are kept)
+ */
+void ui_spool_cache_clear(void);
+
+/**
+ * Hit/miss counters since boot
+ */
+void ui_spool_cache_get_stats(ui_spool_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_SPOOL_CACHE_H */
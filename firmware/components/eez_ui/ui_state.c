@@ -0,0 +1,176 @@
+/**
+ * @file ui_state.c
+ * @brief Published UI state (LVGL subjects)
+ *
+ * The data sources (Rust FFI on firmware, backend_client in the simulator)
+ * can only be polled, so ui_state_poll() samples them once per
+ * UI_STATE_POLL_MS and publishes into LVGL subjects. A subject only notifies
+ * its observers when the sampled value differs from the published one.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#include "ui_state.h"
+#include "ui_internal.h"
+#include "ui_cover_cache.h"
+#include <stdio.h>
+
+// External functions
+extern bool nfc_is_initialized(void);
+extern bool nfc_tag_present(void);
+extern float scale_get_weight(void);
+extern bool scale_is_initialized(void);
+
+// Scale display hysteresis (grams)
+#define SCALE_HYSTERESIS_G 10.0f
+
+lv_subject_t ui_subject_clock;
+lv_subject_t ui_subject_wifi;
+lv_subject_t ui_subject_backend;
+lv_subject_t ui_subject_printers;
+lv_subject_t ui_subject_cover;
+lv_subject_t ui_subject_nfc;
+lv_subject_t ui_subject_scale;
+lv_subject_t ui_subject_update;
+
+static bool state_initialized = false;
+static uint32_t last_poll_ms = 0;
+static float last_published_weight = 0.0f;
+
+void ui_state_init(void) {
+    if (state_initialized) return;
+
+    lv_subject_init_int(&ui_subject_clock, -1);
+    lv_subject_init_int(&ui_subject_wifi, UI_WIFI_OFF);
+    lv_subject_init_int(&ui_subject_backend, 0);
+    lv_subject_init_int(&ui_subject_printers, 0);
+    lv_subject_init_int(&ui_subject_cover, 0);
+    lv_subject_init_int(&ui_subject_nfc, UI_NFC_UNAVAILABLE);
+    lv_subject_init_int(&ui_subject_scale, UI_SCALE_NA);
+    lv_subject_init_int(&ui_subject_update, 0);
+
+    state_initialized = true;
+}
+
+/**
+ * Publish a value - lv_subject_set_int() notifies even when nothing changed
+ */
+static void publish_int(lv_subject_t *subject, int32_t value) {
+    if (lv_subject_get_int(subject) != value) {
+        lv_subject_set_int(subject, value);
+    }
+}
+
+static int32_t sample_wifi_level(void) {
+    WifiStatus status;
+    wifi_get_status(&status);
+
+    if (status.state == 3) {
+        if (status.rssi > -50) return UI_WIFI_EXCELLENT;
+        if (status.rssi > -65) return UI_WIFI_GOOD;
+        if (status.rssi > -75) return UI_WIFI_FAIR;
+        return UI_WIFI_POOR;
+    }
+    return status.state == 2 ? UI_WIFI_CONNECTING : UI_WIFI_OFF;
+}
+
+static int32_t sample_nfc_state(void) {
+    if (!nfc_is_initialized()) return UI_NFC_UNAVAILABLE;
+    return nfc_tag_present() ? UI_NFC_TAG : UI_NFC_READY;
+}
+
+/**
+ * Weight as shown in the status bar - only moves after a 10 g change, so the
+ * label doesn't redraw on scale noise
+ */
+static int32_t sample_scale_weight(void) {
+    if (!scale_is_initialized()) return UI_SCALE_NA;
+
+    float weight = scale_get_weight();
+    float diff = weight - last_published_weight;
+    if (diff < 0) diff = -diff;
+
+    if (lv_subject_get_int(&ui_subject_scale) == UI_SCALE_NA || diff >= SCALE_HYSTERESIS_G) {
+        last_published_weight = weight;
+    }
+
+    int weight_int = (int)last_published_weight;
+    if (weight_int >= -20 && weight_int <= 20) weight_int = 0;
+    if (weight_int < 0) weight_int = 0;
+    return weight_int;
+}
+
+void ui_state_refresh(void) {
+    if (!state_initialized) return;
+    last_poll_ms = lv_tick_get();
+
+    BackendStatus status;
+    backend_get_status(&status);
+    publish_int(&ui_subject_backend, status.state == 2);
+    publish_int(&ui_subject_printers, (int32_t)ui_backend_refresh_snapshot());
+    ui_cover_cache_sync();
+    publish_int(&ui_subject_cover, (int32_t)ui_cover_cache_generation());
+    publish_int(&ui_subject_clock, time_get_hhmm());
+    publish_int(&ui_subject_wifi, sample_wifi_level());
+    publish_int(&ui_subject_nfc, sample_nfc_state());
+    publish_int(&ui_subject_scale, sample_scale_weight());
+    publish_int(&ui_subject_update, ota_is_update_available() ? 1 : 0);
+}
+
+bool ui_state_poll(void) {
+    if (lv_tick_elaps(last_poll_ms) < UI_STATE_POLL_MS) {
+        return false;
+    }
+    ui_state_refresh();
+    return true;
+}
+
+// =============================================================================
+// Top Bar Bindings
+// =============================================================================
+
+static void clock_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
+    lv_obj_t *label = lv_observer_get_target(observer);
+    int32_t hhmm = lv_subject_get_int(subject);
+    if (hhmm < 0) return;  // Keep the placeholder until time is synced
+
+    char time_str[8];
+    snprintf(time_str, sizeof(time_str), "%02d:%02d", (int)((hhmm >> 8) & 0xFF), (int)(hhmm & 0xFF));
+    lv_label_set_text(label, time_str);
+}
+
+static void wifi_icon_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
+    lv_obj_t *icon = lv_observer_get_target(observer);
+    int32_t level = lv_subject_get_int(subject);
+
+    if (level == UI_WIFI_OFF) {
+        // Disconnected - dimmed (30% opacity), no recolor
+        lv_obj_set_style_image_recolor_opa(icon, 0, LV_PART_MAIN);
+        lv_obj_set_style_opa(icon, 80, LV_PART_MAIN);
+        return;
+    }
+
+    // Connecting is yellow, connected is colored by signal strength
+    uint32_t color;
+    switch (level) {
+        case UI_WIFI_EXCELLENT: color = 0xff00ff00; break;  // Bright green
+        case UI_WIFI_GOOD:      color = 0xff88ff00; break;  // Yellow-green
+        case UI_WIFI_POOR:      color = 0xffff5555; break;  // Red
+        default:                color = 0xffffaa00; break;  // Fair / connecting - orange/yellow
+    }
+    lv_obj_set_style_image_recolor(icon, lv_color_hex(color), LV_PART_MAIN);
+    lv_obj_set_style_image_recolor_opa(icon, 255, LV_PART_MAIN);
+    lv_obj_set_style_opa(icon, 255, LV_PART_MAIN);
+}
+
+void ui_state_bind_clock(lv_obj_t *label) {
+    if (label) {
+        lv_subject_add_observer_obj(&ui_subject_clock, clock_observer_cb, label, NULL);
+    }
+}
+
+void ui_state_bind_wifi_icon(lv_obj_t *icon) {
+    if (icon) {
+        lv_subject_add_observer_obj(&ui_subject_wifi, wifi_icon_observer_cb, icon, NULL);
+    }
+}
@@ -0,0 +1,91 @@
+/**
+ * @file ui_state.h
+ * @brief Published UI state (LVGL subjects)
+ *
+ * Backend, WiFi, NFC and scale state is sampled in one place and published
+ * as LVGL subjects. Widgets bind to a subject and update only when its value
+ * changes, instead of every screen re-pushing its labels on a tick counter.
+ *
+ * Shared between firmware and simulator.
+ */
+
+#ifndef UI_STATE_H
+#define UI_STATE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Sampling period of the data sources (ms)
+#ifndef UI_STATE_POLL_MS
+#define UI_STATE_POLL_MS 100
+#endif
+
+// WiFi icon level (ui_subject_wifi)
+typedef enum {
+    UI_WIFI_OFF = 0,        // Disconnected / not initialized
+    UI_WIFI_CONNECTING,
+    UI_WIFI_POOR,           // Connected, RSSI <= -75 dBm
+    UI_WIFI_FAIR,           // Connected, RSSI <= -65 dBm
+    UI_WIFI_GOOD,           // Connected, RSSI <= -50 dBm
+    UI_WIFI_EXCELLENT,
+} ui_wifi_level_t;
+
+// NFC reader state (ui_subject_nfc)
+typedef enum {
+    UI_NFC_UNAVAILABLE = 0,
+    UI_NFC_READY,
+    UI_NFC_TAG,             // Tag present
+} ui_nfc_state_t;
+
+#define UI_SCALE_NA INT32_MIN   // ui_subject_scale value when no scale is connected
+
+// Subjects (all integer subjects)
+extern lv_subject_t ui_subject_clock;     // hour << 8 | minute, -1 = not synced
+extern lv_subject_t ui_subject_wifi;      // ui_wifi_level_t
+extern lv_subject_t ui_subject_backend;   // 1 = backend server connected
+extern lv_subject_t ui_subject_printers;  // Backend snapshot generation (printer/AMS data)
+extern lv_subject_t ui_subject_cover;     // Cover cache generation, bumped when a cover finished downloading
+extern lv_subject_t ui_subject_nfc;       // ui_nfc_state_t
+extern lv_subject_t ui_subject_scale;     // Displayed weight in grams (10 g steps), UI_SCALE_NA
+extern lv_subject_t ui_subject_update;    // 1 = firmware update available
+
+/**
+ * Initialize the subjects. Call once before any screen is created.
+ */
+void ui_state_init(void);
+
+/**
+ * Sample all data sources if UI_STATE_POLL_MS passed since the last sample.
+ * Call from ui_tick (also runs while the display is idle).
+ *
+ * @return true if a sample was taken
+ */
+bool ui_state_poll(void);
+
+/**
+ * Sample all data sources now and publish values that changed.
+ */
+void ui_state_refresh(void);
+
+/**
+ * Bind a top bar clock label to ui_subject_clock.
+ * The binding is removed when the label is deleted.
+ */
+void ui_state_bind_clock(lv_obj_t *label);
+
+/**
+ * Bind a top bar WiFi icon to ui_subject_wifi.
+ * The binding is removed when the icon is deleted.
+ */
+void ui_state_bind_wifi_icon(lv_obj_t *icon);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_STATE_H */
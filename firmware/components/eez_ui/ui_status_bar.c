@@ -5,9 +5,13 @@
  * Layout (800x30 bar):
  * [Backend dot]     [Colored badge + Material]     [NFC icon + label] [Scale icon + weight]
  *     Left                   Center                        Right
+ *
+ * Every element is bound to a ui_state subject and redraws only when the
+ * published value changes.
  */
 
 #include "ui_status_bar.h"
+#include "ui_state.h"
 #include "screens.h"
 #include <lvgl.h>
 #include <stdio.h>
@@ -24,10 +28,6 @@ static const char *TAG = "ui_status_bar";
 #endif
 
 // External functions
-extern bool nfc_is_initialized(void);
-extern bool nfc_tag_present(void);
-extern float scale_get_weight(void);
-extern bool scale_is_initialized(void);
 extern int get_selected_printer_index(void);
 
 // Colors
@@ -49,81 +49,73 @@ static lv_obj_t *scale_label = NULL;
 // Track which screen we're on
 static bool current_is_main_screen = true;
 
-// Weight display hysteresis
-static float last_displayed_weight = 0.0f;
-static bool weight_initialized = false;
-
 /**
  * Get the active tray info from the selected printer
  * Returns the tray color (RGBA) and material type
  */
 static bool get_active_tray_info(uint32_t *color_out, char *material_out, size_t material_size) {
 #ifdef ESP_PLATFORM
-    // Firmware: use backend FFI
+    // Firmware: use the backend snapshot, re-resolved only when its generation changes
+    static int cached_printer_idx = -1;
+    static uint32_t cached_generation = 0;
+    static bool cached_found = false;
+    static uint32_t cached_color = COLOR_GRAY;
+    static char cached_material[16] = "";
+
     int printer_idx = get_selected_printer_index();
-    BackendPrinterInfo info;
-    if (backend_get_printer(printer_idx, &info) != 0 || !info.connected) {
+    const BackendSnapshot *snapshot = ui_backend_get_snapshot();
+    if (printer_idx < 0 || printer_idx >= snapshot->printer_count) {
         return false;
     }
-
-    // Get tray_now values from separate functions
-    int tray_now = backend_get_tray_now(printer_idx);
-    int tray_now_left = backend_get_tray_now_left(printer_idx);
-    int tray_now_right = backend_get_tray_now_right(printer_idx);
-
-    // Determine which tray is active
-    int active_tray = -1;
-    if (tray_now >= 0 && tray_now < 255) {
-        active_tray = tray_now;
-    } else if (tray_now_right >= 0 && tray_now_right < 255) {
-        active_tray = tray_now_right;  // Prefer right for display
-    } else if (tray_now_left >= 0 && tray_now_left < 255) {
-        active_tray = tray_now_left;
-    }
-
-    if (active_tray < 0) {
+    const BackendPrinterSnapshot *printer = &snapshot->printers[printer_idx];
+    if (!printer->info.connected) {
         return false;
     }
 
-    // Find the tray in AMS units
-    int ams_count = backend_get_ams_count(printer_idx);
-    for (int ams_idx = 0; ams_idx < ams_count; ams_idx++) {
-        AmsUnitCInfo ams_info;
-        if (backend_get_ams_unit(printer_idx, ams_idx, &ams_info) != 0) continue;
-
-        for (int tray_idx = 0; tray_idx < ams_info.tray_count; tray_idx++) {
-            AmsTrayInfo tray_info;
-            if (backend_get_ams_tray(printer_idx, ams_idx, tray_idx, &tray_info) != 0) continue;
+    if (printer_idx != cached_printer_idx || printer->generation != cached_generation) {
+        cached_printer_idx = printer_idx;
+        cached_generation = printer->generation;
+        cached_found = false;
 
-            // Match tray: ams_id * 4 + tray_id (for regular AMS)
-            int global_tray = ams_info.id * 4 + tray_idx;
-            if (global_tray == active_tray) {
-                // Parse color (hex string like "FF0000")
-                if (tray_info.tray_color[0]) {
-                    unsigned int r, g, b;
-                    if (sscanf(tray_info.tray_color, "%02x%02x%02x", &r, &g, &b) == 3) {
-                        *color_out = (r << 16) | (g << 8) | b;
-                    } else {
-                        *color_out = COLOR_GRAY;
-                    }
-                } else {
-                    *color_out = COLOR_GRAY;
-                }
+        // Determine which tray is active
+        int active_tray = -1;
+        if (printer->tray_now >= 0 && printer->tray_now < 255) {
+            active_tray = printer->tray_now;
+        } else if (printer->tray_now_right >= 0 && printer->tray_now_right < 255) {
+            active_tray = printer->tray_now_right;  // Prefer right for display
+        } else if (printer->tray_now_left >= 0 && printer->tray_now_left < 255) {
+            active_tray = printer->tray_now_left;
+        }
 
-                // Copy material
-                if (tray_info.tray_type[0]) {
-                    strncpy(material_out, tray_info.tray_type, material_size - 1);
-                    material_out[material_size - 1] = '\0';
+        // Find the tray in AMS units
+        for (int ams_idx = 0; active_tray >= 0 && ams_idx < printer->ams_count && !cached_found; ams_idx++) {
+            const AmsUnitCInfo *ams_info = &printer->ams[ams_idx].info;
+            for (int tray_idx = 0; tray_idx < ams_info->tray_count && tray_idx < 4; tray_idx++) {
+                // Match tray: ams_id * 4 + tray_id (for regular AMS)
+                if (ams_info->id * 4 + tray_idx != active_tray) continue;
+
+                const AmsTrayCInfo *tray = &ams_info->trays[tray_idx];
+                // RGBA -> RGB; 0 = no color reported (empty tray)
+                cached_color = tray->tray_color ? tray->tray_color >> 8 : COLOR_GRAY;
+                if (tray->tray_type[0]) {
+                    strncpy(cached_material, tray->tray_type, sizeof(cached_material) - 1);
+                    cached_material[sizeof(cached_material) - 1] = '\0';
                 } else {
-                    strncpy(material_out, "Empty", material_size - 1);
+                    strcpy(cached_material, "Empty");
                 }
-
-                return true;
+                cached_found = true;
+                break;
             }
         }
     }
 
-    return false;
+    if (!cached_found) {
+        return false;
+    }
+    *color_out = cached_color;
+    strncpy(material_out, cached_material, material_size - 1);
+    material_out[material_size - 1] = '\0';
+    return true;
 #else
     // Simulator: use backend_client
     int printer_idx = get_selected_printer_index();
@@ -212,17 +204,74 @@ static bool get_active_tray_info(uint32_t *color_out, char *material_out, size_t
 #endif
 }
 
+// =============================================================================
+// Subject Observers
+// =============================================================================
+
+static void backend_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
+    bool connected = lv_subject_get_int(subject) != 0;
+    lv_obj_set_style_bg_color(lv_observer_get_target(observer),
+        lv_color_hex(connected ? COLOR_GREEN : COLOR_RED), 0);
+}
+
 /**
- * Check if backend is connected
+ * Active tray badge - follows printer data (ui_subject_printers)
+ * The material label is updated together with the badge.
  */
-static bool is_backend_connected(void) {
-#ifdef ESP_PLATFORM
-    BackendStatus status;
-    backend_get_status(&status);
-    return status.state == 2;  // Connected
-#else
-    return backend_is_connected();
-#endif
+static void active_tray_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
+    (void)observer;
+    (void)subject;
+    if (!active_tray_badge || !active_tray_label) return;
+
+    uint32_t tray_color = COLOR_DARK_GRAY;
+    char material[64] = "---";
+
+    if (get_active_tray_info(&tray_color, material, sizeof(material))) {
+        lv_obj_set_style_bg_color(active_tray_badge, lv_color_hex(tray_color), 0);
+        lv_obj_set_style_border_color(active_tray_badge, lv_color_hex(0x888888), 0);
+        lv_label_set_text(active_tray_label, material);
+        lv_obj_set_style_text_color(active_tray_label, lv_color_hex(COLOR_WHITE), 0);
+    } else {
+        lv_obj_set_style_bg_color(active_tray_badge, lv_color_hex(COLOR_DARK_GRAY), 0);
+        lv_obj_set_style_border_color(active_tray_badge, lv_color_hex(0x555555), 0);
+        lv_label_set_text(active_tray_label, "---");
+        lv_obj_set_style_text_color(active_tray_label, lv_color_hex(COLOR_GRAY), 0);
+    }
+}
+
+static void nfc_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
+    lv_obj_t *label = lv_observer_get_target(observer);
+
+    switch (lv_subject_get_int(subject)) {
+        case UI_NFC_TAG:
+            lv_label_set_text(label, "NFC: Tag");
+            lv_obj_set_style_text_color(label, lv_color_hex(COLOR_GREEN), 0);
+            break;
+        case UI_NFC_READY:
+            lv_label_set_text(label, "NFC: Ready");
+            lv_obj_set_style_text_color(label, lv_color_hex(COLOR_WHITE), 0);
+            break;
+        default:
+            lv_label_set_text(label, "NFC: N/A");
+            lv_obj_set_style_text_color(label, lv_color_hex(COLOR_GRAY), 0);
+            break;
+    }
+}
+
+static void scale_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
+    lv_obj_t *label = lv_observer_get_target(observer);
+    int32_t weight = lv_subject_get_int(subject);
+
+    if (weight == UI_SCALE_NA) {
+        lv_label_set_text(label, "Scale: N/A");
+        lv_obj_set_style_text_color(label, lv_color_hex(COLOR_GRAY), 0);
+        return;
+    }
+
+    char weight_str[24];
+    snprintf(weight_str, sizeof(weight_str), "Scale: %dg", (int)weight);
+    lv_label_set_text(label, weight_str);
+    lv_obj_set_style_text_color(label, lv_color_hex(COLOR_WHITE), 0);
 }
 
 void ui_status_bar_init(bool is_main_screen) {
@@ -311,97 +360,14 @@ void ui_status_bar_init(bool is_main_screen) {
     lv_obj_set_style_text_color(scale_label, lv_color_hex(COLOR_GRAY), 0);
     lv_obj_set_style_text_font(scale_label, &lv_font_montserrat_12, 0);
 
-    STATUS_LOG("Status bar initialized for %s", is_main_screen ? "main_screen" : "ams_overview");
-}
-
-void ui_status_bar_update(void) {
-    if (!status_bar_container) return;
-
-    // Verify the container is still valid (attached to an active screen)
-    lv_obj_t *screen = lv_obj_get_screen(status_bar_container);
-    if (!screen || screen != lv_scr_act()) {
-        // Container belongs to a deleted/inactive screen - clear and return
-        ui_status_bar_cleanup();
-        return;
-    }
-
-    // =========================================================================
-    // Update backend connection dot
-    // =========================================================================
-    if (backend_dot) {
-        bool connected = is_backend_connected();
-        lv_obj_set_style_bg_color(backend_dot,
-            lv_color_hex(connected ? COLOR_GREEN : COLOR_RED), 0);
-    }
-
-    // =========================================================================
-    // Update active tray badge and material
-    // =========================================================================
-    if (active_tray_badge && active_tray_label) {
-        uint32_t tray_color = COLOR_DARK_GRAY;
-        char material[64] = "---";
-
-        if (get_active_tray_info(&tray_color, material, sizeof(material))) {
-            lv_obj_set_style_bg_color(active_tray_badge, lv_color_hex(tray_color), 0);
-            lv_obj_set_style_border_color(active_tray_badge, lv_color_hex(0x888888), 0);
-            lv_label_set_text(active_tray_label, material);
-            lv_obj_set_style_text_color(active_tray_label, lv_color_hex(COLOR_WHITE), 0);
-        } else {
-            lv_obj_set_style_bg_color(active_tray_badge, lv_color_hex(COLOR_DARK_GRAY), 0);
-            lv_obj_set_style_border_color(active_tray_badge, lv_color_hex(0x555555), 0);
-            lv_label_set_text(active_tray_label, "---");
-            lv_obj_set_style_text_color(active_tray_label, lv_color_hex(COLOR_GRAY), 0);
-        }
-    }
-
-    // =========================================================================
-    // Update NFC status text
-    // =========================================================================
-    if (nfc_label) {
-        bool nfc_ready = nfc_is_initialized();
-        bool tag_present = nfc_ready && nfc_tag_present();
-
-        if (tag_present) {
-            lv_label_set_text(nfc_label, "NFC: Tag");
-            lv_obj_set_style_text_color(nfc_label, lv_color_hex(COLOR_GREEN), 0);
-        } else if (nfc_ready) {
-            lv_label_set_text(nfc_label, "NFC: Ready");
-            lv_obj_set_style_text_color(nfc_label, lv_color_hex(COLOR_WHITE), 0);
-        } else {
-            lv_label_set_text(nfc_label, "NFC: N/A");
-            lv_obj_set_style_text_color(nfc_label, lv_color_hex(COLOR_GRAY), 0);
-        }
-    }
-
-    // =========================================================================
-    // Update scale weight text
-    // =========================================================================
-    if (scale_label) {
-        if (scale_is_initialized()) {
-            float weight = scale_get_weight();
-
-            // Apply 10g hysteresis
-            float diff = weight - last_displayed_weight;
-            if (diff < 0) diff = -diff;
-
-            if (!weight_initialized || diff >= 10.0f) {
-                last_displayed_weight = weight;
-                weight_initialized = true;
+    // Bind to published state (observers run once now, and are removed
+    // together with their element)
+    lv_subject_add_observer_obj(&ui_subject_backend, backend_observer_cb, backend_dot, NULL);
+    lv_subject_add_observer_obj(&ui_subject_printers, active_tray_observer_cb, active_tray_badge, NULL);
+    lv_subject_add_observer_obj(&ui_subject_nfc, nfc_observer_cb, nfc_label, NULL);
+    lv_subject_add_observer_obj(&ui_subject_scale, scale_observer_cb, scale_label, NULL);
 
-                int weight_int = (int)weight;
-                if (weight_int >= -20 && weight_int <= 20) weight_int = 0;
-                if (weight_int < 0) weight_int = 0;
-
-                char weight_str[24];
-                snprintf(weight_str, sizeof(weight_str), "Scale: %dg", weight_int);
-                lv_label_set_text(scale_label, weight_str);
-            }
-            lv_obj_set_style_text_color(scale_label, lv_color_hex(COLOR_WHITE), 0);
-        } else {
-            lv_label_set_text(scale_label, "Scale: N/A");
-            lv_obj_set_style_text_color(scale_label, lv_color_hex(COLOR_GRAY), 0);
-        }
-    }
+    STATUS_LOG("Status bar initialized for %s", is_main_screen ? "main_screen" : "ams_overview");
 }
 
 void ui_status_bar_cleanup(void) {
@@ -414,8 +380,18 @@ void ui_status_bar_cleanup(void) {
     active_tray_label = NULL;
     nfc_label = NULL;
     scale_label = NULL;
-    weight_initialized = false;
-    last_displayed_weight = 0.0f;
 
     STATUS_LOG("Status bar cleaned up");
 }
+
+void ui_status_bar_detach(void) {
+    lv_obj_t *elements[] = {
+        backend_dot, backend_label, active_tray_badge, active_tray_label, nfc_label, scale_label,
+    };
+    for (size_t i = 0; i < sizeof(elements) / sizeof(elements[0]); i++) {
+        if (elements[i]) {
+            lv_obj_delete(elements[i]);
+        }
+    }
+    ui_status_bar_cleanup();
+}
@@ -6,6 +6,8 @@
  * - Left: Backend connection status (green/red dot)
  * - Center: Active tray color badge + material type
  * - Right: NFC status + Scale weight
+ *
+ * Elements are bound to the ui_state subjects, no periodic update needed.
  */
 
 #ifndef UI_STATUS_BAR_H
@@ -21,16 +23,17 @@
  */
 void ui_status_bar_init(bool is_main_screen);
 
-/**
- * Update status bar with current state.
- * Call periodically from ui_tick.
- */
-void ui_status_bar_update(void);
-
 /**
  * Cleanup status bar elements.
  * Call before screen deletion.
  */
 void ui_status_bar_cleanup(void);
 
+/**
+ * Delete status bar elements and clear pointers.
+ * Call when leaving a screen that stays alive (screen cache), so the
+ * elements aren't duplicated when the status bar is initialized there again.
+ */
+void ui_status_bar_detach(void);
+
 #endif /* UI_STATUS_BAR_H */
@@ -0,0 +1,412 @@
+/**
+ * SpoolBuddy Shared I2C Bus Manager
+ * Callers queue transactions by priority; a single worker task runs them one
+ * at a time, always taking the highest-priority pending one next.
+ */
+
+#include "i2c_bus.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+
+// Driver backend, selected with CONFIG_I2C_BUS_DRIVER (menuconfig)
+// 0 = legacy driver/i2c.h (default). esp-idf-hal drives I2C1 (scale, NFC
+//     bridge) with the legacy driver, and ESP-IDF 5.2 aborts at startup if
+//     the legacy and the new driver are linked into the same image.
+// 1 = new driver/i2c_master.h (per-device clocks, async-capable) - use once
+//     the Rust side moves to the new driver as well.
+#ifndef I2C_BUS_NG_DRIVER
+#ifdef CONFIG_I2C_BUS_DRIVER_NG
+#define I2C_BUS_NG_DRIVER 1
+#else
+#define I2C_BUS_NG_DRIVER 0
+#endif
+#endif
+
+#if I2C_BUS_NG_DRIVER
+#include "driver/i2c_master.h"
+#else
+#include "driver/i2c.h"
+#endif
+
+static const char *TAG = "i2c_bus";
+
+#define I2C_BUS_MAX_DEVICES     8
+#define I2C_BUS_QUEUE_LEN       8       // Per priority
+#define I2C_BUS_TASK_STACK      3072
+#define I2C_BUS_TASK_PRIO       10      // Above touch/render so queued work drains promptly
+#define I2C_BUS_WAIT_MARGIN_MS  200     // Extra wait for the transactions queued ahead
+
+struct i2c_bus_device {
+    uint8_t addr;
+    const char *name;
+    i2c_bus_prio_t prio;
+    i2c_bus_stats_t stats;
+#if I2C_BUS_NG_DRIVER
+    i2c_master_dev_handle_t handle;
+#endif
+};
+
+// Queued transaction. Heap-allocated with copies of the tx/rx data, so a
+// caller that gives up waiting can hand it over to the worker to free.
+typedef struct {
+    i2c_bus_dev_t dev;          // NULL = address probe
+    uint8_t addr;
+    const uint8_t *tx;          // Points into data[]
+    size_t tx_len;
+    uint8_t *rx;                // Points into data[]
+    size_t rx_len;
+    int timeout_ms;
+    int64_t queued_us;
+    esp_err_t result;
+    bool finished;              // Set by the worker (bus_lock)
+    bool abandoned;             // Set by a caller that timed out (bus_lock)
+    SemaphoreHandle_t done;
+    StaticSemaphore_t done_buf;
+    uint8_t data[];
+} i2c_bus_req_t;
+
+static bool bus_ready = false;
+static int bus_port = 0;
+static uint32_t bus_freq_hz = 0;
+#if I2C_BUS_NG_DRIVER
+static i2c_master_bus_handle_t bus_handle = NULL;
+#endif
+
+static QueueHandle_t bus_queues[I2C_BUS_PRIO_COUNT];
+static SemaphoreHandle_t bus_pending = NULL;   // Counts queued transactions
+
+static struct i2c_bus_device devices[I2C_BUS_MAX_DEVICES];
+static int device_count = 0;
+static portMUX_TYPE bus_lock = portMUX_INITIALIZER_UNLOCKED;   // Device table + stats
+
+/**
+ * Run one transaction on the hardware (worker task only)
+ */
+static esp_err_t bus_xfer(const i2c_bus_req_t *req)
+{
+#if I2C_BUS_NG_DRIVER
+    if (req->dev == NULL) {
+        return i2c_master_probe(bus_handle, req->addr, req->timeout_ms);
+    }
+    i2c_master_dev_handle_t handle = req->dev->handle;
+    if (req->tx_len > 0 && req->rx_len > 0) {
+        return i2c_master_transmit_receive(handle, req->tx, req->tx_len,
+                                           req->rx, req->rx_len, req->timeout_ms);
+    }
+    if (req->tx_len > 0) {
+        return i2c_master_transmit(handle, req->tx, req->tx_len, req->timeout_ms);
+    }
+    return i2c_master_receive(handle, req->rx, req->rx_len, req->timeout_ms);
+#else
+    TickType_t ticks = pdMS_TO_TICKS(req->timeout_ms);
+    if (ticks == 0) {
+        ticks = 1;
+    }
+    if (req->dev == NULL) {
+        uint8_t dummy;
+        return i2c_master_read_from_device(bus_port, req->addr, &dummy, 1, ticks);
+    }
+    if (req->tx_len > 0 && req->rx_len > 0) {
+        return i2c_master_write_read_device(bus_port, req->addr, req->tx, req->tx_len,
+                                            req->rx, req->rx_len, ticks);
+    }
+    if (req->tx_len > 0) {
+        return i2c_master_write_to_device(bus_port, req->addr, req->tx, req->tx_len, ticks);
+    }
+    return i2c_master_read_from_device(bus_port, req->addr, req->rx, req->rx_len, ticks);
+#endif
+}
+
+/**
+ * Account one finished transaction
+ */
+static void record_stats(i2c_bus_dev_t dev, int64_t queued_us, int64_t start_us, esp_err_t result)
+{
+    uint32_t latency_us = (uint32_t)(esp_timer_get_time() - queued_us);
+    uint32_t wait_us = (uint32_t)(start_us - queued_us);
+
+    taskENTER_CRITICAL(&bus_lock);
+    i2c_bus_stats_t *st = &dev->stats;
+    st->transactions++;
+    if (result == ESP_ERR_TIMEOUT) {
+        st->timeouts++;
+    } else if (result != ESP_OK) {
+        st->errors++;
+    }
+    st->latency_sum_us += latency_us;
+    if (latency_us > st->latency_max_us) {
+        st->latency_max_us = latency_us;
+    }
+    if (wait_us > st->wait_max_us) {
+        st->wait_max_us = wait_us;
+    }
+    taskEXIT_CRITICAL(&bus_lock);
+}
+
+/**
+ * Bus worker - one transaction at a time, highest priority first
+ */
+static void bus_task(void *arg)
+{
+    while (1) {
+        xSemaphoreTake(bus_pending, portMAX_DELAY);
+
+        i2c_bus_req_t *req = NULL;
+        for (int p = 0; p < I2C_BUS_PRIO_COUNT; p++) {
+            if (xQueueReceive(bus_queues[p], &req, 0) == pdTRUE) {
+                break;
+            }
+        }
+        if (req == NULL) {
+            continue;
+        }
+
+        taskENTER_CRITICAL(&bus_lock);
+        bool abandoned = req->abandoned;
+        taskEXIT_CRITICAL(&bus_lock);
+        if (abandoned) {
+            free(req);      // Caller gave up before it ran
+            continue;
+        }
+
+        int64_t start_us = esp_timer_get_time();
+        req->result = bus_xfer(req);
+        if (req->dev != NULL) {
+            record_stats(req->dev, req->queued_us, start_us, req->result);
+        }
+
+        taskENTER_CRITICAL(&bus_lock);
+        abandoned = req->abandoned;
+        req->finished = true;
+        taskEXIT_CRITICAL(&bus_lock);
+        if (abandoned) {
+            free(req);
+        } else {
+            xSemaphoreGive(req->done);
+        }
+    }
+}
+
+/**
+ * Queue a transaction and wait for the worker to run it
+ *
+ * The wait is bounded: if the transaction hasn't finished within its own
+ * timeout plus I2C_BUS_WAIT_MARGIN_MS (e.g. the bus is stuck on another
+ * device), it's left to the worker to drop and ESP_ERR_TIMEOUT is returned.
+ */
+static esp_err_t bus_submit(i2c_bus_dev_t dev, uint8_t addr, const uint8_t *tx, size_t tx_len,
+                            uint8_t *rx, size_t rx_len, int timeout_ms, i2c_bus_prio_t prio)
+{
+    if (!bus_ready) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    i2c_bus_req_t *req = calloc(1, sizeof(*req) + tx_len + rx_len);
+    if (req == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (tx_len > 0) {
+        memcpy(req->data, tx, tx_len);
+    }
+    req->dev = dev;
+    req->addr = addr;
+    req->tx = req->data;
+    req->tx_len = tx_len;
+    req->rx = req->data + tx_len;
+    req->rx_len = rx_len;
+    req->timeout_ms = timeout_ms;
+    req->done = xSemaphoreCreateBinaryStatic(&req->done_buf);
+    req->queued_us = esp_timer_get_time();
+
+    if (xQueueSend(bus_queues[prio], &req, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+        if (dev != NULL) {
+            record_stats(dev, req->queued_us, esp_timer_get_time(), ESP_ERR_TIMEOUT);
+        }
+        free(req);
+        return ESP_ERR_TIMEOUT;
+    }
+    xSemaphoreGive(bus_pending);
+
+    if (xSemaphoreTake(req->done, pdMS_TO_TICKS(timeout_ms + I2C_BUS_WAIT_MARGIN_MS)) != pdTRUE) {
+        taskENTER_CRITICAL(&bus_lock);
+        bool finished = req->finished;
+        req->abandoned = !finished;
+        taskEXIT_CRITICAL(&bus_lock);
+        if (!finished) {
+            ESP_LOGW(TAG, "0x%02X: no result after %dms, giving up", addr,
+                     timeout_ms + I2C_BUS_WAIT_MARGIN_MS);
+            return ESP_ERR_TIMEOUT;     // The worker frees req
+        }
+        // Finished just now - done is about to be given
+        xSemaphoreTake(req->done, portMAX_DELAY);
+    }
+
+    esp_err_t result = req->result;
+    if (result == ESP_OK && rx_len > 0) {
+        memcpy(rx, req->rx, rx_len);
+    }
+    free(req);
+    return result;
+}
+
+esp_err_t i2c_bus_init(const i2c_bus_config_t *config)
+{
+    if (bus_ready) {
+        return ESP_OK;
+    }
+
+    bus_port = config->port;
+    bus_freq_hz = config->freq_hz;
+
+#if I2C_BUS_NG_DRIVER
+    i2c_master_bus_config_t bus_config = {
+        .i2c_port = config->port,
+        .sda_io_num = config->sda_gpio,
+        .scl_io_num = config->scl_gpio,
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .glitch_ignore_cnt = 7,
+        .flags.enable_internal_pullup = true,
+    };
+    esp_err_t err = i2c_new_master_bus(&bus_config, &bus_handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+#else
+    i2c_config_t conf = {
+        .mode = I2C_MODE_MASTER,
+        .sda_io_num = config->sda_gpio,
+        .scl_io_num = config->scl_gpio,
+        .sda_pullup_en = GPIO_PULLUP_ENABLE,
+        .scl_pullup_en = GPIO_PULLUP_ENABLE,
+        .master.clk_speed = config->freq_hz,
+    };
+    esp_err_t err = i2c_param_config(config->port, &conf);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = i2c_driver_install(config->port, conf.mode, 0, 0, 0);
+    if (err != ESP_OK) {
+        return err;
+    }
+#endif
+
+    for (int p = 0; p < I2C_BUS_PRIO_COUNT; p++) {
+        bus_queues[p] = xQueueCreate(I2C_BUS_QUEUE_LEN, sizeof(i2c_bus_req_t *));
+        if (bus_queues[p] == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    bus_pending = xSemaphoreCreateCounting(I2C_BUS_PRIO_COUNT * I2C_BUS_QUEUE_LEN, 0);
+    if (bus_pending == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (xTaskCreate(bus_task, "i2c_bus", I2C_BUS_TASK_STACK, NULL,
+                    I2C_BUS_TASK_PRIO, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    bus_ready = true;
+    ESP_LOGI(TAG, "I2C%d ready at %lukHz (%s driver)", config->port,
+             (unsigned long)(config->freq_hz / 1000), I2C_BUS_NG_DRIVER ? "new" : "legacy");
+    return ESP_OK;
+}
+
+bool i2c_bus_is_ready(void)
+{
+    return bus_ready;
+}
+
+i2c_bus_dev_t i2c_bus_add_device(uint8_t addr, const char *name, i2c_bus_prio_t prio, uint32_t scl_hz)
+{
+    if (!bus_ready || prio >= I2C_BUS_PRIO_COUNT) {
+        return NULL;
+    }
+
+    taskENTER_CRITICAL(&bus_lock);
+    if (device_count >= I2C_BUS_MAX_DEVICES) {
+        taskEXIT_CRITICAL(&bus_lock);
+        ESP_LOGE(TAG, "Device table full, can't add %s (0x%02X)", name, addr);
+        return NULL;
+    }
+    i2c_bus_dev_t dev = &devices[device_count++];
+    memset(dev, 0, sizeof(*dev));
+    dev->addr = addr;
+    dev->name = name;
+    dev->prio = prio;
+    taskEXIT_CRITICAL(&bus_lock);
+
+#if I2C_BUS_NG_DRIVER
+    i2c_device_config_t dev_config = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = addr,
+        .scl_speed_hz = scl_hz ? scl_hz : bus_freq_hz,
+    };
+    if (i2c_master_bus_add_device(bus_handle, &dev_config, &dev->handle) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to add %s (0x%02X)", name, addr);
+        return NULL;  // Slot stays used; devices are only added at boot
+    }
+#else
+    (void)scl_hz;   // Legacy driver runs every device at the bus clock
+#endif
+
+    return dev;
+}
+
+esp_err_t i2c_bus_write_read(i2c_bus_dev_t dev, const uint8_t *tx, size_t tx_len,
+                             uint8_t *rx, size_t rx_len, int timeout_ms)
+{
+    if (dev == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return bus_submit(dev, dev->addr, tx, tx_len, rx, rx_len, timeout_ms, dev->prio);
+}
+
+esp_err_t i2c_bus_write(i2c_bus_dev_t dev, const uint8_t *tx, size_t tx_len, int timeout_ms)
+{
+    return i2c_bus_write_read(dev, tx, tx_len, NULL, 0, timeout_ms);
+}
+
+esp_err_t i2c_bus_read(i2c_bus_dev_t dev, uint8_t *rx, size_t rx_len, int timeout_ms)
+{
+    return i2c_bus_write_read(dev, NULL, 0, rx, rx_len, timeout_ms);
+}
+
+bool i2c_bus_probe(uint8_t addr, int timeout_ms)
+{
+    return bus_submit(NULL, addr, NULL, 0, NULL, 0, timeout_ms, I2C_BUS_PRIO_BULK) == ESP_OK;
+}
+
+void i2c_bus_get_stats(i2c_bus_dev_t dev, i2c_bus_stats_t *stats)
+{
+    if (dev == NULL || stats == NULL) {
+        return;
+    }
+    taskENTER_CRITICAL(&bus_lock);
+    *stats = dev->stats;
+    taskEXIT_CRITICAL(&bus_lock);
+}
+
+void i2c_bus_log_stats(void)
+{
+    for (int i = 0; i < device_count; i++) {
+        i2c_bus_stats_t st;
+        i2c_bus_get_stats(&devices[i], &st);
+        if (st.transactions == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "%-9s 0x%02X: %lu xfers, %lu err, %lu timeout, latency avg=%lluus max=%luus, wait max=%luus",
+                 devices[i].name, devices[i].addr, (unsigned long)st.transactions,
+                 (unsigned long)st.errors, (unsigned long)st.timeouts,
+                 (unsigned long long)(st.latency_sum_us / st.transactions),
+                 (unsigned long)st.latency_max_us, (unsigned long)st.wait_max_us);
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * SpoolBuddy Shared I2C Bus Manager
+ * One worker task owns the bus and runs queued transactions in priority
+ * order, with per-device latency and error statistics
+ *
+ * Only the bus passed to i2c_bus_init() (I2C0: GT911 touch, STC8H backlight
+ * and the boot-time NFC bridge probe) is arbitrated here. I2C1 - the scale
+ * and the runtime NFC bridge traffic - is driven from Rust through
+ * esp-idf-hal under its own shared_i2c mutex and isn't queued, prioritized
+ * or counted by this manager.
+ */
+
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Transaction priority (lower value runs first)
+ * A long low-priority sequence (e.g. an NFC bridge command + response) is
+ * made of separate transactions, so touch reads slot in between them.
+ */
+typedef enum {
+    I2C_BUS_PRIO_TOUCH = 0,     // Touch controller - latency critical
+    I2C_BUS_PRIO_CONTROL,       // Short control writes (backlight)
+    I2C_BUS_PRIO_BULK,          // Bus scans, boot-time NFC bridge probe
+    I2C_BUS_PRIO_COUNT,
+} i2c_bus_prio_t;
+
+/**
+ * Bus configuration
+ */
+typedef struct {
+    int port;               // I2C controller number
+    int sda_gpio;
+    int scl_gpio;
+    uint32_t freq_hz;       // Bus clock (default for devices)
+} i2c_bus_config_t;
+
+/**
+ * Per-device statistics
+ * Latency is measured from queueing a transaction to its completion, so it
+ * includes time spent waiting behind other devices.
+ */
+typedef struct {
+    uint32_t transactions;
+    uint32_t errors;        // NACK / bus errors
+    uint32_t timeouts;
+    uint64_t latency_sum_us;    // Divide by transactions for the average
+    uint32_t latency_max_us;
+    uint32_t wait_max_us;       // Longest wait before the transfer started
+} i2c_bus_stats_t;
+
+typedef struct i2c_bus_device *i2c_bus_dev_t;
+
+/**
+ * Install the bus driver and start the worker task
+ *
+ * @return ESP_OK, or the driver error
+ */
+esp_err_t i2c_bus_init(const i2c_bus_config_t *config);
+
+/**
+ * Check whether i2c_bus_init() succeeded
+ */
+bool i2c_bus_is_ready(void);
+
+/**
+ * Register a device
+ *
+ * @param addr 7-bit address
+ * @param name Short name for the statistics log (must stay valid)
+ * @param prio Priority of all transactions to this device
+ * @param scl_hz Device clock, 0 = bus clock (only honoured by the new driver)
+ * @return Device handle, NULL if the table is full or the bus isn't ready
+ */
+i2c_bus_dev_t i2c_bus_add_device(uint8_t addr, const char *name, i2c_bus_prio_t prio, uint32_t scl_hz);
+
+/**
+ * Write then read in one transaction (repeated start)
+ *
+ * Waits at most timeout_ms plus a short margin for the transactions queued
+ * ahead, then returns ESP_ERR_TIMEOUT. The same holds for the calls below.
+ */
+esp_err_t i2c_bus_write_read(i2c_bus_dev_t dev, const uint8_t *tx, size_t tx_len,
+                             uint8_t *rx, size_t rx_len, int timeout_ms);
+
+/**
+ * Write to a device
+ */
+esp_err_t i2c_bus_write(i2c_bus_dev_t dev, const uint8_t *tx, size_t tx_len, int timeout_ms);
+
+/**
+ * Read from a device
+ */
+esp_err_t i2c_bus_read(i2c_bus_dev_t dev, uint8_t *rx, size_t rx_len, int timeout_ms);
+
+/**
+ * Check whether an address ACKs (bulk priority, not counted per device)
+ */
+bool i2c_bus_probe(uint8_t addr, int timeout_ms);
+
+/**
+ * Get statistics for one device
+ */
+void i2c_bus_get_stats(i2c_bus_dev_t dev, i2c_bus_stats_t *stats);
+
+/**
+ * Log statistics for all registered devices
+ */
+void i2c_bus_log_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I2C_BUS_H */
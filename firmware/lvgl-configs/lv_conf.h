@@ -37,8 +37,21 @@
 /* Default Dot Per Inch */
 #define LV_DPI_DEF 130
 
-/* Enable OS abstraction layer */
+/* Software draw units. With 2, LVGL 9 dispatches draw tasks to two
+ * FreeRTOS render threads so rasterization uses both ESP32-S3 cores.
+ * 1 renders in the calling task without an OS layer (the old behaviour).
+ * Set to 1 for a single-core comparison build. */
+#ifndef DISPLAY_DRAW_UNITS
+#define DISPLAY_DRAW_UNITS 2
+#endif
+
+/* Enable OS abstraction layer (needed for draw unit threads) */
+#if DISPLAY_DRAW_UNITS > 1
+#define LV_USE_OS LV_OS_FREERTOS
+#define LV_USE_FREERTOS_TASK_NOTIFY 1
+#else
 #define LV_USE_OS LV_OS_NONE
+#endif
 
 /*====================
    FEATURE CONFIGURATION
@@ -46,6 +59,19 @@
 
 /* Drawing engine features */
 #define LV_USE_DRAW_SW 1
+#define LV_DRAW_SW_DRAW_UNIT_CNT DISPLAY_DRAW_UNITS
+#define LV_DRAW_THREAD_STACK_SIZE (8 * 1024)  /* Per draw thread, shadows/masks need headroom */
+
+/* Last blurred shadow corner per draw unit (SIZE^2 bytes each). Hits when
+ * consecutive shadows share width and radius and width + radius <= SIZE:
+ * the AMS containers are 5 + 10, the EEZ panels 1 + 10. Objects baked by
+ * ui_shadow.c don't use it. */
+#define LV_DRAW_SW_SHADOW_CACHE_SIZE 24
+
+/* Decoded image cache. Indexed ui_image_*.c assets are decoded to ARGB8888
+ * once and kept here (~54 KB, see tools/convert_eez_images.py); A8, RGB565
+ * and RGB565A8 assets are drawn from flash and don't use it. */
+#define LV_CACHE_DEF_SIZE (64U * 1024U)
 
 /* Enable vector graphics */
 #define LV_USE_VECTOR_GRAPHIC 0
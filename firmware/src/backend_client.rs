@@ -16,6 +16,10 @@ const MAX_PRINTERS: usize = 4;
 /// Maximum number of AMS units per printer
 const MAX_AMS_UNITS: usize = 4;
 
+/// AMS unit slots per printer in the C snapshot (must match BACKEND_SNAPSHOT_MAX_AMS)
+const SNAPSHOT_MAX_AMS: usize = 8;
+const _: () = assert!(MAX_AMS_UNITS <= SNAPSHOT_MAX_AMS);
+
 /// HTTP timeout in milliseconds
 const HTTP_TIMEOUT_MS: u64 = 5000;
 
@@ -63,7 +67,6 @@ struct ApiPrinter {
     print_progress: Option<u8>,
     subtask_name: Option<String>,
     mc_remaining_time: Option<u16>,
-    cover_url: Option<String>,
     stg_cur: Option<i8>,           // Current stage number (-1 = idle)
     stg_cur_name: Option<String>,  // Human-readable stage name
     #[serde(default)]
@@ -82,7 +85,7 @@ struct ApiTime {
 }
 
 /// Cached AMS tray info
-#[derive(Debug, Clone, Copy, Default)]
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
 struct CachedAmsTray {
     tray_type: [u8; 16],    // Material type
     tray_color: u32,        // RGBA packed (0xRRGGBBAA)
@@ -90,7 +93,7 @@ struct CachedAmsTray {
 }
 
 /// Cached AMS unit info
-#[derive(Debug, Clone, Copy)]
+#[derive(Debug, Clone, Copy, PartialEq)]
 struct CachedAmsUnit {
     id: i32,
     humidity: i32,          // -1 if not available
@@ -114,7 +117,7 @@ impl Default for CachedAmsUnit {
 }
 
 /// Cached printer info (internal)
-#[derive(Debug, Clone)]
+#[derive(Debug, Clone, PartialEq)]
 struct CachedPrinter {
     name: [u8; 32],
     serial: [u8; 20],
@@ -166,6 +169,11 @@ struct BackendManager {
     server_url: String,
     printers: [CachedPrinter; MAX_PRINTERS],
     printer_count: usize,
+    // Snapshot generations: bumped from one global counter whenever the data
+    // changes, so a value is never reused (0 = never filled)
+    generation: u32,
+    printer_gens: [u32; MAX_PRINTERS],
+    ams_gens: [[u32; MAX_AMS_UNITS]; MAX_PRINTERS],
 }
 
 const EMPTY_AMS_TRAY: CachedAmsTray = CachedAmsTray {
@@ -210,18 +218,24 @@ impl BackendManager {
             server_url: String::new(),
             printers: [EMPTY_PRINTER; MAX_PRINTERS],
             printer_count: 0,
+            generation: 0,
+            printer_gens: [0; MAX_PRINTERS],
+            ams_gens: [[0; MAX_AMS_UNITS]; MAX_PRINTERS],
         }
     }
+
+    /// Hand out the next snapshot generation (never 0)
+    fn next_generation(&mut self) -> u32 {
+        self.generation = self.generation.wrapping_add(1).max(1);
+        self.generation
+    }
 }
 
 // Global backend manager
 static BACKEND_MANAGER: Mutex<BackendManager> = Mutex::new(BackendManager::new());
 
-// Cover image storage (max 64KB for thumbnail)
-const MAX_COVER_SIZE: usize = 65536;
-static COVER_DATA: Mutex<Vec<u8>> = Mutex::new(Vec::new());
-static COVER_VALID: std::sync::atomic::AtomicBool = std::sync::atomic::AtomicBool::new(false);
-static LAST_COVER_URL: Mutex<String> = Mutex::new(String::new());
+/// Cover image download timeout (the backend may have to fetch the 3MF first)
+const COVER_TIMEOUT_MS: u64 = 10000;
 
 /// Initialize the backend client
 pub fn init() {
@@ -277,13 +291,9 @@ pub fn poll_backend() {
 
     // Fetch printers
     let printers_url = format!("{}/api/printers", base_url);
-    let mut cover_url_to_fetch: Option<String> = None;
 
     match fetch_printers(&printers_url) {
         Ok(printers) => {
-            // Check if cover URL changed before updating cache
-            cover_url_to_fetch = check_cover_url_changed(&printers, &base_url);
-
             let mut manager = BACKEND_MANAGER.lock().unwrap();
             update_printer_cache(&mut manager, &printers);
         }
@@ -292,11 +302,6 @@ pub fn poll_backend() {
         }
     }
 
-    // Fetch cover image if URL changed (outside of lock)
-    if let Some(url) = cover_url_to_fetch {
-        fetch_cover_image(&url);
-    }
-
     // Fetch time from backend
     fetch_and_set_time(&base_url);
 }
@@ -724,11 +729,22 @@ fn parse_rgba_color(color: &str) -> u32 {
 }
 
 fn update_printer_cache(manager: &mut BackendManager, printers: &[ApiPrinter]) {
-    manager.printer_count = printers.len().min(MAX_PRINTERS);
+    let printer_count = printers.len().min(MAX_PRINTERS);
+    if printer_count != manager.printer_count {
+        // Forget printers that dropped out, so one reappearing later gets a new generation
+        for i in printer_count..MAX_PRINTERS {
+            manager.printers[i] = EMPTY_PRINTER;
+            manager.printer_gens[i] = 0;
+            manager.ams_gens[i] = [0; MAX_AMS_UNITS];
+        }
+        manager.next_generation();
+    }
+    manager.printer_count = printer_count;
 
     info!("Updating printer cache with {} printers", printers.len());
 
     for (i, printer) in printers.iter().take(MAX_PRINTERS).enumerate() {
+        let before = manager.printers[i].clone();
         let cached = &mut manager.printers[i];
 
         info!("Printer {}: serial={}, name={:?}, connected={}",
@@ -841,101 +857,18 @@ fn update_printer_cache(manager: &mut BackendManager, printers: &[ApiPrinter]) {
                 cached_tray.remain = tray.remain.unwrap_or(0).max(0) as u8;
             }
         }
-    }
-
-}
 
-/// Check if cover URL changed and return the new URL if so
-fn check_cover_url_changed(printers: &[ApiPrinter], base_url: &str) -> Option<String> {
-    if let Some(printer) = printers.first() {
-        if let Some(ref cover_url) = printer.cover_url {
-            let mut last_url = LAST_COVER_URL.lock().unwrap();
-            if *last_url != *cover_url {
-                // Cover URL changed
-                *last_url = cover_url.clone();
-                return Some(format!("{}{}", base_url, cover_url));
+        // Bump generations of whatever changed (the printer's also covers its AMS units)
+        for j in 0..MAX_AMS_UNITS {
+            if manager.ams_gens[i][j] == 0 || before.ams_units[j] != manager.printers[i].ams_units[j] {
+                manager.ams_gens[i][j] = manager.next_generation();
             }
-        } else {
-            // No cover URL, invalidate cover
-            COVER_VALID.store(false, std::sync::atomic::Ordering::Relaxed);
-            let mut last_url = LAST_COVER_URL.lock().unwrap();
-            last_url.clear();
         }
-    }
-    None
-}
-
-/// Fetch cover image from URL
-fn fetch_cover_image(url: &str) {
-    info!("Fetching cover image from: {}", url);
-
-    let config = HttpConfig {
-        timeout: Some(std::time::Duration::from_millis(10000)), // 10s timeout for image
-        ..Default::default()
-    };
-
-    let connection = match EspHttpConnection::new(&config) {
-        Ok(c) => c,
-        Err(e) => {
-            warn!("Cover fetch connection failed: {:?}", e);
-            COVER_VALID.store(false, std::sync::atomic::Ordering::Relaxed);
-            return;
-        }
-    };
-
-    let mut client = HttpClient::wrap(connection);
-
-    let request = match client.get(url) {
-        Ok(r) => r,
-        Err(e) => {
-            warn!("Cover fetch request failed: {:?}", e);
-            COVER_VALID.store(false, std::sync::atomic::Ordering::Relaxed);
-            return;
-        }
-    };
-
-    let mut response = match request.submit() {
-        Ok(r) => r,
-        Err(e) => {
-            warn!("Cover fetch submit failed: {:?}", e);
-            COVER_VALID.store(false, std::sync::atomic::Ordering::Relaxed);
-            return;
-        }
-    };
-
-    if response.status() != 200 {
-        warn!("Cover fetch HTTP error: {}", response.status());
-        COVER_VALID.store(false, std::sync::atomic::Ordering::Relaxed);
-        return;
-    }
-
-    // Read image data
-    let mut data = Vec::new();
-    let mut buf = [0u8; 1024];
-    loop {
-        match response.read(&mut buf) {
-            Ok(0) => break,
-            Ok(n) => {
-                if data.len() + n > MAX_COVER_SIZE {
-                    warn!("Cover image too large, truncating");
-                    break;
-                }
-                data.extend_from_slice(&buf[..n]);
-            }
-            Err(e) => {
-                warn!("Cover read error: {:?}", e);
-                COVER_VALID.store(false, std::sync::atomic::Ordering::Relaxed);
-                return;
-            }
+        if manager.printer_gens[i] == 0 || before != manager.printers[i] {
+            manager.printer_gens[i] = manager.next_generation();
         }
     }
 
-    info!("Downloaded cover image: {} bytes", data.len());
-
-    // Store cover data
-    let mut cover = COVER_DATA.lock().unwrap();
-    *cover = data;
-    COVER_VALID.store(true, std::sync::atomic::Ordering::Relaxed);
 }
 
 // ============================================================================
@@ -1024,53 +957,47 @@ pub extern "C" fn backend_get_printer(index: c_int, info: *mut PrinterInfo) -> c
     }
 
     let cached = &manager.printers[idx];
-
     unsafe {
-        // Copy name (already null-terminated due to zero init)
-        for (i, &b) in cached.name.iter().enumerate() {
-            (*info).name[i] = b as c_char;
-        }
-
-        // Copy serial
-        for (i, &b) in cached.serial.iter().enumerate() {
-            (*info).serial[i] = b as c_char;
-        }
-
-        // Copy IP address
-        for (i, &b) in cached.ip_address.iter().enumerate() {
-            (*info).ip_address[i] = b as c_char;
-        }
-
-        // Copy access code
-        for (i, &b) in cached.access_code.iter().enumerate() {
-            (*info).access_code[i] = b as c_char;
-        }
-
-        // Copy state
-        for (i, &b) in cached.gcode_state.iter().enumerate() {
-            (*info).gcode_state[i] = b as c_char;
-        }
+        fill_printer_info(cached, &mut *info);
+    }
 
-        // Copy subtask name
-        for (i, &b) in cached.subtask_name.iter().enumerate() {
-            (*info).subtask_name[i] = b as c_char;
-        }
+    0
+}
 
-        (*info).connected = cached.connected;
-        (*info).print_progress = cached.print_progress;
-        (*info).remaining_time_min = cached.remaining_time_min;
+/// Copy a cached printer into the C struct
+fn fill_printer_info(cached: &CachedPrinter, info: &mut PrinterInfo) {
+    // Copy strings (already null-terminated due to zero init)
+    for (i, &b) in cached.name.iter().enumerate() {
+        info.name[i] = b as c_char;
+    }
+    for (i, &b) in cached.serial.iter().enumerate() {
+        info.serial[i] = b as c_char;
+    }
+    for (i, &b) in cached.ip_address.iter().enumerate() {
+        info.ip_address[i] = b as c_char;
+    }
+    for (i, &b) in cached.access_code.iter().enumerate() {
+        info.access_code[i] = b as c_char;
+    }
+    for (i, &b) in cached.gcode_state.iter().enumerate() {
+        info.gcode_state[i] = b as c_char;
+    }
+    for (i, &b) in cached.subtask_name.iter().enumerate() {
+        info.subtask_name[i] = b as c_char;
+    }
 
-        // Copy stage info
-        (*info).stg_cur = cached.stg_cur;
-        for (i, &b) in cached.stg_cur_name.iter().enumerate() {
-            (*info).stg_cur_name[i] = b as c_char;
-        }
+    info.connected = cached.connected;
+    info.print_progress = cached.print_progress;
+    info.remaining_time_min = cached.remaining_time_min;
 
-        // Initialize padding
-        (*info)._pad = [0; 3];
+    // Copy stage info
+    info.stg_cur = cached.stg_cur;
+    for (i, &b) in cached.stg_cur_name.iter().enumerate() {
+        info.stg_cur_name[i] = b as c_char;
     }
 
-    0
+    // Initialize padding
+    info._pad = [0; 3];
 }
 
 /// Set backend server URL from C
@@ -1124,42 +1051,96 @@ pub extern "C" fn backend_get_printer_count() -> c_int {
     manager.printer_count as c_int
 }
 
-/// Check if cover image is available
-/// Returns 1 if valid cover exists, 0 otherwise
+/// Download the cover image (raw RGB565) of a printer's current job into buf
+/// Returns the number of bytes read, -1 on error or if the image doesn't fit.
+/// Blocking - the UI calls it from a worker task (ui_cover_cache.c).
 #[no_mangle]
-pub extern "C" fn backend_has_cover() -> c_int {
-    if COVER_VALID.load(std::sync::atomic::Ordering::Relaxed) {
-        1
-    } else {
-        0
+pub extern "C" fn backend_fetch_cover(serial: *const c_char, buf: *mut u8, buf_size: u32) -> c_int {
+    if serial.is_null() || buf.is_null() || buf_size == 0 {
+        return -1;
     }
-}
 
-/// Get cover image data
-/// Returns pointer to PNG data, or null if not available
-/// Size is written to size_out if provided
-#[no_mangle]
-pub extern "C" fn backend_get_cover_data(size_out: *mut u32) -> *const u8 {
-    if !COVER_VALID.load(std::sync::atomic::Ordering::Relaxed) {
-        if !size_out.is_null() {
-            unsafe { *size_out = 0; }
+    let serial_str = unsafe {
+        match std::ffi::CStr::from_ptr(serial).to_str() {
+            Ok(s) => s,
+            Err(_) => return -1,
         }
-        return std::ptr::null();
+    };
+    let out = unsafe { std::slice::from_raw_parts_mut(buf, buf_size as usize) };
+
+    let manager = BACKEND_MANAGER.lock().unwrap();
+    let base_url = manager.server_url.clone();
+    drop(manager);
+
+    if base_url.is_empty() {
+        return -1;
     }
 
-    let cover = COVER_DATA.lock().unwrap();
-    if cover.is_empty() {
-        if !size_out.is_null() {
-            unsafe { *size_out = 0; }
+    let url = format!("{}/api/printers/{}/cover", base_url, serial_str);
+    info!("Fetching cover image from: {}", url);
+
+    let config = HttpConfig {
+        timeout: Some(std::time::Duration::from_millis(COVER_TIMEOUT_MS)),
+        ..Default::default()
+    };
+
+    let connection = match EspHttpConnection::new(&config) {
+        Ok(c) => c,
+        Err(e) => {
+            warn!("Cover fetch connection failed: {:?}", e);
+            return -1;
         }
-        return std::ptr::null();
+    };
+
+    let mut client = HttpClient::wrap(connection);
+
+    let request = match client.get(&url) {
+        Ok(r) => r,
+        Err(e) => {
+            warn!("Cover fetch request failed: {:?}", e);
+            return -1;
+        }
+    };
+
+    let mut response = match request.submit() {
+        Ok(r) => r,
+        Err(e) => {
+            warn!("Cover fetch submit failed: {:?}", e);
+            return -1;
+        }
+    };
+
+    if response.status() != 200 {
+        warn!("Cover fetch HTTP error: {}", response.status());
+        return -1;
     }
 
-    if !size_out.is_null() {
-        unsafe { *size_out = cover.len() as u32; }
+    // Read straight into the caller's buffer
+    let mut total = 0;
+    loop {
+        if total == out.len() {
+            // Full - anything more means the image has the wrong size
+            let mut probe = [0u8; 1];
+            return match response.read(&mut probe) {
+                Ok(0) => total as c_int,
+                _ => {
+                    warn!("Cover image larger than {} bytes", out.len());
+                    -1
+                }
+            };
+        }
+        match response.read(&mut out[total..]) {
+            Ok(0) => break,
+            Ok(n) => total += n,
+            Err(e) => {
+                warn!("Cover read error: {:?}", e);
+                return -1;
+            }
+        }
     }
 
-    cover.as_ptr()
+    info!("Downloaded cover image: {} bytes", total);
+    total as c_int
 }
 
 // ============================================================================
@@ -1220,28 +1201,31 @@ pub extern "C" fn backend_get_ams_unit(
     }
 
     let ams = &printer.ams_units[ams_index as usize];
-
     unsafe {
-        let out = &mut *info;
-        out.id = ams.id;
-        out.humidity = ams.humidity;
-        out.temperature = ams.temperature;
-        out.extruder = ams.extruder;
-        out.tray_count = ams.tray_count;
-
-        for (i, tray) in ams.trays.iter().enumerate() {
-            out.trays[i].tray_type = [0; 16];
-            for (j, &byte) in tray.tray_type.iter().enumerate() {
-                out.trays[i].tray_type[j] = byte as c_char;
-            }
-            out.trays[i].tray_color = tray.tray_color;
-            out.trays[i].remain = tray.remain;
-        }
+        fill_ams_unit_info(ams, &mut *info);
     }
 
     0
 }
 
+/// Copy a cached AMS unit into the C struct
+fn fill_ams_unit_info(ams: &CachedAmsUnit, out: &mut AmsUnitCInfo) {
+    out.id = ams.id;
+    out.humidity = ams.humidity;
+    out.temperature = ams.temperature;
+    out.extruder = ams.extruder;
+    out.tray_count = ams.tray_count;
+
+    for (i, tray) in ams.trays.iter().enumerate() {
+        out.trays[i].tray_type = [0; 16];
+        for (j, &byte) in tray.tray_type.iter().enumerate() {
+            out.trays[i].tray_type[j] = byte as c_char;
+        }
+        out.trays[i].tray_color = tray.tray_color;
+        out.trays[i].remain = tray.remain;
+    }
+}
+
 /// AMS tray info with string color (for status_bar.c hex parsing)
 #[repr(C)]
 pub struct AmsTrayInfo {
@@ -1345,6 +1329,82 @@ pub extern "C" fn backend_get_active_extruder(printer_index: c_int) -> c_int {
     manager.printers[printer_index as usize].active_extruder
 }
 
+// ============================================================================
+// Snapshot FFI
+// ============================================================================
+
+/// AMS unit entry of a snapshot
+#[repr(C)]
+pub struct BackendAmsSnapshot {
+    pub generation: u32,          // Changes whenever this unit's data changes
+    pub info: AmsUnitCInfo,
+}
+
+/// Printer entry of a snapshot
+#[repr(C)]
+pub struct BackendPrinterSnapshot {
+    pub generation: u32,          // Changes whenever the printer or any of its AMS units changes
+    pub info: PrinterInfo,
+    pub tray_now: c_int,          // -1 if not available
+    pub tray_now_left: c_int,
+    pub tray_now_right: c_int,
+    pub active_extruder: c_int,   // -1 if not available, 0=right, 1=left
+    pub ams_count: u8,
+    pub _pad: [u8; 3],
+    pub ams: [BackendAmsSnapshot; SNAPSHOT_MAX_AMS],
+}
+
+/// State of all printers and their AMS units in one structure
+#[repr(C)]
+pub struct BackendSnapshot {
+    pub generation: u32,          // Latest generation handed out (0 = no data yet)
+    pub printer_count: u8,
+    pub _pad: [u8; 3],
+    pub printers: [BackendPrinterSnapshot; MAX_PRINTERS],
+}
+
+/// Fill a snapshot of all printers and AMS units under one lock
+/// Entries whose generation already matches are left untouched, so pass the
+/// same (zero-initialized) buffer on every call to only copy what changed.
+#[no_mangle]
+pub extern "C" fn backend_get_snapshot(snapshot: *mut BackendSnapshot) {
+    if snapshot.is_null() {
+        return;
+    }
+
+    let manager = BACKEND_MANAGER.lock().unwrap();
+    let snap = unsafe { &mut *snapshot };
+
+    snap.generation = manager.generation;
+    snap.printer_count = manager.printer_count as u8;
+    snap._pad = [0; 3];
+
+    for i in 0..manager.printer_count {
+        let out = &mut snap.printers[i];
+        if out.generation == manager.printer_gens[i] {
+            continue;
+        }
+
+        let cached = &manager.printers[i];
+        fill_printer_info(cached, &mut out.info);
+        out.tray_now = cached.tray_now;
+        out.tray_now_left = cached.tray_now_left;
+        out.tray_now_right = cached.tray_now_right;
+        out.active_extruder = cached.active_extruder;
+        out.ams_count = cached.ams_unit_count;
+        out._pad = [0; 3];
+
+        for j in 0..cached.ams_unit_count as usize {
+            if out.ams[j].generation != manager.ams_gens[i][j] {
+                fill_ams_unit_info(&cached.ams_units[j], &mut out.ams[j].info);
+                out.ams[j].generation = manager.ams_gens[i][j];
+            }
+        }
+
+        out.generation = manager.printer_gens[i];
+    }
+}
+
 /// Check if firmware update is available
 /// Returns 1 if update available, 0 otherwise
 #[no_mangle]
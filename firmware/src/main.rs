@@ -47,7 +47,9 @@ const NFC_ENABLED: bool = false;
 extern "C" {
     fn display_init() -> i32;
     fn display_tick();
+    fn display_start_render_task() -> i32;
     fn display_set_backlight_hw(brightness_percent: u8);
+    fn display_set_idle_timeout(timeout_ms: u32);
 }
 
 // =============================================================================
@@ -77,6 +79,8 @@ pub extern "C" fn display_get_brightness() -> u8 {
 pub extern "C" fn display_set_timeout(timeout_seconds: u16) {
     unsafe {
         DISPLAY_TIMEOUT = timeout_seconds;
+        // Render task goes idle (backlight off, no rendering) after this
+        display_set_idle_timeout(timeout_seconds as u32 * 1000);
     }
     info!("Display timeout set to {} seconds", timeout_seconds);
 }
@@ -190,6 +194,18 @@ fn main() {
         }
     }
 
+    // Hand LVGL to its own task on core 1 so NFC/scale polling below can't
+    // stall rendering (and vice versa). Fall back to ticking from this loop.
+    let render_task_running = unsafe { display_start_render_task() } == 0;
+    if render_task_running {
+        info!("LVGL render task started");
+        unsafe {
+            display_set_idle_timeout(DISPLAY_TIMEOUT as u32 * 1000);
+        }
+    } else {
+        warn!("LVGL render task failed to start, ticking from main loop");
+    }
+
     // Initialize shared I2C bus on UART1-OUT port
     // UART1-OUT pinout: IO19-RX1, IO20-TX1, 3V3, GND
     // Using: GPIO19=SDA, GPIO20=SCL
@@ -1091,8 +1107,10 @@ fn main() {
 
     // Main loop
     loop {
-        unsafe {
-            display_tick();
+        if !render_task_running {
+            unsafe {
+                display_tick();
+            }
         }
 
         // Poll scale every 10 iterations (~50ms at 5ms delay)
@@ -12,6 +12,11 @@ use crate::shared_i2c;
 /// Global NFC state protected by mutex
 static NFC_STATE: Mutex<Option<NfcBridgeState>> = Mutex::new(None);
 
+// Display driver (C) - wake the screen when a spool is presented
+extern "C" {
+    fn display_wake();
+}
+
 /// NFC status for C code
 #[repr(C)]
 pub struct NfcStatus {
@@ -133,6 +138,10 @@ pub fn poll_nfc() {
         }
     } // Release NFC_STATE lock and I2C lock here
 
+    if tag_just_appeared {
+        unsafe { display_wake(); }
+    }
+
     // Now make HTTP calls outside the locks
     if tag_just_appeared || tag_data_decoded {
         let weight = crate::scale_manager::scale_get_weight();
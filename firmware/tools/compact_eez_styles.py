@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+"""
+SpoolBuddy EEZ Style Compaction
+
+EEZ Studio applies every style property as a local style
+(lv_obj_set_style_*). Each local style costs a heap allocation per widget
+and is resolved separately at render time. Top bars, bottom bars, buttons
+and panels repeat the same property set on every screen.
+
+This tool post-processes the generated screens.c: widgets whose complete
+property set (per part/state selector) is repeated are switched to one
+shared static lv_style_t, initialized once and attached with
+lv_obj_add_style(). Widgets with a unique property set keep their local
+styles.
+
+The file is rewritten in place and a per-screen report of the saved LVGL
+heap is printed. Running it on an already compacted file does nothing.
+
+Usage:
+    python compact_eez_styles.py ../eez/src/ui/screens.c
+    python compact_eez_styles.py ../eez/src/ui/screens.c --dry-run
+    python compact_eez_styles.py ../eez/src/ui/screens.c --min-uses 3
+
+Called by update_eez_screens.sh after every EEZ export.
+"""
+
+import argparse
+import re
+import sys
+from collections import OrderedDict, defaultdict
+from pathlib import Path
+
+MARKER = "// Shared styles (generated by compact_eez_styles.py)"
+
+# LVGL 9.x heap cost model (32-bit target, allocator headers not included):
+# a local style is an lv_style_t allocated per widget plus its value/prop array.
+STYLE_T_BYTES = 12          # sizeof(lv_style_t)
+STYLE_PROP_BYTES = 5        # sizeof(lv_style_value_t) + sizeof(lv_style_prop_t)
+
+# Properties that stay local: custom UI code removes them with
+# lv_obj_remove_local_style_prop() (e.g. AMS panels reparented into a flex row)
+KEEP_LOCAL = {"align", "x", "y", "translate_x", "translate_y"}
+
+RE_SCREEN = re.compile(r'^void create_screen_(\w+)\(\) \{$')
+RE_FUNC_END = re.compile(r'^\}$')
+RE_WIDGET = re.compile(r'^(\s*)lv_obj_t \*obj = ')
+RE_NAME = re.compile(r'^\s*(?://|objects\.)\s*(\w+)')
+RE_STYLE = re.compile(
+    r'^(\s*)lv_obj_set_style_(\w+)\(obj, (.+), (LV_PART_\w+ \| LV_STATE_\w+)\);$')
+
+
+class Block:
+    """Style lines of one widget for one selector"""
+
+    def __init__(self, screen, widget):
+        self.screen = screen
+        self.widget = widget
+        self.lines = []     # Line indices in screens.c
+        self.props = []     # (property, value) in source order
+        self.style = None   # Shared style name, if any
+
+    def key(self):
+        return tuple(sorted(self.props))
+
+    def local_cost(self):
+        return STYLE_T_BYTES + STYLE_PROP_BYTES * len(self.props)
+
+
+def parse_blocks(lines):
+    """Collect the local style blocks of every create_screen_* function"""
+    blocks = OrderedDict()
+    screen = None
+    widgets = {}            # Indent -> (line index, widget name)
+
+    for i, line in enumerate(lines):
+        m = RE_SCREEN.match(line)
+        if m:
+            screen = m.group(1)
+            widgets = {}
+            continue
+        if screen is None:
+            continue
+        if RE_FUNC_END.match(line):
+            screen = None
+            continue
+
+        m = RE_WIDGET.match(line)
+        if m:
+            # Widget name: "// name" comment above or "objects.name = obj;" below
+            name = None
+            for j in (i - 1, i + 1):
+                n = RE_NAME.match(lines[j])
+                if n:
+                    name = n.group(1)
+                    break
+            widgets[len(m.group(1))] = (i, name or screen)
+            continue
+
+        m = RE_STYLE.match(line)
+        if m and m.group(2) not in KEEP_LOCAL:
+            indent = len(m.group(1))
+            if indent not in widgets:
+                continue
+            widget_line, widget_name = widgets[indent]
+            key = (widget_line, m.group(4))
+            if key not in blocks:
+                blocks[key] = Block(screen, widget_name)
+            block = blocks[key]
+            block.lines.append(i)
+            block.props.append((m.group(2), m.group(3)))
+
+    return [b for b in blocks.values()
+            if len({p for p, _ in b.props}) == len(b.props)]  # Skip overridden props
+
+
+def style_name(widget, used):
+    base = "style_" + re.sub(r'_\d+$', '', widget)
+    name = base
+    n = 2
+    while name in used:
+        name = f"{base}_{n}"
+        n += 1
+    used.add(name)
+    return name
+
+
+def assign_styles(blocks, min_uses):
+    """Give every property set used by at least min_uses widgets a shared style"""
+    groups = defaultdict(list)
+    for block in blocks:
+        groups[block.key()].append(block)
+
+    styles = OrderedDict()  # Name -> property list
+    used = set()
+    for block in blocks:
+        group = groups[block.key()]
+        if len(group) < min_uses or block.style:
+            continue
+        name = style_name(group[0].widget, used)
+        styles[name] = group[0].props
+        for member in group:
+            member.style = name
+    return styles
+
+
+def rewrite(lines, blocks, styles):
+    out = list(lines)
+    remove = set()
+    for block in blocks:
+        if not block.style:
+            continue
+        first = block.lines[0]
+        m = RE_STYLE.match(lines[first])
+        out[first] = f"{m.group(1)}lv_obj_add_style(obj, &{block.style}, {m.group(4)});"
+        remove.update(block.lines[1:])
+
+    header = [MARKER]
+    header += [f"static lv_style_t {name};" for name in styles]
+    header += [
+        "",
+        "static void init_shared_styles() {",
+        "    static bool initialized = false;",
+        "    if (initialized) return;",
+        "    initialized = true;",
+    ]
+    for name, props in styles.items():
+        header.append(f"    lv_style_init(&{name});")
+        header += [f"    lv_style_set_{prop}(&{name}, {value});" for prop, value in props]
+    header += ["}", ""]
+
+    result = []
+    for i, line in enumerate(out):
+        if i in remove:
+            continue
+        result.append(line)
+        if line.startswith("uint32_t active_theme_index"):
+            result.append("")
+            result += header
+        elif RE_SCREEN.match(line):
+            result.append("    init_shared_styles();")
+    return result
+
+
+def report(blocks, styles):
+    saved = defaultdict(int)
+    shared = defaultdict(int)
+    local = defaultdict(int)
+    for block in blocks:
+        if block.style:
+            saved[block.screen] += block.local_cost()
+            shared[block.screen] += 1
+        else:
+            local[block.screen] += 1
+    once = sum(STYLE_PROP_BYTES * len(props) for props in styles.values())
+
+    print(f"  {'Screen':<28} {'Shared':>6} {'Local':>6} {'Heap saved':>11}")
+    for screen in OrderedDict.fromkeys(b.screen for b in blocks):
+        print(f"  {screen:<28} {shared[screen]:>6} {local[screen]:>6} {saved[screen]:>9} B")
+    total = sum(saved.values())
+    print(f"  {len(styles)} shared styles ({once} B heap, once) - net saving {total - once} B "
+          f"if all screens are alive")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Share repeated local styles in EEZ screens.c")
+    parser.add_argument("screens_c", type=Path, help="EEZ generated screens.c")
+    parser.add_argument("--min-uses", type=int, default=2,
+                        help="Widgets that must share a property set (default: 2)")
+    parser.add_argument("--dry-run", action="store_true", help="Report only, don't rewrite")
+    args = parser.parse_args()
+
+    text = args.screens_c.read_text()
+    if MARKER in text:
+        print("  - Styles already compacted, skipping")
+        return 0
+
+    lines = text.split("\n")
+    blocks = parse_blocks(lines)
+    styles = assign_styles(blocks, max(args.min_uses, 2))
+    if not styles:
+        print("  - No repeated property sets found")
+        return 0
+
+    report(blocks, styles)
+    if not args.dry_run:
+        args.screens_c.write_text("\n".join(rewrite(lines, blocks, styles)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
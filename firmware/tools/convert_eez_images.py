@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+"""
+SpoolBuddy EEZ Image Conversion
+
+EEZ Studio exports every image as an uncompressed ARGB8888 C array (4 bytes
+per pixel), although the panel is RGB565. This tool rewrites the generated
+ui_image_*.c files in the cheapest format that draws the same:
+
+  A8        Icons listed in A8_ICONS. They are always drawn with
+            image_recolor_opa 255, so only their alpha is visible.
+            LVGL takes the color of an A8 image from image_recolor.
+  RGB565    Fully opaque images (nothing is lost on a 16-bit panel)
+  I1/I2/I4  Small images with at most 16 distinct ARGB colors (exact palette).
+            Decoded to ARGB8888 on first draw and kept in the LVGL image cache
+            (LV_CACHE_DEF_SIZE in lv_conf.h must hold all of them).
+  RGB565A8  Everything else
+
+A8, RGB565 and RGB565A8 are drawn straight from flash by the software
+renderer, without a decode step. Images that are not ARGB8888 (already
+converted, or exported as RGB565) are left alone, so running the tool twice
+does nothing. A report of the flash bytes per image before and after is
+printed.
+
+Every converted image is decoded back and checked: A8 against the source
+alpha, indexed formats against the source pixels, RGB565/RGB565A8 against
+the source quantized to RGB565. The report's "Err" column is the largest
+per-channel difference from the 8-bit source (RGB565 rounding, up to 7).
+
+Usage:
+    python convert_eez_images.py ../eez/src/ui
+    python convert_eez_images.py ../eez/src/ui --dry-run
+
+Called by update_eez_screens.sh after every EEZ export.
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+MARKER = "// Converted by convert_eez_images.py"
+
+# Icons only ever shown recolored at full opacity (screens.c and custom code).
+# Icons whose recolor is switched off at runtime must not be listed here:
+# signal (ui_state.c wifi icon), 3d_cube (ui_printer.c), wifi (ui_wifi.c).
+A8_ICONS = {
+    "about", "add", "amssetup", "catalog", "display", "encoding", "firmware",
+    "home", "nfc", "reset", "scale", "scale_2", "settings", "spool_fill",
+    "thermometer",
+}
+
+# Indexed images are decoded into the image cache - keep them small
+INDEXED_MAX_COLORS = 16
+INDEXED_MAX_PIXELS = 100 * 100
+
+RE_MAP = re.compile(r'(uint8_t (\w+)_map\[\] = \{\n)(.*?)(\n\};)', re.S)
+RE_HEADER = re.compile(r'(\.(cf|w|h|stride) = )([^,]+),')
+RE_SET_SRC = re.compile(r'lv_image_set_src\(obj, &img_(\w+)\);')
+
+
+class Image:
+    """One ui_image_<name>.c file"""
+
+    def __init__(self, path):
+        self.path = path
+        self.name = path.stem[len("ui_image_"):]
+        self.text = path.read_text()
+        self.header = {m.group(2): m.group(3) for m in RE_HEADER.finditer(self.text)}
+        self.cf = self.header["cf"].replace("LV_COLOR_FORMAT_", "")
+        self.w = int(self.header["w"])
+        self.h = int(self.header["h"])
+        self.map = RE_MAP.search(self.text)
+        self.size = self.map_size()
+
+    def map_size(self):
+        return len(re.findall(r'0x[0-9a-fA-F]{2}', self.map.group(3)))
+
+    def pixels(self):
+        """ARGB8888 pixels as (r, g, b, a) - stored B, G, R, A, rows may be padded"""
+        data = bytes(int(x, 16) for x in re.findall(r'0x([0-9a-fA-F]{2})', self.map.group(3)))
+        stride = int(self.header["stride"])
+        return [(data[i + 2], data[i + 1], data[i], data[i + 3])
+                for y in range(self.h)
+                for i in range(y * stride, y * stride + self.w * 4, 4)]
+
+    def rewrite(self, cf, stride, rows):
+        """One line per pixel row (and one for a palette), like the EEZ export"""
+        body = "\n".join("    " + ",".join(f"0x{b:02x}" for b in row) + "," for row in rows)
+        text = (self.text[:self.map.start(3)] + "\n" + body + "\n" +
+                self.text[self.map.end(3):])
+        text = text.replace(f".cf = {self.header['cf']},", f".cf = LV_COLOR_FORMAT_{cf},")
+        text = text.replace(f".stride = {self.header['stride']},", f".stride = {stride},")
+        note = f"{MARKER} (ARGB8888, {self.size} bytes)\n"
+        text = text.replace("static const\n", note + "static const\n", 1)
+        self.path.write_text(text)
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def expand565(c):
+    """RGB565 back to 8-bit channels, the way LVGL does"""
+    r, g, b = (c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+def recolored_everywhere(screens, names):
+    """Names whose every screens.c use sets image_recolor (locally or via a style)"""
+    lines = screens.split("\n")
+    recolor_styles = set(re.findall(r'lv_style_set_image_recolor\(&(\w+),', screens))
+    ok = {name: True for name in names}
+    for i, line in enumerate(lines):
+        m = RE_SET_SRC.search(line)
+        if not m or m.group(1) not in ok:
+            continue
+        recolored = False
+        for follow in lines[i + 1:i + 40]:
+            if "lv_obj_t *obj = " in follow:
+                break
+            style = re.search(r'lv_obj_add_style\(obj, &(\w+),', follow)
+            if "image_recolor(" in follow or (style and style.group(1) in recolor_styles):
+                recolored = True
+        ok[m.group(1)] &= recolored
+    return {name for name, recolored in ok.items() if recolored}
+
+
+def split_rows(data, stride):
+    return [data[i:i + stride] for i in range(0, len(data), stride)]
+
+
+def pack_indexed(pixels, w, h):
+    palette = list(dict.fromkeys(pixels))
+    bpp = 1 if len(palette) <= 2 else 2 if len(palette) <= 4 else 4
+    index = {color: i for i, color in enumerate(palette)}
+    palette += [(0, 0, 0, 0)] * ((1 << bpp) - len(palette))
+
+    rows = [b"".join(bytes((b, g, r, a)) for r, g, b, a in palette)]
+    stride = (w * bpp + 7) // 8
+    per_byte = 8 // bpp
+    for y in range(h):
+        row = bytearray(stride)
+        for x in range(w):
+            # First pixel in the most significant bits
+            shift = 8 - bpp * (x % per_byte + 1)
+            row[x // per_byte] |= index[pixels[y * w + x]] << shift
+        rows.append(row)
+    return f"I{bpp}", stride, rows
+
+
+def convert(image, pixels, a8_ok):
+    """Pick the format for an ARGB8888 image, returns (cf, stride, rows)"""
+    w, h = image.w, image.h
+
+    if image.name in a8_ok:
+        return "A8", w, split_rows(bytes(a for _, _, _, a in pixels), w)
+
+    if all(a == 255 for _, _, _, a in pixels):
+        data = bytearray()
+        for r, g, b, _ in pixels:
+            data += rgb565(r, g, b).to_bytes(2, "little")
+        return "RGB565", w * 2, split_rows(data, w * 2)
+
+    if w * h <= INDEXED_MAX_PIXELS and len(set(pixels)) <= INDEXED_MAX_COLORS:
+        return pack_indexed(pixels, w, h)
+
+    # RGB565 plane followed by the alpha plane
+    color = bytearray()
+    for r, g, b, _ in pixels:
+        color += rgb565(r, g, b).to_bytes(2, "little")
+    alpha = bytes(a for _, _, _, a in pixels)
+    return "RGB565A8", w * 2, split_rows(color, w * 2) + split_rows(alpha, w)
+
+
+def decode(cf, rows, w, h):
+    """Converted rows back to (r, g, b, a) pixels, A8 as (0, 0, 0, a)"""
+    if cf == "A8":
+        return [(0, 0, 0, a) for row in rows for a in row[:w]]
+    if cf == "RGB565" or cf == "RGB565A8":
+        colors = [expand565(int.from_bytes(row[x * 2:x * 2 + 2], "little"))
+                  for row in rows[:h] for x in range(w)]
+        alpha = [a for row in rows[h:] for a in row[:w]] if cf == "RGB565A8" else [255] * (w * h)
+        return [c + (a,) for c, a in zip(colors, alpha)]
+    bpp = int(cf[1:])
+    palette = [(r, g, b, a) for b, g, r, a in zip(*[iter(rows[0])] * 4)]
+    per_byte = 8 // bpp
+    return [palette[(row[x // per_byte] >> (8 - bpp * (x % per_byte + 1))) & ((1 << bpp) - 1)]
+            for row in rows[1:] for x in range(w)]
+
+
+def check(image, pixels, cf, rows):
+    """Compare the decoded image with what the format can hold, returns the max channel error"""
+    decoded = decode(cf, rows, image.w, image.h)
+    if cf == "A8":
+        expected = [(0, 0, 0, a) for _, _, _, a in pixels]
+        source = expected
+    elif cf.startswith("RGB565"):
+        expected = [expand565(rgb565(r, g, b)) + (a if cf == "RGB565A8" else 255,)
+                    for r, g, b, a in pixels]
+        source = pixels
+    else:
+        expected = source = pixels
+    if decoded != expected:
+        bad = next(i for i, (d, e) in enumerate(zip(decoded, expected)) if d != e)
+        raise SystemExit(f"  ERROR: {image.name} decodes wrong at pixel {bad} "
+                         f"({decoded[bad]} != {expected[bad]})")
+    return max((abs(d - s) for dp, sp in zip(decoded, source) for d, s in zip(dp, sp)), default=0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert EEZ ARGB8888 images to cheaper formats")
+    parser.add_argument("eez_dir", type=Path, help="EEZ export directory (ui_image_*.c, screens.c)")
+    parser.add_argument("--dry-run", action="store_true", help="Report only, don't rewrite")
+    args = parser.parse_args()
+
+    images = [Image(path) for path in sorted(args.eez_dir.glob("ui_image_*.c"))]
+    screens = (args.eez_dir / "screens.c").read_text()
+    a8_ok = recolored_everywhere(screens, A8_ICONS)
+    for name in sorted(A8_ICONS - a8_ok):
+        print(f"  WARNING: {name} is not recolored on every screen, keeping its colors")
+
+    print(f"  {'Image':<32} {'Size':>9} {'Format':>9} {'Before':>9} {'After':>9} {'Err':>4}")
+    before_total = after_total = cache_bytes = 0
+    for image in images:
+        before = after = image.size
+        cf = image.cf
+        err = "-"
+        if MARKER in image.text:
+            before = int(re.search(re.escape(MARKER) + r' \(ARGB8888, (\d+) bytes\)',
+                                   image.text).group(1))
+        elif cf == "ARGB8888":
+            pixels = image.pixels()
+            cf, stride, rows = convert(image, pixels, a8_ok)
+            err = check(image, pixels, cf, rows)
+            after = sum(len(row) for row in rows)
+            if not args.dry_run:
+                image.rewrite(cf, stride, rows)
+        if cf.startswith("I"):
+            cache_bytes += image.w * image.h * 4
+        before_total += before
+        after_total += after
+        print(f"  {image.name:<32} {image.w:>4}x{image.h:<4} {cf:>9} {before:>9} {after:>9} {err:>4}")
+
+    print(f"  Total: {before_total} B -> {after_total} B "
+          f"({before_total - after_total} B flash saved)")
+    print(f"  Indexed images need {cache_bytes} B of LVGL image cache (LV_CACHE_DEF_SIZE)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
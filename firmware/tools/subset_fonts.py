@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""
+SpoolBuddy Font Subsetting
+
+The UI uses LVGL's built-in Montserrat fonts: 4 bpp, ASCII plus about 60
+FontAwesome symbols, compiled for every size enabled in lv_conf.h. This tool
+scans screens.c and the custom ui*.c sources and generates only what is used:
+
+  Sizes   every &lv_font_montserrat_N reference plus LV_FONT_DEFAULT (14)
+  Glyphs  characters of string literals, the character classes of printf
+          conversions (%d -> digits and '-', %x -> hex digits, %f -> digits
+          and '.', %s/%c -> printable ASCII because printer names, SSIDs and
+          keyboard input can be anything), referenced LV_SYMBOL_* and the
+          symbols LVGL widgets draw themselves (WIDGET_SYMBOLS)
+
+The fonts are written to fonts/subset/ under the built-in names
+(lv_font_montserrat_N.c), so screens.c and the custom code stay unchanged.
+The build does not use them yet. Using them means including
+fonts/subset/ui_fonts.h from lv_conf.h (firmware and simulator), switching
+off the built-in sizes it lists, and compiling fonts/subset/*.c.
+
+Requires lv_font_conv (npm install in firmware/) and the LVGL submodule
+(lv_symbol_def.h and the FontAwesome font LVGL builds its symbols from).
+The simulator's "--bench fonts" mode compares text render cost per bpp.
+
+Usage:
+    python subset_fonts.py
+    python subset_fonts.py --bpp 2
+    python subset_fonts.py --dry-run
+
+Rerun after changing UI strings or font sizes.
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+FIRMWARE_DIR = Path(__file__).resolve().parent.parent
+EEZ_DIR = FIRMWARE_DIR.parent / "eez" / "src" / "ui"
+UI_DIR = FIRMWARE_DIR / "components" / "eez_ui"
+LVGL_DIR = FIRMWARE_DIR / "components" / "lvgl"
+OUT_DIR = FIRMWARE_DIR / "fonts" / "subset"
+
+TEXT_FONT = FIRMWARE_DIR / "fonts" / "Montserrat-Medium.ttf"
+SYMBOL_FONT = LVGL_DIR / "scripts" / "built_in_font" / "FontAwesome5-Solid+Brands+Regular.woff"
+SYMBOL_DEF = LVGL_DIR / "src" / "font" / "lv_symbol_def.h"
+
+DEFAULT_SIZE = 14   # LV_FONT_DEFAULT (theme, keyboard, message boxes)
+
+# Drawn by LVGL itself: dropdown arrow, keyboard keys, message box close
+WIDGET_SYMBOLS = {"DOWN", "UP", "LEFT", "RIGHT", "OK", "CLOSE", "BACKSPACE",
+                  "NEW_LINE", "KEYBOARD"}
+
+PRINTABLE_ASCII = {chr(c) for c in range(0x20, 0x7F)}
+DIGITS = set("0123456789")
+CONVERSION_CLASSES = {
+    "d": DIGITS | {"-"}, "i": DIGITS | {"-"}, "u": DIGITS, "o": DIGITS,
+    "x": DIGITS | set("abcdef"), "X": DIGITS | set("ABCDEF"),
+    "f": DIGITS | set(".-"), "F": DIGITS | set(".-"),
+    "e": DIGITS | set(".-+e"), "g": DIGITS | set(".-+e"),
+    "s": PRINTABLE_ASCII, "c": PRINTABLE_ASCII,
+    "p": DIGITS | set("abcdefx"), "%": {"%"},
+}
+
+RE_FONT = re.compile(r'&lv_font_montserrat_(\d+)\b')
+RE_SYMBOL = re.compile(r'\bLV_SYMBOL_(\w+)')
+RE_STRING = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+RE_CONVERSION = re.compile(r'%[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l|z|j|t|L)?([diouxXfFeEgGcsp%])')
+RE_ESCAPE = re.compile(r'\\(x[0-9a-fA-F]{1,2}|[0-7]{1,3}|.)')
+RE_SYMBOL_DEF = re.compile(r'#define\s+LV_SYMBOL_(\w+)\s+"((?:\\x[0-9a-fA-F]{2})+)"')
+RE_BITMAP = re.compile(r'glyph_bitmap\[\] = \{(.*?)\};', re.S)
+
+SIMPLE_ESCAPES = {"n": "\n", "t": "\t", "r": "\r", "0": "\0"}
+
+
+def sources():
+    files = [EEZ_DIR / "screens.c", EEZ_DIR / "styles.c"]
+    files += sorted(p for p in UI_DIR.glob("ui*.c") if not p.name.startswith("ui_image_"))
+    return [p for p in files if p.exists()]
+
+
+def decode_literal(body):
+    """C string literal body -> text (\\x escapes are UTF-8 bytes)"""
+    out = bytearray()
+    pos = 0
+    for m in RE_ESCAPE.finditer(body):
+        out += body[pos:m.start()].encode()
+        esc = m.group(1)
+        if esc[0] == "x":
+            out.append(int(esc[1:], 16))
+        elif esc[0] in "01234567" and esc != "0":
+            out.append(int(esc, 8) & 0xFF)
+        else:
+            out += SIMPLE_ESCAPES.get(esc, esc).encode()
+        pos = m.end()
+    out += body[pos:].encode()
+    return out.decode("utf-8", errors="ignore")
+
+
+def scan(files):
+    """Referenced sizes, text characters, symbol names and why ASCII is needed"""
+    sizes = {DEFAULT_SIZE}
+    chars = set()
+    symbols = set(WIDGET_SYMBOLS)
+    ascii_reason = None
+    for path in files:
+        for line in path.read_text(errors="ignore").split("\n"):
+            stripped = line.strip()
+            if stripped.startswith(("#include", "//")):
+                continue
+            sizes.update(int(n) for n in RE_FONT.findall(line))
+            symbols.update(RE_SYMBOL.findall(line))
+            for literal in RE_STRING.findall(line):
+                text = decode_literal(literal)
+                for m in RE_CONVERSION.finditer(text):
+                    chars |= CONVERSION_CLASSES[m.group(1)]
+                    if m.group(1) in "sc" and not ascii_reason:
+                        ascii_reason = f"{path.name}: \"{literal}\""
+                chars.update(c for c in RE_CONVERSION.sub("", text) if c >= " ")
+    chars.discard("\x7f")
+    return sizes, chars, symbols, ascii_reason
+
+
+def symbol_codepoints(names):
+    """LV_SYMBOL_* name -> code point, from LVGL's lv_symbol_def.h"""
+    table = {}
+    for name, escaped in RE_SYMBOL_DEF.findall(SYMBOL_DEF.read_text()):
+        table[name] = ord(bytes(int(h, 16) for h in escaped.split("\\x")[1:]).decode())
+    missing = sorted(n for n in names if n not in table)
+    if missing:
+        print(f"  WARNING: unknown symbols {', '.join(missing)}")
+    return {table[n] for n in names if n in table}
+
+
+def ranges(codepoints):
+    """Sorted code points -> lv_font_conv range list (0x20-0x7E,0xB0)"""
+    parts = []
+    points = sorted(codepoints)
+    start = prev = points[0]
+    for cp in points[1:] + [None]:
+        if cp is not None and cp == prev + 1:
+            prev = cp
+            continue
+        parts.append(f"0x{start:X}" if start == prev else f"0x{start:X}-0x{prev:X}")
+        if cp is not None:
+            start = prev = cp
+    return ",".join(parts)
+
+
+def bitmap_bytes(path):
+    m = RE_BITMAP.search(path.read_text()) if path.exists() else None
+    return len(re.findall(r'0x[0-9a-fA-F]+', m.group(1))) if m else 0
+
+
+def write_header(sizes, bpp):
+    declares = " \\\n".join(f"    LV_FONT_DECLARE(lv_font_montserrat_{n})" for n in sizes)
+    (OUT_DIR / "ui_fonts.h").write_text(f"""/**
+ * @file ui_fonts.h
+ * @brief Glyph-subset Montserrat fonts (generated by tools/subset_fonts.py)
+ *
+ * Included by lv_conf.h: replaces the built-in Montserrat sizes.
+ * Don't edit - rerun the tool, or delete this directory to go back to the
+ * built-in fonts.
+ */
+
+#ifndef UI_FONTS_H
+#define UI_FONTS_H
+
+#define UI_SUBSET_FONTS 1
+#define UI_SUBSET_FONT_BPP {bpp}
+
+#define LV_FONT_CUSTOM_DECLARE \\
+{declares}
+
+#endif /* UI_FONTS_H */
+""")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate glyph-subset Montserrat fonts for the UI")
+    parser.add_argument("--bpp", type=int, choices=(1, 2, 4), default=4,
+                        help="Bits per pixel (default: 4, like the built-in fonts)")
+    parser.add_argument("--dry-run", action="store_true", help="Report only, don't generate")
+    args = parser.parse_args()
+
+    files = sources()
+    sizes, chars, symbols, ascii_reason = scan(files)
+    sizes = sorted(sizes)
+    text_points = {ord(c) for c in chars}
+
+    print(f"  Scanned {len(files)} files")
+    print(f"  Sizes: {', '.join(str(n) for n in sizes)}")
+    if ascii_reason:
+        print(f"  Printable ASCII kept for dynamic text ({ascii_reason})")
+    extra = "".join(sorted(c for c in chars if ord(c) > 0x7E))
+    print(f"  Text glyphs: {len(text_points)} (non-ASCII: {extra or 'none'})")
+    print(f"  Symbols: {', '.join(sorted(symbols))}")
+    if args.dry_run:
+        return 0
+
+    if not SYMBOL_DEF.exists() or not SYMBOL_FONT.exists():
+        print(f"  ERROR: LVGL submodule not found at {LVGL_DIR}")
+        return 1
+    symbol_points = symbol_codepoints(symbols)
+
+    OUT_DIR.mkdir(parents=True, exist_ok=True)
+    for old in OUT_DIR.glob("lv_font_montserrat_*.c"):
+        old.unlink()
+
+    print(f"  {'Font':<24} {'Glyphs':>6} {'Built-in':>10} {'Subset':>10}")
+    for size in sizes:
+        name = f"lv_font_montserrat_{size}"
+        out = OUT_DIR / f"{name}.c"
+        subprocess.run([
+            "npx", "lv_font_conv", "--no-compress", "--format", "lvgl",
+            "--bpp", str(args.bpp), "--size", str(size),
+            "--font", str(TEXT_FONT), "-r", ranges(text_points),
+            "--font", str(SYMBOL_FONT), "-r", ranges(symbol_points),
+            "-o", str(out),
+        ], cwd=FIRMWARE_DIR, check=True)
+        builtin = bitmap_bytes(LVGL_DIR / "src" / "font" / f"{name}.c")
+        print(f"  {name:<24} {len(text_points) + len(symbol_points):>6} "
+              f"{builtin:>8} B {bitmap_bytes(out):>8} B")
+
+    write_header(sizes, args.bpp)
+    print(f"  Wrote {OUT_DIR.relative_to(FIRMWARE_DIR)}/ (bitmap bytes, kerning and cmaps not included)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -4,9 +4,11 @@
 #
 # This script:
 # 1. Applies LVGL 9.x compatibility fixes to EEZ output
-# 2. Creates symlinks from firmware to EEZ output
-# 3. Creates symlinks from simulator to EEZ output
-# 4. Preserves custom code (ui.c, ui_backend.c, etc.)
+# 2. Compacts repeated local styles into shared styles
+# 3. Converts ARGB8888 images to cheaper color formats
+# 4. Creates symlinks from firmware to EEZ output
+# 5. Creates symlinks from simulator to EEZ output
+# 6. Preserves custom code (ui.c, ui_backend.c, etc.)
 
 set -e
 
@@ -64,6 +66,32 @@ sed_inplace '/objects.encode_tag = obj;/,/objects.catalog = obj;/{s/objects.sett
 
 echo "  - Applied fixes to EEZ source files"
 
+# ============================================================
+# Step 1b: Share repeated local styles
+# ============================================================
+# EEZ sets every property as a local style (one heap allocation per widget).
+# Identical property sets become shared static lv_style_t objects.
+echo ""
+echo "Step 1b: Compacting repeated local styles..."
+if command -v python3 >/dev/null 2>&1; then
+    python3 "$SCRIPT_DIR/tools/compact_eez_styles.py" "$EEZ_DIR/screens.c"
+else
+    echo "  WARNING: python3 not found, screens.c keeps its local styles"
+fi
+
+# ============================================================
+# Step 1c: Convert images
+# ============================================================
+# EEZ exports ARGB8888 (4 bytes/pixel). Recolored icons become A8, opaque
+# images RGB565, small few-color images indexed, the rest RGB565A8.
+echo ""
+echo "Step 1c: Converting images..."
+if command -v python3 >/dev/null 2>&1; then
+    python3 "$SCRIPT_DIR/tools/convert_eez_images.py" "$EEZ_DIR"
+else
+    echo "  WARNING: python3 not found, images stay ARGB8888"
+fi
+
 # ============================================================
 # Step 2: Create firmware symlinks
 # ============================================================
@@ -22,7 +22,7 @@
 static BackendState g_state = {0};
 static char g_base_url[256] = BACKEND_DEFAULT_URL;
 static CURL *g_curl = NULL;
-static pthread_mutex_t g_curl_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t g_curl_mutex = PTHREAD_MUTEX_INITIALIZER;  // Held for every g_curl use (poll thread + ui_async workers)
 
 // NFC state (synced from real device via backend, or toggled with 'N' key)
 static bool g_nfc_initialized = true;
@@ -336,6 +336,7 @@ int backend_send_device_state(float weight, bool stable, const char *tag_id) {
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -345,6 +346,7 @@ int backend_send_device_state(float weight, bool stable, const char *tag_id) {
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 2L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
     free(response.data);
 
     return (res == CURLE_OK) ? 0 : -1;
@@ -627,69 +629,63 @@ const BackendPrinterState *backend_get_first_printer(void) {
     return NULL;
 }
 
-// Static buffer for cover image path
-static char g_cover_path[256] = "/tmp/spoolbuddy_cover.png";
-static char g_cover_serial[32] = "";
+// Cover download target (fixed-size caller buffer)
+typedef struct {
+    uint8_t *data;
+    size_t size;
+    size_t used;
+    bool overflow;
+} CoverBuffer;
 
-// Write callback for file download
-static size_t write_file_callback(void *contents, size_t size, size_t nmemb, void *userp) {
-    FILE *fp = (FILE *)userp;
-    return fwrite(contents, size, nmemb, fp);
+static size_t write_cover_callback(void *contents, size_t size, size_t nmemb, void *userp) {
+    size_t realsize = size * nmemb;
+    CoverBuffer *buf = (CoverBuffer *)userp;
+
+    if (buf->used + realsize > buf->size) {
+        buf->overflow = true;
+        return 0;  // Abort the transfer
+    }
+    memcpy(buf->data + buf->used, contents, realsize);
+    buf->used += realsize;
+    return realsize;
 }
 
-const char *backend_fetch_cover_image(const char *serial) {
-    if (!g_curl || !serial) return NULL;
+int backend_fetch_cover(const char *serial, uint8_t *buf, uint32_t buf_size) {
+    if (!serial || !buf || buf_size == 0) return -1;
 
-    // Check if we already have this cover cached
-    if (strcmp(g_cover_serial, serial) == 0) {
-        // Check if file exists
-        FILE *fp = fopen(g_cover_path, "r");
-        if (fp) {
-            fclose(fp);
-            return g_cover_path;
-        }
-    }
+    // Runs on a UI worker thread - g_curl belongs to the poll thread
+    CURL *curl = curl_easy_init();
+    if (!curl) return -1;
 
     char url[512];
     snprintf(url, sizeof(url), "%s/api/printers/%s/cover", g_base_url, serial);
 
-    FILE *fp = fopen(g_cover_path, "wb");
-    if (!fp) {
-        fprintf(stderr, "[backend] Failed to open temp file for cover image\n");
-        return NULL;
-    }
-
-    curl_easy_setopt(g_curl, CURLOPT_URL, url);
-    curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_file_callback);
-    curl_easy_setopt(g_curl, CURLOPT_WRITEDATA, fp);
-    curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
-
-    CURLcode res = curl_easy_perform(g_curl);
-    fclose(fp);
+    CoverBuffer cover = { .data = buf, .size = buf_size };
+    curl_easy_setopt(curl, CURLOPT_URL, url);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_cover_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &cover);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
 
-    // Reset write callback for JSON fetching
-    curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
+    CURLcode res = curl_easy_perform(curl);
+    long http_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
+    curl_easy_cleanup(curl);
 
+    if (cover.overflow) {
+        fprintf(stderr, "[backend] Cover image for %s larger than %u bytes\n", serial, (unsigned)buf_size);
+        return -1;
+    }
     if (res != CURLE_OK) {
         fprintf(stderr, "[backend] Failed to fetch cover image: %s\n", curl_easy_strerror(res));
-        remove(g_cover_path);
-        g_cover_serial[0] = '\0';
-        return NULL;
+        return -1;
     }
-
-    // Check HTTP response code
-    long http_code = 0;
-    curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
     if (http_code != 200) {
         fprintf(stderr, "[backend] Cover image HTTP error: %ld\n", http_code);
-        remove(g_cover_path);
-        g_cover_serial[0] = '\0';
-        return NULL;
+        return -1;
     }
 
-    strncpy(g_cover_serial, serial, sizeof(g_cover_serial) - 1);
-    printf("[backend] Fetched cover image for %s\n", serial);
-    return g_cover_path;
+    printf("[backend] Fetched cover image for %s (%zu bytes)\n", serial, cover.used);
+    return (int)cover.used;
 }
 
 // =============================================================================
@@ -821,32 +817,82 @@ int backend_get_active_extruder(int printer_index) {
     return g_state.printers[printer_index].active_extruder;
 }
 
-int backend_get_tray_reading_bits(int printer_index) {
-    if (printer_index < 0 || printer_index >= g_state.printer_count) {
-        return -1;
+// Snapshot with generations, rebuilt from g_state on every backend_get_snapshot()
+static BackendSnapshot g_snapshot = {0};
+static uint32_t g_snapshot_generation = 0;
+
+static uint32_t next_snapshot_generation(void) {
+    if (++g_snapshot_generation == 0) {
+        g_snapshot_generation = 1;
     }
-    return g_state.printers[printer_index].tray_reading_bits;
+    return g_snapshot_generation;
 }
 
-// Cover image handling - simulator uses file-based approach
-static uint8_t *g_cover_data = NULL;
-static uint32_t g_cover_data_size = 0;
+static void refresh_snapshot(void) {
+    int count = g_state.printer_count;
+    if (count > BACKEND_SNAPSHOT_MAX_PRINTERS) count = BACKEND_SNAPSHOT_MAX_PRINTERS;
 
-int backend_has_cover(void) {
-    // Check if we have a cached cover file
-    FILE *fp = fopen(g_cover_path, "r");
-    if (fp) {
-        fclose(fp);
-        return 1;
+    if (count != g_snapshot.printer_count) {
+        // Forget printers that dropped out, so one reappearing later gets a new generation
+        for (int i = count; i < BACKEND_SNAPSHOT_MAX_PRINTERS; i++) {
+            memset(&g_snapshot.printers[i], 0, sizeof(g_snapshot.printers[i]));
+        }
+        g_snapshot.printer_count = count;
+        next_snapshot_generation();
     }
-    return 0;
+
+    static BackendPrinterSnapshot cur;  // Static - too large for the stack
+    for (int i = 0; i < count; i++) {
+        BackendPrinterSnapshot *prev = &g_snapshot.printers[i];
+        const BackendPrinterState *src = &g_state.printers[i];
+
+        memset(&cur, 0, sizeof(cur));
+        backend_get_printer(i, &cur.info);
+        cur.tray_now = src->tray_now;
+        cur.tray_now_left = src->tray_now_left;
+        cur.tray_now_right = src->tray_now_right;
+        cur.active_extruder = src->active_extruder;
+        cur.ams_count = src->ams_unit_count < BACKEND_SNAPSHOT_MAX_AMS ? src->ams_unit_count : BACKEND_SNAPSHOT_MAX_AMS;
+
+        for (int j = 0; j < cur.ams_count; j++) {
+            backend_get_ams_unit(i, j, &cur.ams[j].info);
+            cur.ams[j].generation = prev->ams[j].generation;
+            if (cur.ams[j].generation == 0 ||
+                memcmp(&cur.ams[j].info, &prev->ams[j].info, sizeof(cur.ams[j].info)) != 0) {
+                cur.ams[j].generation = next_snapshot_generation();
+            }
+        }
+
+        // Any unit generation change also makes this compare differ
+        cur.generation = prev->generation;
+        if (cur.generation == 0 || memcmp(&cur, prev, sizeof(cur)) != 0) {
+            cur.generation = next_snapshot_generation();
+        }
+        *prev = cur;
+    }
+
+    g_snapshot.generation = g_snapshot_generation;
 }
 
-const uint8_t* backend_get_cover_data(uint32_t *size_out) {
-    // Simulator uses file-based covers, not raw data
-    // Return NULL - ui_backend.c will need to handle this differently
-    if (size_out) *size_out = 0;
-    return NULL;
+void backend_get_snapshot(BackendSnapshot *snapshot) {
+    if (!snapshot) return;
+
+    refresh_snapshot();
+
+    snapshot->generation = g_snapshot.generation;
+    snapshot->printer_count = g_snapshot.printer_count;
+    for (int i = 0; i < g_snapshot.printer_count; i++) {
+        if (snapshot->printers[i].generation != g_snapshot.printers[i].generation) {
+            snapshot->printers[i] = g_snapshot.printers[i];
+        }
+    }
+}
+
+int backend_get_tray_reading_bits(int printer_index) {
+    if (printer_index < 0 || printer_index >= g_state.printer_count) {
+        return -1;
+    }
+    return g_state.printers[printer_index].tray_reading_bits;
 }
 
 int time_get_hhmm(void) {
@@ -874,6 +920,7 @@ bool spool_exists_by_tag(const char *tag_id) {
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
@@ -881,6 +928,7 @@ bool spool_exists_by_tag(const char *tag_id) {
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     bool found = false;
     if (res == CURLE_OK && response.data) {
@@ -916,6 +964,7 @@ bool spool_get_by_tag_full(const char *tag_id, SpoolInfo *info) {
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
@@ -923,6 +972,7 @@ bool spool_get_by_tag_full(const char *tag_id, SpoolInfo *info) {
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     bool found = false;
     if (res == CURLE_OK && response.data) {
@@ -1009,6 +1059,7 @@ bool spool_get_by_tag(const char *tag_id, SpoolInfoC *info) {
         strncpy(info->color_name, full.color_name, sizeof(info->color_name) - 1);
         info->color_rgba = full.color_rgba;
         info->label_weight = full.label_weight;
+        info->weight_current = full.weight_current;
         strncpy(info->slicer_filament, full.slicer_filament, sizeof(info->slicer_filament) - 1);
         info->valid = true;
     }
@@ -1097,6 +1148,7 @@ bool spool_add_to_inventory(const char *tag_id, const char *vendor, const char *
     struct curl_slist *headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POSTFIELDS, body);
@@ -1109,6 +1161,7 @@ bool spool_add_to_inventory(const char *tag_id, const char *vendor, const char *
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     curl_slist_free_all(headers);
     free(body);
@@ -1139,6 +1192,7 @@ int spool_get_k_profiles(const char *spool_id, SpoolKProfile *profiles, int max_
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
@@ -1146,6 +1200,7 @@ int spool_get_k_profiles(const char *spool_id, SpoolKProfile *profiles, int max_
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     int count = 0;
     if (res == CURLE_OK && response.data) {
@@ -1254,6 +1309,7 @@ int spool_get_untagged_list(UntaggedSpoolInfo *spools, int max_count) {
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
@@ -1261,6 +1317,7 @@ int spool_get_untagged_list(UntaggedSpoolInfo *spools, int max_count) {
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     int count = 0;
     if (res == CURLE_OK && response.data) {
@@ -1364,6 +1421,7 @@ bool spool_link_tag(const char *spool_id, const char *tag_id, const char *tag_ty
     struct curl_slist *headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_CUSTOMREQUEST, "PATCH");
@@ -1377,6 +1435,7 @@ bool spool_link_tag(const char *spool_id, const char *tag_id, const char *tag_ty
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     curl_slist_free_all(headers);
     free(body);
@@ -1423,6 +1482,7 @@ bool spool_sync_weight(const char *spool_id, int weight) {
     struct curl_slist *headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -1436,6 +1496,7 @@ bool spool_sync_weight(const char *spool_id, int weight) {
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     curl_slist_free_all(headers);
     free(body);
@@ -1486,6 +1547,7 @@ AssignResult backend_assign_spool_to_tray(const char *printer_serial, int ams_id
     struct curl_slist *headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -1499,6 +1561,7 @@ AssignResult backend_assign_spool_to_tray(const char *printer_serial, int ams_id
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     curl_slist_free_all(headers);
     free(json_str);
@@ -1552,6 +1615,7 @@ bool backend_cancel_staged_assignment(const char *printer_serial, int ams_id, in
     printf("[backend] cancel_staged_assignment: POST %s\n", url);
 
     ResponseBuffer response = {0};
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -1564,6 +1628,7 @@ bool backend_cancel_staged_assignment(const char *printer_serial, int ams_id, in
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     if (response.data) free(response.data);
 
@@ -1594,6 +1659,7 @@ int backend_poll_assignment_completions(double since_timestamp, AssignmentComple
     }
 
     ResponseBuffer response = {0};
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
@@ -1604,6 +1670,7 @@ int backend_poll_assignment_completions(double since_timestamp, AssignmentComple
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     int count = 0;
     if (res == CURLE_OK && http_code == 200 && response.data) {
@@ -1684,6 +1751,7 @@ bool backend_set_tray_calibration(const char *printer_serial, int ams_id, int tr
     struct curl_slist *headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -1697,6 +1765,7 @@ bool backend_set_tray_calibration(const char *printer_serial, int ams_id, int tr
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     curl_slist_free_all(headers);
     free(json_str);
@@ -1811,6 +1880,7 @@ const char *backend_get_preset_filament_id(const char *setting_id) {
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
@@ -1821,6 +1891,7 @@ const char *backend_get_preset_filament_id(const char *setting_id) {
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     if (res != CURLE_OK || http_code != 200) {
         printf("[backend] get_preset_filament_id(%s): request failed (res=%d, http=%ld)\n",
@@ -1877,6 +1948,7 @@ bool backend_get_preset_detail(const char *setting_id, PresetDetail *detail) {
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
@@ -1887,6 +1959,7 @@ bool backend_get_preset_detail(const char *setting_id, PresetDetail *detail) {
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     if (res != CURLE_OK || http_code != 200) {
         printf("[backend] get_preset_detail(%s): request failed (res=%d, http=%ld)\n",
@@ -2068,6 +2141,7 @@ bool backend_set_slot_filament(const char *printer_serial, int ams_id, int tray_
     struct curl_slist *headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -2081,6 +2155,7 @@ bool backend_set_slot_filament(const char *printer_serial, int ams_id, int tray_
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     curl_slist_free_all(headers);
     free(json_str);
@@ -2129,6 +2204,7 @@ bool backend_set_slot_calibration(const char *printer_serial, int ams_id, int tr
     struct curl_slist *headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -2142,6 +2218,7 @@ bool backend_set_slot_calibration(const char *printer_serial, int ams_id, int tr
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     curl_slist_free_all(headers);
     free(json_str);
@@ -2169,6 +2246,7 @@ bool backend_reset_slot(const char *printer_serial, int ams_id, int tray_id) {
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -2181,6 +2259,7 @@ bool backend_reset_slot(const char *printer_serial, int ams_id, int tray_id) {
 
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     if (response.data) free(response.data);
 
@@ -2285,6 +2364,7 @@ static void fetch_tag_data_from_backend(const char *tag_uid_hex) {
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
@@ -2292,6 +2372,7 @@ static void fetch_tag_data_from_backend(const char *tag_uid_hex) {
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 2L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     if (res == CURLE_OK && response.data) {
         cJSON *json = cJSON_Parse(response.data);
@@ -2590,6 +2671,7 @@ int backend_update_printer(const char *serial, const char *name, const char *ip,
     struct curl_slist *headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_CUSTOMREQUEST, "PUT");
@@ -2600,13 +2682,17 @@ int backend_update_printer(const char *serial, const char *name, const char *ip,
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
 
     CURLcode res = curl_easy_perform(g_curl);
+
+    long http_code = 0;
+    curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+
+    pthread_mutex_unlock(&g_curl_mutex);
+
     curl_slist_free_all(headers);
     free(json_str);
 
     int result = -1;
     if (res == CURLE_OK) {
-        long http_code;
-        curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
         if (http_code == 200) {
             result = 0;
             printf("[backend] Printer %s updated successfully\n", serial);
@@ -2629,6 +2715,7 @@ int backend_delete_printer(const char *serial) {
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_CUSTOMREQUEST, "DELETE");
@@ -2638,10 +2725,13 @@ int backend_delete_printer(const char *serial) {
 
     CURLcode res = curl_easy_perform(g_curl);
 
+    long http_code = 0;
+    curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+
+    pthread_mutex_unlock(&g_curl_mutex);
+
     int result = -1;
     if (res == CURLE_OK) {
-        long http_code;
-        curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
         if (http_code == 204) {
             result = 0;
             printf("[backend] Printer %s deleted successfully\n", serial);
@@ -2679,6 +2769,7 @@ int backend_add_printer(const char *serial, const char *name, const char *ip, co
     struct curl_slist *headers = NULL;
     headers = curl_slist_append(headers, "Content-Type: application/json");
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -2689,13 +2780,17 @@ int backend_add_printer(const char *serial, const char *name, const char *ip, co
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
 
     CURLcode res = curl_easy_perform(g_curl);
+
+    long http_code = 0;
+    curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+
+    pthread_mutex_unlock(&g_curl_mutex);
+
     curl_slist_free_all(headers);
     free(json_str);
 
     int result = -1;
     if (res == CURLE_OK) {
-        long http_code;
-        curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
         if (http_code == 201 || http_code == 200) {
             result = 0;
             printf("[backend] Printer %s added successfully\n", serial);
@@ -2718,6 +2813,7 @@ int backend_connect_printer(const char *serial) {
 
     ResponseBuffer response = {0};
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -2728,10 +2824,13 @@ int backend_connect_printer(const char *serial) {
 
     CURLcode res = curl_easy_perform(g_curl);
 
+    long http_code = 0;
+    curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+
+    pthread_mutex_unlock(&g_curl_mutex);
+
     int result = -1;
     if (res == CURLE_OK) {
-        long http_code;
-        curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
         if (http_code == 204 || http_code == 200) {
             result = 0;
             printf("[backend] Printer %s connect initiated\n", serial);
@@ -2758,6 +2857,7 @@ int backend_discovery_start(void) {
     snprintf(url, sizeof(url), "%s/api/discovery/start", g_base_url);
 
     ResponseBuffer response = {0};
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -2767,6 +2867,7 @@ int backend_discovery_start(void) {
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
     free(response.data);
 
     if (res == CURLE_OK) {
@@ -2785,6 +2886,7 @@ int backend_discovery_stop(void) {
     snprintf(url, sizeof(url), "%s/api/discovery/stop", g_base_url);
 
     ResponseBuffer response = {0};
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -2794,6 +2896,7 @@ int backend_discovery_stop(void) {
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
     free(response.data);
 
     if (res == CURLE_OK) {
@@ -2811,6 +2914,7 @@ int backend_discovery_is_running(void) {
     snprintf(url, sizeof(url), "%s/api/discovery/status", g_base_url);
 
     ResponseBuffer response = {0};
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
@@ -2818,6 +2922,7 @@ int backend_discovery_is_running(void) {
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 2L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     int running = 0;
     if (res == CURLE_OK && response.data) {
@@ -2842,6 +2947,7 @@ int backend_discovery_get_printers(PrinterDiscoveryResult *results, int max_resu
     snprintf(url, sizeof(url), "%s/api/discovery/printers", g_base_url);
 
     ResponseBuffer response = {0};
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
@@ -2849,6 +2955,7 @@ int backend_discovery_get_printers(PrinterDiscoveryResult *results, int max_resu
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 2L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
 
     int count = 0;
     if (res == CURLE_OK && response.data) {
@@ -2932,6 +3039,7 @@ int backend_scale_tare(void) {
     char url[256];
     snprintf(url, sizeof(url), "%s/api/device/scale/tare", g_base_url);
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -2939,6 +3047,7 @@ int backend_scale_tare(void) {
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
     if (res == CURLE_OK) {
         printf("[backend] Scale tare command sent\n");
         return 0;
@@ -2954,6 +3063,7 @@ int backend_scale_calibrate(float known_weight_grams) {
     char url[256];
     snprintf(url, sizeof(url), "%s/api/device/scale/calibrate?known_weight=%.1f", g_base_url, known_weight_grams);
 
+    pthread_mutex_lock(&g_curl_mutex);
     curl_easy_reset(g_curl);
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_POST, 1L);
@@ -2961,6 +3071,7 @@ int backend_scale_calibrate(float known_weight_grams) {
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
     if (res == CURLE_OK) {
         printf("[backend] Scale calibrate command sent (known weight: %.1f g)\n", known_weight_grams);
         return 0;
@@ -2982,6 +3093,7 @@ int backend_search_colors(const char *manufacturer, const char *material,
     char params[256] = "";
     int has_params = 0;
 
+    pthread_mutex_lock(&g_curl_mutex);
     if (manufacturer && manufacturer[0]) {
         char *encoded = curl_easy_escape(g_curl, manufacturer, 0);
         if (encoded) {
@@ -3013,6 +3125,7 @@ int backend_search_colors(const char *manufacturer, const char *material,
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 10L);
 
     CURLcode res = curl_easy_perform(g_curl);
+    pthread_mutex_unlock(&g_curl_mutex);
     if (res != CURLE_OK) {
         printf("[backend] Color search failed: %s\n", curl_easy_strerror(res));
         free(response.data);
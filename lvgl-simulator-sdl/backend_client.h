@@ -124,10 +124,10 @@ const BackendPrinterState *backend_get_printer_by_serial(const char *serial);
 // Get first connected printer (convenience)
 const BackendPrinterState *backend_get_first_printer(void);
 
-// Fetch cover image for a printer to temp file
-// Returns path to temp file on success, NULL on failure
-// The returned path is valid until the next call
-const char *backend_fetch_cover_image(const char *serial);
+// Download the cover image (raw RGB565) of a printer's current job into buf
+// Returns the number of bytes read, -1 on error or if the image doesn't fit
+// Blocking, uses its own curl handle (safe off the poll thread)
+int backend_fetch_cover(const char *serial, uint8_t *buf, uint32_t buf_size);
 
 // =============================================================================
 // Firmware-compatible API (allows sharing ui_backend.c with firmware)
@@ -184,8 +184,38 @@ int backend_get_tray_now_left(int printer_index);
 int backend_get_tray_now_right(int printer_index);
 int backend_get_active_extruder(int printer_index);
 int backend_get_tray_reading_bits(int printer_index);  // Bitmask of trays being read (-1 if unknown)
-int backend_has_cover(void);
-const uint8_t* backend_get_cover_data(uint32_t *size_out);
+
+// Backend snapshot (matches firmware BackendSnapshot)
+#define BACKEND_SNAPSHOT_MAX_PRINTERS 4
+#define BACKEND_SNAPSHOT_MAX_AMS 8
+
+typedef struct {
+    uint32_t generation;    // Changes whenever this unit's data changes
+    AmsUnitCInfo info;
+} BackendAmsSnapshot;
+
+typedef struct {
+    uint32_t generation;    // Changes whenever the printer or any of its AMS units changes
+    BackendPrinterInfo info;
+    int tray_now;           // -1 if not available
+    int tray_now_left;
+    int tray_now_right;
+    int active_extruder;    // -1=unknown, 0=right, 1=left
+    uint8_t ams_count;
+    uint8_t _pad[3];
+    BackendAmsSnapshot ams[BACKEND_SNAPSHOT_MAX_AMS];
+} BackendPrinterSnapshot;
+
+typedef struct {
+    uint32_t generation;    // Latest generation handed out (0 = no data yet)
+    uint8_t printer_count;
+    uint8_t _pad[3];
+    BackendPrinterSnapshot printers[BACKEND_SNAPSHOT_MAX_PRINTERS];
+} BackendSnapshot;
+
+// Fill the snapshot; entries whose generation already matches are not copied
+// again, so always pass the same zero-initialized buffer
+void backend_get_snapshot(BackendSnapshot *snapshot);
 
 // Time functions (simulator provides system time)
 int time_get_hhmm(void);
@@ -227,6 +257,7 @@ typedef struct {
     char color_name[32];
     uint32_t color_rgba;
     int32_t label_weight;
+    int32_t weight_current;
     char slicer_filament[32];
     bool valid;
 } SpoolInfoC;
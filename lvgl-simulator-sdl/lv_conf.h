@@ -50,11 +50,14 @@
 #if LV_USE_DRAW_SW
     #define LV_DRAW_SW_ASM LV_DRAW_SW_ASM_NONE
     #define LV_DRAW_SW_COMPLEX 1
-    #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
+    #define LV_DRAW_SW_SHADOW_CACHE_SIZE 24   /* Same as the firmware */
     #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #define LV_DRAW_SW_GRADIENT_MAX_STOPS 2
 #endif
 
+/* Decoded image cache - same size as the firmware (indexed ui_image_*.c) */
+#define LV_CACHE_DEF_SIZE (64U * 1024U)
+
 /*====================
    GPU
  *====================*/
@@ -8,10 +8,16 @@
  * Usage:
  *   ./simulator                         # Uses default localhost:3000
  *   ./simulator http://192.168.1.10:3000  # Custom backend URL
+ *   ./simulator --backend http://192.168.1.10:3000
+ *   ./simulator --bench images          # Print render timings and exit
+ *   ./simulator --bench fonts
+ *   ./simulator --bench ams
+ *   ./simulator --bench shadows
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <pthread.h>
 #include <time.h>
@@ -20,6 +26,7 @@
 #include "ui/ui.h"
 #include "ui/screens.h"
 #include "sim_control.h"
+#include "sim_bench.h"
 
 #ifdef ENABLE_BACKEND_CLIENT
 #include "backend_client.h"
@@ -36,7 +43,69 @@ static uint32_t *fb_pixels;
 static lv_display_t *disp;
 static lv_indev_t *mouse_indev;
 
-static pthread_mutex_t lvgl_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t lvgl_mutex;  /* Recursive - posted callbacks may lock again */
+
+/* UI command queue - same contract as display_ui_post() on the firmware */
+#define UI_QUEUE_LEN 16
+typedef struct {
+    void (*cb)(void *arg);
+    void *arg;
+} ui_cmd_t;
+static ui_cmd_t ui_queue[UI_QUEUE_LEN];
+static int ui_queue_head = 0;
+static int ui_queue_count = 0;
+static pthread_mutex_t ui_queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Queue a callback to run on the LVGL (main) thread */
+bool display_ui_post(void (*cb)(void *arg), void *arg)
+{
+    if (!cb) return false;
+
+    pthread_mutex_lock(&ui_queue_mutex);
+    if (ui_queue_count >= UI_QUEUE_LEN) {
+        pthread_mutex_unlock(&ui_queue_mutex);
+        printf("[display] UI queue full, dropping command\n");
+        return false;
+    }
+    int tail = (ui_queue_head + ui_queue_count) % UI_QUEUE_LEN;
+    ui_queue[tail].cb = cb;
+    ui_queue[tail].arg = arg;
+    ui_queue_count++;
+    pthread_mutex_unlock(&ui_queue_mutex);
+    return true;
+}
+
+/* Lock LVGL for direct use from another thread */
+bool display_lock(int timeout_ms)
+{
+    (void)timeout_ms;
+    pthread_mutex_lock(&lvgl_mutex);
+    return true;
+}
+
+void display_unlock(void)
+{
+    pthread_mutex_unlock(&lvgl_mutex);
+}
+
+/* Run queued UI commands (called with lvgl_mutex held) */
+static void ui_queue_drain(void)
+{
+    while (1) {
+        ui_cmd_t cmd;
+        pthread_mutex_lock(&ui_queue_mutex);
+        if (ui_queue_count == 0) {
+            pthread_mutex_unlock(&ui_queue_mutex);
+            break;
+        }
+        cmd = ui_queue[ui_queue_head];
+        ui_queue_head = (ui_queue_head + 1) % UI_QUEUE_LEN;
+        ui_queue_count--;
+        pthread_mutex_unlock(&ui_queue_mutex);
+
+        cmd.cb(cmd.arg);
+    }
+}
 
 /* Display flush callback */
 static void sdl_flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *px_map)
@@ -210,8 +279,28 @@ static void sdl_render(void)
 
 int main(int argc, char **argv)
 {
-    (void)argc;
-    (void)argv;
+    const char *bench = NULL;
+#ifdef ENABLE_BACKEND_CLIENT
+    const char *backend_url = BACKEND_DEFAULT_URL;
+#endif
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bench") == 0 && i + 1 < argc) {
+            bench = argv[++i];
+        } else if (strcmp(argv[i], "--backend") == 0) {
+#ifdef ENABLE_BACKEND_CLIENT
+            if (i + 1 < argc) {
+                backend_url = argv[++i];
+            }
+#else
+            i++;  /* Offline build, ignore the URL */
+#endif
+        }
+#ifdef ENABLE_BACKEND_CLIENT
+        else {
+            backend_url = argv[i];
+        }
+#endif
+    }
 
     printf("===========================================\n");
     printf("  SpoolBuddy LVGL 9 Simulator\n");
@@ -219,16 +308,19 @@ int main(int argc, char **argv)
     printf("Display: %dx%d\n", DISP_HOR_RES, DISP_VER_RES);
 
 #ifdef ENABLE_BACKEND_CLIENT
-    const char *backend_url = BACKEND_DEFAULT_URL;
-    if (argc > 1) {
-        backend_url = argv[1];
-    }
     printf("Backend: %s\n", backend_url);
 #else
     printf("Backend: disabled (offline mode)\n");
 #endif
     printf("\n");
 
+    /* LVGL lock must be recursive (see display_lock) */
+    pthread_mutexattr_t lvgl_mutex_attr;
+    pthread_mutexattr_init(&lvgl_mutex_attr);
+    pthread_mutexattr_settype(&lvgl_mutex_attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&lvgl_mutex, &lvgl_mutex_attr);
+    pthread_mutexattr_destroy(&lvgl_mutex_attr);
+
     /* Initialize SDL */
     if (sdl_init() != 0) {
         return 1;
@@ -246,6 +338,15 @@ int main(int argc, char **argv)
     lvgl_display_init();
     lvgl_input_init();
 
+    if (bench) {
+        int result = sim_bench_run(bench, disp);
+#ifdef ENABLE_BACKEND_CLIENT
+        backend_cleanup();
+#endif
+        sdl_deinit();
+        return result;
+    }
+
     /* Start tick thread */
     pthread_t tick_tid;
     pthread_create(&tick_tid, NULL, tick_thread, NULL);
@@ -276,6 +377,7 @@ int main(int argc, char **argv)
         }
 
         pthread_mutex_lock(&lvgl_mutex);
+        ui_queue_drain();
         lv_task_handler();
         ui_tick();  /* Process navigation and screen changes */
         pthread_mutex_unlock(&lvgl_mutex);
@@ -0,0 +1,527 @@
+/**
+ * Simulator Benchmarks
+ * Every measurement is a full-screen redraw, minus the time of the same
+ * redraw without the object under test.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sim_bench.h"
+#include "ui/images.h"
+#include "ui/screens.h"
+#include "ui/ui_ams_strip.h"
+#include "ui/ui_shadow.h"
+
+#define BENCH_ITERATIONS 50
+
+static uint64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+/* Average time of a full redraw of the active screen (us) */
+static uint32_t redraw_us(lv_display_t *disp, int iterations)
+{
+    lv_obj_t *scr = lv_display_get_screen_active(disp);
+    uint64_t start = now_us();
+    for (int i = 0; i < iterations; i++) {
+        lv_obj_invalidate(scr);
+        lv_refr_now(disp);
+    }
+    return (uint32_t)((now_us() - start) / iterations);
+}
+
+static const char *cf_name(uint32_t cf)
+{
+    switch (cf) {
+        case LV_COLOR_FORMAT_ARGB8888: return "ARGB8888";
+        case LV_COLOR_FORMAT_RGB565:   return "RGB565";
+        case LV_COLOR_FORMAT_RGB565A8: return "RGB565A8";
+        case LV_COLOR_FORMAT_A8:       return "A8";
+        case LV_COLOR_FORMAT_I1:       return "I1";
+        case LV_COLOR_FORMAT_I2:       return "I2";
+        case LV_COLOR_FORMAT_I4:       return "I4";
+        case LV_COLOR_FORMAT_I8:       return "I8";
+        default:                       return "other";
+    }
+}
+
+/* =============================================================================
+ * Images
+ * ============================================================================= */
+
+static void bench_images(lv_display_t *disp)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x1a1a1a), 0);
+    lv_screen_load(scr);
+    uint32_t base = redraw_us(disp, BENCH_ITERATIONS);
+
+    printf("Image draw time (%d redraws, empty screen %u us)\n", BENCH_ITERATIONS, base);
+    printf("%-30s %9s %-9s %8s %10s %10s\n", "Image", "Size", "Format", "Bytes", "First us", "Cached us");
+
+    uint32_t total_bytes = 0;
+    for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+        const lv_image_dsc_t *dsc = images[i].img_dsc;
+
+        lv_obj_t *img = lv_image_create(scr);
+        lv_image_set_src(img, dsc);
+        lv_obj_center(img);
+        // A8 icons take their color from image_recolor, as in the UI
+        lv_obj_set_style_image_recolor(img, lv_color_hex(0x00ff00), 0);
+
+        // First draw includes decoding (indexed images) into the image cache
+        lv_image_cache_drop(dsc);
+        uint32_t first = redraw_us(disp, 1);
+        uint32_t cached = redraw_us(disp, BENCH_ITERATIONS);
+
+        char size[16];
+        snprintf(size, sizeof(size), "%dx%d", (int)dsc->header.w, (int)dsc->header.h);
+        printf("%-30s %9s %-9s %8u %10u %10u\n", images[i].name, size, cf_name(dsc->header.cf),
+               (unsigned)dsc->data_size, first > base ? first - base : 0,
+               cached > base ? cached - base : 0);
+        total_bytes += dsc->data_size;
+
+        lv_obj_delete(img);
+    }
+    printf("Total image data: %u bytes\n", total_bytes);
+}
+
+/* =============================================================================
+ * Fonts
+ * ============================================================================= */
+
+// firmware/fonts, ASCII only (LV_SYMBOL_* glyphs are not drawn)
+LV_FONT_DECLARE(montserrat_14_1bpp)
+LV_FONT_DECLARE(montserrat_14_2bpp)
+LV_FONT_DECLARE(montserrat_14_4bpp)
+LV_FONT_DECLARE(montserrat_16_1bpp)
+LV_FONT_DECLARE(montserrat_16_2bpp)
+LV_FONT_DECLARE(montserrat_16_4bpp)
+LV_FONT_DECLARE(montserrat_20_1bpp)
+LV_FONT_DECLARE(montserrat_20_2bpp)
+LV_FONT_DECLARE(montserrat_20_4bpp)
+LV_FONT_DECLARE(montserrat_24_1bpp)
+LV_FONT_DECLARE(montserrat_24_2bpp)
+LV_FONT_DECLARE(montserrat_24_4bpp)
+
+typedef struct {
+    const lv_font_t *font;          // Built-in (or subset) font used by the UI
+    const lv_font_t *variant[3];    // 1, 2 and 4 bpp
+} font_variants_t;
+
+static const font_variants_t font_variants[] = {
+    { &lv_font_montserrat_14, { &montserrat_14_1bpp, &montserrat_14_2bpp, &montserrat_14_4bpp } },
+    { &lv_font_montserrat_16, { &montserrat_16_1bpp, &montserrat_16_2bpp, &montserrat_16_4bpp } },
+    { &lv_font_montserrat_20, { &montserrat_20_1bpp, &montserrat_20_2bpp, &montserrat_20_4bpp } },
+    { &lv_font_montserrat_24, { &montserrat_24_1bpp, &montserrat_24_2bpp, &montserrat_24_4bpp } },
+};
+
+typedef struct {
+    lv_obj_t **labels;
+    const lv_font_t **fonts;        // Font each label had when the screen was built
+    int count;
+} label_list_t;
+
+static void collect_labels(lv_obj_t *obj, label_list_t *list)
+{
+    if (lv_obj_check_type(obj, &lv_label_class)) {
+        list->labels = realloc(list->labels, (list->count + 1) * sizeof(*list->labels));
+        list->fonts = realloc(list->fonts, (list->count + 1) * sizeof(*list->fonts));
+        list->labels[list->count] = obj;
+        list->fonts[list->count] = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+        list->count++;
+    }
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) {
+        collect_labels(lv_obj_get_child(obj, i), list);
+    }
+}
+
+/* Point every label at variant (-1 = the font it was built with), returns the number changed */
+static int set_label_fonts(const label_list_t *list, int variant)
+{
+    int changed = 0;
+    for (int i = 0; i < list->count; i++) {
+        const lv_font_t *font = list->fonts[i];
+        for (size_t f = 0; variant >= 0 && f < sizeof(font_variants) / sizeof(font_variants[0]); f++) {
+            if (font_variants[f].font == font) {
+                font = font_variants[f].variant[variant];
+                changed++;
+                break;
+            }
+        }
+        lv_obj_set_style_text_font(list->labels[i], font, LV_PART_MAIN);
+    }
+    return changed;
+}
+
+static void bench_font_screen(lv_display_t *disp, const char *name, lv_obj_t *scr)
+{
+    static const char *variant_names[] = { "1 bpp", "2 bpp", "4 bpp" };
+    label_list_t list = { 0 };
+
+    lv_screen_load(scr);
+    collect_labels(scr, &list);
+
+    for (int i = 0; i < list.count; i++) lv_obj_add_flag(list.labels[i], LV_OBJ_FLAG_HIDDEN);
+    uint32_t base = redraw_us(disp, BENCH_ITERATIONS);
+    for (int i = 0; i < list.count; i++) lv_obj_remove_flag(list.labels[i], LV_OBJ_FLAG_HIDDEN);
+
+    uint32_t builtin = redraw_us(disp, BENCH_ITERATIONS);
+    printf("%-16s %-9s %7d %10u\n", name, UI_SUBSET_FONTS ? "subset" : "built-in", list.count,
+           builtin > base ? builtin - base : 0);
+
+    for (int v = 0; v < 3; v++) {
+        int changed = set_label_fonts(&list, v);
+        uint32_t us = redraw_us(disp, BENCH_ITERATIONS);
+        printf("%-16s %-9s %7d %10u\n", name, variant_names[v], changed, us > base ? us - base : 0);
+    }
+    set_label_fonts(&list, -1);
+
+    free(list.labels);
+    free(list.fonts);
+}
+
+static void bench_fonts(lv_display_t *disp)
+{
+    lv_theme_t *theme = lv_theme_default_init(disp, lv_palette_main(LV_PALETTE_BLUE),
+                                              lv_palette_main(LV_PALETTE_RED), true, LV_FONT_DEFAULT);
+    lv_display_set_theme(disp, theme);
+
+    printf("Text draw time (%d redraws, labels hidden = 0; 14/16/20/24 px labels retargeted)\n",
+           BENCH_ITERATIONS);
+    printf("%-16s %-9s %7s %10s\n", "Screen", "Font", "Labels", "Text us");
+
+    create_screen_ams_overview();
+    bench_font_screen(disp, "ams_overview", objects.ams_overview);
+    create_screen_scan_result();
+    bench_font_screen(disp, "scan_result", objects.scan_result);
+}
+
+/* =============================================================================
+ * AMS Units
+ * ============================================================================= */
+
+// ui_backend.c: creates the AMS overview strips
+extern void wire_ams_slot_click_handlers(void);
+
+// Tray colors of the benchmark units, 0 = empty (striped)
+static const uint32_t bench_trays[4] = { 0xE03030FF, 0, 0x2080E0FF, 0 };
+
+static uint32_t count_objects(lv_obj_t *obj)
+{
+    uint32_t count = 1;
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) {
+        count += count_objects(lv_obj_get_child(obj, i));
+    }
+    return count;
+}
+
+static void bench_ams_row(lv_display_t *disp, const char *screen, const char *variant)
+{
+    lv_obj_t *scr = lv_display_get_screen_active(disp);
+    lv_obj_update_layout(scr);
+    printf("%-16s %-12s %8u %10u\n", screen, variant, count_objects(scr),
+           redraw_us(disp, BENCH_ITERATIONS));
+}
+
+/* Main screen unit as built before ui_ams_strip: container, name label, slot
+ * objects with clip_corner and 3 rotated stripe objects per empty slot */
+static void legacy_main_unit(lv_obj_t *parent, int x, int y, const char *name, int slot_count)
+{
+    lv_obj_t *container = lv_obj_create(parent);
+    lv_obj_set_pos(container, x, y);
+    lv_obj_set_size(container, slot_count == 1 ? 56 : 120, 50);
+    lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_color(container, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_border_width(container, 3, 0);
+    lv_obj_set_style_border_color(container, lv_color_hex(0x3d3d3d), 0);
+    lv_obj_set_style_shadow_width(container, 5, 0);
+    lv_obj_set_style_shadow_ofs_x(container, 2, 0);
+    lv_obj_set_style_shadow_ofs_y(container, 2, 0);
+    lv_obj_set_style_shadow_spread(container, 2, 0);
+    lv_obj_set_style_shadow_opa(container, 100, 0);
+
+    lv_obj_t *label = lv_label_create(container);
+    lv_label_set_text(label, name);
+    lv_obj_set_style_text_font(label, slot_count == 1 ? &lv_font_montserrat_12 : &lv_font_montserrat_14, 0);
+    lv_obj_set_pos(label, slot_count == 1 ? -14 : 35, slot_count == 1 ? -17 : -18);
+
+    static const int slot_x[4] = { -17, 11, 39, 68 };
+    for (int i = 0; i < slot_count; i++) {
+        lv_obj_t *slot = lv_obj_create(container);
+        lv_obj_set_pos(slot, slot_count == 1 ? -10 : slot_x[i], slot_count == 1 ? -1 : -3);
+        lv_obj_set_size(slot, 23, 24);
+        lv_obj_clear_flag(slot, LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_set_style_pad_all(slot, 0, 0);
+        lv_obj_set_style_radius(slot, 5, 0);
+        lv_obj_set_style_clip_corner(slot, true, 0);
+        lv_obj_set_style_border_color(slot, lv_color_hex(0xbab1b1), 0);
+        lv_obj_set_style_border_width(slot, 2, 0);
+
+        uint32_t rgba = bench_trays[i];
+        if (rgba) {
+            lv_obj_set_style_bg_color(slot, lv_color_hex(rgba >> 8), 0);
+            continue;
+        }
+        lv_obj_set_style_bg_color(slot, lv_color_hex(0x0a0a0a), 0);
+        for (int j = 0; j < 3; j++) {
+            lv_obj_t *stripe = lv_obj_create(slot);
+            lv_obj_remove_style_all(stripe);
+            lv_obj_set_size(stripe, 31, 3);
+            lv_obj_set_pos(stripe, -4, 6 + j * 10);
+            lv_obj_set_style_bg_color(stripe, lv_color_hex(0x3a3a3a), 0);
+            lv_obj_set_style_bg_opa(stripe, 255, 0);
+            lv_obj_set_style_transform_rotation(stripe, -200, 0);
+        }
+    }
+}
+
+static void strip_main_unit(lv_obj_t *parent, int x, int y, const char *name, int slot_count)
+{
+    lv_obj_t *strip = ui_ams_strip_create(parent, UI_AMS_STRIP_MAIN, slot_count);
+    lv_obj_set_pos(strip, x, y);
+    lv_obj_set_style_bg_color(strip, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_opa(strip, 255, 0);
+    lv_obj_set_style_radius(strip, 10, 0);
+    lv_obj_set_style_border_width(strip, 3, 0);
+    lv_obj_set_style_border_color(strip, lv_color_hex(0x3d3d3d), 0);
+    lv_obj_set_style_text_color(strip, lv_color_hex(0xfafafa), 0);
+    lv_obj_set_style_shadow_width(strip, 5, 0);
+    lv_obj_set_style_shadow_ofs_x(strip, 2, 0);
+    lv_obj_set_style_shadow_ofs_y(strip, 2, 0);
+    lv_obj_set_style_shadow_spread(strip, 2, 0);
+    lv_obj_set_style_shadow_opa(strip, 100, 0);
+    ui_ams_strip_set_name(strip, name);
+    for (int i = 0; i < slot_count; i++) {
+        ui_ams_strip_set_slot(strip, i, bench_trays[i], NULL, NULL);
+    }
+}
+
+/* Left nozzle area of the main screen: AMS A-C, HT-A and Ext */
+static void bench_ams_main(lv_display_t *disp, bool strips)
+{
+    void (*unit)(lv_obj_t *, int, int, const char *, int) = strips ? strip_main_unit : legacy_main_unit;
+
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *nozzle = lv_obj_create(scr);
+    lv_obj_set_pos(nozzle, 10, 100);
+    lv_obj_set_size(nozzle, 420, 160);
+    lv_obj_clear_flag(nozzle, LV_OBJ_FLAG_SCROLLABLE);
+    lv_screen_load(scr);
+
+    unit(nozzle, -16, -2, "A", 4);
+    unit(nozzle, 111, -2, "B", 4);
+    unit(nozzle, 238, -2, "C", 4);
+    unit(nozzle, -16, 50, "HT-A", 1);
+    unit(nozzle, 48, 50, "Ext-L", 1);
+
+    bench_ams_row(disp, "main", strips ? "strips" : "objects");
+    lv_obj_delete(scr);
+}
+
+/* Scan result panels: strips placed like ui_scan_result.c does, replacing
+ * the name label and the slots (slot_count entries of slots) */
+static void replace_scan_panel(lv_obj_t *panel, lv_obj_t *label, int slot_count, lv_obj_t *const slots[])
+{
+    if (!panel) return;
+    char name[8] = "";
+    if (label) snprintf(name, sizeof(name), "%s", lv_label_get_text(label));
+
+    lv_obj_t *strip = ui_ams_strip_create(panel, UI_AMS_STRIP_SCAN, slot_count);
+    if (slot_count == 1) {
+        lv_obj_set_pos(strip, -14, -17);
+    } else {
+        lv_obj_set_pos(strip, -11, -14);
+    }
+    ui_ams_strip_replace(strip, &label, 1);
+    ui_ams_strip_replace(strip, slots, slot_count);
+    ui_ams_strip_set_name(strip, name);
+    for (int i = 0; i < slot_count; i++) {
+        ui_ams_strip_set_slot(strip, i, bench_trays[i], NULL, NULL);
+    }
+}
+
+#define SCAN_QUAD(unit) \
+    objects.scan_screen_main_panel_ams_panel_##unit, objects.scan_screen_main_panel_ams_panel_##unit##_label_name, 4, \
+    (lv_obj_t *const[]){ objects.scan_screen_main_panel_ams_panel_##unit##_slot_1, \
+                         objects.scan_screen_main_panel_ams_panel_##unit##_slot_2, \
+                         objects.scan_screen_main_panel_ams_panel_##unit##_slot_3, \
+                         objects.scan_screen_main_panel_ams_panel_##unit##_slot_4 }
+
+#define SCAN_SINGLE(unit, slot) \
+    objects.scan_screen_main_panel_ams_panel_##unit, objects.scan_screen_main_panel_ams_panel_##unit##_label_name, 1, \
+    (lv_obj_t *const[]){ objects.scan_screen_main_panel_ams_panel_##unit##_##slot }
+
+static void bench_ams(lv_display_t *disp)
+{
+    lv_theme_t *theme = lv_theme_default_init(disp, lv_palette_main(LV_PALETTE_BLUE),
+                                              lv_palette_main(LV_PALETTE_RED), true, LV_FONT_DEFAULT);
+    lv_display_set_theme(disp, theme);
+
+    printf("AMS unit draw cost (%d full redraws; objects = whole screen)\n", BENCH_ITERATIONS);
+    printf("%-16s %-12s %8s %10s\n", "Screen", "Units", "Objects", "Redraw us");
+
+    bench_ams_main(disp, false);
+    bench_ams_main(disp, true);
+
+    // EEZ placeholders as created, then with the panels' slot objects replaced
+    create_screen_ams_overview();
+    lv_screen_load(objects.ams_overview);
+    bench_ams_row(disp, "ams_overview", "objects");
+    wire_ams_slot_click_handlers();
+    bench_ams_row(disp, "ams_overview", "strips");
+
+    create_screen_scan_result();
+    lv_screen_load(objects.scan_result);
+    bench_ams_row(disp, "scan_result", "objects");
+    replace_scan_panel(SCAN_QUAD(ams_a));
+    replace_scan_panel(SCAN_QUAD(ams_b));
+    replace_scan_panel(SCAN_QUAD(ams_c));
+    replace_scan_panel(SCAN_QUAD(ams_d));
+    replace_scan_panel(SCAN_SINGLE(ht_a, slot_color));
+    replace_scan_panel(SCAN_SINGLE(ht_b, slot));
+    replace_scan_panel(SCAN_SINGLE(ext_l, slot));
+    replace_scan_panel(SCAN_SINGLE(ext_r, slot));
+    bench_ams_row(disp, "scan_result", "strips");
+}
+
+/* =============================================================================
+ * Shadows
+ * ============================================================================= */
+
+typedef struct {
+    lv_obj_t **objs;
+    int32_t *widths;                // Shadow width of the styles
+    int count;
+} shadow_list_t;
+
+static void collect_shadows(lv_obj_t *obj, shadow_list_t *list)
+{
+    int32_t width = lv_obj_get_style_shadow_width(obj, LV_PART_MAIN);
+    if (width > 0) {
+        list->objs = realloc(list->objs, (list->count + 1) * sizeof(*list->objs));
+        list->widths = realloc(list->widths, (list->count + 1) * sizeof(*list->widths));
+        list->objs[list->count] = obj;
+        list->widths[list->count] = width;
+        list->count++;
+    }
+    for (uint32_t i = 0; i < lv_obj_get_child_count(obj); i++) {
+        collect_shadows(lv_obj_get_child(obj, i), list);
+    }
+}
+
+static void set_shadows(const shadow_list_t *list, bool on)
+{
+    for (int i = 0; i < list->count; i++) {
+        lv_obj_set_style_shadow_width(list->objs[i], on ? list->widths[i] : 0, LV_PART_MAIN);
+    }
+}
+
+/* Average time of redrawing one object's area, shadow included (us) */
+static uint32_t redraw_obj_us(lv_display_t *disp, lv_obj_t *obj, int iterations)
+{
+    uint64_t start = now_us();
+    for (int i = 0; i < iterations; i++) {
+        lv_obj_invalidate(obj);
+        lv_refr_now(disp);
+    }
+    return (uint32_t)((now_us() - start) / iterations);
+}
+
+static void bench_shadow_row(lv_display_t *disp, const char *strategy, lv_obj_t *panel,
+                             uint32_t base_screen, uint32_t base_panel)
+{
+    uint32_t screen = redraw_us(disp, BENCH_ITERATIONS);
+    uint32_t one = redraw_obj_us(disp, panel, BENCH_ITERATIONS);
+    printf("%-10s %10u %10u %10u %10u\n", strategy, screen, screen > base_screen ? screen - base_screen : 0,
+           one, one > base_panel ? one - base_panel : 0);
+}
+
+/* One screen as the UI builds it, shadows off / LVGL / ui_shadow. The panel
+ * row redraws `panel`, or the first object with a shadow if it is NULL */
+static void bench_shadow_screen(lv_display_t *disp, const char *name, lv_obj_t *screen, lv_obj_t *panel)
+{
+    lv_screen_load(screen);
+    lv_obj_update_layout(screen);
+
+    shadow_list_t list = { 0 };
+    collect_shadows(screen, &list);
+    if (list.count == 0) {
+        printf("%s: no objects with a shadow\n\n", name);
+        return;
+    }
+    if (!panel) panel = list.objs[0];
+
+    printf("Shadow draw cost on %s (%d redraws, %d objects with a shadow, "
+           "LV_DRAW_SW_SHADOW_CACHE_SIZE %d)\n", name, BENCH_ITERATIONS, list.count, LV_DRAW_SW_SHADOW_CACHE_SIZE);
+    printf("%-10s %10s %10s %10s %10s\n", "Strategy", "Screen us", "Shadow us", "Panel us", "Shadow us");
+
+    set_shadows(&list, false);
+    uint32_t base_screen = redraw_us(disp, BENCH_ITERATIONS);
+    uint32_t base_panel = redraw_obj_us(disp, panel, BENCH_ITERATIONS);
+    printf("%-10s %10u %10s %10u %10s\n", "none", base_screen, "-", base_panel, "-");
+    set_shadows(&list, true);
+
+    bench_shadow_row(disp, "lvgl", panel, base_screen, base_panel);
+
+    uint64_t start = now_us();
+    int baked = ui_shadow_bake_tree(screen);
+    uint32_t bake_us = (uint32_t)(now_us() - start);
+    bench_shadow_row(disp, "baked", panel, base_screen, base_panel);
+    printf("%d of %d shadows baked in %u us, %u bytes cached\n\n", baked, list.count, bake_us,
+           (unsigned)ui_shadow_cache_bytes());
+
+    ui_shadow_unbake_tree(screen);
+    free(list.objs);
+    free(list.widths);
+}
+
+/* The screens ui.c bakes shadows on */
+static void bench_shadows(lv_display_t *disp)
+{
+    lv_theme_t *theme = lv_theme_default_init(disp, lv_palette_main(LV_PALETTE_BLUE),
+                                              lv_palette_main(LV_PALETTE_RED), true, LV_FONT_DEFAULT);
+    lv_display_set_theme(disp, theme);
+
+    create_screen_main_screen();
+    bench_shadow_screen(disp, "main_screen", objects.main_screen, NULL);
+
+    create_screen_ams_overview();
+    wire_ams_slot_click_handlers();
+    bench_shadow_screen(disp, "ams_overview", objects.ams_overview, objects.ams_screen_ams_panel_ams_a);
+
+    create_screen_scan_result();
+    bench_shadow_screen(disp, "scan_result", objects.scan_result, NULL);
+}
+
+/* =============================================================================
+ * Entry Point
+ * ============================================================================= */
+
+int sim_bench_run(const char *name, lv_display_t *disp)
+{
+    if (strcmp(name, "images") == 0) {
+        bench_images(disp);
+        return 0;
+    }
+    if (strcmp(name, "fonts") == 0) {
+        bench_fonts(disp);
+        return 0;
+    }
+    if (strcmp(name, "ams") == 0) {
+        bench_ams(disp);
+        return 0;
+    }
+    if (strcmp(name, "shadows") == 0) {
+        bench_shadows(disp);
+        return 0;
+    }
+
+    fprintf(stderr, "Unknown benchmark '%s' (available: images, fonts, ams, shadows)\n", name);
+    return 1;
+}
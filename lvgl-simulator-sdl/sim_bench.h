@@ -0,0 +1,29 @@
+/**
+ * Simulator Benchmarks
+ * Headless render timing, run with ./simulator --bench <name>
+ *
+ * Times are host CPU times - compare runs on the same machine (e.g. before
+ * and after an asset change), not against the ESP32.
+ */
+
+#ifndef SIM_BENCH_H
+#define SIM_BENCH_H
+
+#include "lvgl.h"
+
+/**
+ * Run a benchmark and print the results
+ * @param name "images": draw time of every EEZ image (first and cached draw)
+ *             "fonts":  text draw time of the AMS overview and scan result
+ *                       screens with the UI fonts and 1/2/4 bpp Montserrat
+ *             "ams":    object count and redraw time of the AMS units on the
+ *                       main, AMS overview and scan result screens, per-slot
+ *                       objects vs ui_ams_strip
+ *             "shadows": full-screen and one-panel redraw time of the AMS
+ *                        overview with shadows off, drawn by LVGL and
+ *                        baked by ui_shadow
+ * @return 0 on success, 1 for an unknown name
+ */
+int sim_bench_run(const char *name, lv_display_t *disp);
+
+#endif // SIM_BENCH_H
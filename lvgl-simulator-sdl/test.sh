@@ -8,5 +8,8 @@ ctest --output-on-failure
 # Run test executables directly
 ./tests/unit_tests
 ./tests/integration_tests
+./tests/soak_tests
+# Benchmarks (timing only)
+./tests/preset_search_bench
 cd ..
   
\ No newline at end of file
@@ -0,0 +1,168 @@
+/**
+ * Preset Search Micro-Benchmark
+ * Types queries character by character against a few thousand synthetic
+ * preset names and compares the per-keystroke cost of the previous
+ * full-rescan filter with ui_preset_search. Both must return the same result.
+ *
+ * Built with UI_PRESET_SEARCH_MAX_PRESETS raised to BENCH_PRESETS.
+ * Repetitions can be changed with BENCH_REPEAT (environment).
+ */
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ui_preset_search.h"
+
+#define BENCH_PRESETS 4000
+#define BENCH_DEFAULT_REPEAT 50
+
+#if UI_PRESET_SEARCH_MAX_PRESETS < BENCH_PRESETS
+#error "Build with UI_PRESET_SEARCH_MAX_PRESETS >= BENCH_PRESETS"
+#endif
+
+static char names[BENCH_PRESETS][UI_PRESET_SEARCH_NAME_LEN];
+static int16_t reference[BENCH_PRESETS];
+
+static const char *brands[] = {
+    "Bambu", "Generic", "Polymaker", "eSUN", "Elegoo", "Sunlu", "Overture",
+    "Prusament", "Jayo", "Kingroon", "Eryone", "Fiberon",
+};
+static const char *materials[] = {
+    "PLA", "PLA Basic", "PLA Matte", "PLA Silk", "PLA-CF", "PETG", "PETG HF",
+    "PETG-CF", "ABS", "ASA", "TPU 95A", "PC", "PA6-CF", "PVA", "Support W",
+};
+static const char *printers[] = {
+    "@BBL X1C", "@BBL X1C 0.2 nozzle", "@BBL P1S", "@BBL P1P", "@BBL A1",
+    "@BBL A1 mini", "@BBL X1E", "@BBL H2D",
+};
+
+static const char *queries[] = {
+    "bambu pla matte x1c",
+    "petg hf p1s",
+    "generic asa",
+    "polymaker pla-cf @bbl a1 mini",
+};
+
+// Previous implementation from ui_ams_slot_modal.c
+static bool naive_matches(const char *name, const char *query) {
+    if (!query || !query[0]) return true;
+
+    char lower_name[128];
+    size_t len = strlen(name);
+    if (len >= sizeof(lower_name)) len = sizeof(lower_name) - 1;
+    for (size_t j = 0; j < len; j++) {
+        lower_name[j] = tolower((unsigned char)name[j]);
+    }
+    lower_name[len] = '\0';
+
+    char query_copy[64];
+    strncpy(query_copy, query, sizeof(query_copy) - 1);
+    query_copy[sizeof(query_copy) - 1] = '\0';
+    for (size_t j = 0; query_copy[j]; j++) {
+        query_copy[j] = tolower((unsigned char)query_copy[j]);
+    }
+
+    char *saveptr;
+    char *word = strtok_r(query_copy, " ", &saveptr);
+    while (word) {
+        if (word[0] && !strstr(lower_name, word)) {
+            return false;
+        }
+        word = strtok_r(NULL, " ", &saveptr);
+    }
+    return true;
+}
+
+static int naive_query(const char *query) {
+    int count = 0;
+    for (int i = 0; i < BENCH_PRESETS; i++) {
+        if (naive_matches(names[i], query)) {
+            reference[count++] = (int16_t)i;
+        }
+    }
+    return count;
+}
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void generate_names(void) {
+    unsigned seed = 12345;
+    for (int i = 0; i < BENCH_PRESETS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        const char *brand = brands[(seed >> 8) % (sizeof(brands) / sizeof(brands[0]))];
+        const char *material = materials[(seed >> 12) % (sizeof(materials) / sizeof(materials[0]))];
+        const char *printer = printers[(seed >> 16) % (sizeof(printers) / sizeof(printers[0]))];
+        if (i % 5 == 0) {
+            snprintf(names[i], sizeof(names[i]), "%s %s %s #%d", brand, material, printer, i);
+        } else {
+            snprintf(names[i], sizeof(names[i]), "%s %s %s", brand, material, printer);
+        }
+    }
+}
+
+int main(void) {
+    const char *env = getenv("BENCH_REPEAT");
+    int repeat = env && atoi(env) > 0 ? atoi(env) : BENCH_DEFAULT_REPEAT;
+
+    generate_names();
+
+    double start = now_us();
+    ui_preset_search_reset();
+    for (int i = 0; i < BENCH_PRESETS; i++) {
+        ui_preset_search_add(names[i]);
+    }
+    double build_us = now_us() - start;
+
+    printf("\n=== Preset Search Benchmark (%d presets, %d repetitions) ===\n\n", BENCH_PRESETS, repeat);
+    printf("  Index build: %.1f us\n\n", build_us);
+    printf("  %-32s %10s %10s %8s\n", "Query (typed)", "Rescan us", "Index us", "Speedup");
+
+    double total_naive = 0, total_index = 0;
+    int keystrokes = 0;
+    for (size_t q = 0; q < sizeof(queries) / sizeof(queries[0]); q++) {
+        char typed[UI_PRESET_SEARCH_NAME_LEN];
+        size_t len = strlen(queries[q]);
+        double naive_us = 0, index_us = 0;
+
+        for (int r = 0; r < repeat; r++) {
+            // A fresh query each repetition, then one keystroke at a time
+            ui_preset_search_query("", NULL);
+            for (size_t n = 1; n <= len; n++) {
+                memcpy(typed, queries[q], n);
+                typed[n] = '\0';
+
+                double t0 = now_us();
+                int expected = naive_query(typed);
+                double t1 = now_us();
+                const int16_t *results;
+                int count = ui_preset_search_query(typed, &results);
+                double t2 = now_us();
+                naive_us += t1 - t0;
+                index_us += t2 - t1;
+
+                if (count != expected || memcmp(results, reference, count * sizeof(int16_t)) != 0) {
+                    printf("  MISMATCH for '%s': %d results, expected %d\n", typed, count, expected);
+                    return 1;
+                }
+            }
+        }
+
+        naive_us /= repeat * (double)len;
+        index_us /= repeat * (double)len;
+        printf("  %-32s %10.1f %10.1f %7.1fx\n", queries[q], naive_us, index_us, naive_us / index_us);
+        total_naive += naive_us * len;
+        total_index += index_us * len;
+        keystrokes += (int)len;
+    }
+
+    printf("\n  Mean per keystroke: rescan %.1f us, index %.1f us (%.1fx)\n\n",
+           total_naive / keystrokes, total_index / keystrokes, total_naive / total_index);
+    return 0;
+}
@@ -0,0 +1,267 @@
+/**
+ * Navigation Soak Test
+ * Runs the real UI headless (no SDL window) through thousands of scripted
+ * screen transitions, NFC popup and AMS slot modal cycles, and fails if
+ * heap usage or the LVGL object count grows.
+ *
+ * Iterations can be changed with SOAK_ITERATIONS (environment).
+ */
+
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "ui.h"
+#include "ui_internal.h"
+#include "ui_async.h"
+#include "ui_ams_slot_modal.h"
+#include "ui_mem.h"
+#include "ui_state.h"
+#include "sim_control.h"
+
+#define SOAK_HOR_RES 800
+#define SOAK_VER_RES 480
+#define SOAK_DEFAULT_ITERATIONS 500
+#define SOAK_WARMUP_ITERATIONS 3
+#define SOAK_HEAP_TOLERANCE 1024     // Bytes of growth allowed (allocator rounding)
+
+// Scripted route - every EEZ screen and every programmatic screen
+static const int soak_route[] = {
+    SCREEN_ID_MAIN_SCREEN,
+    SCREEN_ID_AMS_OVERVIEW,
+    SCREEN_ID_MAIN_SCREEN,
+    SCREEN_ID_SCAN_RESULT,
+    SCREEN_ID_SPOOL_DETAILS,
+    SCREEN_ID_SETTINGS_SCREEN,
+    SCREEN_ID_SETTINGS_WIFI_SCREEN,
+    SCREEN_ID_SETTINGS_SCREEN,
+    SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN,
+    SCREEN_ID_SETTINGS_DISPLAY_SCREEN,
+    SCREEN_ID_SETTINGS_UPDATE_SCREEN,
+    SCREEN_ID_NFC_SCREEN,
+    SCREEN_ID_SCALE_CALIBRATION_SCREEN,
+    SCREEN_ID_KEYBOARD_LAYOUT_SCREEN,
+};
+#define SOAK_ROUTE_LEN (sizeof(soak_route) / sizeof(soak_route[0]))
+
+static bool soak_initialized = false;
+
+// Simulator main.c provides these; the UI posts async results through them.
+// Same contract as main.c: queued from any thread, run by soak_step() on the
+// test (LVGL) thread.
+#define SOAK_UI_QUEUE_LEN 16
+typedef struct {
+    void (*cb)(void *arg);
+    void *arg;
+} soak_ui_cmd_t;
+static soak_ui_cmd_t soak_ui_queue[SOAK_UI_QUEUE_LEN];
+static int soak_ui_queue_head = 0;
+static int soak_ui_queue_count = 0;
+static pthread_mutex_t soak_ui_queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+bool display_ui_post(void (*cb)(void *arg), void *arg) {
+    if (!cb) return false;
+
+    pthread_mutex_lock(&soak_ui_queue_mutex);
+    if (soak_ui_queue_count >= SOAK_UI_QUEUE_LEN) {
+        pthread_mutex_unlock(&soak_ui_queue_mutex);
+        return false;
+    }
+    int tail = (soak_ui_queue_head + soak_ui_queue_count) % SOAK_UI_QUEUE_LEN;
+    soak_ui_queue[tail].cb = cb;
+    soak_ui_queue[tail].arg = arg;
+    soak_ui_queue_count++;
+    pthread_mutex_unlock(&soak_ui_queue_mutex);
+    return true;
+}
+
+static void soak_ui_queue_drain(void) {
+    for (;;) {
+        soak_ui_cmd_t cmd;
+        pthread_mutex_lock(&soak_ui_queue_mutex);
+        if (soak_ui_queue_count == 0) {
+            pthread_mutex_unlock(&soak_ui_queue_mutex);
+            break;
+        }
+        cmd = soak_ui_queue[soak_ui_queue_head];
+        soak_ui_queue_head = (soak_ui_queue_head + 1) % SOAK_UI_QUEUE_LEN;
+        soak_ui_queue_count--;
+        pthread_mutex_unlock(&soak_ui_queue_mutex);
+
+        cmd.cb(cmd.arg);
+    }
+}
+
+bool display_lock(int timeout_ms) {
+    (void)timeout_ms;
+    return true;
+}
+
+void display_unlock(void) {
+}
+
+static void soak_flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *px_map) {
+    (void)area;
+    (void)px_map;
+    lv_display_flush_ready(display);
+}
+
+static void soak_init(void) {
+    if (soak_initialized) return;
+
+    static uint8_t buf[SOAK_HOR_RES * 48 * 2];
+    lv_init();
+    lv_display_t *disp = lv_display_create(SOAK_HOR_RES, SOAK_VER_RES);
+    lv_display_set_flush_cb(disp, soak_flush_cb);
+    lv_display_set_buffers(disp, buf, NULL, sizeof(buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    ui_init();
+    soak_initialized = true;
+}
+
+// One UI frame: enough time for a state sample, then the UI and LVGL timers
+static void soak_step(void) {
+    soak_ui_queue_drain();
+    lv_tick_inc(UI_STATE_POLL_MS);
+    ui_tick();
+    lv_timer_handler();
+}
+
+// Wait for every async request to finish and its done callback to run, so
+// that samples are taken at the same point every iteration
+static void soak_settle(void) {
+    while (!ui_async_idle()) {
+        usleep(1000);
+        soak_ui_queue_drain();
+    }
+}
+
+static void soak_navigate(int screen_id) {
+    pendingScreen = (enum ScreensEnum)screen_id;
+    soak_step();
+    soak_step();
+}
+
+// Show the NFC popup on the main screen; it is closed by the next navigation
+static void soak_nfc_popup(void) {
+    sim_set_nfc_tag_present(true);
+    soak_step();
+    soak_settle();  // Inventory lookup fills in the card
+    sim_set_nfc_tag_present(false);
+    soak_step();
+}
+
+// Open the AMS slot modal on the AMS overview, let its data fetch finish
+// (the backend is offline, so it ends with the empty lists) and close it
+static void soak_ams_slot_modal(void) {
+    ui_ams_slot_modal_open("SOAK00000000000", 0, 1, 4, -1, "PLA", "FF0000FF", NULL);
+    soak_step();    // load_data_timer_cb starts the fetch
+    soak_step();
+    soak_settle();
+    soak_step();    // Fetched data shown
+    ui_ams_slot_modal_close();
+    soak_step();
+}
+
+static void soak_run_route(void) {
+    for (size_t i = 0; i < SOAK_ROUTE_LEN; i++) {
+        soak_navigate(soak_route[i]);
+        if (soak_route[i] == SCREEN_ID_MAIN_SCREEN) {
+            soak_nfc_popup();
+        } else if (soak_route[i] == SCREEN_ID_AMS_OVERVIEW) {
+            soak_ams_slot_modal();
+        }
+    }
+}
+
+static int soak_iterations(void) {
+    const char *env = getenv("SOAK_ITERATIONS");
+    int n = env ? atoi(env) : 0;
+    return n > 0 ? n : SOAK_DEFAULT_ITERATIONS;
+}
+
+// ============================================================================
+// Tests
+// ============================================================================
+
+void test_soak_route_is_recorded(void) {
+    soak_init();
+    ui_mem_reset();
+
+    soak_run_route();
+
+    // Every screen of the route was loaded and accounted
+    for (size_t i = 0; i < SOAK_ROUTE_LEN; i++) {
+        ui_mem_stats_t stats;
+        TEST_ASSERT_TRUE_MESSAGE(ui_mem_get_screen_stats(soak_route[i], &stats),
+                                 "screen missing from ui_mem stats");
+        TEST_ASSERT_GREATER_THAN_UINT32(0, stats.objects);
+    }
+
+    // NFC popup opened (on both visits of the main screen) and closed again
+    ui_mem_stats_t popup;
+    TEST_ASSERT_TRUE(ui_mem_get_modal_stats(UI_MEM_MODAL_NFC_POPUP, &popup));
+    TEST_ASSERT_EQUAL_UINT32(2, popup.count);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, popup.objects);
+
+    // AMS slot modal opened once and closed without leaving objects behind
+    ui_mem_stats_t slot_modal;
+    TEST_ASSERT_TRUE(ui_mem_get_modal_stats(UI_MEM_MODAL_AMS_SLOT, &slot_modal));
+    TEST_ASSERT_EQUAL_UINT32(1, slot_modal.count);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, slot_modal.objects);
+    TEST_ASSERT_EQUAL_INT32(0, slot_modal.object_leak);
+}
+
+void test_soak_navigation_does_not_leak(void) {
+    soak_init();
+
+    // Warm up: fill the screen cache and the lazily allocated UI state
+    for (int i = 0; i < SOAK_WARMUP_ITERATIONS; i++) {
+        soak_run_route();
+    }
+
+    soak_settle();
+    ui_mem_sample_t baseline;
+    ui_mem_sample(&baseline);
+
+    int iterations = soak_iterations();
+    uint32_t peak_used = baseline.heap_used;
+    for (int i = 0; i < iterations; i++) {
+        soak_run_route();
+        soak_settle();
+
+        ui_mem_sample_t now;
+        ui_mem_sample(&now);
+        if (now.heap_used > peak_used) {
+            peak_used = now.heap_used;
+        }
+        // Same point of the route every iteration - same object tree
+        if (now.objects != baseline.objects) {
+            printf("  iteration %d: %lu objects (baseline %lu)\n", i,
+                   (unsigned long)now.objects, (unsigned long)baseline.objects);
+            TEST_FAIL_MESSAGE("LVGL object count changed between identical iterations");
+        }
+    }
+
+    ui_mem_sample_t end;
+    ui_mem_sample(&end);
+    ui_mem_log_summary();
+    printf("  %d iterations (%d navigations): heap %lu -> %lu B (peak %lu B), %lu objects\n",
+           iterations, iterations * (int)SOAK_ROUTE_LEN,
+           (unsigned long)baseline.heap_used, (unsigned long)end.heap_used,
+           (unsigned long)peak_used, (unsigned long)end.objects);
+
+    TEST_ASSERT_UINT32_WITHIN(SOAK_HEAP_TOLERANCE, baseline.heap_used, end.heap_used);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(baseline.heap_used + SOAK_HEAP_TOLERANCE, peak_used);
+}
+
+// ============================================================================
+// Test Suite Runner
+// ============================================================================
+
+void run_navigation_soak_tests(void) {
+    RUN_TEST(test_soak_route_is_recorded);
+    RUN_TEST(test_soak_navigation_does_not_leak);
+}
@@ -9,6 +9,8 @@
 // Test suite declarations
 extern void run_parsing_tests(void);
 extern void run_formatting_tests(void);
+extern void run_preset_search_tests(void);
+extern void run_spool_cache_tests(void);
 
 void setUp(void) {
     // Called before each test
@@ -29,6 +31,8 @@ int main(int argc, char **argv) {
     // Run all test suites
     run_parsing_tests();
     run_formatting_tests();
+    run_preset_search_tests();
+    run_spool_cache_tests();
 
     int result = UNITY_END();
 
@@ -0,0 +1,35 @@
+/**
+ * Test Main - Soak Tests Runner
+ * Runs the headless navigation soak test for the LVGL Simulator
+ */
+
+#include <stdio.h>
+#include "unity.h"
+
+// Test suite declarations
+extern void run_navigation_soak_tests(void);
+
+void setUp(void) {
+    // Called before each test
+}
+
+void tearDown(void) {
+    // Called after each test
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+
+    printf("\n=== SpoolBuddy LVGL Simulator Soak Tests ===\n\n");
+
+    UNITY_BEGIN();
+
+    run_navigation_soak_tests();
+
+    int result = UNITY_END();
+
+    printf("\n=== Test Run Complete ===\n");
+
+    return result;
+}
@@ -0,0 +1,149 @@
+/**
+ * Unit Tests for the Preset Search Index
+ * Tests matching and incremental narrowing of ui_preset_search
+ */
+
+#include "unity.h"
+#include <string.h>
+#include "ui_preset_search.h"
+
+static const char *test_presets[] = {
+    "Bambu PLA Basic @BBL X1C",
+    "Bambu PLA Matte @BBL X1C",
+    "Bambu PETG HF @BBL P1S",
+    "Generic PLA @BBL A1",
+    "Generic PETG @BBL A1",
+    "My PLA Silk (custom)",
+};
+#define TEST_PRESET_COUNT (int)(sizeof(test_presets) / sizeof(test_presets[0]))
+
+static void index_test_presets(void) {
+    ui_preset_search_reset();
+    for (int i = 0; i < TEST_PRESET_COUNT; i++) {
+        ui_preset_search_add(test_presets[i]);
+    }
+}
+
+// ============================================================================
+// Matching Tests
+// ============================================================================
+
+void test_search_add_assigns_indices(void) {
+    ui_preset_search_reset();
+    TEST_ASSERT_EQUAL_INT(0, ui_preset_search_add("First"));
+    TEST_ASSERT_EQUAL_INT(1, ui_preset_search_add("Second"));
+    TEST_ASSERT_EQUAL_INT(2, ui_preset_search_count());
+}
+
+void test_search_empty_query_matches_all(void) {
+    index_test_presets();
+    const int16_t *results;
+    TEST_ASSERT_EQUAL_INT(TEST_PRESET_COUNT, ui_preset_search_query("", &results));
+    TEST_ASSERT_EQUAL_INT(TEST_PRESET_COUNT, ui_preset_search_query(NULL, &results));
+    TEST_ASSERT_EQUAL_INT(TEST_PRESET_COUNT, ui_preset_search_query("   ", &results));
+    for (int i = 0; i < TEST_PRESET_COUNT; i++) {
+        TEST_ASSERT_EQUAL_INT16(i, results[i]);
+    }
+}
+
+void test_search_is_case_insensitive(void) {
+    index_test_presets();
+    const int16_t *results;
+    TEST_ASSERT_EQUAL_INT(1, ui_preset_search_query("MaTTe", &results));
+    TEST_ASSERT_EQUAL_INT16(1, results[0]);
+    TEST_ASSERT_EQUAL_INT(1, ui_preset_search_query("SILK", &results));
+    TEST_ASSERT_EQUAL_INT16(5, results[0]);
+}
+
+void test_search_all_words_must_match(void) {
+    index_test_presets();
+    const int16_t *results;
+    TEST_ASSERT_EQUAL_INT(2, ui_preset_search_query("petg bbl", &results));
+    TEST_ASSERT_EQUAL_INT16(2, results[0]);
+    TEST_ASSERT_EQUAL_INT16(4, results[1]);
+    TEST_ASSERT_EQUAL_INT(1, ui_preset_search_query("  generic   petg ", &results));
+    TEST_ASSERT_EQUAL_INT16(4, results[0]);
+    TEST_ASSERT_EQUAL_INT(0, ui_preset_search_query("petg silk", &results));
+}
+
+void test_search_matches_substrings(void) {
+    index_test_presets();
+    const int16_t *results;
+    TEST_ASSERT_EQUAL_INT(1, ui_preset_search_query("ustom", &results));
+    TEST_ASSERT_EQUAL_INT16(5, results[0]);
+    TEST_ASSERT_EQUAL_INT(2, ui_preset_search_query("@bbl a1", &results));
+}
+
+// ============================================================================
+// Incremental Narrowing Tests
+// ============================================================================
+
+void test_search_typing_narrows_result(void) {
+    index_test_presets();
+    const int16_t *results;
+    TEST_ASSERT_EQUAL_INT(4, ui_preset_search_query("pla", &results));
+    TEST_ASSERT_EQUAL_INT(4, ui_preset_search_query("pla ", &results));
+    TEST_ASSERT_EQUAL_INT(3, ui_preset_search_query("pla b", &results));
+    TEST_ASSERT_EQUAL_INT(2, ui_preset_search_query("pla bambu", &results));
+    TEST_ASSERT_EQUAL_INT16(0, results[0]);
+    TEST_ASSERT_EQUAL_INT16(1, results[1]);
+}
+
+void test_search_backspace_rescans(void) {
+    index_test_presets();
+    const int16_t *results;
+    TEST_ASSERT_EQUAL_INT(1, ui_preset_search_query("pla matte", &results));
+    TEST_ASSERT_EQUAL_INT(4, ui_preset_search_query("pla", &results));
+    TEST_ASSERT_EQUAL_INT(2, ui_preset_search_query("petg", &results));
+}
+
+void test_search_add_invalidates_narrowing(void) {
+    index_test_presets();
+    const int16_t *results;
+    TEST_ASSERT_EQUAL_INT(1, ui_preset_search_query("silk", &results));
+    ui_preset_search_add("Generic PLA Silk @BBL A1");
+    TEST_ASSERT_EQUAL_INT(2, ui_preset_search_query("silk ", &results));
+}
+
+void test_search_full_index_rejects_names(void) {
+    ui_preset_search_reset();
+    for (int i = 0; i < UI_PRESET_SEARCH_MAX_PRESETS; i++) {
+        TEST_ASSERT_EQUAL_INT(i, ui_preset_search_add("Generic PLA"));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, ui_preset_search_add("Generic PETG"));
+    TEST_ASSERT_EQUAL_INT(UI_PRESET_SEARCH_MAX_PRESETS, ui_preset_search_count());
+}
+
+void test_search_long_name_is_truncated(void) {
+    char name[128];
+    memset(name, 'a', sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    name[100] = 'Z';
+
+    ui_preset_search_reset();
+    ui_preset_search_add(name);
+    TEST_ASSERT_EQUAL_INT(1, ui_preset_search_query("aaaa", NULL));
+    TEST_ASSERT_EQUAL_INT(0, ui_preset_search_query("z", NULL));
+}
+
+// ============================================================================
+// Test Suite Runner
+// ============================================================================
+
+void run_preset_search_tests(void) {
+    // Matching tests
+    RUN_TEST(test_search_add_assigns_indices);
+    RUN_TEST(test_search_empty_query_matches_all);
+    RUN_TEST(test_search_is_case_insensitive);
+    RUN_TEST(test_search_all_words_must_match);
+    RUN_TEST(test_search_matches_substrings);
+
+    // Incremental narrowing tests
+    RUN_TEST(test_search_typing_narrows_result);
+    RUN_TEST(test_search_backspace_rescans);
+    RUN_TEST(test_search_add_invalidates_narrowing);
+
+    // Capacity tests
+    RUN_TEST(test_search_full_index_rejects_names);
+    RUN_TEST(test_search_long_name_is_truncated);
+}
@@ -0,0 +1,181 @@
+/**
+ * Unit Tests for the Spool Cache
+ * Tests hits, expiry, eviction and invalidation of ui_spool_cache
+ */
+
+#include "unity.h"
+#include <stdio.h>
+#include <string.h>
+#include "mock_lvgl.h"
+#include "ui_spool_cache.h"
+
+// ============================================================================
+// Fake Backend
+// ============================================================================
+
+static int backend_spool_calls = 0;
+static int backend_k_profile_calls = 0;
+static int backend_weight = 1000;
+
+bool spool_get_by_tag(const char *tag_id, SpoolInfoC *info) {
+    backend_spool_calls++;
+    memset(info, 0, sizeof(*info));
+    if (strncmp(tag_id, "AA", 2) != 0) return false;
+
+    // Spool id derived from the tag: "AA01" -> "spool-AA01"
+    snprintf(info->id, sizeof(info->id), "spool-%s", tag_id);
+    strncpy(info->tag_id, tag_id, sizeof(info->tag_id) - 1);
+    strncpy(info->material, "PLA", sizeof(info->material) - 1);
+    info->weight_current = backend_weight;
+    info->valid = true;
+    return true;
+}
+
+bool spool_get_k_profile_for_printer(const char *spool_id, const char *printer_serial,
+                                     SpoolKProfileC *profile) {
+    backend_k_profile_calls++;
+    memset(profile, 0, sizeof(*profile));
+    if (strcmp(printer_serial, "P1") != 0) return false;
+
+    profile->cali_idx = 3;
+    strncpy(profile->k_value, "0.020", sizeof(profile->k_value) - 1);
+    strncpy(profile->printer_serial, printer_serial, sizeof(profile->printer_serial) - 1);
+    (void)spool_id;
+    return true;
+}
+
+static void reset_cache(void) {
+    ui_spool_cache_clear();
+    backend_spool_calls = 0;
+    backend_k_profile_calls = 0;
+    backend_weight = 1000;
+    mock_lvgl_set_tick(1000);
+}
+
+// ============================================================================
+// Lookup Tests
+// ============================================================================
+
+void test_cache_second_lookup_hits(void) {
+    reset_cache();
+    ui_spool_cache_stats_t before, after;
+    ui_spool_cache_get_stats(&before);
+
+    SpoolInfoC info;
+    TEST_ASSERT_TRUE(ui_spool_cache_get_by_tag("AA01", &info));
+    TEST_ASSERT_TRUE(ui_spool_cache_get_by_tag("AA01", &info));
+    TEST_ASSERT_EQUAL_STRING("spool-AA01", info.id);
+    TEST_ASSERT_EQUAL_INT(1, backend_spool_calls);
+
+    ui_spool_cache_get_stats(&after);
+    TEST_ASSERT_EQUAL_UINT32(1, after.spool_hits - before.spool_hits);
+    TEST_ASSERT_EQUAL_UINT32(1, after.spool_misses - before.spool_misses);
+}
+
+void test_cache_remembers_unknown_tag(void) {
+    reset_cache();
+    SpoolInfoC info;
+    TEST_ASSERT_FALSE(ui_spool_cache_get_by_tag("BB01", &info));
+    TEST_ASSERT_FALSE(ui_spool_cache_get_by_tag("BB01", &info));
+    TEST_ASSERT_FALSE(info.valid);
+    TEST_ASSERT_EQUAL_INT(1, backend_spool_calls);
+}
+
+void test_cache_k_profile_keyed_by_printer(void) {
+    reset_cache();
+    SpoolKProfileC profile;
+    TEST_ASSERT_TRUE(ui_spool_cache_get_k_profile("spool-AA01", "P1", &profile));
+    TEST_ASSERT_FALSE(ui_spool_cache_get_k_profile("spool-AA01", "P2", &profile));
+    TEST_ASSERT_TRUE(ui_spool_cache_get_k_profile("spool-AA01", "P1", &profile));
+    TEST_ASSERT_EQUAL_STRING("0.020", profile.k_value);
+    TEST_ASSERT_EQUAL_INT(2, backend_k_profile_calls);
+}
+
+// ============================================================================
+// Expiry and Eviction Tests
+// ============================================================================
+
+void test_cache_entries_expire(void) {
+    reset_cache();
+    SpoolInfoC info;
+    ui_spool_cache_get_by_tag("AA01", &info);
+    ui_spool_cache_get_by_tag("BB01", &info);
+
+    mock_lvgl_advance_tick(UI_SPOOL_CACHE_MISS_TTL_MS);
+    ui_spool_cache_get_by_tag("AA01", &info);
+    ui_spool_cache_get_by_tag("BB01", &info);
+    TEST_ASSERT_EQUAL_INT(3, backend_spool_calls);
+
+    mock_lvgl_advance_tick(UI_SPOOL_CACHE_TTL_MS);
+    ui_spool_cache_get_by_tag("AA01", &info);
+    TEST_ASSERT_EQUAL_INT(4, backend_spool_calls);
+}
+
+void test_cache_evicts_least_recently_used(void) {
+    reset_cache();
+    SpoolInfoC info;
+    char tag[8];
+    for (int i = 0; i < UI_SPOOL_CACHE_SPOOLS; i++) {
+        snprintf(tag, sizeof(tag), "AA%02d", i);
+        ui_spool_cache_get_by_tag(tag, &info);
+    }
+    ui_spool_cache_get_by_tag("AA00", &info);     // Now AA01 is the oldest
+    ui_spool_cache_get_by_tag("AAXX", &info);     // Evicts AA01
+    TEST_ASSERT_EQUAL_INT(UI_SPOOL_CACHE_SPOOLS + 1, backend_spool_calls);
+
+    ui_spool_cache_get_by_tag("AA00", &info);
+    TEST_ASSERT_EQUAL_INT(UI_SPOOL_CACHE_SPOOLS + 1, backend_spool_calls);
+    ui_spool_cache_get_by_tag("AA01", &info);
+    TEST_ASSERT_EQUAL_INT(UI_SPOOL_CACHE_SPOOLS + 2, backend_spool_calls);
+}
+
+// ============================================================================
+// Invalidation Tests
+// ============================================================================
+
+void test_cache_invalidate_spool_refetches(void) {
+    reset_cache();
+    SpoolInfoC info;
+    SpoolKProfileC profile;
+    ui_spool_cache_get_by_tag("AA01", &info);
+    ui_spool_cache_get_k_profile("spool-AA01", "P1", &profile);
+
+    backend_weight = 750;
+    ui_spool_cache_invalidate_spool("spool-AA01");
+    ui_spool_cache_get_by_tag("AA01", &info);
+    ui_spool_cache_get_k_profile("spool-AA01", "P1", &profile);
+    TEST_ASSERT_EQUAL_INT(750, info.weight_current);
+    TEST_ASSERT_EQUAL_INT(2, backend_spool_calls);
+    TEST_ASSERT_EQUAL_INT(2, backend_k_profile_calls);
+}
+
+void test_cache_invalidate_tag_keeps_others(void) {
+    reset_cache();
+    SpoolInfoC info;
+    ui_spool_cache_get_by_tag("AA01", &info);
+    ui_spool_cache_get_by_tag("AA02", &info);
+
+    ui_spool_cache_invalidate_tag("AA01");
+    ui_spool_cache_get_by_tag("AA01", &info);
+    ui_spool_cache_get_by_tag("AA02", &info);
+    TEST_ASSERT_EQUAL_INT(3, backend_spool_calls);
+}
+
+// ============================================================================
+// Test Suite Runner
+// ============================================================================
+
+void run_spool_cache_tests(void) {
+    // Lookup tests
+    RUN_TEST(test_cache_second_lookup_hits);
+    RUN_TEST(test_cache_remembers_unknown_tag);
+    RUN_TEST(test_cache_k_profile_keyed_by_printer);
+
+    // Expiry and eviction tests
+    RUN_TEST(test_cache_entries_expire);
+    RUN_TEST(test_cache_evicts_least_recently_used);
+
+    // Invalidation tests
+    RUN_TEST(test_cache_invalidate_spool_refetches);
+    RUN_TEST(test_cache_invalidate_tag_keeps_others);
+}
@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_ams_strip.c
\ No newline at end of file
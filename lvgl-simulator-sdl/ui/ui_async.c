@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_async.c
\ No newline at end of file
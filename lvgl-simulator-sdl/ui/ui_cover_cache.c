@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_cover_cache.c
\ No newline at end of file
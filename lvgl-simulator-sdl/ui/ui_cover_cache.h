@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_cover_cache.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_mem.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_preset_search.h
\ No newline at end of file
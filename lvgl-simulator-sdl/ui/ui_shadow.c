@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_shadow.c
\ No newline at end of file
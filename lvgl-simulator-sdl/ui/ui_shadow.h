@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_shadow.h
\ No newline at end of file
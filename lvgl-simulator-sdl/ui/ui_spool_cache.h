@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_spool_cache.h
\ No newline at end of file
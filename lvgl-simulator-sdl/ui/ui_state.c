@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_state.c
\ No newline at end of file
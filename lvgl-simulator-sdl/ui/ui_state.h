@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_state.h
\ No newline at end of file